@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/checkpoint_demo.dir/src/main.cpp.o"
+  "CMakeFiles/checkpoint_demo.dir/src/main.cpp.o.d"
+  "bin/checkpoint_demo"
+  "bin/checkpoint_demo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/checkpoint_demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
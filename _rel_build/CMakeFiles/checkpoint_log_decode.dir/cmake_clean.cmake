@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/checkpoint_log_decode.dir/src/cli/log_decode_cli.cpp.o"
+  "CMakeFiles/checkpoint_log_decode.dir/src/cli/log_decode_cli.cpp.o.d"
+  "bin/checkpoint_log_decode"
+  "bin/checkpoint_log_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/checkpoint_log_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
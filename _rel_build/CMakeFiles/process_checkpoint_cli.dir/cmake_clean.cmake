@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/process_checkpoint_cli.dir/src/cli/process_checkpoint_cli.cpp.o"
+  "CMakeFiles/process_checkpoint_cli.dir/src/cli/process_checkpoint_cli.cpp.o.d"
+  "bin/process_checkpoint_cli"
+  "bin/process_checkpoint_cli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/process_checkpoint_cli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
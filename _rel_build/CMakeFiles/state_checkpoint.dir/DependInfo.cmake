@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/checksum.cpp" "CMakeFiles/state_checkpoint.dir/src/core/checksum.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/checksum.cpp.o.d"
+  "/root/repo/src/core/codec.cpp" "CMakeFiles/state_checkpoint.dir/src/core/codec.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/codec.cpp.o.d"
+  "/root/repo/src/core/io_engine.cpp" "CMakeFiles/state_checkpoint.dir/src/core/io_engine.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/io_engine.cpp.o.d"
+  "/root/repo/src/core/metrics.cpp" "CMakeFiles/state_checkpoint.dir/src/core/metrics.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/metrics.cpp.o.d"
+  "/root/repo/src/core/serializer.cpp" "CMakeFiles/state_checkpoint.dir/src/core/serializer.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/serializer.cpp.o.d"
+  "/root/repo/src/core/shared_buffer.cpp" "CMakeFiles/state_checkpoint.dir/src/core/shared_buffer.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/core/shared_buffer.cpp.o.d"
+  "/root/repo/src/logger/binary_log.cpp" "CMakeFiles/state_checkpoint.dir/src/logger/binary_log.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/logger/binary_log.cpp.o.d"
+  "/root/repo/src/logger/operation_logger.cpp" "CMakeFiles/state_checkpoint.dir/src/logger/operation_logger.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/logger/operation_logger.cpp.o.d"
+  "/root/repo/src/real_process/aslr_handler.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/aslr_handler.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/aslr_handler.cpp.o.d"
+  "/root/repo/src/real_process/checkpoint_daemon.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_daemon.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_daemon.cpp.o.d"
+  "/root/repo/src/real_process/checkpoint_image.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_image.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_image.cpp.o.d"
+  "/root/repo/src/real_process/checkpoint_stream.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_stream.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_stream.cpp.o.d"
+  "/root/repo/src/real_process/dump_buffer_pool.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/dump_buffer_pool.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/dump_buffer_pool.cpp.o.d"
+  "/root/repo/src/real_process/fd_restorer.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/fd_restorer.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/fd_restorer.cpp.o.d"
+  "/root/repo/src/real_process/file_backup.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/file_backup.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/file_backup.cpp.o.d"
+  "/root/repo/src/real_process/file_operation.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/file_operation.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/file_operation.cpp.o.d"
+  "/root/repo/src/real_process/group_checkpoint.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/group_checkpoint.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/group_checkpoint.cpp.o.d"
+  "/root/repo/src/real_process/lazy_restore.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/lazy_restore.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/lazy_restore.cpp.o.d"
+  "/root/repo/src/real_process/live_migration.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/live_migration.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/live_migration.cpp.o.d"
+  "/root/repo/src/real_process/memory_manager.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/memory_manager.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/memory_manager.cpp.o.d"
+  "/root/repo/src/real_process/page_store.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/page_store.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/page_store.cpp.o.d"
+  "/root/repo/src/real_process/parasite.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/parasite.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/parasite.cpp.o.d"
+  "/root/repo/src/real_process/proc_reader.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/proc_reader.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/proc_reader.cpp.o.d"
+  "/root/repo/src/real_process/ptrace_controller.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/ptrace_controller.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/ptrace_controller.cpp.o.d"
+  "/root/repo/src/real_process/real_process_types.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/real_process_types.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/real_process_types.cpp.o.d"
+  "/root/repo/src/real_process/reverse_executor.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/reverse_executor.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/reverse_executor.cpp.o.d"
+  "/root/repo/src/real_process/tracee_supervisor.cpp" "CMakeFiles/state_checkpoint.dir/src/real_process/tracee_supervisor.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/real_process/tracee_supervisor.cpp.o.d"
+  "/root/repo/src/rollback/rollback_engine.cpp" "CMakeFiles/state_checkpoint.dir/src/rollback/rollback_engine.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/rollback/rollback_engine.cpp.o.d"
+  "/root/repo/src/rollback/state_delta.cpp" "CMakeFiles/state_checkpoint.dir/src/rollback/state_delta.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/rollback/state_delta.cpp.o.d"
+  "/root/repo/src/state/checkpoint_index.cpp" "CMakeFiles/state_checkpoint.dir/src/state/checkpoint_index.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/checkpoint_index.cpp.o.d"
+  "/root/repo/src/state/integrity_scrubber.cpp" "CMakeFiles/state_checkpoint.dir/src/state/integrity_scrubber.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/integrity_scrubber.cpp.o.d"
+  "/root/repo/src/state/log_storage.cpp" "CMakeFiles/state_checkpoint.dir/src/state/log_storage.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/log_storage.cpp.o.d"
+  "/root/repo/src/state/sharded_state_manager.cpp" "CMakeFiles/state_checkpoint.dir/src/state/sharded_state_manager.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/sharded_state_manager.cpp.o.d"
+  "/root/repo/src/state/state_manager.cpp" "CMakeFiles/state_checkpoint.dir/src/state/state_manager.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/state_manager.cpp.o.d"
+  "/root/repo/src/state/storage.cpp" "CMakeFiles/state_checkpoint.dir/src/state/storage.cpp.o" "gcc" "CMakeFiles/state_checkpoint.dir/src/state/storage.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
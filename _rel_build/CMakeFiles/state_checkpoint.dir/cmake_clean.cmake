@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/state_checkpoint.dir/src/core/checksum.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/checksum.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/core/codec.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/codec.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/core/io_engine.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/io_engine.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/core/metrics.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/metrics.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/core/serializer.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/serializer.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/core/shared_buffer.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/core/shared_buffer.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/logger/binary_log.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/logger/binary_log.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/logger/operation_logger.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/logger/operation_logger.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/aslr_handler.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/aslr_handler.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_daemon.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_daemon.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_image.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_image.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_stream.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/checkpoint_stream.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/dump_buffer_pool.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/dump_buffer_pool.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/fd_restorer.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/fd_restorer.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/file_backup.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/file_backup.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/file_operation.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/file_operation.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/group_checkpoint.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/group_checkpoint.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/lazy_restore.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/lazy_restore.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/live_migration.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/live_migration.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/memory_manager.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/memory_manager.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/page_store.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/page_store.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/parasite.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/parasite.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/proc_reader.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/proc_reader.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/ptrace_controller.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/ptrace_controller.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/real_process_types.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/real_process_types.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/reverse_executor.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/reverse_executor.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/tracee_supervisor.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/real_process/tracee_supervisor.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/rollback/rollback_engine.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/rollback/rollback_engine.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/rollback/state_delta.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/rollback/state_delta.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/checkpoint_index.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/checkpoint_index.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/integrity_scrubber.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/integrity_scrubber.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/log_storage.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/log_storage.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/sharded_state_manager.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/sharded_state_manager.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/state_manager.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/state_manager.cpp.o.d"
+  "CMakeFiles/state_checkpoint.dir/src/state/storage.cpp.o"
+  "CMakeFiles/state_checkpoint.dir/src/state/storage.cpp.o.d"
+  "lib/libstate_checkpoint.a"
+  "lib/libstate_checkpoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/state_checkpoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/checkpoint_bench"
+  "../bin/checkpoint_bench.pdb"
+  "CMakeFiles/checkpoint_bench.dir/checkpoint_bench.cpp.o"
+  "CMakeFiles/checkpoint_bench.dir/checkpoint_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/checkpoint_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks
+# Build directory: /root/repo/_rel_build/benchmarks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[checkpoint_bench_smoke]=] "/root/repo/_rel_build/bin/checkpoint_bench" "--smoke" "--json" "/root/repo/_rel_build/benchmarks/bench_smoke.json")
+set_tests_properties([=[checkpoint_bench_smoke]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/benchmarks/CMakeLists.txt;12;add_test;/root/repo/benchmarks/CMakeLists.txt;0;")
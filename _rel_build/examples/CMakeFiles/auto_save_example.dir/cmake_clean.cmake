@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/auto_save_example"
+  "../bin/auto_save_example.pdb"
+  "CMakeFiles/auto_save_example.dir/auto_save_example.cpp.o"
+  "CMakeFiles/auto_save_example.dir/auto_save_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/auto_save_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
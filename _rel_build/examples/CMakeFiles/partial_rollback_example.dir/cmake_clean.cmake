@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/partial_rollback_example"
+  "../bin/partial_rollback_example.pdb"
+  "CMakeFiles/partial_rollback_example.dir/partial_rollback_example.cpp.o"
+  "CMakeFiles/partial_rollback_example.dir/partial_rollback_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partial_rollback_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
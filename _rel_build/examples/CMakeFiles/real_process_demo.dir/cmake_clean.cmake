@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/real_process_demo"
+  "../bin/real_process_demo.pdb"
+  "CMakeFiles/real_process_demo.dir/real_process_demo.cpp.o"
+  "CMakeFiles/real_process_demo.dir/real_process_demo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/real_process_demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/real_restore_test"
+  "../bin/real_restore_test.pdb"
+  "CMakeFiles/real_restore_test.dir/real_restore_test.cpp.o"
+  "CMakeFiles/real_restore_test.dir/real_restore_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/real_restore_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
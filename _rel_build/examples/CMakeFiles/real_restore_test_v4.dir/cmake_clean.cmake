@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/real_restore_test_v4"
+  "../bin/real_restore_test_v4.pdb"
+  "CMakeFiles/real_restore_test_v4.dir/real_restore_test_v4.cpp.o"
+  "CMakeFiles/real_restore_test_v4.dir/real_restore_test_v4.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/real_restore_test_v4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
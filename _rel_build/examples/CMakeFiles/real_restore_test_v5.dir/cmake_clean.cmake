@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/real_restore_test_v5"
+  "../bin/real_restore_test_v5.pdb"
+  "CMakeFiles/real_restore_test_v5.dir/real_restore_test_v5.cpp.o"
+  "CMakeFiles/real_restore_test_v5.dir/real_restore_test_v5.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/real_restore_test_v5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
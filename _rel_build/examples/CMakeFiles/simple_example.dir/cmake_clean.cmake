@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/simple_example"
+  "../bin/simple_example.pdb"
+  "CMakeFiles/simple_example.dir/simple_example.cpp.o"
+  "CMakeFiles/simple_example.dir/simple_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
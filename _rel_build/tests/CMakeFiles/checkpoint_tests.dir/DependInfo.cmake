@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_file_operation_advanced.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_file_operation_advanced.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_file_operation_advanced.cpp.o.d"
+  "/root/repo/tests/test_integration.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_integration.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_integration.cpp.o.d"
+  "/root/repo/tests/test_logger.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_logger.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_logger.cpp.o.d"
+  "/root/repo/tests/test_real_process_checkpoint.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_real_process_checkpoint.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_real_process_checkpoint.cpp.o.d"
+  "/root/repo/tests/test_reverse_execution.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_reverse_execution.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_reverse_execution.cpp.o.d"
+  "/root/repo/tests/test_rollback.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_rollback.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_rollback.cpp.o.d"
+  "/root/repo/tests/test_serializer.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_serializer.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_serializer.cpp.o.d"
+  "/root/repo/tests/test_state_manager.cpp" "tests/CMakeFiles/checkpoint_tests.dir/test_state_manager.cpp.o" "gcc" "tests/CMakeFiles/checkpoint_tests.dir/test_state_manager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/state_checkpoint.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+file(REMOVE_RECURSE
+  "../bin/checkpoint_tests"
+  "../bin/checkpoint_tests.pdb"
+  "CMakeFiles/checkpoint_tests.dir/test_file_operation_advanced.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_file_operation_advanced.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_integration.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_integration.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_logger.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_logger.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_real_process_checkpoint.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_real_process_checkpoint.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_reverse_execution.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_reverse_execution.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_rollback.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_rollback.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_serializer.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_serializer.cpp.o.d"
+  "CMakeFiles/checkpoint_tests.dir/test_state_manager.cpp.o"
+  "CMakeFiles/checkpoint_tests.dir/test_state_manager.cpp.o.d"
+  "checkpoint_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/checkpoint_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
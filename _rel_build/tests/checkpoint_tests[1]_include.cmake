@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_rel_build/tests/checkpoint_tests[1]_tests.cmake")
+  include("/root/repo/_rel_build/tests/checkpoint_tests[1]_tests.cmake")
+else()
+  add_test(checkpoint_tests_NOT_BUILT checkpoint_tests_NOT_BUILT)
+endif()
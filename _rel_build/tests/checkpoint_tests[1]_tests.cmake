@@ -0,0 +1,529 @@
+add_test([=[SerializerTest.BinarySerializeDeserialize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BinarySerializeDeserialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BinarySerializeDeserialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.BinarySerializeObject]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BinarySerializeObject]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BinarySerializeObject]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.ChecksumCalculation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.ChecksumCalculation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.ChecksumCalculation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.ChecksumVerification]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.ChecksumVerification]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.ChecksumVerification]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.CompressDecompress]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.CompressDecompress]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.CompressDecompress]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.EmptyDataHandling]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.EmptyDataHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.EmptyDataHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.JsonSerializeDeserialize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.JsonSerializeDeserialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.JsonSerializeDeserialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.JsonToString]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.JsonToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.JsonToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.LargeDataSerialization]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.LargeDataSerialization]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.LargeDataSerialization]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.DeserializeInsufficientBuffer]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.DeserializeInsufficientBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.DeserializeInsufficientBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.BinaryReaderWriterRoundTrip]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BinaryReaderWriterRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BinaryReaderWriterRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.BinaryReaderFailsOnTruncation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BinaryReaderFailsOnTruncation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BinaryReaderFailsOnTruncation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.SchemaRoundTripsNestedTypes]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.SchemaRoundTripsNestedTypes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.SchemaRoundTripsNestedTypes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.SchemaDiffCarriesOnlyChangedFields]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.SchemaDiffCarriesOnlyChangedFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.SchemaDiffCarriesOnlyChangedFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Lz4CodecRoundTrip]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Lz4CodecRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Lz4CodecRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Lz4CodecRejectsCorruptInput]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Lz4CodecRejectsCorruptInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Lz4CodecRejectsCorruptInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.BinaryCompressShrinksHeapLikeData]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BinaryCompressShrinksHeapLikeData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BinaryCompressShrinksHeapLikeData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.ParallelCompressMatchesSerial]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.ParallelCompressMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.ParallelCompressMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.DecompressRangeReadsAcrossChunks]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.DecompressRangeReadsAcrossChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.DecompressRangeReadsAcrossChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.IncompressibleChunksStoredRaw]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.IncompressibleChunksStoredRaw]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.IncompressibleChunksStoredRaw]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.JsonCompressDefaultsToPassthrough]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.JsonCompressDefaultsToPassthrough]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.JsonCompressDefaultsToPassthrough]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Crc32cKnownVector]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Crc32cKnownVector]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Crc32cKnownVector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Crc32cHardwareMatchesSoftware]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Crc32cHardwareMatchesSoftware]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Crc32cHardwareMatchesSoftware]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Crc32cStreamingMatchesOneShot]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Crc32cStreamingMatchesOneShot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Crc32cStreamingMatchesOneShot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.VerifyChecksumAcceptsLegacyCrc32]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.VerifyChecksumAcceptsLegacyCrc32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.VerifyChecksumAcceptsLegacyCrc32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.Xxhash64KnownVectors]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.Xxhash64KnownVectors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.Xxhash64KnownVectors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.AsyncFileWriterRoundTripOnBothBackends]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.AsyncFileWriterRoundTripOnBothBackends]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.AsyncFileWriterRoundTripOnBothBackends]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.AsyncFileWriterDirectIoTruncatesPadding]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.AsyncFileWriterDirectIoTruncatesPadding]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.AsyncFileWriterDirectIoTruncatesPadding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.SharedBufferSharesAndSlicesWithoutCopy]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.SharedBufferSharesAndSlicesWithoutCopy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.SharedBufferSharesAndSlicesWithoutCopy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.SharedBufferMapFileOutlivesUnlink]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.SharedBufferMapFileOutlivesUnlink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.SharedBufferMapFileOutlivesUnlink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SerializerTest.BufferArenaPacksSmallBuffers]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=SerializerTest.BufferArenaPacksSmallBuffers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SerializerTest.BufferArenaPacksSmallBuffers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CreateCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CreateCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CreateCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.GetCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.GetCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.GetCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.TruncatedCheckpointDeserializesAsCorrupted]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.TruncatedCheckpointDeserializesAsCorrupted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.TruncatedCheckpointDeserializesAsCorrupted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.GetNonExistentCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.GetNonExistentCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.GetNonExistentCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.UpdateCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.UpdateCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.UpdateCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.DeleteCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.DeleteCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.DeleteCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ListCheckpoints]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ListCheckpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ListCheckpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.GetLatestCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.GetLatestCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.GetLatestCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.GetCurrentState]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.GetCurrentState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.GetCurrentState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointIntegrity]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointIntegrity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointIntegrity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointValidity]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointValidity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointValidity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.PersistenceAcrossSessions]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.PersistenceAcrossSessions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.PersistenceAcrossSessions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.SaveAndLoadFromFile]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.SaveAndLoadFromFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.SaveAndLoadFromFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointCount]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.TotalStorageSize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.TotalStorageSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.TotalStorageSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.MemoryStorageBasic]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.MemoryStorageBasic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.MemoryStorageBasic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.EmptyCheckpointName]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.EmptyCheckpointName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.EmptyCheckpointName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.EmptyCheckpointData]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.EmptyCheckpointData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.EmptyCheckpointData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.LargeCheckpointData]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.LargeCheckpointData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.LargeCheckpointData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.HybridStorageWritesBackAndKeepsHotRecords]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.HybridStorageWritesBackAndKeepsHotRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.HybridStorageWritesBackAndKeepsHotRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.HybridStorageCompressedTier]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.HybridStorageCompressedTier]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.HybridStorageCompressedTier]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ChunkBoundariesResyncAfterInsert]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ChunkBoundariesResyncAfterInsert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ChunkBoundariesResyncAfterInsert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ChunkStorageDeduplicatesAcrossCheckpoints]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ChunkStorageDeduplicatesAcrossCheckpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ChunkStorageDeduplicatesAcrossCheckpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ChunkStorageRemoveCollectsUnreferencedChunks]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ChunkStorageRemoveCollectsUnreferencedChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ChunkStorageRemoveCollectsUnreferencedChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ChunkStorageDetectsCorruptChunk]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ChunkStorageDetectsCorruptChunk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ChunkStorageDetectsCorruptChunk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.StateManagerWithChunkStorage]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.StateManagerWithChunkStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.StateManagerWithChunkStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.StartupReadsIndexNotPayloads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.StartupReadsIndexNotPayloads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.StartupReadsIndexNotPayloads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.StaleIndexIsReconciledWithStorage]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.StaleIndexIsReconciledWithStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.StaleIndexIsReconciledWithStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ScrubberVerifiesIncrementallyAndPersistsState]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ScrubberVerifiesIncrementallyAndPersistsState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ScrubberVerifiesIncrementallyAndPersistsState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ScrubberReportsCorruptedRecord]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ScrubberReportsCorruptedRecord]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ScrubberReportsCorruptedRecord]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.AutoSaveSkipsUnchangedState]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.AutoSaveSkipsUnchangedState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.AutoSaveSkipsUnchangedState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.DeltaAutoSaveStoresOnlyChangedBlocks]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.DeltaAutoSaveStoresOnlyChangedBlocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.DeltaAutoSaveStoresOnlyChangedBlocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointCacheIsBounded]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointCacheIsBounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointCacheIsBounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.AsyncCheckpointIsReadableBeforeDurable]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.AsyncCheckpointIsReadableBeforeDurable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.AsyncCheckpointIsReadableBeforeDurable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.AsyncCheckpointsPersistAcrossSessions]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.AsyncCheckpointsPersistAcrossSessions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.AsyncCheckpointsPersistAcrossSessions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.AsyncCheckpointDeletedOrUpdatedBeforeWrite]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.AsyncCheckpointDeletedOrUpdatedBeforeWrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.AsyncCheckpointDeletedOrUpdatedBeforeWrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.LogStorageRoundTripAndReopen]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.LogStorageRoundTripAndReopen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.LogStorageRoundTripAndReopen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.LogStorageCoalescesConcurrentSaves]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.LogStorageCoalescesConcurrentSaves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.LogStorageCoalescesConcurrentSaves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.LogStorageTruncatesTornTail]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.LogStorageTruncatesTornTail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.LogStorageTruncatesTornTail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.LogStorageCompactionDropsRemovedRecords]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.LogStorageCompactionDropsRemovedRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.LogStorageCompactionDropsRemovedRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.StateManagerWithLogStorage]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.StateManagerWithLogStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.StateManagerWithLogStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.FileStorageParallelChunkedIo]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.FileStorageParallelChunkedIo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.FileStorageParallelChunkedIo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointHandlesAreSharedAndImmutable]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointHandlesAreSharedAndImmutable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointHandlesAreSharedAndImmutable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ShardedManagerConcurrentReadersAndWriters]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ShardedManagerConcurrentReadersAndWriters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ShardedManagerConcurrentReadersAndWriters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.ShardedManagerPersistsPerShard]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.ShardedManagerPersistsPerShard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.ShardedManagerPersistsPerShard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.MemoryStorageLoadSharesBuffer]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.MemoryStorageLoadSharesBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.MemoryStorageLoadSharesBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointDataIsSharedAcrossCopiesAndLoads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointDataIsSharedAcrossCopiesAndLoads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointDataIsSharedAcrossCopiesAndLoads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.FileStorageMappedLoadSurvivesOverwrite]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.FileStorageMappedLoadSurvivesOverwrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.FileStorageMappedLoadSurvivesOverwrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.TraceScopeRecordsStagesAndExportsOpenMetrics]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.TraceScopeRecordsStagesAndExportsOpenMetrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.TraceScopeRecordsStagesAndExportsOpenMetrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StateManagerTest.CheckpointOperationsAreTraced]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=StateManagerTest.CheckpointOperationsAreTraced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StateManagerTest.CheckpointOperationsAreTraced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogEntryToString]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogEntryToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogEntryToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogEntryWithFileInfo]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogEntryWithFileInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogEntryWithFileInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.TextFormatter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.TextFormatter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.TextFormatter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.JsonFormatter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.JsonFormatter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.JsonFormatter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.FileOutput]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.FileOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.FileOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BasicLogging]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BasicLogging]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BasicLogging]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogLevelFiltering]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogLevelFiltering]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogLevelFiltering]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogOperation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogOperation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogOperation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogOperationComplete]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogOperationComplete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogOperationComplete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.GetEntriesBetweenTimestamps]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.GetEntriesBetweenTimestamps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.GetEntriesBetweenTimestamps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.GetOperationsSince]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.GetOperationsSince]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.GetOperationsSince]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.ClearLogs]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.ClearLogs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.ClearLogs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogMacros]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogMacros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogMacros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.FileRotation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.FileRotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.FileRotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.ConcurrentLogging]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.ConcurrentLogging]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.ConcurrentLogging]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.MpscRingPreservesOrderAndReportsFull]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.MpscRingPreservesOrderAndReportsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.MpscRingPreservesOrderAndReportsFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.MpscRingConcurrentProducers]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.MpscRingConcurrentProducers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.MpscRingConcurrentProducers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.AsyncLoggingDeliversAllEntries]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.AsyncLoggingDeliversAllEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.AsyncLoggingDeliversAllEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.AsyncDropPolicyCountsOverflow]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.AsyncDropPolicyCountsOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.AsyncDropPolicyCountsOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BinaryLogRoundTripsEntries]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BinaryLogRoundTripsEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BinaryLogRoundTripsEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BinaryLogIsSmallerThanText]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BinaryLogIsSmallerThanText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BinaryLogIsSmallerThanText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BinaryOnlyOutputsSkipFormatting]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BinaryOnlyOutputsSkipFormatting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BinaryOnlyOutputsSkipFormatting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BinaryLogRendersTextAndJsonOffline]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BinaryLogRendersTextAndJsonOffline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BinaryLogRendersTextAndJsonOffline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.BinaryLogRotationKeepsFilesSelfContained]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.BinaryLogRotationKeepsFilesSelfContained]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.BinaryLogRotationKeepsFilesSelfContained]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.LogEntrySerializeRoundTrip]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.LogEntrySerializeRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.LogEntrySerializeRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.SegmentedHistoryTimeQueryToleratesSkew]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.SegmentedHistoryTimeQueryToleratesSkew]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.SegmentedHistoryTimeQueryToleratesSkew]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.RetentionEvictsOldSegmentsAndKeepsIndexes]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.RetentionEvictsOldSegmentsAndKeepsIndexes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.RetentionEvictsOldSegmentsAndKeepsIndexes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LoggerTest.GetOperationsSinceStartsAtFirstRelatedOperation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LoggerTest.GetOperationsSinceStartsAtFirstRelatedOperation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggerTest.GetOperationsSinceStartsAtFirstRelatedOperation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.CreateRollbackPlan]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.CreateRollbackPlan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.CreateRollbackPlan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.CreateRollbackPlanForNonExistent]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.CreateRollbackPlanForNonExistent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.CreateRollbackPlanForNonExistent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackPlanWithStrategy]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackPlanWithStrategy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackPlanWithStrategy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.ExecuteRollback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.ExecuteRollback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.ExecuteRollback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackToCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackToCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackToCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackToLatest]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackToLatest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackToLatest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackWithProgress]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackWithProgress]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackWithProgress]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.PreviewRollback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.PreviewRollback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.PreviewRollback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.UndoRollback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.UndoRollback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.UndoRollback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.CannotUndoWithoutRollback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.CannotUndoWithoutRollback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.CannotUndoWithoutRollback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.PartialRollback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.PartialRollback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.PartialRollback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.PartialRollbackWithFilter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.PartialRollbackWithFilter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.PartialRollbackWithFilter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackWithConfirmation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackWithConfirmation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackWithConfirmation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackCancelledByConfirmation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackCancelledByConfirmation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackCancelledByConfirmation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackStatistics]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackStatistics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackStatistics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.MaxUndoHistory]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.MaxUndoHistory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.MaxUndoHistory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.BlockDeltaRoundTripsAcrossSizeChanges]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.BlockDeltaRoundTripsAcrossSizeChanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.BlockDeltaRoundTripsAcrossSizeChanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.DeltaChainRewindsAndCompacts]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.DeltaChainRewindsAndCompacts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.DeltaChainRewindsAndCompacts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.IncrementalRollbackReplaysDeltasInReverse]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.IncrementalRollbackReplaysDeltasInReverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.IncrementalRollbackReplaysDeltasInReverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.IncrementalRollbackFallsBackWhenStateDiverges]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.IncrementalRollbackFallsBackWhenStateDiverges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.IncrementalRollbackFallsBackWhenStateDiverges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.FullRollbackSharesCheckpointBuffer]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.FullRollbackSharesCheckpointBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.FullRollbackSharesCheckpointBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.RollbackFieldsRestoresOnlyNamedFields]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.RollbackFieldsRestoresOnlyNamedFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.RollbackFieldsRestoresOnlyNamedFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RollbackTest.AutoRollbackReportsScrubberCorruption]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RollbackTest.AutoRollbackReportsScrubberCorruption]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RollbackTest.AutoRollbackReportsScrubberCorruption]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.FullWorkflow]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.FullWorkflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.FullWorkflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.ErrorRecoveryScenario]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.ErrorRecoveryScenario]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.ErrorRecoveryScenario]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.IncrementalCheckpoints]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.IncrementalCheckpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.IncrementalCheckpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.ConcurrentAccess]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.ConcurrentAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.ConcurrentAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.PersistenceAndRecovery]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.PersistenceAndRecovery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.PersistenceAndRecovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.LargeDataHandling]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.LargeDataHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.LargeDataHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.PartialRollbackScenario]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.PartialRollbackScenario]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.PartialRollbackScenario]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.RollbackChainScenario]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.RollbackChainScenario]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.RollbackChainScenario]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.StorageTypeComparison]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.StorageTypeComparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.StorageTypeComparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegrationTest.CompleteSystemTest]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=IntegrationTest.CompleteSystemTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegrationTest.CompleteSystemTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.SerializeDeserialize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.SerializeDeserialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.SerializeDeserialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.FileOpTypeToString]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.FileOpTypeToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.FileOpTypeToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.StringToFileOpType]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.StringToFileOpType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.StringToFileOpType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogRecordAndRetrieve]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogRecordAndRetrieve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogRecordAndRetrieve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogGetOperationsForFile]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogGetOperationsForFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogGetOperationsForFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogCheckpointMarker]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogCheckpointMarker]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogCheckpointMarker]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogSerializeDeserialize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogSerializeDeserialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogSerializeDeserialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerBasicTracking]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerBasicTracking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerBasicTracking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerCaptureFileContent]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerCaptureFileContent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerCaptureFileContent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerOptions]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerOptions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerOptions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseCreate]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseCreate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseCreate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseDelete]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseDelete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseDelete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseRename]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseRename]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseRename]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseWrite]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseWrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseWrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseTruncate]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseTruncate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseTruncate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.BatchReverse]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.BatchReverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.BatchReverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.PreviewReverse]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.PreviewReverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.PreviewReverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.DryRun]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.DryRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.DryRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.CannotReverseNonReversible]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.CannotReverseNonReversible]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.CannotReverseNonReversible]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.CannotReverseAlreadyReversed]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.CannotReverseAlreadyReversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.CannotReverseAlreadyReversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.FullWorkflow]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.FullWorkflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.FullWorkflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.InterceptorTrackedSyscallsFollowFlags]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.InterceptorTrackedSyscallsFollowFlags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.InterceptorTrackedSyscallsFollowFlags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerWritePreImageAndAppend]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerWritePreImageAndAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerWritePreImageAndAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerRejectsMismatchedAfterWrite]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerRejectsMismatchedAfterWrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerRejectsMismatchedAfterWrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.InterceptorCapturesWritesThroughFdTable]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.InterceptorCapturesWritesThroughFdTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.InterceptorCapturesWritesThroughFdTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.FileBackupStrategyCopiesWithoutFullBuffer]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.FileBackupStrategyCopiesWithoutFullBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.FileBackupStrategyCopiesWithoutFullBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.TrackerDiskBackupsForTruncateAndUnlink]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.TrackerDiskBackupsForTruncateAndUnlink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.TrackerDiskBackupsForTruncateAndUnlink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ByteRangeSetMergesAndSubtracts]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ByteRangeSetMergesAndSubtracts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ByteRangeSetMergesAndSubtracts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogCoalescesRewritesWithinEpoch]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogCoalescesRewritesWithinEpoch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogCoalescesRewritesWithinEpoch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.LogCoalescingResetsOnNonWriteAndKeepsGrowth]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.LogCoalescingResetsOnNonWriteAndKeepsGrowth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.LogCoalescingResetsOnNonWriteAndKeepsGrowth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.JournalPersistsAndRecoversOperations]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.JournalPersistsAndRecoversOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.JournalPersistsAndRecoversOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.JournalRotatesAtCheckpointsAndDropsSegments]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.JournalRotatesAtCheckpointsAndDropsSegments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.JournalRotatesAtCheckpointsAndDropsSegments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.JournalTruncatesTornTail]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.JournalTruncatesTornTail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.JournalTruncatesTornTail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ReverseDependenciesFollowPathsAndDirectories]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ReverseDependenciesFollowPathsAndDirectories]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ReverseDependenciesFollowPathsAndDirectories]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.ParallelReverseKeepsPerPathOrder]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.ParallelReverseKeepsPerPathOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.ParallelReverseKeepsPerPathOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileOperationTest.InterceptorSeccompStopsOnlyOnTrackedSyscalls]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=FileOperationTest.InterceptorSeccompStopsOnlyOnTrackedSyscalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileOperationTest.InterceptorSeccompStopsOnlyOnTrackedSyscalls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.SerializeEmptyOperation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.SerializeEmptyOperation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.SerializeEmptyOperation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.SerializeLargeContent]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.SerializeLargeContent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.SerializeLargeContent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.SerializeMultipleDiffs]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.SerializeMultipleDiffs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.SerializeMultipleDiffs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.SerializeSpecialCharactersInPath]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.SerializeSpecialCharactersInPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.SerializeSpecialCharactersInPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.OperationMemoryUsage]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.OperationMemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.OperationMemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.LogFilterOperations]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.LogFilterOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.LogFilterOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.LogFilterBySize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.LogFilterBySize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.LogFilterBySize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.LogMultipleCheckpoints]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.LogMultipleCheckpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.LogMultipleCheckpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.LogClearBeforeCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.LogClearBeforeCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.LogClearBeforeCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.LogPersistence]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.LogPersistence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.LogPersistence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.TrackerPathFiltering]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.TrackerPathFiltering]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.TrackerPathFiltering]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.TrackerExtensionFiltering]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.TrackerExtensionFiltering]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.TrackerExtensionFiltering]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.TrackerCapturePartialContent]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.TrackerCapturePartialContent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.TrackerCapturePartialContent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.TrackerMaxFileSizeLimit]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.TrackerMaxFileSizeLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.TrackerMaxFileSizeLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseWithDiffs]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseWithDiffs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseWithDiffs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseAppend]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseChmod]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseChmod]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseChmod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseMkdir]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseMkdir]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseMkdir]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseRmdir]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseRmdir]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseRmdir]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseSymlink]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseSymlink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseSymlink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseWithTypeFilter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseWithTypeFilter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseWithTypeFilter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseWithExcludeFilter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseWithExcludeFilter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseWithExcludeFilter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseWithCustomFilter]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseWithCustomFilter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseWithCustomFilter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseStopOnError]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseStopOnError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseStopOnError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseContinueOnError]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseContinueOnError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseContinueOnError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseValidation]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseValidation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseValidation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseStatistics]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseStatistics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseStatistics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseProgressCallback]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseProgressCallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseProgressCallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ReverseBinaryFile]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ReverseBinaryFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ReverseBinaryFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AdvancedFileOperationTest.ConcurrentLogAccess]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=AdvancedFileOperationTest.ConcurrentLogAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AdvancedFileOperationTest.ConcurrentLogAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.SerializeRoundTripKeepsChainFields]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.SerializeRoundTripKeepsChainFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.SerializeRoundTripKeepsChainFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MergeChainAppliesDirtyPages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MergeChainAppliesDirtyPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MergeChainAppliesDirtyPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MergeChainKeepsNewRegionsAndDropsUnmapped]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MergeChainKeepsNewRegionsAndDropsUnmapped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MergeChainKeepsNewRegionsAndDropsUnmapped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MergeChainRejectsBrokenChain]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MergeChainRejectsBrokenChain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MergeChainRejectsBrokenChain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.CompareCheckpointsReportsExactRanges]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.CompareCheckpointsReportsExactRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.CompareCheckpointsReportsExactRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.CompareCheckpointsHandlesResizeAndZeroFill]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.CompareCheckpointsHandlesResizeAndZeroFill]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.CompareCheckpointsHandlesResizeAndZeroFill]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.ZeroPageScanFindsLastByte]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.ZeroPageScanFindsLastByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.ZeroPageScanFindsLastByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.EliminateZeroPagesSplitsRuns]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.EliminateZeroPagesSplitsRuns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.EliminateZeroPagesSplitsRuns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.PageStoreSharesPagesAcrossCheckpoints]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.PageStoreSharesPagesAcrossCheckpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.PageStoreSharesPagesAcrossCheckpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MergeChainAppliesZeroFillRuns]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MergeChainAppliesZeroFillRuns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MergeChainAppliesZeroFillRuns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.RelocatePointersUsesRegionTable]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.RelocatePointersUsesRegionTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.RelocatePointersUsesRegionTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MapsLineParserHandlesAllFields]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MapsLineParserHandlesAllFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MapsLineParserHandlesAllFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MapQueryMatchesTextMaps]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MapQueryMatchesTextMaps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MapQueryMatchesTextMaps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.MapsCacheSharesSnapshotUntilInvalidated]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.MapsCacheSharesSnapshotUntilInvalidated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.MapsCacheSharesSnapshotUntilInvalidated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.SmapsReportsTransparentHugePages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.SmapsReportsTransparentHugePages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.SmapsReportsTransparentHugePages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.StreamWriterOutputMatchesDeserialize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.StreamWriterOutputMatchesDeserialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.StreamWriterOutputMatchesDeserialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.SaveLoadThroughIoEngine]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.SaveLoadThroughIoEngine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.SaveLoadThroughIoEngine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.StreamReaderSkipsPayloads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.StreamReaderSkipsPayloads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.StreamReaderSkipsPayloads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.IndexedImageMapsAlignedPayloads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.IndexedImageMapsAlignedPayloads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.IndexedImageMapsAlignedPayloads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.IndexedImageKeepsThreads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.IndexedImageKeepsThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.IndexedImageKeepsThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RealProcessCheckpointTest.IndexedImageRejectsTruncatedFile]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RealProcessCheckpointTest.IndexedImageRejectsTruncatedFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RealProcessCheckpointTest.IndexedImageRejectsTruncatedFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.DumpSkipsUnreadablePages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.DumpSkipsUnreadablePages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.DumpSkipsUnreadablePages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.RestoreWritesAllDumps]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.RestoreWritesAllDumps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.RestoreWritesAllDumps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.ParallelDumpMatchesSerial]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.ParallelDumpMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.ParallelDumpMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.ForkSnapshotDumpsChildCopy]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.ForkSnapshotDumpsChildCopy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.ForkSnapshotDumpsChildCopy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.CreateCheckpointToFileStreamsDumps]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.CreateCheckpointToFileStreamsDumps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.CreateCheckpointToFileStreamsDumps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.RepeatedDumpsReuseBufferPool]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.RepeatedDumpsReuseBufferPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.RepeatedDumpsReuseBufferPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.CheckpointTraceRecordsStagesAndIo]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.CheckpointTraceRecordsStagesAndIo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.CheckpointTraceRecordsStagesAndIo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.LiveMigrationPreCopiesAndRestoresIntoTarget]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.LiveMigrationPreCopiesAndRestoresIntoTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.LiveMigrationPreCopiesAndRestoresIntoTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.LiveMigrationCarriesPagesDiscardedBetweenRounds]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.LiveMigrationCarriesPagesDiscardedBetweenRounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.LiveMigrationCarriesPagesDiscardedBetweenRounds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.LiveMigrationResumesSourceWhenRestoreFails]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.LiveMigrationResumesSourceWhenRestoreFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.LiveMigrationResumesSourceWhenRestoreFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.RestoreFromMappedImage]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.RestoreFromMappedImage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.RestoreFromMappedImage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.RestoreMapsImagePayloadsIntoTarget]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.RestoreMapsImagePayloadsIntoTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.RestoreMapsImagePayloadsIntoTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.CheckpointKeepsWritesToMappedImagePayloads]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.CheckpointKeepsWritesToMappedImagePayloads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.CheckpointKeepsWritesToMappedImagePayloads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.RestoreFromPageStoreAndZeroFill]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.RestoreFromPageStoreAndZeroFill]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.RestoreFromPageStoreAndZeroFill]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.IncrementalCheckpointCapturesWrittenAndDiscardedPages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.IncrementalCheckpointCapturesWrittenAndDiscardedPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.IncrementalCheckpointCapturesWrittenAndDiscardedPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.DeltaRestoreWritesOnlyChangedPages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.DeltaRestoreWritesOnlyChangedPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.DeltaRestoreWritesOnlyChangedPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.DeltaRestoreRewritesDiscardedPages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.DeltaRestoreRewritesDiscardedPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.DeltaRestoreRewritesDiscardedPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.DeltaRestoreComparesBytesNotHashes]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.DeltaRestoreComparesBytesNotHashes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.DeltaRestoreComparesBytesNotHashes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.ParasiteRunsBatchInOneRoundTrip]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.ParasiteRunsBatchInOneRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.ParasiteRunsBatchInOneRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchedMemoryTest.ParasiteSplitsLargeBatchesAndRestoresFds]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=BatchedMemoryTest.ParasiteSplitsLargeBatchesAndRestoresFds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchedMemoryTest.ParasiteSplitsLargeBatchesAndRestoresFds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DumpBufferPoolTest.ReusesRecycledBuffersWithinLimit]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=DumpBufferPoolTest.ReusesRecycledBuffersWithinLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DumpBufferPoolTest.ReusesRecycledBuffersWithinLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MigrationReceiverTest.RejectsDataFrameLargerThanChunkSize]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=MigrationReceiverTest.RejectsDataFrameLargerThanChunkSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MigrationReceiverTest.RejectsDataFrameLargerThanChunkSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MigrationReceiverTest.CapsRoundSizeAndTimesOutOnStalledPeer]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=MigrationReceiverTest.CapsRoundSizeAndTimesOutOnStalledPeer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MigrationReceiverTest.CapsRoundSizeAndTimesOutOnStalledPeer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ZeroPageRestoreTest.DiscardZeroPagesUsesMadvise]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=ZeroPageRestoreTest.DiscardZeroPagesUsesMadvise]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ZeroPageRestoreTest.DiscardZeroPagesUsesMadvise]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HugePageRestoreTest.PrefaultsHugePagesBeforeWriting]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=HugePageRestoreTest.PrefaultsHugePagesBeforeWriting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HugePageRestoreTest.PrefaultsHugePagesBeforeWriting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LazyRestoreTest.ServesFaultsFromCheckpoint]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LazyRestoreTest.ServesFaultsFromCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LazyRestoreTest.ServesFaultsFromCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LazyRestoreTest.PrefetchCompletesInBackground]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=LazyRestoreTest.PrefetchCompletesInBackground]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LazyRestoreTest.PrefetchCompletesInBackground]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadGroupCheckpointTest.FreezesAndRestoresEveryThread]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=ThreadGroupCheckpointTest.FreezesAndRestoresEveryThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadGroupCheckpointTest.FreezesAndRestoresEveryThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceeSupervisorTest.InterruptsDumpsAndResumesManyTracees]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=TraceeSupervisorTest.InterruptsDumpsAndResumesManyTracees]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TraceeSupervisorTest.InterruptsDumpsAndResumesManyTracees]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GroupCheckpointTest.DumpsWholeTreeAndSharesForkedPages]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=GroupCheckpointTest.DumpsWholeTreeAndSharesForkedPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GroupCheckpointTest.DumpsWholeTreeAndSharesForkedPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GroupCheckpointTest.FreezesDedicatedCgroup]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=GroupCheckpointTest.FreezesDedicatedCgroup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GroupCheckpointTest.FreezesDedicatedCgroup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DaemonPolicyTest.ParsesJobsAndLimits]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=DaemonPolicyTest.ParsesJobsAndLimits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DaemonPolicyTest.ParsesJobsAndLimits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateLimiterTest.ReservationsWaitForDebt]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=RateLimiterTest.ReservationsWaitForDebt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RateLimiterTest.ReservationsWaitForDebt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointDaemonTest.SchedulesSnapshotsServesControlAndPrunes]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=CheckpointDaemonTest.SchedulesSnapshotsServesControlAndPrunes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointDaemonTest.SchedulesSnapshotsServesControlAndPrunes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointDaemonTest.ControlSocketIsPrivateAndNeverReplacesFiles]=]  /root/repo/_rel_build/bin/checkpoint_tests [==[--gtest_filter=CheckpointDaemonTest.ControlSocketIsPrivateAndNeverReplacesFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointDaemonTest.ControlSocketIsPrivateAndNeverReplacesFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  checkpoint_tests_TESTS SerializerTest.BinarySerializeDeserialize SerializerTest.BinarySerializeObject SerializerTest.ChecksumCalculation SerializerTest.ChecksumVerification SerializerTest.CompressDecompress SerializerTest.EmptyDataHandling SerializerTest.JsonSerializeDeserialize SerializerTest.JsonToString SerializerTest.LargeDataSerialization SerializerTest.DeserializeInsufficientBuffer SerializerTest.BinaryReaderWriterRoundTrip SerializerTest.BinaryReaderFailsOnTruncation SerializerTest.SchemaRoundTripsNestedTypes SerializerTest.SchemaDiffCarriesOnlyChangedFields SerializerTest.Lz4CodecRoundTrip SerializerTest.Lz4CodecRejectsCorruptInput SerializerTest.BinaryCompressShrinksHeapLikeData SerializerTest.ParallelCompressMatchesSerial SerializerTest.DecompressRangeReadsAcrossChunks SerializerTest.IncompressibleChunksStoredRaw SerializerTest.JsonCompressDefaultsToPassthrough SerializerTest.Crc32cKnownVector SerializerTest.Crc32cHardwareMatchesSoftware SerializerTest.Crc32cStreamingMatchesOneShot SerializerTest.VerifyChecksumAcceptsLegacyCrc32 SerializerTest.Xxhash64KnownVectors SerializerTest.AsyncFileWriterRoundTripOnBothBackends SerializerTest.AsyncFileWriterDirectIoTruncatesPadding SerializerTest.SharedBufferSharesAndSlicesWithoutCopy SerializerTest.SharedBufferMapFileOutlivesUnlink SerializerTest.BufferArenaPacksSmallBuffers StateManagerTest.CreateCheckpoint StateManagerTest.GetCheckpoint StateManagerTest.TruncatedCheckpointDeserializesAsCorrupted StateManagerTest.GetNonExistentCheckpoint StateManagerTest.UpdateCheckpoint StateManagerTest.DeleteCheckpoint StateManagerTest.ListCheckpoints StateManagerTest.GetLatestCheckpoint StateManagerTest.GetCurrentState StateManagerTest.CheckpointIntegrity StateManagerTest.CheckpointValidity StateManagerTest.PersistenceAcrossSessions StateManagerTest.SaveAndLoadFromFile StateManagerTest.CheckpointCount StateManagerTest.TotalStorageSize StateManagerTest.MemoryStorageBasic StateManagerTest.EmptyCheckpointName StateManagerTest.EmptyCheckpointData StateManagerTest.LargeCheckpointData StateManagerTest.HybridStorageWritesBackAndKeepsHotRecords StateManagerTest.HybridStorageCompressedTier StateManagerTest.ChunkBoundariesResyncAfterInsert StateManagerTest.ChunkStorageDeduplicatesAcrossCheckpoints StateManagerTest.ChunkStorageRemoveCollectsUnreferencedChunks StateManagerTest.ChunkStorageDetectsCorruptChunk StateManagerTest.StateManagerWithChunkStorage StateManagerTest.StartupReadsIndexNotPayloads StateManagerTest.StaleIndexIsReconciledWithStorage StateManagerTest.ScrubberVerifiesIncrementallyAndPersistsState StateManagerTest.ScrubberReportsCorruptedRecord StateManagerTest.AutoSaveSkipsUnchangedState StateManagerTest.DeltaAutoSaveStoresOnlyChangedBlocks StateManagerTest.CheckpointCacheIsBounded StateManagerTest.AsyncCheckpointIsReadableBeforeDurable StateManagerTest.AsyncCheckpointsPersistAcrossSessions StateManagerTest.AsyncCheckpointDeletedOrUpdatedBeforeWrite StateManagerTest.LogStorageRoundTripAndReopen StateManagerTest.LogStorageCoalescesConcurrentSaves StateManagerTest.LogStorageTruncatesTornTail StateManagerTest.LogStorageCompactionDropsRemovedRecords StateManagerTest.StateManagerWithLogStorage StateManagerTest.FileStorageParallelChunkedIo StateManagerTest.CheckpointHandlesAreSharedAndImmutable StateManagerTest.ShardedManagerConcurrentReadersAndWriters StateManagerTest.ShardedManagerPersistsPerShard StateManagerTest.MemoryStorageLoadSharesBuffer StateManagerTest.CheckpointDataIsSharedAcrossCopiesAndLoads StateManagerTest.FileStorageMappedLoadSurvivesOverwrite StateManagerTest.TraceScopeRecordsStagesAndExportsOpenMetrics StateManagerTest.CheckpointOperationsAreTraced LoggerTest.LogEntryToString LoggerTest.LogEntryWithFileInfo LoggerTest.TextFormatter LoggerTest.JsonFormatter LoggerTest.FileOutput LoggerTest.BasicLogging LoggerTest.LogLevelFiltering LoggerTest.LogOperation LoggerTest.LogOperationComplete LoggerTest.GetEntriesBetweenTimestamps LoggerTest.GetOperationsSince LoggerTest.ClearLogs LoggerTest.LogMacros LoggerTest.FileRotation LoggerTest.ConcurrentLogging LoggerTest.MpscRingPreservesOrderAndReportsFull LoggerTest.MpscRingConcurrentProducers LoggerTest.AsyncLoggingDeliversAllEntries LoggerTest.AsyncDropPolicyCountsOverflow LoggerTest.BinaryLogRoundTripsEntries LoggerTest.BinaryLogIsSmallerThanText LoggerTest.BinaryOnlyOutputsSkipFormatting LoggerTest.BinaryLogRendersTextAndJsonOffline LoggerTest.BinaryLogRotationKeepsFilesSelfContained LoggerTest.LogEntrySerializeRoundTrip LoggerTest.SegmentedHistoryTimeQueryToleratesSkew LoggerTest.RetentionEvictsOldSegmentsAndKeepsIndexes LoggerTest.GetOperationsSinceStartsAtFirstRelatedOperation RollbackTest.CreateRollbackPlan RollbackTest.CreateRollbackPlanForNonExistent RollbackTest.RollbackPlanWithStrategy RollbackTest.ExecuteRollback RollbackTest.RollbackToCheckpoint RollbackTest.RollbackToLatest RollbackTest.RollbackWithProgress RollbackTest.PreviewRollback RollbackTest.UndoRollback RollbackTest.CannotUndoWithoutRollback RollbackTest.PartialRollback RollbackTest.PartialRollbackWithFilter RollbackTest.RollbackWithConfirmation RollbackTest.RollbackCancelledByConfirmation RollbackTest.RollbackStatistics RollbackTest.MaxUndoHistory RollbackTest.BlockDeltaRoundTripsAcrossSizeChanges RollbackTest.DeltaChainRewindsAndCompacts RollbackTest.IncrementalRollbackReplaysDeltasInReverse RollbackTest.IncrementalRollbackFallsBackWhenStateDiverges RollbackTest.FullRollbackSharesCheckpointBuffer RollbackTest.RollbackFieldsRestoresOnlyNamedFields RollbackTest.AutoRollbackReportsScrubberCorruption IntegrationTest.FullWorkflow IntegrationTest.ErrorRecoveryScenario IntegrationTest.IncrementalCheckpoints IntegrationTest.ConcurrentAccess IntegrationTest.PersistenceAndRecovery IntegrationTest.LargeDataHandling IntegrationTest.PartialRollbackScenario IntegrationTest.RollbackChainScenario IntegrationTest.StorageTypeComparison IntegrationTest.CompleteSystemTest FileOperationTest.SerializeDeserialize FileOperationTest.FileOpTypeToString FileOperationTest.StringToFileOpType FileOperationTest.LogRecordAndRetrieve FileOperationTest.LogGetOperationsForFile FileOperationTest.LogCheckpointMarker FileOperationTest.LogSerializeDeserialize FileOperationTest.TrackerBasicTracking FileOperationTest.TrackerCaptureFileContent FileOperationTest.TrackerOptions FileOperationTest.ReverseCreate FileOperationTest.ReverseDelete FileOperationTest.ReverseRename FileOperationTest.ReverseWrite FileOperationTest.ReverseTruncate FileOperationTest.BatchReverse FileOperationTest.PreviewReverse FileOperationTest.DryRun FileOperationTest.CannotReverseNonReversible FileOperationTest.CannotReverseAlreadyReversed FileOperationTest.FullWorkflow FileOperationTest.InterceptorTrackedSyscallsFollowFlags FileOperationTest.TrackerWritePreImageAndAppend FileOperationTest.TrackerRejectsMismatchedAfterWrite FileOperationTest.InterceptorCapturesWritesThroughFdTable FileOperationTest.FileBackupStrategyCopiesWithoutFullBuffer FileOperationTest.TrackerDiskBackupsForTruncateAndUnlink FileOperationTest.ByteRangeSetMergesAndSubtracts FileOperationTest.LogCoalescesRewritesWithinEpoch FileOperationTest.LogCoalescingResetsOnNonWriteAndKeepsGrowth FileOperationTest.JournalPersistsAndRecoversOperations FileOperationTest.JournalRotatesAtCheckpointsAndDropsSegments FileOperationTest.JournalTruncatesTornTail FileOperationTest.ReverseDependenciesFollowPathsAndDirectories FileOperationTest.ParallelReverseKeepsPerPathOrder FileOperationTest.InterceptorSeccompStopsOnlyOnTrackedSyscalls AdvancedFileOperationTest.SerializeEmptyOperation AdvancedFileOperationTest.SerializeLargeContent AdvancedFileOperationTest.SerializeMultipleDiffs AdvancedFileOperationTest.SerializeSpecialCharactersInPath AdvancedFileOperationTest.OperationMemoryUsage AdvancedFileOperationTest.LogFilterOperations AdvancedFileOperationTest.LogFilterBySize AdvancedFileOperationTest.LogMultipleCheckpoints AdvancedFileOperationTest.LogClearBeforeCheckpoint AdvancedFileOperationTest.LogPersistence AdvancedFileOperationTest.TrackerPathFiltering AdvancedFileOperationTest.TrackerExtensionFiltering AdvancedFileOperationTest.TrackerCapturePartialContent AdvancedFileOperationTest.TrackerMaxFileSizeLimit AdvancedFileOperationTest.ReverseWithDiffs AdvancedFileOperationTest.ReverseAppend AdvancedFileOperationTest.ReverseChmod AdvancedFileOperationTest.ReverseMkdir AdvancedFileOperationTest.ReverseRmdir AdvancedFileOperationTest.ReverseSymlink AdvancedFileOperationTest.ReverseWithTypeFilter AdvancedFileOperationTest.ReverseWithExcludeFilter AdvancedFileOperationTest.ReverseWithCustomFilter AdvancedFileOperationTest.ReverseStopOnError AdvancedFileOperationTest.ReverseContinueOnError AdvancedFileOperationTest.ReverseValidation AdvancedFileOperationTest.ReverseStatistics AdvancedFileOperationTest.ReverseProgressCallback AdvancedFileOperationTest.ReverseBinaryFile AdvancedFileOperationTest.ConcurrentLogAccess RealProcessCheckpointTest.SerializeRoundTripKeepsChainFields RealProcessCheckpointTest.MergeChainAppliesDirtyPages RealProcessCheckpointTest.MergeChainKeepsNewRegionsAndDropsUnmapped RealProcessCheckpointTest.MergeChainRejectsBrokenChain RealProcessCheckpointTest.CompareCheckpointsReportsExactRanges RealProcessCheckpointTest.CompareCheckpointsHandlesResizeAndZeroFill RealProcessCheckpointTest.ZeroPageScanFindsLastByte RealProcessCheckpointTest.EliminateZeroPagesSplitsRuns RealProcessCheckpointTest.PageStoreSharesPagesAcrossCheckpoints RealProcessCheckpointTest.MergeChainAppliesZeroFillRuns RealProcessCheckpointTest.RelocatePointersUsesRegionTable RealProcessCheckpointTest.MapsLineParserHandlesAllFields RealProcessCheckpointTest.MapQueryMatchesTextMaps RealProcessCheckpointTest.MapsCacheSharesSnapshotUntilInvalidated RealProcessCheckpointTest.SmapsReportsTransparentHugePages RealProcessCheckpointTest.StreamWriterOutputMatchesDeserialize RealProcessCheckpointTest.SaveLoadThroughIoEngine RealProcessCheckpointTest.StreamReaderSkipsPayloads RealProcessCheckpointTest.IndexedImageMapsAlignedPayloads RealProcessCheckpointTest.IndexedImageKeepsThreads RealProcessCheckpointTest.IndexedImageRejectsTruncatedFile BatchedMemoryTest.DumpSkipsUnreadablePages BatchedMemoryTest.RestoreWritesAllDumps BatchedMemoryTest.ParallelDumpMatchesSerial BatchedMemoryTest.ForkSnapshotDumpsChildCopy BatchedMemoryTest.CreateCheckpointToFileStreamsDumps BatchedMemoryTest.RepeatedDumpsReuseBufferPool BatchedMemoryTest.CheckpointTraceRecordsStagesAndIo BatchedMemoryTest.LiveMigrationPreCopiesAndRestoresIntoTarget BatchedMemoryTest.LiveMigrationCarriesPagesDiscardedBetweenRounds BatchedMemoryTest.LiveMigrationResumesSourceWhenRestoreFails BatchedMemoryTest.RestoreFromMappedImage BatchedMemoryTest.RestoreMapsImagePayloadsIntoTarget BatchedMemoryTest.CheckpointKeepsWritesToMappedImagePayloads BatchedMemoryTest.RestoreFromPageStoreAndZeroFill BatchedMemoryTest.IncrementalCheckpointCapturesWrittenAndDiscardedPages BatchedMemoryTest.DeltaRestoreWritesOnlyChangedPages BatchedMemoryTest.DeltaRestoreRewritesDiscardedPages BatchedMemoryTest.DeltaRestoreComparesBytesNotHashes BatchedMemoryTest.ParasiteRunsBatchInOneRoundTrip BatchedMemoryTest.ParasiteSplitsLargeBatchesAndRestoresFds DumpBufferPoolTest.ReusesRecycledBuffersWithinLimit MigrationReceiverTest.RejectsDataFrameLargerThanChunkSize MigrationReceiverTest.CapsRoundSizeAndTimesOutOnStalledPeer ZeroPageRestoreTest.DiscardZeroPagesUsesMadvise HugePageRestoreTest.PrefaultsHugePagesBeforeWriting LazyRestoreTest.ServesFaultsFromCheckpoint LazyRestoreTest.PrefetchCompletesInBackground ThreadGroupCheckpointTest.FreezesAndRestoresEveryThread TraceeSupervisorTest.InterruptsDumpsAndResumesManyTracees GroupCheckpointTest.DumpsWholeTreeAndSharesForkedPages GroupCheckpointTest.FreezesDedicatedCgroup DaemonPolicyTest.ParsesJobsAndLimits RateLimiterTest.ReservationsWaitForDebt CheckpointDaemonTest.SchedulesSnapshotsServesControlAndPrunes CheckpointDaemonTest.ControlSocketIsPrivateAndNeverReplacesFiles)
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace checkpoint {
+namespace bench {
+
+// ============================================================================
+// Bench Harness - checkpoint_bench için küçük ölçüm altyapısı
+// ============================================================================
+// Her örnek tek bir işlemin (op) süresidir; setup varsa her örnekten önce
+// ölçüm dışında çalışır. Önce warmup örnekleri atılır, sonra repetitions
+// örnek toplanır. Throughput medyan süreden hesaplanır. Girdi verileri sabit
+// seed'le üretildiğinden iki sürüm arasında yalnızca kod değişir.
+
+struct Config {
+    size_t repetitions = 10;
+    size_t warmup = 1;
+    std::string filter;                 // Boş değilse adı içermeyenler atlanır
+};
+
+struct Result {
+    std::string name;
+    std::map<std::string, std::string> params;
+    size_t samples = 0;
+    double minNs = 0;
+    double medianNs = 0;
+    double meanNs = 0;
+    double p90Ns = 0;
+    double maxNs = 0;
+    double stddevNs = 0;
+    uint64_t bytesPerOp = 0;
+    uint64_t itemsPerOp = 0;
+    std::map<std::string, double> counters;
+    std::string skipped;                // Boş değilse ölçülmedi; sebep
+};
+
+class Runner {
+public:
+    explicit Runner(Config config) : m_config(std::move(config)) {}
+
+    bool selected(const std::string& name) const {
+        return m_config.filter.empty() || name.find(m_config.filter) != std::string::npos;
+    }
+
+    // op'u warmup + repetitions kez çalıştır; her çağrı bir örnek
+    Result* run(const std::string& name, std::map<std::string, std::string> params,
+                const std::function<void()>& op,
+                uint64_t bytesPerOp = 0, uint64_t itemsPerOp = 0,
+                const std::function<void()>& setup = nullptr) {
+        if (!selected(name)) return nullptr;
+
+        std::vector<double> samples;
+        samples.reserve(m_config.repetitions);
+        for (size_t i = 0; i < m_config.warmup + m_config.repetitions; ++i) {
+            if (setup) setup();
+            auto start = std::chrono::steady_clock::now();
+            op();
+            auto end = std::chrono::steady_clock::now();
+            if (i >= m_config.warmup) {
+                samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            }
+        }
+
+        Result result;
+        result.name = name;
+        result.params = std::move(params);
+        result.bytesPerOp = bytesPerOp;
+        result.itemsPerOp = itemsPerOp;
+        summarize(samples, result);
+        m_results.push_back(std::move(result));
+        return &m_results.back();
+    }
+
+    // Ölçülemeyen (ör. ptrace izni yok) benchmark'ı kayda geçir
+    void skip(const std::string& name, std::map<std::string, std::string> params,
+              const std::string& reason) {
+        if (!selected(name)) return;
+        Result result;
+        result.name = name;
+        result.params = std::move(params);
+        result.skipped = reason;
+        m_results.push_back(std::move(result));
+    }
+
+    const std::vector<Result>& results() const { return m_results; }
+    const Config& config() const { return m_config; }
+
+    void printTable(std::ostream& out) const {
+        out << std::left << std::setw(64) << "benchmark"
+            << std::right << std::setw(14) << "median"
+            << std::setw(14) << "p90" << std::setw(14) << "throughput" << "\n";
+        for (const auto& r : m_results) {
+            std::string label = r.name;
+            for (const auto& [key, value] : r.params) label += " " + key + "=" + value;
+            out << std::left << std::setw(64) << label << std::right;
+            if (!r.skipped.empty()) {
+                out << "  skipped: " << r.skipped << "\n";
+                continue;
+            }
+            out << std::setw(14) << formatNanos(r.medianNs)
+                << std::setw(14) << formatNanos(r.p90Ns)
+                << std::setw(14) << formatThroughput(r) << "\n";
+        }
+    }
+
+    // Sürümler arası diff'lenecek biçim: sabit alan sırası, bir benchmark
+    // bir satır
+    void writeJson(std::ostream& out, const std::map<std::string, std::string>& context) const {
+        out << "{\n  \"context\": {";
+        bool first = true;
+        for (const auto& [key, value] : context) {
+            out << (first ? "" : ",") << "\n    \"" << escape(key) << "\": \"" << escape(value) << "\"";
+            first = false;
+        }
+        out << "\n  },\n  \"benchmarks\": [";
+        first = true;
+        for (const auto& r : m_results) {
+            out << (first ? "" : ",") << "\n    {\"name\": \"" << escape(r.name) << "\", \"params\": {";
+            bool firstParam = true;
+            for (const auto& [key, value] : r.params) {
+                out << (firstParam ? "" : ", ") << "\"" << escape(key) << "\": \"" << escape(value) << "\"";
+                firstParam = false;
+            }
+            out << "}";
+            if (!r.skipped.empty()) {
+                out << ", \"skipped\": \"" << escape(r.skipped) << "\"}";
+                first = false;
+                continue;
+            }
+            out << ", \"samples\": " << r.samples
+                << ", \"min_ns\": " << number(r.minNs)
+                << ", \"median_ns\": " << number(r.medianNs)
+                << ", \"mean_ns\": " << number(r.meanNs)
+                << ", \"p90_ns\": " << number(r.p90Ns)
+                << ", \"max_ns\": " << number(r.maxNs)
+                << ", \"stddev_ns\": " << number(r.stddevNs);
+            if (r.bytesPerOp) {
+                out << ", \"bytes_per_op\": " << r.bytesPerOp
+                    << ", \"mb_per_s\": " << number(mbPerSecond(r));
+            }
+            if (r.itemsPerOp) {
+                out << ", \"items_per_op\": " << r.itemsPerOp
+                    << ", \"items_per_s\": " << number(itemsPerSecond(r));
+            }
+            for (const auto& [key, value] : r.counters) {
+                out << ", \"" << escape(key) << "\": " << number(value);
+            }
+            out << "}";
+            first = false;
+        }
+        out << "\n  ]\n}\n";
+    }
+
+private:
+    Config m_config;
+    std::vector<Result> m_results;
+
+    static void summarize(std::vector<double> samples, Result& result) {
+        result.samples = samples.size();
+        if (samples.empty()) return;
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double s : samples) sum += s;
+        result.minNs = samples.front();
+        result.maxNs = samples.back();
+        result.meanNs = sum / samples.size();
+        result.medianNs = samples.size() % 2
+            ? samples[samples.size() / 2]
+            : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2;
+        result.p90Ns = samples[std::min(samples.size() - 1, (samples.size() * 9) / 10)];
+        double var = 0;
+        for (double s : samples) var += (s - result.meanNs) * (s - result.meanNs);
+        result.stddevNs = std::sqrt(var / samples.size());
+    }
+
+    static double mbPerSecond(const Result& r) {
+        return r.medianNs > 0 ? (r.bytesPerOp / (1024.0 * 1024.0)) / (r.medianNs / 1e9) : 0;
+    }
+    static double itemsPerSecond(const Result& r) {
+        return r.medianNs > 0 ? r.itemsPerOp / (r.medianNs / 1e9) : 0;
+    }
+
+    static std::string formatNanos(double ns) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2);
+        if (ns >= 1e9) out << ns / 1e9 << " s";
+        else if (ns >= 1e6) out << ns / 1e6 << " ms";
+        else if (ns >= 1e3) out << ns / 1e3 << " us";
+        else out << ns << " ns";
+        return out.str();
+    }
+
+    static std::string formatThroughput(const Result& r) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(1);
+        if (r.bytesPerOp) out << mbPerSecond(r) << " MB/s";
+        else if (r.itemsPerOp) out << itemsPerSecond(r) / 1e3 << " k/s";
+        else out << "-";
+        return out.str();
+    }
+
+    static std::string number(double value) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(value < 100 ? 3 : 0) << value;
+        return out.str();
+    }
+
+    static std::string escape(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20) continue;
+            out += c;
+        }
+        return out;
+    }
+};
+
+// Çalıştırma ortamı; JSON'da sonuçların yanına yazılır
+inline std::map<std::string, std::string> collectContext() {
+    std::map<std::string, std::string> context;
+    char host[256] = {};
+    if (gethostname(host, sizeof(host) - 1) == 0) context["host"] = host;
+    context["cpus"] = std::to_string(std::thread::hardware_concurrency());
+
+    std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    context["date"] = date;
+#ifdef CHECKPOINT_VERSION
+    context["version"] = CHECKPOINT_VERSION;
+#endif
+#ifdef CHECKPOINT_BUILD_TYPE
+    context["build_type"] = CHECKPOINT_BUILD_TYPE;
+#endif
+#ifdef NDEBUG
+    context["assertions"] = "off";
+#else
+    context["assertions"] = "on";
+#endif
+    return context;
+}
+
+} // namespace bench
+} // namespace checkpoint
@@ -0,0 +1,483 @@
+/**
+ * Checkpoint Benchmark Suite
+ *
+ * Sıcak yolların tekrarlanabilir ölçümü: serializer sıkıştırma/checksum,
+ * FileStorage/HybridStorage save/load, OperationLogger sync/async,
+ * RollbackEngine planlama/uygulama ve gerçek process checkpoint/restore.
+ * Sonuçlar tablo olarak yazılır; --json ile sürümler arası diff'lenecek
+ * JSON üretilir. Anlamlı sayılar için Release build kullanın.
+ *
+ * Kullanım:
+ *   checkpoint_bench [--json <file|->] [--filter <substr>] [--repetitions N]
+ *                    [--warmup N] [--rss-mb N] [--mappings N] [--smoke]
+ */
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "bench_harness.hpp"
+#include "core/serializer.hpp"
+#include "state/storage.hpp"
+#include "state/state_manager.hpp"
+#include "logger/operation_logger.hpp"
+#include "rollback/rollback_engine.hpp"
+#include "real_process/ptrace_controller.hpp"
+#include "real_process/dump_buffer_pool.hpp"
+
+using namespace checkpoint;
+using namespace checkpoint::bench;
+
+namespace {
+
+constexpr uint64_t SEED = 0x5eed;
+constexpr size_t KiB = 1024;
+constexpr size_t MiB = 1024 * 1024;
+
+struct Options {
+    Config config;
+    std::string jsonPath;
+    size_t rssMb = 64;
+    size_t mappings = 16;
+    bool smoke = false;         // Küçük boyutlar, tek örnek (ctest için)
+};
+
+std::string sizeLabel(size_t bytes) {
+    if (bytes >= MiB && bytes % MiB == 0) return std::to_string(bytes / MiB) + "MiB";
+    if (bytes >= KiB && bytes % KiB == 0) return std::to_string(bytes / KiB) + "KiB";
+    return std::to_string(bytes) + "B";
+}
+
+// Yarısı rastgele, yarısı tekrar eden desen: gerçek heap'e yakın, codec'in
+// hem sıkışan hem sıkışmayan yolu ölçülür
+StateData makeData(size_t size, uint64_t seed = SEED) {
+    StateData data(size);
+    std::mt19937_64 rng(seed);
+    size_t half = size / 2;
+    for (size_t i = 0; i < half; i += 8) {
+        uint64_t v = rng();
+        std::memcpy(data.data() + i, &v, std::min<size_t>(8, half - i));
+    }
+    for (size_t i = half; i < size; ++i) {
+        data[i] = static_cast<uint8_t>((i / 64) & 0x0f);
+    }
+    return data;
+}
+
+std::filesystem::path scratchDir(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() /
+                ("checkpoint_bench_" + std::to_string(getpid()) + "_" + name);
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path;
+}
+
+// ============================================================================
+// Serializer
+// ============================================================================
+
+void benchSerializer(Runner& runner, const Options& opts) {
+    size_t size = opts.smoke ? 256 * KiB : 16 * MiB;
+    StateData data = makeData(size);
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts = {1};
+    if (hw > 1) threadCounts.push_back(hw);
+
+    for (CodecType codec : {CodecType::Rle, CodecType::Lz4}) {
+        for (unsigned threads : threadCounts) {
+            BinarySerializer serializer;
+            serializer.setCodec(createCodec(codec), CompressedFrame::DEFAULT_CHUNK_SIZE, threads);
+            std::map<std::string, std::string> params = {
+                {"codec", codecTypeToString(codec)},
+                {"threads", std::to_string(threads)},
+                {"size", sizeLabel(size)}};
+
+            StateData compressed;
+            if (auto* r = runner.run("serializer/compress", params,
+                                     [&] { compressed = serializer.compress(data); }, size)) {
+                r->counters["ratio"] = compressed.empty() ? 0 : double(size) / compressed.size();
+            }
+            if (compressed.empty()) compressed = serializer.compress(data);
+            StateData restored;
+            runner.run("serializer/decompress", params,
+                       [&] { restored = serializer.decompress(compressed); }, size);
+        }
+    }
+
+    BinarySerializer serializer;
+    volatile uint32_t sink = 0;
+    runner.run("serializer/checksum", {{"size", sizeLabel(size)}},
+               [&] { sink = serializer.calculateChecksum(data); }, size);
+    (void)sink;
+}
+
+// ============================================================================
+// Storage
+// ============================================================================
+
+void benchStorage(Runner& runner, const Options& opts) {
+    std::vector<size_t> sizes = opts.smoke
+        ? std::vector<size_t>{4 * KiB, 256 * KiB}
+        : std::vector<size_t>{4 * KiB, 1 * MiB, 16 * MiB};
+
+    for (size_t size : sizes) {
+        StateData data = makeData(size);
+        std::map<std::string, std::string> params = {{"size", sizeLabel(size)}};
+
+        {
+            auto dir = scratchDir("file");
+            FileStorage storage(dir);
+            CheckpointId id = 1;
+            runner.run("storage/file/save", params, [&] { storage.save(id, data); }, size);
+            runner.run("storage/file/load", params, [&] { storage.load(id); }, size);
+            std::filesystem::remove_all(dir);
+        }
+
+        {
+            // save bellek katmanına yazar; dosyaya yazma flush'ta ölçülür
+            auto dir = scratchDir("hybrid");
+            HybridStorage storage(dir, 64 * MiB);
+            CheckpointId id = 1;
+            runner.run("storage/hybrid/save", params, [&] { storage.save(id, data); }, size);
+            runner.run("storage/hybrid/save_flush", params,
+                       [&] { storage.save(id, data); storage.flushToFile(); }, size);
+            runner.run("storage/hybrid/load_hot", params, [&] { storage.load(id); }, size);
+            std::filesystem::remove_all(dir);
+        }
+    }
+}
+
+// ============================================================================
+// Logger
+// ============================================================================
+
+class NullLogOutput : public ILogOutput {
+public:
+    void write(const std::string& formattedEntry) override {
+        m_bytes.fetch_add(formattedEntry.size(), std::memory_order_relaxed);
+    }
+    void flush() override {}
+private:
+    std::atomic<uint64_t> m_bytes{0};
+};
+
+void benchLogger(Runner& runner, const Options& opts) {
+    size_t perOp = opts.smoke ? 2000 : 100000;
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts = {1, 2, 4};
+    if (hw > 4) threadCounts.push_back(hw);
+
+    for (bool async : {false, true}) {
+        for (unsigned threads : threadCounts) {
+            OperationLogger logger;
+            logger.clearOutputs();
+            logger.addOutput(std::make_shared<NullLogOutput>());
+            logger.setMinLevel(LogLevel::Info);
+            logger.setRetention(10000, 1000);
+            if (async) {
+                logger.setAsyncQueue(OperationLogger::DEFAULT_ASYNC_CAPACITY, LogOverflowPolicy::Block);
+                logger.enableAsync(true);
+            }
+
+            // Tüm mesajlar kuyruktan çıkıp output'a ulaşana kadar
+            auto op = [&] {
+                std::vector<std::thread> workers;
+                for (unsigned t = 0; t < threads; ++t) {
+                    workers.emplace_back([&, t] {
+                        for (size_t i = t; i < perOp; i += threads) {
+                            logger.info("bench", "operation completed");
+                        }
+                    });
+                }
+                for (auto& w : workers) w.join();
+                logger.flush();
+            };
+            runner.run("logger/log", {{"mode", async ? "async" : "sync"},
+                                      {"threads", std::to_string(threads)}},
+                       op, 0, perOp);
+            logger.enableAsync(false);
+        }
+    }
+}
+
+// ============================================================================
+// Rollback
+// ============================================================================
+
+struct RollbackFixture {
+    std::shared_ptr<StateManager> stateManager;
+    std::shared_ptr<OperationLogger> logger;
+    std::shared_ptr<RollbackEngine> engine;
+    CheckpointId base = 0;
+
+    // Taban checkpoint + history adet küçük değişiklik
+    void build(size_t history, size_t stateSize) {
+        stateManager = std::make_shared<StateManager>(std::make_unique<MemoryStorage>(1024 * MiB));
+        logger = std::make_shared<OperationLogger>();
+        logger->clearOutputs();
+        engine = std::make_shared<RollbackEngine>(stateManager, logger);
+
+        StateData state = makeData(stateSize);
+        base = *stateManager->createCheckpoint("base", state).value;
+        logger->logOperation(OperationType::Checkpoint, "base", base);
+        for (size_t i = 0; i < history; ++i) {
+            state[(i * 4096 + 17) % stateSize] ^= 0xff;
+            engine->recordStateChange("change " + std::to_string(i), state, base);
+        }
+    }
+};
+
+void benchRollback(Runner& runner, const Options& opts) {
+    std::vector<size_t> histories = opts.smoke
+        ? std::vector<size_t>{10, 50}
+        : std::vector<size_t>{10, 100, 1000};
+    size_t stateSize = opts.smoke ? 64 * KiB : 1 * MiB;
+
+    for (size_t history : histories) {
+        for (auto strategy : {RollbackStrategy::Full, RollbackStrategy::Incremental}) {
+            std::string strategyName = strategy == RollbackStrategy::Full ? "full" : "incremental";
+            std::map<std::string, std::string> params = {
+                {"history", std::to_string(history)},
+                {"strategy", strategyName},
+                {"state", sizeLabel(stateSize)}};
+
+            if (runner.selected("rollback/plan")) {
+                RollbackFixture fixture;
+                fixture.build(history, stateSize);
+                runner.run("rollback/plan", params,
+                           [&] { fixture.engine->createRollbackPlan(fixture.base, strategy); },
+                           0, history);
+            }
+
+            // Her örnek taze bir geçmişe uygulanır (kurulum ölçülmez)
+            if (runner.selected("rollback/execute")) {
+                RollbackFixture fixture;
+                RollbackPlan plan;
+                size_t warnings = 0;
+                auto* r = runner.run("rollback/execute", params,
+                    [&] {
+                        auto result = fixture.engine->executeRollback(plan);
+                        if (result.isSuccess()) warnings += result.value->warnings.size();
+                    },
+                    stateSize, history,
+                    [&] {
+                        fixture.build(history, stateSize);
+                        plan = *fixture.engine->createRollbackPlan(fixture.base, strategy).value;
+                    });
+                // Incremental'dan tam restore'a düşüşler uyarı olarak görünür
+                if (r) r->counters["warnings"] = double(warnings);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Real process checkpoint / restore
+// ============================================================================
+
+// rssMb'lık belleği mappings ayrı bölgeye dağıtıp dolduran ve bekleyen
+// çocuk process. Bölgeler arasında PROT_NONE sayfa bırakılır ki kernel
+// komşu mapping'leri birleştirmesin.
+pid_t spawnTarget(size_t rssMb, size_t mappings) {
+    int ready[2];
+    if (pipe(ready) != 0) return -1;
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(ready[0]);
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t perMapping = std::max(page, ((rssMb * MiB) / std::max<size_t>(mappings, 1)) / page * page);
+        std::mt19937_64 rng(SEED);
+        for (size_t m = 0; m < mappings; ++m) {
+            void* p = mmap(nullptr, perMapping + page, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) _exit(1);
+            auto* bytes = static_cast<uint8_t*>(p);
+            for (size_t off = 0; off < perMapping; off += 8) {
+                uint64_t v = (off / page) % 4 == 0 ? 0 : rng();    // Her 4 sayfadan biri sıfır
+                std::memcpy(bytes + off, &v, 8);
+            }
+            mprotect(bytes + perMapping, page, PROT_NONE);
+        }
+        char c = 1;
+        if (write(ready[1], &c, 1) != 1) _exit(1);
+        while (true) pause();
+    }
+
+    close(ready[1]);
+    char c = 0;
+    bool ok = pid > 0 && read(ready[0], &c, 1) == 1;
+    close(ready[0]);
+    if (!ok && pid > 0) {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        return -1;
+    }
+    return pid;
+}
+
+void benchProcess(Runner& runner, const Options& opts) {
+    size_t rssMb = opts.smoke ? 4 : opts.rssMb;
+    size_t mappings = opts.smoke ? 4 : opts.mappings;
+    if (!runner.selected("process/")) return;
+
+    pid_t child = spawnTarget(rssMb, mappings);
+    std::map<std::string, std::string> base = {
+        {"rss", std::to_string(rssMb) + "MiB"}, {"mappings", std::to_string(mappings)}};
+    if (child <= 0) {
+        runner.skip("process/checkpoint", base, "target could not be started");
+        return;
+    }
+
+    real_process::RealProcessCheckpointer checkpointer;
+    real_process::CheckpointOptions probe;
+    probe.saveMemory = false;
+    probe.saveFileDescriptors = false;
+    probe.saveEnvironment = false;
+    if (!checkpointer.createCheckpoint(child, "probe", probe)) {
+        runner.skip("process/checkpoint", base, "ptrace not permitted: " + checkpointer.getLastError());
+        kill(child, SIGKILL);
+        waitpid(child, nullptr, 0);
+        return;
+    }
+
+    struct Mode {
+        const char* name;
+        real_process::CheckpointOptions options;
+    };
+    std::vector<Mode> modes;
+    modes.push_back({"serial", {}});
+    modes.push_back({"parallel", {}});
+    modes.back().options.dumpThreads = 0;
+    modes.push_back({"fork_snapshot", {}});
+    modes.back().options.forkSnapshot = true;
+
+    std::optional<real_process::RealProcessCheckpoint> last;
+    for (auto& mode : modes) {
+        mode.options.saveFileDescriptors = false;
+        mode.options.saveEnvironment = false;
+        auto params = base;
+        params["mode"] = mode.name;
+
+        // Önceki checkpoint'in tamponları havuza döner; ilk turdan sonra
+        // dump'lar yeni bellek ayırmaz
+        auto* r = runner.run("process/checkpoint", params, [&] {
+            if (last) checkpointer.releaseCheckpoint(*last);
+            last = checkpointer.createCheckpoint(child, "bench", mode.options);
+        });
+        if (!r) continue;
+        if (!last) {
+            r->skipped = "checkpoint failed: " + checkpointer.getLastError();
+            continue;
+        }
+
+        // Boyut her örnekte aynı; donma süreleri son örnekten
+        for (const auto& dump : last->memoryDumps) r->bytesPerOp += dump.data.size();
+        const auto& stats = checkpointer.getLastFreezeStats();
+        r->counters["freeze_ms"] = stats.freezeNanos / 1e6;
+        r->counters["stopped_ms"] = stats.stoppedNanos / 1e6;
+    }
+
+    if (last) {
+        real_process::RestoreOptions restore;
+        restore.restoreRegisters = false;
+        restore.restoreSignals = false;
+        for (bool delta : {false, true}) {
+            restore.deltaRestore = delta;
+            auto params = base;
+            params["mode"] = delta ? "delta" : "full";
+            uint64_t bytes = 0;
+            for (const auto& dump : last->memoryDumps) bytes += dump.data.size();
+            real_process::RestoreResult result{};
+            std::string error;
+            auto* r = runner.run("process/restore", params, [&] {
+                result = checkpointer.restoreCheckpointEx(child, *last, restore);
+                if (!result.success) error = result.errorMessage;
+            }, bytes);
+            if (r) {
+                // Delta modunda çoğu sayfa karşılaştırılıp atlanır
+                r->counters["bytes_written"] = double(result.bytesWritten);
+                if (!error.empty()) r->skipped = "restore failed: " + error;
+            }
+        }
+        checkpointer.releaseCheckpoint(*last);
+    }
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+}
+
+bool parseArgs(int argc, char* argv[], Options& opts) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--json") {
+            opts.jsonPath = next();
+        } else if (arg == "--filter") {
+            opts.config.filter = next();
+        } else if (arg == "--repetitions") {
+            opts.config.repetitions = std::max(1, std::atoi(next().c_str()));
+        } else if (arg == "--warmup") {
+            opts.config.warmup = static_cast<size_t>(std::max(0, std::atoi(next().c_str())));
+        } else if (arg == "--rss-mb") {
+            opts.rssMb = static_cast<size_t>(std::max(1, std::atoi(next().c_str())));
+        } else if (arg == "--mappings") {
+            opts.mappings = static_cast<size_t>(std::max(1, std::atoi(next().c_str())));
+        } else if (arg == "--smoke") {
+            opts.smoke = true;
+            opts.config.repetitions = 1;
+            opts.config.warmup = 0;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options opts;
+    if (!parseArgs(argc, argv, opts)) {
+        std::cerr << "Kullanım: " << argv[0]
+                  << " [--json <file|->] [--filter <substr>] [--repetitions N] [--warmup N]"
+                     " [--rss-mb N] [--mappings N] [--smoke]\n";
+        return 1;
+    }
+
+    Runner runner(opts.config);
+    benchSerializer(runner, opts);
+    benchStorage(runner, opts);
+    benchLogger(runner, opts);
+    benchRollback(runner, opts);
+    benchProcess(runner, opts);
+
+    bool jsonToStdout = opts.jsonPath == "-";
+    runner.printTable(jsonToStdout ? std::cerr : std::cout);
+
+    if (!opts.jsonPath.empty()) {
+        auto context = collectContext();
+        context["repetitions"] = std::to_string(opts.config.repetitions);
+        context["warmup"] = std::to_string(opts.config.warmup);
+        context["smoke"] = opts.smoke ? "true" : "false";
+        if (jsonToStdout) {
+            runner.writeJson(std::cout, context);
+        } else {
+            std::ofstream out(opts.jsonPath);
+            if (!out) {
+                std::cerr << "JSON dosyası açılamadı: " << opts.jsonPath << "\n";
+                return 1;
+            }
+            runner.writeJson(out, context);
+        }
+    }
+    return 0;
+}
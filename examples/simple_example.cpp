@@ -38,7 +38,7 @@ int main() {
     // İlk checkpoint'e dön
     auto result = manager.getCheckpoint(*cp1.value);
     if (result.isSuccess()) {
-        auto& data = result.value->getData();
+        const auto& data = result.value->getData();
         std::string content(data.begin(), data.end());
         std::cout << "\nCheckpoint 1 içeriği: " << content << "\n";
     }
@@ -0,0 +1,222 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace checkpoint {
+
+// ============================================================================
+// Binary Reader / Writer - span tabanlı, ara tampon ayırmadan (de)serileştirme
+// ============================================================================
+// Sabit genişlikli alanlar host byte sırasıyla (memcpy) yazılır; mevcut kayıt
+// biçimleri bununla birebir aynıdır. Yeni biçimler uzunluklar için LEB128
+// varint kullanabilir.
+//
+// Reader sınırları denetler: taşan ilk okumadan sonra ok() false olur ve
+// sonraki okumalar sıfır / boş değer döndürür; çağıran her alanı ayrıca
+// kontrol etmek zorunda değildir, sonda ok()'a bakması yeterlidir.
+// writeLE/readLE, host'tan bağımsız little-endian tanımlı biçimler içindir.
+
+template<typename T>
+concept BinaryPod = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>;
+
+inline size_t varintSize(uint64_t value) {
+    size_t n = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+template<std::unsigned_integral T>
+constexpr T toLittleEndian(T value) {
+    if constexpr (std::endian::native == std::endian::little || sizeof(T) == 1) {
+        return value;
+    } else {
+        T swapped = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            swapped = static_cast<T>((swapped << 8) | ((value >> (i * 8)) & 0xFF));
+        }
+        return swapped;
+    }
+}
+
+class BinaryWriter {
+public:
+    // Önceden boyutlanmış tampona yerinde yazar; sığmayan yazma ok()'u bozar
+    explicit BinaryWriter(std::span<uint8_t> buffer) : m_buffer(buffer) {}
+    // Vektörün sonuna ekler (gerekirse büyütür)
+    explicit BinaryWriter(StateData& out) : m_out(&out), m_pos(out.size()) {}
+
+    template<BinaryPod T>
+    void write(const T& value) {
+        writeBytes(&value, sizeof(T));
+    }
+
+    template<std::unsigned_integral T>
+    void writeLE(T value) {
+        write(toLittleEndian(value));
+    }
+
+    void writeU8(uint8_t value) { write(value); }
+    void writeBool(bool value) { writeU8(value ? 1 : 0); }
+
+    void writeBytes(const void* data, size_t size) {
+        uint8_t* dst = reserve(size);
+        if (dst && size > 0) std::memcpy(dst, data, size);
+    }
+    void writeBytes(std::span<const uint8_t> bytes) { writeBytes(bytes.data(), bytes.size()); }
+
+    void writeVarint(uint64_t value) {
+        uint8_t tmp[10];
+        size_t n = 0;
+        while (value >= 0x80) {
+            tmp[n++] = static_cast<uint8_t>(value) | 0x80;
+            value >>= 7;
+        }
+        tmp[n++] = static_cast<uint8_t>(value);
+        writeBytes(tmp, n);
+    }
+
+    // LenT uzunluk öneki + içerik
+    template<typename LenT = uint32_t>
+    void writeString(std::string_view str) {
+        write(static_cast<LenT>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+    void writeVarString(std::string_view str) {
+        writeVarint(str.size());
+        writeBytes(str.data(), str.size());
+    }
+
+    // size byte'lık alan ayırıp adresini döndür (ör. sonradan doldurulacak
+    // ya da doğrudan kopyalanacak veri için); sığmazsa nullptr
+    uint8_t* reserve(size_t size) {
+        if (m_out) {
+            if (m_out->size() < m_pos + size) m_out->resize(m_pos + size);
+            uint8_t* p = m_out->data() + m_pos;
+            m_pos += size;
+            return p;
+        }
+        if (!m_ok || m_buffer.size() - m_pos < size) {
+            m_ok = false;
+            return nullptr;
+        }
+        uint8_t* p = m_buffer.data() + m_pos;
+        m_pos += size;
+        return p;
+    }
+
+    size_t position() const { return m_pos; }
+    bool ok() const { return m_ok; }
+
+private:
+    std::span<uint8_t> m_buffer;
+    StateData* m_out = nullptr;
+    size_t m_pos = 0;
+    bool m_ok = true;
+};
+
+class BinaryReader {
+public:
+    explicit BinaryReader(std::span<const uint8_t> data) : m_data(data) {}
+
+    template<BinaryPod T>
+    bool read(T& value) {
+        const uint8_t* p = take(sizeof(T));
+        if (!p) {
+            value = T{};
+            return false;
+        }
+        std::memcpy(&value, p, sizeof(T));
+        return true;
+    }
+
+    template<BinaryPod T>
+    T read() {
+        T value;
+        read(value);
+        return value;
+    }
+
+    template<std::unsigned_integral T>
+    T readLE() {
+        return toLittleEndian(read<T>());
+    }
+
+    uint8_t readU8() { return read<uint8_t>(); }
+    bool readBool() { return readU8() != 0; }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const uint8_t* p = take(1);
+            if (!p) break;
+            value |= static_cast<uint64_t>(*p & 0x7F) << shift;
+            if ((*p & 0x80) == 0) return true;
+        }
+        m_ok = false;
+        value = 0;
+        return false;
+    }
+    uint64_t readVarint() {
+        uint64_t value;
+        readVarint(value);
+        return value;
+    }
+
+    // Kopyasız görünüm (kaynak veri yaşadığı sürece geçerli); taşarsa boş
+    std::span<const uint8_t> readBytes(size_t size) {
+        const uint8_t* p = take(size);
+        return p ? std::span<const uint8_t>(p, size) : std::span<const uint8_t>();
+    }
+
+    bool readBytesInto(void* out, size_t size) {
+        const uint8_t* p = take(size);
+        if (!p) return false;
+        if (size > 0) std::memcpy(out, p, size);
+        return true;
+    }
+
+    template<typename LenT = uint32_t>
+    std::string readString() {
+        auto bytes = readBytes(static_cast<size_t>(read<LenT>()));
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+    std::string readVarString() {
+        auto bytes = readBytes(static_cast<size_t>(readVarint()));
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    bool skip(size_t size) { return take(size) != nullptr; }
+    // Anlamsal hata (ör. geçersiz uzunluk): sonraki okumalar da başarısız
+    void fail() { m_ok = false; }
+
+    size_t position() const { return m_pos; }
+    size_t remaining() const { return m_ok ? m_data.size() - m_pos : 0; }
+    bool atEnd() const { return remaining() == 0; }
+    bool ok() const { return m_ok; }
+
+private:
+    std::span<const uint8_t> m_data;
+    size_t m_pos = 0;
+    bool m_ok = true;
+
+    const uint8_t* take(size_t size) {
+        if (!m_ok || m_data.size() - m_pos < size) {
+            m_ok = false;
+            return nullptr;
+        }
+        const uint8_t* p = m_data.data() + m_pos;
+        m_pos += size;
+        return p;
+    }
+};
+
+} // namespace checkpoint
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace checkpoint {
+
+// ============================================================================
+// CRC32C (Castagnoli) - donanım hızlandırmalı checksum
+// ============================================================================
+// x86-64'te SSE4.2 crc32, AArch64'te ARMv8 CRC komutları kullanılır; ikisi
+// de yoksa slicing-by-8 tablo yoluna düşülür. Seçim ilk çağrıda runtime'da
+// yapılır. Tüm yollar aynı sonucu üretir.
+//
+// Tek seferde:      uint32_t c = crc32c(data, size);
+// Parça parça:      uint32_t c = crc32c(a, n1); c = crc32c(b, n2, c);
+
+// crc önceki parçanın sonucudur (ilk parça için 0)
+uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+// Tablo tabanlı referans yol (test ve karşılaştırma için)
+uint32_t crc32cSoftware(const void* data, size_t size, uint32_t crc = 0);
+
+// Seçilen yol: "sse4.2", "armv8-crc" veya "slicing-by-8"
+const char* crc32cImplementation();
+
+// Dump sırasında checksum biriktirmek için streaming yardımcı
+class Crc32c {
+public:
+    Crc32c() : m_value(0), m_bytes(0) {}
+
+    void update(const void* data, size_t size) {
+        m_value = crc32c(data, size, m_value);
+        m_bytes += size;
+    }
+
+    void reset() {
+        m_value = 0;
+        m_bytes = 0;
+    }
+
+    uint32_t value() const { return m_value; }
+    uint64_t bytes() const { return m_bytes; }
+
+private:
+    uint32_t m_value;
+    uint64_t m_bytes;
+};
+
+// ============================================================================
+// XXH64 - içerik adresleme için hızlı 64-bit hash (kriptografik değil)
+// ============================================================================
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+
+} // namespace checkpoint
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace checkpoint {
+
+// Codec türleri (frame header'ında saklanır - değerler değişmemeli)
+enum class CodecType : uint8_t {
+    None = 0,
+    Rle = 1,
+    Lz4 = 2
+};
+
+std::string codecTypeToString(CodecType type);
+
+// ============================================================================
+// Codec arayüzü - tek bloğu sıkıştırır/açar
+// ============================================================================
+// Codec'ler durumsuzdur; aynı nesne birden fazla thread'den kullanılabilir.
+class ICodec {
+public:
+    virtual ~ICodec() = default;
+
+    virtual CodecType type() const = 0;
+
+    // srcSize byte için gereken en büyük çıktı boyutu
+    virtual size_t maxCompressedSize(size_t srcSize) const = 0;
+
+    // Yazılan byte sayısı; çıktı dstCapacity'ye sığmazsa 0
+    virtual size_t compress(const uint8_t* src, size_t srcSize,
+                            uint8_t* dst, size_t dstCapacity) const = 0;
+
+    // Tam olarak dstSize byte üretilirse true (bozuk girdide false)
+    virtual bool decompress(const uint8_t* src, size_t srcSize,
+                            uint8_t* dst, size_t dstSize) const = 0;
+};
+
+// Sıkıştırmasız kopya
+class NoneCodec : public ICodec {
+public:
+    CodecType type() const override { return CodecType::None; }
+    size_t maxCompressedSize(size_t srcSize) const override { return srcSize; }
+    size_t compress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstCapacity) const override;
+    bool decompress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstSize) const override;
+};
+
+// Eski BinarySerializer RLE'si (0xFF escape, count, value)
+class RleCodec : public ICodec {
+public:
+    CodecType type() const override { return CodecType::Rle; }
+    size_t maxCompressedSize(size_t srcSize) const override { return srcSize * 3; }
+    size_t compress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstCapacity) const override;
+    bool decompress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstSize) const override;
+};
+
+// LZ4 blok formatı (token + literal + 16-bit offset + match uzunluğu).
+// Harici kütüphane gerektirmez; çıktısı standart LZ4 block decoder'ları
+// ile açılabilir.
+class Lz4Codec : public ICodec {
+public:
+    CodecType type() const override { return CodecType::Lz4; }
+    size_t maxCompressedSize(size_t srcSize) const override {
+        return srcSize + srcSize / 255 + 16;
+    }
+    size_t compress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstCapacity) const override;
+    bool decompress(const uint8_t* src, size_t srcSize,
+                    uint8_t* dst, size_t dstSize) const override;
+};
+
+std::shared_ptr<ICodec> createCodec(CodecType type);
+
+// ============================================================================
+// Compressed Frame - bağımsız chunk'lardan oluşan sıkıştırılmış veri
+// ============================================================================
+// Veri chunkSize'lık parçalara bölünür ve her parça ayrı sıkıştırılır;
+// böylece sıkıştırma paralel yapılabilir ve herhangi bir aralık sadece
+// kapsadığı chunk'lar açılarak okunabilir. Sıkışmayan chunk'lar ham saklanır.
+//
+//   "CKZ1" | codec u8 | reserved[3] | chunkSize u32 | originalSize u64
+//   chunk tablosu: u32 x chunkCount (boyut | RAW_CHUNK_FLAG)
+//   chunk payload'ları (sırayla)
+class CompressedFrame {
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+    static constexpr uint32_t RAW_CHUNK_FLAG = 0x80000000u;
+    static constexpr size_t HEADER_SIZE = 20;
+
+    // threads = 0 -> donanım thread sayısı
+    static StateData compress(const ICodec& codec, const uint8_t* data, size_t size,
+                              size_t chunkSize = DEFAULT_CHUNK_SIZE,
+                              unsigned threads = 1);
+
+    static bool isFrame(const uint8_t* data, size_t size);
+
+    // Frame üzerinde view aç (veri kopyalanmaz, frame yaşadığı sürece geçerli)
+    bool open(const uint8_t* frame, size_t size);
+
+    CodecType codec() const { return m_codecType; }
+    uint64_t originalSize() const { return m_originalSize; }
+    size_t chunkSize() const { return m_chunkSize; }
+    size_t chunkCount() const { return m_offsets.size(); }
+
+    // [offset, offset + length) aralığını aç - sadece ilgili chunk'lar çözülür
+    bool read(uint64_t offset, uint8_t* out, size_t length) const;
+
+    // Tamamını aç (out en az originalSize byte olmalı)
+    bool decompressAll(uint8_t* out, unsigned threads = 1) const;
+
+private:
+    const uint8_t* m_frame = nullptr;
+    CodecType m_codecType = CodecType::None;
+    std::shared_ptr<ICodec> m_codec;
+    uint64_t m_originalSize = 0;
+    size_t m_chunkSize = 0;
+    std::vector<uint64_t> m_offsets;    // chunk payload başlangıçları
+    std::vector<uint32_t> m_sizes;      // RAW_CHUNK_FLAG dahil
+
+    bool decompressChunk(size_t index, uint8_t* out) const;
+    size_t chunkLength(size_t index) const;
+};
+
+} // namespace checkpoint
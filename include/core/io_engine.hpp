@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace checkpoint {
+
+// ============================================================================
+// I/O Engine - io_uring, yoksa blocking pread/pwrite
+// ============================================================================
+// Büyük imajlar tek fd'ye art arda write() ile yazılınca her seferinde tek
+// istek kuyrukta olur; NVMe'nin paralelliği kullanılmaz. IoEngine birden
+// fazla okuma/yazmayı aynı anda uçuşta tutar. Kernel io_uring'i
+// desteklemiyorsa (ENOSYS, seccomp, < 5.6) aynı arayüz istekleri submit
+// anında blocking pread/pwrite ile tamamlar.
+//
+//   IoEngine io;
+//   io.submitWrite(fd, buf, len, offset, tag);   // canSubmit() iken
+//   io.wait(completions, 1);                      // en az 1 tamamlanma
+//
+// Kısa okuma/yazma (result < len) çağıranın sorumluluğundadır; readFully /
+// writeFully ve AsyncFileWriter bunu kendisi tamamlar. Thread-safe değil.
+struct IoEngineOptions {
+    unsigned queueDepth = 32;           // aynı anda uçuşta en fazla istek
+    size_t bufferSize = 1024 * 1024;    // AsyncFileWriter tampon / parça boyu
+    unsigned buffers = 8;               // AsyncFileWriter tampon sayısı
+    bool useIoUring = true;
+    bool directIo = false;              // O_DIRECT (desteklenmiyorsa düşülür)
+};
+
+enum class IoBackend {
+    IoUring,
+    Blocking
+};
+
+const char* ioBackendName(IoBackend backend);
+
+class IoEngine {
+public:
+    static constexpr size_t DIRECT_ALIGNMENT = 4096;
+
+    struct Completion {
+        uint64_t tag;
+        int64_t result;     // aktarılan byte ya da -errno
+    };
+
+    explicit IoEngine(const IoEngineOptions& options = IoEngineOptions());
+    ~IoEngine();
+
+    IoEngine(const IoEngine&) = delete;
+    IoEngine& operator=(const IoEngine&) = delete;
+
+    IoBackend backend() const { return m_backend; }
+    unsigned queueDepth() const { return m_queueDepth; }
+    size_t inFlight() const { return m_inFlight; }
+    bool canSubmit() const { return m_inFlight < m_queueDepth; }
+
+    // Buffer tamamlanana kadar geçerli kalmalı. canSubmit() false ise false.
+    bool submitWrite(int fd, const void* buf, size_t len, uint64_t offset, uint64_t tag);
+    bool submitRead(int fd, void* buf, size_t len, uint64_t offset, uint64_t tag);
+
+    // Bekleyenleri kernel'e gönder, en az minComplete tamamlanmayı bekle
+    // (inFlight ile sınırlı) ve hazır olanların hepsini out'a ekle
+    size_t wait(std::vector<Completion>& out, size_t minComplete);
+
+    // [offset, offset+size) aralığını chunkSize parçalarla paralel aktar
+    bool readFully(int fd, void* buf, size_t size, uint64_t offset,
+                   size_t chunkSize, std::string* error = nullptr);
+    bool writeFully(int fd, const void* buf, size_t size, uint64_t offset,
+                    size_t chunkSize, std::string* error = nullptr);
+
+private:
+    struct Ring;
+
+    IoBackend m_backend;
+    unsigned m_queueDepth;
+    size_t m_inFlight;
+    std::unique_ptr<Ring> m_ring;
+    std::vector<Completion> m_ready;     // blocking backend tamamlanmaları
+
+    bool submit(uint8_t opcode, int fd, void* buf, size_t len, uint64_t offset, uint64_t tag);
+    bool transfer(bool write, int fd, uint8_t* buf, size_t size, uint64_t offset,
+                  size_t chunkSize, std::string* error);
+};
+
+// ============================================================================
+// Aligned Buffer - O_DIRECT için DIRECT_ALIGNMENT hizalı tampon
+// ============================================================================
+class AlignedBuffer {
+public:
+    AlignedBuffer() = default;
+    explicit AlignedBuffer(size_t capacity);
+
+    uint8_t* data() { return m_data.get(); }
+    const uint8_t* data() const { return m_data.get(); }
+    size_t capacity() const { return m_capacity; }
+
+private:
+    struct Free { void operator()(uint8_t* p) const; };
+    std::unique_ptr<uint8_t, Free> m_data;
+    size_t m_capacity = 0;
+};
+
+// ============================================================================
+// Async File Writer - sıralı yazmaları çoklu tamponla üst üste bindirir
+// ============================================================================
+// write() veriyi sıradaki tampona kopyalar; dolan tampon engine'e verilir
+// ve çağıran bir sonrakini doldurmaya devam eder (dump okuma ile disk
+// yazma örtüşür). Tüm tamponlar uçuştaysa ilki bitene kadar beklenir.
+// directIo'da tamponlar hizalıdır; son parça sıfırla doldurulup yazılır
+// ve dosya finish()'te gerçek boyuta kesilir.
+//
+// writeStable() kopyasız yoldur: data finish()'e kadar geçerli kalmalı
+// (direct modda hizasızsa kopyalanır).
+class AsyncFileWriter {
+public:
+    // engine nullptr ise writer kendi engine'ini oluşturur
+    explicit AsyncFileWriter(const IoEngineOptions& options = IoEngineOptions(),
+                             IoEngine* engine = nullptr);
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    // Dosyayı oluştur/kes
+    bool open(const std::string& filepath, int mode = 0644);
+
+    bool write(const void* data, size_t size);
+    bool writeStable(const void* data, size_t size);
+
+    // Bekleyen her şeyi yaz ve bitmesini bekle; sync: fdatasync
+    bool finish(bool sync = false);
+
+    // finish() çağrılmadıysa bekleyenleri yazar (hata sessiz)
+    void close();
+
+    bool isOpen() const { return m_fd >= 0; }
+    bool isDirect() const { return m_direct; }
+    IoBackend backend() const { return m_engine->backend(); }
+    uint64_t bytesWritten() const { return m_logicalSize; }
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    struct Request {
+        const uint8_t* data;
+        size_t len;
+        uint64_t offset;
+        size_t done;
+        int slot;           // -1: çağıranın belleği (writeStable)
+    };
+
+    struct Slot {
+        AlignedBuffer buffer;
+        size_t used = 0;
+        bool busy = false;
+    };
+
+    IoEngineOptions m_options;
+    std::unique_ptr<IoEngine> m_ownedEngine;
+    IoEngine* m_engine;
+    int m_fd;
+    bool m_direct;
+    bool m_failed;
+    std::vector<Slot> m_slots;
+    size_t m_current;
+    uint64_t m_fileOffset;          // sıradaki isteğin dosya offseti
+    uint64_t m_logicalSize;         // write edilen byte (padding hariç)
+    uint64_t m_nextTag;
+    std::unordered_map<uint64_t, Request> m_requests;
+    std::vector<IoEngine::Completion> m_completions;
+    std::string m_lastError;
+
+    bool submitRequest(const Request& request);
+    bool reap(size_t minComplete);
+    bool submitCurrent();
+    bool acquireSlot();
+    bool fail(const std::string& message);
+};
+
+} // namespace checkpoint
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <array>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace checkpoint {
+
+// ============================================================================
+// Metrics - işlem başına aşama süreleri ve sayaçlar
+// ============================================================================
+// Her ölçülen işlem (checkpoint alma, restore, state kaydı, rollback, ...)
+// bir OperationTrace üretir: sırayla aşamalar ve süreleri, toplam süre,
+// byte / syscall gibi sayaçlar. TraceScope izi oluşturur ve bitince
+// MetricsRegistry'ye verir; registry aşama başına süre histogramları ve
+// sayaç toplamları tutar, son izleri saklar ve OpenMetrics metni üretir.
+//
+//   TraceScope trace("checkpoint.create");
+//   trace.stage("attach");   ...
+//   trace.stage("dump");     ...
+//   trace.count("bytes_dumped", n);
+//   trace.succeed();
+//   // kapsam sonunda (ya da finish()) kaydedilir
+//
+// İşlem adları "alan.işlem" biçimindedir; aşama / sayaç adları snake_case.
+
+struct OperationTrace {
+    std::string operation;
+    Timestamp startedAt;
+    uint64_t totalNanos = 0;
+    bool success = true;
+    std::vector<std::pair<std::string, uint64_t>> stages;      // Sırayla, ns
+    std::map<std::string, uint64_t> counters;
+
+    // Aynı adlı aşamalar toplanır; yoksa 0
+    uint64_t stageNanos(const std::string& stage) const;
+    uint64_t counter(const std::string& name) const;
+
+    // Tek satırlık okunabilir özet
+    std::string toString() const;
+};
+
+class MetricsRegistry {
+public:
+    // Histogram üst sınırları (saniye); son kova +Inf
+    static constexpr std::array<double, 7> BUCKET_BOUNDS = {
+        0.0001, 0.001, 0.01, 0.1, 1.0, 10.0, 60.0};
+    static constexpr size_t DEFAULT_TRACE_HISTORY = 64;
+
+    struct DurationStats {
+        uint64_t count = 0;
+        uint64_t sumNanos = 0;
+        uint64_t minNanos = 0;
+        uint64_t maxNanos = 0;
+        std::array<uint64_t, BUCKET_BOUNDS.size() + 1> buckets{};      // Kümülatif değil
+
+        double meanNanos() const { return count ? double(sumNanos) / count : 0; }
+    };
+
+    struct OperationStats {
+        uint64_t succeeded = 0;
+        uint64_t failed = 0;
+        DurationStats total;
+        std::map<std::string, DurationStats> stages;
+        std::map<std::string, uint64_t> counters;
+    };
+
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Kütüphane bileşenlerinin varsayılan olarak yazdığı registry
+    static MetricsRegistry& global();
+
+    // Kapalıyken record() hiçbir şey yapmaz (TraceScope yine de ölçer)
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+    void setTraceHistory(size_t count);
+
+    void record(const OperationTrace& trace);
+
+    // ========================================================================
+    // Sorgular
+    // ========================================================================
+
+    std::map<std::string, OperationStats> getOperationStats() const;
+    std::optional<OperationStats> getOperationStats(const std::string& operation) const;
+    // En yeni sonda
+    std::vector<OperationTrace> getRecentTraces() const;
+    std::optional<OperationTrace> getLastTrace(const std::string& operation) const;
+
+    void reset();
+
+    // ========================================================================
+    // Dışa aktarma
+    // ========================================================================
+
+    // OpenMetrics metin biçimi ("# EOF" ile biter):
+    //   checkpoint_operations_total{operation,result}               counter
+    //   checkpoint_operation_duration_seconds{operation}            histogram
+    //   checkpoint_stage_duration_seconds{operation,stage}          histogram
+    //   checkpoint_operation_events_total{operation,name}           counter
+    std::string toOpenMetrics() const;
+
+    // İşlem başına tablo: sayı, ortalama/maks süre, aşamaların payı, sayaçlar
+    std::string toText() const;
+
+private:
+    mutable std::mutex m_mutex;
+    bool m_enabled = true;
+    size_t m_traceHistory = DEFAULT_TRACE_HISTORY;
+    std::map<std::string, OperationStats> m_operations;
+    std::deque<OperationTrace> m_recent;
+};
+
+// İzi oluşturan RAII yardımcı. Tek thread'den kullanılır; kapsam biterken
+// finish çağrılmadıysa iz kaydedilir. succeed() çağrılmadan biten işlem
+// başarısız sayılır (erken hata dönüşleri ayrıca işaretlenmez).
+class TraceScope {
+public:
+    explicit TraceScope(std::string operation,
+                        MetricsRegistry& registry = MetricsRegistry::global());
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    // Açık aşamayı kapatıp yenisini başlat
+    void stage(std::string name);
+    // Açık aşamayı kapat (sonraki süre hiçbir aşamaya yazılmaz)
+    void endStage();
+
+    void count(const std::string& name, uint64_t delta = 1);
+    void succeed() { m_trace.success = true; }
+
+    // Aşamayı kapat, toplamı hesapla ve kaydet (bir kez)
+    const OperationTrace& finish();
+    const OperationTrace& trace() const { return m_trace; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    MetricsRegistry& m_registry;
+    OperationTrace m_trace;
+    Clock::time_point m_start;
+    Clock::time_point m_stageStart;
+    std::string m_stage;
+    bool m_finished = false;
+};
+
+} // namespace checkpoint
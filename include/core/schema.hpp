@@ -0,0 +1,321 @@
+#pragma once
+
+#include "core/types.hpp"
+#include "core/binary_io.hpp"
+#include <algorithm>
+#include <concepts>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace checkpoint {
+
+// Serileştirilebilir kavramı
+template<typename T>
+concept Serializable = requires(T obj, StateData& data) {
+    { obj.serialize() } -> std::convertible_to<StateData>;
+    { T::deserialize(data) } -> std::convertible_to<T>;
+};
+
+// ============================================================================
+// Schema - tipli durum için derleme zamanı alan tabanlı serileştirme
+// ============================================================================
+// Tip, alanlarını constexpr bir tuple olarak bildirir:
+//
+//   struct Player {
+//       int hp;
+//       std::string name;
+//       std::vector<uint32_t> items;
+//       static constexpr auto schemaFields() {
+//           return std::make_tuple(schemaField("hp", &Player::hp),
+//                                  schemaField("name", &Player::name),
+//                                  schemaField("items", &Player::items));
+//       }
+//   };
+//
+// Her alanın kodlayıcısı tipinden derleme zamanında seçilir: şemalı tipler
+// (iç içe), std::string, std::vector, std::map, std::optional, Serializable
+// tipler ve trivially-copyable POD'lar. Uzunluklar varint, sabit alanlar
+// host byte sırasıyla yazılır. Alanlar bildirim sırasıyla ve etiketsiz
+// yazılır; şemaya alan eklemek / sırasını değiştirmek biçimi değiştirir.
+//
+// Alan düzeyinde fark: schema::diff yalnız değişen alanları (indeks +
+// kodlanmış değer) taşır, schema::applyDiff bunları yerine koyar.
+
+template<typename T, typename M>
+struct SchemaField {
+    std::string_view name;
+    M T::* member;
+};
+
+template<typename T, typename M>
+constexpr SchemaField<T, M> schemaField(std::string_view name, M T::* member) {
+    return {name, member};
+}
+
+template<typename T>
+concept Reflected = requires { T::schemaFields(); };
+
+namespace schema {
+
+namespace detail {
+
+template<typename T> struct IsVector : std::false_type {};
+template<typename T, typename A> struct IsVector<std::vector<T, A>> : std::true_type {};
+
+template<typename T> struct IsMap : std::false_type {};
+template<typename K, typename V, typename C, typename A>
+struct IsMap<std::map<K, V, C, A>> : std::true_type {};
+
+template<typename T> struct IsOptional : std::false_type {};
+template<typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+template<typename> inline constexpr bool ALWAYS_FALSE = false;
+
+// Ardışık bellekten tek kopyayla yazılabilen eleman tipleri
+template<typename T>
+inline constexpr bool BULK_ELEMENT = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template<typename T, typename Fn, size_t... I>
+constexpr void forEachFieldImpl(Fn&& fn, std::index_sequence<I...>) {
+    constexpr auto fields = T::schemaFields();
+    (fn(std::integral_constant<size_t, I>{}, std::get<I>(fields)), ...);
+}
+
+} // namespace detail
+
+template<Reflected T>
+constexpr size_t fieldCount() {
+    return std::tuple_size_v<decltype(T::schemaFields())>;
+}
+
+// fn(std::integral_constant<size_t, I>, const SchemaField<T, M>&)
+template<Reflected T, typename Fn>
+constexpr void forEachField(Fn&& fn) {
+    detail::forEachFieldImpl<T>(std::forward<Fn>(fn), std::make_index_sequence<fieldCount<T>()>{});
+}
+
+template<Reflected T>
+std::vector<std::string_view> fieldNames() {
+    std::vector<std::string_view> names;
+    names.reserve(fieldCount<T>());
+    forEachField<T>([&](auto, const auto& field) { names.push_back(field.name); });
+    return names;
+}
+
+template<typename T>
+void encodeValue(BinaryWriter& writer, const T& value);
+template<typename T>
+bool decodeValue(BinaryReader& reader, T& value);
+
+template<typename T>
+void encodeValue(BinaryWriter& writer, const T& value) {
+    if constexpr (Reflected<T>) {
+        forEachField<T>([&](auto, const auto& field) { encodeValue(writer, value.*field.member); });
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        writer.writeVarString(value);
+    } else if constexpr (detail::IsVector<T>::value) {
+        using E = typename T::value_type;
+        writer.writeVarint(value.size());
+        if constexpr (detail::BULK_ELEMENT<E>) {
+            writer.writeBytes(value.data(), value.size() * sizeof(E));
+        } else {
+            for (const auto& element : value) encodeValue<E>(writer, element);
+        }
+    } else if constexpr (detail::IsMap<T>::value) {
+        writer.writeVarint(value.size());
+        for (const auto& [key, mapped] : value) {
+            encodeValue(writer, key);
+            encodeValue(writer, mapped);
+        }
+    } else if constexpr (detail::IsOptional<T>::value) {
+        writer.writeBool(value.has_value());
+        if (value) encodeValue(writer, *value);
+    } else if constexpr (Serializable<T>) {
+        StateData bytes = value.serialize();
+        writer.writeVarint(bytes.size());
+        writer.writeBytes(bytes.data(), bytes.size());
+    } else if constexpr (BinaryPod<T>) {
+        writer.write(value);
+    } else {
+        static_assert(detail::ALWAYS_FALSE<T>, "schema: tip kodlanamıyor (schemaFields bildirin)");
+    }
+}
+
+template<typename T>
+bool decodeValue(BinaryReader& reader, T& value) {
+    if constexpr (Reflected<T>) {
+        forEachField<T>([&](auto, const auto& field) { decodeValue(reader, value.*field.member); });
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        value = reader.readVarString();
+    } else if constexpr (detail::IsVector<T>::value) {
+        using E = typename T::value_type;
+        uint64_t count = reader.readVarint();
+        value.clear();
+        if constexpr (detail::BULK_ELEMENT<E>) {
+            if (count > reader.remaining() / sizeof(E)) {
+                reader.fail();      // kesik / bozuk sayı
+                return false;
+            }
+            value.resize(static_cast<size_t>(count));
+            reader.readBytesInto(value.data(), value.size() * sizeof(E));
+        } else {
+            // Sayı bozuksa bile okuma hatası döngüyü keser
+            for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+                E element{};
+                decodeValue(reader, element);
+                value.push_back(std::move(element));
+            }
+        }
+    } else if constexpr (detail::IsMap<T>::value) {
+        uint64_t count = reader.readVarint();
+        value.clear();
+        for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+            typename T::key_type key{};
+            typename T::mapped_type mapped{};
+            decodeValue(reader, key);
+            decodeValue(reader, mapped);
+            value.insert_or_assign(std::move(key), std::move(mapped));
+        }
+    } else if constexpr (detail::IsOptional<T>::value) {
+        value.reset();
+        if (reader.readBool()) {
+            typename T::value_type inner{};
+            decodeValue(reader, inner);
+            value = std::move(inner);
+        }
+    } else if constexpr (Serializable<T>) {
+        auto bytes = reader.readBytes(static_cast<size_t>(reader.readVarint()));
+        if (reader.ok()) {
+            StateData copy(bytes.begin(), bytes.end());
+            value = T::deserialize(copy);
+        }
+    } else if constexpr (BinaryPod<T>) {
+        reader.read(value);
+    } else {
+        static_assert(detail::ALWAYS_FALSE<T>, "schema: tip çözülemiyor (schemaFields bildirin)");
+    }
+    return reader.ok();
+}
+
+template<typename T>
+void encodeTo(StateData& out, const T& value) {
+    BinaryWriter writer(out);
+    encodeValue(writer, value);
+}
+
+template<typename T>
+StateData encode(const T& value) {
+    StateData out;
+    encodeTo(out, value);
+    return out;
+}
+
+// Kesik, bozuk ya da fazladan byte içeren veride nullopt
+template<typename T>
+std::optional<T> decode(std::span<const uint8_t> data) {
+    BinaryReader reader(data);
+    T value{};
+    if (!decodeValue(reader, value) || !reader.atEnd()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+namespace detail {
+
+template<typename M>
+bool fieldEquals(const M& a, const M& b) {
+    if constexpr (std::equality_comparable<M>) {
+        return a == b;
+    } else {
+        return encode(a) == encode(b);
+    }
+}
+
+} // namespace detail
+
+// before → after arasında değeri farklı olan alanların adları
+template<Reflected T>
+std::vector<std::string_view> changedFields(const T& before, const T& after) {
+    std::vector<std::string_view> changed;
+    forEachField<T>([&](auto, const auto& field) {
+        if (!detail::fieldEquals(before.*field.member, after.*field.member)) {
+            changed.push_back(field.name);
+        }
+    });
+    return changed;
+}
+
+// Biçim: varint değişen alan sayısı, her biri için varint indeks + varint
+// uzunluk + kodlanmış değer
+template<Reflected T>
+StateData diff(const T& before, const T& after) {
+    StateData fields;
+    BinaryWriter fieldWriter(fields);
+    uint64_t count = 0;
+    forEachField<T>([&](auto index, const auto& field) {
+        const auto& value = after.*field.member;
+        if (detail::fieldEquals(before.*field.member, value)) return;
+        StateData encoded = encode(value);
+        fieldWriter.writeVarint(index());
+        fieldWriter.writeVarint(encoded.size());
+        fieldWriter.writeBytes(encoded.data(), encoded.size());
+        ++count;
+    });
+    
+    StateData out;
+    BinaryWriter writer(out);
+    writer.writeVarint(count);
+    writer.writeBytes(fields.data(), fields.size());
+    return out;
+}
+
+// diff'i uygula; bozuk farkta target değişmez
+template<Reflected T>
+bool applyDiff(T& target, std::span<const uint8_t> delta) {
+    T patched = target;
+    BinaryReader reader(delta);
+    uint64_t count = reader.readVarint();
+    for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+        uint64_t index = reader.readVarint();
+        auto bytes = reader.readBytes(static_cast<size_t>(reader.readVarint()));
+        if (!reader.ok() || index >= fieldCount<T>()) return false;
+
+        bool decoded = false;
+        forEachField<T>([&](auto fieldIndex, const auto& field) {
+            if (fieldIndex() != index) return;
+            BinaryReader fieldReader(bytes);
+            decoded = decodeValue(fieldReader, patched.*field.member) && fieldReader.atEnd();
+        });
+        if (!decoded) return false;
+    }
+    if (!reader.ok() || !reader.atEnd()) return false;
+    target = std::move(patched);
+    return true;
+}
+
+// source'taki adı verilen alanları target'a kopyala; bilinmeyen ad varsa
+// hiçbir şey kopyalanmaz ve false döner
+template<Reflected T>
+bool copyFields(T& target, const T& source, const std::vector<std::string_view>& names) {
+    auto known = fieldNames<T>();
+    for (auto name : names) {
+        if (std::find(known.begin(), known.end(), name) == known.end()) return false;
+    }
+    forEachField<T>([&](auto, const auto& field) {
+        if (std::find(names.begin(), names.end(), field.name) != names.end()) {
+            target.*field.member = source.*field.member;
+        }
+    });
+    return true;
+}
+
+} // namespace schema
+} // namespace checkpoint
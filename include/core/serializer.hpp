@@ -1,6 +1,8 @@
 #pragma once
 
 #include "core/types.hpp"
+#include "core/codec.hpp"
+#include "core/schema.hpp"
 #include <string>
 #include <vector>
 #include <concepts>
@@ -8,13 +10,6 @@
 
 namespace checkpoint {
 
-// Serileştirilebilir kavramı
-template<typename T>
-concept Serializable = requires(T obj, StateData& data) {
-    { obj.serialize() } -> std::convertible_to<StateData>;
-    { T::deserialize(data) } -> std::convertible_to<T>;
-};
-
 // Temel serileştirici arayüzü
 class ISerializer {
 public:
@@ -30,11 +25,41 @@ public:
     // Checksum hesaplama
     virtual uint32_t calculateChecksum(const StateData& data) = 0;
     virtual bool verifyChecksum(const StateData& data, uint32_t checksum) = 0;
+    
+    // Codec seçimi - compress() veriyi chunkSize'lık bağımsız parçalar
+    // halinde bu codec ile sıkıştırır (threads > 1 ise paralel, 0 = donanım
+    // thread sayısı). Çıktı CompressedFrame'dir; decompressRange ile
+    // herhangi bir aralık tüm veriyi açmadan okunabilir.
+    void setCodec(std::shared_ptr<ICodec> codec,
+                  size_t chunkSize = CompressedFrame::DEFAULT_CHUNK_SIZE,
+                  unsigned threads = 1) {
+        m_codec = codec ? std::move(codec) : createCodec(CodecType::None);
+        m_chunkSize = chunkSize;
+        m_threads = threads;
+    }
+    const ICodec& getCodec() const { return *m_codec; }
+    
+    // Sıkıştırılmış verinin [offset, offset + size) aralığını aç
+    bool decompressRange(const StateData& data, uint64_t offset, void* output, size_t size) {
+        CompressedFrame frame;
+        return frame.open(data.data(), data.size()) &&
+               frame.read(offset, static_cast<uint8_t*>(output), size);
+    }
+    
+protected:
+    explicit ISerializer(CodecType defaultCodec = CodecType::None)
+        : m_codec(createCodec(defaultCodec)) {}
+    
+    std::shared_ptr<ICodec> m_codec;
+    size_t m_chunkSize = CompressedFrame::DEFAULT_CHUNK_SIZE;
+    unsigned m_threads = 1;
 };
 
-// Binary serileştirici implementasyonu
+// Binary serileştirici implementasyonu (varsayılan codec: LZ4)
 class BinarySerializer : public ISerializer {
 public:
+    BinarySerializer() : ISerializer(CodecType::Lz4) {}
+    
     StateData serialize(const void* data, size_t size) override;
     bool deserialize(const StateData& data, void* output, size_t size) override;
     
@@ -44,23 +69,45 @@ public:
     uint32_t calculateChecksum(const StateData& data) override;
     bool verifyChecksum(const StateData& data, uint32_t checksum) override;
     
-    // Yardımcı template fonksiyonlar
+    // Yardımcı template fonksiyonlar: şemalı tipler alan alan (core/schema.hpp),
+    // Serializable tipler kendi kodlayıcılarıyla, diğerleri ham byte olarak
     template<typename T>
     StateData serializeObject(const T& obj) {
-        StateData data(sizeof(T));
-        std::memcpy(data.data(), &obj, sizeof(T));
-        return data;
+        if constexpr (Reflected<T>) {
+            return schema::encode(obj);
+        } else if constexpr (Serializable<T>) {
+            return obj.serialize();
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "serializeObject: schemaFields bildirin ya da Serializable olun");
+            StateData data(sizeof(T));
+            std::memcpy(data.data(), &obj, sizeof(T));
+            return data;
+        }
     }
     
+    // Bozuk / kısa veride varsayılan nesne
     template<typename T>
     T deserializeObject(const StateData& data) {
-        T obj;
-        std::memcpy(&obj, data.data(), sizeof(T));
-        return obj;
+        if constexpr (Reflected<T>) {
+            return schema::decode<T>(data).value_or(T{});
+        } else if constexpr (Serializable<T>) {
+            StateData copy = data;
+            return T::deserialize(copy);
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "deserializeObject: schemaFields bildirin ya da Serializable olun");
+            T obj{};
+            if (data.size() >= sizeof(T)) {
+                std::memcpy(&obj, data.data(), sizeof(T));
+            }
+            return obj;
+        }
     }
 };
 
 // JSON serileştirici (opsiyonel, daha okunaklı çıktı için)
+// Okunabilirlik için varsayılan codec None; setCodec ile değiştirilebilir
 class JsonSerializer : public ISerializer {
 public:
     StateData serialize(const void* data, size_t size) override;
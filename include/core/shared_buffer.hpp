@@ -0,0 +1,104 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace checkpoint {
+
+// ============================================================================
+// Shared Buffer - değişmez, referans sayımlı byte dizisi
+// ============================================================================
+// Checkpoint verisi StateData olarak taşındığında her getCheckpoint, storage
+// load'u ve rollback multi-MB kopya demektir. SharedBuffer içeriği bir kez
+// oluşturulur ve sonra sadece paylaşılır: kopyalamak referans sayısını
+// artırır, slice() aynı belleğin bir parçasını işaret eder. Sahip bir
+// StateData (taşınarak alınır), mmap'lenmiş bir dosya ya da BufferArena
+// bloğu olabilir; son referans gidince serbest bırakılır.
+//
+//   SharedBuffer buf(std::move(state));      // kopya yok
+//   SharedBuffer part = buf.slice(16, 1024); // kopya yok
+//   StateData copy = part.toVector();        // açık kopya
+class SharedBuffer {
+public:
+    using value_type = uint8_t;
+    using const_iterator = const uint8_t*;
+    using iterator = const_iterator;
+    using size_type = size_t;
+
+    SharedBuffer() = default;
+    // StateData'yı sahiplenir (kopya yok)
+    SharedBuffer(StateData&& data);
+    // owner, [data, data+size) geçerli kaldığı sürece tutulur
+    SharedBuffer(std::shared_ptr<const void> owner, const uint8_t* data, size_t size);
+
+    static SharedBuffer copyOf(const void* data, size_t size);
+    static SharedBuffer copyOf(const StateData& data) { return copyOf(data.data(), data.size()); }
+
+    // Dosyanın tamamını salt okunur mmap'le. Eşleme dosya kesilirse
+    // (truncate) SIGBUS verir; yazıcılar yeni dosyaya yazıp rename etmeli.
+    static std::optional<SharedBuffer> mapFile(const std::string& path,
+                                               std::string* error = nullptr);
+    static std::optional<SharedBuffer> mapFile(int fd, size_t size,
+                                               std::string* error = nullptr);
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+    uint8_t operator[](size_t i) const { return m_data[i]; }
+
+    // Aynı belleğin [offset, offset+length) parçası; sınır dışı kısım kırpılır
+    SharedBuffer slice(size_t offset, size_t length) const;
+
+    StateData toVector() const { return StateData(begin(), end()); }
+
+    // Aynı sahip belleği paylaşıyor mu (içerik karşılaştırması değil)
+    bool sharesStorageWith(const SharedBuffer& other) const;
+    long useCount() const { return m_owner.use_count(); }
+
+    friend bool operator==(const SharedBuffer& a, const SharedBuffer& b);
+    friend bool operator==(const SharedBuffer& a, const StateData& b);
+
+private:
+    std::shared_ptr<const void> m_owner;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+// ============================================================================
+// Buffer Arena - küçük buffer'lar için blok tabanlı ayırıcı
+// ============================================================================
+// Her copy() ayrı bir heap ayırması yerine ortak bir bloktan yer alır;
+// dönen SharedBuffer bloğu canlı tutar. Blok, ondan alınan son buffer
+// gidince serbest kalır. blockSize'ın yarısından büyük istekler ayrı
+// ayrılır. Thread-safe.
+class BufferArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+    explicit BufferArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    BufferArena(const BufferArena&) = delete;
+    BufferArena& operator=(const BufferArena&) = delete;
+
+    SharedBuffer copy(const void* data, size_t size);
+    SharedBuffer copy(const StateData& data) { return copy(data.data(), data.size()); }
+
+    size_t blockSize() const { return m_blockSize; }
+    size_t blocksAllocated() const;
+
+private:
+    size_t m_blockSize;
+    std::shared_ptr<uint8_t[]> m_block;
+    size_t m_used;
+    size_t m_blocksAllocated;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace checkpoint
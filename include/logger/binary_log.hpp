@@ -0,0 +1,183 @@
+#pragma once
+
+#include "logger/operation_logger.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace checkpoint {
+
+// ============================================================================
+// Binary Log Format (CKLG v1)
+// ============================================================================
+// Kayıtlar yazılırken formatlanmaz; text/JSON çıktısı sonradan decoder ile
+// üretilir. Category, dosya adı, context anahtarları ve mesaj şablonları
+// dosya başına bir kez yazılıp id ile referans edilir. Mesajdaki sayılar
+// şablondan çıkarılıp varint argüman olarak saklanır:
+//   "Operation 42 completed" -> şablon "Operation \x1F completed", args [42]
+//
+//   "CKLG" | version u8 | record*
+//   STRING: 0x01 | len varint | bytes                  (id'ler 1'den sırayla)
+//   ENTRY:  0x02 | level u8 | Δid zigzag | Δtimestamp(ns) zigzag |
+//           categoryId | templateId | fileId (0 = yok) | line |
+//           argCount | args... | contextCount | (keyId | len | bytes)...
+namespace binlog {
+
+constexpr char MAGIC[4] = {'C', 'K', 'L', 'G'};
+constexpr uint8_t VERSION = 1;
+constexpr uint8_t RECORD_STRING = 0x01;
+constexpr uint8_t RECORD_ENTRY = 0x02;
+constexpr char ARG_PLACEHOLDER = '\x1F';
+
+inline void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+inline bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+inline uint64_t zigzag(int64_t v) {
+    return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+inline int64_t unzigzag(uint64_t v) {
+    return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+// Mesajı şablon + sayı argümanlarına ayır. Mesaj placeholder karakterini
+// içeriyorsa ya da sayı u64'e sığmıyorsa o kısım literal kalır.
+void splitMessage(const std::string& message, std::string& pattern, std::vector<uint64_t>& args);
+std::string joinMessage(const std::string& pattern, const std::vector<uint64_t>& args);
+
+int64_t toNanos(const Timestamp& ts);
+Timestamp fromNanos(int64_t ns);
+
+void appendHeader(std::vector<uint8_t>& out);
+// Başarılıysa p header'ın arkasına ilerletilir
+bool readHeader(const uint8_t*& p, const uint8_t* end, std::string& error);
+
+// Kayıt üretici: string tablosu ve delta durumu dosya/tampon başına
+class Encoder {
+public:
+    void reset();
+    void encode(const LogEntry& entry, std::vector<uint8_t>& out);
+
+private:
+    std::unordered_map<std::string, uint64_t> m_strings;
+    uint64_t m_lastId = 0;
+    int64_t m_lastTimestamp = 0;
+
+    // Scratch alanlar (kayıt başına allocation olmasın)
+    std::string m_pattern;
+    std::vector<uint64_t> m_args;
+    std::vector<uint64_t> m_keyIds;
+
+    uint64_t intern(const std::string& str, std::vector<uint8_t>& out);
+};
+
+// Kayıt çözücü: STRING kayıtlarını tabloya alır, ENTRY'de durur
+class Decoder {
+public:
+    enum class Status { Entry, End, Corrupt };
+
+    void reset();
+    Status decode(const uint8_t*& p, const uint8_t* end, LogEntry& entry);
+
+private:
+    std::vector<std::string> m_strings{std::string()};     // id 0 = boş
+    uint64_t m_lastId = 0;
+    int64_t m_lastTimestamp = 0;
+    std::vector<uint64_t> m_args;
+
+    const std::string* lookup(uint64_t id) const;
+};
+
+} // namespace binlog
+
+// ============================================================================
+// Binary Log Output - LogEntry'leri formatlamadan sıkıştırılmış yazar
+// ============================================================================
+// Kayıtlar tamponlanır (BUFFER_SIZE dolunca ya da flush'ta yazılır).
+// maxFileSize > 0 ise FileLogOutput gibi .0, .1 ... yedekleriyle döner;
+// her dosya kendi string tablosunu taşır ve tek başına decode edilebilir.
+class BinaryLogOutput : public ILogOutput {
+public:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    explicit BinaryLogOutput(const std::filesystem::path& filePath,
+                             size_t maxFileSize = 0,
+                             int maxBackupCount = 5);
+    ~BinaryLogOutput() override;
+
+    bool acceptsEntries() const override { return true; }
+    void writeEntry(const LogEntry& entry) override;
+
+    // Önceden formatlanmış metin - mesaj olarak saklanır
+    void write(const std::string& formattedEntry) override;
+    void flush() override;
+
+    uint64_t entriesWritten() const { return m_entries; }
+
+private:
+    std::ofstream m_file;
+    std::filesystem::path m_filePath;
+    size_t m_maxFileSize;
+    int m_maxBackupCount;
+    std::mutex m_mutex;
+
+    std::vector<uint8_t> m_buffer;
+    uint64_t m_fileBytes;
+    uint64_t m_entries;
+    binlog::Encoder m_encoder;
+
+    void openFile();
+    void flushBuffer();
+    void rotateIfNeeded();
+};
+
+// ============================================================================
+// Binary Log Reader - CKLG dosyasını LogEntry'lere çözer
+// ============================================================================
+class BinaryLogReader {
+public:
+    BinaryLogReader();
+
+    bool open(const std::filesystem::path& filePath);
+
+    // Sıradaki entry; dosya sonunda ya da bozuk kayıtta nullopt
+    // (bozuksa getLastError dolu)
+    std::optional<LogEntry> next();
+    std::vector<LogEntry> readAll();
+
+    std::string getLastError() const { return m_lastError; }
+
+    // Dosyayı formatter ile metne dök; dönüş: yazılan entry sayısı
+    static size_t render(const std::filesystem::path& filePath,
+                         ILogFormatter& formatter,
+                         std::ostream& out,
+                         std::string* error = nullptr);
+
+private:
+    std::vector<uint8_t> m_data;
+    size_t m_pos;
+    binlog::Decoder m_decoder;
+    std::string m_lastError;
+};
+
+} // namespace checkpoint
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace checkpoint {
+
+// Segmentlere bölünmüş, ekleme sırasını koruyan geçmiş kaydı
+// Her kayıt artan bir sıra numarası (seq) alır; seq -> kayıt O(1)'dir.
+// Eski geçmiş yalnızca baştaki tam segmentler atılarak temizlenir, böylece
+// geri kalan kayıtlar hiç kaydırılmaz ve seq'ler geçerli kalır.
+//
+// Zaman sorguları için her segment min/max timestamp ve o segmente kadarki
+// en büyük timestamp'i (prefixMax, monoton) tutar. Kayıtlar farklı
+// thread'lerden kilit almadan önce damgalandığı için sıra hafifçe bozuk
+// olabilir; görülen en büyük gecikme (lateness) sorgu sınırına eklenir.
+// T'nin bir `timestamp` alanı olmalı.
+template<typename T>
+class SegmentedHistory {
+public:
+    static constexpr size_t SEGMENT_SIZE = 4096;
+
+    uint64_t firstSeq() const { return m_base; }
+    uint64_t endSeq() const { return m_base + m_size; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool contains(uint64_t seq) const { return seq >= m_base && seq < endSeq(); }
+
+    uint64_t push(T value) {
+        if (m_segments.empty() || m_segments.back().items.size() == SEGMENT_SIZE) {
+            Segment seg;
+            seg.items.reserve(SEGMENT_SIZE);
+            seg.minTs = seg.maxTs = value.timestamp;
+            seg.prefixMax = m_segments.empty()
+                ? value.timestamp : std::max(m_segments.back().prefixMax, value.timestamp);
+            m_segments.push_back(std::move(seg));
+        }
+
+        Segment& seg = m_segments.back();
+        const Timestamp ts = value.timestamp;
+        if (ts < seg.prefixMax) {
+            m_lateness = std::max(m_lateness, seg.prefixMax - ts);
+        }
+        seg.minTs = std::min(seg.minTs, ts);
+        seg.maxTs = std::max(seg.maxTs, ts);
+        seg.prefixMax = std::max(seg.prefixMax, ts);
+        seg.items.push_back(std::move(value));
+        return m_base + m_size++;
+    }
+
+    T& at(uint64_t seq) {
+        size_t idx = seq - m_base;
+        return m_segments[idx / SEGMENT_SIZE].items[idx % SEGMENT_SIZE];
+    }
+
+    const T& at(uint64_t seq) const {
+        size_t idx = seq - m_base;
+        return m_segments[idx / SEGMENT_SIZE].items[idx % SEGMENT_SIZE];
+    }
+
+    // [from, endSeq) aralığını sırayla gez
+    template<typename F>
+    void forEachFrom(uint64_t from, F&& f) const {
+        for (uint64_t seq = std::max(from, m_base); seq < endSeq(); ++seq) {
+            f(at(seq));
+        }
+    }
+
+    // Sondan başa gez; f false dönerse dur
+    template<typename F>
+    void forEachReverse(F&& f) const {
+        for (auto seg = m_segments.rbegin(); seg != m_segments.rend(); ++seg) {
+            for (auto it = seg->items.rbegin(); it != seg->items.rend(); ++it) {
+                if (!f(*it)) return;
+            }
+        }
+    }
+
+    // timestamp'i [start, end] aralığındaki kayıtlar, ekleme sırasıyla.
+    // Maliyet: O(log segment + k + sınır segmentleri)
+    template<typename F>
+    void forEachBetween(Timestamp start, Timestamp end, F&& f) const {
+        auto first = std::partition_point(m_segments.begin(), m_segments.end(),
+            [&](const Segment& seg) { return seg.prefixMax < start; });
+
+        for (auto seg = first; seg != m_segments.end(); ++seg) {
+            // Sonraki kayıtların hepsi bu segmentin max'ından en fazla
+            // lateness kadar geride olabilir
+            if (seg != first && (seg - 1)->maxTs - m_lateness > end) break;
+            if (seg->maxTs < start || seg->minTs > end) continue;
+            for (const auto& item : seg->items) {
+                if (item.timestamp >= start && item.timestamp <= end) f(item);
+            }
+        }
+    }
+
+    // Boyut maxItems'ın altına inmeyecek şekilde baştaki tam segmentleri at.
+    // onEvict her atılan kayıt için (eski -> yeni sırayla) çağrılır.
+    template<typename F>
+    size_t evict(size_t maxItems, F&& onEvict) {
+        size_t evicted = 0;
+        while (m_segments.size() > 1 && m_size - m_segments.front().items.size() >= maxItems) {
+            for (const auto& item : m_segments.front().items) onEvict(item);
+            size_t n = m_segments.front().items.size();
+            m_segments.pop_front();
+            m_base += n;
+            m_size -= n;
+            evicted += n;
+        }
+        return evicted;
+    }
+
+    // seq'ler sıfırlanmaz; eski seq'ler geçersiz kalır
+    void clear() {
+        m_segments.clear();
+        m_base += m_size;
+        m_size = 0;
+        m_lateness = Timestamp::duration::zero();
+    }
+
+private:
+    struct Segment {
+        std::vector<T> items;
+        Timestamp minTs;
+        Timestamp maxTs;
+        Timestamp prefixMax;
+    };
+
+    std::deque<Segment> m_segments;
+    uint64_t m_base = 0;
+    size_t m_size = 0;
+    Timestamp::duration m_lateness = Timestamp::duration::zero();
+};
+
+} // namespace checkpoint
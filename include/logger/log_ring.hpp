@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace checkpoint {
+
+// Sınırlı, kilitsiz çok-üretici / tek-tüketici halka tampon
+// Slotlar baştan ayrılır; her slotta bir sıra numarası tutulur (Vyukov).
+// Üretici bir slotu CAS ile alır, yerinde doldurur ve sıra numarasını
+// yayınlar; tüketici sadece yayınlanmış slotları okur. Slot içerikleri
+// yeniden kullanıldığı için string kapasiteleri de korunur.
+template<typename T>
+class MpscRing {
+public:
+    // capacity 2'nin kuvvetine yukarı yuvarlanır
+    explicit MpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_mask = size - 1;
+        m_slots = std::make_unique<Slot[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            m_slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t capacity() const { return m_mask + 1; }
+
+    // Şimdiye kadar alınan slot sayısı (yayınlanmamışlar dahil)
+    uint64_t enqueued() const { return m_head.load(std::memory_order_acquire); }
+
+    // Boş slot varsa fill(T&) ile doldur; doluysa false
+    template<typename Fill>
+    bool tryPush(Fill&& fill) {
+        uint64_t pos = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = m_slots[pos & m_mask];
+            uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Sadece tüketici thread'i: en fazla max yayınlanmış slotu sırayla
+    // consume(T&) ile işle. Dönüş: işlenen slot sayısı.
+    template<typename Consume>
+    size_t drain(Consume&& consume, size_t max) {
+        size_t n = 0;
+        while (n < max) {
+            Slot& slot = m_slots[m_tail & m_mask];
+            if (slot.seq.load(std::memory_order_acquire) != m_tail + 1) {
+                break;
+            }
+            consume(slot.value);
+            slot.seq.store(m_tail + m_mask + 1, std::memory_order_release);
+            ++m_tail;
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    size_t m_mask = 0;
+    alignas(64) std::atomic<uint64_t> m_head{0};
+    alignas(64) uint64_t m_tail = 0;
+};
+
+} // namespace checkpoint
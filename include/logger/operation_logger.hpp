@@ -53,6 +53,11 @@ public:
     virtual ~ILogOutput() = default;
     virtual void write(const std::string& formattedEntry) = 0;
     virtual void flush() = 0;
+    
+    // true dönen output'lar ham LogEntry alır (writeEntry); formatlama
+    // yalnızca metin isteyen bir output varsa yapılır
+    virtual bool acceptsEntries() const { return false; }
+    virtual void writeEntry(const LogEntry& entry) { (void)entry; }
 };
 
 // Console output
@@ -87,6 +92,12 @@ public:
     void flush() override;
 };
 
+// Async kuyruk dolduğunda üreticinin davranışı
+enum class LogOverflowPolicy {
+    Block,      // Yer açılana kadar bekle (kayıp yok)
+    Drop        // Kaydı at ve sayacı artır
+};
+
 // İşlem Logger'ı - ana logger sınıfı
 class OperationLogger {
 private:
@@ -103,9 +114,17 @@ public:
     // Konfigürasyon
     void setMinLevel(LogLevel level);
     void addOutput(std::shared_ptr<ILogOutput> output);
+    void clearOutputs();        // varsayılan console output dahil
     void setFormatter(std::shared_ptr<ILogFormatter> formatter);
     void enableAsync(bool enable);
     
+    // Async mod: log() kayıtları kilitsiz, önceden ayrılmış bir halkaya
+    // yazar; tek bir thread toplu halde boşaltıp output'lara iletir ve
+    // geçmişe ekler (flush() boşalmayı bekler). enableAsync'ten önce çağrılmalı.
+    static constexpr size_t DEFAULT_ASYNC_CAPACITY = 8192;
+    void setAsyncQueue(size_t capacity, LogOverflowPolicy policy = LogOverflowPolicy::Block);
+    uint64_t getDroppedCount() const;
+    
     // Logging metodları
     void log(LogLevel level, const std::string& category, 
              const std::string& message, const char* file = nullptr, int line = 0);
@@ -132,6 +151,13 @@ public:
     std::vector<OperationRecord> getOperationHistory(size_t maxCount = 100);
     std::vector<OperationRecord> getOperationsSince(CheckpointId checkpointId);
     
+    // Saklama: geçmiş SegmentedHistory::SEGMENT_SIZE'lık segmentler
+    // halinde tutulur; sınır aşılınca en eski segment bütün olarak atılır
+    // (kayıtlar kaydırılmaz). En az max* kayıt korunur, 0 = sınırsız.
+    void setRetention(size_t maxEntries, size_t maxOperations);
+    size_t getEntryCount() const;
+    size_t getOperationCount() const;
+    
     // Temizlik
     void clear();
     void flush();
@@ -129,8 +129,12 @@ public:
     
     // Scan and relocate pointers in memory dump
     // WARNING: This is heuristic and may corrupt data!
+    // Checkpoint bölgeleri başlangıca göre sıralı bir tabloya (bölge başına
+    // offset ile) alınır. Word'ler önce SIMD ile (AVX2/NEON) tüm bölgelerin
+    // [min, max) aralığına göre süzülür, adaylar tabloda binary search ile
+    // aranır; bölgeler arası boşluklara düşen değerler sayılmaz.
     struct RelocationResult {
-        size_t pointersFound;
+        size_t pointersFound;       // Bir checkpoint bölgesine düşen word'ler
         size_t pointersRelocated;
         std::vector<uint64_t> relocatedAddresses;
     };
@@ -142,6 +146,16 @@ public:
         bool conservative = true  // Only relocate likely pointers
     );
     
+    // Tüm dump'lar: tablo bir kez kurulur, dump'lar threads worker'a
+    // dağıtılır (0 = donanım thread sayısı). Sonuç dump sırasıyla birleşir.
+    RelocationResult relocatePointers(
+        std::vector<MemoryDump>& dumps,
+        const std::vector<MemoryRegion>& checkpointMap,
+        const AddressOffset& offsets,
+        bool conservative = true,
+        unsigned threads = 0
+    );
+    
     // ========================================================================
     // Utilities
     // ========================================================================
@@ -187,6 +201,23 @@ private:
     };
     
     RegionType identifyRegionType(const MemoryRegion& region);
+    
+    static int64_t regionOffset(RegionType type, const AddressOffset& offsets);
+    
+    // relocatePointers için sıralı bölge tablosu
+    struct RelocationTarget {
+        uint64_t startAddr;
+        uint64_t endAddr;
+        int64_t offset;
+        bool relocate;              // conservative filtre ve offset != 0
+    };
+    std::vector<RelocationTarget> buildRelocationTable(
+        const std::vector<MemoryRegion>& checkpointMap,
+        const AddressOffset& offsets,
+        bool conservative
+    );
+    static void scanDump(MemoryDump& dump, const std::vector<RelocationTarget>& table,
+                         RelocationResult& result);
 };
 
 // ============================================================================
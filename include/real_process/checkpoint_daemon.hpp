@@ -0,0 +1,249 @@
+#pragma once
+
+#include "real_process/ptrace_controller.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Daemon Policy - zamanlanmış checkpoint işleri
+// ============================================================================
+// Satır tabanlı policy dosyası; '#' sonrası yorumdur:
+//
+//   directory  /var/lib/checkpoints
+//   socket     /run/checkpointd.sock     # boş / yok = kontrol socket'i kapalı
+//   workers    4
+//   queue      64                         # bekleyen snapshot sınırı
+//   io_limit   64M                        # byte/s (K, M, G); 0 = sınırsız
+//   cpu_limit  0.5                        # worker'ların toplam çekirdek payı
+//   fork_snapshot on                      # target sadece fork kadar durur
+//   job web    pid 1234 every 30s keep 5
+//   job batch  cgroup /sys/fs/cgroup/batch every 5m keep 10
+//
+// cgroup yolu '/' ile başlamıyorsa /sys/fs/cgroup altında aranır; her turda
+// cgroup.procs yeniden okunur. Süreler ms, s, m, h son eklerini alır.
+struct DaemonJob {
+    enum class Target {
+        Pid,
+        Cgroup
+    };
+
+    std::string name;                       // Dosya adı öneki: [A-Za-z0-9_-]
+    Target target = Target::Pid;
+    pid_t pid = 0;
+    std::string cgroup;
+    std::chrono::milliseconds interval{60000};
+    unsigned keep = 0;                      // pid başına saklanan imaj (0 = hepsi)
+};
+
+struct DaemonPolicy {
+    std::string directory = "./daemon_checkpoints";
+    std::string controlSocket;
+    unsigned workers = 2;
+    size_t queueLimit = 64;
+    uint64_t ioBytesPerSec = 0;
+    double cpuCores = 0;
+
+    // Policy dosyası fork_snapshot dışında bunları değiştirmez
+    CheckpointOptions checkpoint;
+    RestoreOptions restore;
+
+    std::vector<DaemonJob> jobs;
+
+    DaemonPolicy();
+
+    const DaemonJob* job(const std::string& name) const;
+
+    // Hatalı satırda std::nullopt; error "satır N: ..." olur
+    static std::optional<DaemonPolicy> parse(const std::string& text, std::string* error = nullptr);
+    static std::optional<DaemonPolicy> load(const std::string& filepath, std::string* error = nullptr);
+};
+
+// ============================================================================
+// Rate Limiter - token bucket
+// ============================================================================
+// Kova rate * burstSeconds token'a kadar dolar. acquire token'ı rezerve edip
+// kova borçtan çıkana kadar bekler; charge beklemeden düşer (iş bittikten
+// sonra ölçülen maliyet için - sonraki acquire borcu öder). rate 0 sınırsız.
+class RateLimiter {
+public:
+    explicit RateLimiter(double ratePerSec = 0, double burstSeconds = 1.0);
+
+    void acquire(uint64_t amount);
+    void charge(uint64_t amount);
+
+    // Açıkken bekleyenler uyanır ve acquire beklemez (kapanış için)
+    void setCancelled(bool cancelled);
+
+    bool isLimited() const { return m_rate > 0; }
+    double rate() const { return m_rate; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const double m_rate;
+    const double m_capacity;
+    double m_tokens;
+    Clock::time_point m_last;
+    bool m_cancelled = false;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    void refill();
+};
+
+// ============================================================================
+// Checkpoint Daemon
+// ============================================================================
+// Zamanlayıcı thread'i vadesi gelen işleri hedef pid'lere açar ve sınırlı
+// bir worker havuzunun kuyruğuna koyar. Kuyruk doluysa ya da aynı pid'in
+// önceki snapshot'ı hâlâ sürüyorsa o tur atlanır (dropped). Her worker
+// kendi checkpointer'ını kullanır (ptrace tracer thread'ine bağlıdır).
+//
+// Snapshot'lar createCheckpointToSink ile doğrudan dosyaya stream edilir;
+// io_limit dump yazımlarını, cpu_limit worker thread'lerinin CPU süresini
+// (CLOCK_THREAD_CPUTIME_ID) kısar. fork_snapshot açıkken kısma target'ı
+// değil COW child'ı bekletir. İmaj önce ".part" adıyla yazılıp tamamlanınca
+// "<job>.<pid>.<epoch ms>.chkpt" adına taşınır; ardından (job, pid) için
+// keep'ten eski imajlar silinir.
+//
+// Kontrol socket'i (AF_UNIX, satır tabanlı) 0600 izniyle oluşturulur ve
+// sadece root ya da daemon'ın kullanıcısı (SO_PEERCRED) kabul edilir; yolda
+// socket olmayan bir dosya varsa start başarısız olur. Her istek satırına
+// sıfır ya da daha fazla veri satırı ve "OK ..." / "ERR ..." ile biten bir
+// yanıt döner:
+//   status                      sayaçlar
+//   jobs                        iş başına "<ad> <hedef> runs=.. failures=.."
+//   snapshot <job> | pid <pid>  hemen al ve bitmesini bekle
+//   list [job]                  saklanan imajlar
+//   restore <file> <pid>        imajı (dizine göre) pid'e restore et
+//   metrics                     MetricsRegistry::toOpenMetrics
+//   quit                        bağlantıyı kapat
+// İstekler kontrol thread'inde sırayla işlenir; uzun bir restore diğer
+// bağlantıları bekletir.
+class CheckpointDaemon {
+public:
+    struct Snapshot {
+        bool success = false;
+        pid_t pid = 0;
+        std::string path;
+        uint64_t bytes = 0;                 // Dosya boyutu
+        std::string error;
+    };
+
+    struct Stats {
+        uint64_t snapshots = 0;
+        uint64_t failures = 0;
+        uint64_t dropped = 0;               // Kuyruk dolu / önceki sürüyor
+        uint64_t bytesWritten = 0;
+        uint64_t filesRemoved = 0;          // Retention
+        uint64_t restores = 0;
+        size_t queued = 0;
+        size_t running = 0;
+    };
+
+    explicit CheckpointDaemon(DaemonPolicy policy);
+    ~CheckpointDaemon();
+
+    CheckpointDaemon(const CheckpointDaemon&) = delete;
+    CheckpointDaemon& operator=(const CheckpointDaemon&) = delete;
+
+    // Dizini, socket'i ve thread'leri kur
+    bool start();
+    // Zamanlamayı durdurur, kuyruktaki işleri iptal eder, süren işleri bekler
+    void stop();
+    bool isRunning() const;
+
+    // Senkron, worker havuzu üzerinden (kuyruk doluysa hata)
+    std::vector<Snapshot> snapshotJob(const std::string& jobName);
+    Snapshot snapshotPid(pid_t pid, const std::string& jobName = "manual");
+    RestoreResult restore(const std::string& filepath, pid_t pid);
+
+    // Tek kontrol isteğini işle (socket'ten bağımsız, test edilebilir)
+    std::string handleCommand(const std::string& line);
+
+    // Dizindeki imaj dosya adları (jobName verilirse sadece onunkiler); ada
+    // göre sıralı, yani aynı (job, pid) içinde eskiden yeniye
+    std::vector<std::string> listImages(const std::string& jobName = "") const;
+
+    Stats stats() const;
+    const DaemonPolicy& policy() const { return m_policy; }
+    std::string getLastError() const { return m_lastError; }
+
+    void setMetricsRegistry(MetricsRegistry& registry) { m_metrics = &registry; }
+
+    // dir altında prefix ile başlayan .chkpt'lerden en yeni keep tanesi
+    // dışındakileri siler; silinen sayısını döner
+    static size_t applyRetention(const std::string& directory, const std::string& prefix,
+                                 unsigned keep);
+
+    // cgroup.procs; okunamazsa boş
+    static std::vector<pid_t> readCgroupPids(const std::string& cgroup);
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void(RealProcessCheckpointer&)>;
+
+    static constexpr int CONTROL_IDLE_MS = 30000;   // Boşta bağlantı kapatılır
+
+    struct JobState {
+        Clock::time_point nextDue;
+        uint64_t runs = 0;
+        uint64_t failures = 0;
+        std::string lastPath;
+    };
+
+    DaemonPolicy m_policy;
+    MetricsRegistry* m_metrics = &MetricsRegistry::global();
+    RateLimiter m_ioLimiter;
+    RateLimiter m_cpuLimiter;
+    std::shared_ptr<DumpBufferPool> m_bufferPool;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_taskCv;       // Worker'lar
+    std::condition_variable m_scheduleCv;   // Zamanlayıcı
+    std::deque<Task> m_tasks;
+    std::set<pid_t> m_inFlight;             // Zamanlanmış, henüz bitmemiş
+    std::set<pid_t> m_active;               // Şu an ptrace edilen (worker başına bir)
+    std::condition_variable m_activeCv;
+    std::map<std::string, JobState> m_jobStates;
+    Stats m_stats;
+    bool m_running = false;
+    bool m_stopping = false;
+
+    std::vector<std::thread> m_workers;
+    std::thread m_scheduler;
+    std::thread m_control;
+    int m_listenFd = -1;
+    int m_wakeFd = -1;                      // eventfd: kontrol thread'ini durdur
+    std::string m_lastError;
+
+    void workerLoop();
+    void schedulerLoop();
+    void controlLoop();
+    void serveConnection(int fd);
+
+    // m_mutex tutulurken; kuyruk doluysa false
+    bool enqueueLocked(Task task);
+    // Aynı pid'e iki worker aynı anda attach edemez: zamanlanmış ve istek
+    // üzerine işler pid başına sıralanır. Durdurulurken false.
+    bool claimPid(pid_t pid);
+    void releasePid(pid_t pid);
+    std::vector<pid_t> jobPids(const DaemonJob& job) const;
+    Snapshot takeSnapshot(RealProcessCheckpointer& checkpointer, const std::string& jobName, pid_t pid);
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "real_process/checkpoint_stream.hpp"
+#include <span>
+#include <string>
+#include <vector>
+#include <optional>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Indexed Checkpoint Image (RCHK v7, v4 okunur)
+// ============================================================================
+// Stream formatında dump'lara ulaşmak için tüm dosya baştan okunmalıdır.
+// İndeksli imaj payload'ları sayfa hizalı offset'lere koyar ve sona bir region
+// index tablosu ekler; dosya mmap edilip sadece footer ve index okunarak
+// açılır, dump verisi ancak dokunulduğunda page cache'ten gelir.
+//
+//   [header (dumpCount = 0; v7'de thread bölümü dahil)] [pad] [payload 0] [pad] [payload 1] ...
+//   [index: start u64, end u64, flags u8, offset u64, size u64, crc32c u32] x N
+//   [signals] [footer: indexOffset u64, dumpCount u32, reserved u32, "RCHKIDX\0"]
+
+// ============================================================================
+// Checkpoint Image Writer - v7 imajını sıralı yazar
+// ============================================================================
+class CheckpointImageWriter : public ICheckpointSink {
+public:
+    static constexpr uint64_t PAYLOAD_ALIGNMENT = 4096;
+
+    CheckpointImageWriter();
+    ~CheckpointImageWriter() override;
+
+    CheckpointImageWriter(const CheckpointImageWriter&) = delete;
+    CheckpointImageWriter& operator=(const CheckpointImageWriter&) = delete;
+
+    bool open(const std::string& filepath);
+    // Yazmalar IoEngine üzerinden (bkz. CheckpointStreamWriter::open)
+    bool open(const std::string& filepath, const IoEngineOptions& io);
+    void close();
+    bool isOpen() const { return m_fd >= 0 || m_async != nullptr; }
+
+    bool writeHeader(const RealProcessCheckpoint& checkpoint) override;
+
+    // Payload PAYLOAD_ALIGNMENT'a hizalanarak yazılır, CRC32C'si ile
+    // index'e eklenir
+    bool writeDump(const MemoryDump& dump) override;
+
+    // Index + signals + footer
+    bool finish(const SignalInfo& signals) override;
+
+    uint64_t bytesWritten() const { return m_offset; }
+    size_t dumpsWritten() const { return m_index.size(); }
+    std::string getLastError() const override { return m_lastError; }
+
+private:
+    struct IndexEntry {
+        uint64_t startAddr;
+        uint64_t endAddr;
+        uint8_t flags;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t checksum;
+    };
+
+    int m_fd;
+    bool m_headerWritten;
+    bool m_finished;
+    uint64_t m_offset;
+    std::vector<IndexEntry> m_index;
+    std::unique_ptr<AsyncFileWriter> m_async;
+    std::string m_lastError;
+
+    bool writeAll(const void* data, size_t size);
+    bool padToAlignment();
+};
+
+// ============================================================================
+// Mapped Checkpoint Image - v4/v7 imajını mmap ile tembel açar
+// ============================================================================
+// open() sadece header, index ve footer'ı okur; açılış süresi imaj
+// boyutundan bağımsızdır. dumpData() mapping'e bakan bir view döner ve
+// imaj açık kaldığı sürece geçerlidir.
+class MappedCheckpointImage {
+public:
+    MappedCheckpointImage();
+    ~MappedCheckpointImage();
+
+    MappedCheckpointImage(const MappedCheckpointImage&) = delete;
+    MappedCheckpointImage& operator=(const MappedCheckpointImage&) = delete;
+
+    bool open(const std::string& filepath);
+    void close();
+    bool isOpen() const { return m_base != nullptr; }
+
+    // Dosya v4/v7 indeksli imaj mı (magic + version kontrolü)
+    static bool isIndexedImage(const std::string& filepath);
+
+    // Metadata, register'lar, memory map ve signals (memoryDumps boş)
+    const RealProcessCheckpoint& metadata() const { return m_metadata; }
+
+    size_t dumpCount() const { return m_entries.size(); }
+    const MemoryRegion& dumpRegion(size_t index) const { return m_entries[index].region; }
+    // Sıfır sayfa aralığı (payload yok, dumpData boş)
+    bool isZeroFill(size_t index) const { return m_entries[index].zeroFill; }
+
+    // Mapping içindeki payload (kopya yok)
+    std::span<const uint8_t> dumpData(size_t index) const;
+
+    // addr'ı içeren dump'ın index'i (adrese göre sıralı tabloda binary search)
+    std::optional<size_t> findDump(uint64_t addr) const;
+
+    // Payload'ın dosyadaki (PAYLOAD_ALIGNMENT hizalı) offset'i
+    uint64_t dumpOffset(size_t index) const { return m_entries[index].offset; }
+
+    // Yazarken hesaplanan CRC32C ve payload ile karşılaştırma
+    uint32_t dumpChecksum(size_t index) const { return m_entries[index].checksum; }
+    bool verifyDump(size_t index) const;
+
+    // Tek dump'ı heap'e kopyala
+    MemoryDump loadDump(size_t index) const;
+
+    // Tüm imajı klasik RealProcessCheckpoint'e çevir
+    RealProcessCheckpoint materialize() const;
+
+    uint64_t fileSize() const { return m_size; }
+    // open()'a verilen yolun mutlak hali (hedef process imajı bununla açar)
+    const std::string& path() const { return m_path; }
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    struct Entry {
+        MemoryRegion region;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t checksum;
+        bool zeroFill;
+    };
+
+    int m_fd;
+    const uint8_t* m_base;
+    size_t m_size;
+    std::string m_path;
+    RealProcessCheckpoint m_metadata;
+    std::vector<Entry> m_entries;
+    std::vector<size_t> m_byAddress;    // startAddr'a göre sıralı index'ler
+    std::string m_lastError;
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "real_process/real_process_types.hpp"
+#include "core/checksum.hpp"
+#include "core/io_engine.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+#include <optional>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Checkpoint Sink - dump'ları okundukları sırada bir imaja yazan hedef
+// ============================================================================
+// RealProcessCheckpointer stream modunda bu arayüzü kullanır; v3 stream
+// (CheckpointStreamWriter) ve v7 indeksli imaj (CheckpointImageWriter)
+// aynı çağrı sırasını izler: writeHeader, 0..N writeDump, finish.
+class ICheckpointSink {
+public:
+    virtual ~ICheckpointSink() = default;
+
+    virtual bool writeHeader(const RealProcessCheckpoint& checkpoint) = 0;
+    virtual bool writeDump(const MemoryDump& dump) = 0;
+    virtual bool finish(const SignalInfo& signals) = 0;
+    virtual std::string getLastError() const = 0;
+};
+
+// ============================================================================
+// Checkpoint Stream Writer - RCHK imajını parça parça yazar
+// ============================================================================
+// serialize() tüm imajı tek bir vector'de topladığından checkpointer'ın
+// tepe RSS'i imaj boyutunun iki katını aşar. Writer header'ı, her dump'ı
+// ve trailer'ı okundukları sırada doğrudan fd'ye yazar; dump sayısı
+// önceden bilinmediği için v3 stream formatı (end kaydı) kullanılır.
+//
+//   writer.writeHeader(cp);          // magic .. memory map
+//   writer.writeDump(dump);          // 0..N kez
+//   writer.finish(cp.signals);       // end kaydı + signals
+class CheckpointStreamWriter : public ICheckpointSink {
+public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+    CheckpointStreamWriter();
+    // fd'nin sahipliği alınmaz (pipe/socket de olabilir)
+    explicit CheckpointStreamWriter(int fd, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    ~CheckpointStreamWriter() override;
+
+    CheckpointStreamWriter(const CheckpointStreamWriter&) = delete;
+    CheckpointStreamWriter& operator=(const CheckpointStreamWriter&) = delete;
+
+    // Dosyayı oluştur/kes ve sahiplen
+    bool open(const std::string& filepath);
+    // Yazmalar IoEngine üzerinden: birden fazla tampon uçuşta, dump okuma
+    // ile disk yazma örtüşür (io_uring yoksa blocking pwrite)
+    bool open(const std::string& filepath, const IoEngineOptions& io);
+    void close();
+    bool isOpen() const { return m_fd >= 0 || m_async != nullptr; }
+
+    // Header: metadata, register'lar, memory map (memoryDumps yok sayılır)
+    bool writeHeader(const RealProcessCheckpoint& checkpoint) override;
+
+    // Tek dump kaydı - büyük payload'lar tampona kopyalanmadan yazılır
+    bool writeDump(const MemoryDump& dump) override;
+
+    // End kaydı + signals, tamponu boşalt
+    bool finish(const SignalInfo& signals) override;
+
+    uint64_t bytesWritten() const { return m_bytesWritten; }
+    size_t dumpsWritten() const { return m_dumpsWritten; }
+    std::string getLastError() const override { return m_lastError; }
+
+    // fd'ye yazılan tüm byte'ların CRC32C'si (yazarken hesaplanır; dosyayı
+    // ikinci kez okumadan manifest/transfer doğrulaması için)
+    uint32_t checksum() const { return m_checksum.value(); }
+
+private:
+    int m_fd;
+    bool m_ownsFd;
+    bool m_headerWritten;
+    bool m_finished;
+    std::vector<uint8_t> m_buffer;
+    size_t m_bufferSize;
+    uint64_t m_bytesWritten;
+    size_t m_dumpsWritten;
+    Crc32c m_checksum;
+    std::unique_ptr<AsyncFileWriter> m_async;
+    std::string m_lastError;
+
+    bool append(const uint8_t* data, size_t size);
+    bool flushBuffer();
+    bool writeAll(const uint8_t* data, size_t size);
+};
+
+// ============================================================================
+// Checkpoint Stream Reader - RCHK imajını bölüm bölüm okur
+// ============================================================================
+// Tüm dosyayı belleğe almadan header'ı ve dump'ları sırayla okur. v1-v3
+// dosyalarını (serialize() ya da CheckpointStreamWriter çıktısı) okur.
+// v4/v7 indeksli imajlarda sadece readHeader() geçerlidir; dump'lar için
+// MappedCheckpointImage kullanılır.
+class CheckpointStreamReader {
+public:
+    CheckpointStreamReader();
+    explicit CheckpointStreamReader(int fd);  // fd'nin sahipliği alınmaz
+    ~CheckpointStreamReader();
+
+    CheckpointStreamReader(const CheckpointStreamReader&) = delete;
+    CheckpointStreamReader& operator=(const CheckpointStreamReader&) = delete;
+
+    bool open(const std::string& filepath);
+    // Büyük dump payload'ları IoEngine ile paralel parçalar halinde okunur
+    bool open(const std::string& filepath, const IoEngineOptions& io);
+    void close();
+
+    // Header'ı oku: memoryDumps boş, signals henüz okunmamış checkpoint
+    std::optional<RealProcessCheckpoint> readHeader();
+
+    // Sıradaki dump. Dump bölümü bittiğinde false döner (hata yoksa
+    // getLastError() boştur) ve trailer okunmuş olur.
+    // loadData = false ise payload atlanır (dump.data boş, dump.isValid false)
+    bool nextDump(MemoryDump& dump, bool loadData = true);
+
+    // nextDump false döndükten sonra geçerlidir
+    const SignalInfo& signals() const { return m_signals; }
+    bool finished() const { return m_finished; }
+
+    // Header + tüm dump'lar + trailer (tek kopya, ara vector yok)
+    std::optional<RealProcessCheckpoint> readAll();
+
+    uint32_t version() const { return m_version; }
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    int m_fd;
+    bool m_ownsFd;
+    uint32_t m_version;
+    uint32_t m_dumpCount;
+    uint32_t m_dumpsRead;
+    std::unique_ptr<IoEngine> m_io;
+    size_t m_ioChunkSize;
+    bool m_streamed;
+    bool m_finished;
+    SignalInfo m_signals;
+    std::vector<MemoryRegion> m_memoryMap;   // v1 dump flag'leri için
+    std::string m_lastError;
+
+    // Okuma tamponu
+    std::vector<uint8_t> m_buffer;
+    size_t m_bufferPos;
+    size_t m_bufferLen;
+
+    bool fillBuffer();
+    bool readExact(void* out, size_t size);
+    bool skipExact(uint64_t size);
+    bool readString(std::string& out);
+    bool readRegisters(LinuxRegisters& registers);     // Ham blok + FPU
+    bool readTrailer();
+
+    template<typename T>
+    bool readPod(T& value) { return readExact(&value, sizeof(T)); }
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "real_process/real_process_types.hpp"
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Dump Buffer Pool - MemoryDump tamponlarının yeniden kullanımı
+// ============================================================================
+// Her checkpoint'te bölge boyutunda yeni bir vector ayırmak, okumadan önce
+// tüm tamponu sıfırlatır ve her sayfası için page fault alır. Havuz bırakılan
+// tamponları kapasiteleriyle saklar ve aynı boyutta istekte olduğu gibi
+// geri verir: eski içerik üzerine yazılacağından ne sıfırlama ne de fault
+// olur (büyütülen kısım hariç). Aynı process'in periyodik checkpoint'leri
+// ilk turdan sonra hiç ayırma yapmaz.
+//
+// Boş listeler NUMA node'una göre tutulur: tampon onu bırakan thread'in
+// node'una girer, istekte önce o node'a bakılır (first-touch yerleşimde
+// sayfalar genelde oradadır). hugePages açıksa yeni ayrılan büyük tamponlar
+// MADV_HUGEPAGE ile işaretlenir. Thread-safe.
+class DumpBufferPool {
+public:
+    static constexpr uint64_t DEFAULT_MAX_RETAINED_BYTES = 1ull << 30;
+    static constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+    struct Stats {
+        uint64_t hits = 0;              // Havuzdan verilen
+        uint64_t misses = 0;            // Yeni ayrılan
+        uint64_t recycled = 0;          // Havuza geri dönen
+        uint64_t dropped = 0;           // Sınır aşıldığı için serbest bırakılan
+        uint64_t retainedBytes = 0;
+    };
+
+    explicit DumpBufferPool(uint64_t maxRetainedBytes = DEFAULT_MAX_RETAINED_BYTES);
+
+    DumpBufferPool(const DumpBufferPool&) = delete;
+    DumpBufferPool& operator=(const DumpBufferPool&) = delete;
+
+    void setMaxRetainedBytes(uint64_t bytes);
+    void setHugePages(bool enable);
+
+    // size byte'lık tampon. İçerik tanımsızdır (yeniden kullanılan tamponda
+    // önceki dump'ın verisi); çağıran tamamını yazmalıdır.
+    std::vector<uint8_t> acquire(size_t size);
+
+    void recycle(std::vector<uint8_t>&& buffer);
+    // Dump'ın data'sını havuza ver (dump boşalır)
+    void recycle(MemoryDump& dump);
+    // Checkpoint'in tüm dump tamponlarını havuza ver
+    void recycle(RealProcessCheckpoint& checkpoint);
+
+    // Saklanan tüm tamponları serbest bırak
+    void trim();
+
+    Stats getStats() const;
+
+private:
+    // node -> (kapasite -> tampon)
+    std::map<unsigned, std::multimap<size_t, std::vector<uint8_t>>> m_free;
+    uint64_t m_maxRetainedBytes;
+    bool m_hugePages = false;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+
+    bool takeFrom(std::multimap<size_t, std::vector<uint8_t>>& list, size_t size,
+                  std::vector<uint8_t>& out);
+};
+
+} // namespace real_process
+} // namespace checkpoint
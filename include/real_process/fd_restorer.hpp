@@ -6,10 +6,13 @@
 #include <string>
 #include <optional>
 #include <functional>
+#include <memory>
 
 namespace checkpoint {
 namespace real_process {
 
+class MemoryManager;
+
 // ============================================================================
 // File Descriptor Restoration Errors
 // ============================================================================
@@ -128,6 +131,8 @@ public:
     RestoreFDResult restoreFD(const ExtendedFDInfo& fdInfo);
     
     // Restore all restorable FDs
+    // Parasite kullanılabiliyorsa tüm open/dup2/lseek'ler tek batch'te
+    // (hedefte tek tur) çalışır; değilse restoreFD ile tek tek.
     struct BatchRestoreResult {
         int totalFDs;
         int restoredFDs;
@@ -141,6 +146,9 @@ public:
         bool stopOnError = false
     );
     
+    void setUseParasite(bool enable) { m_useParasite = enable; }
+    bool getUseParasite() const { return m_useParasite; }
+    
     // ========================================================================
     // Individual Operations (via syscall injection)
     // ========================================================================
@@ -188,9 +196,15 @@ private:
     pid_t m_pid;
     std::string m_lastError;
     ProgressCallback m_progressCallback;
+    bool m_useParasite;
+    std::unique_ptr<MemoryManager> m_syscalls;     // Batch yürütücü (parasite)
     
     void reportProgress(const std::string& stage, double progress);
     
+    // false: batch yolu kullanılamadı, hiçbir syscall çalışmadı
+    bool restoreAllFDsBatched(const std::vector<ExtendedFDInfo>& fdInfos,
+                              bool stopOnError, BatchRestoreResult& result);
+    
     // Syscall injection helper
     int64_t injectSyscall(
         uint64_t syscallNum,
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// File Backup Strategy - dosya içeriğini RAM'e almadan kopyalama
+// ============================================================================
+// Sırasıyla denenir:
+//   1. FICLONE: XFS/Btrfs gibi reflink destekleyen fs'lerde blok paylaşımı;
+//      boyuttan bağımsız, yeni veri bloğu ayırmaz (copy-on-write).
+//   2. copy_file_range: kernel içi kopya, user-space buffer yok (NFS/ext4'te
+//      sunucu tarafı ya da page cache üzerinden).
+//   3. Buffered: sabit boyutlu tek buffer ile pread/pwrite; dosyanın tamamı
+//      hiçbir zaman bellekte tutulmaz.
+// Hedef oluşturulur ya da içeriği tamamen değiştirilir (aynı inode).
+enum class BackupMethod {
+    None,               // Başarısız
+    Reflink,
+    CopyFileRange,
+    Buffered
+};
+
+std::string backupMethodToString(BackupMethod method);
+
+struct FileBackupOptions {
+    bool allowReflink;
+    bool allowCopyFileRange;
+    size_t bufferSize;              // Buffered yöntemin buffer boyutu
+
+    FileBackupOptions()
+        : allowReflink(true),
+          allowCopyFileRange(true),
+          bufferSize(64 * 1024) {}
+};
+
+class FileBackupStrategy {
+public:
+    FileBackupStrategy();
+    explicit FileBackupStrategy(const FileBackupOptions& options);
+
+    // src'yi dst'ye kopyala; dst yoksa src'nin izinleriyle oluşturulur.
+    // Dönüş: kullanılan yöntem, hata durumunda None (error doldurulur).
+    BackupMethod copyFile(const std::string& src, const std::string& dst,
+                          std::string* error = nullptr) const;
+
+    // Açık fd'ler arasında [0, size) kopyası; dstFd'nin içeriği size'a kesilir
+    BackupMethod copyFd(int srcFd, int dstFd, uint64_t size,
+                        std::string* error = nullptr) const;
+
+    const FileBackupOptions& getOptions() const { return m_options; }
+
+    // İstatistik: yöntem başına başarılı kopya sayısı
+    struct Stats {
+        uint64_t reflinks = 0;
+        uint64_t copyFileRanges = 0;
+        uint64_t buffered = 0;
+        uint64_t failures = 0;
+        uint64_t bytesCopied = 0;       // Reflink dahil mantıksal boyut
+    };
+    Stats getStats() const;
+
+private:
+    FileBackupOptions m_options;
+
+    mutable std::atomic<uint64_t> m_reflinks{0};
+    mutable std::atomic<uint64_t> m_copyFileRanges{0};
+    mutable std::atomic<uint64_t> m_buffered{0};
+    mutable std::atomic<uint64_t> m_failures{0};
+    mutable std::atomic<uint64_t> m_bytesCopied{0};
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -5,8 +5,12 @@
 #include <vector>
 #include <chrono>
 #include <optional>
+#include <span>
 #include <functional>
 #include <filesystem>
+#include <map>
+#include <utility>
+#include <sys/types.h>
 
 namespace checkpoint {
 namespace real_process {
@@ -67,6 +71,9 @@ struct FileOperation {
     
     // Full content backup (küçük dosyalar için)
     std::optional<std::vector<uint8_t>> originalContent;
+    // Diskteki tam yedek (FileTrackingOptions::backupDir); varsa
+    // originalContent yerine kullanılır, bellekte yer tutmaz
+    std::string backupPath;
     
     // Delta encoding (büyük dosyalar için)
     std::vector<FileContentDiff> diffs;
@@ -98,17 +105,54 @@ struct FileOperation {
     
     // Serialization
     std::vector<uint8_t> serialize() const;
-    static FileOperation deserialize(const std::vector<uint8_t>& data);
+    static FileOperation deserialize(std::span<const uint8_t> data);
     
     // Utility
-    bool hasFullBackup() const { return originalContent.has_value(); }
+    bool hasFullBackup() const { return originalContent.has_value() || !backupPath.empty(); }
     bool hasDiffs() const { return !diffs.empty(); }
     size_t estimatedMemoryUsage() const;
 };
 
+// ============================================================================
+// Byte Range Set - ayrık [begin, end) aralıkları kümesi
+// ============================================================================
+// Aralıklar başlangıca göre sıralı bir ağaçta (std::map) birleştirilmiş
+// tutulur; sorgu ve ekleme O(log n + kesişen aralık sayısı).
+class ByteRangeSet {
+public:
+    // [begin, end) içinde kümede olmayan parçalar, sıralı
+    std::vector<std::pair<off_t, off_t>> subtract(off_t begin, off_t end) const;
+    void add(off_t begin, off_t end);
+    bool covers(off_t begin, off_t end) const;
+    
+    size_t intervalCount() const { return m_ranges.size(); }
+    uint64_t coveredBytes() const;
+    bool empty() const { return m_ranges.empty(); }
+    void clear() { m_ranges.clear(); }
+
+private:
+    std::map<off_t, off_t> m_ranges;    // begin -> end
+};
+
 // ============================================================================
 // File Operation Log - Dosya işlemleri günlüğü
 // ============================================================================
+// Write coalescing açıksa bir checkpoint epoch'u (son markCheckpoint'ten
+// beri) içinde her dosya için hangi byte'ların ön görüntüsünün zaten
+// kayıtlı olduğu tutulur. Yeni WRITE'ın diff'lerinden sadece daha önce
+// dokunulmamış aralıklar saklanır: epoch'a geri dönmek için her byte'ın en
+// eski ön görüntüsü yeterlidir (ters sırada önce yeniler, sonra eskiler
+// yazılır). Epoch'taki ilk yazmadan önceki dosya boyutunun ötesi zaten
+// kesilerek geri alındığından örtülü sayılır. Tamamen örtülü ve boyutu
+// değiştirmeyen yazma hiç kaydedilmez. WRITE dışı bir işlem (truncate,
+// rename, ...) o dosyanın epoch durumunu sıfırlar.
+//
+// Journal açıksa her kayıt oluştuğu anda aktif segment dosyasına eklenir ve
+// bellekte sadece içeriksiz başlığı (yol, tip, id) ile segment/offset
+// referansı kalır; sorgular tam kaydı pread ile okur. markCheckpoint yeni
+// segmente geçer, böylece clearOperationsBeforeCheckpoint eski epoch'ları
+// dosya silerek atar. Açılışta segmentler sırayla okunur, CRC'si tutmayan
+// kuyruk kesilir.
 class FileOperationLog {
 public:
     FileOperationLog();
@@ -141,17 +185,34 @@ public:
     void markCheckpoint(uint64_t checkpointId);
     void clearOperationsBeforeCheckpoint(uint64_t checkpointId);
     
+    // Write diff coalescing (varsayılan kapalı; tracker açar)
+    void setCoalesceWrites(bool enable);
+    bool getCoalesceWrites() const;
+    size_t getCoalescedOperationCount() const;  // Hiç kaydedilmeyen yazmalar
+    uint64_t getCoalescedBytes() const;         // Atılan ön görüntü byte'ları
+    
     // State management
     size_t getOperationCount() const;
     void clear();
     
     // Serialization
     std::vector<uint8_t> serialize() const;
-    static FileOperationLog deserialize(const std::vector<uint8_t>& data);
+    static FileOperationLog deserialize(std::span<const uint8_t> data);
     
     // Persistence
     bool saveToFile(const std::filesystem::path& path) const;
     bool loadFromFile(const std::filesystem::path& path);
+    
+    // On-disk journal (segment dosyaları, <dir>/NNNNNNNN.fol)
+    // Mevcut segmentler okunur (yarım kalan son kayıt kesilir), bellekteki
+    // kayıtlar journal'a aktarılır. Sonrasında içerik sadece diskte durur.
+    bool openJournal(const std::filesystem::path& dir, std::string* error = nullptr);
+    void closeJournal();                        // Kayıtları belleğe geri yükler
+    bool isJournaled() const;
+    void setJournalSyncEachRecord(bool enable); // Her kayıttan sonra fdatasync
+    bool syncJournal();
+    size_t getSegmentCount() const;
+    uint64_t getJournalSize() const;            // Geçerli kayıt byte'ları
 
 private:
     struct Impl;
@@ -171,10 +232,21 @@ struct FileTrackingOptions {
     bool useDeltas;                             // Delta encoding kullan
     bool trackMetadata;                         // İzin/sahiplik değişikliklerini izle
     
+    // Boş değilse truncate/unlink/rename ön görüntüleri bu dizine
+    // reflink/copy_file_range ile kopyalanır (maxFileSize uygulanmaz);
+    // bellek sadece kopya başarısız olursa kullanılır
+    std::string backupDir;
+    
+    bool coalesceWrites;                        // Log'da epoch başına byte başına tek ön görüntü
+    
+    // Boş değilse log bu dizinde append-only journal olarak tutulur
+    std::string journalDir;
+    
     FileTrackingOptions()
         : maxFileSize(10 * 1024 * 1024),  // 10 MB default
           useDeltas(true),
-          trackMetadata(true) {}
+          trackMetadata(true),
+          coalesceWrites(true) {}
 };
 
 class FileOperationTracker {
@@ -189,6 +261,10 @@ public:
     bool isTracking() const;
     
     // Manual operation recording (interceptor'dan çağrılır)
+    // offset < 0: O_APPEND yazması, dosya sonundan itibaren. Ön görüntü tek
+    // pread ile okunur; afterWrite'taki size gerçekte yazılan byte sayısıdır.
+    // afterWrite'ın fd/offset'i beforeWrite'takiyle aynı olmalı, değilse
+    // kayıt geri alınamaz olarak işaretlenir.
     void beforeWrite(int fd, const std::string& path, off_t offset, size_t size);
     void afterWrite(int fd, const std::string& path, off_t offset, size_t size, bool success);
     
@@ -204,10 +280,22 @@ public:
     void beforeCreate(const std::string& path, mode_t mode);
     void afterCreate(const std::string& path, int fd, bool success);
     
-    // File content capture
+    // File content capture (dosya sonunda kısa okuma, kısa vektör döner)
     std::vector<uint8_t> captureFileContent(const std::string& path);
     std::vector<uint8_t> captureFileContent(const std::string& path, off_t offset, size_t size);
     
+    // Okuma için açık tutulan fd'ler path başına önbelleklenir. Path başka
+    // bir inode'a bağlandıysa (rename/unlink/yeniden create) bu çağrılmalı;
+    // tracker'ın kendi unlink/rename/create kayıtları bunu kendisi yapar.
+    void invalidateFile(const std::string& path);
+    size_t getCachedFileCount() const;
+    
+    // backupDir'e bu tracker'ın yazdığı yedekler. Log diske kaydedilip
+    // sonra geri alınacaksa silinmemeli; bu yüzden destructor silmez.
+    size_t getBackupFileCount() const;
+    void removeBackupFiles();
+    static constexpr size_t MAX_CACHED_FILES = 64;
+    
     // Get recorded operations
     FileOperationLog& getLog();
     const FileOperationLog& getLog() const;
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "real_process/ptrace_controller.hpp"
+#include "real_process/page_store.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Group Checkpoint - process ağacının tutarlı, paralel checkpoint'i
+// ============================================================================
+// Kök pid ve tüm torunları (buildProcessTree) aynı anda durdurulur, her üye
+// ayrı bir worker'da dump edilir ve sayfalar tek bir PageStore'da
+// birleştirilir. Sonuç, üye index'i olan tek bir grup imajıdır.
+//
+// Dondurma:
+//   Cgroup  Ağaç kendine ait bir cgroup'taysa (v2 cgroup.freeze ya da v1
+//           freezer.state) cgroup dondurulur, üyelere SIGSTOP gönderilir ve
+//           cgroup çözülür. Üyeler dondurucudan çıkarken bekleyen SIGSTOP'u
+//           user space'e dönmeden işler: hiçbir üye diğerleri dururken
+//           çalışmaz, arada fork edilen çocuk da kaçmaz.
+//   Signal  Üyelere kökten yapraklara SIGSTOP; ağaç yeniden taranır ve yeni
+//           üye kalmayana kadar (maxStopPasses) tekrarlanır.
+// Zaten durmuş olan üyeler sonda devam ettirilmez.
+//
+// Dedupe: fork edilmiş üyeler COW sayfalarını paylaşır. Her dump sayfasının
+// fiziksel frame'i pagemap'ten okunur; daha önce görülen frame hash'lenmeden
+// aynı id'ye bağlanır. PFN görünmüyorsa (CAP_SYS_ADMIN yok) sayfalar içerik
+// hash'iyle (PageStore::intern) birleştirilir.
+//
+//   ProcessGroupCheckpointer group;
+//   auto image = group.checkpointTree(supervisorPid);
+//   image->save("service.rgrp");
+//   auto worker = GroupCheckpoint::loadMember("service.rgrp", workerPid);
+enum class GroupFreezeMode {
+    Auto,       // Uygunsa Cgroup, değilse Signal
+    Cgroup,
+    Signal
+};
+
+struct GroupCheckpointOptions {
+    // Üye başına checkpoint ayarları (forkSnapshot kullanılmaz: üyeler
+    // zaten durmuş bekler)
+    CheckpointOptions checkpoint;
+
+    unsigned workers = 0;                   // 0 = donanım thread sayısı
+    GroupFreezeMode freeze = GroupFreezeMode::Auto;
+    bool dedupePages = true;                // Kapalıysa dump'lar düz veri kalır
+    bool resume = true;                     // Bitince SIGCONT (hatada her zaman)
+
+    int stopTimeoutMs = 2000;               // Üye başına durma beklemesi
+    unsigned maxStopPasses = 8;             // Signal modunda tarama turu
+};
+
+struct GroupMember {
+    pid_t pid = 0;
+    pid_t ppid = 0;
+    std::string name;
+    RealProcessCheckpoint checkpoint;       // Dump'lar pageRefs (dedupe açıksa)
+};
+
+struct GroupCheckpoint {
+    pid_t rootPid = 0;
+    std::vector<GroupMember> members;       // Kök önce, ebeveyn çocuktan önce
+    std::unique_ptr<PageStore> pages = std::make_unique<PageStore>();
+
+    GroupFreezeMode freezeMode = GroupFreezeMode::Signal;   // Kullanılan (Auto değil)
+    uint64_t freezeNanos = 0;               // İlk durdurma -> tüm ağaç durdu
+    uint64_t totalNanos = 0;
+    uint64_t dumpedBytes = 0;
+    uint64_t frameHits = 0;                 // Paylaşılan fiziksel frame (hash'siz)
+    uint64_t contentHits = 0;               // İçerik hash'iyle eşleşen sayfa
+
+    const GroupMember* member(pid_t pid) const;
+
+    // Üyenin pageRefs'i açılmış kopyası (restore / v4 imaj için)
+    std::optional<RealProcessCheckpoint> materialize(pid_t pid) const;
+
+    // "RGRP" | version u32 | rootPid i32 | memberCount u32 | pageCount u32 |
+    //   indexSize u32 | pageOffset u64
+    // index:  (memberCount kez) pid i32 | ppid i32 | offset u64 | size u64 |
+    //         nameLen u32 | name
+    // üyeler: RealProcessCheckpoint::serialize (dump'lar pageRefs)
+    // sayfalar: pageOffset'ten (PAGE_BYTES hizalı) pageCount * PAGE_BYTES
+    bool save(const std::string& filepath, std::string* error = nullptr) const;
+    static std::optional<GroupCheckpoint> load(const std::string& filepath,
+                                               std::string* error = nullptr);
+
+    // Index'ten tek üyeyi okur; sadece onun başvurduğu sayfalar okunur.
+    // Dönen checkpoint'in dump'ları düz veridir.
+    static std::optional<RealProcessCheckpoint> loadMember(const std::string& filepath, pid_t pid,
+                                                           std::string* error = nullptr);
+};
+
+// ============================================================================
+// Process Group Checkpointer
+// ============================================================================
+class ProcessGroupCheckpointer {
+public:
+    explicit ProcessGroupCheckpointer(GroupCheckpointOptions options = GroupCheckpointOptions());
+
+    ProcessGroupCheckpointer(const ProcessGroupCheckpointer&) = delete;
+    ProcessGroupCheckpointer& operator=(const ProcessGroupCheckpointer&) = delete;
+
+    // Ağacın tamamı ya da hiçbiri: bir üye alınamazsa std::nullopt
+    std::optional<GroupCheckpoint> checkpointTree(pid_t rootPid);
+
+    const GroupCheckpointOptions& options() const { return m_options; }
+    std::string getLastError() const { return m_lastError; }
+
+    // Worker checkpointer'ları aynı tampon havuzunu ve registry'yi kullanır
+    // ("group.checkpoint" ve üye başına "checkpoint.create")
+    void setBufferPool(std::shared_ptr<DumpBufferPool> pool) { m_bufferPool = std::move(pool); }
+    void setMetricsRegistry(MetricsRegistry& registry) { m_metrics = &registry; }
+
+private:
+    GroupCheckpointOptions m_options;
+    std::shared_ptr<DumpBufferPool> m_bufferPool;
+    MetricsRegistry* m_metrics = &MetricsRegistry::global();
+    std::string m_lastError;
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <sys/types.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Lazy Restore Session - userfaultfd ile sayfaları talep üzerine yükleme
+// ============================================================================
+// Post-copy restore: büyük private anonim bölgeler target'a yazılmaz;
+// target'ta userfaultfd açılır (syscall enjeksiyonu), bölgeler
+// MADV_DONTNEED ile boşaltılıp kaydedilir ve fd pidfd_getfd ile tracer'a
+// alınır. Target serbest bırakıldıktan sonra dokunduğu her eksik sayfa
+// bu oturumun thread'i tarafından UFFDIO_COPY ile checkpoint verisinden
+// doldurulur; arada kalan sayfalar arka planda önceden yüklenir.
+//
+// Range::data checkpoint'in dump tamponuna ya da mmap edilmiş imaja bakar
+// ve oturum bitene kadar (isComplete / finish / yıkıcı) geçerli kalmalıdır.
+// Target'ın munmap / mremap / MADV_DONTNEED'i izlenir; lazy aşamada fork
+// edilen child'ın henüz yüklenmemiş sayfaları sıfır okunur (fork'tan önce
+// wait() çağrılmalı). Sadece x86_64.
+class LazyRestoreSession {
+public:
+    // data == nullptr: aralık sıfır sayfalarla doldurulur
+    struct Range {
+        uint64_t addr;
+        const uint8_t* data;
+        uint64_t length;
+    };
+
+    struct Stats {
+        uint64_t pagesTotal = 0;
+        uint64_t faultsServed = 0;      // Okunan page fault mesajı
+        uint64_t pagesFaulted = 0;      // Fault yüzünden kopyalanan sayfa
+        uint64_t pagesPrefetched = 0;   // Arka planda kopyalanan sayfa
+        uint64_t pagesDiscarded = 0;    // Target'ın kendisi unmap/boşalttı
+    };
+
+    static constexpr uint64_t PAGE_BYTES = 4096;
+    static constexpr uint64_t FAULT_AROUND_PAGES = 16;      // Fault başına en fazla
+    static constexpr uint64_t PREFETCH_CHUNK_BYTES = 256 * 1024;
+
+    ~LazyRestoreSession();
+
+    LazyRestoreSession(const LazyRestoreSession&) = delete;
+    LazyRestoreSession& operator=(const LazyRestoreSession&) = delete;
+
+    static bool isSupported();
+
+    // Target ptrace ile durdurulmuş olmalı (enjeksiyon yapılır). Servis
+    // thread'i burada başlar. Kaydı ya da boşaltması başarısız olan
+    // aralıklar failed'a eklenir - çağıran bunları hemen yazmalıdır.
+    // Hiçbir aralık kaydedilemezse nullptr (error set).
+    static std::unique_ptr<LazyRestoreSession> setup(pid_t pid,
+                                                     std::vector<Range> ranges,
+                                                     bool prefetch,
+                                                     std::vector<Range>& failed,
+                                                     std::string& error);
+
+    // Tüm sayfalar yüklenene kadar bekle (timeoutMs < 0: süresiz).
+    // prefetch kapalıysa sadece fault'lar ilerletir.
+    bool wait(int timeoutMs = -1);
+
+    // Kalan sayfaları hemen kopyala ve thread'i durdur. Bundan sonra
+    // Range::data'ya erişilmez.
+    void finish();
+
+    bool isComplete() const { return m_complete.load(); }
+    pid_t getPid() const { return m_pid; }
+    uint64_t getLazyBytes() const { return m_totalPages * PAGE_BYTES; }
+    Stats getStats() const;
+    std::string getLastError() const;
+
+private:
+    // Aralık başına sayfa durumu: 1 = artık fault beklenmez
+    struct Area {
+        uint64_t addr;
+        const uint8_t* data;
+        uint64_t pages;
+        std::vector<uint8_t> done;
+        uint64_t remaining;
+    };
+
+    LazyRestoreSession(pid_t pid, int uffd, std::vector<Area> areas, bool prefetch);
+
+    pid_t m_pid;
+    int m_uffd;
+    int m_wakeFd;                   // eventfd - finish() thread'i uyandırır
+    bool m_prefetch;
+    std::vector<Area> m_areas;      // addr'a göre sıralı, çakışmasız
+    uint64_t m_totalPages = 0;
+    uint64_t m_remainingPages = 0;
+    size_t m_prefetchArea = 0;      // Prefetch imleci
+    uint64_t m_prefetchPage = 0;
+    std::vector<uint64_t> m_retryFaults;    // EAGAIN: event okunduktan sonra
+
+    std::thread m_thread;
+    // setup'ın boşaltması bitti. madvise event okunur okunmaz döner; o
+    // event'ler işlenmeden arming bitmiş sayılmasın diye m_armed'ı sadece
+    // servis döngüsü (istek geldikten sonra, iki okuma arasında) kurar.
+    std::atomic<bool> m_armRequested{false};
+    bool m_armed = false;
+    std::atomic<bool> m_drain{false};
+    std::atomic<bool> m_complete{false};
+    std::atomic<uint64_t> m_faultsServed{0};
+    std::atomic<uint64_t> m_pagesFaulted{0};
+    std::atomic<uint64_t> m_pagesPrefetched{0};
+    std::atomic<uint64_t> m_pagesDiscarded{0};
+
+    mutable std::mutex m_mutex;     // m_lastError ve wait()
+    std::condition_variable m_completeCv;
+    std::string m_lastError;
+
+    void start();
+    void wake();
+    void run();
+    bool handleEvents();            // false: uffd kapandı / target gitti
+    bool prefetchNext();
+    // false: mm değişiyordu (EAGAIN), fault tekrar denenmeli
+    bool serveFault(uint64_t addr);
+    // [page, page+count) aralığını kopyala; bitmiş sayfaları atlar.
+    // false: target gitti. again: EAGAIN ile yarıda kaldı.
+    bool populate(size_t area, uint64_t page, uint64_t count, bool prefetch,
+                  bool* again = nullptr);
+    void markDone(size_t area, uint64_t page, uint64_t count, bool discarded);
+    void markRangeDone(uint64_t addr, uint64_t length);
+    void unmarkRange(uint64_t addr, uint64_t length);
+    void remap(uint64_t from, uint64_t to, uint64_t length);
+    Area* findArea(uint64_t addr, size_t* index = nullptr);
+    void complete();
+    void setError(const std::string& error);
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "real_process/ptrace_controller.hpp"
+#include "core/codec.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Live Migration - iteratif pre-copy ile process'i başka host'a taşıma
+// ============================================================================
+// Kaynak çalışmaya devam ederken bellek turlar halinde TCP üzerinden akar:
+//
+//   tur 0      tam checkpoint (fork snapshot; kaynak sadece fork kadar durur)
+//   tur 1..N   soft-dirty ile son turdan beri kirlenen sayfalar
+//   son tur    kaynak SIGSTOP ile durdurulur; register'lar, fd'ler, sinyaller
+//              ve kalan kirli sayfalar (stop-and-copy)
+//
+// Kirli küme stopCopyBytes'ın altına inince, maxRounds'a ulaşınca ya da
+// turlar arası küçülme minShrinkRatio'dan azsa (yazma hızı aktarım hızına
+// yetişiyor) son tura geçilir. Duraklama son turun boyutuyla sınırlıdır.
+//
+// Her tur bir v3 checkpoint stream'idir (CheckpointStreamWriter ile aynı
+// byte'lar). Stream chunkSize'lık parçalara bölünür; parçalar
+// compressThreads worker'da sıkıştırılırken ayrı bir thread önceki
+// parçaları sırayla socket'e yazar - dump okuma, sıkıştırma ve gönderme
+// örtüşür. Receiver turları birleştirir (mergeCheckpointChain) ve son
+// turdan sonra hazırlanmış target process'e restore eder.
+//
+// Tel formatı (host byte sırası; iki uç aynı mimaridir):
+//   frame:      type u8 | round u32 | size u32 | payload[size]
+//   HELLO       version u32 | pid i32 | name | chunkSize u32
+//   DATA        codec u8 | rawSize u32 | sıkıştırılmış (ya da ham) parça
+//               (0 < rawSize <= HELLO'daki chunkSize)
+//   ROUND_END   final u8 | rawBytes u64 | crc32c u32
+//   ABORT       mesaj
+//   ACK (receiver -> sender, her ROUND_END'e)  ok u8 | mesaj
+//
+// Protokolde kimlik doğrulama yoktur: receiver varsayılan olarak loopback'e
+// bağlanır, dış arayüz açıkça verilmelidir (tünel / güvenilir ağ).
+class LiveMigrationProtocol {
+public:
+    static constexpr uint32_t VERSION = 2;
+    static constexpr size_t FRAME_HEADER_SIZE = 9;
+    static constexpr uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+    static constexpr uint32_t DATA_HEADER_SIZE = 5;
+    static constexpr uint32_t MIN_CHUNK_SIZE = 4096;
+    static constexpr uint32_t MAX_CHUNK_SIZE = MAX_FRAME_SIZE - DATA_HEADER_SIZE;
+
+    enum class FrameType : uint8_t {
+        Hello = 1,
+        Data = 2,
+        RoundEnd = 3,
+        Abort = 4,
+        Ack = 5
+    };
+};
+
+struct MigrationOptions {
+    // Pre-copy turları bu ayarlarla alınır; fork snapshot ve soft-dirty
+    // takibi her zaman açılır, fd / environment son tura bırakılır
+    CheckpointOptions checkpoint;
+    RestoreOptions restore;
+
+    uint32_t maxRounds = 8;                         // Pre-copy turu (tur 0 dahil)
+    uint64_t stopCopyBytes = 4 * 1024 * 1024;       // Bu kadar kirli kalınca dur
+    double minShrinkRatio = 0.8;                    // Tur / önceki tur bundan büyükse yakınsamıyor
+
+    CodecType codec = CodecType::Lz4;
+    size_t chunkSize = 1024 * 1024;                 // [MIN_CHUNK_SIZE, MAX_CHUNK_SIZE]'e kırpılır
+    unsigned compressThreads = 2;                   // 0 = donanım thread sayısı
+
+    int stopTimeoutMs = 2000;                       // SIGSTOP sonrası durma beklemesi
+    int ackTimeoutMs = 30000;                       // Son turun (restore dahil) onayı
+
+    // Başarılı migration sonrası kaynak öldürülür; kapalıysa durmuş kalır.
+    // Başarısızlıkta kaynak her zaman SIGCONT ile devam ettirilir.
+    bool killSourceOnSuccess = false;
+};
+
+struct MigrationRound {
+    uint32_t round = 0;
+    bool final = false;
+    uint64_t dirtyBytes = 0;        // Okunan bölge byte'ları (zeroFill hariç: telde yer tutmaz)
+    uint64_t rawBytes = 0;          // Stream byte'ları
+    uint64_t wireBytes = 0;         // Sıkıştırma + frame sonrası
+    uint64_t nanos = 0;
+};
+
+struct MigrationResult {
+    bool success = false;
+    std::string errorMessage;
+    std::vector<MigrationRound> rounds;
+    bool converged = false;         // stopCopyBytes'a inildi (maxRounds / küçülme değil)
+    uint64_t downtimeNanos = 0;     // SIGSTOP -> receiver onayı
+    uint64_t totalNanos = 0;
+
+    uint64_t totalWireBytes() const;
+};
+
+// ============================================================================
+// Migration Sender - kaynak tarafı
+// ============================================================================
+class MigrationSender {
+public:
+    explicit MigrationSender(MigrationOptions options = MigrationOptions());
+    ~MigrationSender();
+
+    MigrationSender(const MigrationSender&) = delete;
+    MigrationSender& operator=(const MigrationSender&) = delete;
+
+    // host:port'a bağlanıp migrate et
+    MigrationResult migrate(pid_t pid, const std::string& host, uint16_t port);
+
+    // Bağlı socket üzerinden (sahipliği alınmaz)
+    MigrationResult migrate(pid_t pid, int fd);
+
+    RealProcessCheckpointer& checkpointer() { return m_checkpointer; }
+    const MigrationOptions& options() const { return m_options; }
+
+private:
+    MigrationOptions m_options;
+    RealProcessCheckpointer m_checkpointer;
+};
+
+// ============================================================================
+// Migration Receiver - hedef tarafı
+// ============================================================================
+class MigrationReceiver {
+public:
+    MigrationReceiver();
+    ~MigrationReceiver();
+
+    MigrationReceiver(const MigrationReceiver&) = delete;
+    MigrationReceiver& operator=(const MigrationReceiver&) = delete;
+
+    // port 0 = çekirdek seçer (boundPort ile öğrenilir). Başka host'tan
+    // bağlantı için bindAddress açıkça verilmelidir ("0.0.0.0" dahil).
+    bool listen(uint16_t port, const std::string& bindAddress = "127.0.0.1");
+    uint16_t boundPort() const { return m_port; }
+
+    // Sender'dan gelen her frame için bekleme sınırı; süre dolarsa receive
+    // başarısız olur (durmuş bir peer receiver'ı sonsuza kadar tutmaz)
+    void setReadTimeout(int timeoutMs) { m_readTimeoutMs = timeoutMs; }
+    // Tek turun stream'i için üst sınır (açılmış byte'lar); aşılırsa tur reddedilir
+    void setMaxRoundBytes(uint64_t bytes) { m_maxRoundBytes = bytes; }
+
+    // İlk bağlantıyı kabul edip receive(fd, ...) çalıştır
+    bool accept(pid_t targetPid, const RestoreOptions& options = RestoreOptions());
+
+    // Turları oku ve birleştir. targetPid > 0 ise son turdan sonra restore
+    // edilir ve sonuç sender'a onay olarak gider; 0 ise sadece checkpoint
+    // toplanır (onay birleştirme sonucudur). fd'nin sahipliği alınmaz.
+    bool receive(int fd, pid_t targetPid = 0, const RestoreOptions& options = RestoreOptions());
+
+    // Birleştirilmiş son durum (receive başarılıysa)
+    const RealProcessCheckpoint& checkpoint() const { return m_merged; }
+    const RestoreResult& restoreResult() const { return m_restoreResult; }
+    uint32_t roundsReceived() const { return m_rounds; }
+
+    RealProcessCheckpointer& checkpointer() { return m_checkpointer; }
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    RealProcessCheckpointer m_checkpointer;
+    RealProcessCheckpoint m_merged;
+    RestoreResult m_restoreResult;
+    uint32_t m_rounds = 0;
+    int m_listenFd = -1;
+    uint16_t m_port = 0;
+    int m_readTimeoutMs = 30000;
+    uint64_t m_maxRoundBytes = 16ull * 1024 * 1024 * 1024;
+    std::string m_lastError;
+
+    bool applyRound(std::vector<uint8_t>& stream);
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "real_process/real_process_types.hpp"
+#include "real_process/parasite.hpp"
+#include "real_process/proc_reader.hpp"
 #include <sys/types.h>
 #include <vector>
 #include <optional>
 #include <functional>
+#include <memory>
 
 namespace checkpoint {
 namespace real_process {
@@ -91,7 +94,10 @@ public:
     );
     
     // Get current memory map from /proc/<pid>/maps
+    // Kısa süreli cache'lenir; injectSyscall/executeBatch cache'i düşürür.
+    // Hedef başka yoldan değiştiyse invalidateMemoryMap çağrılmalı.
     std::vector<MemoryRegion> getCurrentMemoryMap();
+    void invalidateMemoryMap() { m_procReader.invalidateMemoryMaps(); }
     
     // Check if a region exists at the given address
     bool regionExists(uint64_t addr, size_t size);
@@ -141,6 +147,7 @@ public:
         std::vector<MemoryRegion> failedRegions;
         bool needsRelocation;
         int64_t relocationOffset;
+        uint64_t bytesPrefaulted = 0;   // hugePages bölgelerinde (prepareHugePages)
     };
     
     PrepareResult prepareForRestore(
@@ -149,6 +156,13 @@ public:
         bool removeExtra = false
     );
     
+    // Aralıkları MADV_HUGEPAGE ile işaretleyip MADV_POPULATE_WRITE ile
+    // önceden fault eder (tek batch). Böylece ardından gelen toplu yazma
+    // sayfa sayfa fault almadan hazır huge page'lere gider. Çekirdek
+    // POPULATE_WRITE'ı desteklemiyorsa (< 5.14) sadece işaretlenir.
+    // Döner: önceden fault edilen byte'lar
+    uint64_t prepareHugePages(const std::vector<std::pair<uint64_t, uint64_t>>& ranges);
+    
     // ========================================================================
     // ASLR Handling
     // ========================================================================
@@ -181,6 +195,21 @@ public:
         uint64_t arg6 = 0
     );
     
+    // ========================================================================
+    // Batched Syscalls
+    // ========================================================================
+    
+    // Batch'i hedefteki kalıcı parasite sayfasıyla tek turda çalıştırır
+    // (ilk çağrıda kurulur, unbind'de kaldırılır). Parasite kurulamazsa ya
+    // da batch parasite alanına dokunuyorsa komutlar tek tek injectSyscall
+    // ile çalışır; veri argümanı olan batch'ler bu durumda false döner.
+    bool executeBatch(const SyscallBatch& batch, SyscallBatchResult& result);
+    
+    void setUseParasite(bool enable) { m_useParasite = enable; }
+    bool getUseParasite() const { return m_useParasite; }
+    void releaseParasite();
+    const ParasiteStub* getParasite() const { return m_parasite.get(); }
+    
     // ========================================================================
     // Utilities
     // ========================================================================
@@ -195,6 +224,9 @@ private:
     pid_t m_pid;
     std::string m_lastError;
     ProgressCallback m_progressCallback;
+    std::unique_ptr<ParasiteStub> m_parasite;
+    bool m_useParasite;
+    ProcFSReader m_procReader;
     
     // Ptrace helpers
     bool saveRegisters(LinuxRegisters& saved);
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "real_process/real_process_types.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Zero Page Elimination
+// ============================================================================
+
+// size byte'ın tamamı sıfır mı (SSE2/NEON ile 64 byte'lık adımlar)
+bool isZeroPage(const uint8_t* data, size_t size);
+
+// Dump'lardaki sıfır sayfa dizilerini zeroFill dump'larına ayır. Sıfır
+// sayfası olmayan dump'lar kopyalanmadan taşınır. Dönüş: elenen byte sayısı.
+uint64_t eliminateZeroPages(std::vector<MemoryDump>& dumps, size_t pageSize = 4096);
+
+// ============================================================================
+// Page Store - içerik adresli, paylaşılan sayfa deposu
+// ============================================================================
+// Aynı içerikli sayfalar (bir checkpoint içinde ya da aynı process'in
+// checkpoint'leri arasında) bir kez saklanır; MemoryDump::pageRefs bu
+// depodaki id'lere bakar. Anahtar 64-bit içerik hash'idir, eşleşmeler
+// memcmp ile doğrulanır. Id'ler kalıcıdır (depo sadece büyür).
+// Thread-safe değildir.
+//
+//   PageStore store;
+//   deduplicatePages(cp, store);                       // dump'lar -> pageRefs
+//   store.save("pages.rpgs");
+//   checkpointer.restoreCheckpointEx(pid, cp, store);  // sayfalar depodan
+class PageStore {
+public:
+    static constexpr size_t PAGE_BYTES = 4096;
+
+    PageStore();
+
+    PageStore(const PageStore&) = delete;
+    PageStore& operator=(const PageStore&) = delete;
+
+    // Sayfanın id'si; içerik depoda yoksa eklenir
+    uint32_t intern(const uint8_t* page);
+
+    // id geçersizse nullptr. Dönen pointer depo yaşadığı sürece geçerlidir.
+    const uint8_t* page(uint32_t id) const;
+
+    size_t pageCount() const { return m_count; }
+    uint64_t storedBytes() const { return static_cast<uint64_t>(m_count) * PAGE_BYTES; }
+
+    // intern çağrılarından kaçı mevcut bir sayfaya denk geldi
+    uint64_t dedupHits() const { return m_hits; }
+
+    // "RPGS" | version u32 | pageCount u32 | sayfalar
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath);
+
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    static constexpr size_t PAGES_PER_BLOCK = 256;     // 1MB blok
+
+    std::vector<std::unique_ptr<uint8_t[]>> m_blocks;
+    size_t m_count;
+    uint64_t m_hits;
+    std::unordered_multimap<uint64_t, uint32_t> m_index;
+    mutable std::string m_lastError;
+
+    uint8_t* slot(uint32_t id) const;
+    uint32_t append(const uint8_t* page, uint64_t hash);
+    static uint64_t hashPage(const uint8_t* page);
+};
+
+// Sayfa hizalı dump'ların verisini store'a taşı, yerine pageRefs yaz.
+// Dönüş: store'da zaten bulunan (paylaşılan) sayfa sayısı.
+uint64_t deduplicatePages(RealProcessCheckpoint& checkpoint, PageStore& store);
+
+// pageRefs'i store'dan tekrar düz veriye aç (v4 imaj yazmadan ya da
+// zincir birleştirmeden önce). Geçersiz id'de false.
+bool rehydratePages(RealProcessCheckpoint& checkpoint, const PageStore& store);
+
+} // namespace real_process
+} // namespace checkpoint
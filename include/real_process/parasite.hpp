@@ -0,0 +1,134 @@
+#pragma once
+
+#include <sys/types.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Syscall Batch - hedef process'te art arda çalıştırılacak syscall listesi
+// ============================================================================
+// Bir komutun argümanı iki şekilde bağlanabilir:
+//   useResult: daha önceki bir komutun dönüş değeri (ör. open -> dup2)
+//   useData:   hedefe kopyalanan bir verinin adresi (ör. open'ın path'i)
+// Dönüş değerleri çekirdek ABI'sindeki gibidir: hata -errno.
+class SyscallBatch {
+public:
+    static constexpr int MAX_ARGS = 6;
+
+    struct Command {
+        uint64_t nr = 0;
+        std::array<uint64_t, MAX_ARGS> args{};
+        uint8_t resultRefs = 0;         // bit i: args[i] = results[args[i]]
+        std::vector<std::pair<int, std::vector<uint8_t>>> data;    // arg -> içerik
+    };
+
+    size_t add(uint64_t nr, uint64_t arg1 = 0, uint64_t arg2 = 0, uint64_t arg3 = 0,
+               uint64_t arg4 = 0, uint64_t arg5 = 0, uint64_t arg6 = 0);
+
+    // cmd'nin argIndex'inci argümanı sourceCmd'nin sonucu olur (sourceCmd < cmd)
+    void useResult(size_t cmd, int argIndex, size_t sourceCmd);
+    // cmd'nin argIndex'inci argümanı hedefteki kopyanın adresi olur
+    void useData(size_t cmd, int argIndex, const void* data, size_t size);
+    void useString(size_t cmd, int argIndex, const std::string& str);     // NUL dahil
+
+    // Sık kullanılanlar
+    size_t addMmap(uint64_t addr, uint64_t length, int prot, int flags, int fd = -1, off_t offset = 0);
+    size_t addMunmap(uint64_t addr, uint64_t length);
+    size_t addMprotect(uint64_t addr, uint64_t length, int prot);
+    size_t addMadvise(uint64_t addr, uint64_t length, int advice);
+    size_t addOpen(const std::string& path, int flags, int mode = 0);
+    size_t addClose(int fd);
+    size_t addDup2(int oldFd, int newFd);
+    size_t addLseek(int fd, off_t offset, int whence);
+
+    // Açıksa ilk hatalı komuttan sonra durulur
+    void setStopOnError(bool enable) { m_stopOnError = enable; }
+    bool getStopOnError() const { return m_stopOnError; }
+
+    const std::vector<Command>& commands() const { return m_commands; }
+    size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+    bool hasData() const;
+    void clear() { m_commands.clear(); }
+
+private:
+    std::vector<Command> m_commands;
+    bool m_stopOnError = false;
+};
+
+struct SyscallBatchResult {
+    static constexpr int64_t NOT_RUN = -125;    // -ECANCELED: stopOnError ile atlandı
+
+    std::vector<int64_t> results;       // Komut başına dönüş değeri
+    size_t executed = 0;
+    size_t roundTrips = 0;              // Hedefin çalıştırıldığı tur sayısı
+
+    bool succeeded(size_t index) const {
+        return index < results.size() && (results[index] >= 0 || results[index] < -4095);
+    }
+};
+
+// ============================================================================
+// Parasite Stub - hedefte kalıcı syscall yürütücü sayfa
+// ============================================================================
+// injectSyscall her çağrıda yazmaçları kaydeder, RIP'e `syscall` yazar,
+// tek adım çalıştırır ve geri yükler (~6 ptrace turu). Burada hedefe bir
+// kez küçük bir kod bloğu ile komut alanı yerleştirilir; bir batch komut
+// alanına process_vm_writev ile yazılır ve blok tek PTRACE_CONT ile tüm
+// komutları çalıştırıp int3'te durur. Alan yetmezse batch parçalara
+// bölünür (parçalar arası result referansları tracer'da çözülür).
+//
+// Hedef ptrace ile durdurulmuş olmalıdır; yazmaçlar her turdan sonra geri
+// yüklenir. Sadece x86_64.
+class ParasiteStub {
+public:
+    static constexpr size_t DEFAULT_AREA_SIZE = 64 * 1024;
+    static constexpr size_t CODE_SIZE = 128;        // Komut alanı bundan sonra başlar
+    static constexpr size_t COMMAND_BYTES = 64;
+
+    explicit ParasiteStub(pid_t pid, size_t areaSize = DEFAULT_AREA_SIZE);
+    ~ParasiteStub();
+
+    ParasiteStub(const ParasiteStub&) = delete;
+    ParasiteStub& operator=(const ParasiteStub&) = delete;
+
+    static bool isSupported();
+
+    // mmap + kod yazma (tek injectSyscall); tekrar çağrılırsa no-op
+    bool install();
+    // munmap; hedef hâlâ durdurulmuş olmalı
+    bool uninstall();
+    bool isInstalled() const { return m_base != 0; }
+
+    uint64_t getAddress() const { return m_base; }
+    size_t getAreaSize() const { return m_areaSize; }
+    bool overlaps(uint64_t addr, uint64_t length) const;
+
+    bool execute(const SyscallBatch& batch, SyscallBatchResult& result);
+
+    uint64_t getTotalRoundTrips() const { return m_totalRoundTrips; }
+    std::string getLastError() const { return m_lastError; }
+
+private:
+    pid_t m_pid;
+    size_t m_areaSize;
+    uint64_t m_base = 0;
+    uint64_t m_totalRoundTrips = 0;
+    std::string m_lastError;
+
+    bool writeRemote(uint64_t addr, const void* data, size_t size);
+    bool readRemote(uint64_t addr, void* data, size_t size);
+    // Komut alanındaki [first, first+count) parçasını çalıştır
+    bool runChunk(const SyscallBatch& batch, size_t first, size_t count,
+                  SyscallBatchResult& result, bool& stopped);
+};
+
+} // namespace real_process
+} // namespace checkpoint
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "real_process/real_process_types.hpp"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <optional>
@@ -9,13 +13,29 @@
 namespace checkpoint {
 namespace real_process {
 
+// Paylaşılan, değişmez memory map görüntüsü
+using MemoryMapSnapshot = std::shared_ptr<const std::vector<MemoryRegion>>;
+
 // ============================================================================
 // ProcFS Reader - /proc Filesystem Okuyucu
 // ============================================================================
+// Memory map okuma sırası:
+//   1. PROCMAP_QUERY ioctl (Linux 6.11+): VMA başına tek ioctl, metin
+//      üretimi ve parse yok. Desteklenmiyorsa (ENOTTY/EINVAL) bir kez
+//      işaretlenir ve bir daha denenmez.
+//   2. Metin: /proc/<pid>/maps sabit bir buffer'a parça parça okunur ve
+//      satırlar stringstream/stoull olmadan elle parse edilir.
+// Map cache'i varsayılan kapalıdır (TTL 0). Açıldığında pid başına son
+// görüntü TTL boyunca paylaşılır; filtreli getter'lar da aynı görüntüyü
+// kullanır. Hedefi değiştiren (mmap/munmap/mprotect) çağıran
+// invalidateMemoryMaps ile cache'i düşürmelidir.
 class ProcFSReader {
 public:
     ProcFSReader() = default;
     ~ProcFSReader() = default;
+
+    ProcFSReader(const ProcFSReader&) = delete;
+    ProcFSReader& operator=(const ProcFSReader&) = delete;
     
     // ========================================================================
     // Process Discovery
@@ -48,15 +68,74 @@ public:
     // Memory Map - /proc/<pid>/maps
     // ========================================================================
     
-    // Tüm memory bölgelerini oku
+    // Tüm memory bölgelerini oku (cache açıksa oradan kopyalanır)
     std::vector<MemoryRegion> getMemoryMaps(pid_t pid);
     
+    // Cache'li görüntü; kopyasız paylaşım için. Okuma başarısızsa boş liste.
+    MemoryMapSnapshot getMemoryMapsSnapshot(pid_t pid);
+    
+    // Cache kontrolü; ttl 0 = kapalı. pid 0 = tüm girdiler.
+    void setMapsCacheTtl(std::chrono::milliseconds ttl);
+    std::chrono::milliseconds getMapsCacheTtl() const;
+    void invalidateMemoryMaps(pid_t pid = 0);
+    
+    // Okuma yolları ayrı ayrı (testler ve tanı için); cache'i kullanmaz
+    bool queryMemoryMaps(pid_t pid, std::vector<MemoryRegion>& regions);     // PROCMAP_QUERY
+    bool readMemoryMapsText(pid_t pid, std::vector<MemoryRegion>& regions);
+    static bool isMapQuerySupported();
+    
+    // /proc/<pid>/smaps: maps alanlarına ek olarak KernelPageSize,
+    // AnonHugePages ve THPeligible. Çekirdek her VMA için sayfa tablolarını
+    // yürüttüğünden maps'ten çok daha pahalıdır; cache'lenmez.
+    bool readSmaps(pid_t pid, std::vector<MemoryRegion>& regions);
+    // Sayfa boyutu alanlarını başlangıç adresi eşleşen bölgelere kopyala
+    // (iki liste de adrese göre sıralı)
+    static void copyPageSizes(const std::vector<MemoryRegion>& from, std::vector<MemoryRegion>& to);
+    
+    // "start-end perms offset dev inode [path]" satırı; [begin, end) '\n' içermez
+    static bool parseMapsLine(const char* begin, const char* end, MemoryRegion& region);
+    
+    struct MapsCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t queryReads = 0;        // PROCMAP_QUERY ile okunan görüntü
+        uint64_t textReads = 0;         // Metin parse ile okunan görüntü
+    };
+    MapsCacheStats getMapsCacheStats() const;
+    
     // Belirli tipte memory bölgelerini filtrele
     std::vector<MemoryRegion> getStackRegions(pid_t pid);
     std::vector<MemoryRegion> getHeapRegions(pid_t pid);
     std::vector<MemoryRegion> getWritableRegions(pid_t pid);
     std::vector<MemoryRegion> getAnonymousRegions(pid_t pid);
     
+    // ========================================================================
+    // Soft-Dirty Tracking - /proc/<pid>/clear_refs, /proc/<pid>/pagemap
+    // ========================================================================
+    
+    // Tüm sayfaların soft-dirty bitlerini temizle ("4" > clear_refs)
+    bool clearSoftDirty(pid_t pid);
+    
+    // Bölge içindeki kirli sayfaları [start, end) aralıkları olarak döndür.
+    // Soft-dirty'e ek olarak bellekte olmayan, swap'taki ve sıfır sayfasına
+    // bağlı sayfalar da kirlidir (MADV_DONTNEED soft-dirty bırakmaz).
+    // Ardışık kirli sayfalar tek aralıkta birleştirilir. zeroRanges
+    // verilirse özel anonim bölgede kesin sıfır okunan sayfalar (bellekte
+    // olmayan, sıfır sayfası) oraya yazılır ve kirli aralıklara girmez.
+    // pagemap okunamazsa std::nullopt döner (çağıran tam dump'a düşmeli).
+    std::optional<std::vector<std::pair<uint64_t, uint64_t>>> getDirtyPageRanges(
+        pid_t pid, const MemoryRegion& region,
+        std::vector<std::pair<uint64_t, uint64_t>>* zeroRanges = nullptr);
+    
+    // Çekirdek soft-dirty biti tutuyor mu (CONFIG_MEM_SOFT_DIRTY). Yoksa
+    // yazılan sayfalar hiç kirli görünmez; incremental tam dump'a düşmeli.
+    static bool softDirtySupported();
+    
+    // [startAddr, startAddr + size) sayfalarının fiziksel frame numaraları
+    // (pagemap bit 0-54). Bellekte olmayan sayfa ve PFN'i gizlenen okuyucu
+    // (CAP_SYS_ADMIN yok) için 0. pagemap okunamazsa std::nullopt.
+    std::optional<std::vector<uint64_t>> getPageFrames(pid_t pid, uint64_t startAddr, uint64_t size);
+    
     // ========================================================================
     // File Descriptors - /proc/<pid>/fd, /proc/<pid>/fdinfo
     // ========================================================================
@@ -100,10 +179,17 @@ private:
     // Parsing helpers
     bool parseStatFile(pid_t pid, RealProcessInfo& info);
     bool parseStatusFile(pid_t pid, RealProcessInfo& info);
-    bool parseMapsLine(const std::string& line, MemoryRegion& region);
-    
-    // Cache (opsiyonel, performans için)
-    // std::map<pid_t, RealProcessInfo> m_infoCache;
+    MemoryMapSnapshot loadMemoryMaps(pid_t pid, bool& viaQuery);
+    
+    // Memory map cache
+    struct MapsCacheEntry {
+        MemoryMapSnapshot regions;
+        std::chrono::steady_clock::time_point loadedAt;
+    };
+    mutable std::mutex m_mapsMutex;
+    std::map<pid_t, MapsCacheEntry> m_mapsCache;
+    std::chrono::milliseconds m_mapsCacheTtl{0};
+    MapsCacheStats m_mapsStats;
 };
 
 // ============================================================================
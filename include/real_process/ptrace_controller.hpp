@@ -2,15 +2,26 @@
 
 #include "real_process/real_process_types.hpp"
 #include "real_process/proc_reader.hpp"
+#include "core/io_engine.hpp"
+#include "core/metrics.hpp"
 #include <sys/types.h>
 #include <sys/ptrace.h>
 #include <sys/user.h>
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <functional>
 
 namespace checkpoint {
 namespace real_process {
 
+class ICheckpointSink;
+class MappedCheckpointImage;
+class PageStore;
+class DumpBufferPool;
+class LazyRestoreSession;
+
 // ============================================================================
 // Ptrace Error Codes
 // ============================================================================
@@ -26,6 +37,8 @@ enum class PtraceError {
 };
 
 std::string ptraceErrorToString(PtraceError err);
+// errno'yu (ptrace / waitpid sonrası) PtraceError'a çevir
+PtraceError errnoToPtraceError();
 
 // ============================================================================
 // Ptrace Controller - Process Kontrolü ve Memory Erişimi
@@ -56,10 +69,53 @@ public:
     // Seize (PTRACE_SEIZE) - daha modern, process durmaz
     PtraceError seize(pid_t pid);
     
-    // Attached mi?
-    bool isAttached() const { return m_attached; }
+    // Zaten bu thread tarafından trace edilen ve durmuş bir process'i
+    // sahiplen (örn. CLONE_PTRACE ile oluşmuş fork snapshot child'ı)
+    PtraceError adoptTracee(pid_t pid);
+    
+    // Attached mi? (attach, seize ya da freezeThreadGroup)
+    bool isAttached() const { return m_attached || m_seized; }
     pid_t getAttachedPid() const { return m_pid; }
     
+    // ========================================================================
+    // Thread Group
+    // ========================================================================
+    
+    // Tüm thread'leri PTRACE_SEIZE + PTRACE_INTERRUPT ile durdur. Önce
+    // hepsine interrupt gönderilir, sonra beklenir; kernel thread'leri
+    // paralel durdurur. /proc/<pid>/task bu arada açılan thread'ler için
+    // yeni thread kalmayana kadar tekrar taranır (durmuş thread clone
+    // edemez, tarama sonlanır). Diğer çağrılar ana thread'e (pid) gider;
+    // detach tüm thread'leri bırakır.
+    //
+    // ptrace istekleri sadece tracer thread'inden geçerli olduğundan
+    // register'lar bu thread'den okunur: kernel'e gidiş thread başına tek
+    // GETREGS/GETREGSET, duraklamanın asıl maliyeti olan bekleme paraleldir.
+    PtraceError freezeThreadGroup(pid_t pid);
+    bool isGroupFrozen() const { return !m_threads.empty(); }
+    
+    // Durdurulmuş thread'ler, ana thread ilk sırada
+    std::vector<pid_t> getFrozenThreads() const;
+    
+    // Durdurma penceresi ölçümü; stoppedNanos detach'te dolar
+    struct FreezeStats {
+        size_t threads = 0;
+        size_t scanRounds = 0;          // Yeni thread bulunan task taramaları
+        uint64_t freezeNanos = 0;       // İlk interrupt -> son thread durdu
+        uint64_t stoppedNanos = 0;      // Hepsi durdu -> serbest bırakıldı
+    };
+    const FreezeStats& getFreezeStats() const { return m_freezeStats; }
+    
+    // Bellek aktarım syscall'ları (process_vm_readv/writev, /proc/<pid>/mem,
+    // PEEK/POKEDATA) ve aktarılan byte'lar; paralel dump worker'ları dahil
+    struct IoStats {
+        uint64_t readCalls = 0;
+        uint64_t readBytes = 0;
+        uint64_t writeCalls = 0;
+        uint64_t writeBytes = 0;
+    };
+    IoStats getIoStats() const;
+    
     // ========================================================================
     // Process Control
     // ========================================================================
@@ -100,6 +156,12 @@ public:
     PtraceError getFPURegisters(std::vector<uint8_t>& fpuState);
     PtraceError setFPURegisters(const std::vector<uint8_t>& fpuState);
     
+    // Belirli bir thread'in register'ları (tid durdurulmuş tracee olmalı)
+    PtraceError getThreadRegisters(pid_t tid, LinuxRegisters& regs);
+    PtraceError setThreadRegisters(pid_t tid, const LinuxRegisters& regs);
+    PtraceError getThreadFPURegisters(pid_t tid, std::vector<uint8_t>& fpuState);
+    PtraceError setThreadFPURegisters(pid_t tid, const std::vector<uint8_t>& fpuState);
+    
     // ========================================================================
     // Memory Access
     // ========================================================================
@@ -116,12 +178,60 @@ public:
     // Bellek bloğu yaz
     PtraceError writeMemory(uint64_t addr, const void* buffer, size_t size);
     
+    // Dump tamponları bu havuzdan alınır (nullptr: her dump için yeni vector)
+    void setBufferPool(std::shared_ptr<DumpBufferPool> pool) { m_bufferPool = std::move(pool); }
+    
     // Memory region dump
     MemoryDump dumpMemoryRegion(const MemoryRegion& region);
     
     // Memory region restore
     PtraceError restoreMemoryRegion(const MemoryDump& dump);
     
+    // Toplu dump (process_vm_readv, çağrı başına IOV_MAX kadar iovec)
+    // Okunamayan sayfalar (guard page, PROT_NONE delikleri) sayfa sayfa
+    // atlanır; böyle bir bölge okunabilir sayfa aralıklarına bölünerek döner.
+    // process_vm_readv yoksa /proc/<pid>/mem + PEEKDATA yoluna düşer.
+    // threads > 1 ise büyük bölgeler chunkSize'lık parçalara bölünüp paralel
+    // okunur (0 = donanım thread sayısı); çıktı sırası her durumda aynıdır.
+    // HUGE_PAGE_SIZE'dan büyük chunk'lar onun katına yuvarlanır ve parça
+    // sınırları mutlak adreste chunk katlarına denk gelir: bir THP asla iki
+    // worker arasında bölünmez.
+    static constexpr uint64_t DEFAULT_DUMP_CHUNK_SIZE = 4 * 1024 * 1024;
+    static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    std::vector<MemoryDump> dumpMemoryRegions(const std::vector<MemoryRegion>& regions,
+                                              unsigned threads = 1,
+                                              uint64_t chunkSize = 0);
+    
+    // Toplu restore (process_vm_writev). errors verilirse her dump'ın sonucu
+    // aynı index'e yazılır; dönüş değeri ilk hatadır.
+    PtraceError restoreMemoryRegions(const std::vector<MemoryDump>& dumps,
+                                     std::vector<PtraceError>* errors = nullptr);
+    
+    // Toplu yazma birimi - kaynak herhangi bir tampon olabilir (ör. mmap
+    // edilmiş checkpoint imajı); veri kopyalanmadan process_vm_writev'e verilir
+    struct WriteSegment {
+        uint64_t addr;
+        const uint8_t* data;
+        uint64_t length;
+    };
+    
+    // restoreMemoryRegions'ın izin kontrolü yapmayan çekirdeği. Boş segmentler
+    // INVALID_ARGUMENT alır; errors/dönüş değeri restoreMemoryRegions gibidir.
+    PtraceError writeMemorySegments(const std::vector<WriteSegment>& segments,
+                                    std::vector<PtraceError>* errors = nullptr);
+    
+    // Toplu okuma birimi - uzak adres ve hedef tampon
+    struct ReadSegment {
+        uint64_t addr;
+        uint8_t* buffer;
+        uint64_t length;
+    };
+    
+    // Segmentleri toplu oku; okunamayan sayfası olan segment MEMORY_ERROR
+    // alır (okunabilen kısmı yine doldurulur). Dönüş değeri ilk hatadır.
+    PtraceError readMemorySegments(const std::vector<ReadSegment>& segments,
+                                   std::vector<PtraceError>* errors = nullptr);
+    
     // ========================================================================
     // Signal Handling
     // ========================================================================
@@ -155,8 +265,49 @@ private:
     bool m_seized;
     int m_memFd;            // /proc/<pid>/mem file descriptor
     
+    // freezeThreadGroup ile durdurulan thread'ler; pendingSignal, durma
+    // sırasında yakalanan sinyal (detach'te geri verilir)
+    struct FrozenThread {
+        pid_t tid;
+        int pendingSignal;
+    };
+    std::vector<FrozenThread> m_threads;
+    FreezeStats m_freezeStats;
+    std::chrono::steady_clock::time_point m_frozenAt;
+    std::shared_ptr<DumpBufferPool> m_bufferPool;
+    std::atomic<uint64_t> m_readCalls{0};
+    std::atomic<uint64_t> m_readBytes{0};
+    std::atomic<uint64_t> m_writeCalls{0};
+    std::atomic<uint64_t> m_writeBytes{0};
+    
+    void countRead(ssize_t result) {
+        m_readCalls.fetch_add(1, std::memory_order_relaxed);
+        if (result > 0) m_readBytes.fetch_add(static_cast<uint64_t>(result), std::memory_order_relaxed);
+    }
+    void countWrite(ssize_t result) {
+        m_writeCalls.fetch_add(1, std::memory_order_relaxed);
+        if (result > 0) m_writeBytes.fetch_add(static_cast<uint64_t>(result), std::memory_order_relaxed);
+    }
+    
+    PtraceError detachThreads();
+    std::vector<uint8_t> allocateDumpBuffer(size_t size);
+    
     PtraceError openMemFd();
     void closeMemFd();
+    
+    // Okunamayan aralık (segment index'i + segment içi offset)
+    struct SegmentHole {
+        size_t segment;
+        uint64_t offset;
+        uint64_t length;
+    };
+    
+    // Segmentleri process_vm_readv ile oku, okunamayan sayfaları holes'a ekle.
+    // onTracerThread false ise fallback'te PEEKDATA kullanılmaz (ptrace
+    // istekleri sadece tracer thread'inden geçerlidir).
+    void readSegments(const std::vector<ReadSegment>& segments,
+                      std::vector<SegmentHole>& holes,
+                      bool onTracerThread);
     PtraceError waitForSignal(int* status);
 };
 
@@ -179,11 +330,50 @@ public:
         const CheckpointOptions& options = CheckpointOptions()
     );
     
+    // Checkpoint'i doğrudan dosyaya stream ederek al - dump'lar target'tan
+    // okundukça yazılır, bellekte tutulmaz (dönen checkpoint'te memoryDumps boş)
+    std::optional<RealProcessCheckpoint> createCheckpointToFile(
+        pid_t pid,
+        const std::string& filepath,
+        const std::string& name = "",
+        const CheckpointOptions& options = CheckpointOptions(),
+        CheckpointFileFormat format = CheckpointFileFormat::STREAM
+    );
+    
+    // Dump'lar okundukça verilen sink'e yazılır (ör. live migration
+    // stream'i); parent verilirse sadece kirlenen sayfalar. Dönen
+    // checkpoint'te memoryDumps boş.
+    std::optional<RealProcessCheckpoint> createCheckpointToSink(
+        pid_t pid,
+        ICheckpointSink& sink,
+        const std::string& name = "",
+        const CheckpointOptions& options = CheckpointOptions(),
+        const RealProcessCheckpoint* parent = nullptr
+    );
+    
+    // Incremental checkpoint al - sadece parent'tan sonra kirlenen sayfalar
+    // Parent, trackDirtyPages açıkken alınmış olmalı (soft-dirty bitleri
+    // parent dump'ından sonra temizlenir). Sonuç parent'ı referans eder.
+    std::optional<RealProcessCheckpoint> createIncrementalCheckpoint(
+        pid_t pid,
+        const RealProcessCheckpoint& parent,
+        const std::string& name = "",
+        const CheckpointOptions& options = CheckpointOptions::incremental()
+    );
+    
+    // Base + incremental zincirini tek tam checkpoint'e birleştir
+    // chain[0] base checkpoint, sonrakiler sırayla birbirinin child'ı olmalı
+    std::optional<RealProcessCheckpoint> mergeCheckpointChain(
+        const std::vector<RealProcessCheckpoint>& chain
+    );
+    
     // Checkpoint'i dosyaya kaydet
+    // INDEXED: sayfa hizalı v7 imaj (MappedCheckpointImage ile açılabilir)
     bool saveCheckpoint(const RealProcessCheckpoint& checkpoint, 
-                       const std::string& filepath);
+                       const std::string& filepath,
+                       CheckpointFileFormat format = CheckpointFileFormat::STREAM);
     
-    // Checkpoint'i dosyadan yükle
+    // Checkpoint'i dosyadan yükle (v1-v7; indeksli imaj mmap üzerinden kopyalanır)
     std::optional<RealProcessCheckpoint> loadCheckpoint(const std::string& filepath);
     
     // ========================================================================
@@ -205,6 +395,50 @@ public:
         const RestoreOptions& options = RestoreOptions()
     );
     
+    // pageRefs içeren (deduplicatePages ile PageStore'a taşınmış)
+    // checkpoint'i restore et - sayfalar doğrudan store'dan yazılır
+    RestoreResult restoreCheckpointEx(
+        pid_t pid,
+        const RealProcessCheckpoint& checkpoint,
+        const PageStore& store,
+        const RestoreOptions& options = RestoreOptions()
+    );
+    
+    // mmap edilmiş indeksli imajdan restore - dump'lar heap'e kopyalanmadan
+    // doğrudan mapping'den target'a yazılır. options.mapImagePayloads
+    // açıksa uygun bölgeler hiç yazılmaz, target'ta imaj dosyasından eşlenir.
+    RestoreResult restoreFromImage(
+        pid_t pid,
+        const MappedCheckpointImage& image,
+        const RestoreOptions& options = RestoreOptions()
+    );
+    
+    // Lazy (post-copy) restore: register'lar, mapping'ler ve sıcak küme
+    // (stack, lazyEagerBytes'tan küçük bölgeler) yazılır, büyük private
+    // anonim bölgeler userfaultfd ile talep üzerine session'dan yüklenir.
+    // session nullptr kalırsa her şey hemen yazılmıştır. checkpoint / image
+    // session tamamlanana (ya da yok edilene) kadar yaşamalıdır.
+    RestoreResult restoreLazy(
+        pid_t pid,
+        const RealProcessCheckpoint& checkpoint,
+        std::unique_ptr<LazyRestoreSession>& session,
+        const RestoreOptions& options = RestoreOptions()
+    );
+    
+    RestoreResult restoreLazyFromImage(
+        pid_t pid,
+        const MappedCheckpointImage& image,
+        std::unique_ptr<LazyRestoreSession>& session,
+        const RestoreOptions& options = RestoreOptions()
+    );
+    
+    // Incremental zinciri birleştirip restore et
+    RestoreResult restoreCheckpointChain(
+        pid_t pid,
+        const std::vector<RealProcessCheckpoint>& chain,
+        const RestoreOptions& options = RestoreOptions()
+    );
+    
     // Validate restore (dry run)
     RestoreResult validateRestore(
         pid_t pid,
@@ -215,8 +449,18 @@ public:
     // Comparison / Diff
     // ========================================================================
     
-    // İki checkpoint arasındaki farkları bul
+    // İki checkpoint arasındaki farkları bul. Dump'lar başlangıç adresiyle
+    // eşleşir; iki dump'ın da sayfa hash ağacı varsa (CheckpointOptions::
+    // hashPages ya da computePageHashes) eşit alt ağaçlar atlanır ve sadece
+    // hash'i farklı sayfalar byte byte karşılaştırılır, yoksa tüm sayfalar
+    // karşılaştırılır. Hash'ler serileştirilmez: yüklenen checkpoint'lerde
+    // ağaç için computePageHashes çağrılmalıdır.
     struct CheckpointDiff {
+        struct ChangedRange {
+            uint64_t addr;
+            uint64_t length;
+        };
+        
         bool registersChanged;
         std::vector<std::string> changedRegisters;
         
@@ -224,7 +468,9 @@ public:
         std::vector<MemoryRegion> addedRegions;
         std::vector<MemoryRegion> removedRegions;
         std::vector<MemoryRegion> modifiedRegions;
-        uint64_t totalBytesChanged;
+        std::vector<ChangedRange> changedRanges;    // Eşleşen dump'larda, adrese göre sıralı
+        uint64_t totalBytesChanged;                 // changedRanges + eklenen/silinen dump'lar
+        uint64_t pagesCompared;                     // Hash'i farklı çıkıp okunan sayfa
         
         bool filesChanged;
         std::vector<FileDescriptorInfo> addedFds;
@@ -246,16 +492,145 @@ public:
     // Son hata mesajı
     std::string getLastError() const { return m_lastError; }
     
+    // Son checkpoint'in durdurma penceresi (captureAllThreads açıkken)
+    const PtraceController::FreezeStats& getLastFreezeStats() const { return m_lastFreezeStats; }
+    
     // Callback'ler
     using ProgressCallback = std::function<void(const std::string& stage, double progress)>;
     void setProgressCallback(ProgressCallback cb) { m_progressCallback = cb; }
     
+    // saveCheckpoint / createCheckpointToFile / loadCheckpoint dosya I/O'su
+    // (kuyruk derinliği, tampon boyu, io_uring, O_DIRECT)
+    void setIoOptions(const IoEngineOptions& options) { m_ioOptions = options; }
+    const IoEngineOptions& getIoOptions() const { return m_ioOptions; }
+    
+    // Dump tamponları bu havuzdan alınır; stream edilen dump'lar yazılınca
+    // havuza döner. Bellekte tutulan checkpoint'lerinki releaseCheckpoint ile
+    // geri verilir. Varsayılan olarak checkpointer'a ait bir havuz vardır.
+    void setBufferPool(std::shared_ptr<DumpBufferPool> pool) { m_bufferPool = std::move(pool); }
+    const std::shared_ptr<DumpBufferPool>& getBufferPool() const { return m_bufferPool; }
+    void releaseCheckpoint(RealProcessCheckpoint& checkpoint);
+    
+    // Checkpoint ("checkpoint.create") ve restore ("checkpoint.restore")
+    // işlemlerinin aşama süreleri, byte ve syscall sayaçları bu registry'ye
+    // yazılır (varsayılan: MetricsRegistry::global())
+    void setMetricsRegistry(MetricsRegistry& registry) { m_metrics = &registry; }
+    MetricsRegistry& getMetricsRegistry() const { return *m_metrics; }
+    
 private:
     ProcFSReader m_procReader;
     std::string m_lastError;
     ProgressCallback m_progressCallback;
+    IoEngineOptions m_ioOptions;
+    PtraceController::FreezeStats m_lastFreezeStats;
+    std::shared_ptr<DumpBufferPool> m_bufferPool;
+    MetricsRegistry* m_metrics = &MetricsRegistry::global();
     
     void reportProgress(const std::string& stage, double progress);
+    
+    // Stream modunda bir seferde okunup yazılan en fazla dump byte'ı
+    static constexpr uint64_t STREAM_BATCH_BYTES = 64 * 1024 * 1024;
+    
+    // createCheckpoint / createIncrementalCheckpoint ortak gövdesi
+    // parent != nullptr ise sadece soft-dirty sayfalar dump edilir,
+    // sink != nullptr ise dump'lar checkpoint'e değil stream'e yazılır
+    std::optional<RealProcessCheckpoint> captureCheckpoint(
+        pid_t pid,
+        const std::string& name,
+        const CheckpointOptions& options,
+        const RealProcessCheckpoint* parent,
+        ICheckpointSink* sink
+    );
+    
+    // Bölgeleri source'tan oku; sink varsa gruplar halinde stream'e yaz,
+    // yoksa out'a topla. fixup her dump'a yazılmadan önce uygulanır.
+    bool dumpRegions(
+        PtraceController& source,
+        const std::vector<MemoryRegion>& regions,
+        const CheckpointOptions& options,
+        ICheckpointSink* sink,
+        std::vector<MemoryDump>& out,
+        const std::function<void(MemoryDump&)>& fixup
+    );
+    
+    bool shouldDumpRegion(const MemoryRegion& region, const CheckpointOptions& options) const;
+    
+    // format'a göre dosya sink'i aç; başarısızlıkta nullptr (m_lastError set)
+    std::unique_ptr<ICheckpointSink> openFileSink(const std::string& filepath,
+                                                  CheckpointFileFormat format);
+    
+    // Restore edilecek dump - veri checkpoint'in vector'üne ya da imaj
+    // mapping'ine bakar; zeroFill'de veri yok, pageRefs'te sayfalar store'da
+    struct RestoreDumpView {
+        MemoryRegion region;
+        const uint8_t* data;
+        uint64_t size;
+        bool zeroFill;
+        const std::vector<uint32_t>* pageRefs;
+        int64_t fileOffset = -1;                    // İmajdaki payload offset'i
+    };
+    
+    // Bu boyuttan büyük zeroFill aralıkları discardZeroPages açıkken
+    // madvise ile boşaltılır (küçüklerde syscall enjeksiyonu yazmaktan pahalı)
+    static constexpr uint64_t DISCARD_MIN_BYTES = 64 * 1024;
+    
+    static std::vector<RestoreDumpView> dumpViews(const RealProcessCheckpoint& checkpoint);
+    
+    // Delta restore: segmentlerden canlı içeriği aynı olan sayfaları çıkar
+    // (owners birlikte güncellenir). onlyDirty ise soft-dirty olmayan
+    // sayfalar okunmadan eşit sayılır. Canlı okuma DELTA_BATCH_BYTES'lık
+    // gruplar halinde yapılır.
+    static constexpr uint64_t DELTA_BATCH_BYTES = 16 * 1024 * 1024;
+    void filterUnchangedPages(
+        PtraceController& ptrace,
+        pid_t pid,
+        const std::vector<RestoreDumpView>& dumps,
+        const std::vector<uint64_t>& targets,
+        bool onlyDirty,
+        std::vector<PtraceController::WriteSegment>& segments,
+        std::vector<size_t>& owners,
+        RestoreResult& result
+    );
+    
+    // Son delta restore'dan sonra soft-dirty bitleri temizlenen process'ler:
+    // temiz sayfaları checkpointId'nin içeriğini taşır. startTime pid
+    // yeniden kullanımını ayırt eder.
+    struct DeltaBaseline {
+        uint64_t checkpointId;
+        uint64_t startTime;
+    };
+    std::map<pid_t, DeltaBaseline> m_deltaBaselines;
+    
+    // restoreCheckpointEx / restoreFromImage / restoreLazy ortak gövdesi.
+    // lazy != nullptr ise uygun bölgeler lazy session'a bırakılır;
+    // imagePath verilirse mapImagePayloads dump'ları bu dosyadan eşler.
+    RestoreResult restoreImpl(
+        pid_t pid,
+        const RealProcessCheckpoint& checkpoint,
+        const std::vector<RestoreDumpView>& dumps,
+        const PageStore* store,
+        const RestoreOptions& options,
+        std::unique_ptr<LazyRestoreSession>* lazy = nullptr,
+        const std::string* imagePath = nullptr
+    );
+    
+    // MAP_PRIVATE|MAP_FIXED ile imajdan eşlenebilecek dump (yazılabilir,
+    // private anonim, stack/heap değil, payload bölgenin tamamı)
+    static bool canMapFromImage(const RestoreDumpView& dump);
+    
+    // Fork snapshot: target'a clone(CLONE_PTRACE) enjekte et, target'ı hemen
+    // serbest bırak ve bölgeleri donmuş child'dan oku. ptrace bu çağrıdan
+    // sonra detach edilmiş olur. Başarısızlıkta std::nullopt; ptrace hâlâ
+    // attached ise target henüz serbest bırakılmamıştır (yerinde dump yapılabilir).
+    std::optional<std::vector<MemoryDump>> dumpViaForkSnapshot(
+        PtraceController& ptrace,
+        pid_t pid,
+        const std::vector<MemoryRegion>& regions,
+        const CheckpointOptions& options,
+        bool clearSoftDirty,
+        ICheckpointSink* sink,
+        TraceScope& trace
+    );
 };
 
 } // namespace real_process
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <span>
 #include <sys/types.h>
 #include <sys/user.h>
 
@@ -49,6 +50,14 @@ struct MemoryRegion {
     uint64_t inode;
     std::string pathname;
     
+    // Sayfa boyutu bilgisi (ProcFSReader::readSmaps; okunmadıysa 0 / false)
+    uint64_t kernelPageSize = 0;    // KernelPageSize: hugetlbfs'te 2MB / 1GB
+    uint64_t anonHugeBytes = 0;     // AnonHugePages: THP ile eşlenmiş byte
+    bool thpEligible = false;       // THPeligible
+    // Bölge THP ile eşlenmişti (anonHugeBytes > 0). Checkpoint'te saklanan
+    // tek bit budur; restore bölgeyi yazmadan önce huge page'lerle hazırlar.
+    bool hugePages = false;
+    
     uint64_t size() const { return endAddr - startAddr; }
     bool isAnonymous() const { return pathname.empty() || pathname[0] != '/'; }
     bool isStack() const { return pathname.find("[stack") != std::string::npos; }
@@ -148,7 +157,37 @@ struct MemoryDump {
     std::vector<uint8_t> data;
     bool isValid;
     
-    MemoryDump() : isValid(false) {}
+    // Sıfır sayfa aralığı - data boş, restore'da sıfırlanır (ya da MADV_DONTNEED)
+    bool zeroFill;
+    
+    // Deduplicate edilmiş dump - sayfa başına PageStore id'si, data boş
+    std::vector<uint32_t> pageRefs;
+    
+    // data'nın PAGE_HASH_BYTES'lık sayfalarının xxhash64'ü (diff için
+    // bellekte tutulur, serileştirilmez; boş = hesaplanmadı).
+    // data değiştirilirse temizlenmeli.
+    std::vector<uint64_t> pageHashes;
+    
+    // pageHashes üzerine Merkle ağacının iç düğümleri: seviyeler yapraktan
+    // köke art arda dizilir, her düğüm HASH_TREE_FANOUT çocuğunun hash'idir
+    // ve kök en sondadır (tek sayfada boş). pageHashes ile birlikte
+    // temizlenir; compareCheckpoints eşit alt ağaçları atlar.
+    std::vector<uint64_t> hashTree;
+    
+    MemoryDump() : region(), isValid(false), zeroFill(false) {}
+    
+    bool isDeduplicated() const { return !pageRefs.empty(); }
+    
+    // Dosyaya yazılan payload: data ya da pageRefs (zeroFill'de boş)
+    const uint8_t* payload() const {
+        return isDeduplicated() ? reinterpret_cast<const uint8_t*>(pageRefs.data()) : data.data();
+    }
+    uint64_t payloadSize() const {
+        return isDeduplicated() ? pageRefs.size() * sizeof(uint32_t) : data.size();
+    }
+    
+    // Yazılacak bir şey var mı (boş, geçersiz dump'lar atlanır)
+    bool hasContent() const { return isValid && (zeroFill || payloadSize() > 0); }
 };
 
 // ============================================================================
@@ -182,12 +221,25 @@ struct RealProcessCheckpoint {
     std::string name;
     uint64_t timestamp;
     
+    // Incremental checkpoint zinciri
+    // Incremental checkpoint'lerde memoryDumps sadece parent'tan sonra
+    // kirlenen sayfa aralıklarını içerir (dump.region = sayfa aralığı)
+    uint64_t parentCheckpointId;    // 0 = tam (base) checkpoint
+    bool isIncremental;
+    
     // Process Info
     RealProcessInfo info;
     
-    // CPU State
+    // CPU State (ana thread)
     LinuxRegisters registers;
     
+    // Diğer thread'ler (v6+, indeksli imajda v7); restore tid eşleşmesiyle yapılır
+    struct ThreadState {
+        pid_t tid;
+        LinuxRegisters registers;
+    };
+    std::vector<ThreadState> threads;
+    
     // Memory State
     std::vector<MemoryRegion> memoryMap;
     std::vector<MemoryDump> memoryDumps;    // Sadece writable/anonymous regions
@@ -206,14 +258,67 @@ struct RealProcessCheckpoint {
     std::vector<std::string> environ;
     
     // Serialization
+    // v1: temel format, v2: incremental zincir + dump flag'leri,
+    // v3: stream edilmiş dump bölümü (STREAMED_DUMP_COUNT + end kaydı)
+    // v4: indeksli imaj - sayfa hizalı payload'lar + sondaki region index
+    //     tablosu (MappedCheckpointImage ile mmap edilerek okunur)
+    // v5: v3 + zero-fill ve page-ref dump'ları (DUMP_FLAG_*)
+    // v6: v5 + ana thread FPU'sundan sonra thread bölümü (sayı + tid/register)
+    // v7: v4 + v6'daki thread bölümü (indeksli imaj; v4 hâlâ okunur)
+    static constexpr uint32_t FORMAT_VERSION = 6;
+    static constexpr uint32_t INDEXED_FORMAT_VERSION = 7;
+    static constexpr uint32_t INDEXED_FORMAT_VERSION_V4 = 4;
+    static constexpr uint32_t STREAMED_DUMP_COUNT = 0xFFFFFFFF;
+    
     std::vector<uint8_t> serialize() const;
-    static RealProcessCheckpoint deserialize(const std::vector<uint8_t>& data);
+    static RealProcessCheckpoint deserialize(std::span<const uint8_t> data);
+    
+    // Parçalı serileştirme (CheckpointStreamWriter için): magic'ten dump
+    // sayısına kadar olan kısım ve tek dump kaydının başlığı
+    std::vector<uint8_t> serializeHeader(uint32_t dumpCount,
+                                         uint32_t version = FORMAT_VERSION) const;
+    static void serializeDumpHeader(const MemoryDump& dump, std::vector<uint8_t>& out);
+    
+    // Dump flag byte'ı: bit 0-3 region izinleri, üst bitler dump türü
+    static constexpr uint8_t DUMP_FLAG_ZERO_FILL = 0x10;   // payload yok
+    static constexpr uint8_t DUMP_FLAG_PAGE_REFS = 0x20;   // payload: u32 sayfa id'leri
+    // Region (ve dump) flag'lerinde MemoryRegion::hugePages; eski okuyucular
+    // bilinmeyen biti yok sayar, sürüm değişmez
+    static constexpr uint8_t REGION_FLAG_HUGE_PAGES = 0x40;
+    static uint8_t dumpFlags(const MemoryDump& dump);
+    // flags'i dump'a uygula; payload'ın nereye okunacağını belirler
+    static void applyDumpFlags(MemoryDump& dump, uint8_t flags);
+    static bool isStreamVersion(uint32_t version) {
+        return version >= 1 && version <= FORMAT_VERSION && version != INDEXED_FORMAT_VERSION_V4;
+    }
+    static bool isIndexedVersion(uint32_t version) {
+        return version == INDEXED_FORMAT_VERSION_V4 || version == INDEXED_FORMAT_VERSION;
+    }
     
     // Helper methods
     uint64_t totalMemorySize() const;
     uint64_t dumpedMemorySize() const;
     
-    RealProcessCheckpoint() : checkpointId(0), timestamp(0), hasFileOperationLog(false) {}
+    // Dump sayfa hash'lerini ve ağacı hesapla (varsa atlanır). Aynı
+    // checkpoint'i tekrar tekrar karşılaştıran döngüde bir kez çağrılır.
+    static constexpr uint64_t PAGE_HASH_BYTES = 4096;
+    static constexpr uint64_t HASH_TREE_FANOUT = 16;
+    void computePageHashes();
+    
+    // Yaprak hash'lerinden hashTree düzeninde iç düğümler
+    static std::vector<uint64_t> buildHashTree(const std::vector<uint64_t>& leaves);
+    
+    RealProcessCheckpoint() : checkpointId(0), timestamp(0),
+                              parentCheckpointId(0), isIncremental(false),
+                              hasFileOperationLog(false) {}
+};
+
+// ============================================================================
+// Checkpoint File Format - saveCheckpoint / createCheckpointToFile çıktısı
+// ============================================================================
+enum class CheckpointFileFormat {
+    STREAM,     // v3 - sıralı kayıtlar, pipe/socket'e de yazılabilir
+    INDEXED     // v7 - sayfa hizalı payload + region index (mmap ile açılır)
 };
 
 // ============================================================================
@@ -236,13 +341,50 @@ struct CheckpointOptions {
     
     uint64_t maxMemoryDump;     // Maksimum dump boyutu (0 = sınırsız)
     
+    // Incremental checkpoint desteği
+    // Dump sonrası soft-dirty bitlerini temizler; böylece sonraki
+    // createIncrementalCheckpoint sadece kirlenen sayfaları okur
+    bool trackDirtyPages;
+    
+    // Paralel dump - target durdurulmuşken bölgeler dumpThreads worker ile
+    // dumpChunkSize'lık parçalar halinde okunur (0 thread = donanım sayısı,
+    // 0 chunk = varsayılan 4MB). Çıktı sırası thread sayısından bağımsızdır.
+    unsigned dumpThreads;
+    uint64_t dumpChunkSize;
+    
+    // Fork snapshot modu - target'a fork enjekte edilir, register'lar
+    // alındıktan sonra target hemen devam eder; bellek COW child'dan okunur.
+    // Duraklama süresi heap boyutundan bağımsızdır (bedeli: COW sayfaları).
+    bool forkSnapshot;
+    
+    // Tamamı sıfır olan sayfalar veri olmadan zeroFill dump'ı olarak
+    // kaydedilir (heap/BSS'te tipik olarak büyük kazanç)
+    bool eliminateZeroPages;
+    
+    // Tüm thread'ler PTRACE_SEIZE/INTERRUPT ile durdurulur ve her birinin
+    // register'ları kaydedilir. Kapalıysa sadece ana thread attach edilir.
+    bool captureAllThreads;
+    
+    // Dump'ların sayfa hash'leri ve Merkle ağacı target serbest kaldıktan
+    // sonra hesaplanır (compareCheckpoints kullanır). Hash'ler sadece
+    // bellekte tutulur, dosyaya yazılmaz; bu yüzden varsayılan kapalıdır -
+    // aynı checkpoint'i tekrar tekrar karşılaştıran (CLI diff) açar.
+    bool hashPages;
+    
+    // Bölgelerin THP durumu target durdurulmadan önce smaps'ten okunur;
+    // THP ile eşlenmiş bölgeler hugePages bayrağıyla kaydedilir
+    bool capturePageSizes;
+    
     CheckpointOptions() 
         : saveRegisters(true), saveMemory(true),
           saveFileDescriptors(true), saveEnvironment(true),
           saveSignals(true), dumpHeap(true), dumpStack(true),
           dumpAnonymous(true), dumpFileBacked(false),
           skipReadOnly(true), skipVdso(true),
-          maxMemoryDump(0) {}
+          maxMemoryDump(0), trackDirtyPages(false),
+          dumpThreads(1), dumpChunkSize(0), forkSnapshot(false),
+          eliminateZeroPages(false), captureAllThreads(true),
+          hashPages(false), capturePageSizes(true) {}
     
     // Preset configurations
     static CheckpointOptions minimal() {
@@ -259,6 +401,21 @@ struct CheckpointOptions {
         opt.skipReadOnly = false;
         return opt;
     }
+    
+    // Düşük gecikme: fork snapshot + paralel dump
+    static CheckpointOptions lowLatency() {
+        CheckpointOptions opt;
+        opt.forkSnapshot = true;
+        opt.dumpThreads = 0;
+        return opt;
+    }
+    
+    // Base + incremental zinciri için (soft-dirty takibi açık)
+    static CheckpointOptions incremental() {
+        CheckpointOptions opt;
+        opt.trackDirtyPages = true;
+        return opt;
+    }
 };
 
 // ============================================================================
@@ -285,6 +442,41 @@ struct RestoreOptions {
     bool ignoreMemoryErrors;        // Continue if memory write fails
     bool ignoreFDErrors;            // Continue if FD restoration fails
     
+    // zeroFill dump'ları private anonymous bölgelerde sıfır yazmak yerine
+    // enjekte edilen madvise(MADV_DONTNEED) ile boşaltılır
+    bool discardZeroPages;
+    
+    // Delta restore: canlı sayfalar okunup checkpoint'le karşılaştırılır,
+    // sadece farklı olanlar yazılır. deltaUseSoftDirty açıkken restore
+    // sonunda soft-dirty bitleri temizlenir; aynı checkpoint'in bir sonraki
+    // delta restore'unda temiz sayfalar hiç okunmadan atlanır (bu, process'in
+    // incremental checkpoint takibini de sıfırlar). Varsayılan kapalı: arada
+    // başka biri clear_refs'e yazarsa (CRIU, başka bir checkpointer) değişen
+    // sayfalar temiz görünür ve bu tespit edilemez.
+    bool deltaRestore;
+    bool deltaUseSoftDirty;
+    
+    // Lazy restore (restoreLazy): bu boyuttan küçük bölgeler ve stack hemen
+    // yazılır, büyük private anonim bölgeler userfaultfd ile talep üzerine
+    // yüklenir. lazyPrefetch açıkken kalan sayfalar arka planda doldurulur.
+    uint64_t lazyEagerBytes;
+    bool lazyPrefetch;
+    
+    // restoreFromImage: private anonim bölgeler kopyalanmak yerine imaj
+    // dosyasından MAP_PRIVATE|MAP_FIXED ile eşlenir (page cache'ten COW).
+    // Aynı imajdan restore edilen process'ler fiziksel sayfaları paylaşır;
+    // imaj dosyası bu process'ler yaşadıkça değiştirilmemelidir. Eşlenen
+    // bölgenin maps yolu imaj dosyası olur (isAnonymous() false); capture
+    // bu bölgeleri imaj magic'inden tanıyıp dumpFileBacked kapalıyken de
+    // dump eder. İmaj silinir ya da taşınırsa tanınmaz ve sonraki
+    // checkpoint'lere restore sonrası yazmalar girmez.
+    bool mapImagePayloads;
+    
+    // hugePages bayraklı bölgeler yazılmadan önce MADV_HUGEPAGE ile
+    // işaretlenip MADV_POPULATE_WRITE ile önceden fault edilir; toplu yazma
+    // 4K fault'lar yerine hazır huge page'lere gider
+    bool restoreHugePages;
+    
     RestoreOptions()
         : restoreRegisters(true), restoreMemory(true),
           restoreFileDescriptors(false),  // Tehlikeli, dikkatli kullan
@@ -296,7 +488,14 @@ struct RestoreOptions {
           handleASLR(false),
           validateBeforeRestore(true),
           ignoreMemoryErrors(false),
-          ignoreFDErrors(true) {}
+          ignoreFDErrors(true),
+          discardZeroPages(false),
+          deltaRestore(false),
+          deltaUseSoftDirty(false),
+          lazyEagerBytes(1024 * 1024),
+          lazyPrefetch(true),
+          mapImagePayloads(false),
+          restoreHugePages(true) {}
     
     // Preset: Safe restore (validates everything, stops on error)
     static RestoreOptions safe() {
@@ -339,6 +538,15 @@ struct RestoreResult {
     int fdsRestored;
     int fdsFailed;
     
+    // Yazılan byte'lar; deltaRestore'da karşılaştırma sayaçları
+    uint64_t bytesWritten;
+    uint64_t pagesCompared;         // Canlı sayfası okunup karşılaştırılan
+    uint64_t pagesUnchanged;        // Karşılaştırmada eşit çıkan (yazılmadı)
+    uint64_t pagesClean;            // Soft-dirty temiz: okunmadan atlandı
+    uint64_t bytesDeferred;         // Lazy restore: talep üzerine yüklenecek
+    uint64_t bytesMapped;           // İmaj dosyasından eşlenen (kopyalanmadı)
+    uint64_t bytesPrefaulted;       // Huge page ile önceden fault edilen
+    
     // Warnings (non-fatal issues)
     std::vector<std::string> warnings;
     
@@ -349,7 +557,9 @@ struct RestoreResult {
     RestoreResult() : success(false), registersRestored(0),
                       memoryRegionsRestored(0), memoryRegionsFailed(0),
                       fdsRestored(0), fdsFailed(0),
-                      aslrDetected(false), aslrOffset(0) {}
+                      bytesWritten(0), pagesCompared(0),
+                      pagesUnchanged(0), pagesClean(0), bytesDeferred(0),
+                      bytesMapped(0), bytesPrefaulted(0), aslrDetected(false), aslrOffset(0) {}
 };
 
 } // namespace real_process
@@ -45,9 +45,11 @@ struct BatchReverseResult {
     
     // Timing
     std::chrono::milliseconds duration;
+    size_t workersUsed;             // Paralel geri almada thread sayısı
     
     BatchReverseResult() : allSucceeded(false), totalOperations(0),
-                          successCount(0), failCount(0), skippedCount(0) {}
+                          successCount(0), failCount(0), skippedCount(0),
+                          duration(0), workersUsed(0) {}
 };
 
 // ============================================================================
@@ -61,6 +63,7 @@ struct ReverseOptions {
     bool validateBeforeReverse;     // Tersine çevirmeden önce doğrula
     bool preserveTimestamps;        // Dosya zaman damgalarını koru
     bool reverseNewestFirst;        // En yeni işlemden başla (LIFO)
+    unsigned parallelism;           // Worker sayısı; 0: donanım thread sayısı, 1: sıralı
     
     // Filtering
     std::vector<FileOperationType> includeTypes;  // Sadece bu türleri geri al
@@ -74,7 +77,8 @@ struct ReverseOptions {
           backupDir("/tmp/checkpoint_backups"),
           validateBeforeReverse(true),
           preserveTimestamps(true),
-          reverseNewestFirst(true) {}
+          reverseNewestFirst(true),
+          parallelism(0) {}
     
     // Presets
     static ReverseOptions safe() {
@@ -111,9 +115,20 @@ public:
     // Single operation reverse
     ReverseResult reverseOperation(const FileOperation& op);
     
-    // Batch reverse - multiple operations
+    // Batch reverse - multiple operations. İşlemler path'e göre bir
+    // bağımlılık grafiğine dizilir; bağımsız zincirler parallelism kadar
+    // thread'de geri alınır, aynı path üzerindeki sıra (LIFO) korunur.
+    // stopOnError paralelde yeni işlem başlatmayı durdurur; o an çalışanlar
+    // tamamlanır.
     BatchReverseResult reverseOperations(const std::vector<FileOperation>& ops);
     
+    // orderedOps (geri alma sırasında) için her işlemin beklemesi gereken
+    // önceki işlemlerin indeksleri. Aynı path (ya da rename'in iki ucu)
+    // ardışık bağlanır; RENAME/MKDIR/RMDIR bir dizinin altındaki tüm
+    // path'lerle sıralanır.
+    static std::vector<std::vector<size_t>> buildDependencies(
+        const std::vector<FileOperation>& orderedOps);
+    
     // Reverse operations since checkpoint
     BatchReverseResult reverseToCheckpoint(const FileOperationLog& log, 
                                            uint64_t checkpointId);
@@ -167,16 +182,57 @@ private:
 // ============================================================================
 // Syscall Interceptor - ptrace tabanlı syscall yakalayıcı
 // ============================================================================
+// PtraceSyscall modunda tracee her syscall'ın girişinde ve çıkışında durur
+// (futex, epoll, read dahil); filtreleme durduktan sonra yapılır. Seccomp
+// modunda tracee'ye sadece etkin syscall'lar için SECCOMP_RET_TRACE dönen
+// bir BPF filtresi kurulur ve PTRACE_O_TRACESECCOMP ile yalnızca onlarda
+// durulur; diğer syscall'lar tracer'a hiç uğramaz.
+//
+// Seccomp filtresi kaldırılamaz ve tracer yokken SECCOMP_RET_TRACE
+// syscall'ı ENOSYS ile başarısız kılar. Bu yüzden filtre sadece launch()
+// ile başlatılan (ömrü boyunca izlenecek) process'lere exec'ten önce
+// kurulur; attach() edilen process'lerde PtraceSyscall moduna düşülür.
+// Filtre fork/clone ile çocuklara geçtiği için seccomp modunda tüm
+// çocuklar ve thread'ler de izlenir. Launch edilen tracee tracer ölürse
+// (PTRACE_O_EXITKILL) ya da detach edilirse öldürülür.
+//
+//   SyscallInterceptor interceptor;
+//   interceptor.setTraceMode(SyscallTraceMode::Seccomp);
+//   interceptor.launch("/usr/bin/app", {"app", "--flag"});
+//   interceptor.startInterception();
+//   interceptor.run();                  // process çıkana kadar
+//
+// PtraceSyscall modunda sadece ana thread izlenir (fork/clone takip
+// edilmez).
+//
+// Tracker bağlıysa write/pwrite64/writev/pwritev(2) girişinde hedef dosyanın
+// eski içeriği beforeWrite ile alınır, çıkışta dönen byte sayısıyla
+// afterWrite çağrılır (seccomp modunda çıkış için bir PTRACE_SYSCALL daha
+// yapılır). fd -> path eşlemesi tracee başına tutulan bir tabloda
+// open/dup/close çıkışlarıyla güncellenir; bilinmeyen fd'ler için bir kez
+// /proc/<pid>/fd readlink'i yapılır. Dosya pozisyonu ve O_APPEND önbellekli
+// /proc/<pid>/fdinfo fd'sinden pread ile okunur. Normal dosya olmayan
+// hedefler (pipe, tty, socket) kaydedilmez.
+enum class SyscallTraceMode {
+    PtraceSyscall,      // PTRACE_SYSCALL: her syscall'da iki durma
+    Seccomp             // seccomp-BPF: sadece izlenen syscall'larda durma
+};
+
 class SyscallInterceptor {
 public:
     SyscallInterceptor();
     ~SyscallInterceptor();
     
-    // Attach to process
+    // Attach to process (her zaman PtraceSyscall modunda izlenir)
     bool attach(pid_t pid);
     void detach();
     bool isAttached() const;
     
+    // Programı izlenen child olarak başlat (fork + exec). Seccomp modunda
+    // filtre exec'ten önce kurulur; filtre her zaman o anki intercept*
+    // ayarlarından üretilir. Dönüş: child pid, hata -1.
+    pid_t launch(const std::string& path, const std::vector<std::string>& args);
+    
     // Set tracker for automatic operation recording
     void setTracker(std::shared_ptr<FileOperationTracker> tracker);
     
@@ -185,6 +241,22 @@ public:
     void stopInterception();
     bool isIntercepting() const;
     
+    // Sıradaki ptrace durmasını bekle, izlenen syscall ise işle ve devam
+    // ettir. Process çıktıysa ya da attach değilse false.
+    bool processNextEvent();
+    // Process çıkana kadar processNextEvent
+    void run();
+    // Çıkan process'in waitpid durumu (çıkmadıysa -1)
+    int getExitStatus() const;
+    
+    // İzleme modu; launch/attach'tan önce ayarlanmalı
+    void setTraceMode(SyscallTraceMode mode);
+    SyscallTraceMode getTraceMode() const;
+    // Şu anki tracee'nin gerçekte izlendiği mod
+    SyscallTraceMode getActiveTraceMode() const;
+    // Kernel SECCOMP_RET_TRACE destekliyor mu (>= 4.14 ile sorgulanabilir)
+    static bool isSeccompTraceSupported();
+    
     // Syscall filtering
     void interceptWrite(bool enable);
     void interceptOpen(bool enable);
@@ -193,6 +265,14 @@ public:
     void interceptTruncate(bool enable);
     void interceptAll(bool enable);
     
+    // Etkin ayarlara göre izlenen syscall numaraları (seccomp filtresinin
+    // içeriği)
+    std::vector<long> getTrackedSyscalls() const;
+    
+    // İstatistik: toplam ptrace durması ve işlenen (izlenen) syscall sayısı
+    uint64_t getStopCount() const;
+    uint64_t getHandledSyscallCount() const;
+    
     // Manual syscall handling callback
     using SyscallCallback = std::function<void(pid_t pid, long syscallNum, 
                                                const std::vector<uint64_t>& args)>;
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "real_process/ptrace_controller.hpp"
+#include <signal.h>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Tracee Supervisor - tek event loop'tan çok sayıda tracee
+// ============================================================================
+// Her tracee PTRACE_SEIZE ile alınır ve kendi durum makinesinde ilerler:
+//
+//   Running --interrupt()--> Interrupting --(stop)--> Stopped
+//   Stopped --stop handler--> Dumping --(true)--> Running
+//   Stopped --resume()--> Running
+//   herhangi biri --(çıkış)--> Exited
+//
+// poll() tek bir epoll_wait'te bloklanır: SIGCHLD için signalfd (ptrace
+// durmaları) ve her tracee için pidfd (çıkış). Uyanınca sadece tracee'ler
+// waitpid(WNOHANG | __WALL) ile boşaltılır; ilgisiz çocuklar reap edilmez.
+// SIGCHLD kurucuyu çağıran thread'de bloklanır (yıkıcıda geri alınır);
+// process'in başka bir thread'i sinyali yutarsa olay en geç WAKE_SLICE_MS
+// içinde yine işlenir.
+//
+// ptrace istekleri sadece tracer thread'inden geçerli olduğundan tüm
+// metodlar supervisor'ı oluşturan thread'den çağrılmalıdır.
+class TraceeSupervisor {
+public:
+    enum class TraceeState {
+        Running,
+        Interrupting,       // PTRACE_INTERRUPT gönderildi, durma bekleniyor
+        Stopped,
+        Dumping,            // Stop handler çalışıyor
+        Exited
+    };
+
+    // Tracee durduğunda (Dumping durumunda) çağrılır; true dönerse tracee
+    // devam ettirilir, false ise Stopped kalır
+    using StopHandler = std::function<bool(pid_t pid)>;
+    using ExitHandler = std::function<void(pid_t pid, int status)>;
+
+    static constexpr int WAKE_SLICE_MS = 50;
+
+    TraceeSupervisor();
+    ~TraceeSupervisor();
+
+    TraceeSupervisor(const TraceeSupervisor&) = delete;
+    TraceeSupervisor& operator=(const TraceeSupervisor&) = delete;
+
+    // epoll / signalfd kurulamadıysa false
+    bool isValid() const { return m_epollFd >= 0 && m_signalFd >= 0; }
+
+    // ========================================================================
+    // Tracee yönetimi
+    // ========================================================================
+
+    // PTRACE_SEIZE; process durmaz (Running)
+    PtraceError add(pid_t pid);
+
+    // Durmuşsa hemen, çalışıyorsa interrupt edip durmasını bekleyerek detach;
+    // çıkmışsa sadece unutulur
+    PtraceError remove(pid_t pid, int timeoutMs = 1000);
+
+    // Running -> Interrupting
+    PtraceError interrupt(pid_t pid);
+    size_t interruptAll();
+
+    // Stopped -> Running; durma sırasında yakalanan sinyal geri verilir
+    PtraceError resume(pid_t pid);
+    size_t resumeAll();
+
+    void setStopHandler(StopHandler handler) { m_onStop = std::move(handler); }
+    void setExitHandler(ExitHandler handler) { m_onExit = std::move(handler); }
+
+    // ========================================================================
+    // Event loop
+    // ========================================================================
+
+    // Olay gelene ya da timeout dolana kadar bekle (-1: süresiz, 0: bekleme);
+    // işlenen durum değişikliği sayısı
+    size_t poll(int timeoutMs = -1);
+
+    // Interrupt edilen tüm tracee'ler durana (ya da çıkana) kadar poll et
+    bool waitForAllStopped(int timeoutMs = -1);
+
+    // ========================================================================
+    // Sorgular
+    // ========================================================================
+
+    bool contains(pid_t pid) const { return m_tracees.count(pid) != 0; }
+    // Bilinmeyen pid için Exited
+    TraceeState getState(pid_t pid) const;
+    std::vector<pid_t> getTracees() const;
+    size_t count(TraceeState state) const;
+
+private:
+    struct Tracee {
+        TraceeState state = TraceeState::Running;
+        int pidfd = -1;
+        int pendingSignal = 0;      // Durma sırasında yakalanan sinyal
+        bool detaching = false;     // remove bekliyor: stop handler çağrılmaz
+    };
+
+    std::unordered_map<pid_t, Tracee> m_tracees;
+    StopHandler m_onStop;
+    ExitHandler m_onExit;
+    int m_epollFd = -1;
+    int m_signalFd = -1;
+    sigset_t m_oldMask;
+
+    // Bekleyen wait olaylarını boşalt; işlenen olay sayısı
+    size_t drainEvents();
+    // Tek bir waitpid sonucu; durum değiştiyse true (handler çağırmaz)
+    bool handleStatus(pid_t pid, Tracee& tracee, int status);
+    void forget(pid_t pid, Tracee& tracee);
+};
+
+std::string traceeStateToString(TraceeSupervisor::TraceeState state);
+
+} // namespace real_process
+} // namespace checkpoint
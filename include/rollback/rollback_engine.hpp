@@ -2,6 +2,7 @@
 
 #include "core/types.hpp"
 #include "state/state_manager.hpp"
+#include "state/integrity_scrubber.hpp"
 #include "logger/operation_logger.hpp"
 #include <functional>
 #include <stack>
@@ -104,6 +105,43 @@ public:
     void setConfirmationCallback(std::function<bool(const RollbackPlan&)> callback);
     void setMaxUndoHistory(size_t count);
     
+    // Artımlı durum takibi: her değişiklik bir Update işlemi olarak loglanır
+    // ve önceki duruma göre blok XOR deltası olarak saklanır (tam kopya
+    // tutulmaz). RollbackStrategy::Incremental bu deltaları ters sırada
+    // uygular; zincir bilinen durumla uyuşmazsa tam restore'a düşülür.
+    Result<OperationId> recordStateChange(const std::string& description,
+                                          const StateData& newState,
+                                          CheckpointId relatedCheckpoint = 0);
+    
+    // Bu sayıdan fazla delta birikince en eskiler tam tabana katlanır
+    void setDeltaCompactionInterval(size_t interval);
+    size_t getDeltaMemoryUsage() const;
+    
+    // Checkpoint'ten seçmeli geri yükleme: merge(güncel, hedef) yeni durumu
+    // üretir; sonuç recordStateChange ile kaydedilir (Incremental geri
+    // alınabilir). merge nullopt dönerse durum değişmez.
+    using StateMerge = std::function<std::optional<StateData>(std::span<const uint8_t> current,
+                                                              std::span<const uint8_t> target)>;
+    Result<RollbackResult> mergeFromCheckpoint(CheckpointId targetId, const StateMerge& merge,
+                                               const std::string& description);
+    
+    // Tipli durumda yalnız adı verilen alanları checkpoint'teki değerlerine
+    // döndür; diğer alanlar güncel kalır
+    template<Reflected T>
+    Result<RollbackResult> rollbackFields(CheckpointId targetId,
+                                          const std::vector<std::string_view>& fields) {
+        return mergeFromCheckpoint(targetId,
+            [&fields](std::span<const uint8_t> current,
+                      std::span<const uint8_t> target) -> std::optional<StateData> {
+                auto state = schema::decode<T>(current);
+                auto saved = schema::decode<T>(target);
+                if (!state || !saved || !schema::copyFields(*state, *saved, fields)) {
+                    return std::nullopt;
+                }
+                return schema::encode(*state);
+            }, "Field rollback");
+    }
+    
     // File operation reverse execution support
     void setFileOperationTracker(std::shared_ptr<real_process::FileOperationTracker> tracker);
     void setReverseExecutionEnabled(bool enabled);
@@ -117,13 +155,17 @@ public:
     Duration getTotalRollbackTime() const;
 };
 
-// Otomatik geri alma yöneticisi
+// Otomatik geri alma yöneticisi. Bütünlük kontrolü her turda tüm
+// checkpoint'leri okumaz: IntegrityScrubber arka planda hız sınırıyla tarar,
+// monitör sadece bulduğu bozulmaları işler.
 class AutoRollbackManager {
 private:
     std::shared_ptr<RollbackEngine> m_engine;
     std::shared_ptr<StateManager> m_stateManager;
+    std::unique_ptr<IntegrityScrubber> m_scrubber;
     bool m_enabled;
     Duration m_checkInterval;
+    ErrorCallback m_errorCallback;
     std::thread m_monitorThread;
     std::atomic<bool> m_running;
     
@@ -141,7 +183,11 @@ public:
     void setCheckInterval(Duration interval);
     void setEnabled(bool enabled);
     
-    // Hata callback'i
+    // Tarama hızı / yeniden doğrulama aralığı buradan ayarlanır
+    IntegrityScrubber& getScrubber() { return *m_scrubber; }
+    
+    // Bozuk bulunan her checkpoint için (CheckpointCorrupted) çağrılır;
+    // start'tan önce ayarlanmalı
     void setErrorCallback(ErrorCallback callback);
 };
 
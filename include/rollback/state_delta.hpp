@@ -0,0 +1,102 @@
+#pragma once
+
+#include "core/types.hpp"
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace checkpoint {
+
+// ============================================================================
+// Block XOR Delta
+// ============================================================================
+// İki StateData arasındaki farkı blok düzeyinde saklar: yalnızca değişen
+// blokların XOR'u tutulur. Kısa olan taraf sıfırla uzatılmış kabul edilir.
+// XOR simetrik olduğu için aynı delta hem ileri (from -> to) hem geri
+// (to -> from) uygulanabilir; undo ve redo için ayrı kopya gerekmez.
+struct BlockDelta {
+    static constexpr uint32_t DEFAULT_BLOCK_SIZE = 4096;
+
+    uint32_t blockSize = DEFAULT_BLOCK_SIZE;
+    uint64_t fromSize = 0;
+    uint64_t toSize = 0;
+    std::vector<uint32_t> blocks;       // değişen blok indeksleri (artan)
+    std::vector<uint8_t> xorData;       // blokların XOR'u, art arda
+
+    static BlockDelta compute(const StateData& from, const StateData& to,
+                              uint32_t blockSize = DEFAULT_BLOCK_SIZE);
+    // SharedBuffer / mmap'li veri için kopyasız
+    static BlockDelta compute(const uint8_t* from, size_t fromSize,
+                              const uint8_t* to, size_t toSize,
+                              uint32_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    bool isIdentity() const { return blocks.empty() && fromSize == toSize; }
+
+    // state boyutu beklenen taraftan farklıysa dokunmadan false döner
+    bool apply(StateData& state) const;     // from -> to
+    bool revert(StateData& state) const;    // to -> from
+
+    size_t memoryUsage() const;
+
+    // blockSize u32 | fromSize u64 | toSize u64 | count u32 |
+    // blocks u32 x count | xorData
+    StateData serialize() const;
+    // Tutarsız / kesik veri için nullopt
+    static std::optional<BlockDelta> deserialize(const uint8_t* data, size_t size);
+
+private:
+    bool xorInto(StateData& state, uint64_t expectedSize, uint64_t resultSize) const;
+};
+
+// ============================================================================
+// Delta Chain - tam taban + işlem başına delta
+// ============================================================================
+// current her zaman en son kaydedilen durumdur. Bir işlemden önceki durum,
+// hangisi daha yakınsa tabandan ileri ya da current'tan geri delta
+// uygulanarak üretilir. Delta sayısı compaction aralığını aşınca en eski
+// deltalar tabana katlanır; o işlemlerin öncesine artık buradan dönülemez.
+class DeltaChain {
+public:
+    static constexpr size_t DEFAULT_COMPACTION_INTERVAL = 64;
+
+    explicit DeltaChain(uint32_t blockSize = BlockDelta::DEFAULT_BLOCK_SIZE);
+
+    // Zinciri verilen durumla yeniden başlat (tüm deltalar atılır)
+    void reset(const StateData& state);
+    bool isInitialized() const { return m_initialized; }
+
+    // opId'ler artan sırada gelmeli
+    void record(OperationId opId, const StateData& newState);
+    void record(OperationId opId, const uint8_t* data, size_t size);
+
+    // opId (ve sonrasındaki) işlemler uygulanmadan önceki durum
+    Result<StateData> stateBefore(OperationId opId) const;
+
+    const StateData& current() const { return m_current; }
+    const StateData& base() const { return m_base; }
+
+    void setCompactionInterval(size_t interval);
+    void compact();                 // tüm deltaları tabana katla
+
+    size_t deltaCount() const { return m_deltas.size(); }
+    size_t memoryUsage() const;
+
+private:
+    struct Entry {
+        OperationId opId;
+        BlockDelta delta;
+    };
+
+    uint32_t m_blockSize;
+    size_t m_compactionInterval;
+    bool m_initialized;
+    StateData m_base;
+    StateData m_current;
+    std::deque<Entry> m_deltas;
+    OperationId m_foldedUpTo;       // tabana katlanan son işlem (0 = yok)
+    size_t m_deltaBytes;
+
+    void foldOldest();
+};
+
+} // namespace checkpoint
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "state/state_manager.hpp"
+#include <map>
+#include <optional>
+
+namespace checkpoint {
+
+// Kalıcı checkpoint metadata index'i (StateManager ve ShardedStateManager)
+// Açılışta payload'lar okunmadan metadata buradan yüklenir; storage ile
+// uzlaştırma storedSize üzerinden yapılır.
+//   "CKIX" | version u32 | count u32 |
+//   [metaLen u32 | CheckpointMetadata | storedSize u64 | dataOffset u64 |
+//    lastVerified i64 (unix ms, v2)] x N |
+//   crc32c u32
+// v1 index'ler okunur; girdileri hiç doğrulanmamış sayılır.
+struct CheckpointIndexEntry {
+    CheckpointMetadata metadata;
+    uint64_t storedSize = 0;    // storage'daki serialize edilmiş kayıt boyutu
+    uint64_t dataOffset = 0;    // kayıt içinde state verisinin offset'i
+    Timestamp lastVerified{};   // storage'daki kaydın son doğrulandığı an (epoch: hiç)
+    Timestamp lastAccessed{};   // son okuma; kalıcı değil
+};
+
+CheckpointIndexEntry makeCheckpointIndexEntry(const Checkpoint& checkpoint, size_t storedSize);
+
+StateData serializeCheckpointIndex(const std::map<CheckpointId, CheckpointIndexEntry>& index);
+
+// Bozuk / uyumsuz index için nullopt
+std::optional<std::map<CheckpointId, CheckpointIndexEntry>> deserializeCheckpointIndex(const StateData& data);
+
+} // namespace checkpoint
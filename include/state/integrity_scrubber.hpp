@@ -0,0 +1,80 @@
+#pragma once
+
+#include "state/state_manager.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace checkpoint {
+
+// ============================================================================
+// Integrity Scrubber - storage'daki checkpoint'lerin arka planda doğrulanması
+// ============================================================================
+// Her adımda tek bir checkpoint StateManager::verifyStoredCheckpoint ile
+// doğrulanır; okunan byte kadar beklenerek bytesPerSecond sınırı korunur.
+// Sıra: yazıldığından ya da son doğrulamadan sonra okunduğundan beri
+// doğrulanmamışlar (en yeni etkinlik önce), sonra reverifyInterval'i geçmiş
+// olanlar (en eski doğrulama önce). lastVerified index'le birlikte kalıcıdır;
+// yeniden açılışta sadece vadesi gelenler taranır.
+class IntegrityScrubber {
+public:
+    using CorruptionCallback = std::function<void(CheckpointId id)>;
+
+    struct Stats {
+        uint64_t checkpointsVerified = 0;
+        uint64_t bytesVerified = 0;
+        uint64_t corruptionsFound = 0;
+    };
+
+    static constexpr uint64_t DEFAULT_BYTES_PER_SECOND = 32ull << 20;      // 32 MiB/s
+    static constexpr Duration DEFAULT_REVERIFY_INTERVAL = Duration(24 * 60 * 60 * 1000);
+    static constexpr Duration DEFAULT_IDLE_INTERVAL = Duration(1000);
+
+    explicit IntegrityScrubber(std::shared_ptr<StateManager> stateManager);
+    ~IntegrityScrubber();
+
+    IntegrityScrubber(const IntegrityScrubber&) = delete;
+    IntegrityScrubber& operator=(const IntegrityScrubber&) = delete;
+
+    void start();
+    void stop();
+    bool isRunning() const { return m_running; }
+
+    void setBytesPerSecond(uint64_t bytesPerSecond);    // 0: sınırsız
+    void setReverifyInterval(Duration interval);
+    void setIdleInterval(Duration interval);            // doğrulanacak yokken bekleme
+    // Tarama thread'inden çağrılır
+    void setCorruptionCallback(CorruptionCallback callback);
+
+    // Sıradaki checkpoint'i hemen (hız sınırı olmadan) doğrula; doğrulanacak
+    // checkpoint yoksa false
+    bool scrubNext();
+
+    // Son çağrıdan beri bozuk bulunan checkpoint'ler
+    std::vector<CheckpointId> takeCorrupted();
+    Stats getStats() const;
+
+private:
+    std::shared_ptr<StateManager> m_stateManager;
+    uint64_t m_bytesPerSecond = DEFAULT_BYTES_PER_SECOND;
+    Duration m_reverifyInterval = DEFAULT_REVERIFY_INTERVAL;
+    Duration m_idleInterval = DEFAULT_IDLE_INTERVAL;
+    CorruptionCallback m_onCorruption;
+    std::vector<CheckpointId> m_corrupted;
+    Stats m_stats;
+    bool m_stateDirty = false;      // flushIndex'e yazılmamış doğrulama sonuçları
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+    // Doğrulanan kaydın boyutu (doğrulanacak yoksa nullopt)
+    std::optional<uint64_t> verifyOne();
+    void scrubLoop();
+};
+
+} // namespace checkpoint
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "state/state_manager.hpp"
+#include <functional>
+
+namespace checkpoint {
+
+// ============================================================================
+// Sharded State Manager - çok thread'li, okuma ağırlıklı kullanım için
+// ============================================================================
+// StateManager tüm çağrıları tek mutex'te sıralar. Burada CheckpointId
+// hash'lenerek N shard'a dağıtılır; her shard'ın kendi reader-writer kilidi,
+// metadata index'i, handle cache'i ve storage'ı vardır. Okumalar shared
+// kilitle yapılır ve kopya almaz: getCheckpointHandle cache'teki değişmez
+// nesneyi paylaşır. Güncelleme yeni bir nesne yayınlar, silme sadece
+// shard'dan çıkarır; eldeki handle'lar geçerli kalır (RCU benzeri).
+//
+// Yazmalar ve cache kaçırmaları shard'ı storage çağrısı boyunca exclusive
+// kilitler; diğer shard'lar etkilenmez. Async yazıcı yoktur (bkz. StateManager).
+using StorageFactory = std::function<std::unique_ptr<IStorage>(size_t shard)>;
+
+class ShardedStateManager : public IStateManager {
+public:
+    static constexpr size_t DEFAULT_SHARD_COUNT = 16;
+    static constexpr size_t DEFAULT_CACHE_CAPACITY_PER_SHARD = 64;
+
+    // Shard başına MemoryStorage
+    explicit ShardedStateManager(size_t shardCount = DEFAULT_SHARD_COUNT);
+    // Shard başına FileStorage: <storagePath>/shard-NN
+    explicit ShardedStateManager(const std::filesystem::path& storagePath,
+                                 size_t shardCount = DEFAULT_SHARD_COUNT);
+    // Özel storage; shard sayısı değişirse mevcut kayıtlar bulunamaz
+    ShardedStateManager(StorageFactory factory, size_t shardCount);
+    ~ShardedStateManager();
+
+    ShardedStateManager(const ShardedStateManager&) = delete;
+    ShardedStateManager& operator=(const ShardedStateManager&) = delete;
+
+    // IStateManager implementasyonu
+    Result<CheckpointId> createCheckpoint(const std::string& name, const StateData& state) override;
+    Result<Checkpoint> getCheckpoint(CheckpointId id) override;     // kopya
+    Result<void> updateCheckpoint(CheckpointId id, const StateData& state) override;
+    Result<void> deleteCheckpoint(CheckpointId id) override;
+    std::vector<CheckpointMetadata> listCheckpoints() override;     // id sıralı
+
+    void setAutoSaveInterval(Duration interval) override;
+    void enableAutoSave(bool enable) override;
+
+    Result<StateData> getCurrentState() override;       // kopya
+    Result<CheckpointId> getLatestCheckpointId() override;
+
+    // Kopyasız okuma
+    Result<CheckpointHandle> getCheckpointHandle(CheckpointId id);
+    SharedBuffer getCurrentStateBuffer();
+
+    void setCurrentState(const StateData& state);
+    void setCurrentState(SharedBuffer state);
+
+    // Shard başına payload cache kapasitesi
+    void setCacheCapacity(size_t capacityPerShard);
+    size_t getCachedCheckpointCount() const;
+
+    // Tüm shard'ların metadata index'ini yaz (destructor'da da yapılır)
+    void flushIndex();
+
+    size_t getShardCount() const;
+    size_t shardOf(CheckpointId id) const;
+
+    size_t getCheckpointCount() const;
+    size_t getTotalStorageSize() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace checkpoint
@@ -1,14 +1,22 @@
 #pragma once
 
 #include "core/types.hpp"
+#include "core/shared_buffer.hpp"
+#include "core/schema.hpp"
 #include <string>
 #include <vector>
 #include <map>
 #include <any>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <span>
 
 namespace checkpoint {
 
+class IStorage;
+
 // Checkpoint metadata yapısı
 struct CheckpointMetadata {
     CheckpointId id;
@@ -21,16 +29,17 @@ struct CheckpointMetadata {
     uint32_t checksum;
     std::map<std::string, std::string> tags;
     
-    // Serileştirme
+    // Serileştirme (bozuk / kesik veride status Corrupted)
     StateData serialize() const;
-    static CheckpointMetadata deserialize(const StateData& data);
+    size_t serializedSize() const;
+    static CheckpointMetadata deserialize(std::span<const uint8_t> data);
 };
 
 // Tek bir checkpoint kaydı
 class Checkpoint {
 private:
     CheckpointMetadata m_metadata;
-    StateData m_data;
+    SharedBuffer m_data;            // kopyalanan Checkpoint'ler veriyi paylaşır
     std::vector<OperationId> m_relatedOperations;
     
 public:
@@ -47,7 +56,7 @@ public:
     const std::string& getDescription() const { return m_metadata.description; }
     Timestamp getCreatedAt() const { return m_metadata.createdAt; }
     CheckpointStatus getStatus() const { return m_metadata.status; }
-    const StateData& getData() const { return m_data; }
+    const SharedBuffer& getData() const { return m_data; }
     const CheckpointMetadata& getMetadata() const { return m_metadata; }
     const std::vector<OperationId>& getRelatedOperations() const { return m_relatedOperations; }
     
@@ -57,7 +66,9 @@ public:
     void setStatus(CheckpointStatus status);
     void setData(const StateData& data);
     void setData(StateData&& data);
+    void setData(SharedBuffer data);     // kopya yok
     void addTag(const std::string& key, const std::string& value);
+    void removeTag(const std::string& key);
     void addRelatedOperation(OperationId opId);
     
     // Doğrulama
@@ -67,8 +78,14 @@ public:
     // Serileştirme
     StateData serialize() const;
     static Checkpoint deserialize(const StateData& data);
+    // Veri kopyalanmaz: getData() data'nın bir slice'ıdır
+    static Checkpoint deserialize(const SharedBuffer& data);
 };
 
+// Paylaşılan, değişmez checkpoint - okuyucular kopya almadan tutar; silme
+// ya da güncelleme eldeki handle'ı geçersiz kılmaz
+using CheckpointHandle = std::shared_ptr<const Checkpoint>;
+
 // İşlem kaydı - log entry
 struct OperationRecord {
     OperationId id;
@@ -81,7 +98,7 @@ struct OperationRecord {
     bool canUndo;
     
     StateData serialize() const;
-    static OperationRecord deserialize(const StateData& data);
+    static OperationRecord deserialize(std::span<const uint8_t> data);
 };
 
 // Durum yöneticisi arayüzü
@@ -105,15 +122,39 @@ public:
     virtual Result<CheckpointId> getLatestCheckpointId() = 0;
 };
 
+// Async checkpoint kalıcı hale geldiğinde (ya da yazma başarısız olunca)
+// arka plan yazıcı thread'inden çağrılır
+using CheckpointCallback = std::function<void(const Result<CheckpointId>&)>;
+
+// Arka plan bütünlük taraması için checkpoint başına index durumu
+struct ScrubCandidate {
+    CheckpointId id = 0;
+    uint64_t storedSize = 0;
+    Timestamp modifiedAt{};
+    Timestamp lastVerified{};   // epoch: hiç doğrulanmadı
+    Timestamp lastAccessed{};   // epoch: bu oturumda okunmadı
+};
+
 // Durum yöneticisi implementasyonu
 class StateManager : public IStateManager {
 private:
     struct Impl;
     std::unique_ptr<Impl> m_impl;
     
+    template<typename T>
+    static Result<T> decodeTyped(std::span<const uint8_t> data) {
+        auto value = schema::decode<T>(data);
+        if (!value) {
+            return Result<T>::failure(ErrorCode::DeserializationError, "State does not match schema");
+        }
+        return Result<T>::success(std::move(*value));
+    }
+    
 public:
     StateManager();
     explicit StateManager(const std::filesystem::path& storagePath);
+    // Özel depolama (ör. ChunkStorage); mevcut checkpoint'ler yüklenir
+    explicit StateManager(std::unique_ptr<IStorage> storage);
     ~StateManager();
     
     // Move semantics
@@ -127,16 +168,110 @@ public:
     Result<void> deleteCheckpoint(CheckpointId id) override;
     std::vector<CheckpointMetadata> listCheckpoints() override;
     
+    // getCheckpoint'in kopyasız hali (cache'teki nesneyi paylaşır)
+    Result<CheckpointHandle> getCheckpointHandle(CheckpointId id);
+    
     void setAutoSaveInterval(Duration interval) override;
     void enableAutoSave(bool enable) override;
     
-    Result<StateData> getCurrentState() override;
+    // Auto-save güncel durum son kayıttan beri değişmediyse atlanır. Durum
+    // kilit altında sadece referansla alınır; delta hesabı kilitsiz, serialize
+    // ve yazma async yazıcıda yapılır. Delta modunda son auto-save'e göre
+    // değişen bloklar (BlockDelta) saklanır, okurken taban üzerine uygulanır;
+    // zincir MAX_AUTOSAVE_DELTA_CHAIN'e ulaşınca ya da delta durumun yarısını
+    // aşınca tam kayıt alınır. Taban silinir / güncellenirse ona bağlı delta
+    // kayıtlar önce tam veriyle yeniden yazılır.
+    enum class AutoSaveMode { Full, Delta };
+    static constexpr size_t MAX_AUTOSAVE_DELTA_CHAIN = 16;
+    void setAutoSaveMode(AutoSaveMode mode);
+    // Zamanlayıcıyı beklemeden auto-save; değişiklik yoksa nullopt
+    std::optional<CheckpointId> autoSaveNow();
+    
+    Result<StateData> getCurrentState() override;       // kopya
     Result<CheckpointId> getLatestCheckpointId() override;
     
+    // getCurrentState'in kopyasız hali
+    SharedBuffer getCurrentStateBuffer();
+    
+    // Checkpoint oluşturmadan güncel durumu değiştir (rollback / delta kaydı);
+    // SharedBuffer verilirse sadece referans değişir
+    void setCurrentState(const StateData& state);
+    void setCurrentState(SharedBuffer state);
+    
+    // Tipli durum: T alan alan kodlanır (core/schema.hpp); çözülemeyen veri
+    // DeserializationError döner
+    template<typename T>
+    Result<CheckpointId> createTypedCheckpoint(const std::string& name, const T& state) {
+        return createCheckpoint(name, schema::encode(state));
+    }
+    
+    template<typename T>
+    Result<T> getTypedCheckpoint(CheckpointId id) {
+        auto handle = getCheckpointHandle(id);
+        if (handle.isError()) {
+            return Result<T>::failure(handle.error, handle.message);
+        }
+        const SharedBuffer& data = (*handle.value)->getData();
+        return decodeTyped<T>(std::span<const uint8_t>(data.data(), data.size()));
+    }
+    
+    template<typename T>
+    void setCurrentTypedState(const T& state) {
+        setCurrentState(SharedBuffer(schema::encode(state)));
+    }
+    
+    template<typename T>
+    Result<T> getCurrentTypedState() {
+        SharedBuffer data = getCurrentStateBuffer();
+        return decodeTyped<T>(std::span<const uint8_t>(data.data(), data.size()));
+    }
+    
+    // Güncel durumla checkpoint arasında farklı olan alanlar
+    template<Reflected T>
+    Result<std::vector<std::string_view>> getChangedFields(CheckpointId id) {
+        auto saved = getTypedCheckpoint<T>(id);
+        if (saved.isError()) {
+            return Result<std::vector<std::string_view>>::failure(saved.error, saved.message);
+        }
+        auto current = getCurrentTypedState<T>();
+        if (current.isError()) {
+            return Result<std::vector<std::string_view>>::failure(current.error, current.message);
+        }
+        return Result<std::vector<std::string_view>>::success(
+            schema::changedFields(*saved.value, *current.value));
+    }
+    
+    // Async checkpoint: state taşınarak alınır, id hemen atanır ve checkpoint
+    // index'e/cache'e girer (getCheckpoint hemen çalışır, metadata durumu
+    // yazılana kadar Pending). Serialize + storage->save arka plan yazıcıda
+    // yapılır; future ve onDurable yazma bitince tamamlanır.
+    std::future<Result<CheckpointId>> createCheckpointAsync(const std::string& name,
+                                                            StateData&& state,
+                                                            CheckpointCallback onDurable = nullptr);
+    void waitForPendingWrites();
+    size_t getPendingWriteCount() const;
+    
     // Ek özellikler
     Result<void> saveToFile(CheckpointId id, const std::filesystem::path& path);
     Result<Checkpoint> loadFromFile(const std::filesystem::path& path);
     
+    // Payload cache'i - metadata her zaman bellekte, veriler ilk
+    // getCheckpoint'te storage'dan okunur ve en fazla capacity tanesi tutulur
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 128;
+    void setCacheCapacity(size_t capacity);
+    size_t getCachedCheckpointCount() const;
+    
+    // Metadata index'ini storage'a yaz (destructor'da da yapılır)
+    void flushIndex();
+    
+    // Bütünlük taraması: henüz yazılmamış async ve Corrupted checkpoint'ler
+    // listelenmez.
+    // verifyStoredCheckpoint kaydı storage'dan cache'e almadan okuyup veri
+    // checksum'ını index'teki değerle karşılaştırır; sonuç index'e (lastVerified
+    // ya da Corrupted durumu) işlenir. Kayıt okunamazsa hata, bozuksa false.
+    std::vector<ScrubCandidate> getScrubCandidates() const;
+    Result<bool> verifyStoredCheckpoint(CheckpointId id);
+    
     // İstatistikler
     size_t getCheckpointCount() const;
     size_t getTotalStorageSize() const;
@@ -1,10 +1,17 @@
 #pragma once
 
 #include "core/types.hpp"
+#include "core/io_engine.hpp"
 #include "state/state_manager.hpp"
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <list>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace checkpoint {
 
@@ -20,6 +27,41 @@ public:
     virtual std::vector<CheckpointId> listAll() = 0;
     virtual size_t getSize(CheckpointId id) = 0;
     virtual size_t getTotalSize() = 0;
+    
+    // Opsiyonel kalıcı metadata index'i - StateManager açılışta payload'ları
+    // okumamak için kullanır. Desteklemeyen depolamalar hata döner.
+    virtual Result<void> saveIndex(const StateData& index) {
+        (void)index;
+        return Result<void>::failure(ErrorCode::IOError, "Index not supported");
+    }
+    virtual Result<StateData> loadIndex() {
+        return Result<StateData>::failure(ErrorCode::IOError, "Index not supported");
+    }
+    
+    // Birden fazla kaydı tek seferde yaz. Varsayılan her biri için save();
+    // log tabanlı depolamalar tek bir sync ile commit eder. Başarısızlıkta
+    // kayıtların bir kısmı yazılmış olabilir.
+    virtual Result<void> saveBatch(const std::vector<std::pair<CheckpointId, const StateData*>>& items) {
+        for (const auto& [id, data] : items) {
+            auto result = save(id, *data);
+            if (result.isError()) return result;
+        }
+        return Result<void>::success();
+    }
+    
+    // Kopyasız yol: bellek içi depolamalar buffer'ı paylaşır, dosya
+    // depolaması büyük kayıtları mmap'ler. Varsayılan load()/save()'e
+    // düşer (load sonucu taşınır, save için bir kopya alınır).
+    virtual Result<SharedBuffer> loadShared(CheckpointId id) {
+        auto loaded = load(id);
+        if (loaded.isError()) {
+            return Result<SharedBuffer>::failure(loaded.error, loaded.message);
+        }
+        return Result<SharedBuffer>::success(SharedBuffer(std::move(*loaded.value)));
+    }
+    virtual Result<void> saveShared(CheckpointId id, const SharedBuffer& data) {
+        return save(id, data.toVector());
+    }
 };
 
 // Dosya tabanlı depolama
@@ -27,31 +69,53 @@ class FileStorage : public IStorage {
 private:
     std::filesystem::path m_basePath;
     std::string m_extension;
+    IoEngineOptions m_ioOptions;
+    std::unique_ptr<IoEngine> m_io;             // ilk I/O'da kurulur
+    std::unique_ptr<AsyncFileWriter> m_writer;
+    size_t m_mmapThreshold = DEFAULT_MMAP_THRESHOLD;
     
     std::filesystem::path getFilePath(CheckpointId id) const;
+    IoEngine& ioEngine();
+    Result<void> writeFile(CheckpointId id, const uint8_t* data, size_t size);
     
 public:
+    // Bu boyuttan büyük kayıtlar loadShared'de okunmak yerine mmap'lenir
+    static constexpr size_t DEFAULT_MMAP_THRESHOLD = 256 * 1024;
+    
     explicit FileStorage(const std::filesystem::path& basePath, 
                         const std::string& extension = ".chkpt");
     
+    // Kayıt geçici dosyaya yazılıp rename edilir: eski dosyayı mmap'lemiş
+    // okuyucular eski içeriği görmeye devam eder
     Result<void> save(CheckpointId id, const StateData& data) override;
     Result<StateData> load(CheckpointId id) override;
+    Result<SharedBuffer> loadShared(CheckpointId id) override;
+    Result<void> saveShared(CheckpointId id, const SharedBuffer& data) override;
     Result<void> remove(CheckpointId id) override;
     bool exists(CheckpointId id) override;
     std::vector<CheckpointId> listAll() override;
     size_t getSize(CheckpointId id) override;
     size_t getTotalSize() override;
+    Result<void> saveIndex(const StateData& index) override;
+    Result<StateData> loadIndex() override;
     
     // Dosya spesifik
     std::filesystem::path getBasePath() const { return m_basePath; }
     void setBasePath(const std::filesystem::path& path);
     Result<void> cleanup(Duration olderThan);
+    
+    // Checkpoint dosyaları IoEngine ile parça parça, paralel yazılır/okunur
+    void setIoOptions(const IoEngineOptions& options);
+    IoBackend getIoBackend() { return ioEngine().backend(); }
+    
+    // 0: loadShared her zaman okur
+    void setMmapThreshold(size_t bytes) { m_mmapThreshold = bytes; }
 };
 
 // Bellek içi depolama (test ve geçici kullanım için)
 class MemoryStorage : public IStorage {
 private:
-    std::map<CheckpointId, StateData> m_storage;
+    std::map<CheckpointId, SharedBuffer> m_storage;    // load'lar paylaşır
     size_t m_maxSize;
     
 public:
@@ -59,6 +123,8 @@ public:
     
     Result<void> save(CheckpointId id, const StateData& data) override;
     Result<StateData> load(CheckpointId id) override;
+    Result<SharedBuffer> loadShared(CheckpointId id) override;
+    Result<void> saveShared(CheckpointId id, const SharedBuffer& data) override;
     Result<void> remove(CheckpointId id) override;
     bool exists(CheckpointId id) override;
     std::vector<CheckpointId> listAll() override;
@@ -69,27 +135,309 @@ public:
     void setMaxSize(size_t size) { m_maxSize = size; }
 };
 
-// Hibrit depolama (önce bellek, sonra dosya)
+// Katmanlı depolama: bellek (byte bütçeli LRU) -> opsiyonel sıkıştırılmış
+// bellek katmanı (LZ4) -> dosya.
+// save kaydı bellek katmanına dirty olarak koyar, arka plan thread'i dosyaya
+// yazar (write-back). Bütçe aşılınca en az kullanılan temiz kayıtlar
+// sıkıştırılmış katmana (kapalıysa / sıkışmıyorsa tamamen) düşürülür; dirty
+// kayıtlar yazılana kadar bellekte kalır ve dirty byte'lar bütçeyi aşarsa save
+// yazıcıyı bekler. Dosyadan ya da sıkıştırılmış katmandan okunan kayıt belleğe
+// terfi eder; sık kullanılanlar böylece kendiliğinden bellekte kalır. Bellek
+// bütçesinden büyük kayıtlar doğrudan dosyaya yazılır.
 class HybridStorage : public IStorage {
-private:
-    std::unique_ptr<MemoryStorage> m_memoryStorage;
-    std::unique_ptr<FileStorage> m_fileStorage;
-    size_t m_memoryThreshold;
-    
 public:
+    struct Stats {
+        size_t memoryEntries;
+        uint64_t memoryBytes;
+        uint64_t dirtyBytes;        // henüz dosyaya yazılmamış
+        size_t compressedEntries;
+        uint64_t compressedBytes;
+        uint64_t memoryHits;
+        uint64_t compressedHits;
+        uint64_t fileLoads;
+        uint64_t evictions;         // bellek katmanından çıkarılan
+        uint64_t writeBacks;
+    };
+    
     HybridStorage(const std::filesystem::path& basePath, 
-                  size_t memoryThreshold = 10 * 1024 * 1024);
+                  size_t memoryThreshold = 10 * 1024 * 1024,
+                  size_t compressedBudget = 0);        // 0: sıkıştırılmış katman kapalı
+    ~HybridStorage() override;
+    
+    HybridStorage(const HybridStorage&) = delete;
+    HybridStorage& operator=(const HybridStorage&) = delete;
     
     Result<void> save(CheckpointId id, const StateData& data) override;
     Result<StateData> load(CheckpointId id) override;
+    Result<SharedBuffer> loadShared(CheckpointId id) override;
+    Result<void> saveShared(CheckpointId id, const SharedBuffer& data) override;
     Result<void> remove(CheckpointId id) override;
     bool exists(CheckpointId id) override;
     std::vector<CheckpointId> listAll() override;
     size_t getSize(CheckpointId id) override;
     size_t getTotalSize() override;
     
+    Result<void> saveIndex(const StateData& index) override;
+    Result<StateData> loadIndex() override;
+    
+    void setCompressedBudget(size_t bytes);
+    
+    // Tüm dirty kayıtlar dosyaya yazılana kadar bekle (destructor'da da yapılır)
     void flushToFile();
+    // Kaydı önceden belleğe al
     void loadToMemory(CheckpointId id);
+    
+    Stats getStats() const;
+    
+private:
+    struct Entry {
+        SharedBuffer data;          // bellek katmanında
+        SharedBuffer compressed;    // sıkıştırılmış katmanda (CompressedFrame)
+        size_t size = 0;
+        bool dirty = false;
+        uint64_t version = 0;       // her save'de artar; write-back eşleştirmesi
+        std::list<CheckpointId>::iterator lruPos;
+    };
+    
+    std::unique_ptr<FileStorage> m_fileStorage;
+    size_t m_memoryBudget;
+    size_t m_compressedBudget;
+    
+    // Sıra: m_fileMutex -> m_mutex
+    mutable std::mutex m_mutex;
+    std::mutex m_fileMutex;
+    std::condition_variable m_flushCv;      // yazıcıyı uyandırır
+    std::condition_variable m_flushedCv;    // dirty byte azaldı / kuyruk boşaldı
+    std::unordered_map<CheckpointId, Entry> m_entries;
+    std::list<CheckpointId> m_memoryLru;        // baş: en son kullanılan
+    std::list<CheckpointId> m_compressedLru;
+    std::deque<CheckpointId> m_flushQueue;
+    bool m_flushing = false;
+    bool m_stop = false;
+    uint64_t m_nextVersion = 0;
+    Stats m_stats{};
+    std::thread m_flusher;
+    
+    Result<void> store(CheckpointId id, SharedBuffer data);
+    Result<SharedBuffer> fetch(CheckpointId id);
+    void eraseEntry(std::unordered_map<CheckpointId, Entry>::iterator it);
+    bool promote(Entry& entry, CheckpointId id);
+    void evict();
+    void flushLoop();
+};
+
+// İçerik adresli chunk depolama
+// StateData içerik tanımlı (gear rolling hash) chunk'lara bölünür; her farklı
+// chunk bir kez saklanır, checkpoint başına sadece chunk listesi (manifest)
+// yazılır. Ardışık checkpoint'lerde değişmeyen bölgeler aynı chunk'lara
+// düştüğü için save çoğunlukla hash'le-ve-atla işlemidir.
+//
+//   <base>/manifests/<id>.manifest
+//   <base>/chunks/<xx>/<hash>-<crc>.chunk
+//
+// Referans sayıları açılışta manifest'lerden yeniden kurulur; bir chunk'ı
+// kullanan son checkpoint silindiğinde chunk dosyası da silinir.
+class ChunkStorage : public IStorage {
+public:
+    static constexpr size_t MIN_CHUNK_SIZE = 2 * 1024;
+    static constexpr size_t AVG_CHUNK_SIZE = 8 * 1024;      // 2'nin kuvveti olmalı
+    static constexpr size_t MAX_CHUNK_SIZE = 64 * 1024;
+    
+    struct ChunkRef {
+        uint64_t hash;          // XXH64
+        uint32_t crc;           // CRC32C - okuma sırasında doğrulanır
+        uint32_t size;
+        
+        bool operator==(const ChunkRef& other) const {
+            return hash == other.hash && crc == other.crc && size == other.size;
+        }
+    };
+    
+    struct Stats {
+        size_t checkpoints;
+        size_t uniqueChunks;
+        uint64_t logicalBytes;  // checkpoint'lerin toplam boyutu
+        uint64_t storedBytes;   // diskteki farklı chunk'ların toplamı
+    };
+    
+    explicit ChunkStorage(const std::filesystem::path& basePath);
+    
+    Result<void> save(CheckpointId id, const StateData& data) override;
+    Result<StateData> load(CheckpointId id) override;
+    Result<void> remove(CheckpointId id) override;
+    bool exists(CheckpointId id) override;
+    std::vector<CheckpointId> listAll() override;
+    size_t getSize(CheckpointId id) override;
+    size_t getTotalSize() override;
+    Result<void> saveIndex(const StateData& index) override;
+    Result<StateData> loadIndex() override;
+    
+    // data'nın chunk sınırları (test ve analiz için)
+    static std::vector<size_t> chunkBoundaries(const uint8_t* data, size_t size);
+    
+    // Hiçbir manifest'in referans etmediği chunk dosyalarını sil
+    // (yarıda kalmış save'lerden). Dönüş: silinen chunk sayısı.
+    size_t collectGarbage();
+    
+    Stats getStats() const;
+    std::filesystem::path getBasePath() const { return m_basePath; }
+    
+private:
+    struct ChunkRefHash {
+        size_t operator()(const ChunkRef& ref) const { return static_cast<size_t>(ref.hash); }
+    };
+    
+    struct Manifest {
+        uint64_t totalSize;
+        std::vector<ChunkRef> chunks;
+    };
+    
+    std::filesystem::path m_basePath;
+    std::map<CheckpointId, Manifest> m_manifests;
+    std::unordered_map<ChunkRef, uint32_t, ChunkRefHash> m_refCounts;
+    uint64_t m_storedBytes;
+    
+    std::filesystem::path manifestPath(CheckpointId id) const;
+    std::filesystem::path chunkPath(const ChunkRef& ref) const;
+    
+    bool writeFileAtomic(const std::filesystem::path& path, const void* data, size_t size);
+    static std::optional<Manifest> readManifest(const std::filesystem::path& path);
+    
+    void addRefs(const Manifest& manifest);
+    void dropRefs(const Manifest& manifest);
+};
+
+// Segmentli write-ahead log depolama
+// Tüm kayıtlar sadece sona eklenir; her kayıt CRC32C ile korunur:
+//
+//   <base>/wal/<segment:08>.wal
+//   kayıt: "CKWL" | type u8 | pad[3] | id u64 | len u32 | crc32c u32 | payload
+//   type: PUT (payload = checkpoint verisi) / DEL (tombstone, payload yok)
+//
+// Group commit: eşzamanlı save/remove çağrıları ortak bir tampona eklenir;
+// o an commit eden yoksa çağıranlardan biri lider olup biriken her şeyi tek
+// write + tek fdatasync ile yazar, diğerleri commit'i bekler. Çağrı
+// döndüğünde kayıt diskte kalıcıdır.
+//
+// Açılışta segmentler baştan taranır; son segmentin yarım kalan kuyruğu
+// (çökme) kesilir. Silinen/üzerine yazılan kayıtlar compaction ile atılır:
+// sadece en eski kapalı segment, canlı oranı eşiğin altındaysa, canlı
+// kayıtları aktif segmente taşınarak silinir. En eskiden başlandığı için
+// tombstone'lar eski PUT'ları asla geri getirmez.
+struct LogStorageOptions {
+    size_t segmentSize = 64 * 1024 * 1024;
+    double compactionThreshold = 0.5;       // canlı/toplam oranı bunun altındaysa
+    bool backgroundCompaction = true;
+    Duration compactionInterval = Duration(30000);
+    bool syncOnCommit = true;               // false: sadece testler / benchmark
+};
+
+class LogStorage : public IStorage {
+public:
+    struct Stats {
+        size_t segments;
+        size_t records;             // canlı checkpoint sayısı
+        uint64_t liveBytes;         // canlı kayıtların diskteki boyutu
+        uint64_t logBytes;          // tüm segmentlerin toplam boyutu
+        uint64_t commits;           // yapılan group commit (sync) sayısı
+        uint64_t committedRecords;
+        uint64_t compactedSegments;
+        uint64_t recoveredRecords;  // açılışta okunan geçerli kayıt
+        uint64_t truncatedBytes;    // açılışta kesilen bozuk kuyruk
+    };
+    
+    explicit LogStorage(const std::filesystem::path& basePath,
+                        const LogStorageOptions& options = LogStorageOptions());
+    ~LogStorage() override;
+    
+    LogStorage(const LogStorage&) = delete;
+    LogStorage& operator=(const LogStorage&) = delete;
+    
+    Result<void> save(CheckpointId id, const StateData& data) override;
+    Result<void> saveBatch(const std::vector<std::pair<CheckpointId, const StateData*>>& items) override;
+    Result<StateData> load(CheckpointId id) override;
+    Result<void> remove(CheckpointId id) override;
+    bool exists(CheckpointId id) override;
+    std::vector<CheckpointId> listAll() override;
+    size_t getSize(CheckpointId id) override;
+    size_t getTotalSize() override;
+    Result<void> saveIndex(const StateData& index) override;
+    Result<StateData> loadIndex() override;
+    
+    // Eşik altındaki en eski segmentleri sıkıştır; dönüş: silinen segment
+    size_t compact();
+    
+    Stats getStats() const;
+    std::filesystem::path getBasePath() const { return m_basePath; }
+    
+private:
+    struct SegmentFile;
+    
+    struct Location {
+        uint32_t segment;
+        uint64_t offset;        // kayıt başlangıcı (header)
+        uint32_t size;          // payload boyutu
+        
+        bool operator==(const Location& other) const {
+            return segment == other.segment && offset == other.offset && size == other.size;
+        }
+    };
+    
+    struct Waiter {
+        Result<void> result = Result<void>::success();
+        bool done = false;
+    };
+    
+    struct PendingOp {
+        uint8_t type;
+        CheckpointId id;
+        uint64_t bufferOffset;
+        uint32_t size;
+        Waiter* waiter;
+        bool conditional;       // compaction: sadece index hâlâ expected'i gösteriyorsa
+        Location expected;
+    };
+    
+    struct Append {
+        uint8_t type;
+        CheckpointId id;
+        const StateData* data;
+        bool conditional;
+        Location expected;
+    };
+    
+    std::filesystem::path m_basePath;
+    std::filesystem::path m_walPath;
+    LogStorageOptions m_options;
+    
+    mutable std::mutex m_mutex;
+    std::condition_variable m_commitCv;
+    std::map<uint32_t, std::shared_ptr<SegmentFile>> m_segments;
+    std::shared_ptr<SegmentFile> m_active;
+    std::map<CheckpointId, Location> m_index;
+    uint64_t m_payloadBytes;
+    
+    // Group commit durumu (m_mutex altında)
+    std::vector<uint8_t> m_pendingBuffer;
+    std::vector<PendingOp> m_pendingOps;
+    bool m_committing;
+    Stats m_stats;
+    
+    // Arka plan compaction
+    std::mutex m_compactMutex;
+    std::thread m_compactThread;
+    std::condition_variable m_compactCv;
+    bool m_stopping;
+    
+    Result<void> submit(const std::vector<Append>& appends);
+    void commitPending(std::unique_lock<std::mutex>& lock);
+    void applyOp(const PendingOp& op, uint32_t segment, uint64_t base);
+    Result<void> openSegment(uint32_t number);
+    void recover();
+    void recoverSegment(SegmentFile& segment, bool isLast);
+    bool compactOldest();
+    void compactionLoop();
+    Result<StateData> readRecord(const SegmentFile& segment, const Location& loc) const;
 };
 
 } // namespace checkpoint
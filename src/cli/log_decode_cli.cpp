@@ -0,0 +1,53 @@
+/**
+ * Binary Log Decoder
+ * 
+ * BinaryLogOutput'un yazdığı CKLG dosyalarını text ya da JSON'a çevirir.
+ * 
+ * Kullanım:
+ *   checkpoint_log_decode [--json] <file> [file...]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "logger/binary_log.hpp"
+
+using namespace checkpoint;
+
+int main(int argc, char* argv[]) {
+    bool json = false;
+    std::vector<std::string> files;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            std::cout << "Kullanım: " << argv[0] << " [--json] <file> [file...]\n";
+            return 0;
+        } else if (arg == "--json") {
+            json = true;
+        } else {
+            files.push_back(arg);
+        }
+    }
+    
+    if (files.empty()) {
+        std::cerr << "Kullanım: " << argv[0] << " [--json] <file> [file...]\n";
+        return 1;
+    }
+    
+    TextLogFormatter textFormatter;
+    JsonLogFormatter jsonFormatter;
+    ILogFormatter& formatter = json ? static_cast<ILogFormatter&>(jsonFormatter) : textFormatter;
+    
+    int status = 0;
+    for (const auto& file : files) {
+        std::string error;
+        BinaryLogReader::render(file, formatter, std::cout, &error);
+        if (!error.empty()) {
+            std::cerr << file << ": " << error << "\n";
+            status = 1;
+        }
+    }
+    return status;
+}
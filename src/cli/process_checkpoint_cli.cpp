@@ -7,6 +7,8 @@
  *   process_checkpoint_cli [--help]
  *   process_checkpoint_cli --pid <pid>    # Belirli process ile başla
  *   process_checkpoint_cli --list         # Process listesi göster
+ *   process_checkpoint_cli --daemon <policy>          # Etkileşimsiz, zamanlanmış snapshot'lar
+ *   process_checkpoint_cli --control <socket> <istek> # Çalışan daemon'a tek istek gönder
  * 
  * Komutlar:
  *   snapshot <pid> [name]    - Process'in snapshot'ını al
@@ -17,6 +19,10 @@
  *   diff <id1> <id2>         - İki checkpoint'i karşılaştır
  *   export <id> <file>       - Checkpoint'i dosyaya kaydet
  *   import <file>            - Checkpoint'i dosyadan yükle
+ *   migrate <pid> <host> <port> - Process'i canlı olarak başka host'a taşı
+ *   receive <port> <target_pid> [bind_addr] - Gelen migration'ı target'a restore et
+ *   group <root_pid> <file>  - Process ağacının grup checkpoint'ini al
+ *   stats [reset|recent|openmetrics [file]] - Aşama süreleri ve sayaçlar
  *   help                     - Yardım göster
  *   quit                     - Çıkış
  */
@@ -30,12 +36,20 @@
 #include <filesystem>
 #include <chrono>
 #include <csignal>
+#include <cerrno>
 #include <cstring>
+#include <fstream>
 #include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include "real_process/real_process_types.hpp"
 #include "real_process/proc_reader.hpp"
 #include "real_process/ptrace_controller.hpp"
+#include "real_process/live_migration.hpp"
+#include "real_process/group_checkpoint.hpp"
+#include "real_process/checkpoint_daemon.hpp"
+#include "core/metrics.hpp"
 
 using namespace checkpoint::real_process;
 namespace fs = std::filesystem;
@@ -158,6 +172,7 @@ void cmdHelp() {
     std::cout << "    show <id>                   Checkpoint detaylarını göster\n";
     std::cout << "    delete <id>                 Checkpoint'i sil\n";
     std::cout << "    diff <id1> <id2>            İki checkpoint'i karşılaştır\n";
+    std::cout << "    group <root_pid> <file>     Process ağacını tek grup imajına al\n";
     std::cout << "\n";
     
     std::cout << Color::CYAN << "  Dosya İşlemleri:\n" << Color::RESET;
@@ -165,7 +180,17 @@ void cmdHelp() {
     std::cout << "    import <file>               Dosyadan checkpoint yükle\n";
     std::cout << "\n";
     
+    std::cout << Color::CYAN << "  Migration:\n" << Color::RESET;
+    std::cout << "    migrate <pid> <host> <port> Pre-copy ile process'i karşı host'a taşı\n";
+    std::cout << "    receive <port> <pid> [addr] Migration bekle, target'a restore et\n";
+    std::cout << "                                (addr varsayılanı 127.0.0.1)\n";
+    std::cout << "\n";
+    
     std::cout << Color::CYAN << "  Diğer:\n" << Color::RESET;
+    std::cout << "    stats                       İşlem / aşama süreleri ve sayaçlar\n";
+    std::cout << "    stats recent                Son işlemlerin izleri\n";
+    std::cout << "    stats openmetrics [file]    OpenMetrics formatında dışa aktar\n";
+    std::cout << "    stats reset                 Ölçümleri sıfırla\n";
     std::cout << "    verbose [on|off]            Detaylı çıktı aç/kapa\n";
     std::cout << "    clear                       Ekranı temizle\n";
     std::cout << "    help                        Bu yardımı göster\n";
@@ -388,6 +413,7 @@ void cmdSnapshot(pid_t pid, const std::string& name) {
     options.dumpHeap = true;
     options.dumpStack = true;
     options.dumpAnonymous = true;
+    options.hashPages = true;       // diff eşit alt ağaçları atlar
     
     auto checkpoint = g_state.checkpointer.createCheckpoint(pid, name, options);
     
@@ -598,6 +624,8 @@ void cmdImport(const std::string& filepath) {
         return;
     }
     
+    // Hash'ler dosyada yok: bir kez hesaplanır, sonraki diff'ler kullanır
+    checkpoint->computePageHashes();
     checkpoint->checkpointId = g_state.nextCheckpointId++;
     g_state.checkpoints[checkpoint->checkpointId] = *checkpoint;
     
@@ -645,6 +673,7 @@ void cmdDiff(uint64_t id1, uint64_t id2) {
         std::cout << "  Eklenen region:   " << diff.addedRegions.size() << "\n";
         std::cout << "  Silinen region:   " << diff.removedRegions.size() << "\n";
         std::cout << "  Değişen region:   " << diff.modifiedRegions.size() << "\n";
+        std::cout << "  Değişen aralık:   " << diff.changedRanges.size() << "\n";
         std::cout << "  Toplam değişiklik: " << formatSize(diff.totalBytesChanged) << "\n";
     } else {
         std::cout << "  Değişiklik yok\n";
@@ -661,6 +690,149 @@ void cmdDiff(uint64_t id1, uint64_t id2) {
     std::cout << "\n";
 }
 
+// ============================================================================
+// Command: migrate - Live migration (sender)
+// ============================================================================
+void cmdMigrate(pid_t pid, const std::string& host, uint16_t port) {
+    printInfo("Migrating PID " + std::to_string(pid) + " to " + host + ":" + std::to_string(port) + "...");
+    
+    MigrationSender sender;
+    auto result = sender.migrate(pid, host, port);
+    
+    for (const auto& round : result.rounds) {
+        std::cout << "  " << (round.final ? "stop-copy" : "round " + std::to_string(round.round))
+                  << ": " << formatSize(round.dirtyBytes) << " dirty, "
+                  << formatSize(round.wireBytes) << " sent, "
+                  << std::fixed << std::setprecision(1) << round.nanos / 1e6 << " ms\n";
+    }
+    
+    if (!result.success) {
+        printError("Migration başarısız: " + result.errorMessage);
+        return;
+    }
+    printSuccess("Migration tamamlandı");
+    std::cout << "  Downtime: " << std::fixed << std::setprecision(1)
+              << result.downtimeNanos / 1e6 << " ms"
+              << (result.converged ? "" : " (kirli küme yakınsamadı)") << "\n";
+    std::cout << "  Kaynak process durdurulmuş halde bekliyor (PID: " << pid << ")\n\n";
+}
+
+// ============================================================================
+// Command: receive - Live migration (receiver)
+// ============================================================================
+void cmdReceive(uint16_t port, pid_t targetPid, const std::string& bindAddress) {
+    MigrationReceiver receiver;
+    if (!receiver.listen(port, bindAddress)) {
+        printError(receiver.getLastError());
+        return;
+    }
+    printInfo(bindAddress + ":" + std::to_string(receiver.boundPort()) + " üzerinde migration bekleniyor...");
+    
+    if (!receiver.accept(targetPid)) {
+        printError("Migration alınamadı: " + receiver.getLastError());
+        return;
+    }
+    
+    // Alınan durum checkpoint listesine de eklenir
+    auto checkpoint = receiver.checkpoint();
+    checkpoint.checkpointId = g_state.nextCheckpointId++;
+    g_state.checkpoints[checkpoint.checkpointId] = checkpoint;
+    
+    printSuccess("Migration alındı ve PID " + std::to_string(targetPid) + " içine restore edildi");
+    std::cout << "  Turlar:   " << receiver.roundsReceived() << "\n";
+    std::cout << "  Memory:   " << formatSize(checkpoint.dumpedMemorySize()) << "\n";
+    std::cout << "  ID:       " << checkpoint.checkpointId << "\n\n";
+}
+
+// ============================================================================
+// Command: group - Process tree checkpoint
+// ============================================================================
+void cmdGroup(pid_t rootPid, const std::string& filepath) {
+    printInfo("Checkpointing process tree of PID " + std::to_string(rootPid) + "...");
+    
+    ProcessGroupCheckpointer group;
+    auto image = group.checkpointTree(rootPid);
+    if (!image) {
+        printError("Grup checkpoint başarısız: " + group.getLastError());
+        return;
+    }
+    
+    std::string error;
+    if (!image->save(filepath, &error)) {
+        printError(error);
+        return;
+    }
+    
+    printSuccess("Grup checkpoint kaydedildi: " + filepath);
+    for (const auto& member : image->members) {
+        std::cout << "  [" << member.pid << "] " << std::left << std::setw(20) << member.name
+                  << std::right << " ppid " << member.ppid << "\n";
+    }
+    std::cout << "  Dondurma: " << (image->freezeMode == GroupFreezeMode::Cgroup ? "cgroup" : "signal")
+              << ", " << std::fixed << std::setprecision(1) << image->freezeNanos / 1e6 << " ms\n";
+    std::cout << "  Memory:   " << formatSize(image->dumpedBytes) << " dump, "
+              << formatSize(image->pages->storedBytes()) << " saklandı ("
+              << image->frameHits << " paylaşılan frame, " << image->contentHits << " aynı içerik)\n\n";
+}
+
+// ============================================================================
+// Command: stats - Operation metrics
+// ============================================================================
+void cmdStats(const std::vector<std::string>& args) {
+    auto& metrics = g_state.checkpointer.getMetricsRegistry();
+    std::string mode = args.empty() ? "" : args[0];
+    
+    if (mode == "reset") {
+        metrics.reset();
+        printSuccess("Ölçümler sıfırlandı");
+        return;
+    }
+    
+    if (mode == "openmetrics") {
+        std::string text = metrics.toOpenMetrics();
+        if (args.size() < 2) {
+            std::cout << text;
+            return;
+        }
+        std::ofstream out(args[1]);
+        if (!out || !(out << text)) {
+            printError("Dosyaya yazılamadı: " + args[1]);
+            return;
+        }
+        printSuccess("Metrikler kaydedildi: " + args[1]);
+        return;
+    }
+    
+    if (mode == "recent") {
+        auto traces = metrics.getRecentTraces();
+        if (traces.empty()) {
+            printInfo("Henüz ölçülmüş işlem yok");
+            return;
+        }
+        for (const auto& trace : traces) {
+            std::cout << "  " << (trace.success ? Color::GREEN : Color::RED) << "●"
+                      << Color::RESET << " " << trace.toString() << "\n";
+        }
+        std::cout << "\n";
+        return;
+    }
+    
+    if (!mode.empty()) {
+        printError("Kullanım: stats [reset|recent|openmetrics [file]]");
+        return;
+    }
+    
+    std::string table = metrics.toText();
+    if (table.empty()) {
+        printInfo("Henüz ölçülmüş işlem yok");
+        return;
+    }
+    std::cout << "\n" << Color::BOLD << "İşlem Ölçümleri" << Color::RESET
+              << Color::DIM << "  (aşama: ortalama, maks, toplam payı)" << Color::RESET << "\n";
+    std::cout << std::string(60, '=') << "\n";
+    std::cout << table << "\n";
+}
+
 // ============================================================================
 // Process command
 // ============================================================================
@@ -758,6 +930,31 @@ void processCommand(const std::string& input) {
             }
             cmdDiff(std::stoull(tokens[1]), std::stoull(tokens[2]));
         }
+        else if (cmd == "migrate") {
+            if (tokens.size() < 4) {
+                printError("Kullanım: migrate <pid> <host> <port>");
+                return;
+            }
+            cmdMigrate(std::stoi(tokens[1]), tokens[2], static_cast<uint16_t>(std::stoi(tokens[3])));
+        }
+        else if (cmd == "receive") {
+            if (tokens.size() < 3) {
+                printError("Kullanım: receive <port> <target_pid> [bind_addr]");
+                return;
+            }
+            cmdReceive(static_cast<uint16_t>(std::stoi(tokens[1])), std::stoi(tokens[2]),
+                       tokens.size() > 3 ? tokens[3] : "127.0.0.1");
+        }
+        else if (cmd == "group") {
+            if (tokens.size() < 3) {
+                printError("Kullanım: group <root_pid> <file>");
+                return;
+            }
+            cmdGroup(std::stoi(tokens[1]), tokens[2]);
+        }
+        else if (cmd == "stats") {
+            cmdStats(std::vector<std::string>(tokens.begin() + 1, tokens.end()));
+        }
         else if (cmd == "verbose") {
             if (tokens.size() > 1) {
                 g_state.verbose = (tokens[1] == "on" || tokens[1] == "1");
@@ -774,6 +971,99 @@ void processCommand(const std::string& input) {
     }
 }
 
+// ============================================================================
+// Daemon Mode - policy dosyasıyla etkileşimsiz çalışma
+// ============================================================================
+int runDaemon(const std::string& policyPath) {
+    std::string error;
+    auto policy = DaemonPolicy::load(policyPath, &error);
+    if (!policy) {
+        printError("Policy okunamadı: " + error);
+        return 1;
+    }
+    
+    // SIGINT / SIGTERM daemon thread'lerinde değil burada beklenir
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    
+    CheckpointDaemon daemon(*policy);
+    if (!daemon.start()) {
+        printError("Daemon başlatılamadı: " + daemon.getLastError());
+        return 1;
+    }
+    
+    printInfo("Daemon çalışıyor: " + std::to_string(policy->jobs.size()) + " iş, " +
+              std::to_string(policy->workers) + " worker, dizin " + policy->directory);
+    if (!policy->controlSocket.empty()) {
+        printInfo("Kontrol socket'i: " + policy->controlSocket);
+    }
+    
+    int sig = 0;
+    sigwait(&signals, &sig);
+    printInfo(std::string("Durduruluyor (") + strsignal(sig) + ")");
+    daemon.stop();
+    
+    auto stats = daemon.stats();
+    std::cout << "  Snapshots:   " << stats.snapshots << " (" << stats.failures << " failed, "
+              << stats.dropped << " dropped)\n";
+    std::cout << "  Written:     " << formatSize(stats.bytesWritten) << "\n";
+    std::cout << "  Removed:     " << stats.filesRemoved << " images\n";
+    return 0;
+}
+
+// Çalışan daemon'a tek istek: yanıt OK / ERR satırına kadar yazdırılır
+int runControl(const std::string& socketPath, const std::string& request) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr.sun_path)) {
+        printError("Socket yolu çok uzun");
+        return 1;
+    }
+    std::memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        printError("Bağlanılamadı: " + socketPath + ": " + std::strerror(errno));
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+    
+    std::string line = request + "\n";
+    if (send(fd, line.data(), line.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(line.size())) {
+        printError("İstek gönderilemedi");
+        close(fd);
+        return 1;
+    }
+    
+    std::string buffer;
+    char chunk[4096];
+    int status = 1;
+    bool done = false;
+    while (!done) {
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        buffer.append(chunk, static_cast<size_t>(n));
+        
+        size_t nl;
+        while ((nl = buffer.find('\n')) != std::string::npos) {
+            std::string reply = buffer.substr(0, nl);
+            buffer.erase(0, nl + 1);
+            std::cout << reply << "\n";
+            if (reply.rfind("OK", 0) == 0 || reply.rfind("ERR", 0) == 0) {
+                status = reply.rfind("OK", 0) == 0 ? 0 : 1;
+                done = true;
+                break;
+            }
+        }
+    }
+    close(fd);
+    return status;
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -787,9 +1077,23 @@ int main(int argc, char* argv[]) {
             std::cout << "  --help, -h           Yardım göster\n";
             std::cout << "  --pid <pid>          Belirli bir PID ile başla\n";
             std::cout << "  --dir <directory>    Checkpoint dizini\n";
+            std::cout << "  --daemon <policy>    Policy dosyasındaki işleri zamanla (etkileşimsiz)\n";
+            std::cout << "  --control <socket> <istek...>\n";
+            std::cout << "                       Çalışan daemon'a istek gönder (status, jobs,\n";
+            std::cout << "                       snapshot <job>, list, restore <file> <pid>, metrics)\n";
             std::cout << "\n";
             return 0;
         }
+        else if (arg == "--daemon" && i + 1 < argc) {
+            return runDaemon(argv[i + 1]);
+        }
+        else if (arg == "--control" && i + 2 < argc) {
+            std::string request;
+            for (int j = i + 2; j < argc; ++j) {
+                request += (j > i + 2 ? " " : "") + std::string(argv[j]);
+            }
+            return runControl(argv[i + 1], request);
+        }
         else if ((arg == "--pid" || arg == "-p") && i + 1 < argc) {
             // Başlangıçta bu PID'nin bilgisini göster
             pid_t pid = std::stoi(argv[++i]);
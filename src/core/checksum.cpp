@@ -0,0 +1,258 @@
+#include "core/checksum.hpp"
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+namespace checkpoint {
+
+namespace {
+
+constexpr uint32_t CRC32C_POLY = 0x82F63B78;    // Castagnoli, reflected
+
+// ==================== Slicing-by-8 ====================
+
+struct Crc32cTables {
+    uint32_t t[8][256];
+
+    Crc32cTables() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int k = 0; k < 8; ++k) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+            }
+            t[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (int s = 1; s < 8; ++s) {
+                t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+const Crc32cTables& tables() {
+    static const Crc32cTables instance;
+    return instance;
+}
+
+uint32_t crc32cSlicing8(const uint8_t* p, size_t size, uint32_t crc) {
+    const auto& t = tables().t;
+
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        word ^= crc;    // little-endian: düşük 4 byte crc ile karışır
+        crc = t[7][word & 0xFF] ^
+              t[6][(word >> 8) & 0xFF] ^
+              t[5][(word >> 16) & 0xFF] ^
+              t[4][(word >> 24) & 0xFF] ^
+              t[3][(word >> 32) & 0xFF] ^
+              t[2][(word >> 40) & 0xFF] ^
+              t[1][(word >> 48) & 0xFF] ^
+              t[0][word >> 56];
+        p += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    }
+    return crc;
+}
+
+// ==================== Donanım yolları ====================
+
+#if defined(__x86_64__)
+
+__attribute__((target("sse4.2")))
+uint32_t crc32cHardware(const uint8_t* p, size_t size, uint32_t crc) {
+    uint64_t c = crc;
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        c = _mm_crc32_u64(c, word);
+        p += 8;
+        size -= 8;
+    }
+    uint32_t c32 = static_cast<uint32_t>(c);
+    while (size--) {
+        c32 = _mm_crc32_u8(c32, *p++);
+    }
+    return c32;
+}
+
+bool hardwareAvailable() {
+    return __builtin_cpu_supports("sse4.2");
+}
+
+constexpr const char* HARDWARE_NAME = "sse4.2";
+
+#elif defined(__aarch64__)
+
+__attribute__((target("+crc")))
+uint32_t crc32cHardware(const uint8_t* p, size_t size, uint32_t crc) {
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        crc = __crc32cd(crc, word);
+        p += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = __crc32cb(crc, *p++);
+    }
+    return crc;
+}
+
+bool hardwareAvailable() {
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+}
+
+constexpr const char* HARDWARE_NAME = "armv8-crc";
+
+#else
+
+uint32_t crc32cHardware(const uint8_t* p, size_t size, uint32_t crc) {
+    return crc32cSlicing8(p, size, crc);
+}
+
+bool hardwareAvailable() {
+    return false;
+}
+
+constexpr const char* HARDWARE_NAME = "slicing-by-8";
+
+#endif
+
+using Crc32cFn = uint32_t (*)(const uint8_t*, size_t, uint32_t);
+
+struct Dispatch {
+    Crc32cFn fn;
+    const char* name;
+
+    Dispatch() {
+        if (hardwareAvailable()) {
+            fn = crc32cHardware;
+            name = HARDWARE_NAME;
+        } else {
+            fn = crc32cSlicing8;
+            name = "slicing-by-8";
+        }
+    }
+};
+
+const Dispatch& dispatch() {
+    static const Dispatch instance;
+    return instance;
+}
+
+} // namespace
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc) {
+    return ~dispatch().fn(static_cast<const uint8_t*>(data), size, ~crc);
+}
+
+uint32_t crc32cSoftware(const void* data, size_t size, uint32_t crc) {
+    return ~crc32cSlicing8(static_cast<const uint8_t*>(data), size, ~crc);
+}
+
+const char* crc32cImplementation() {
+    return dispatch().name;
+}
+
+// ==================== XXH64 ====================
+
+namespace {
+
+constexpr uint64_t XXH_PRIME1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH_PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH_PRIME3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH_PRIME4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH_PRIME5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME2;
+    acc = rotl64(acc, 31);
+    return acc * XXH_PRIME1;
+}
+
+inline uint64_t xxhMerge(uint64_t acc, uint64_t val) {
+    acc ^= xxhRound(0, val);
+    return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+} // namespace
+
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        uint64_t v1 = seed + XXH_PRIME1 + XXH_PRIME2;
+        uint64_t v2 = seed + XXH_PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME1;
+        do {
+            v1 = xxhRound(v1, read64(p));
+            v2 = xxhRound(v2, read64(p + 8));
+            v3 = xxhRound(v3, read64(p + 16));
+            v4 = xxhRound(v4, read64(p + 24));
+            p += 32;
+        } while (p + 32 <= end);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = xxhMerge(h, v1);
+        h = xxhMerge(h, v2);
+        h = xxhMerge(h, v3);
+        h = xxhMerge(h, v4);
+    } else {
+        h = seed + XXH_PRIME5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxhRound(0, read64(p));
+        h = rotl64(h, 27) * XXH_PRIME1 + XXH_PRIME4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * XXH_PRIME1;
+        h = rotl64(h, 23) * XXH_PRIME2 + XXH_PRIME3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * XXH_PRIME5;
+        h = rotl64(h, 11) * XXH_PRIME1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME2;
+    h ^= h >> 29;
+    h *= XXH_PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+} // namespace checkpoint
@@ -0,0 +1,457 @@
+#include "core/codec.hpp"
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace checkpoint {
+
+std::string codecTypeToString(CodecType type) {
+    switch (type) {
+        case CodecType::None: return "none";
+        case CodecType::Rle:  return "rle";
+        case CodecType::Lz4:  return "lz4";
+        default:              return "unknown";
+    }
+}
+
+std::shared_ptr<ICodec> createCodec(CodecType type) {
+    // Codec'ler durumsuz - her serializer için yeni nesne ayırma
+    static const auto none = std::make_shared<NoneCodec>();
+    static const auto rle = std::make_shared<RleCodec>();
+    static const auto lz4 = std::make_shared<Lz4Codec>();
+    
+    switch (type) {
+        case CodecType::None: return none;
+        case CodecType::Rle:  return rle;
+        case CodecType::Lz4:  return lz4;
+        default:              return nullptr;
+    }
+}
+
+// ==================== NoneCodec ====================
+
+size_t NoneCodec::compress(const uint8_t* src, size_t srcSize,
+                           uint8_t* dst, size_t dstCapacity) const {
+    if (srcSize > dstCapacity) return 0;
+    std::memcpy(dst, src, srcSize);
+    return srcSize;
+}
+
+bool NoneCodec::decompress(const uint8_t* src, size_t srcSize,
+                           uint8_t* dst, size_t dstSize) const {
+    if (srcSize != dstSize) return false;
+    std::memcpy(dst, src, srcSize);
+    return true;
+}
+
+// ==================== RleCodec ====================
+
+size_t RleCodec::compress(const uint8_t* src, size_t srcSize,
+                          uint8_t* dst, size_t dstCapacity) const {
+    size_t out = 0;
+    size_t i = 0;
+    while (i < srcSize) {
+        uint8_t current = src[i];
+        size_t count = 1;
+        while (i + count < srcSize && src[i + count] == current && count < 255) {
+            count++;
+        }
+
+        if (count >= 4 || current == 0xFF) {
+            if (out + 3 > dstCapacity) return 0;
+            dst[out++] = 0xFF;  // Escape character
+            dst[out++] = static_cast<uint8_t>(count);
+            dst[out++] = current;
+        } else {
+            if (out + count > dstCapacity) return 0;
+            std::memset(dst + out, current, count);
+            out += count;
+        }
+        i += count;
+    }
+    return out;
+}
+
+bool RleCodec::decompress(const uint8_t* src, size_t srcSize,
+                          uint8_t* dst, size_t dstSize) const {
+    size_t out = 0;
+    size_t i = 0;
+    while (i < srcSize) {
+        if (src[i] == 0xFF && i + 2 < srcSize) {
+            size_t count = src[i + 1];
+            if (out + count > dstSize) return false;
+            std::memset(dst + out, src[i + 2], count);
+            out += count;
+            i += 3;
+        } else {
+            if (out >= dstSize) return false;
+            dst[out++] = src[i++];
+        }
+    }
+    return out == dstSize;
+}
+
+// ==================== Lz4Codec ====================
+
+namespace {
+
+constexpr int LZ4_HASH_LOG = 12;
+constexpr size_t LZ4_MIN_MATCH = 4;
+constexpr size_t LZ4_LAST_LITERALS = 5;    // Son 5 byte daima literal
+constexpr size_t LZ4_MF_LIMIT = 12;        // Son 12 byte'ta match başlamaz
+constexpr size_t LZ4_MAX_OFFSET = 65535;
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t lz4Hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_LOG);
+}
+
+// 15'ten büyük uzunluklar 255'lik ek byte'larla yazılır
+inline uint8_t* writeLength(uint8_t* op, size_t len) {
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = static_cast<uint8_t>(len);
+    return op;
+}
+
+} // namespace
+
+size_t Lz4Codec::compress(const uint8_t* src, size_t srcSize,
+                          uint8_t* dst, size_t dstCapacity) const {
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* const iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const oend = dst + dstCapacity;
+
+    auto emit = [&](const uint8_t* literalEnd, size_t offset, size_t matchLen) -> bool {
+        size_t litLen = static_cast<size_t>(literalEnd - anchor);
+        size_t need = 1 + litLen / 255 + 1 + litLen + 2 + (matchLen / 255) + 1;
+        if (static_cast<size_t>(oend - op) < need) return false;
+
+        uint8_t* token = op++;
+        if (litLen >= 15) {
+            *token = 15 << 4;
+            op = writeLength(op, litLen - 15);
+        } else {
+            *token = static_cast<uint8_t>(litLen << 4);
+        }
+        std::memcpy(op, anchor, litLen);
+        op += litLen;
+
+        if (matchLen == 0) return true;   // Son sekans: sadece literal
+
+        *op++ = static_cast<uint8_t>(offset);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+        size_t ml = matchLen - LZ4_MIN_MATCH;
+        if (ml >= 15) {
+            *token |= 15;
+            op = writeLength(op, ml - 15);
+        } else {
+            *token |= static_cast<uint8_t>(ml);
+        }
+        return true;
+    };
+
+    if (srcSize > LZ4_MF_LIMIT) {
+        uint32_t table[1 << LZ4_HASH_LOG] = {};
+        const uint8_t* const mflimit = iend - LZ4_MF_LIMIT;
+        const uint8_t* const matchlimit = iend - LZ4_LAST_LITERALS;
+
+        ip++;
+        while (ip < mflimit) {
+            // Sıkışmayan veride adımı büyüt (rastgele sayfalarda hız için)
+            size_t step = 1 + (static_cast<size_t>(ip - anchor) >> 6);
+
+            uint32_t seq = read32(ip);
+            uint32_t h = lz4Hash(seq);
+            const uint8_t* ref = src + table[h];
+            table[h] = static_cast<uint32_t>(ip - src);
+
+            if (ref >= ip || static_cast<size_t>(ip - ref) > LZ4_MAX_OFFSET || read32(ref) != seq) {
+                ip += step;
+                continue;
+            }
+
+            // Geriye doğru genişlet
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            }
+
+            const uint8_t* mp = ip + LZ4_MIN_MATCH;
+            const uint8_t* rp = ref + LZ4_MIN_MATCH;
+            while (mp < matchlimit && *mp == *rp) {
+                mp++;
+                rp++;
+            }
+
+            size_t matchLen = static_cast<size_t>(mp - ip);
+            if (!emit(ip, static_cast<size_t>(ip - ref), matchLen)) return 0;
+
+            ip = mp;
+            anchor = ip;
+            if (ip < mflimit) {
+                table[lz4Hash(read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - src);
+            }
+        }
+    }
+
+    if (!emit(iend, 0, 0)) return 0;
+    return static_cast<size_t>(op - dst);
+}
+
+bool Lz4Codec::decompress(const uint8_t* src, size_t srcSize,
+                          uint8_t* dst, size_t dstSize) const {
+    const uint8_t* ip = src;
+    const uint8_t* const iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const oend = dst + dstSize;
+
+    auto readLength = [&](size_t& len) -> bool {
+        uint8_t b;
+        do {
+            if (ip >= iend) return false;
+            b = *ip++;
+            len += b;
+        } while (b == 255);
+        return true;
+    };
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        size_t litLen = token >> 4;
+        if (litLen == 15 && !readLength(litLen)) return false;
+        if (litLen > static_cast<size_t>(iend - ip) || litLen > static_cast<size_t>(oend - op)) {
+            return false;
+        }
+        std::memcpy(op, ip, litLen);
+        ip += litLen;
+        op += litLen;
+
+        if (ip == iend) break;   // Son sekans
+
+        if (iend - ip < 2) return false;
+        size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+
+        size_t matchLen = token & 15;
+        if (matchLen == 15 && !readLength(matchLen)) return false;
+        matchLen += LZ4_MIN_MATCH;
+        if (matchLen > static_cast<size_t>(oend - op)) return false;
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLen) {
+            std::memcpy(op, match, matchLen);
+            op += matchLen;
+        } else {
+            // Örtüşen kopya (tekrar eden desen)
+            for (size_t i = 0; i < matchLen; ++i) {
+                *op++ = match[i];
+            }
+        }
+    }
+
+    return op == oend;
+}
+
+// ==================== CompressedFrame ====================
+
+namespace {
+
+constexpr char FRAME_MAGIC[4] = {'C', 'K', 'Z', '1'};
+constexpr size_t MAX_CHUNK_SIZE = 1u << 30;
+
+template<typename T>
+void storePod(uint8_t* p, T value) {
+    std::memcpy(p, &value, sizeof(T));
+}
+
+template<typename T>
+T loadPod(const uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+unsigned resolveThreads(unsigned threads, size_t work) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, work)));
+}
+
+// [0, count) işlerini threads worker'a dağıt
+template<typename Fn>
+void parallelFor(size_t count, unsigned threads, Fn&& fn) {
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++) fn(i);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+} // namespace
+
+StateData CompressedFrame::compress(const ICodec& codec, const uint8_t* data, size_t size,
+                                    size_t chunkSize, unsigned threads) {
+    chunkSize = std::clamp<size_t>(chunkSize, 1, MAX_CHUNK_SIZE);
+    size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+
+    std::vector<StateData> chunks(chunkCount);
+    std::vector<uint32_t> sizes(chunkCount);
+
+    parallelFor(chunkCount, resolveThreads(threads, chunkCount), [&](size_t i) {
+        const uint8_t* src = data + i * chunkSize;
+        size_t len = std::min(chunkSize, size - i * chunkSize);
+
+        StateData& out = chunks[i];
+        out.resize(codec.maxCompressedSize(len));
+        size_t n = codec.compress(src, len, out.data(), out.size());
+        if (n == 0 || n >= len) {
+            // Sıkışmadı - ham sakla
+            out.assign(src, src + len);
+            sizes[i] = static_cast<uint32_t>(len) | RAW_CHUNK_FLAG;
+        } else {
+            out.resize(n);
+            sizes[i] = static_cast<uint32_t>(n);
+        }
+    });
+
+    size_t total = HEADER_SIZE + chunkCount * sizeof(uint32_t);
+    for (const auto& chunk : chunks) total += chunk.size();
+
+    StateData frame(total);
+    uint8_t* p = frame.data();
+    std::memcpy(p, FRAME_MAGIC, sizeof(FRAME_MAGIC));
+    p[4] = static_cast<uint8_t>(codec.type());
+    p[5] = p[6] = p[7] = 0;
+    storePod<uint32_t>(p + 8, static_cast<uint32_t>(chunkSize));
+    storePod<uint64_t>(p + 12, static_cast<uint64_t>(size));
+    p += HEADER_SIZE;
+
+    for (uint32_t s : sizes) {
+        storePod(p, s);
+        p += sizeof(uint32_t);
+    }
+    for (const auto& chunk : chunks) {
+        std::memcpy(p, chunk.data(), chunk.size());
+        p += chunk.size();
+    }
+
+    return frame;
+}
+
+bool CompressedFrame::isFrame(const uint8_t* data, size_t size) {
+    return size >= HEADER_SIZE && std::memcmp(data, FRAME_MAGIC, sizeof(FRAME_MAGIC)) == 0;
+}
+
+bool CompressedFrame::open(const uint8_t* frame, size_t size) {
+    m_frame = nullptr;
+    m_offsets.clear();
+    m_sizes.clear();
+
+    if (!isFrame(frame, size)) return false;
+
+    m_codecType = static_cast<CodecType>(frame[4]);
+    m_codec = createCodec(m_codecType);
+    m_chunkSize = loadPod<uint32_t>(frame + 8);
+    m_originalSize = loadPod<uint64_t>(frame + 12);
+    if (!m_codec || m_chunkSize == 0 || m_chunkSize > MAX_CHUNK_SIZE) return false;
+
+    uint64_t chunkCount = (m_originalSize + m_chunkSize - 1) / m_chunkSize;
+    if (chunkCount > (size - HEADER_SIZE) / sizeof(uint32_t)) return false;
+
+    m_offsets.resize(chunkCount);
+    m_sizes.resize(chunkCount);
+    uint64_t offset = HEADER_SIZE + chunkCount * sizeof(uint32_t);
+    for (uint64_t i = 0; i < chunkCount; ++i) {
+        m_sizes[i] = loadPod<uint32_t>(frame + HEADER_SIZE + i * sizeof(uint32_t));
+        m_offsets[i] = offset;
+        offset += m_sizes[i] & ~RAW_CHUNK_FLAG;
+    }
+    if (offset > size) {
+        m_offsets.clear();
+        m_sizes.clear();
+        return false;
+    }
+
+    m_frame = frame;
+    return true;
+}
+
+size_t CompressedFrame::chunkLength(size_t index) const {
+    return static_cast<size_t>(std::min<uint64_t>(m_chunkSize,
+                                                  m_originalSize - index * m_chunkSize));
+}
+
+bool CompressedFrame::decompressChunk(size_t index, uint8_t* out) const {
+    const uint8_t* src = m_frame + m_offsets[index];
+    uint32_t stored = m_sizes[index];
+    size_t len = chunkLength(index);
+
+    if (stored & RAW_CHUNK_FLAG) {
+        if ((stored & ~RAW_CHUNK_FLAG) != len) return false;
+        std::memcpy(out, src, len);
+        return true;
+    }
+    return m_codec->decompress(src, stored, out, len);
+}
+
+bool CompressedFrame::read(uint64_t offset, uint8_t* out, size_t length) const {
+    if (!m_frame || offset > m_originalSize || length > m_originalSize - offset) {
+        return false;
+    }
+
+    StateData scratch;
+    while (length > 0) {
+        size_t index = static_cast<size_t>(offset / m_chunkSize);
+        uint64_t inChunk = offset - static_cast<uint64_t>(index) * m_chunkSize;
+        size_t len = chunkLength(index);
+        size_t take = std::min<size_t>(length, len - inChunk);
+
+        if (inChunk == 0 && take == len) {
+            if (!decompressChunk(index, out)) return false;
+        } else {
+            scratch.resize(len);
+            if (!decompressChunk(index, scratch.data())) return false;
+            std::memcpy(out, scratch.data() + inChunk, take);
+        }
+
+        out += take;
+        offset += take;
+        length -= take;
+    }
+    return true;
+}
+
+bool CompressedFrame::decompressAll(uint8_t* out, unsigned threads) const {
+    if (!m_frame) return false;
+
+    std::atomic<bool> ok{true};
+    parallelFor(chunkCount(), resolveThreads(threads, chunkCount()), [&](size_t i) {
+        if (!decompressChunk(i, out + i * m_chunkSize)) ok = false;
+    });
+    return ok;
+}
+
+} // namespace checkpoint
@@ -0,0 +1,596 @@
+#include "core/io_engine.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace checkpoint {
+
+const char* ioBackendName(IoBackend backend) {
+    return backend == IoBackend::IoUring ? "io_uring" : "blocking";
+}
+
+// ==================== io_uring ring ====================
+// liburing'e bağımlı olmamak için ring doğrudan syscall + mmap ile kurulur.
+// SQ tail ve CQ head sadece bu thread tarafından yazılır; kernel'in
+// yazdığı SQ head / CQ tail acquire ile okunur.
+
+namespace {
+
+int ioUringSetup(unsigned entries, io_uring_params* params) {
+#ifdef __NR_io_uring_setup
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+#else
+    (void)entries; (void)params;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+#ifdef __NR_io_uring_enter
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete,
+                                      flags, nullptr, 0));
+#else
+    (void)fd; (void)toSubmit; (void)minComplete; (void)flags;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+template<typename T>
+T* ringField(void* base, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+} // namespace
+
+struct IoEngine::Ring {
+    int fd = -1;
+    void* sqMap = MAP_FAILED;
+    size_t sqMapSize = 0;
+    void* cqMap = MAP_FAILED;
+    size_t cqMapSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    unsigned unsubmitted = 0;
+
+    ~Ring() {
+        if (sqes != MAP_FAILED) ::munmap(sqes, sqesSize);
+        if (cqMap != MAP_FAILED && cqMap != sqMap) ::munmap(cqMap, cqMapSize);
+        if (sqMap != MAP_FAILED) ::munmap(sqMap, sqMapSize);
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool init(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        fd = ioUringSetup(entries, &params);
+        if (fd < 0) return false;
+
+        // IORING_OP_READ/WRITE 5.6 ile geldi; aynı sürümün feature bitiyle
+        // eski kernel'leri ayıkla
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) return false;
+
+        sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            sqMapSize = cqMapSize = std::max(sqMapSize, cqMapSize);
+        }
+
+        sqMap = ::mmap(nullptr, sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       fd, IORING_OFF_SQ_RING);
+        if (sqMap == MAP_FAILED) return false;
+        cqMap = single ? sqMap
+                       : ::mmap(nullptr, cqMapSize, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cqMap == MAP_FAILED) return false;
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED) return false;
+
+        sqHead = ringField<unsigned>(sqMap, params.sq_off.head);
+        sqTail = ringField<unsigned>(sqMap, params.sq_off.tail);
+        sqMask = *ringField<unsigned>(sqMap, params.sq_off.ring_mask);
+        sqEntries = *ringField<unsigned>(sqMap, params.sq_off.ring_entries);
+        sqArray = ringField<unsigned>(sqMap, params.sq_off.array);
+        cqHead = ringField<unsigned>(cqMap, params.cq_off.head);
+        cqTail = ringField<unsigned>(cqMap, params.cq_off.tail);
+        cqMask = *ringField<unsigned>(cqMap, params.cq_off.ring_mask);
+        cqes = ringField<io_uring_cqe>(cqMap, params.cq_off.cqes);
+        return true;
+    }
+
+    io_uring_sqe* nextSqe() {
+        unsigned tail = *sqTail;
+        unsigned head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= sqEntries) return nullptr;
+
+        unsigned index = tail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqArray[index] = index;
+        return sqe;
+    }
+
+    void commitSqe() {
+        __atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+        unsubmitted++;
+    }
+
+    // 0 ya da -errno
+    int enter(unsigned minComplete) {
+        unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+        while (unsubmitted > 0 || minComplete > 0) {
+            int n = ioUringEnter(fd, unsubmitted, minComplete, flags);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return -errno;
+            }
+            unsubmitted -= std::min<unsigned>(unsubmitted, static_cast<unsigned>(n));
+            if (minComplete > 0 || unsubmitted == 0) break;
+        }
+        return 0;
+    }
+
+    size_t reap(std::vector<Completion>& out) {
+        unsigned head = *cqHead;
+        unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        size_t count = 0;
+        while (head != tail) {
+            const io_uring_cqe& cqe = cqes[head & cqMask];
+            out.push_back({cqe.user_data, cqe.res});
+            head++;
+            count++;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        return count;
+    }
+};
+
+// ==================== IoEngine ====================
+
+namespace {
+
+// Blocking yol: tamamı aktarılana, EOF'a ya da hataya kadar
+int64_t blockingTransfer(bool write, int fd, uint8_t* buf, size_t len, uint64_t offset) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = write
+            ? ::pwrite(fd, buf + done, len - done, static_cast<off_t>(offset + done))
+            : ::pread(fd, buf + done, len - done, static_cast<off_t>(offset + done));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return done > 0 ? static_cast<int64_t>(done) : -errno;
+        }
+        if (n == 0) break;
+        done += static_cast<size_t>(n);
+    }
+    return static_cast<int64_t>(done);
+}
+
+} // namespace
+
+IoEngine::IoEngine(const IoEngineOptions& options)
+    : m_backend(IoBackend::Blocking)
+    , m_queueDepth(std::max(options.queueDepth, 1u))
+    , m_inFlight(0) {
+    if (options.useIoUring) {
+        auto ring = std::make_unique<Ring>();
+        if (ring->init(m_queueDepth)) {
+            m_ring = std::move(ring);
+            m_backend = IoBackend::IoUring;
+        }
+    }
+}
+
+IoEngine::~IoEngine() {
+    // Uçuştaki istekler buffer'lara yazmaya devam etmesin
+    if (m_ring && m_inFlight > 0) {
+        std::vector<Completion> drain;
+        while (m_inFlight > 0 && wait(drain, m_inFlight) > 0) {
+            drain.clear();
+        }
+    }
+}
+
+bool IoEngine::submit(uint8_t opcode, int fd, void* buf, size_t len, uint64_t offset,
+                      uint64_t tag) {
+    if (!canSubmit()) return false;
+
+    if (m_backend == IoBackend::Blocking) {
+        bool write = opcode == IORING_OP_WRITE;
+        m_ready.push_back({tag, blockingTransfer(write, fd, static_cast<uint8_t*>(buf), len, offset)});
+        m_inFlight++;
+        return true;
+    }
+
+    io_uring_sqe* sqe = m_ring->nextSqe();
+    if (!sqe) {
+        // SQ dolu: gönder ve yeniden dene
+        if (m_ring->enter(0) < 0 || !(sqe = m_ring->nextSqe())) return false;
+    }
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = static_cast<uint32_t>(len);
+    sqe->off = offset;
+    sqe->user_data = tag;
+    m_ring->commitSqe();
+    m_inFlight++;
+    return true;
+}
+
+bool IoEngine::submitWrite(int fd, const void* buf, size_t len, uint64_t offset, uint64_t tag) {
+    return submit(IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset, tag);
+}
+
+bool IoEngine::submitRead(int fd, void* buf, size_t len, uint64_t offset, uint64_t tag) {
+    return submit(IORING_OP_READ, fd, buf, len, offset, tag);
+}
+
+size_t IoEngine::wait(std::vector<Completion>& out, size_t minComplete) {
+    minComplete = std::min(minComplete, m_inFlight);
+
+    if (m_backend == IoBackend::Blocking) {
+        size_t count = m_ready.size();
+        out.insert(out.end(), m_ready.begin(), m_ready.end());
+        m_ready.clear();
+        m_inFlight -= count;
+        return count;
+    }
+
+    size_t count = m_ring->reap(out);
+    if (count < minComplete || m_ring->unsubmitted > 0) {
+        unsigned need = static_cast<unsigned>(minComplete > count ? minComplete - count : 0);
+        int err = m_ring->enter(need);
+        if (err < 0) {
+            // Gönderilemeyen istekler hiç tamamlanmayacak; sayaçtan düş
+            for (unsigned i = 0; i < m_ring->unsubmitted; ++i) {
+                out.push_back({UINT64_MAX, err});
+            }
+            m_inFlight -= std::min<size_t>(m_inFlight, m_ring->unsubmitted);
+            m_ring->unsubmitted = 0;
+        }
+        count += m_ring->reap(out);
+    }
+    m_inFlight -= std::min(m_inFlight, count);
+    return count;
+}
+
+bool IoEngine::transfer(bool write, int fd, uint8_t* buf, size_t size, uint64_t offset,
+                        size_t chunkSize, std::string* error) {
+    chunkSize = std::max<size_t>(chunkSize, 4096);
+    // tag = parçanın buf içindeki başlangıcı; değer = kalan uzunluk
+    std::unordered_map<uint64_t, size_t> outstanding;
+    std::vector<Completion> completions;
+    size_t next = 0;
+    bool ok = true;
+    std::string message;
+
+    auto issue = [&](uint64_t start, size_t len) {
+        outstanding[start] = len;
+        return write ? submitWrite(fd, buf + start, len, offset + start, start)
+                     : submitRead(fd, buf + start, len, offset + start, start);
+    };
+
+    while (ok && (next < size || !outstanding.empty())) {
+        while (ok && next < size && canSubmit()) {
+            size_t len = std::min(chunkSize, size - next);
+            if (!issue(next, len)) {
+                ok = false;
+                message = "I/O submit failed";
+                break;
+            }
+            next += len;
+        }
+
+        completions.clear();
+        wait(completions, 1);
+        for (const auto& c : completions) {
+            auto it = outstanding.find(c.tag);
+            if (it == outstanding.end()) {
+                ok = false;
+                message = std::string("I/O failed: ") + std::strerror(static_cast<int>(-c.result));
+                continue;
+            }
+            size_t len = it->second;
+            uint64_t start = it->first;
+            outstanding.erase(it);
+
+            if (c.result < 0) {
+                ok = false;
+                message = std::string("I/O failed: ") + std::strerror(static_cast<int>(-c.result));
+            } else if (c.result == 0) {
+                ok = false;
+                message = write ? "Write made no progress" : "Unexpected end of file";
+            } else if (static_cast<size_t>(c.result) < len && ok) {
+                // Kısa aktarım: kalanı yeniden gönder
+                uint64_t done = static_cast<uint64_t>(c.result);
+                if (!issue(start + done, len - done)) {
+                    ok = false;
+                    message = "I/O submit failed";
+                }
+            }
+        }
+    }
+
+    // Hata: uçuştakileri bekle ki buf serbest bırakılabilsin
+    while (!outstanding.empty() && m_inFlight > 0) {
+        completions.clear();
+        if (wait(completions, 1) == 0) break;
+        for (const auto& c : completions) outstanding.erase(c.tag);
+    }
+
+    if (!ok && error) *error = message;
+    return ok;
+}
+
+bool IoEngine::readFully(int fd, void* buf, size_t size, uint64_t offset,
+                         size_t chunkSize, std::string* error) {
+    return transfer(false, fd, static_cast<uint8_t*>(buf), size, offset, chunkSize, error);
+}
+
+bool IoEngine::writeFully(int fd, const void* buf, size_t size, uint64_t offset,
+                          size_t chunkSize, std::string* error) {
+    return transfer(true, fd, const_cast<uint8_t*>(static_cast<const uint8_t*>(buf)),
+                    size, offset, chunkSize, error);
+}
+
+// ==================== AlignedBuffer ====================
+
+void AlignedBuffer::Free::operator()(uint8_t* p) const {
+    std::free(p);
+}
+
+AlignedBuffer::AlignedBuffer(size_t capacity) {
+    size_t rounded = (capacity + IoEngine::DIRECT_ALIGNMENT - 1) & ~(IoEngine::DIRECT_ALIGNMENT - 1);
+    void* p = nullptr;
+    if (rounded > 0 && ::posix_memalign(&p, IoEngine::DIRECT_ALIGNMENT, rounded) == 0) {
+        m_data.reset(static_cast<uint8_t*>(p));
+        m_capacity = rounded;
+    }
+}
+
+// ==================== AsyncFileWriter ====================
+
+AsyncFileWriter::AsyncFileWriter(const IoEngineOptions& options, IoEngine* engine)
+    : m_options(options)
+    , m_engine(engine)
+    , m_fd(-1)
+    , m_direct(false)
+    , m_failed(false)
+    , m_current(0)
+    , m_fileOffset(0)
+    , m_logicalSize(0)
+    , m_nextTag(0) {
+    if (!m_engine) {
+        m_ownedEngine = std::make_unique<IoEngine>(options);
+        m_engine = m_ownedEngine.get();
+    }
+    m_options.buffers = std::max(m_options.buffers, 2u);
+    m_options.bufferSize = std::max<size_t>(m_options.bufferSize, IoEngine::DIRECT_ALIGNMENT);
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    close();
+}
+
+bool AsyncFileWriter::open(const std::string& filepath, int mode) {
+    close();
+
+    int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    m_direct = false;
+    if (m_options.directIo) {
+        m_fd = ::open(filepath.c_str(), flags | O_DIRECT, mode);
+        m_direct = m_fd >= 0;
+    }
+    if (m_fd < 0) {
+        // tmpfs vb. O_DIRECT'i EINVAL ile reddeder
+        m_fd = ::open(filepath.c_str(), flags, mode);
+    }
+    if (m_fd < 0) {
+        m_lastError = "Failed to open file for writing: " + filepath +
+                      " (" + std::strerror(errno) + ")";
+        return false;
+    }
+
+    // Tamponlar ilk kullanımda ayrılır ve sonraki open()'larda yeniden kullanılır
+    m_slots.resize(m_options.buffers);
+    for (auto& slot : m_slots) {
+        slot.used = 0;
+        slot.busy = false;
+    }
+    m_current = 0;
+    m_fileOffset = 0;
+    m_logicalSize = 0;
+    m_failed = false;
+    m_requests.clear();
+    m_lastError.clear();
+    return true;
+}
+
+bool AsyncFileWriter::fail(const std::string& message) {
+    if (!m_failed) {
+        m_failed = true;
+        m_lastError = message;
+    }
+    return false;
+}
+
+bool AsyncFileWriter::submitRequest(const Request& request) {
+    while (!m_engine->canSubmit()) {
+        if (!reap(1)) return false;
+    }
+    uint64_t tag = m_nextTag++;
+    if (!m_engine->submitWrite(m_fd, request.data + request.done, request.len - request.done,
+                               request.offset + request.done, tag)) {
+        return fail("I/O submit failed");
+    }
+    m_requests[tag] = request;
+    return true;
+}
+
+bool AsyncFileWriter::reap(size_t minComplete) {
+    m_completions.clear();
+    m_engine->wait(m_completions, minComplete);
+
+    // Yeniden gönderim m_completions'ı değiştirebilir; kopya üzerinde dön
+    std::vector<IoEngine::Completion> completions;
+    completions.swap(m_completions);
+    for (const auto& c : completions) {
+        auto it = m_requests.find(c.tag);
+        if (it == m_requests.end()) {
+            fail(std::string("Write failed: ") + std::strerror(static_cast<int>(-c.result)));
+            continue;
+        }
+        Request request = it->second;
+        m_requests.erase(it);
+
+        if (c.result <= 0) {
+            fail(c.result < 0 ? std::string("Write failed: ") + std::strerror(static_cast<int>(-c.result))
+                              : std::string("Write made no progress"));
+        } else if (request.done + static_cast<size_t>(c.result) < request.len && !m_failed) {
+            request.done += static_cast<size_t>(c.result);
+            submitRequest(request);
+            continue;
+        }
+        if (request.slot >= 0) {
+            m_slots[request.slot].busy = false;
+            m_slots[request.slot].used = 0;
+        }
+    }
+    return !m_failed;
+}
+
+bool AsyncFileWriter::submitCurrent() {
+    Slot& slot = m_slots[m_current];
+    if (slot.used == 0) return true;
+
+    size_t len = slot.used;
+    if (m_direct) {
+        // Son parça: hizaya kadar sıfırla (dosya finish'te kesilir)
+        size_t padded = (len + IoEngine::DIRECT_ALIGNMENT - 1) & ~(IoEngine::DIRECT_ALIGNMENT - 1);
+        std::memset(slot.buffer.data() + len, 0, padded - len);
+        len = padded;
+    }
+
+    slot.busy = true;
+    Request request{slot.buffer.data(), len, m_fileOffset, 0, static_cast<int>(m_current)};
+    m_fileOffset += len;
+    return submitRequest(request);
+}
+
+bool AsyncFileWriter::acquireSlot() {
+    for (;;) {
+        for (size_t i = 0; i < m_slots.size(); ++i) {
+            size_t index = (m_current + 1 + i) % m_slots.size();
+            if (!m_slots[index].busy) {
+                m_current = index;
+                return true;
+            }
+        }
+        if (!reap(1)) return false;
+    }
+}
+
+bool AsyncFileWriter::write(const void* data, size_t size) {
+    if (m_fd < 0) return fail("Writer not open");
+    if (m_failed) return false;
+
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        Slot& slot = m_slots[m_current];
+        if (slot.buffer.capacity() == 0) {
+            slot.buffer = AlignedBuffer(m_options.bufferSize);
+            if (slot.buffer.capacity() == 0) return fail("Out of memory for I/O buffer");
+        }
+        size_t n = std::min(size, slot.buffer.capacity() - slot.used);
+        std::memcpy(slot.buffer.data() + slot.used, src, n);
+        slot.used += n;
+        src += n;
+        size -= n;
+        m_logicalSize += n;
+
+        if (slot.used == slot.buffer.capacity()) {
+            if (!submitCurrent() || !acquireSlot()) return false;
+        }
+    }
+    return true;
+}
+
+bool AsyncFileWriter::writeStable(const void* data, size_t size) {
+    if (m_fd < 0) return fail("Writer not open");
+    if (m_failed) return false;
+
+    // Direct modda offset ve adres hizalı olmalı; küçük parçalar da kopyalanır
+    if (m_direct || size < m_options.bufferSize) {
+        return write(data, size);
+    }
+
+    // Sıra korunsun: yarım tampon önce gider
+    if (m_slots[m_current].used > 0 && (!submitCurrent() || !acquireSlot())) {
+        return false;
+    }
+
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        size_t len = std::min(size, m_options.bufferSize);
+        if (!submitRequest({src, len, m_fileOffset, 0, -1})) return false;
+        m_fileOffset += len;
+        m_logicalSize += len;
+        src += len;
+        size -= len;
+    }
+    return true;
+}
+
+bool AsyncFileWriter::finish(bool sync) {
+    if (m_fd < 0) return fail("Writer not open");
+
+    if (!m_failed) submitCurrent();
+    while (!m_requests.empty()) {
+        size_t before = m_requests.size();
+        reap(1);
+        if (m_requests.size() >= before && m_engine->inFlight() == 0) break;
+    }
+
+    if (!m_failed && m_direct && m_fileOffset != m_logicalSize &&
+        ::ftruncate(m_fd, static_cast<off_t>(m_logicalSize)) != 0) {
+        fail(std::string("Truncate failed: ") + std::strerror(errno));
+    }
+    if (!m_failed && sync && ::fdatasync(m_fd) != 0) {
+        fail(std::string("Sync failed: ") + std::strerror(errno));
+    }
+
+    ::close(m_fd);
+    m_fd = -1;
+    return !m_failed;
+}
+
+void AsyncFileWriter::close() {
+    if (m_fd >= 0) {
+        finish(false);
+    }
+}
+
+} // namespace checkpoint
@@ -0,0 +1,304 @@
+#include "core/metrics.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace checkpoint {
+
+namespace {
+
+std::string formatNanos(uint64_t nanos) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    if (nanos >= 1000000000ull) out << nanos / 1e9 << "s";
+    else if (nanos >= 1000000ull) out << nanos / 1e6 << "ms";
+    else out << nanos / 1e3 << "us";
+    return out.str();
+}
+
+void observe(MetricsRegistry::DurationStats& stats, uint64_t nanos) {
+    stats.minNanos = stats.count ? std::min(stats.minNanos, nanos) : nanos;
+    stats.maxNanos = std::max(stats.maxNanos, nanos);
+    stats.count++;
+    stats.sumNanos += nanos;
+
+    double seconds = nanos / 1e9;
+    size_t bucket = 0;
+    while (bucket < MetricsRegistry::BUCKET_BOUNDS.size() &&
+           seconds > MetricsRegistry::BUCKET_BOUNDS[bucket]) {
+        ++bucket;
+    }
+    stats.buckets[bucket]++;
+}
+
+// OpenMetrics label değeri: \ " ve satır sonu kaçışlanır
+std::string labelValue(const std::string& value) {
+    std::string out;
+    out.reserve(value.size());
+    for (char c : value) {
+        if (c == '\\' || c == '"') out += '\\';
+        if (c == '\n') { out += "\\n"; continue; }
+        out += c;
+    }
+    return out;
+}
+
+std::string seconds(uint64_t nanos) {
+    std::ostringstream out;
+    out << std::setprecision(9) << nanos / 1e9;
+    return out.str();
+}
+
+std::string bound(double value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+void writeHistogram(std::ostringstream& out, const std::string& family,
+                    const std::string& labels, const MetricsRegistry::DurationStats& stats) {
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < MetricsRegistry::BUCKET_BOUNDS.size(); ++i) {
+        cumulative += stats.buckets[i];
+        out << family << "_bucket{" << labels << ",le=\"" << bound(MetricsRegistry::BUCKET_BOUNDS[i])
+            << "\"} " << cumulative << "\n";
+    }
+    out << family << "_bucket{" << labels << ",le=\"+Inf\"} " << stats.count << "\n";
+    out << family << "_sum{" << labels << "} " << seconds(stats.sumNanos) << "\n";
+    out << family << "_count{" << labels << "} " << stats.count << "\n";
+}
+
+} // namespace
+
+// ============================================================================
+// OperationTrace
+// ============================================================================
+
+uint64_t OperationTrace::stageNanos(const std::string& stage) const {
+    uint64_t total = 0;
+    for (const auto& [name, nanos] : stages) {
+        if (name == stage) total += nanos;
+    }
+    return total;
+}
+
+uint64_t OperationTrace::counter(const std::string& name) const {
+    auto it = counters.find(name);
+    return it == counters.end() ? 0 : it->second;
+}
+
+std::string OperationTrace::toString() const {
+    std::ostringstream out;
+    out << operation << (success ? "" : " (failed)") << " " << formatNanos(totalNanos);
+    if (!stages.empty()) {
+        out << " [";
+        for (size_t i = 0; i < stages.size(); ++i) {
+            out << (i ? " " : "") << stages[i].first << "=" << formatNanos(stages[i].second);
+        }
+        out << "]";
+    }
+    for (const auto& [name, value] : counters) {
+        out << " " << name << "=" << value;
+    }
+    return out.str();
+}
+
+// ============================================================================
+// MetricsRegistry
+// ============================================================================
+
+MetricsRegistry& MetricsRegistry::global() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+void MetricsRegistry::setEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_enabled = enabled;
+}
+
+bool MetricsRegistry::isEnabled() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_enabled;
+}
+
+void MetricsRegistry::setTraceHistory(size_t count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_traceHistory = count;
+    while (m_recent.size() > m_traceHistory) {
+        m_recent.pop_front();
+    }
+}
+
+void MetricsRegistry::record(const OperationTrace& trace) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled) return;
+
+    auto& stats = m_operations[trace.operation];
+    (trace.success ? stats.succeeded : stats.failed)++;
+    observe(stats.total, trace.totalNanos);
+    for (const auto& [stage, nanos] : trace.stages) {
+        observe(stats.stages[stage], nanos);
+    }
+    for (const auto& [name, value] : trace.counters) {
+        stats.counters[name] += value;
+    }
+
+    if (m_traceHistory == 0) return;
+    if (m_recent.size() >= m_traceHistory) {
+        m_recent.pop_front();
+    }
+    m_recent.push_back(trace);
+}
+
+std::map<std::string, MetricsRegistry::OperationStats> MetricsRegistry::getOperationStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_operations;
+}
+
+std::optional<MetricsRegistry::OperationStats> MetricsRegistry::getOperationStats(
+    const std::string& operation) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_operations.find(operation);
+    if (it == m_operations.end()) return std::nullopt;
+    return it->second;
+}
+
+std::vector<OperationTrace> MetricsRegistry::getRecentTraces() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::vector<OperationTrace>(m_recent.begin(), m_recent.end());
+}
+
+std::optional<OperationTrace> MetricsRegistry::getLastTrace(const std::string& operation) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_recent.rbegin(); it != m_recent.rend(); ++it) {
+        if (it->operation == operation) return *it;
+    }
+    return std::nullopt;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_operations.clear();
+    m_recent.clear();
+}
+
+std::string MetricsRegistry::toOpenMetrics() const {
+    auto operations = getOperationStats();
+    std::ostringstream out;
+
+    out << "# TYPE checkpoint_operations counter\n"
+        << "# HELP checkpoint_operations Completed operations by result.\n";
+    for (const auto& [op, stats] : operations) {
+        std::string labels = "operation=\"" + labelValue(op) + "\"";
+        out << "checkpoint_operations_total{" << labels << ",result=\"success\"} " << stats.succeeded << "\n";
+        out << "checkpoint_operations_total{" << labels << ",result=\"failure\"} " << stats.failed << "\n";
+    }
+
+    out << "# TYPE checkpoint_operation_duration_seconds histogram\n"
+        << "# UNIT checkpoint_operation_duration_seconds seconds\n"
+        << "# HELP checkpoint_operation_duration_seconds End-to-end operation latency.\n";
+    for (const auto& [op, stats] : operations) {
+        writeHistogram(out, "checkpoint_operation_duration_seconds",
+                       "operation=\"" + labelValue(op) + "\"", stats.total);
+    }
+
+    out << "# TYPE checkpoint_stage_duration_seconds histogram\n"
+        << "# UNIT checkpoint_stage_duration_seconds seconds\n"
+        << "# HELP checkpoint_stage_duration_seconds Latency of each stage within an operation.\n";
+    for (const auto& [op, stats] : operations) {
+        for (const auto& [stage, stageStats] : stats.stages) {
+            writeHistogram(out, "checkpoint_stage_duration_seconds",
+                           "operation=\"" + labelValue(op) + "\",stage=\"" + labelValue(stage) + "\"",
+                           stageStats);
+        }
+    }
+
+    out << "# TYPE checkpoint_operation_events counter\n"
+        << "# HELP checkpoint_operation_events Bytes, syscalls and other per-operation counts.\n";
+    for (const auto& [op, stats] : operations) {
+        for (const auto& [name, value] : stats.counters) {
+            out << "checkpoint_operation_events_total{operation=\"" << labelValue(op)
+                << "\",name=\"" << labelValue(name) << "\"} " << value << "\n";
+        }
+    }
+
+    out << "# EOF\n";
+    return out.str();
+}
+
+std::string MetricsRegistry::toText() const {
+    auto operations = getOperationStats();
+    std::ostringstream out;
+
+    for (const auto& [op, stats] : operations) {
+        out << op << ": " << stats.succeeded << " ok, " << stats.failed << " failed, mean "
+            << formatNanos(static_cast<uint64_t>(stats.total.meanNanos()))
+            << ", max " << formatNanos(stats.total.maxNanos) << "\n";
+
+        // Aşamalar toplam sürenin payına göre
+        std::vector<std::pair<std::string, const DurationStats*>> stages;
+        for (const auto& [stage, stageStats] : stats.stages) {
+            stages.emplace_back(stage, &stageStats);
+        }
+        std::sort(stages.begin(), stages.end(), [](const auto& a, const auto& b) {
+            return a.second->sumNanos > b.second->sumNanos;
+        });
+        for (const auto& [stage, stageStats] : stages) {
+            double share = stats.total.sumNanos
+                ? 100.0 * stageStats->sumNanos / stats.total.sumNanos : 0;
+            out << "  " << std::left << std::setw(24) << stage << std::right
+                << std::setw(12) << formatNanos(static_cast<uint64_t>(stageStats->meanNanos()))
+                << std::setw(12) << formatNanos(stageStats->maxNanos)
+                << std::setw(8) << std::fixed << std::setprecision(1) << share << "%\n";
+        }
+        for (const auto& [name, value] : stats.counters) {
+            out << "  " << std::left << std::setw(24) << name << std::right << std::setw(12) << value << "\n";
+        }
+    }
+    return out.str();
+}
+
+// ============================================================================
+// TraceScope
+// ============================================================================
+
+TraceScope::TraceScope(std::string operation, MetricsRegistry& registry)
+    : m_registry(registry), m_start(Clock::now()), m_stageStart(m_start) {
+    m_trace.operation = std::move(operation);
+    m_trace.success = false;
+    m_trace.startedAt = std::chrono::system_clock::now();
+}
+
+TraceScope::~TraceScope() {
+    finish();
+}
+
+void TraceScope::stage(std::string name) {
+    endStage();
+    m_stage = std::move(name);
+    m_stageStart = Clock::now();
+}
+
+void TraceScope::endStage() {
+    if (m_stage.empty()) return;
+    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_stageStart).count();
+    m_trace.stages.emplace_back(std::move(m_stage), static_cast<uint64_t>(nanos));
+    m_stage.clear();
+}
+
+void TraceScope::count(const std::string& name, uint64_t delta) {
+    m_trace.counters[name] += delta;
+}
+
+const OperationTrace& TraceScope::finish() {
+    if (m_finished) return m_trace;
+    m_finished = true;
+    endStage();
+    m_trace.totalNanos = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count());
+    m_registry.record(m_trace);
+    return m_trace;
+}
+
+} // namespace checkpoint
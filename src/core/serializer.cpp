@@ -1,10 +1,33 @@
 #include "core/serializer.hpp"
+#include "core/checksum.hpp"
 #include <cstring>
 #include <numeric>
 #include <algorithm>
 
 namespace checkpoint {
 
+namespace {
+
+// Eski bitwise CRC32 (0xEDB88320) - sadece eski checksum'ları doğrulamak için
+uint32_t legacyCrc32(const StateData& data) {
+    uint32_t checksum = 0xFFFFFFFF;
+    
+    for (uint8_t byte : data) {
+        checksum ^= byte;
+        for (int i = 0; i < 8; i++) {
+            if (checksum & 1) {
+                checksum = (checksum >> 1) ^ 0xEDB88320;
+            } else {
+                checksum >>= 1;
+            }
+        }
+    }
+    
+    return ~checksum;
+}
+
+} // namespace
+
 // ==================== BinarySerializer ====================
 
 StateData BinarySerializer::serialize(const void* data, size_t size) {
@@ -22,49 +45,27 @@ bool BinarySerializer::deserialize(const StateData& data, void* output, size_t s
 }
 
 StateData BinarySerializer::compress(const StateData& data) {
-    // Basit RLE (Run-Length Encoding) sıkıştırma
-    StateData compressed;
-    compressed.reserve(data.size());
-    
-    size_t i = 0;
-    while (i < data.size()) {
-        uint8_t current = data[i];
-        size_t count = 1;
-        
-        while (i + count < data.size() && 
-               data[i + count] == current && 
-               count < 255) {
-            count++;
-        }
-        
-        if (count >= 4 || current == 0xFF) {
-            compressed.push_back(0xFF);  // Escape character
-            compressed.push_back(static_cast<uint8_t>(count));
-            compressed.push_back(current);
-        } else {
-            for (size_t j = 0; j < count; j++) {
-                compressed.push_back(current);
-            }
-        }
-        
-        i += count;
-    }
-    
-    return compressed;
+    return CompressedFrame::compress(*m_codec, data.data(), data.size(), m_chunkSize, m_threads);
 }
 
 StateData BinarySerializer::decompress(const StateData& data) {
+    CompressedFrame frame;
+    if (frame.open(data.data(), data.size())) {
+        StateData decompressed(frame.originalSize());
+        if (!frame.decompressAll(decompressed.data(), m_threads)) {
+            return StateData();
+        }
+        return decompressed;
+    }
+    
+    // Frame öncesi format: çıplak RLE akışı
     StateData decompressed;
     decompressed.reserve(data.size() * 2);
     
     size_t i = 0;
     while (i < data.size()) {
         if (data[i] == 0xFF && i + 2 < data.size()) {
-            size_t count = data[i + 1];
-            uint8_t value = data[i + 2];
-            for (size_t j = 0; j < count; j++) {
-                decompressed.push_back(value);
-            }
+            decompressed.insert(decompressed.end(), data[i + 1], data[i + 2]);
             i += 3;
         } else {
             decompressed.push_back(data[i]);
@@ -76,25 +77,12 @@ StateData BinarySerializer::decompress(const StateData& data) {
 }
 
 uint32_t BinarySerializer::calculateChecksum(const StateData& data) {
-    // CRC32-like checksum
-    uint32_t checksum = 0xFFFFFFFF;
-    
-    for (uint8_t byte : data) {
-        checksum ^= byte;
-        for (int i = 0; i < 8; i++) {
-            if (checksum & 1) {
-                checksum = (checksum >> 1) ^ 0xEDB88320;
-            } else {
-                checksum >>= 1;
-            }
-        }
-    }
-    
-    return ~checksum;
+    return crc32c(data.data(), data.size());
 }
 
 bool BinarySerializer::verifyChecksum(const StateData& data, uint32_t checksum) {
-    return calculateChecksum(data) == checksum;
+    // CRC32C öncesi kaydedilmiş checkpoint'ler bitwise CRC32 taşır
+    return calculateChecksum(data) == checksum || legacyCrc32(data) == checksum;
 }
 
 // ==================== JsonSerializer ====================
@@ -149,22 +137,32 @@ bool JsonSerializer::deserialize(const StateData& data, void* output, size_t siz
 }
 
 StateData JsonSerializer::compress(const StateData& data) {
-    // JSON için sıkıştırma yapmıyoruz (okunabilirlik için)
-    return data;
+    // None codec'te veri olduğu gibi kalır (okunabilirlik)
+    if (m_codec->type() == CodecType::None) {
+        return data;
+    }
+    return CompressedFrame::compress(*m_codec, data.data(), data.size(), m_chunkSize, m_threads);
 }
 
 StateData JsonSerializer::decompress(const StateData& data) {
-    return data;
+    CompressedFrame frame;
+    if (!frame.open(data.data(), data.size())) {
+        return data;
+    }
+    StateData decompressed(frame.originalSize());
+    if (!frame.decompressAll(decompressed.data(), m_threads)) {
+        return StateData();
+    }
+    return decompressed;
 }
 
 uint32_t JsonSerializer::calculateChecksum(const StateData& data) {
     // Binary serializer ile aynı
-    BinarySerializer binary;
-    return binary.calculateChecksum(data);
+    return crc32c(data.data(), data.size());
 }
 
 bool JsonSerializer::verifyChecksum(const StateData& data, uint32_t checksum) {
-    return calculateChecksum(data) == checksum;
+    return calculateChecksum(data) == checksum || legacyCrc32(data) == checksum;
 }
 
 std::string JsonSerializer::toJsonString(const StateData& data) {
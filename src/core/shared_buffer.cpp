@@ -0,0 +1,143 @@
+#include "core/shared_buffer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace checkpoint {
+
+// ==================== SharedBuffer ====================
+
+namespace {
+
+// munmap eden sahip; eşlemenin ömrü SharedBuffer referanslarına bağlı
+struct MappedRegion {
+    void* addr;
+    size_t length;
+
+    MappedRegion(void* a, size_t len) : addr(a), length(len) {}
+    MappedRegion(const MappedRegion&) = delete;
+    MappedRegion& operator=(const MappedRegion&) = delete;
+
+    ~MappedRegion() {
+        if (addr != MAP_FAILED && length > 0) {
+            ::munmap(addr, length);
+        }
+    }
+};
+
+void setError(std::string* error, const std::string& message) {
+    if (error) *error = message;
+}
+
+} // namespace
+
+SharedBuffer::SharedBuffer(StateData&& data) {
+    if (data.empty()) return;
+    auto owned = std::make_shared<const StateData>(std::move(data));
+    m_data = owned->data();
+    m_size = owned->size();
+    m_owner = std::move(owned);
+}
+
+SharedBuffer::SharedBuffer(std::shared_ptr<const void> owner, const uint8_t* data, size_t size)
+    : m_owner(std::move(owner)), m_data(size ? data : nullptr), m_size(data ? size : 0) {
+}
+
+SharedBuffer SharedBuffer::copyOf(const void* data, size_t size) {
+    if (size == 0) return SharedBuffer();
+    auto owned = std::make_shared<StateData>(size);
+    std::copy_n(static_cast<const uint8_t*>(data), size, owned->data());
+    const uint8_t* bytes = owned->data();
+    return SharedBuffer(std::move(owned), bytes, size);
+}
+
+std::optional<SharedBuffer> SharedBuffer::mapFile(const std::string& path, std::string* error) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        setError(error, "Cannot open " + path + ": " + std::strerror(errno));
+        return std::nullopt;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        setError(error, "Cannot stat " + path + ": " + std::strerror(errno));
+        ::close(fd);
+        return std::nullopt;
+    }
+    auto result = mapFile(fd, static_cast<size_t>(st.st_size), error);
+    ::close(fd);        // eşleme fd'den bağımsız yaşar
+    return result;
+}
+
+std::optional<SharedBuffer> SharedBuffer::mapFile(int fd, size_t size, std::string* error) {
+    if (size == 0) {
+        return SharedBuffer();      // boş dosya mmap'lenemez
+    }
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        setError(error, std::string("mmap failed: ") + std::strerror(errno));
+        return std::nullopt;
+    }
+    auto region = std::make_shared<const MappedRegion>(addr, size);
+    return SharedBuffer(region, static_cast<const uint8_t*>(addr), size);
+}
+
+SharedBuffer SharedBuffer::slice(size_t offset, size_t length) const {
+    if (offset >= m_size) {
+        return SharedBuffer();
+    }
+    length = std::min(length, m_size - offset);
+    return SharedBuffer(m_owner, m_data + offset, length);
+}
+
+bool SharedBuffer::sharesStorageWith(const SharedBuffer& other) const {
+    return m_owner && !m_owner.owner_before(other.m_owner) && !other.m_owner.owner_before(m_owner);
+}
+
+bool operator==(const SharedBuffer& a, const SharedBuffer& b) {
+    if (a.m_size != b.m_size) return false;
+    return a.m_data == b.m_data || a.m_size == 0 || std::memcmp(a.m_data, b.m_data, a.m_size) == 0;
+}
+
+bool operator==(const SharedBuffer& a, const StateData& b) {
+    if (a.m_size != b.size()) return false;
+    return a.m_size == 0 || std::memcmp(a.m_data, b.data(), a.m_size) == 0;
+}
+
+// ==================== BufferArena ====================
+
+BufferArena::BufferArena(size_t blockSize)
+    : m_blockSize(std::max<size_t>(blockSize, 64)), m_used(0), m_blocksAllocated(0) {
+}
+
+SharedBuffer BufferArena::copy(const void* data, size_t size) {
+    if (size == 0) {
+        return SharedBuffer();
+    }
+    if (size > m_blockSize / 2) {
+        // Büyük istek: bloğu boşa harcamamak için ayrı sahip
+        return SharedBuffer::copyOf(data, size);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_block || m_used + size > m_blockSize) {
+        m_block = std::shared_ptr<uint8_t[]>(new uint8_t[m_blockSize]);
+        m_used = 0;
+        m_blocksAllocated++;
+    }
+    uint8_t* dst = m_block.get() + m_used;
+    std::memcpy(dst, data, size);
+    // 16 byte hizada tut
+    m_used += (size + 15) & ~size_t(15);
+    return SharedBuffer(std::shared_ptr<const void>(m_block, dst), dst, size);
+}
+
+size_t BufferArena::blocksAllocated() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_blocksAllocated;
+}
+
+} // namespace checkpoint
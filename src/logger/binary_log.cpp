@@ -0,0 +1,385 @@
+#include "logger/binary_log.hpp"
+#include "utils/helpers.hpp"
+#include <cstring>
+#include <ostream>
+
+namespace checkpoint {
+
+// ==================== binlog helpers ====================
+
+namespace binlog {
+
+void splitMessage(const std::string& message, std::string& pattern, std::vector<uint64_t>& args) {
+    pattern.clear();
+    args.clear();
+
+    if (message.find(ARG_PLACEHOLDER) != std::string::npos) {
+        pattern = message;
+        return;
+    }
+
+    size_t i = 0;
+    while (i < message.size()) {
+        if (message[i] < '0' || message[i] > '9') {
+            pattern.push_back(message[i++]);
+            continue;
+        }
+
+        size_t end = i;
+        while (end < message.size() && message[end] >= '0' && message[end] <= '9') ++end;
+        size_t len = end - i;
+
+        // Baştaki sıfırlar ve 19 haneden uzun sayılar birebir geri
+        // üretilemez - literal kalır
+        if (len > 19 || (len > 1 && message[i] == '0')) {
+            pattern.append(message, i, len);
+        } else {
+            args.push_back(std::stoull(message.substr(i, len)));
+            pattern.push_back(ARG_PLACEHOLDER);
+        }
+        i = end;
+    }
+}
+
+std::string joinMessage(const std::string& pattern, const std::vector<uint64_t>& args) {
+    std::string message;
+    message.reserve(pattern.size() + args.size() * 4);
+    size_t arg = 0;
+    for (char c : pattern) {
+        if (c == ARG_PLACEHOLDER && arg < args.size()) {
+            message += std::to_string(args[arg++]);
+        } else {
+            message.push_back(c);
+        }
+    }
+    return message;
+}
+
+int64_t toNanos(const Timestamp& ts) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(ts.time_since_epoch()).count();
+}
+
+Timestamp fromNanos(int64_t ns) {
+    return Timestamp(std::chrono::duration_cast<Timestamp::duration>(std::chrono::nanoseconds(ns)));
+}
+
+void appendHeader(std::vector<uint8_t>& out) {
+    out.insert(out.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    out.push_back(VERSION);
+}
+
+bool readHeader(const uint8_t*& p, const uint8_t* end, std::string& error) {
+    if (static_cast<size_t>(end - p) < sizeof(MAGIC) + 1 ||
+        std::memcmp(p, MAGIC, sizeof(MAGIC)) != 0) {
+        error = "Not a binary log file";
+        return false;
+    }
+    if (p[sizeof(MAGIC)] != VERSION) {
+        error = "Unsupported binary log version";
+        return false;
+    }
+    p += sizeof(MAGIC) + 1;
+    return true;
+}
+
+// ==================== Encoder ====================
+
+void Encoder::reset() {
+    m_strings.clear();
+    m_lastId = 0;
+    m_lastTimestamp = 0;
+}
+
+uint64_t Encoder::intern(const std::string& str, std::vector<uint8_t>& out) {
+    auto it = m_strings.find(str);
+    if (it != m_strings.end()) {
+        return it->second;
+    }
+
+    uint64_t id = m_strings.size() + 1;
+    m_strings.emplace(str, id);
+    out.push_back(RECORD_STRING);
+    putVarint(out, str.size());
+    out.insert(out.end(), str.begin(), str.end());
+    return id;
+}
+
+void Encoder::encode(const LogEntry& entry, std::vector<uint8_t>& out) {
+    splitMessage(entry.message, m_pattern, m_args);
+
+    // String tanımları entry'den önce yazılmalı
+    uint64_t categoryId = intern(entry.category, out);
+    uint64_t patternId = intern(m_pattern, out);
+    uint64_t fileId = entry.file.empty() ? 0 : intern(entry.file, out);
+    m_keyIds.clear();
+    for (const auto& [key, value] : entry.context) {
+        m_keyIds.push_back(intern(key, out));
+    }
+
+    int64_t ts = toNanos(entry.timestamp);
+
+    out.push_back(RECORD_ENTRY);
+    out.push_back(static_cast<uint8_t>(entry.level));
+    putVarint(out, zigzag(static_cast<int64_t>(entry.id - m_lastId)));
+    putVarint(out, zigzag(ts - m_lastTimestamp));
+    putVarint(out, categoryId);
+    putVarint(out, patternId);
+    putVarint(out, fileId);
+    putVarint(out, static_cast<uint32_t>(entry.line));
+    putVarint(out, m_args.size());
+    for (uint64_t arg : m_args) {
+        putVarint(out, arg);
+    }
+    putVarint(out, entry.context.size());
+    size_t k = 0;
+    for (const auto& [key, value] : entry.context) {
+        putVarint(out, m_keyIds[k++]);
+        putVarint(out, value.size());
+        out.insert(out.end(), value.begin(), value.end());
+    }
+
+    m_lastId = entry.id;
+    m_lastTimestamp = ts;
+}
+
+// ==================== Decoder ====================
+
+void Decoder::reset() {
+    m_strings.assign(1, std::string());
+    m_lastId = 0;
+    m_lastTimestamp = 0;
+}
+
+const std::string* Decoder::lookup(uint64_t id) const {
+    return id < m_strings.size() ? &m_strings[id] : nullptr;
+}
+
+Decoder::Status Decoder::decode(const uint8_t*& pos, const uint8_t* end, LogEntry& entry) {
+    while (pos < end) {
+        // Kayıt tamamen okunana kadar pos ilerletilmez
+        const uint8_t* p = pos;
+        uint8_t tag = *p++;
+
+        if (tag == RECORD_STRING) {
+            uint64_t len;
+            if (!getVarint(p, end, len) || static_cast<uint64_t>(end - p) < len) {
+                return Status::Corrupt;
+            }
+            m_strings.emplace_back(reinterpret_cast<const char*>(p), len);
+            pos = p + len;
+            continue;
+        }
+
+        if (tag != RECORD_ENTRY || p >= end) {
+            return Status::Corrupt;
+        }
+
+        uint8_t level = *p++;
+        uint64_t idDelta, tsDelta, categoryId, patternId, fileId, line, argCount;
+        if (!getVarint(p, end, idDelta) || !getVarint(p, end, tsDelta) ||
+            !getVarint(p, end, categoryId) || !getVarint(p, end, patternId) ||
+            !getVarint(p, end, fileId) || !getVarint(p, end, line) ||
+            !getVarint(p, end, argCount) || argCount > static_cast<uint64_t>(end - p)) {
+            return Status::Corrupt;
+        }
+
+        m_args.resize(argCount);
+        for (auto& arg : m_args) {
+            if (!getVarint(p, end, arg)) return Status::Corrupt;
+        }
+
+        const std::string* category = lookup(categoryId);
+        const std::string* pattern = lookup(patternId);
+        const std::string* file = lookup(fileId);
+        uint64_t contextCount;
+        if (!category || !pattern || !file || !getVarint(p, end, contextCount)) {
+            return Status::Corrupt;
+        }
+
+        entry = LogEntry{};
+        for (uint64_t c = 0; c < contextCount; ++c) {
+            uint64_t keyId, len;
+            if (!getVarint(p, end, keyId) || !getVarint(p, end, len) ||
+                static_cast<uint64_t>(end - p) < len || !lookup(keyId)) {
+                return Status::Corrupt;
+            }
+            entry.context[*lookup(keyId)] = std::string(reinterpret_cast<const char*>(p), len);
+            p += len;
+        }
+
+        m_lastId += static_cast<uint64_t>(unzigzag(idDelta));
+        m_lastTimestamp += unzigzag(tsDelta);
+        entry.id = m_lastId;
+        entry.level = static_cast<LogLevel>(level);
+        entry.timestamp = fromNanos(m_lastTimestamp);
+        entry.category = *category;
+        entry.message = joinMessage(*pattern, m_args);
+        entry.file = *file;
+        entry.line = static_cast<int>(static_cast<uint32_t>(line));
+
+        pos = p;
+        return Status::Entry;
+    }
+    return Status::End;
+}
+
+} // namespace binlog
+
+// ==================== BinaryLogOutput ====================
+
+BinaryLogOutput::BinaryLogOutput(const std::filesystem::path& filePath,
+                                 size_t maxFileSize, int maxBackupCount)
+    : m_filePath(filePath)
+    , m_maxFileSize(maxFileSize)
+    , m_maxBackupCount(maxBackupCount)
+    , m_fileBytes(0)
+    , m_entries(0) {
+    if (filePath.has_parent_path()) {
+        std::filesystem::create_directories(filePath.parent_path());
+    }
+    m_buffer.reserve(BUFFER_SIZE);
+    openFile();
+}
+
+BinaryLogOutput::~BinaryLogOutput() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flushBuffer();
+}
+
+void BinaryLogOutput::openFile() {
+    // String tablosu dosyaya özgü olduğu için her dosya baştan başlar
+    m_file.open(m_filePath, std::ios::binary | std::ios::out | std::ios::trunc);
+    m_encoder.reset();
+    m_fileBytes = 0;
+    binlog::appendHeader(m_buffer);
+}
+
+void BinaryLogOutput::writeEntry(const LogEntry& entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    rotateIfNeeded();
+    m_encoder.encode(entry, m_buffer);
+    m_entries++;
+
+    if (m_buffer.size() >= BUFFER_SIZE) {
+        flushBuffer();
+    }
+}
+
+void BinaryLogOutput::write(const std::string& formattedEntry) {
+    LogEntry entry{};
+    entry.level = LogLevel::Info;
+    entry.timestamp = utils::TimeUtils::now();
+    entry.message = formattedEntry;
+    writeEntry(entry);
+}
+
+void BinaryLogOutput::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flushBuffer();
+    m_file.flush();
+}
+
+void BinaryLogOutput::flushBuffer() {
+    if (m_buffer.empty() || !m_file.is_open()) return;
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    m_fileBytes += m_buffer.size();
+    m_buffer.clear();
+}
+
+void BinaryLogOutput::rotateIfNeeded() {
+    if (m_maxFileSize == 0 || m_fileBytes + m_buffer.size() < m_maxFileSize) return;
+
+    flushBuffer();
+    m_file.close();
+
+    // Eski backup'ları kaydır (FileLogOutput ile aynı adlandırma)
+    for (int i = m_maxBackupCount - 1; i >= 0; --i) {
+        auto oldPath = m_filePath.string() + "." + std::to_string(i);
+        auto newPath = m_filePath.string() + "." + std::to_string(i + 1);
+
+        if (i == m_maxBackupCount - 1) {
+            std::filesystem::remove(oldPath);
+        } else if (std::filesystem::exists(oldPath)) {
+            std::filesystem::rename(oldPath, newPath);
+        }
+    }
+    std::filesystem::rename(m_filePath, m_filePath.string() + ".0");
+
+    openFile();
+}
+
+// ==================== BinaryLogReader ====================
+
+BinaryLogReader::BinaryLogReader() : m_pos(0) {}
+
+bool BinaryLogReader::open(const std::filesystem::path& filePath) {
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file) {
+        m_lastError = "Cannot open log file: " + filePath.string();
+        return false;
+    }
+
+    size_t size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    m_data.resize(size);
+    file.read(reinterpret_cast<char*>(m_data.data()), size);
+
+    m_lastError.clear();
+    const uint8_t* p = m_data.data();
+    if (!binlog::readHeader(p, p + size, m_lastError)) {
+        return false;
+    }
+
+    m_pos = p - m_data.data();
+    m_decoder.reset();
+    return true;
+}
+
+std::optional<LogEntry> BinaryLogReader::next() {
+    const uint8_t* p = m_data.data() + m_pos;
+    const uint8_t* end = m_data.data() + m_data.size();
+
+    LogEntry entry;
+    auto status = m_decoder.decode(p, end, entry);
+    m_pos = p - m_data.data();
+
+    if (status == binlog::Decoder::Status::Entry) {
+        return entry;
+    }
+    if (status == binlog::Decoder::Status::Corrupt) {
+        // Yarım kalmış son kayıt (çökme) ya da bozuk veri
+        m_lastError = "Truncated or corrupt record at offset " + std::to_string(m_pos);
+        m_pos = m_data.size();
+    }
+    return std::nullopt;
+}
+
+std::vector<LogEntry> BinaryLogReader::readAll() {
+    std::vector<LogEntry> entries;
+    while (auto entry = next()) {
+        entries.push_back(std::move(*entry));
+    }
+    return entries;
+}
+
+size_t BinaryLogReader::render(const std::filesystem::path& filePath,
+                               ILogFormatter& formatter,
+                               std::ostream& out,
+                               std::string* error) {
+    BinaryLogReader reader;
+    if (!reader.open(filePath)) {
+        if (error) *error = reader.getLastError();
+        return 0;
+    }
+
+    size_t count = 0;
+    while (auto entry = reader.next()) {
+        out << formatter.format(*entry);
+        count++;
+    }
+    if (error) *error = reader.getLastError();
+    return count;
+}
+
+} // namespace checkpoint
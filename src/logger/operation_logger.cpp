@@ -1,10 +1,16 @@
 #include "logger/operation_logger.hpp"
+#include "logger/log_ring.hpp"
+#include "logger/binary_log.hpp"
+#include "logger/log_history.hpp"
 #include "utils/helpers.hpp"
 #include <iostream>
-#include <queue>
+#include <algorithm>
+#include <atomic>
 #include <thread>
-#include <condition_variable>
 #include <iomanip>
+#include <cstdlib>
+#include <deque>
+#include <unordered_map>
 
 namespace checkpoint {
 
@@ -33,17 +39,28 @@ std::string LogEntry::toString() const {
 }
 
 StateData LogEntry::serialize() const {
-    // Basit serileştirme
-    std::string str = toString();
-    return StateData(str.begin(), str.end());
+    // Tek kayıtlık, kendi string tablosunu taşıyan CKLG tamponu
+    StateData data;
+    binlog::appendHeader(data);
+    binlog::Encoder encoder;
+    encoder.encode(*this, data);
+    return data;
 }
 
 LogEntry LogEntry::deserialize(const StateData& data) {
-    LogEntry entry;
-    // Basit deserialize - gerçek uygulamada daha detaylı olmalı
-    entry.message = std::string(data.begin(), data.end());
-    entry.timestamp = utils::TimeUtils::now();
-    entry.level = LogLevel::Info;
+    LogEntry entry{};
+    const uint8_t* p = data.data();
+    const uint8_t* end = p + data.size();
+    std::string error;
+    binlog::Decoder decoder;
+    if (!binlog::readHeader(p, end, error) ||
+        decoder.decode(p, end, entry) != binlog::Decoder::Status::Entry) {
+        // Eski metin biçimi / bozuk veri: ham içerik mesaj olarak korunur
+        entry = LogEntry{};
+        entry.message = std::string(data.begin(), data.end());
+        entry.timestamp = utils::TimeUtils::now();
+        entry.level = LogLevel::Info;
+    }
     return entry;
 }
 
@@ -163,35 +180,145 @@ struct OperationLogger::Impl {
     std::vector<std::shared_ptr<ILogOutput>> outputs;
     std::shared_ptr<ILogFormatter> formatter;
     
-    std::vector<LogEntry> entries;
-    std::vector<OperationRecord> operations;
+    // Geçmiş + ikincil indeksler (hepsi mutex altında)
+    SegmentedHistory<LogEntry> entries;
+    SegmentedHistory<OperationRecord> operations;
+    std::unordered_map<CheckpointId, std::deque<uint64_t>> entriesByCheckpoint;
+    std::unordered_map<CheckpointId, std::deque<uint64_t>> operationsByCheckpoint;
+    std::unordered_map<OperationId, uint64_t> operationSeq;
+    size_t maxEntries = 0;          // 0 = sınırsız
+    size_t maxOperations = 0;
     
     std::mutex mutex;
     
-    // Async logging
-    bool asyncEnabled = false;
-    std::queue<LogEntry> pendingEntries;
+    // Async logging - üreticiler sadece halka + birkaç atomic'e dokunur
+    static constexpr size_t DRAIN_BATCH = 256;
+    
+    std::atomic<bool> asyncEnabled{false};
+    size_t asyncCapacity = DEFAULT_ASYNC_CAPACITY;
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+    std::unique_ptr<MpscRing<LogEntry>> ring;
+    std::atomic<uint32_t> signal{0};        // tüketiciyi uyandırmak için
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint32_t> inflight{0};      // halkaya yazmakta olan üreticiler
     std::thread asyncThread;
-    std::condition_variable cv;
     std::atomic<bool> running{false};
     
+    // Formatlama yalnızca metin isteyen ilk output'ta yapılır
+    static void dispatch(const LogEntry& entry, ILogFormatter& fmt,
+                         const std::vector<std::shared_ptr<ILogOutput>>& outs) {
+        std::string formatted;
+        bool formattedReady = false;
+        for (auto& output : outs) {
+            if (output->acceptsEntries()) {
+                output->writeEntry(entry);
+                continue;
+            }
+            if (!formattedReady) {
+                formatted = fmt.format(entry);
+                formattedReady = true;
+            }
+            output->write(formatted);
+        }
+    }
+    
+    // Checkpoint ilişkisi entry context'inde "checkpointId" olarak taşınır
+    static bool entryCheckpoint(const LogEntry& entry, CheckpointId& id) {
+        auto it = entry.context.find("checkpointId");
+        if (it == entry.context.end()) return false;
+        char* end = nullptr;
+        id = std::strtoull(it->second.c_str(), &end, 10);
+        return end != it->second.c_str() && *end == '\0';
+    }
+    
+    // mutex tutulurken çağrılır
+    void appendEntry(const LogEntry& entry) {
+        uint64_t seq = entries.push(entry);
+        CheckpointId cp;
+        if (entryCheckpoint(entry, cp)) {
+            entriesByCheckpoint[cp].push_back(seq);
+        }
+        if (maxEntries) {
+            entries.evict(maxEntries, [this](const LogEntry& old) {
+                CheckpointId oldCp;
+                if (entryCheckpoint(old, oldCp)) {
+                    auto it = entriesByCheckpoint.find(oldCp);
+                    it->second.pop_front();
+                    if (it->second.empty()) entriesByCheckpoint.erase(it);
+                }
+            });
+        }
+    }
+    
+    void appendOperation(const OperationRecord& record) {
+        uint64_t seq = operations.push(record);
+        operationsByCheckpoint[record.relatedCheckpoint].push_back(seq);
+        operationSeq[record.id] = seq;
+        if (maxOperations) {
+            operations.evict(maxOperations, [this](const OperationRecord& old) {
+                auto it = operationsByCheckpoint.find(old.relatedCheckpoint);
+                it->second.pop_front();
+                if (it->second.empty()) operationsByCheckpoint.erase(it);
+                operationSeq.erase(old.id);
+            });
+        }
+    }
+    
+    void submit(LogLevel level, const std::string& category, const std::string& message,
+                const char* file, int line, const std::map<std::string, std::string>* context);
+    
+    void writeBatch(std::vector<LogEntry>& batch, size_t count) {
+        std::shared_ptr<ILogFormatter> fmt;
+        std::vector<std::shared_ptr<ILogOutput>> outs;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < count; ++i) {
+                appendEntry(batch[i]);
+            }
+            fmt = formatter;
+            outs = outputs;
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            dispatch(batch[i], *fmt, outs);
+        }
+    }
+    
     void asyncLoop() {
-        while (running) {
-            std::unique_lock<std::mutex> lock(mutex);
-            cv.wait(lock, [this] { return !pendingEntries.empty() || !running; });
+        std::vector<LogEntry> batch(DRAIN_BATCH);
+        for (;;) {
+            uint32_t seen = signal.load(std::memory_order_acquire);
             
-            while (!pendingEntries.empty()) {
-                auto entry = pendingEntries.front();
-                pendingEntries.pop();
-                lock.unlock();
-                
-                std::string formatted = formatter->format(entry);
-                for (auto& output : outputs) {
-                    output->write(formatted);
-                }
-                
-                lock.lock();
+            // swap: slot'lar batch'in string kapasitelerini geri alır
+            size_t count = 0;
+            ring->drain([&](LogEntry& entry) { std::swap(entry, batch[count++]); }, DRAIN_BATCH);
+            
+            if (count > 0) {
+                writeBatch(batch, count);
+                consumed.fetch_add(count, std::memory_order_release);
+                consumed.notify_all();
+                continue;
+            }
+            
+            if (!running.load()) {
+                // Slot almış ama henüz yayınlamamış üreticileri bekle
+                if (inflight.load() == 0 && ring->enqueued() == consumed.load()) break;
+                std::this_thread::yield();
+                continue;
             }
+            
+            signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+    
+    void stopAsync() {
+        asyncEnabled = false;
+        running = false;
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_all();
+        if (asyncThread.joinable()) {
+            asyncThread.join();
         }
     }
 };
@@ -203,11 +330,7 @@ OperationLogger::OperationLogger() : m_impl(std::make_unique<Impl>()) {
 
 OperationLogger::~OperationLogger() {
     if (m_impl->running) {
-        m_impl->running = false;
-        m_impl->cv.notify_all();
-        if (m_impl->asyncThread.joinable()) {
-            m_impl->asyncThread.join();
-        }
+        m_impl->stopAsync();
     }
 }
 
@@ -226,29 +349,75 @@ void OperationLogger::addOutput(std::shared_ptr<ILogOutput> output) {
     m_impl->outputs.push_back(output);
 }
 
+void OperationLogger::clearOutputs() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->outputs.clear();
+}
+
 void OperationLogger::setFormatter(std::shared_ptr<ILogFormatter> formatter) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     m_impl->formatter = formatter;
 }
 
+void OperationLogger::setAsyncQueue(size_t capacity, LogOverflowPolicy policy) {
+    if (m_impl->running) return;
+    m_impl->asyncCapacity = std::max<size_t>(capacity, 2);
+    m_impl->overflowPolicy = policy;
+}
+
+uint64_t OperationLogger::getDroppedCount() const {
+    return m_impl->dropped.load(std::memory_order_relaxed);
+}
+
 void OperationLogger::enableAsync(bool enable) {
     if (enable && !m_impl->running) {
+        m_impl->ring = std::make_unique<MpscRing<LogEntry>>(m_impl->asyncCapacity);
+        m_impl->consumed = 0;
         m_impl->running = true;
         m_impl->asyncEnabled = true;
         m_impl->asyncThread = std::thread(&Impl::asyncLoop, m_impl.get());
     } else if (!enable && m_impl->running) {
-        m_impl->running = false;
-        m_impl->cv.notify_all();
-        if (m_impl->asyncThread.joinable()) {
-            m_impl->asyncThread.join();
-        }
-        m_impl->asyncEnabled = false;
+        m_impl->stopAsync();
     }
 }
 
-void OperationLogger::log(LogLevel level, const std::string& category, 
-                          const std::string& message, const char* file, int line) {
-    if (level < m_impl->minLevel) return;
+void OperationLogger::Impl::submit(LogLevel level, const std::string& category,
+                                   const std::string& message, const char* file, int line,
+                                   const std::map<std::string, std::string>* context) {
+    if (level < minLevel) return;
+    
+    inflight.fetch_add(1);
+    if (asyncEnabled.load()) {
+        OperationId id = utils::IdGenerator::generateOperationId();
+        Timestamp now = utils::TimeUtils::now();
+        auto fill = [&](LogEntry& entry) {
+            entry.id = id;
+            entry.level = level;
+            entry.timestamp = now;
+            entry.category.assign(category);
+            entry.message.assign(message);
+            if (file) entry.file.assign(file); else entry.file.clear();
+            entry.line = line;
+            if (context) entry.context = *context; else entry.context.clear();
+        };
+        
+        bool pushed = false;
+        while (!(pushed = ring->tryPush(fill))) {
+            if (overflowPolicy == LogOverflowPolicy::Drop) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            std::this_thread::yield();
+        }
+        inflight.fetch_sub(1);
+        
+        if (pushed) {
+            signal.fetch_add(1, std::memory_order_release);
+            signal.notify_one();
+        }
+        return;
+    }
+    inflight.fetch_sub(1);
     
     LogEntry entry;
     entry.id = utils::IdGenerator::generateOperationId();
@@ -258,19 +427,17 @@ void OperationLogger::log(LogLevel level, const std::string& category,
     entry.message = message;
     if (file) entry.file = file;
     entry.line = line;
+    if (context) entry.context = *context;
     
-    std::lock_guard<std::mutex> lock(m_impl->mutex);
-    m_impl->entries.push_back(entry);
+    std::lock_guard<std::mutex> lock(mutex);
+    appendEntry(entry);
     
-    if (m_impl->asyncEnabled) {
-        m_impl->pendingEntries.push(entry);
-        m_impl->cv.notify_one();
-    } else {
-        std::string formatted = m_impl->formatter->format(entry);
-        for (auto& output : m_impl->outputs) {
-            output->write(formatted);
-        }
-    }
+    dispatch(entry, *formatter, outputs);
+}
+
+void OperationLogger::log(LogLevel level, const std::string& category, 
+                          const std::string& message, const char* file, int line) {
+    m_impl->submit(level, category, message, file, line, nullptr);
 }
 
 void OperationLogger::trace(const std::string& category, const std::string& message) {
@@ -320,11 +487,17 @@ OperationId OperationLogger::logOperation(OperationType type, const std::string&
     
     {
         std::lock_guard<std::mutex> lock(m_impl->mutex);
-        m_impl->operations.push_back(record);
+        m_impl->appendOperation(record);
     }
     
-    // Mutex dışında log yaz (deadlock önleme)
-    info("Operation", "[" + typeStr + "] " + description);
+    // Mutex dışında log yaz (deadlock önleme). İlgili checkpoint context'e
+    // yazılır; getEntriesForCheckpoint bu alan üzerinden indekslenir.
+    std::map<std::string, std::string> context;
+    if (relatedCheckpoint != 0) {
+        context["checkpointId"] = std::to_string(relatedCheckpoint);
+    }
+    m_impl->submit(LogLevel::Info, "Operation", "[" + typeStr + "] " + description,
+                   nullptr, 0, context.empty() ? nullptr : &context);
     
     return record.id;
 }
@@ -333,13 +506,9 @@ void OperationLogger::logOperationComplete(OperationId opId, bool success) {
     {
         std::lock_guard<std::mutex> lock(m_impl->mutex);
         
-        for (auto& op : m_impl->operations) {
-            if (op.id == opId) {
-                if (!success) {
-                    op.canUndo = false;
-                }
-                break;
-            }
+        auto it = m_impl->operationSeq.find(opId);
+        if (it != m_impl->operationSeq.end() && !success) {
+            m_impl->operations.at(it->second).canUndo = false;
         }
     }
     
@@ -352,13 +521,13 @@ std::vector<LogEntry> OperationLogger::getEntries(LogLevel minLevel, size_t maxC
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
     std::vector<LogEntry> result;
-    for (auto it = m_impl->entries.rbegin(); 
-         it != m_impl->entries.rend() && result.size() < maxCount; 
-         ++it) {
-        if (it->level >= minLevel) {
-            result.push_back(*it);
+    if (maxCount == 0) return result;
+    m_impl->entries.forEachReverse([&](const LogEntry& entry) {
+        if (entry.level >= minLevel) {
+            result.push_back(entry);
         }
-    }
+        return result.size() < maxCount;
+    });
     
     return result;
 }
@@ -367,11 +536,9 @@ std::vector<LogEntry> OperationLogger::getEntriesBetween(Timestamp start, Timest
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
     std::vector<LogEntry> result;
-    for (const auto& entry : m_impl->entries) {
-        if (entry.timestamp >= start && entry.timestamp <= end) {
-            result.push_back(entry);
-        }
-    }
+    m_impl->entries.forEachBetween(start, end, [&](const LogEntry& entry) {
+        result.push_back(entry);
+    });
     
     return result;
 }
@@ -380,11 +547,11 @@ std::vector<LogEntry> OperationLogger::getEntriesForCheckpoint(CheckpointId chec
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
     std::vector<LogEntry> result;
-    // Checkpoint ID'yi context'ten ara
-    for (const auto& entry : m_impl->entries) {
-        auto it = entry.context.find("checkpointId");
-        if (it != entry.context.end() && std::stoull(it->second) == checkpointId) {
-            result.push_back(entry);
+    auto it = m_impl->entriesByCheckpoint.find(checkpointId);
+    if (it != m_impl->entriesByCheckpoint.end()) {
+        result.reserve(it->second.size());
+        for (uint64_t seq : it->second) {
+            result.push_back(m_impl->entries.at(seq));
         }
     }
     
@@ -396,10 +563,9 @@ std::vector<OperationRecord> OperationLogger::getOperationHistory(size_t maxCoun
     
     std::vector<OperationRecord> result;
     size_t count = std::min(maxCount, m_impl->operations.size());
-    
-    for (size_t i = m_impl->operations.size() - count; i < m_impl->operations.size(); ++i) {
-        result.push_back(m_impl->operations[i]);
-    }
+    result.reserve(count);
+    m_impl->operations.forEachFrom(m_impl->operations.endSeq() - count,
+        [&](const OperationRecord& op) { result.push_back(op); });
     
     return result;
 }
@@ -407,18 +573,17 @@ std::vector<OperationRecord> OperationLogger::getOperationHistory(size_t maxCoun
 std::vector<OperationRecord> OperationLogger::getOperationsSince(CheckpointId checkpointId) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
+    // İlk ilgili işlemin seq'i indeksten; sonrası doğrudan kopyalanır
     std::vector<OperationRecord> result;
-    bool found = false;
-    
-    for (const auto& op : m_impl->operations) {
-        if (op.relatedCheckpoint == checkpointId) {
-            found = true;
-        }
-        if (found) {
-            result.push_back(op);
-        }
+    auto it = m_impl->operationsByCheckpoint.find(checkpointId);
+    if (it == m_impl->operationsByCheckpoint.end()) {
+        return result;
     }
     
+    uint64_t first = it->second.front();
+    result.reserve(m_impl->operations.endSeq() - first);
+    m_impl->operations.forEachFrom(first, [&](const OperationRecord& op) { result.push_back(op); });
+    
     return result;
 }
 
@@ -426,9 +591,38 @@ void OperationLogger::clear() {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     m_impl->entries.clear();
     m_impl->operations.clear();
+    m_impl->entriesByCheckpoint.clear();
+    m_impl->operationsByCheckpoint.clear();
+    m_impl->operationSeq.clear();
+}
+
+void OperationLogger::setRetention(size_t maxEntries, size_t maxOperations) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->maxEntries = maxEntries;
+    m_impl->maxOperations = maxOperations;
+}
+
+size_t OperationLogger::getEntryCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->entries.size();
+}
+
+size_t OperationLogger::getOperationCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->operations.size();
 }
 
 void OperationLogger::flush() {
+    // Async modda halkaya o ana kadar giren kayıtlar işlenene kadar bekle
+    if (m_impl->asyncEnabled) {
+        uint64_t target = m_impl->ring->enqueued();
+        uint64_t done = m_impl->consumed.load(std::memory_order_acquire);
+        while (done < target) {
+            m_impl->consumed.wait(done, std::memory_order_acquire);
+            done = m_impl->consumed.load(std::memory_order_acquire);
+        }
+    }
+    
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     for (auto& output : m_impl->outputs) {
         output->flush();
@@ -212,7 +212,7 @@ int main() {
             // Durumu güncelle
             auto cpResult = stateManager->getCheckpoint(*cp2Result.value);
             if (cpResult.isSuccess()) {
-                appState = ApplicationState::deserialize(cpResult.value->getData());
+                appState = ApplicationState::deserialize(cpResult.value->getData().toVector());
                 std::cout << "\nGeri yüklenmiş durum:\n";
                 appState.print();
             }
@@ -10,6 +10,14 @@
 #include <sstream>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace checkpoint {
 namespace real_process {
@@ -307,7 +315,10 @@ uint64_t ASLRHandler::translateAddress(
     }
     
     // Apply appropriate offset based on region type
-    RegionType type = identifyRegionType(*region);
+    return checkpointAddr + regionOffset(identifyRegionType(*region), offsets);
+}
+
+int64_t ASLRHandler::regionOffset(RegionType type, const AddressOffset& offsets) {
     int64_t offset = 0;
     
     switch (type) {
@@ -331,7 +342,7 @@ uint64_t ASLRHandler::translateAddress(
             break;
     }
     
-    return checkpointAddr + offset;
+    return offset;
 }
 
 LinuxRegisters ASLRHandler::translateRegisters(
@@ -357,6 +368,154 @@ LinuxRegisters ASLRHandler::translateRegisters(
 // Memory Content Relocation
 // ============================================================================
 
+namespace {
+
+// [lo, hi) içindeki word'lerin index'lerini out'a yazar (AVX2 / NEON / skaler)
+size_t collectScalar(const uint8_t* data, size_t begin, size_t end,
+                     uint64_t lo, uint64_t hi, uint32_t* out) {
+    size_t n = 0;
+    for (size_t i = begin; i < end; ++i) {
+        uint64_t value;
+        std::memcpy(&value, data + i * sizeof(uint64_t), sizeof(value));
+        if (value >= lo && value < hi) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2")))
+size_t collectAvx2(const uint8_t* data, size_t begin, size_t end,
+                   uint64_t lo, uint64_t hi, uint32_t* out) {
+    // İşaretsiz karşılaştırma: işaret bitini çevirip işaretli cmpgt
+    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i vlo = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(lo)), bias);
+    const __m256i vhi = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(hi)), bias);
+    size_t n = 0;
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * sizeof(uint64_t)));
+        v = _mm256_xor_si256(v, bias);
+        __m256i below = _mm256_cmpgt_epi64(vlo, v);         // v < lo
+        __m256i inside = _mm256_cmpgt_epi64(vhi, v);        // v < hi
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_andnot_si256(below, inside)));
+        while (mask) {
+            int bit = __builtin_ctz(static_cast<unsigned>(mask));
+            out[n++] = static_cast<uint32_t>(i + bit);
+            mask &= mask - 1;
+        }
+    }
+    return n + collectScalar(data, i, end, lo, hi, out + n);
+}
+
+bool cpuHasAvx2() {
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+#elif defined(__aarch64__)
+size_t collectNeon(const uint8_t* data, size_t begin, size_t end,
+                   uint64_t lo, uint64_t hi, uint32_t* out) {
+    const uint64x2_t vlo = vdupq_n_u64(lo);
+    const uint64x2_t vhi = vdupq_n_u64(hi);
+    size_t n = 0;
+    size_t i = begin;
+    for (; i + 2 <= end; i += 2) {
+        uint64x2_t v = vld1q_u64(reinterpret_cast<const uint64_t*>(data + i * sizeof(uint64_t)));
+        uint64x2_t inside = vandq_u64(vcgeq_u64(v, vlo), vcltq_u64(v, vhi));
+        if (vgetq_lane_u64(inside, 0)) out[n++] = static_cast<uint32_t>(i);
+        if (vgetq_lane_u64(inside, 1)) out[n++] = static_cast<uint32_t>(i + 1);
+    }
+    return n + collectScalar(data, i, end, lo, hi, out + n);
+}
+#endif
+
+size_t collectCandidates(const uint8_t* data, size_t begin, size_t end,
+                         uint64_t lo, uint64_t hi, uint32_t* out) {
+#if defined(__x86_64__)
+    if (cpuHasAvx2()) {
+        return collectAvx2(data, begin, end, lo, hi, out);
+    }
+#elif defined(__aarch64__)
+    return collectNeon(data, begin, end, lo, hi, out);
+#endif
+    return collectScalar(data, begin, end, lo, hi, out);
+}
+
+} // namespace
+
+std::vector<ASLRHandler::RelocationTarget> ASLRHandler::buildRelocationTable(
+    const std::vector<MemoryRegion>& checkpointMap,
+    const AddressOffset& offsets,
+    bool conservative) {
+    
+    std::vector<RelocationTarget> table;
+    table.reserve(checkpointMap.size());
+    for (const auto& region : checkpointMap) {
+        if (region.endAddr <= region.startAddr) continue;
+        RegionType type = identifyRegionType(region);
+        RelocationTarget target;
+        target.startAddr = region.startAddr;
+        target.endAddr = region.endAddr;
+        target.offset = regionOffset(type, offsets);
+        // In conservative mode, only relocate pointers to code/stack/heap
+        bool likely = type == RegionType::CODE || type == RegionType::STACK ||
+                      type == RegionType::HEAP;
+        target.relocate = target.offset != 0 && (!conservative || likely);
+        table.push_back(target);
+    }
+    std::sort(table.begin(), table.end(),
+              [](const RelocationTarget& a, const RelocationTarget& b) {
+                  return a.startAddr < b.startAddr;
+              });
+    return table;
+}
+
+void ASLRHandler::scanDump(MemoryDump& dump, const std::vector<RelocationTarget>& table,
+                           RelocationResult& result) {
+    if (table.empty()) return;
+    const uint64_t lo = table.front().startAddr;
+    uint64_t hi = 0;
+    for (const auto& target : table) hi = std::max(hi, target.endAddr);
+    
+    // Pointers are 8 bytes on x86_64 and must be 8-byte aligned
+    uint8_t* data = dump.data.data();
+    const size_t numWords = dump.data.size() / sizeof(uint64_t);
+    constexpr size_t BLOCK_WORDS = 4096;
+    std::vector<uint32_t> candidates(BLOCK_WORDS);
+    size_t hint = 0;                // Son bulunan bölge: pointer'lar kümelenir
+    
+    for (size_t block = 0; block < numWords; block += BLOCK_WORDS) {
+        size_t end = std::min(numWords, block + BLOCK_WORDS);
+        size_t count = collectCandidates(data, block, end, lo, hi, candidates.data());
+        
+        for (size_t c = 0; c < count; ++c) {
+            size_t i = candidates[c];
+            uint64_t value;
+            std::memcpy(&value, data + i * sizeof(uint64_t), sizeof(value));
+            
+            const RelocationTarget* target = &table[hint];
+            if (value < target->startAddr || value >= target->endAddr) {
+                auto it = std::upper_bound(table.begin(), table.end(), value,
+                    [](uint64_t v, const RelocationTarget& t) { return v < t.startAddr; });
+                if (it == table.begin()) continue;
+                --it;
+                if (value >= it->endAddr) continue;     // Bölgeler arası boşluk
+                hint = static_cast<size_t>(it - table.begin());
+                target = &*it;
+            }
+            
+            result.pointersFound++;
+            if (!target->relocate) continue;
+            
+            uint64_t translated = value + static_cast<uint64_t>(target->offset);
+            std::memcpy(data + i * sizeof(uint64_t), &translated, sizeof(translated));
+            result.pointersRelocated++;
+            result.relocatedAddresses.push_back(dump.region.startAddr + i * sizeof(uint64_t));
+        }
+    }
+}
+
 ASLRHandler::RelocationResult ASLRHandler::relocatePointers(
     MemoryDump& dump,
     const std::vector<MemoryRegion>& checkpointMap,
@@ -369,53 +528,59 @@ ASLRHandler::RelocationResult ASLRHandler::relocatePointers(
         return result;  // No relocation needed
     }
     
-    // Calculate valid address range from checkpoint
-    uint64_t minAddr = UINT64_MAX;
-    uint64_t maxAddr = 0;
+    scanDump(dump, buildRelocationTable(checkpointMap, offsets, conservative), result);
+    return result;
+}
+
+ASLRHandler::RelocationResult ASLRHandler::relocatePointers(
+    std::vector<MemoryDump>& dumps,
+    const std::vector<MemoryRegion>& checkpointMap,
+    const AddressOffset& offsets,
+    bool conservative,
+    unsigned threads) {
     
-    for (const auto& region : checkpointMap) {
-        if (region.startAddr < minAddr) minAddr = region.startAddr;
-        if (region.endAddr > maxAddr) maxAddr = region.endAddr;
+    RelocationResult result = {0, 0, {}};
+    
+    if (!offsets.hasOffset() || dumps.empty()) {
+        return result;
     }
     
-    // Scan memory for potential pointers
-    // Pointers are 8 bytes on x86_64 and must be 8-byte aligned
-    uint64_t* data = reinterpret_cast<uint64_t*>(dump.data.data());
-    size_t numWords = dump.data.size() / sizeof(uint64_t);
+    const auto table = buildRelocationTable(checkpointMap, offsets, conservative);
+    std::vector<RelocationResult> partial(dumps.size(), RelocationResult{0, 0, {}});
     
-    for (size_t i = 0; i < numWords; i++) {
-        uint64_t value = data[i];
-        
-        // Check if value looks like a pointer (within valid range)
-        if (value >= minAddr && value < maxAddr) {
-            result.pointersFound++;
-            
-            // Find containing region to determine appropriate offset
-            const MemoryRegion* region = findContainingRegion(value, checkpointMap);
-            if (!region) {
-                continue;
-            }
-            
-            // In conservative mode, only relocate pointers to code/stack/heap
-            if (conservative) {
-                RegionType type = identifyRegionType(*region);
-                if (type != RegionType::CODE && type != RegionType::STACK && 
-                    type != RegionType::HEAP) {
-                    continue;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, dumps.size()));
+    
+    if (threads <= 1) {
+        for (size_t d = 0; d < dumps.size(); ++d) {
+            scanDump(dumps[d], table, partial[d]);
+        }
+    } else {
+        // Dump'lar boyutça dengesiz: worker'lar sıradakini atomik sayaçtan alır
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&dumps, &table, &partial, &next] {
+                for (size_t d = next++; d < dumps.size(); d = next++) {
+                    scanDump(dumps[d], table, partial[d]);
                 }
-            }
-            
-            // Translate the pointer
-            uint64_t translated = translateAddress(value, checkpointMap, offsets);
-            
-            if (translated != value) {
-                data[i] = translated;
-                result.pointersRelocated++;
-                result.relocatedAddresses.push_back(dump.region.startAddr + i * sizeof(uint64_t));
-            }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
         }
     }
     
+    for (auto& part : partial) {
+        result.pointersFound += part.pointersFound;
+        result.pointersRelocated += part.pointersRelocated;
+        result.relocatedAddresses.insert(result.relocatedAddresses.end(),
+                                         part.relocatedAddresses.begin(),
+                                         part.relocatedAddresses.end());
+    }
     return result;
 }
 
@@ -0,0 +1,893 @@
+#include "real_process/checkpoint_daemon.hpp"
+#include "real_process/checkpoint_stream.hpp"
+#include "real_process/dump_buffer_pool.hpp"
+#include "core/metrics.hpp"
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
+namespace checkpoint {
+namespace real_process {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr const char* IMAGE_EXTENSION = ".chkpt";
+constexpr const char* PART_SUFFIX = ".part";
+
+void setError(std::string* error, std::string message) {
+    if (error) *error = std::move(message);
+}
+
+bool validJobName(const std::string& name) {
+    return !name.empty() && std::all_of(name.begin(), name.end(), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-';
+    });
+}
+
+// "64M", "512K", "1G", "1000"
+bool parseSize(const std::string& text, uint64_t& value) {
+    if (text.empty()) return false;
+    size_t used = 0;
+    double number = 0;
+    try {
+        number = std::stod(text, &used);
+    } catch (const std::exception&) {
+        return false;
+    }
+    std::string unit = text.substr(used);
+    uint64_t scale = 1;
+    if (unit == "K" || unit == "k") scale = 1024;
+    else if (unit == "M" || unit == "m") scale = 1024 * 1024;
+    else if (unit == "G" || unit == "g") scale = 1024ull * 1024 * 1024;
+    else if (!unit.empty()) return false;
+    if (number < 0) return false;
+    value = static_cast<uint64_t>(number * scale);
+    return true;
+}
+
+// "250ms", "30s", "5m", "1h"; son ek yoksa saniye
+bool parseDuration(const std::string& text, std::chrono::milliseconds& value) {
+    size_t used = 0;
+    double number = 0;
+    try {
+        number = std::stod(text, &used);
+    } catch (const std::exception&) {
+        return false;
+    }
+    std::string unit = text.substr(used);
+    double ms = 0;
+    if (unit == "ms") ms = number;
+    else if (unit == "s" || unit.empty()) ms = number * 1000;
+    else if (unit == "m") ms = number * 60 * 1000;
+    else if (unit == "h") ms = number * 3600 * 1000;
+    else return false;
+    if (ms < 1) return false;
+    value = std::chrono::milliseconds(static_cast<int64_t>(ms));
+    return true;
+}
+
+bool parseUnsigned(const std::string& text, uint64_t& value) {
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) {
+        return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    })) return false;
+    try {
+        value = std::stoull(text);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+bool parseSwitch(const std::string& text, bool& value) {
+    if (text == "on" || text == "true" || text == "1") { value = true; return true; }
+    if (text == "off" || text == "false" || text == "0") { value = false; return true; }
+    return false;
+}
+
+uint64_t threadCpuNanos() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+std::string resolveCgroup(const std::string& cgroup) {
+    return cgroup.empty() || cgroup[0] == '/' ? cgroup : "/sys/fs/cgroup/" + cgroup;
+}
+
+std::vector<std::string> splitWords(const std::string& line) {
+    std::vector<std::string> words;
+    std::istringstream in(line);
+    std::string word;
+    while (in >> word) words.push_back(word);
+    return words;
+}
+
+bool sendAll(int fd, const std::string& text) {
+    const char* p = text.data();
+    size_t left = text.size();
+    while (left > 0) {
+        ssize_t n = ::send(fd, p, left, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// ============================================================================
+// Throttled File Sink - dump yazımlarını io_limit'e göre kısar
+// ============================================================================
+// Her dump yazılmadan önce payload boyu kadar token alınır; header ve
+// trailer kısılmaz.
+class ThrottledFileSink : public ICheckpointSink {
+public:
+    explicit ThrottledFileSink(RateLimiter& limiter) : m_limiter(limiter) {}
+
+    bool open(const std::string& filepath) { return m_writer.open(filepath); }
+    void close() { m_writer.close(); }
+
+    bool writeHeader(const RealProcessCheckpoint& checkpoint) override {
+        return m_writer.writeHeader(checkpoint);
+    }
+
+    bool writeDump(const MemoryDump& dump) override {
+        if (dump.hasContent()) {
+            m_limiter.acquire(dump.payloadSize());
+        }
+        return m_writer.writeDump(dump);
+    }
+
+    bool finish(const SignalInfo& signals) override { return m_writer.finish(signals); }
+    std::string getLastError() const override { return m_writer.getLastError(); }
+
+    uint64_t bytesWritten() const { return m_writer.bytesWritten(); }
+
+private:
+    RateLimiter& m_limiter;
+    CheckpointStreamWriter m_writer;
+};
+
+} // namespace
+
+// ============================================================================
+// DaemonPolicy
+// ============================================================================
+
+DaemonPolicy::DaemonPolicy() {
+    checkpoint.forkSnapshot = true;
+}
+
+const DaemonJob* DaemonPolicy::job(const std::string& name) const {
+    for (const auto& entry : jobs) {
+        if (entry.name == name) return &entry;
+    }
+    return nullptr;
+}
+
+std::optional<DaemonPolicy> DaemonPolicy::parse(const std::string& text, std::string* error) {
+    DaemonPolicy policy;
+    std::istringstream in(text);
+    std::string line;
+    size_t lineNo = 0;
+
+    auto fail = [&](const std::string& message) {
+        setError(error, "line " + std::to_string(lineNo) + ": " + message);
+        return std::nullopt;
+    };
+
+    while (std::getline(in, line)) {
+        ++lineNo;
+        line = line.substr(0, line.find('#'));
+        auto words = splitWords(line);
+        if (words.empty()) continue;
+
+        const std::string& key = words[0];
+        uint64_t number = 0;
+
+        if (key == "job") {
+            // job <ad> pid <pid>|cgroup <yol> every <süre> [keep <n>]
+            if (words.size() != 6 && words.size() != 8) {
+                return fail("expected 'job <name> pid|cgroup <target> every <interval> [keep <n>]'");
+            }
+            DaemonJob job;
+            job.name = words[1];
+            if (!validJobName(job.name)) return fail("invalid job name '" + job.name + "'");
+            if (policy.job(job.name)) return fail("duplicate job '" + job.name + "'");
+
+            if (words[2] == "pid") {
+                if (!parseUnsigned(words[3], number) || number == 0) return fail("invalid pid");
+                job.target = DaemonJob::Target::Pid;
+                job.pid = static_cast<pid_t>(number);
+            } else if (words[2] == "cgroup") {
+                job.target = DaemonJob::Target::Cgroup;
+                job.cgroup = words[3];
+            } else {
+                return fail("unknown target '" + words[2] + "'");
+            }
+
+            if (words[4] != "every" || !parseDuration(words[5], job.interval)) {
+                return fail("invalid interval");
+            }
+            if (words.size() == 8) {
+                if (words[6] != "keep" || !parseUnsigned(words[7], number)) return fail("invalid keep");
+                job.keep = static_cast<unsigned>(number);
+            }
+            policy.jobs.push_back(std::move(job));
+            continue;
+        }
+
+        if (words.size() != 2) return fail("expected '" + key + " <value>'");
+        const std::string& value = words[1];
+
+        if (key == "directory") {
+            policy.directory = value;
+        } else if (key == "socket") {
+            policy.controlSocket = value;
+        } else if (key == "workers") {
+            if (!parseUnsigned(value, number) || number == 0) return fail("invalid worker count");
+            policy.workers = static_cast<unsigned>(number);
+        } else if (key == "queue") {
+            if (!parseUnsigned(value, number) || number == 0) return fail("invalid queue limit");
+            policy.queueLimit = static_cast<size_t>(number);
+        } else if (key == "io_limit") {
+            if (!parseSize(value, policy.ioBytesPerSec)) return fail("invalid io_limit");
+        } else if (key == "cpu_limit") {
+            try {
+                policy.cpuCores = std::stod(value);
+            } catch (const std::exception&) {
+                return fail("invalid cpu_limit");
+            }
+            if (policy.cpuCores < 0) return fail("invalid cpu_limit");
+        } else if (key == "fork_snapshot") {
+            if (!parseSwitch(value, policy.checkpoint.forkSnapshot)) return fail("expected on/off");
+        } else {
+            return fail("unknown key '" + key + "'");
+        }
+    }
+
+    return policy;
+}
+
+std::optional<DaemonPolicy> DaemonPolicy::load(const std::string& filepath, std::string* error) {
+    std::ifstream in(filepath);
+    if (!in) {
+        setError(error, "Cannot open policy file: " + filepath);
+        return std::nullopt;
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    return parse(text.str(), error);
+}
+
+// ============================================================================
+// RateLimiter
+// ============================================================================
+
+RateLimiter::RateLimiter(double ratePerSec, double burstSeconds)
+    : m_rate(std::max(ratePerSec, 0.0)),
+      m_capacity(m_rate * std::max(burstSeconds, 0.0)),
+      m_tokens(m_capacity),
+      m_last(Clock::now()) {}
+
+void RateLimiter::refill() {
+    auto now = Clock::now();
+    double elapsed = std::chrono::duration<double>(now - m_last).count();
+    m_tokens = std::min(m_capacity, m_tokens + elapsed * m_rate);
+    m_last = now;
+}
+
+void RateLimiter::acquire(uint64_t amount) {
+    if (!isLimited()) return;
+
+    // Rezervasyon: token şimdi düşülür, çağıran kendi payının borcu
+    // ödenene kadar bekler. Eşzamanlı çağıranlar sırayla ilerler.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_cancelled) return;
+    refill();
+    m_tokens -= static_cast<double>(amount);
+    if (m_tokens >= 0) return;
+
+    auto deadline = m_last + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(-m_tokens / m_rate));
+    m_cv.wait_until(lock, deadline, [this] { return m_cancelled; });
+}
+
+void RateLimiter::charge(uint64_t amount) {
+    if (!isLimited()) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refill();
+    m_tokens -= static_cast<double>(amount);
+}
+
+void RateLimiter::setCancelled(bool cancelled) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled = cancelled;
+    }
+    m_cv.notify_all();
+}
+
+// ============================================================================
+// CheckpointDaemon
+// ============================================================================
+
+CheckpointDaemon::CheckpointDaemon(DaemonPolicy policy)
+    : m_policy(std::move(policy)),
+      m_ioLimiter(static_cast<double>(m_policy.ioBytesPerSec)),
+      m_cpuLimiter(m_policy.cpuCores * 1e9),
+      m_bufferPool(std::make_shared<DumpBufferPool>()) {}
+
+CheckpointDaemon::~CheckpointDaemon() {
+    stop();
+}
+
+bool CheckpointDaemon::isRunning() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_running;
+}
+
+bool CheckpointDaemon::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running) return true;
+
+    std::error_code ec;
+    fs::create_directories(m_policy.directory, ec);
+    if (ec) {
+        m_lastError = "Cannot create " + m_policy.directory + ": " + ec.message();
+        return false;
+    }
+
+    if (!m_policy.controlSocket.empty()) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (m_policy.controlSocket.size() >= sizeof(addr.sun_path)) {
+            m_lastError = "Control socket path too long";
+            return false;
+        }
+        std::memcpy(addr.sun_path, m_policy.controlSocket.c_str(), m_policy.controlSocket.size() + 1);
+
+        // Önceki çalışmadan kalan socket silinir; başka bir dosyaya dokunulmaz
+        struct stat st{};
+        if (::lstat(m_policy.controlSocket.c_str(), &st) == 0) {
+            if (!S_ISSOCK(st.st_mode)) {
+                m_lastError = "Control socket path exists and is not a socket: " + m_policy.controlSocket;
+                return false;
+            }
+            ::unlink(m_policy.controlSocket.c_str());
+        }
+
+        m_listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        m_wakeFd = eventfd(0, EFD_CLOEXEC);
+        bool bound = false;
+        if (m_listenFd >= 0 && m_wakeFd >= 0) {
+            // Socket restore isteği kabul eder: sadece sahibi bağlanabilsin
+            mode_t oldMask = ::umask(0177);
+            bound = ::bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+            ::umask(oldMask);
+            bound = bound && ::chmod(m_policy.controlSocket.c_str(), 0600) == 0 &&
+                    ::listen(m_listenFd, 16) == 0;
+        }
+        if (!bound) {
+            m_lastError = "Cannot listen on " + m_policy.controlSocket + ": " + std::strerror(errno);
+            if (m_listenFd >= 0) ::close(m_listenFd);
+            if (m_wakeFd >= 0) ::close(m_wakeFd);
+            m_listenFd = m_wakeFd = -1;
+            return false;
+        }
+    }
+
+    m_ioLimiter.setCancelled(false);
+    m_cpuLimiter.setCancelled(false);
+    m_stopping = false;
+    m_running = true;
+
+    auto now = Clock::now();
+    for (const auto& job : m_policy.jobs) {
+        m_jobStates[job.name].nextDue = now;
+    }
+
+    for (unsigned i = 0; i < std::max(1u, m_policy.workers); ++i) {
+        m_workers.emplace_back(&CheckpointDaemon::workerLoop, this);
+    }
+    m_scheduler = std::thread(&CheckpointDaemon::schedulerLoop, this);
+    if (m_listenFd >= 0) {
+        m_control = std::thread(&CheckpointDaemon::controlLoop, this);
+    }
+    return true;
+}
+
+void CheckpointDaemon::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running || m_stopping) return;
+        m_stopping = true;
+        // Bekleyen senkron çağrılar broken_promise ile uyanır
+        m_tasks.clear();
+    }
+    m_ioLimiter.setCancelled(true);
+    m_cpuLimiter.setCancelled(true);
+    m_taskCv.notify_all();
+    m_scheduleCv.notify_all();
+    m_activeCv.notify_all();
+    if (m_wakeFd >= 0) {
+        uint64_t one = 1;
+        [[maybe_unused]] ssize_t n = ::write(m_wakeFd, &one, sizeof(one));
+    }
+
+    for (auto& worker : m_workers) worker.join();
+    m_workers.clear();
+    if (m_scheduler.joinable()) m_scheduler.join();
+    if (m_control.joinable()) m_control.join();
+
+    if (m_listenFd >= 0) {
+        ::close(m_listenFd);
+        ::unlink(m_policy.controlSocket.c_str());
+    }
+    if (m_wakeFd >= 0) ::close(m_wakeFd);
+    m_listenFd = m_wakeFd = -1;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_inFlight.clear();
+    m_active.clear();
+    m_running = false;
+    m_stopping = false;
+}
+
+CheckpointDaemon::Stats CheckpointDaemon::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.queued = m_tasks.size();
+    return stats;
+}
+
+bool CheckpointDaemon::enqueueLocked(Task task) {
+    if (!m_running || m_stopping || m_tasks.size() >= m_policy.queueLimit) {
+        return false;
+    }
+    m_tasks.push_back(std::move(task));
+    m_taskCv.notify_one();
+    return true;
+}
+
+bool CheckpointDaemon::claimPid(pid_t pid) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_activeCv.wait(lock, [&] { return m_stopping || !m_active.count(pid); });
+    if (m_stopping) return false;
+    m_active.insert(pid);
+    return true;
+}
+
+void CheckpointDaemon::releasePid(pid_t pid) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_active.erase(pid);
+    }
+    m_activeCv.notify_all();
+}
+
+void CheckpointDaemon::workerLoop() {
+    RealProcessCheckpointer checkpointer;
+    checkpointer.setBufferPool(m_bufferPool);
+    checkpointer.setMetricsRegistry(*m_metrics);
+
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskCv.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+            if (m_stopping) return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_stats.running++;
+        }
+        task(checkpointer);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.running--;
+    }
+}
+
+std::vector<pid_t> CheckpointDaemon::readCgroupPids(const std::string& cgroup) {
+    std::vector<pid_t> pids;
+    std::ifstream in(resolveCgroup(cgroup) + "/cgroup.procs");
+    pid_t pid = 0;
+    while (in >> pid) {
+        pids.push_back(pid);
+    }
+    return pids;
+}
+
+std::vector<pid_t> CheckpointDaemon::jobPids(const DaemonJob& job) const {
+    std::vector<pid_t> pids;
+    if (job.target == DaemonJob::Target::Pid) {
+        if (::kill(job.pid, 0) == 0 || errno == EPERM) pids.push_back(job.pid);
+        return pids;
+    }
+    // Daemon kendi cgroup'unu izliyor olabilir: kendini ptrace edemez
+    for (pid_t pid : readCgroupPids(job.cgroup)) {
+        if (pid != ::getpid()) pids.push_back(pid);
+    }
+    return pids;
+}
+
+void CheckpointDaemon::schedulerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping) {
+        auto now = Clock::now();
+        auto next = now + std::chrono::hours(1);
+
+        for (const auto& job : m_policy.jobs) {
+            auto& state = m_jobStates[job.name];
+            if (state.nextDue <= now) {
+                // Kaymayı önle: geride kaldıysa bir sonraki turu şimdiden say
+                state.nextDue += job.interval;
+                if (state.nextDue <= now) state.nextDue = now + job.interval;
+
+                lock.unlock();
+                auto pids = jobPids(job);
+                lock.lock();
+                if (m_stopping) return;
+
+                if (pids.empty()) {
+                    state.failures++;
+                    m_stats.failures++;
+                }
+                for (pid_t pid : pids) {
+                    if (m_inFlight.count(pid) || m_tasks.size() >= m_policy.queueLimit) {
+                        m_stats.dropped++;
+                        continue;
+                    }
+                    m_inFlight.insert(pid);
+                    enqueueLocked([this, name = job.name, pid](RealProcessCheckpointer& checkpointer) {
+                        takeSnapshot(checkpointer, name, pid);
+                        std::lock_guard<std::mutex> done(m_mutex);
+                        m_inFlight.erase(pid);
+                    });
+                }
+            }
+            next = std::min(next, state.nextDue);
+        }
+
+        m_scheduleCv.wait_until(lock, next, [this] { return m_stopping; });
+    }
+}
+
+CheckpointDaemon::Snapshot CheckpointDaemon::takeSnapshot(RealProcessCheckpointer& checkpointer,
+                                                          const std::string& jobName, pid_t pid) {
+    TraceScope trace("daemon.snapshot", *m_metrics);
+    Snapshot snapshot;
+    snapshot.pid = pid;
+
+    if (!claimPid(pid)) {
+        snapshot.error = "Daemon stopped";
+        return snapshot;
+    }
+
+    // Önceki işlerin CPU borcu ödenene kadar bekle
+    trace.stage("cpu_wait");
+    m_cpuLimiter.acquire(0);
+
+    trace.stage("capture");
+    uint64_t cpuStart = threadCpuNanos();
+    auto epochMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::ostringstream name;
+    name << jobName << "." << pid << "." << std::setw(13) << std::setfill('0') << epochMs;
+    std::string prefix = jobName + "." + std::to_string(pid) + ".";
+    std::string path = (fs::path(m_policy.directory) / (name.str() + IMAGE_EXTENSION)).string();
+    std::string partPath = path + PART_SUFFIX;
+
+    ThrottledFileSink sink(m_ioLimiter);
+    if (!sink.open(partPath)) {
+        snapshot.error = "Cannot create " + partPath + ": " + sink.getLastError();
+    } else {
+        auto checkpoint = checkpointer.createCheckpointToSink(pid, sink, name.str(), m_policy.checkpoint);
+        sink.close();
+        if (!checkpoint) {
+            snapshot.error = checkpointer.getLastError();
+            ::unlink(partPath.c_str());
+        } else if (::rename(partPath.c_str(), path.c_str()) != 0) {
+            snapshot.error = "Cannot rename " + partPath + ": " + std::strerror(errno);
+            ::unlink(partPath.c_str());
+        } else {
+            snapshot.success = true;
+            snapshot.path = path;
+            snapshot.bytes = sink.bytesWritten();
+        }
+    }
+    m_cpuLimiter.charge(threadCpuNanos() - cpuStart);
+    releasePid(pid);
+
+    size_t removed = 0;
+    if (snapshot.success) {
+        trace.stage("retention");
+        const DaemonJob* job = m_policy.job(jobName);
+        removed = applyRetention(m_policy.directory, prefix, job ? job->keep : 0);
+        trace.count("bytes_written", snapshot.bytes);
+        trace.count("files_removed", removed);
+        trace.succeed();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto state = m_jobStates.find(jobName);
+    if (snapshot.success) {
+        m_stats.snapshots++;
+        m_stats.bytesWritten += snapshot.bytes;
+        m_stats.filesRemoved += removed;
+        if (state != m_jobStates.end()) {
+            state->second.runs++;
+            state->second.lastPath = snapshot.path;
+        }
+    } else {
+        m_stats.failures++;
+        if (state != m_jobStates.end()) state->second.failures++;
+    }
+    return snapshot;
+}
+
+size_t CheckpointDaemon::applyRetention(const std::string& directory, const std::string& prefix,
+                                        unsigned keep) {
+    if (keep == 0) return 0;
+
+    std::vector<fs::path> images;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (entry.path().extension() == IMAGE_EXTENSION && name.compare(0, prefix.size(), prefix) == 0) {
+            images.push_back(entry.path());
+        }
+    }
+    if (images.size() <= keep) return 0;
+
+    // Zaman damgası sabit genişlikte: ad sırası = zaman sırası
+    std::sort(images.begin(), images.end());
+    size_t removed = 0;
+    for (size_t i = 0; i + keep < images.size(); ++i) {
+        if (fs::remove(images[i], ec)) removed++;
+    }
+    return removed;
+}
+
+std::vector<std::string> CheckpointDaemon::listImages(const std::string& jobName) const {
+    std::vector<std::string> names;
+    std::string prefix = jobName.empty() ? "" : jobName + ".";
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(m_policy.directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (entry.path().extension() == IMAGE_EXTENSION && name.compare(0, prefix.size(), prefix) == 0) {
+            names.push_back(name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+CheckpointDaemon::Snapshot CheckpointDaemon::snapshotPid(pid_t pid, const std::string& jobName) {
+    auto promise = std::make_shared<std::promise<Snapshot>>();
+    auto future = promise->get_future();
+    Snapshot failed;
+    failed.pid = pid;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool queued = enqueueLocked([this, promise, jobName, pid](RealProcessCheckpointer& checkpointer) {
+            promise->set_value(takeSnapshot(checkpointer, jobName, pid));
+        });
+        if (!queued) {
+            failed.error = m_running ? "Snapshot queue is full" : "Daemon is not running";
+            return failed;
+        }
+    }
+    try {
+        return future.get();
+    } catch (const std::future_error&) {
+        failed.error = "Daemon stopped";
+        return failed;
+    }
+}
+
+std::vector<CheckpointDaemon::Snapshot> CheckpointDaemon::snapshotJob(const std::string& jobName) {
+    std::vector<Snapshot> snapshots;
+    const DaemonJob* job = m_policy.job(jobName);
+    if (!job) {
+        Snapshot failed;
+        failed.error = "Unknown job: " + jobName;
+        snapshots.push_back(failed);
+        return snapshots;
+    }
+    for (pid_t pid : jobPids(*job)) {
+        snapshots.push_back(snapshotPid(pid, jobName));
+    }
+    return snapshots;
+}
+
+RestoreResult CheckpointDaemon::restore(const std::string& filepath, pid_t pid) {
+    fs::path path(filepath);
+    if (path.is_relative()) path = fs::path(m_policy.directory) / path;
+
+    auto promise = std::make_shared<std::promise<RestoreResult>>();
+    auto future = promise->get_future();
+    RestoreResult failed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool queued = enqueueLocked([this, promise, path, pid](RealProcessCheckpointer& checkpointer) {
+            TraceScope trace("daemon.restore", *m_metrics);
+            RestoreResult result;
+            trace.stage("load");
+            auto checkpoint = checkpointer.loadCheckpoint(path.string());
+            if (!checkpoint) {
+                result.errorMessage = "Cannot load " + path.string() + ": " + checkpointer.getLastError();
+            } else if (!claimPid(pid)) {
+                result.errorMessage = "Daemon stopped";
+            } else {
+                trace.stage("restore");
+                result = checkpointer.restoreCheckpointEx(pid, *checkpoint, m_policy.restore);
+                releasePid(pid);
+            }
+            if (result.success) {
+                trace.succeed();
+                std::lock_guard<std::mutex> done(m_mutex);
+                m_stats.restores++;
+            }
+            promise->set_value(std::move(result));
+        });
+        if (!queued) {
+            failed.errorMessage = m_running ? "Snapshot queue is full" : "Daemon is not running";
+            return failed;
+        }
+    }
+    try {
+        return future.get();
+    } catch (const std::future_error&) {
+        failed.errorMessage = "Daemon stopped";
+        return failed;
+    }
+}
+
+// ============================================================================
+// Kontrol protokolü
+// ============================================================================
+
+std::string CheckpointDaemon::handleCommand(const std::string& line) {
+    auto args = splitWords(line);
+    if (args.empty()) return "ERR empty command\n";
+
+    std::ostringstream out;
+    const std::string& cmd = args[0];
+
+    if (cmd == "status") {
+        auto s = stats();
+        out << "OK snapshots=" << s.snapshots << " failures=" << s.failures
+            << " dropped=" << s.dropped << " bytes=" << s.bytesWritten
+            << " removed=" << s.filesRemoved << " restores=" << s.restores
+            << " queued=" << s.queued << " running=" << s.running << "\n";
+    } else if (cmd == "jobs") {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& job : m_policy.jobs) {
+            const auto& state = m_jobStates[job.name];
+            out << job.name << " "
+                << (job.target == DaemonJob::Target::Pid ? "pid " + std::to_string(job.pid)
+                                                         : "cgroup " + job.cgroup)
+                << " every=" << job.interval.count() << "ms keep=" << job.keep
+                << " runs=" << state.runs << " failures=" << state.failures;
+            if (!state.lastPath.empty()) out << " last=" << fs::path(state.lastPath).filename().string();
+            out << "\n";
+        }
+        out << "OK " << m_policy.jobs.size() << " jobs\n";
+    } else if (cmd == "snapshot" && (args.size() == 2 || (args.size() == 3 && args[1] == "pid"))) {
+        std::vector<Snapshot> snapshots;
+        if (args.size() == 3) {
+            uint64_t pid = 0;
+            if (!parseUnsigned(args[2], pid) || pid == 0) return "ERR invalid pid\n";
+            snapshots.push_back(snapshotPid(static_cast<pid_t>(pid)));
+        } else {
+            snapshots = snapshotJob(args[1]);
+        }
+        size_t failed = 0;
+        for (const auto& snapshot : snapshots) {
+            if (snapshot.success) {
+                out << snapshot.pid << " " << fs::path(snapshot.path).filename().string()
+                    << " " << snapshot.bytes << "\n";
+            } else {
+                failed++;
+                out << snapshot.pid << " failed: " << snapshot.error << "\n";
+            }
+        }
+        if (snapshots.empty()) out << "ERR no running process for job\n";
+        else if (failed) out << "ERR " << failed << " of " << snapshots.size() << " snapshots failed\n";
+        else out << "OK " << snapshots.size() << " snapshots\n";
+    } else if (cmd == "list" && args.size() <= 2) {
+        auto images = listImages(args.size() == 2 ? args[1] : "");
+        for (const auto& image : images) out << image << "\n";
+        out << "OK " << images.size() << " images\n";
+    } else if (cmd == "restore" && args.size() == 3) {
+        uint64_t pid = 0;
+        if (!parseUnsigned(args[2], pid) || pid == 0) return "ERR invalid pid\n";
+        auto result = restore(args[1], static_cast<pid_t>(pid));
+        for (const auto& warning : result.warnings) out << "warning: " << warning << "\n";
+        if (result.success) {
+            out << "OK restored " << result.memoryRegionsRestored << " regions, "
+                << result.bytesWritten << " bytes\n";
+        } else {
+            out << "ERR " << result.errorMessage << "\n";
+        }
+    } else if (cmd == "metrics") {
+        out << m_metrics->toOpenMetrics() << "OK\n";
+    } else {
+        out << "ERR unknown command: " << line << "\n";
+    }
+    return out.str();
+}
+
+void CheckpointDaemon::controlLoop() {
+    while (true) {
+        pollfd fds[2] = {{m_listenFd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        int ready = ::poll(fds, 2, -1);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready < 0 || fds[1].revents) return;
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        int fd = ::accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) continue;
+
+        // Dosya izni yanında: sadece root ya da daemon'ın kullanıcısı
+        ucred peer{};
+        socklen_t len = sizeof(peer);
+        if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &peer, &len) != 0 ||
+            (peer.uid != 0 && peer.uid != ::geteuid())) {
+            sendAll(fd, "ERR permission denied\n");
+            ::close(fd);
+            continue;
+        }
+        serveConnection(fd);
+        ::close(fd);
+    }
+}
+
+void CheckpointDaemon::serveConnection(int fd) {
+    std::string buffer;
+    char chunk[4096];
+    while (true) {
+        size_t nl;
+        while ((nl = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, nl);
+            buffer.erase(0, nl + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line == "quit") {
+                sendAll(fd, "OK bye\n");
+                return;
+            }
+            if (!sendAll(fd, handleCommand(line))) return;
+        }
+
+        pollfd fds[2] = {{fd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        int ready = ::poll(fds, 2, CONTROL_IDLE_MS);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0 || fds[1].revents) return;
+
+        ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return;
+        buffer.append(chunk, static_cast<size_t>(n));
+        if (buffer.size() > 64 * 1024) return;      // Satır sonu olmayan çöp
+    }
+}
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,411 @@
+#include "real_process/checkpoint_image.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+
+namespace checkpoint {
+namespace real_process {
+
+namespace {
+
+constexpr char INDEX_MAGIC[8] = {'R', 'C', 'H', 'K', 'I', 'D', 'X', '\0'};
+
+// start + end + flags + offset + size + crc32c
+constexpr size_t INDEX_ENTRY_SIZE = 8 + 8 + 1 + 8 + 8 + 4;
+
+struct ImageFooter {
+    uint64_t indexOffset;
+    uint32_t dumpCount;
+    uint32_t reserved;
+    char magic[8];
+};
+static_assert(sizeof(ImageFooter) == 24, "footer layout is part of the file format");
+
+template<typename T>
+void appendPod(std::vector<uint8_t>& data, const T& value) {
+    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&value),
+                reinterpret_cast<const uint8_t*>(&value) + sizeof(T));
+}
+
+template<typename T>
+T loadPod(const uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+// ============================================================================
+// CheckpointImageWriter
+// ============================================================================
+
+CheckpointImageWriter::CheckpointImageWriter()
+    : m_fd(-1), m_headerWritten(false), m_finished(false), m_offset(0) {
+}
+
+CheckpointImageWriter::~CheckpointImageWriter() {
+    close();
+}
+
+bool CheckpointImageWriter::open(const std::string& filepath) {
+    close();
+
+    m_fd = ::open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        m_lastError = "Failed to open file for writing: " + filepath +
+                      " (" + std::strerror(errno) + ")";
+        return false;
+    }
+
+    m_headerWritten = false;
+    m_finished = false;
+    m_offset = 0;
+    m_index.clear();
+    return true;
+}
+
+bool CheckpointImageWriter::open(const std::string& filepath, const IoEngineOptions& io) {
+    close();
+
+    auto async = std::make_unique<AsyncFileWriter>(io);
+    if (!async->open(filepath)) {
+        m_lastError = async->getLastError();
+        return false;
+    }
+
+    m_async = std::move(async);
+    m_headerWritten = false;
+    m_finished = false;
+    m_offset = 0;
+    m_index.clear();
+    return true;
+}
+
+void CheckpointImageWriter::close() {
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+    m_fd = -1;
+    m_async.reset();
+}
+
+bool CheckpointImageWriter::writeAll(const void* data, size_t size) {
+    if (m_async) {
+        if (!m_async->write(data, size)) {
+            m_lastError = m_async->getLastError();
+            return false;
+        }
+        m_offset += size;
+        return true;
+    }
+
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(m_fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("Write failed: ") + std::strerror(errno);
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+        m_offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+bool CheckpointImageWriter::padToAlignment() {
+    static const uint8_t zeros[PAYLOAD_ALIGNMENT] = {};
+    uint64_t rem = m_offset % PAYLOAD_ALIGNMENT;
+    return rem == 0 || writeAll(zeros, PAYLOAD_ALIGNMENT - rem);
+}
+
+bool CheckpointImageWriter::writeHeader(const RealProcessCheckpoint& checkpoint) {
+    if (!isOpen()) {
+        m_lastError = "Image not open";
+        return false;
+    }
+    if (m_headerWritten) {
+        m_lastError = "Header already written";
+        return false;
+    }
+
+    // İndeksli imajda dump sayısı footer'dadır
+    auto header = checkpoint.serializeHeader(0, RealProcessCheckpoint::INDEXED_FORMAT_VERSION);
+    if (!writeAll(header.data(), header.size())) return false;
+
+    m_headerWritten = true;
+    return true;
+}
+
+bool CheckpointImageWriter::writeDump(const MemoryDump& dump) {
+    if (!m_headerWritten || m_finished) {
+        m_lastError = "writeDump outside of the dump section";
+        return false;
+    }
+
+    if (!dump.hasContent()) {
+        return true;
+    }
+
+    // Sayfa id'leri mapping'den doğrudan restore edilemez
+    if (dump.isDeduplicated()) {
+        m_lastError = "Deduplicated dumps must be rehydrated before writing an indexed image";
+        return false;
+    }
+
+    if (!dump.zeroFill && !padToAlignment()) return false;
+
+    IndexEntry entry;
+    entry.startAddr = dump.region.startAddr;
+    entry.endAddr = dump.region.endAddr;
+    entry.flags = RealProcessCheckpoint::dumpFlags(dump);
+    entry.offset = m_offset;
+    entry.size = dump.data.size();
+    entry.checksum = crc32c(dump.data.data(), dump.data.size());
+
+    if (!writeAll(dump.data.data(), dump.data.size())) return false;
+
+    m_index.push_back(entry);
+    return true;
+}
+
+bool CheckpointImageWriter::finish(const SignalInfo& signals) {
+    if (!m_headerWritten || m_finished) {
+        m_lastError = "finish called twice or before writeHeader";
+        return false;
+    }
+
+    ImageFooter footer{};
+    footer.indexOffset = m_offset;
+    footer.dumpCount = static_cast<uint32_t>(m_index.size());
+    std::memcpy(footer.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+
+    std::vector<uint8_t> tail;
+    tail.reserve(m_index.size() * INDEX_ENTRY_SIZE + sizeof(signals) + sizeof(footer));
+    for (const auto& entry : m_index) {
+        appendPod(tail, entry.startAddr);
+        appendPod(tail, entry.endAddr);
+        appendPod(tail, entry.flags);
+        appendPod(tail, entry.offset);
+        appendPod(tail, entry.size);
+        appendPod(tail, entry.checksum);
+    }
+    appendPod(tail, signals);
+    appendPod(tail, footer);
+
+    if (!writeAll(tail.data(), tail.size())) return false;
+    if (m_async && !m_async->finish()) {
+        m_lastError = m_async->getLastError();
+        return false;
+    }
+
+    m_finished = true;
+    return true;
+}
+
+// ============================================================================
+// MappedCheckpointImage
+// ============================================================================
+
+MappedCheckpointImage::MappedCheckpointImage()
+    : m_fd(-1), m_base(nullptr), m_size(0) {
+}
+
+MappedCheckpointImage::~MappedCheckpointImage() {
+    close();
+}
+
+void MappedCheckpointImage::close() {
+    if (m_base) {
+        munmap(const_cast<uint8_t*>(m_base), m_size);
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+    m_fd = -1;
+    m_base = nullptr;
+    m_size = 0;
+    m_path.clear();
+    m_metadata = RealProcessCheckpoint();
+    m_entries.clear();
+    m_byAddress.clear();
+}
+
+bool MappedCheckpointImage::isIndexedImage(const std::string& filepath) {
+    int fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    uint8_t head[8];
+    bool ok = (pread(fd, head, sizeof(head), 0) == static_cast<ssize_t>(sizeof(head)));
+    ::close(fd);
+
+    return ok && std::memcmp(head, "RCHK", 4) == 0 &&
+           RealProcessCheckpoint::isIndexedVersion(loadPod<uint32_t>(head + 4));
+}
+
+bool MappedCheckpointImage::open(const std::string& filepath) {
+    close();
+
+    m_fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        m_lastError = "Failed to open file: " + filepath;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(m_fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ImageFooter))) {
+        m_lastError = "Checkpoint image too small: " + filepath;
+        close();
+        return false;
+    }
+
+    // Header stream reader ile okunur (küçük, sıralı)
+    {
+        CheckpointStreamReader reader(m_fd);
+        auto header = reader.readHeader();
+        if (!header) {
+            m_lastError = "Failed to read image header: " + reader.getLastError();
+            close();
+            return false;
+        }
+        if (!RealProcessCheckpoint::isIndexedVersion(reader.version())) {
+            m_lastError = "Not an indexed checkpoint image (version " +
+                          std::to_string(reader.version()) + ")";
+            close();
+            return false;
+        }
+        m_metadata = std::move(*header);
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if (base == MAP_FAILED) {
+        m_lastError = std::string("mmap failed: ") + std::strerror(errno);
+        close();
+        return false;
+    }
+    m_base = static_cast<const uint8_t*>(base);
+    m_size = size;
+
+    std::error_code ec;
+    m_path = std::filesystem::absolute(filepath, ec).string();
+    if (ec) m_path = filepath;
+
+    ImageFooter footer;
+    std::memcpy(&footer, m_base + m_size - sizeof(footer), sizeof(footer));
+    if (std::memcmp(footer.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        m_lastError = "Checkpoint image footer missing (truncated file?)";
+        close();
+        return false;
+    }
+
+    uint64_t tailSize = static_cast<uint64_t>(footer.dumpCount) * INDEX_ENTRY_SIZE +
+                        sizeof(SignalInfo) + sizeof(ImageFooter);
+    if (footer.indexOffset > m_size || m_size - footer.indexOffset != tailSize) {
+        m_lastError = "Corrupt checkpoint image index";
+        close();
+        return false;
+    }
+
+    const uint8_t* p = m_base + footer.indexOffset;
+    m_entries.reserve(footer.dumpCount);
+    for (uint32_t i = 0; i < footer.dumpCount; ++i, p += INDEX_ENTRY_SIZE) {
+        Entry entry;
+        entry.region = MemoryRegion{};
+        entry.region.startAddr = loadPod<uint64_t>(p);
+        entry.region.endAddr = loadPod<uint64_t>(p + 8);
+        uint8_t flags = p[16];
+        entry.offset = loadPod<uint64_t>(p + 17);
+        entry.size = loadPod<uint64_t>(p + 25);
+        entry.checksum = loadPod<uint32_t>(p + 33);
+
+        if (entry.offset > footer.indexOffset || entry.size > footer.indexOffset - entry.offset) {
+            m_lastError = "Dump " + std::to_string(i) + " lies outside the payload area";
+            close();
+            return false;
+        }
+
+        // Dump'ı içeren region'dan pathname al
+        for (const auto& region : m_metadata.memoryMap) {
+            if (entry.region.startAddr >= region.startAddr &&
+                entry.region.endAddr <= region.endAddr) {
+                entry.region.pathname = region.pathname;
+                entry.region.offset = region.offset;
+                break;
+            }
+        }
+        MemoryDump flagged;
+        RealProcessCheckpoint::applyDumpFlags(flagged, flags);
+        entry.region.readable = flagged.region.readable;
+        entry.region.writable = flagged.region.writable;
+        entry.region.executable = flagged.region.executable;
+        entry.region.isPrivate = flagged.region.isPrivate;
+        entry.region.hugePages = flagged.region.hugePages;
+        entry.zeroFill = flagged.zeroFill;
+
+        m_entries.push_back(std::move(entry));
+    }
+    std::memcpy(&m_metadata.signals, p, sizeof(SignalInfo));
+
+    m_byAddress.resize(m_entries.size());
+    for (size_t i = 0; i < m_byAddress.size(); ++i) m_byAddress[i] = i;
+    std::sort(m_byAddress.begin(), m_byAddress.end(), [this](size_t a, size_t b) {
+        return m_entries[a].region.startAddr < m_entries[b].region.startAddr;
+    });
+
+    return true;
+}
+
+std::span<const uint8_t> MappedCheckpointImage::dumpData(size_t index) const {
+    const Entry& entry = m_entries[index];
+    return std::span<const uint8_t>(m_base + entry.offset, entry.size);
+}
+
+std::optional<size_t> MappedCheckpointImage::findDump(uint64_t addr) const {
+    auto it = std::upper_bound(m_byAddress.begin(), m_byAddress.end(), addr,
+        [this](uint64_t a, size_t i) { return a < m_entries[i].region.startAddr; });
+    if (it == m_byAddress.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    if (addr < m_entries[*it].region.endAddr) {
+        return *it;
+    }
+    return std::nullopt;
+}
+
+bool MappedCheckpointImage::verifyDump(size_t index) const {
+    auto data = dumpData(index);
+    return crc32c(data.data(), data.size()) == m_entries[index].checksum;
+}
+
+MemoryDump MappedCheckpointImage::loadDump(size_t index) const {
+    MemoryDump dump;
+    dump.region = m_entries[index].region;
+    dump.zeroFill = m_entries[index].zeroFill;
+    auto data = dumpData(index);
+    dump.data.assign(data.begin(), data.end());
+    dump.isValid = true;
+    return dump;
+}
+
+RealProcessCheckpoint MappedCheckpointImage::materialize() const {
+    RealProcessCheckpoint checkpoint = m_metadata;
+    checkpoint.memoryDumps.reserve(m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        checkpoint.memoryDumps.push_back(loadDump(i));
+    }
+    return checkpoint;
+}
+
+} // namespace real_process
+} // namespace checkpoint
@@ -0,0 +1,543 @@
+#include "real_process/checkpoint_stream.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstring>
+#include <algorithm>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// CheckpointStreamWriter
+// ============================================================================
+
+CheckpointStreamWriter::CheckpointStreamWriter()
+    : CheckpointStreamWriter(-1) {
+}
+
+CheckpointStreamWriter::CheckpointStreamWriter(int fd, size_t bufferSize)
+    : m_fd(fd), m_ownsFd(false), m_headerWritten(false), m_finished(false),
+      m_bufferSize(bufferSize), m_bytesWritten(0), m_dumpsWritten(0) {
+    m_buffer.reserve(m_bufferSize);
+}
+
+CheckpointStreamWriter::~CheckpointStreamWriter() {
+    close();
+}
+
+bool CheckpointStreamWriter::open(const std::string& filepath) {
+    close();
+
+    m_fd = ::open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        m_lastError = "Failed to open file for writing: " + filepath +
+                      " (" + std::strerror(errno) + ")";
+        return false;
+    }
+
+    m_ownsFd = true;
+    m_headerWritten = false;
+    m_finished = false;
+    m_bytesWritten = 0;
+    m_dumpsWritten = 0;
+    m_checksum.reset();
+    m_buffer.clear();
+    return true;
+}
+
+bool CheckpointStreamWriter::open(const std::string& filepath, const IoEngineOptions& io) {
+    close();
+
+    auto async = std::make_unique<AsyncFileWriter>(io);
+    if (!async->open(filepath)) {
+        m_lastError = async->getLastError();
+        return false;
+    }
+
+    m_async = std::move(async);
+    m_headerWritten = false;
+    m_finished = false;
+    m_bytesWritten = 0;
+    m_dumpsWritten = 0;
+    m_checksum.reset();
+    m_buffer.clear();
+    return true;
+}
+
+void CheckpointStreamWriter::close() {
+    if (m_fd >= 0) {
+        flushBuffer();
+        if (m_ownsFd) {
+            ::close(m_fd);
+        }
+    }
+    m_async.reset();
+    m_fd = -1;
+    m_ownsFd = false;
+}
+
+bool CheckpointStreamWriter::writeAll(const uint8_t* data, size_t size) {
+    m_checksum.update(data, size);
+    if (m_async) {
+        // Kendi tamponları var; kopyalayıp hemen döner
+        if (!m_async->write(data, size)) {
+            m_lastError = m_async->getLastError();
+            return false;
+        }
+        m_bytesWritten += size;
+        return true;
+    }
+    while (size > 0) {
+        ssize_t n = ::write(m_fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("Write failed: ") + std::strerror(errno);
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+        m_bytesWritten += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+bool CheckpointStreamWriter::flushBuffer() {
+    if (m_buffer.empty()) {
+        return true;
+    }
+    bool ok = writeAll(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+    return ok;
+}
+
+bool CheckpointStreamWriter::append(const uint8_t* data, size_t size) {
+    if (m_async) {
+        return writeAll(data, size);
+    }
+    if (m_buffer.size() + size > m_bufferSize) {
+        if (!flushBuffer()) return false;
+
+        // Tampondan büyük payload'ı kopyalamadan doğrudan yaz
+        if (size >= m_bufferSize) {
+            return writeAll(data, size);
+        }
+    }
+    m_buffer.insert(m_buffer.end(), data, data + size);
+    return true;
+}
+
+bool CheckpointStreamWriter::writeHeader(const RealProcessCheckpoint& checkpoint) {
+    if (!isOpen()) {
+        m_lastError = "Stream not open";
+        return false;
+    }
+    if (m_headerWritten) {
+        m_lastError = "Header already written";
+        return false;
+    }
+
+    auto header = checkpoint.serializeHeader(RealProcessCheckpoint::STREAMED_DUMP_COUNT);
+    if (!append(header.data(), header.size())) return false;
+
+    m_headerWritten = true;
+    return true;
+}
+
+bool CheckpointStreamWriter::writeDump(const MemoryDump& dump) {
+    if (!m_headerWritten || m_finished) {
+        m_lastError = "writeDump outside of the dump section";
+        return false;
+    }
+
+    // Boş dump end kaydıyla karışmasın
+    if (!dump.hasContent()) {
+        return true;
+    }
+
+    std::vector<uint8_t> recordHeader;
+    RealProcessCheckpoint::serializeDumpHeader(dump, recordHeader);
+    if (!append(recordHeader.data(), recordHeader.size())) return false;
+    if (!append(dump.payload(), dump.payloadSize())) return false;
+
+    m_dumpsWritten++;
+    return true;
+}
+
+bool CheckpointStreamWriter::finish(const SignalInfo& signals) {
+    if (!m_headerWritten || m_finished) {
+        m_lastError = "finish called twice or before writeHeader";
+        return false;
+    }
+
+    // End kaydı: start = end = 0, flags = 0, size = 0
+    MemoryDump end;
+    end.region.startAddr = 0;
+    end.region.endAddr = 0;
+    end.region.readable = end.region.writable = false;
+    end.region.executable = end.region.isPrivate = false;
+    std::vector<uint8_t> trailer;
+    RealProcessCheckpoint::serializeDumpHeader(end, trailer);
+    trailer.insert(trailer.end(), reinterpret_cast<const uint8_t*>(&signals),
+                   reinterpret_cast<const uint8_t*>(&signals) + sizeof(signals));
+
+    if (!append(trailer.data(), trailer.size())) return false;
+    if (!flushBuffer()) return false;
+    if (m_async && !m_async->finish()) {
+        m_lastError = m_async->getLastError();
+        return false;
+    }
+
+    m_finished = true;
+    return true;
+}
+
+// ============================================================================
+// CheckpointStreamReader
+// ============================================================================
+
+CheckpointStreamReader::CheckpointStreamReader()
+    : CheckpointStreamReader(-1) {
+}
+
+CheckpointStreamReader::CheckpointStreamReader(int fd)
+    : m_fd(fd), m_ownsFd(false), m_version(0), m_dumpCount(0), m_dumpsRead(0),
+      m_ioChunkSize(0), m_streamed(false), m_finished(false), m_signals{},
+      m_buffer(CheckpointStreamWriter::DEFAULT_BUFFER_SIZE),
+      m_bufferPos(0), m_bufferLen(0) {
+}
+
+CheckpointStreamReader::~CheckpointStreamReader() {
+    close();
+}
+
+bool CheckpointStreamReader::open(const std::string& filepath) {
+    close();
+
+    m_fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        m_lastError = "Failed to open file: " + filepath;
+        return false;
+    }
+
+    m_ownsFd = true;
+    m_bufferPos = m_bufferLen = 0;
+    m_finished = false;
+    m_lastError.clear();
+    return true;
+}
+
+bool CheckpointStreamReader::open(const std::string& filepath, const IoEngineOptions& io) {
+    if (!open(filepath)) {
+        return false;
+    }
+    m_io = std::make_unique<IoEngine>(io);
+    m_ioChunkSize = io.bufferSize;
+    return true;
+}
+
+void CheckpointStreamReader::close() {
+    if (m_fd >= 0 && m_ownsFd) {
+        ::close(m_fd);
+    }
+    m_fd = -1;
+    m_ownsFd = false;
+    m_io.reset();
+}
+
+bool CheckpointStreamReader::fillBuffer() {
+    while (true) {
+        ssize_t n = ::read(m_fd, m_buffer.data(), m_buffer.size());
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("Read failed: ") + std::strerror(errno);
+            return false;
+        }
+        if (n == 0) {
+            m_lastError = "Unexpected end of checkpoint stream";
+            return false;
+        }
+        m_bufferPos = 0;
+        m_bufferLen = static_cast<size_t>(n);
+        return true;
+    }
+}
+
+bool CheckpointStreamReader::readExact(void* out, size_t size) {
+    uint8_t* dst = static_cast<uint8_t*>(out);
+
+    while (size > 0) {
+        if (m_bufferPos < m_bufferLen) {
+            size_t n = std::min(size, m_bufferLen - m_bufferPos);
+            std::memcpy(dst, m_buffer.data() + m_bufferPos, n);
+            m_bufferPos += n;
+            dst += n;
+            size -= n;
+            continue;
+        }
+
+        if (size < m_buffer.size()) {
+            if (!fillBuffer()) return false;
+            continue;
+        }
+
+        // Büyük payload'lar: parçalar aynı anda kuyrukta (dosya offset'i
+        // pread'lerden etkilenmediği için elle ilerletilir)
+        if (m_io && size >= 2 * m_ioChunkSize) {
+            off_t pos = lseek(m_fd, 0, SEEK_CUR);
+            if (pos != static_cast<off_t>(-1)) {
+                if (!m_io->readFully(m_fd, dst, size, static_cast<uint64_t>(pos),
+                                     m_ioChunkSize, &m_lastError)) {
+                    return false;
+                }
+                lseek(m_fd, pos + static_cast<off_t>(size), SEEK_SET);
+                return true;
+            }
+        }
+
+        // Tampondan büyük okumalar (dump payload'ları) doğrudan hedefe
+        ssize_t n = ::read(m_fd, dst, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            m_lastError = std::string("Read failed: ") + std::strerror(errno);
+            return false;
+        }
+        if (n == 0) {
+            m_lastError = "Unexpected end of checkpoint stream";
+            return false;
+        }
+        dst += n;
+        size -= static_cast<size_t>(n);
+    }
+
+    return true;
+}
+
+bool CheckpointStreamReader::skipExact(uint64_t size) {
+    uint64_t buffered = std::min<uint64_t>(size, m_bufferLen - m_bufferPos);
+    m_bufferPos += buffered;
+    size -= buffered;
+    if (size == 0) return true;
+
+    // Tampon tükendi; seekable ise atla, değilse okuyup at
+    if (lseek(m_fd, static_cast<off_t>(size), SEEK_CUR) != static_cast<off_t>(-1)) {
+        return true;
+    }
+
+    while (size > 0) {
+        if (!fillBuffer()) return false;
+        uint64_t n = std::min<uint64_t>(size, m_bufferLen);
+        m_bufferPos = static_cast<size_t>(n);
+        size -= n;
+    }
+    return true;
+}
+
+bool CheckpointStreamReader::readString(std::string& out) {
+    uint32_t len;
+    if (!readPod(len)) return false;
+    out.resize(len);
+    return len == 0 || readExact(out.data(), len);
+}
+
+bool CheckpointStreamReader::readRegisters(LinuxRegisters& registers) {
+    // Registers (raw)
+    if (!readExact(&registers, sizeof(LinuxRegisters) - sizeof(std::vector<uint8_t>))) {
+        return false;
+    }
+
+    uint8_t hasFPU;
+    if (!readPod(hasFPU)) return false;
+    registers.hasFPU = (hasFPU != 0);
+    if (registers.hasFPU) {
+        uint32_t fpuSize;
+        if (!readPod(fpuSize)) return false;
+        registers.fpuState.resize(fpuSize);
+        if (fpuSize > 0 && !readExact(registers.fpuState.data(), fpuSize)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<RealProcessCheckpoint> CheckpointStreamReader::readHeader() {
+    if (m_fd < 0) {
+        m_lastError = "Stream not open";
+        return std::nullopt;
+    }
+
+    RealProcessCheckpoint checkpoint;
+
+    char magic[4];
+    if (!readExact(magic, sizeof(magic))) return std::nullopt;
+    if (std::memcmp(magic, "RCHK", 4) != 0) {
+        m_lastError = "Invalid checkpoint magic";
+        return std::nullopt;
+    }
+
+    if (!readPod(m_version)) return std::nullopt;
+    if (!RealProcessCheckpoint::isStreamVersion(m_version) &&
+        !RealProcessCheckpoint::isIndexedVersion(m_version)) {
+        m_lastError = "Unsupported checkpoint version " + std::to_string(m_version);
+        return std::nullopt;
+    }
+
+    if (!readPod(checkpoint.checkpointId) || !readPod(checkpoint.timestamp)) {
+        return std::nullopt;
+    }
+
+    if (m_version >= 2) {
+        uint8_t incremental;
+        if (!readPod(checkpoint.parentCheckpointId) || !readPod(incremental)) {
+            return std::nullopt;
+        }
+        checkpoint.isIncremental = (incremental != 0);
+    }
+
+    if (!readString(checkpoint.name) ||
+        !readPod(checkpoint.info.pid) || !readPod(checkpoint.info.ppid) ||
+        !readString(checkpoint.info.name) || !readString(checkpoint.info.cmdline)) {
+        return std::nullopt;
+    }
+
+    if (!readRegisters(checkpoint.registers)) return std::nullopt;
+
+    // Diğer thread'ler (v6+)
+    if (m_version >= 6) {
+        uint32_t threadCount;
+        if (!readPod(threadCount)) return std::nullopt;
+        checkpoint.threads.resize(threadCount);
+        for (auto& thread : checkpoint.threads) {
+            int32_t tid;
+            if (!readPod(tid) || !readRegisters(thread.registers)) return std::nullopt;
+            thread.tid = tid;
+        }
+    }
+
+    uint32_t regionCount;
+    if (!readPod(regionCount)) return std::nullopt;
+    checkpoint.memoryMap.reserve(regionCount);
+    for (uint32_t i = 0; i < regionCount; ++i) {
+        MemoryRegion region{};
+        uint8_t flags;
+        if (!readPod(region.startAddr) || !readPod(region.endAddr) ||
+            !readPod(flags) || !readString(region.pathname)) {
+            return std::nullopt;
+        }
+        region.readable = (flags & 1) != 0;
+        region.writable = (flags & 2) != 0;
+        region.executable = (flags & 4) != 0;
+        region.isPrivate = (flags & 8) != 0;
+        region.hugePages = (flags & RealProcessCheckpoint::REGION_FLAG_HUGE_PAGES) != 0;
+        checkpoint.memoryMap.push_back(std::move(region));
+    }
+
+    if (!readPod(m_dumpCount)) return std::nullopt;
+    m_streamed = (m_version >= 3 && m_dumpCount == RealProcessCheckpoint::STREAMED_DUMP_COUNT);
+    m_dumpsRead = 0;
+    m_finished = false;
+    m_memoryMap = checkpoint.memoryMap;
+
+    return checkpoint;
+}
+
+bool CheckpointStreamReader::readTrailer() {
+    if (!readPod(m_signals)) return false;
+    m_finished = true;
+    return true;
+}
+
+bool CheckpointStreamReader::nextDump(MemoryDump& dump, bool loadData) {
+    if (m_finished) {
+        return false;
+    }
+
+    if (RealProcessCheckpoint::isIndexedVersion(m_version)) {
+        m_lastError = "Indexed checkpoint image - use MappedCheckpointImage";
+        return false;
+    }
+
+    if (!m_streamed && m_dumpsRead >= m_dumpCount) {
+        readTrailer();
+        return false;
+    }
+
+    dump = MemoryDump();
+    if (!readPod(dump.region.startAddr) || !readPod(dump.region.endAddr)) {
+        return false;
+    }
+
+    // Dump'ı içeren region'dan pathname (v1'de flag'ler de) al
+    for (const auto& region : m_memoryMap) {
+        if (dump.region.startAddr >= region.startAddr &&
+            dump.region.endAddr <= region.endAddr) {
+            uint64_t start = dump.region.startAddr;
+            uint64_t end = dump.region.endAddr;
+            dump.region = region;
+            dump.region.startAddr = start;
+            dump.region.endAddr = end;
+            break;
+        }
+    }
+
+    uint8_t flags = 0;
+    if (m_version >= 2) {
+        if (!readPod(flags)) return false;
+        RealProcessCheckpoint::applyDumpFlags(dump, flags);
+    }
+
+    uint64_t dataSize;
+    if (!readPod(dataSize)) return false;
+
+    if (m_streamed && dump.region.startAddr == 0 && dump.region.endAddr == 0) {
+        readTrailer();
+        return false;   // End kaydı
+    }
+
+    m_dumpsRead++;
+
+    if (!loadData) {
+        return skipExact(dataSize);
+    }
+
+    if (flags & RealProcessCheckpoint::DUMP_FLAG_PAGE_REFS) {
+        dump.pageRefs.resize(dataSize / sizeof(uint32_t));
+        if (!readExact(dump.pageRefs.data(), dump.pageRefs.size() * sizeof(uint32_t)) ||
+            !skipExact(dataSize % sizeof(uint32_t))) {
+            return false;
+        }
+    } else {
+        dump.data.resize(dataSize);
+        if (dataSize > 0 && !readExact(dump.data.data(), dataSize)) {
+            return false;
+        }
+    }
+    dump.isValid = true;
+    return true;
+}
+
+std::optional<RealProcessCheckpoint> CheckpointStreamReader::readAll() {
+    auto checkpoint = readHeader();
+    if (!checkpoint) {
+        return std::nullopt;
+    }
+
+    if (!m_streamed) {
+        checkpoint->memoryDumps.reserve(m_dumpCount);
+    }
+
+    MemoryDump dump;
+    while (nextDump(dump)) {
+        checkpoint->memoryDumps.push_back(std::move(dump));
+    }
+
+    if (!m_finished) {
+        return std::nullopt;  // Okuma hatası - m_lastError set edildi
+    }
+
+    checkpoint->signals = m_signals;
+    return checkpoint;
+}
+
+} // namespace real_process
+} // namespace checkpoint
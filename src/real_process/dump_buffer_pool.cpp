@@ -0,0 +1,147 @@
+#include "real_process/dump_buffer_pool.hpp"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace checkpoint {
+namespace real_process {
+
+namespace {
+
+// Çağıran thread'in NUMA node'u (bilinmiyorsa 0)
+unsigned currentNode() {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return 0;
+    }
+    return node;
+}
+
+// Bu kadarından fazla boş kalacaksa tampon verilmez (küçük istek büyük
+// tamponu tutmasın)
+bool fits(size_t capacity, size_t size) {
+    return capacity - size <= std::max<size_t>(size, 64 * 1024);
+}
+
+} // namespace
+
+DumpBufferPool::DumpBufferPool(uint64_t maxRetainedBytes)
+    : m_maxRetainedBytes(maxRetainedBytes) {
+}
+
+void DumpBufferPool::setMaxRetainedBytes(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxRetainedBytes = bytes;
+}
+
+void DumpBufferPool::setHugePages(bool enable) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hugePages = enable;
+}
+
+bool DumpBufferPool::takeFrom(std::multimap<size_t, std::vector<uint8_t>>& list, size_t size,
+                              std::vector<uint8_t>& out) {
+    auto it = list.lower_bound(size);
+    if (it == list.end() || !fits(it->first, size)) {
+        return false;
+    }
+    m_stats.retainedBytes -= it->first;
+    out = std::move(it->second);
+    list.erase(it);
+    return true;
+}
+
+std::vector<uint8_t> DumpBufferPool::acquire(size_t size) {
+    std::vector<uint8_t> buffer;
+    if (size == 0) {
+        return buffer;
+    }
+
+    bool hugePages;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        hugePages = m_hugePages;
+
+        // Önce yerel node, yoksa herhangi biri (uzak bellek yeni ayırmaktan ucuz)
+        bool found = false;
+        auto local = m_free.find(currentNode());
+        if (local != m_free.end()) {
+            found = takeFrom(local->second, size, buffer);
+        }
+        for (auto it = m_free.begin(); !found && it != m_free.end(); ++it) {
+            found = takeFrom(it->second, size, buffer);
+        }
+
+        if (found) {
+            m_stats.hits++;
+        } else {
+            m_stats.misses++;
+        }
+    }
+
+    if (buffer.capacity() == 0) {
+        buffer.reserve(size);
+        if (hugePages && size >= HUGE_PAGE_BYTES) {
+            // Sayfalar ilk yazmada (resize) fault alır; önce THP iste
+            auto begin = reinterpret_cast<uintptr_t>(buffer.data());
+            uintptr_t start = (begin + HUGE_PAGE_BYTES - 1) & ~(HUGE_PAGE_BYTES - 1);
+            uintptr_t end = (begin + size) & ~(HUGE_PAGE_BYTES - 1);
+            if (end > start) {
+                madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+            }
+        }
+    }
+    // Küçültme hiçbir byte'a dokunmaz; büyütme sadece aradaki kısmı sıfırlar
+    buffer.resize(size);
+    return buffer;
+}
+
+void DumpBufferPool::recycle(std::vector<uint8_t>&& buffer) {
+    size_t capacity = buffer.capacity();
+    if (capacity == 0) {
+        return;
+    }
+
+    std::vector<uint8_t> released;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stats.retainedBytes + capacity > m_maxRetainedBytes) {
+        m_stats.dropped++;
+        released = std::move(buffer);       // Kilit dışında serbest kalır
+        return;
+    }
+    m_stats.retainedBytes += capacity;
+    m_stats.recycled++;
+    m_free[currentNode()].emplace(capacity, std::move(buffer));
+}
+
+void DumpBufferPool::recycle(MemoryDump& dump) {
+    recycle(std::move(dump.data));
+    dump.data = std::vector<uint8_t>();
+    dump.pageHashes.clear();
+    dump.hashTree.clear();
+}
+
+void DumpBufferPool::recycle(RealProcessCheckpoint& checkpoint) {
+    for (auto& dump : checkpoint.memoryDumps) {
+        recycle(dump);
+    }
+    checkpoint.memoryDumps.clear();
+}
+
+void DumpBufferPool::trim() {
+    std::map<unsigned, std::multimap<size_t, std::vector<uint8_t>>> released;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    released.swap(m_free);
+    m_stats.retainedBytes = 0;
+}
+
+DumpBufferPool::Stats DumpBufferPool::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace real_process
+} // namespace checkpoint
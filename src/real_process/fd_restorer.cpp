@@ -1,5 +1,6 @@
 #include "real_process/fd_restorer.hpp"
 #include "real_process/proc_reader.hpp"
+#include "real_process/memory_manager.hpp"
 #include <sys/ptrace.h>
 #include <sys/wait.h>
 #include <sys/user.h>
@@ -13,6 +14,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cstdint>
 
 namespace checkpoint {
 namespace real_process {
@@ -89,7 +91,7 @@ FDType detectFDType(const std::string& path, int /*flags*/) {
 // ============================================================================
 
 FDRestorer::FDRestorer()
-    : m_pid(0) {
+    : m_pid(0), m_useParasite(true) {
 }
 
 FDRestorer::~FDRestorer() {
@@ -123,6 +125,7 @@ FDError FDRestorer::bindProcess(pid_t pid) {
 }
 
 void FDRestorer::unbindProcess() {
+    m_syscalls.reset();         // parasite'ı kaldırır
     m_pid = 0;
 }
 
@@ -569,6 +572,11 @@ FDRestorer::BatchRestoreResult FDRestorer::restoreAllFDs(
     result.restoredFDs = 0;
     result.failedFDs = 0;
     
+    if (m_useParasite && m_pid > 0 && restoreAllFDsBatched(fdInfos, stopOnError, result)) {
+        reportProgress("FD restoration complete", 1.0);
+        return result;
+    }
+    
     int done = 0;
     for (const auto& fdInfo : fdInfos) {
         reportProgress("Restoring FDs", double(done) / result.totalFDs);
@@ -595,6 +603,119 @@ FDRestorer::BatchRestoreResult FDRestorer::restoreAllFDs(
     return result;
 }
 
+bool FDRestorer::restoreAllFDsBatched(
+    const std::vector<ExtendedFDInfo>& fdInfos,
+    bool stopOnError,
+    BatchRestoreResult& result) {
+    
+    if (!ParasiteStub::isSupported()) {
+        return false;
+    }
+    if (!m_syscalls) {
+        m_syscalls = std::make_unique<MemoryManager>();
+        if (m_syscalls->bindProcess(m_pid) != MemoryError::SUCCESS) {
+            m_syscalls.reset();
+            return false;
+        }
+    }
+    
+    // Geçici fd'ler hedef numaraların üstüne taşınır: bir FD'nin open'ı
+    // başka bir FD'nin hedef numarasını almışsa dup2 onu ezmez.
+    //   t = open(path); h = fcntl(t, F_DUPFD, base); close(t);
+    //   dup2(h, fd); close(h); lseek(fd, pos)
+    // Her adım bir öncekinin sonucunu kullanır; open başarısızsa zincirin
+    // geri kalanı EBADF ile etkisiz kalır.
+    int base = 0;
+    for (const auto& fdInfo : fdInfos) {
+        base = std::max(base, fdInfo.fd + 1);
+    }
+    
+    struct Chain {
+        size_t open = SIZE_MAX;
+        size_t dupHigh = SIZE_MAX;
+        size_t dup = SIZE_MAX;
+        size_t seek = SIZE_MAX;
+    };
+    std::vector<Chain> chains(fdInfos.size());
+    SyscallBatch batch;
+    batch.setStopOnError(stopOnError);
+    
+    for (size_t i = 0; i < fdInfos.size(); ++i) {
+        const auto& fdInfo = fdInfos[i];
+        if (!fdInfo.canRestore) {
+            if (stopOnError) break;     // Rapor burada duracak
+            continue;
+        }
+        
+        int openFlags = fdInfo.flags & (O_ACCMODE | O_APPEND | O_NONBLOCK);
+        if (fdInfo.type == FDType::DIRECTORY) {
+            openFlags |= O_DIRECTORY;
+        }
+        
+        Chain& chain = chains[i];
+        chain.open = batch.addOpen(fdInfo.path, openFlags, 0);
+        chain.dupHigh = batch.add(SYS_fcntl, 0, F_DUPFD, static_cast<uint64_t>(base));
+        batch.useResult(chain.dupHigh, 0, chain.open);
+        size_t closeTemp = batch.add(SYS_close);
+        batch.useResult(closeTemp, 0, chain.open);
+        chain.dup = batch.addDup2(0, fdInfo.fd);
+        batch.useResult(chain.dup, 0, chain.dupHigh);
+        size_t closeHigh = batch.add(SYS_close);
+        batch.useResult(closeHigh, 0, chain.dupHigh);
+        if (fdInfo.type == FDType::REGULAR_FILE && fdInfo.pos > 0) {
+            chain.seek = batch.addLseek(0, fdInfo.pos, SEEK_SET);
+            batch.useResult(chain.seek, 0, chain.dup);
+        }
+    }
+    
+    reportProgress("Restoring FDs", 0.1);
+    SyscallBatchResult batchResult;
+    if (!m_syscalls->executeBatch(batch, batchResult) && batchResult.roundTrips == 0) {
+        return false;
+    }
+    
+    for (size_t i = 0; i < fdInfos.size(); ++i) {
+        const auto& fdInfo = fdInfos[i];
+        const Chain& chain = chains[i];
+        RestoreFDResult fdResult;
+        fdResult.fdNumber = fdInfo.fd;
+        fdResult.error = FDError::SUCCESS;
+        
+        if (!fdInfo.canRestore) {
+            fdResult.error = FDError::SPECIAL_FILE;
+            fdResult.message = fdInfo.restoreWarning;
+        } else if (!batchResult.succeeded(chain.open)) {
+            fdResult.error = FDError::OPEN_FAILED;
+            fdResult.message = "Failed to open: open failed with error: " +
+                               std::to_string(-batchResult.results[chain.open]);
+        } else if (!batchResult.succeeded(chain.dupHigh) || !batchResult.succeeded(chain.dup)) {
+            int64_t err = batchResult.succeeded(chain.dupHigh) ?
+                          batchResult.results[chain.dup] : batchResult.results[chain.dupHigh];
+            fdResult.error = FDError::DUP_FAILED;
+            fdResult.message = "Failed to dup2: dup2 failed with error: " + std::to_string(-err);
+        } else if (chain.seek != SIZE_MAX && !batchResult.succeeded(chain.seek)) {
+            fdResult.message = "Warning: Failed to restore file position";
+        } else {
+            fdResult.message = "Restored FD " + std::to_string(fdInfo.fd) +
+                               " -> " + fdInfo.path;
+        }
+        
+        result.results.push_back(fdResult);
+        if (fdResult.error == FDError::SUCCESS) {
+            result.restoredFDs++;
+        } else {
+            result.failedFDs++;
+            result.warnings.push_back("FD " + std::to_string(fdInfo.fd) +
+                                      ": " + fdResult.message);
+            if (stopOnError) {
+                break;
+            }
+        }
+    }
+    
+    return true;
+}
+
 // ============================================================================
 // Special File Handling
 // ============================================================================
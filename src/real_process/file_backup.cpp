@@ -0,0 +1,178 @@
+#include "real_process/file_backup.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <linux/fs.h>
+
+namespace checkpoint {
+namespace real_process {
+
+std::string backupMethodToString(BackupMethod method) {
+    switch (method) {
+        case BackupMethod::Reflink:       return "reflink";
+        case BackupMethod::CopyFileRange: return "copy_file_range";
+        case BackupMethod::Buffered:      return "buffered";
+        default:                          return "none";
+    }
+}
+
+namespace {
+
+void setError(std::string* error, const std::string& message) {
+    if (error) *error = message + ": " + std::strerror(errno);
+}
+
+// Bu errno'lar "yöntem burada desteklenmiyor" demek: sonrakine geç
+bool isUnsupported(int err) {
+    return err == EXDEV || err == ENOSYS || err == EOPNOTSUPP || err == ENOTTY ||
+           err == EINVAL || err == EBADF || err == ETXTBSY || err == EPERM;
+}
+
+} // namespace
+
+FileBackupStrategy::FileBackupStrategy() = default;
+
+FileBackupStrategy::FileBackupStrategy(const FileBackupOptions& options)
+    : m_options(options) {
+    if (m_options.bufferSize == 0) {
+        m_options.bufferSize = FileBackupOptions().bufferSize;
+    }
+}
+
+BackupMethod FileBackupStrategy::copyFd(int srcFd, int dstFd, uint64_t size,
+                                        std::string* error) const {
+    BackupMethod method = BackupMethod::None;
+
+#ifdef FICLONE
+    // Tüm dosyayı klonlar ve dst'nin eski içeriğini değiştirir
+    if (m_options.allowReflink && ::ioctl(dstFd, FICLONE, srcFd) == 0) {
+        method = BackupMethod::Reflink;
+    }
+#endif
+
+    uint64_t copied = 0;
+    if (method == BackupMethod::None) {
+        if (::ftruncate(dstFd, 0) != 0) {
+            setError(error, "ftruncate failed");
+            m_failures++;
+            return BackupMethod::None;
+        }
+    }
+
+    if (method == BackupMethod::None && m_options.allowCopyFileRange) {
+        bool supported = true;
+        while (copied < size) {
+            loff_t inOff = static_cast<loff_t>(copied);
+            loff_t outOff = static_cast<loff_t>(copied);
+            ssize_t n = ::copy_file_range(srcFd, &inOff, dstFd, &outOff,
+                                          static_cast<size_t>(size - copied), 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) {
+                if (!isUnsupported(errno)) {
+                    setError(error, "copy_file_range failed");
+                    m_failures++;
+                    return BackupMethod::None;
+                }
+                supported = false;
+                break;
+            }
+            if (n == 0) break;          // src beklenenden kısa
+            copied += static_cast<uint64_t>(n);
+        }
+        if (supported) {
+            method = BackupMethod::CopyFileRange;
+        }
+    }
+
+    if (method == BackupMethod::None) {
+        // Son çare: kalan kısmı (copy_file_range yarıda kaldıysa oradan) tek
+        // buffer'la taşı
+        std::vector<uint8_t> buffer(m_options.bufferSize);
+        while (copied < size) {
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(buffer.size(), size - copied));
+            ssize_t n = ::pread(srcFd, buffer.data(), chunk, static_cast<off_t>(copied));
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) {
+                setError(error, "read failed");
+                m_failures++;
+                return BackupMethod::None;
+            }
+            if (n == 0) break;
+            size_t written = 0;
+            while (written < static_cast<size_t>(n)) {
+                ssize_t w = ::pwrite(dstFd, buffer.data() + written, static_cast<size_t>(n) - written,
+                                     static_cast<off_t>(copied + written));
+                if (w < 0 && errno == EINTR) continue;
+                if (w <= 0) {
+                    setError(error, "write failed");
+                    m_failures++;
+                    return BackupMethod::None;
+                }
+                written += static_cast<size_t>(w);
+            }
+            copied += static_cast<uint64_t>(n);
+        }
+        method = BackupMethod::Buffered;
+    }
+
+    switch (method) {
+        case BackupMethod::Reflink:       m_reflinks++; break;
+        case BackupMethod::CopyFileRange: m_copyFileRanges++; break;
+        default:                          m_buffered++; break;
+    }
+    m_bytesCopied += size;
+    return method;
+}
+
+BackupMethod FileBackupStrategy::copyFile(const std::string& src, const std::string& dst,
+                                          std::string* error) const {
+    int srcFd = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (srcFd < 0) {
+        setError(error, "Cannot open " + src);
+        m_failures++;
+        return BackupMethod::None;
+    }
+    struct stat st;
+    if (::fstat(srcFd, &st) != 0) {
+        setError(error, "Cannot stat " + src);
+        ::close(srcFd);
+        m_failures++;
+        return BackupMethod::None;
+    }
+
+    // O_TRUNC yok: copyFd FICLONE denemeden önce kesmemeli (reflink her
+    // durumda içeriği değiştirir, diğer yollar kendisi keser)
+    int dstFd = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, st.st_mode & 07777);
+    if (dstFd < 0) {
+        setError(error, "Cannot open " + dst);
+        ::close(srcFd);
+        m_failures++;
+        return BackupMethod::None;
+    }
+
+    BackupMethod method = copyFd(srcFd, dstFd, static_cast<uint64_t>(st.st_size), error);
+    ::close(srcFd);
+    if (::close(dstFd) != 0 && method != BackupMethod::None) {
+        setError(error, "close failed");
+        method = BackupMethod::None;
+    }
+    return method;
+}
+
+FileBackupStrategy::Stats FileBackupStrategy::getStats() const {
+    Stats stats;
+    stats.reflinks = m_reflinks;
+    stats.copyFileRanges = m_copyFileRanges;
+    stats.buffered = m_buffered;
+    stats.failures = m_failures;
+    stats.bytesCopied = m_bytesCopied;
+    return stats;
+}
+
+} // namespace real_process
+} // namespace checkpoint
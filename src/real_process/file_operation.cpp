@@ -1,4 +1,7 @@
 #include "real_process/file_operation.hpp"
+#include "real_process/file_backup.hpp"
+#include "core/checksum.hpp"
+#include "core/binary_io.hpp"
 #include <fstream>
 #include <sstream>
 #include <cstring>
@@ -9,6 +12,8 @@
 #include <atomic>
 #include <map>
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
 
 namespace checkpoint {
 namespace real_process {
@@ -54,154 +59,134 @@ FileOperationType stringToFileOpType(const std::string& str) {
 // ============================================================================
 
 std::vector<uint8_t> FileOperation::serialize() const {
-    std::vector<uint8_t> data;
-    
-    // Helper to append data
-    auto appendU64 = [&data](uint64_t val) {
-        for (int i = 0; i < 8; i++) {
-            data.push_back((val >> (i * 8)) & 0xFF);
-        }
-    };
-    
-    auto appendU32 = [&data](uint32_t val) {
-        for (int i = 0; i < 4; i++) {
-            data.push_back((val >> (i * 8)) & 0xFF);
-        }
-    };
+    // Tek ayırma: boyut önceden hesaplanır, alanlar yerinde yazılır
+    size_t size = 8 + 4 + 8 + (4 + path.size()) + (4 + originalPath.size()) + 4 + 8 + 8 + 8 + 1 +
+                  4 + 6 * 4 + 1 + 1 + (4 + description.size()) + 4 + (4 + backupPath.size());
+    if (originalContent.has_value()) {
+        size += 8 + originalContent->size();
+    }
+    for (const auto& diff : diffs) {
+        size += 8 + (8 + diff.oldData.size()) + (8 + diff.newData.size());
+    }
+    std::vector<uint8_t> data(size);
+    BinaryWriter writer{std::span<uint8_t>(data)};
     
-    auto appendString = [&data, &appendU32](const std::string& str) {
-        appendU32(static_cast<uint32_t>(str.size()));
-        data.insert(data.end(), str.begin(), str.end());
+    // Biçim host'tan bağımsız little-endian
+    auto writeString = [&writer](const std::string& str) {
+        writer.writeLE(static_cast<uint32_t>(str.size()));
+        writer.writeBytes(str.data(), str.size());
     };
-    
-    auto appendBytes = [&data, &appendU64](const std::vector<uint8_t>& bytes) {
-        appendU64(bytes.size());
-        data.insert(data.end(), bytes.begin(), bytes.end());
+    auto writeBytes = [&writer](const std::vector<uint8_t>& bytes) {
+        writer.writeLE(static_cast<uint64_t>(bytes.size()));
+        writer.writeBytes(bytes.data(), bytes.size());
     };
     
-    // Serialize all fields
-    appendU64(operationId);
-    appendU32(static_cast<uint32_t>(type));
+    writer.writeLE(operationId);
+    writer.writeLE(static_cast<uint32_t>(type));
     
     auto ts = std::chrono::duration_cast<std::chrono::milliseconds>(
         timestamp.time_since_epoch()).count();
-    appendU64(static_cast<uint64_t>(ts));
+    writer.writeLE(static_cast<uint64_t>(ts));
     
-    appendString(path);
-    appendString(originalPath);
-    appendU32(static_cast<uint32_t>(fd));
-    appendU64(static_cast<uint64_t>(offset));
-    appendU64(originalSize);
-    appendU64(newSize);
+    writeString(path);
+    writeString(originalPath);
+    writer.writeLE(static_cast<uint32_t>(fd));
+    writer.writeLE(static_cast<uint64_t>(offset));
+    writer.writeLE(originalSize);
+    writer.writeLE(newSize);
     
     // Original content
-    data.push_back(originalContent.has_value() ? 1 : 0);
+    writer.writeBool(originalContent.has_value());
     if (originalContent.has_value()) {
-        appendBytes(*originalContent);
+        writeBytes(*originalContent);
     }
     
     // Diffs
-    appendU32(static_cast<uint32_t>(diffs.size()));
+    writer.writeLE(static_cast<uint32_t>(diffs.size()));
     for (const auto& diff : diffs) {
-        appendU64(static_cast<uint64_t>(diff.offset));
-        appendBytes(diff.oldData);
-        appendBytes(diff.newData);
+        writer.writeLE(static_cast<uint64_t>(diff.offset));
+        writeBytes(diff.oldData);
+        writeBytes(diff.newData);
     }
     
     // Metadata
-    appendU32(originalMode);
-    appendU32(newMode);
-    appendU32(originalUid);
-    appendU32(originalGid);
-    appendU32(newUid);
-    appendU32(newGid);
+    writer.writeLE(static_cast<uint32_t>(originalMode));
+    writer.writeLE(static_cast<uint32_t>(newMode));
+    writer.writeLE(static_cast<uint32_t>(originalUid));
+    writer.writeLE(static_cast<uint32_t>(originalGid));
+    writer.writeLE(static_cast<uint32_t>(newUid));
+    writer.writeLE(static_cast<uint32_t>(newGid));
     
     // Status
-    data.push_back(isReversible ? 1 : 0);
-    data.push_back(wasReversed ? 1 : 0);
-    appendString(description);
-    appendU32(static_cast<uint32_t>(pid));
+    writer.writeBool(isReversible);
+    writer.writeBool(wasReversed);
+    writeString(description);
+    writer.writeLE(static_cast<uint32_t>(pid));
+    
+    // Sona eklendi: eski kayıtlarda okunmaz, boş kalır
+    writeString(backupPath);
     
     return data;
 }
 
-FileOperation FileOperation::deserialize(const std::vector<uint8_t>& data) {
+FileOperation FileOperation::deserialize(std::span<const uint8_t> data) {
     FileOperation op;
-    size_t pos = 0;
-    
-    auto readU64 = [&data, &pos]() -> uint64_t {
-        uint64_t val = 0;
-        for (int i = 0; i < 8 && pos < data.size(); i++, pos++) {
-            val |= static_cast<uint64_t>(data[pos]) << (i * 8);
-        }
-        return val;
-    };
-    
-    auto readU32 = [&data, &pos]() -> uint32_t {
-        uint32_t val = 0;
-        for (int i = 0; i < 4 && pos < data.size(); i++, pos++) {
-            val |= static_cast<uint32_t>(data[pos]) << (i * 8);
-        }
-        return val;
-    };
+    BinaryReader reader(data);
     
-    auto readString = [&data, &pos, &readU32]() -> std::string {
-        uint32_t len = readU32();
-        std::string str(data.begin() + pos, data.begin() + pos + len);
-        pos += len;
-        return str;
+    auto readString = [&reader]() -> std::string {
+        auto bytes = reader.readBytes(reader.readLE<uint32_t>());
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
     };
-    
-    auto readBytes = [&data, &pos, &readU64]() -> std::vector<uint8_t> {
-        uint64_t len = readU64();
-        std::vector<uint8_t> bytes(data.begin() + pos, data.begin() + pos + len);
-        pos += len;
-        return bytes;
+    auto readBytes = [&reader]() -> std::vector<uint8_t> {
+        auto bytes = reader.readBytes(static_cast<size_t>(reader.readLE<uint64_t>()));
+        return std::vector<uint8_t>(bytes.begin(), bytes.end());
     };
     
-    // Deserialize all fields
-    op.operationId = readU64();
-    op.type = static_cast<FileOperationType>(readU32());
+    op.operationId = reader.readLE<uint64_t>();
+    op.type = static_cast<FileOperationType>(reader.readLE<uint32_t>());
     
-    auto ts = std::chrono::milliseconds(readU64());
+    auto ts = std::chrono::milliseconds(reader.readLE<uint64_t>());
     op.timestamp = std::chrono::system_clock::time_point(ts);
     
     op.path = readString();
     op.originalPath = readString();
-    op.fd = static_cast<int>(readU32());
-    op.offset = static_cast<off_t>(readU64());
-    op.originalSize = readU64();
-    op.newSize = readU64();
+    op.fd = static_cast<int>(reader.readLE<uint32_t>());
+    op.offset = static_cast<off_t>(reader.readLE<uint64_t>());
+    op.originalSize = reader.readLE<uint64_t>();
+    op.newSize = reader.readLE<uint64_t>();
     
     // Original content
-    bool hasContent = data[pos++] != 0;
-    if (hasContent) {
+    if (reader.readBool()) {
         op.originalContent = readBytes();
     }
     
     // Diffs
-    uint32_t diffCount = readU32();
-    for (uint32_t i = 0; i < diffCount; i++) {
+    uint32_t diffCount = reader.readLE<uint32_t>();
+    for (uint32_t i = 0; i < diffCount && reader.ok(); i++) {
         FileContentDiff diff;
-        diff.offset = static_cast<off_t>(readU64());
+        diff.offset = static_cast<off_t>(reader.readLE<uint64_t>());
         diff.oldData = readBytes();
         diff.newData = readBytes();
         op.diffs.push_back(std::move(diff));
     }
     
     // Metadata
-    op.originalMode = readU32();
-    op.newMode = readU32();
-    op.originalUid = static_cast<uid_t>(readU32());
-    op.originalGid = static_cast<gid_t>(readU32());
-    op.newUid = static_cast<uid_t>(readU32());
-    op.newGid = static_cast<gid_t>(readU32());
+    op.originalMode = reader.readLE<uint32_t>();
+    op.newMode = reader.readLE<uint32_t>();
+    op.originalUid = static_cast<uid_t>(reader.readLE<uint32_t>());
+    op.originalGid = static_cast<gid_t>(reader.readLE<uint32_t>());
+    op.newUid = static_cast<uid_t>(reader.readLE<uint32_t>());
+    op.newGid = static_cast<gid_t>(reader.readLE<uint32_t>());
     
     // Status
-    op.isReversible = data[pos++] != 0;
-    op.wasReversed = data[pos++] != 0;
+    op.isReversible = reader.readBool();
+    op.wasReversed = reader.readBool();
     op.description = readString();
-    op.pid = static_cast<pid_t>(readU32());
+    op.pid = static_cast<pid_t>(reader.readLE<uint32_t>());
+    
+    if (!reader.atEnd()) {
+        op.backupPath = readString();
+    }
     
     return op;
 }
@@ -222,15 +207,492 @@ size_t FileOperation::estimatedMemoryUsage() const {
     return usage;
 }
 
+// ============================================================================
+// ByteRangeSet Implementation
+// ============================================================================
+
+std::vector<std::pair<off_t, off_t>> ByteRangeSet::subtract(off_t begin, off_t end) const {
+    std::vector<std::pair<off_t, off_t>> gaps;
+    if (begin >= end) return gaps;
+    
+    // begin'i içerebilecek ilk aralık: begin'den küçük son başlangıç
+    auto it = m_ranges.upper_bound(begin);
+    if (it != m_ranges.begin() && std::prev(it)->second > begin) {
+        --it;
+    }
+    off_t cursor = begin;
+    for (; it != m_ranges.end() && it->first < end; ++it) {
+        if (it->first > cursor) {
+            gaps.emplace_back(cursor, it->first);
+        }
+        cursor = std::max(cursor, it->second);
+        if (cursor >= end) break;
+    }
+    if (cursor < end) {
+        gaps.emplace_back(cursor, end);
+    }
+    return gaps;
+}
+
+void ByteRangeSet::add(off_t begin, off_t end) {
+    if (begin >= end) return;
+    
+    // Değen ya da kesişen aralıkları tek aralıkta birleştir
+    auto it = m_ranges.upper_bound(begin);
+    if (it != m_ranges.begin() && std::prev(it)->second >= begin) {
+        --it;
+    }
+    while (it != m_ranges.end() && it->first <= end) {
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->second);
+        it = m_ranges.erase(it);
+    }
+    m_ranges.emplace(begin, end);
+}
+
+bool ByteRangeSet::covers(off_t begin, off_t end) const {
+    return subtract(begin, end).empty();
+}
+
+uint64_t ByteRangeSet::coveredBytes() const {
+    uint64_t total = 0;
+    for (const auto& range : m_ranges) {
+        total += static_cast<uint64_t>(range.second - range.first);
+    }
+    return total;
+}
+
 // ============================================================================
 // FileOperationLog Implementation
 // ============================================================================
 
+namespace {
+
+// Journal kaydı: magic(4) | type(1) | pad(3) | id(8) | len(4) | crc(4) | payload
+// OP kaydında id = operationId, payload = FileOperation::serialize();
+// MARK kaydında id = checkpointId, payload yok.
+constexpr char JOURNAL_MAGIC[4] = {'F', 'O', 'L', 'J'};
+constexpr uint8_t JOURNAL_OP = 1;
+constexpr uint8_t JOURNAL_MARK = 2;
+constexpr size_t JOURNAL_HEADER_SIZE = 24;
+
+void encodeJournalHeader(uint8_t* out, uint8_t type, uint64_t id,
+                         const uint8_t* payload, uint32_t len) {
+    std::memset(out, 0, JOURNAL_HEADER_SIZE);
+    std::memcpy(out, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    out[4] = type;
+    std::memcpy(out + 8, &id, sizeof(id));
+    std::memcpy(out + 16, &len, sizeof(len));
+    uint32_t crc = crc32c(payload, len, crc32c(out, 20));
+    std::memcpy(out + 20, &crc, sizeof(crc));
+}
+
+struct JournalHeader {
+    uint8_t type;
+    uint64_t id;
+    uint32_t len;
+    uint32_t crc;
+};
+
+bool decodeJournalHeader(const uint8_t* in, JournalHeader& header) {
+    if (std::memcmp(in, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) return false;
+    header.type = in[4];
+    if (header.type != JOURNAL_OP && header.type != JOURNAL_MARK) return false;
+    std::memcpy(&header.id, in + 8, sizeof(header.id));
+    std::memcpy(&header.len, in + 16, sizeof(header.len));
+    std::memcpy(&header.crc, in + 20, sizeof(header.crc));
+    return true;
+}
+
+bool preadFull(int fd, void* buf, size_t size, uint64_t offset) {
+    uint8_t* p = static_cast<uint8_t*>(buf);
+    while (size > 0) {
+        ssize_t n = ::pread(fd, p, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+bool pwriteFull(int fd, const void* buf, size_t size, uint64_t offset) {
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    while (size > 0) {
+        ssize_t n = ::pwrite(fd, p, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+void syncDirectory(const std::filesystem::path& dir) {
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+std::string journalSegmentName(uint32_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%08u.fol", number);
+    return name;
+}
+
+// Journal modunda bellekte kalan kısım: sorgu filtreleri için yol/tip/id,
+// içerik (originalContent, diffs) diskte
+FileOperation stripPayload(const FileOperation& op) {
+    FileOperation header = op;
+    header.originalContent.reset();
+    header.diffs.clear();
+    header.diffs.shrink_to_fit();
+    return header;
+}
+
+} // namespace
+
 struct FileOperationLog::Impl {
     std::vector<FileOperation> operations;
     std::map<uint64_t, size_t> checkpointMarkers;  // checkpointId -> operations index
     std::mutex mutex;
     std::atomic<uint64_t> nextOpId{1};
+    
+    // Write coalescing: bu epoch'ta ön görüntüsü kayıtlı byte'lar
+    struct FileCoverage {
+        ByteRangeSet saved;
+        off_t baseSize{0};          // Epoch'taki ilk yazmadan önceki boyut
+    };
+    bool coalesceWrites{false};
+    std::map<std::string, FileCoverage> epochCoverage;
+    size_t coalescedOps{0};
+    uint64_t coalescedBytes{0};
+    
+    // On-disk journal: operations[i]'nin tam kaydı refs[i]'de.
+    // segment == 0: diske yazılamadı, op bellekte tam tutuluyor.
+    struct RecordRef {
+        uint32_t segment{0};
+        uint64_t offset{0};         // Kayıt başlangıcı (header dahil)
+        uint32_t length{0};         // Payload uzunluğu
+    };
+    struct Segment {
+        int fd{-1};
+        uint64_t size{0};           // Geçerli kayıtların sonu
+    };
+    bool journaled{false};
+    bool syncEachRecord{false};
+    std::filesystem::path journalDir;
+    std::map<uint32_t, Segment> segments;
+    uint32_t activeSegment{0};
+    bool activeHasOps{false};       // Aktif segmentte OP kaydı var mı
+    std::vector<RecordRef> refs;
+    std::map<uint64_t, uint32_t> markerSegments;   // checkpointId -> MARK'ın segmenti
+    
+    ~Impl() {
+        closeSegments();
+    }
+    
+    // mutex tutulurken. false: op tamamen örtülü, kaydedilmemeli
+    bool coalesce(FileOperation& op) {
+        if (!coalesceWrites) return true;
+        if (op.type != FileOperationType::WRITE) {
+            epochCoverage.erase(op.path);
+            if (!op.originalPath.empty()) epochCoverage.erase(op.originalPath);
+            return true;
+        }
+        if (op.hasFullBackup() || op.diffs.empty()) {
+            return true;        // tam geri yükleme ya da verisiz kayıt: dokunma
+        }
+        
+        auto inserted = epochCoverage.try_emplace(op.path);
+        FileCoverage& coverage = inserted.first->second;
+        if (inserted.second) {
+            coverage.baseSize = static_cast<off_t>(op.originalSize);
+        }
+        
+        std::vector<FileContentDiff> kept;
+        for (auto& diff : op.diffs) {
+            off_t begin = diff.offset;
+            off_t end = begin + static_cast<off_t>(diff.oldData.size());
+            off_t limit = std::min(end, coverage.baseSize);     // ötesi kesilerek geri alınır
+            size_t keptBytes = 0;
+            
+            for (const auto& gap : coverage.saved.subtract(begin, limit)) {
+                FileContentDiff piece;
+                piece.offset = gap.first;
+                size_t from = static_cast<size_t>(gap.first - begin);
+                size_t to = static_cast<size_t>(gap.second - begin);
+                piece.oldData.assign(diff.oldData.begin() + from, diff.oldData.begin() + to);
+                if (from < diff.newData.size()) {
+                    piece.newData.assign(diff.newData.begin() + from,
+                                         diff.newData.begin() + std::min(to, diff.newData.size()));
+                }
+                keptBytes += piece.oldData.size();
+                kept.push_back(std::move(piece));
+            }
+            coverage.saved.add(begin, limit);
+            coalescedBytes += diff.oldData.size() - keptBytes;
+        }
+        
+        if (kept.empty()) {
+            if (op.originalSize == op.newSize) {
+                coalescedOps++;
+                return false;
+            }
+            // Sadece boyutu geri almak için boş diff (reverse'te kesme)
+            FileContentDiff marker;
+            marker.offset = op.offset;
+            kept.push_back(std::move(marker));
+        }
+        op.diffs = std::move(kept);
+        return true;
+    }
+    
+    uint64_t append(FileOperation op) {
+        if (op.operationId == 0) {
+            op.operationId = nextOpId++;
+        }
+        uint64_t id = op.operationId;
+        if (coalesce(op)) {
+            store(std::move(op));
+        }
+        return id;
+    }
+    
+    void store(FileOperation op) {
+        if (!journaled) {
+            operations.push_back(std::move(op));
+            return;
+        }
+        auto payload = op.serialize();
+        RecordRef ref = writeRecord(JOURNAL_OP, op.operationId, payload);
+        activeHasOps = true;
+        if (ref.segment != 0) {
+            operations.push_back(stripPayload(op));
+        } else {
+            operations.push_back(std::move(op));
+        }
+        refs.push_back(ref);
+    }
+    
+    void mark(uint64_t checkpointId) {
+        checkpointMarkers[checkpointId] = operations.size();
+        if (!journaled) return;
+        
+        // Yeni epoch yeni segmentte başlar: bu checkpoint'ten önceki
+        // kayıtlar silinirken segment dosyası bütün olarak atılabilir
+        if (activeHasOps) {
+            openSegment(activeSegment + 1, nullptr);
+        }
+        writeRecord(JOURNAL_MARK, checkpointId, {});
+        markerSegments[checkpointId] = activeSegment;
+    }
+    
+    // Tam kaydı getir (journal'dan pread + deserialize)
+    FileOperation materialize(size_t index) const {
+        if (!journaled || refs[index].segment == 0) {
+            return operations[index];
+        }
+        const RecordRef& ref = refs[index];
+        auto seg = segments.find(ref.segment);
+        std::vector<uint8_t> payload(ref.length);
+        if (seg == segments.end() ||
+            !preadFull(seg->second.fd, payload.data(), payload.size(),
+                       ref.offset + JOURNAL_HEADER_SIZE)) {
+            return operations[index];       // Okunamadı: içeriksiz başlık
+        }
+        return FileOperation::deserialize(payload);
+    }
+    
+    // ---------- Segment dosyaları ----------
+    
+    bool openSegment(uint32_t number, std::string* error) {
+        auto path = journalDir / journalSegmentName(number);
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            if (error) *error = "Cannot open journal segment " + path.string() + ": " + std::strerror(errno);
+            return false;
+        }
+        syncDirectory(journalDir);
+        Segment& segment = segments[number];
+        if (segment.fd >= 0) ::close(segment.fd);
+        segment.fd = fd;
+        segment.size = 0;
+        activeSegment = number;
+        activeHasOps = false;
+        return true;
+    }
+    
+    RecordRef writeRecord(uint8_t type, uint64_t id, const std::vector<uint8_t>& payload) {
+        RecordRef ref;
+        auto it = segments.find(activeSegment);
+        if (it == segments.end()) return ref;
+        Segment& segment = it->second;
+        
+        std::vector<uint8_t> buffer(JOURNAL_HEADER_SIZE + payload.size());
+        uint32_t len = static_cast<uint32_t>(payload.size());
+        encodeJournalHeader(buffer.data(), type, id, payload.data(), len);
+        if (!payload.empty()) {
+            std::memcpy(buffer.data() + JOURNAL_HEADER_SIZE, payload.data(), payload.size());
+        }
+        
+        if (!pwriteFull(segment.fd, buffer.data(), buffer.size(), segment.size)) {
+            // Yarım kaydı geri al; op bellekte tutulur
+            if (::ftruncate(segment.fd, static_cast<off_t>(segment.size)) != 0) {
+                // Kuyruk bir sonraki açılışta CRC ile atılır
+            }
+            return ref;
+        }
+        if (syncEachRecord) {
+            ::fdatasync(segment.fd);
+        }
+        ref.segment = activeSegment;
+        ref.offset = segment.size;
+        ref.length = len;
+        segment.size += buffer.size();
+        return ref;
+    }
+    
+    void removeSegment(uint32_t number) {
+        auto it = segments.find(number);
+        if (it == segments.end()) return;
+        if (it->second.fd >= 0) ::close(it->second.fd);
+        std::error_code ec;
+        std::filesystem::remove(journalDir / journalSegmentName(number), ec);
+        segments.erase(it);
+    }
+    
+    void closeSegments() {
+        for (auto& entry : segments) {
+            if (entry.second.fd >= 0) ::close(entry.second.fd);
+        }
+        segments.clear();
+    }
+    
+    // Kalan op ve marker'ların ihtiyaç duymadığı eski segmentleri sil
+    void dropUnusedSegments() {
+        uint32_t needed = activeSegment;
+        for (const auto& ref : refs) {
+            if (ref.segment != 0) needed = std::min(needed, ref.segment);
+        }
+        for (const auto& marker : checkpointMarkers) {
+            auto it = markerSegments.find(marker.first);
+            if (it != markerSegments.end()) needed = std::min(needed, it->second);
+        }
+        for (auto it = markerSegments.begin(); it != markerSegments.end();) {
+            if (!checkpointMarkers.count(it->first)) {
+                it = markerSegments.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        
+        std::vector<uint32_t> unused;
+        for (const auto& entry : segments) {
+            if (entry.first < needed) unused.push_back(entry.first);
+        }
+        for (uint32_t number : unused) {
+            removeSegment(number);
+        }
+        if (!unused.empty()) syncDirectory(journalDir);
+    }
+    
+    // Mevcut segmentleri oku; son segmentteki yarım kayıt kesilir
+    void recoverSegments() {
+        std::vector<uint32_t> numbers;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(journalDir, ec)) {
+            if (entry.path().extension() != ".fol") continue;
+            try {
+                numbers.push_back(static_cast<uint32_t>(std::stoul(entry.path().stem().string())));
+            } catch (...) {
+                // Tanınmayan dosya - atla
+            }
+        }
+        std::sort(numbers.begin(), numbers.end());
+        
+        uint64_t maxId = 0;
+        for (size_t i = 0; i < numbers.size(); ++i) {
+            auto path = journalDir / journalSegmentName(numbers[i]);
+            int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+            if (fd < 0) continue;
+            Segment& segment = segments[numbers[i]];
+            segment.fd = fd;
+            activeSegment = numbers[i];
+            activeHasOps = false;
+            
+            struct stat st;
+            uint64_t fileSize = (::fstat(fd, &st) == 0) ? static_cast<uint64_t>(st.st_size) : 0;
+            uint8_t headerBytes[JOURNAL_HEADER_SIZE];
+            std::vector<uint8_t> payload;
+            uint64_t offset = 0;
+            
+            while (offset + JOURNAL_HEADER_SIZE <= fileSize) {
+                JournalHeader header;
+                if (!preadFull(fd, headerBytes, JOURNAL_HEADER_SIZE, offset) ||
+                    !decodeJournalHeader(headerBytes, header) ||
+                    offset + JOURNAL_HEADER_SIZE + header.len > fileSize) {
+                    break;
+                }
+                payload.resize(header.len);
+                if (header.len > 0 &&
+                    !preadFull(fd, payload.data(), header.len, offset + JOURNAL_HEADER_SIZE)) {
+                    break;
+                }
+                if (crc32c(payload.data(), header.len, crc32c(headerBytes, 20)) != header.crc) {
+                    break;
+                }
+                
+                if (header.type == JOURNAL_OP) {
+                    auto op = FileOperation::deserialize(payload);
+                    operations.push_back(stripPayload(op));
+                    RecordRef ref;
+                    ref.segment = numbers[i];
+                    ref.offset = offset;
+                    ref.length = header.len;
+                    refs.push_back(ref);
+                    maxId = std::max(maxId, op.operationId);
+                    activeHasOps = true;
+                } else {
+                    checkpointMarkers[header.id] = operations.size();
+                    markerSegments[header.id] = numbers[i];
+                }
+                offset += JOURNAL_HEADER_SIZE + header.len;
+            }
+            
+            segment.size = offset;
+            if (offset < fileSize && i + 1 == numbers.size() &&
+                ::ftruncate(fd, static_cast<off_t>(offset)) == 0) {
+                ::fdatasync(fd);
+            }
+        }
+        
+        if (maxId >= nextOpId) {
+            nextOpId = maxId + 1;
+        }
+    }
+    
+    // Bellekteki kayıtları (ve marker'ları aynı konumlarında) journal'a aktar
+    void migrate(std::vector<FileOperation> ops, const std::map<uint64_t, size_t>& markers) {
+        std::multimap<size_t, uint64_t> byIndex;
+        for (const auto& marker : markers) {
+            byIndex.emplace(marker.second, marker.first);
+        }
+        auto next = byIndex.begin();
+        for (size_t i = 0; i <= ops.size(); ++i) {
+            for (; next != byIndex.end() && next->first <= i; ++next) {
+                mark(next->second);
+            }
+            if (i < ops.size()) {
+                if (ops[i].operationId >= nextOpId) nextOpId = ops[i].operationId + 1;
+                store(std::move(ops[i]));
+            }
+        }
+    }
 };
 
 FileOperationLog::FileOperationLog() : m_impl(std::make_unique<Impl>()) {}
@@ -242,51 +704,40 @@ FileOperationLog& FileOperationLog::operator=(FileOperationLog&&) noexcept = def
 
 uint64_t FileOperationLog::recordOperation(const FileOperation& op) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
-    FileOperation newOp = op;
-    if (newOp.operationId == 0) {
-        newOp.operationId = m_impl->nextOpId++;
-    }
-    m_impl->operations.push_back(std::move(newOp));
-    return m_impl->operations.back().operationId;
+    return m_impl->append(op);
 }
 
 void FileOperationLog::recordOperations(const std::vector<FileOperation>& ops) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     for (const auto& op : ops) {
-        FileOperation newOp = op;
-        if (newOp.operationId == 0) {
-            newOp.operationId = m_impl->nextOpId++;
-        }
-        m_impl->operations.push_back(std::move(newOp));
+        m_impl->append(op);
     }
 }
 
 std::vector<FileOperation> FileOperationLog::getOperationsSince(uint64_t checkpointId) const {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
+    size_t startIndex = 0;      // Checkpoint bulunamazsa tümü
     auto it = m_impl->checkpointMarkers.find(checkpointId);
-    if (it == m_impl->checkpointMarkers.end()) {
-        return m_impl->operations;  // Return all if checkpoint not found
+    if (it != m_impl->checkpointMarkers.end()) {
+        startIndex = it->second;
     }
     
-    size_t startIndex = it->second;
-    if (startIndex >= m_impl->operations.size()) {
-        return {};
+    std::vector<FileOperation> result;
+    for (size_t i = startIndex; i < m_impl->operations.size(); ++i) {
+        result.push_back(m_impl->materialize(i));
     }
-    
-    return std::vector<FileOperation>(
-        m_impl->operations.begin() + startIndex,
-        m_impl->operations.end()
-    );
+    return result;
 }
 
 std::vector<FileOperation> FileOperationLog::getOperationsForFile(const std::string& path) const {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     std::vector<FileOperation> result;
     
-    for (const auto& op : m_impl->operations) {
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        const auto& op = m_impl->operations[i];
         if (op.path == path || op.originalPath == path) {
-            result.push_back(op);
+            result.push_back(m_impl->materialize(i));
         }
     }
     
@@ -297,9 +748,9 @@ std::vector<FileOperation> FileOperationLog::getOperationsByType(FileOperationTy
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     std::vector<FileOperation> result;
     
-    for (const auto& op : m_impl->operations) {
-        if (op.type == type) {
-            result.push_back(op);
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        if (m_impl->operations[i].type == type) {
+            result.push_back(m_impl->materialize(i));
         }
     }
     
@@ -308,15 +759,23 @@ std::vector<FileOperation> FileOperationLog::getOperationsByType(FileOperationTy
 
 std::vector<FileOperation> FileOperationLog::getAllOperations() const {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
-    return m_impl->operations;
+    if (!m_impl->journaled) {
+        return m_impl->operations;
+    }
+    std::vector<FileOperation> result;
+    result.reserve(m_impl->operations.size());
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        result.push_back(m_impl->materialize(i));
+    }
+    return result;
 }
 
 std::optional<FileOperation> FileOperationLog::getOperation(uint64_t operationId) const {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
-    for (const auto& op : m_impl->operations) {
-        if (op.operationId == operationId) {
-            return op;
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        if (m_impl->operations[i].operationId == operationId) {
+            return m_impl->materialize(i);
         }
     }
     
@@ -328,9 +787,11 @@ std::vector<FileOperation> FileOperationLog::filterOperations(
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     std::vector<FileOperation> result;
     
-    for (const auto& op : m_impl->operations) {
+    // Predicate içeriğe bakabilir: journal modunda her kayıt okunur
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        FileOperation op = m_impl->materialize(i);
         if (predicate(op)) {
-            result.push_back(op);
+            result.push_back(std::move(op));
         }
     }
     
@@ -339,7 +800,29 @@ std::vector<FileOperation> FileOperationLog::filterOperations(
 
 void FileOperationLog::markCheckpoint(uint64_t checkpointId) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
-    m_impl->checkpointMarkers[checkpointId] = m_impl->operations.size();
+    m_impl->mark(checkpointId);
+    m_impl->epochCoverage.clear();      // yeni epoch
+}
+
+void FileOperationLog::setCoalesceWrites(bool enable) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->coalesceWrites = enable;
+    m_impl->epochCoverage.clear();
+}
+
+bool FileOperationLog::getCoalesceWrites() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->coalesceWrites;
+}
+
+size_t FileOperationLog::getCoalescedOperationCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->coalescedOps;
+}
+
+uint64_t FileOperationLog::getCoalescedBytes() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->coalescedBytes;
 }
 
 void FileOperationLog::clearOperationsBeforeCheckpoint(uint64_t checkpointId) {
@@ -356,6 +839,9 @@ void FileOperationLog::clearOperationsBeforeCheckpoint(uint64_t checkpointId) {
             m_impl->operations.begin(),
             m_impl->operations.begin() + removeCount
         );
+        if (m_impl->journaled) {
+            m_impl->refs.erase(m_impl->refs.begin(), m_impl->refs.begin() + removeCount);
+        }
         
         // Update markers
         std::map<uint64_t, size_t> newMarkers;
@@ -366,6 +852,10 @@ void FileOperationLog::clearOperationsBeforeCheckpoint(uint64_t checkpointId) {
         }
         m_impl->checkpointMarkers = std::move(newMarkers);
     }
+    
+    if (m_impl->journaled) {
+        m_impl->dropUnusedSegments();
+    }
 }
 
 size_t FileOperationLog::getOperationCount() const {
@@ -377,99 +867,157 @@ void FileOperationLog::clear() {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     m_impl->operations.clear();
     m_impl->checkpointMarkers.clear();
+    m_impl->epochCoverage.clear();
+    
+    if (m_impl->journaled) {
+        m_impl->refs.clear();
+        m_impl->markerSegments.clear();
+        uint32_t next = m_impl->activeSegment + 1;
+        std::vector<uint32_t> numbers;
+        for (const auto& entry : m_impl->segments) numbers.push_back(entry.first);
+        for (uint32_t number : numbers) m_impl->removeSegment(number);
+        m_impl->openSegment(next, nullptr);
+    }
 }
 
-std::vector<uint8_t> FileOperationLog::serialize() const {
+bool FileOperationLog::openJournal(const std::filesystem::path& dir, std::string* error) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
-    std::vector<uint8_t> data;
+    if (m_impl->journaled) {
+        if (error) *error = "Journal already open: " + m_impl->journalDir.string();
+        return false;
+    }
     
-    // Header: magic + version
-    data.push_back('F');
-    data.push_back('O');
-    data.push_back('L');
-    data.push_back('G');
-    data.push_back(1);  // version
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        if (error) *error = "Cannot create journal directory " + dir.string() + ": " + ec.message();
+        return false;
+    }
     
-    // Operation count
-    uint64_t count = m_impl->operations.size();
-    for (int i = 0; i < 8; i++) {
-        data.push_back((count >> (i * 8)) & 0xFF);
+    auto pending = std::move(m_impl->operations);
+    auto pendingMarkers = std::move(m_impl->checkpointMarkers);
+    m_impl->operations.clear();
+    m_impl->checkpointMarkers.clear();
+    m_impl->journalDir = dir;
+    m_impl->journaled = true;
+    
+    m_impl->recoverSegments();
+    if (m_impl->segments.empty() && !m_impl->openSegment(1, error)) {
+        m_impl->journaled = false;
+        m_impl->operations = std::move(pending);
+        m_impl->checkpointMarkers = std::move(pendingMarkers);
+        return false;
     }
     
-    // Serialize each operation
-    for (const auto& op : m_impl->operations) {
-        auto opData = op.serialize();
-        uint64_t opSize = opData.size();
-        for (int i = 0; i < 8; i++) {
-            data.push_back((opSize >> (i * 8)) & 0xFF);
+    // Diskteki kayıtların coverage'ı bilinmiyor: yeni epoch gibi başla
+    m_impl->epochCoverage.clear();
+    m_impl->migrate(std::move(pending), pendingMarkers);
+    return true;
+}
+
+void FileOperationLog::closeJournal() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    if (!m_impl->journaled) return;
+    
+    for (size_t i = 0; i < m_impl->operations.size(); ++i) {
+        if (m_impl->refs[i].segment != 0) {
+            m_impl->operations[i] = m_impl->materialize(i);
         }
-        data.insert(data.end(), opData.begin(), opData.end());
     }
+    m_impl->closeSegments();
+    m_impl->refs.clear();
+    m_impl->markerSegments.clear();
+    m_impl->activeSegment = 0;
+    m_impl->activeHasOps = false;
+    m_impl->journaled = false;
+}
+
+bool FileOperationLog::isJournaled() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->journaled;
+}
+
+void FileOperationLog::setJournalSyncEachRecord(bool enable) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->syncEachRecord = enable;
+}
+
+bool FileOperationLog::syncJournal() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    if (!m_impl->journaled) return false;
+    bool ok = true;
+    for (const auto& entry : m_impl->segments) {
+        if (::fdatasync(entry.second.fd) != 0) ok = false;
+    }
+    return ok;
+}
+
+size_t FileOperationLog::getSegmentCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->segments.size();
+}
+
+uint64_t FileOperationLog::getJournalSize() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    uint64_t total = 0;
+    for (const auto& entry : m_impl->segments) {
+        total += entry.second.size;
+    }
+    return total;
+}
+
+std::vector<uint8_t> FileOperationLog::serialize() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    std::vector<uint8_t> data;
+    BinaryWriter writer(data);
     
-    // Serialize checkpoint markers
-    uint32_t markerCount = static_cast<uint32_t>(m_impl->checkpointMarkers.size());
-    for (int i = 0; i < 4; i++) {
-        data.push_back((markerCount >> (i * 8)) & 0xFF);
+    // Header: magic + version
+    writer.writeBytes("FOLG", 4);
+    writer.writeU8(1);  // version
+    
+    // Operation count + her işlem (boyut önekli)
+    writer.writeLE(static_cast<uint64_t>(m_impl->operations.size()));
+    for (size_t index = 0; index < m_impl->operations.size(); ++index) {
+        auto opData = m_impl->materialize(index).serialize();
+        writer.writeLE(static_cast<uint64_t>(opData.size()));
+        writer.writeBytes(opData.data(), opData.size());
     }
+    
+    // Checkpoint markers
+    writer.writeLE(static_cast<uint32_t>(m_impl->checkpointMarkers.size()));
     for (const auto& marker : m_impl->checkpointMarkers) {
-        for (int i = 0; i < 8; i++) {
-            data.push_back((marker.first >> (i * 8)) & 0xFF);
-        }
-        uint64_t idx = marker.second;
-        for (int i = 0; i < 8; i++) {
-            data.push_back((idx >> (i * 8)) & 0xFF);
-        }
+        writer.writeLE(static_cast<uint64_t>(marker.first));
+        writer.writeLE(static_cast<uint64_t>(marker.second));
     }
     
     return data;
 }
 
-FileOperationLog FileOperationLog::deserialize(const std::vector<uint8_t>& data) {
+FileOperationLog FileOperationLog::deserialize(std::span<const uint8_t> data) {
     FileOperationLog log;
-    size_t pos = 0;
+    BinaryReader reader(data);
     
     // Check header
-    if (data.size() < 5 || data[0] != 'F' || data[1] != 'O' || 
-        data[2] != 'L' || data[3] != 'G') {
+    auto magic = reader.readBytes(4);
+    if (!reader.ok() || std::memcmp(magic.data(), "FOLG", 4) != 0 || !reader.skip(1)) {
         return log;
     }
-    pos = 5;  // Skip header
     
-    auto readU64 = [&data, &pos]() -> uint64_t {
-        uint64_t val = 0;
-        for (int i = 0; i < 8 && pos < data.size(); i++, pos++) {
-            val |= static_cast<uint64_t>(data[pos]) << (i * 8);
-        }
-        return val;
-    };
-    
-    auto readU32 = [&data, &pos]() -> uint32_t {
-        uint32_t val = 0;
-        for (int i = 0; i < 4 && pos < data.size(); i++, pos++) {
-            val |= static_cast<uint32_t>(data[pos]) << (i * 8);
-        }
-        return val;
-    };
-    
-    // Read operations
-    uint64_t count = readU64();
-    for (uint64_t i = 0; i < count && pos < data.size(); i++) {
-        uint64_t opSize = readU64();
-        if (pos + opSize > data.size()) break;
-        
-        std::vector<uint8_t> opData(data.begin() + pos, data.begin() + pos + opSize);
-        pos += opSize;
-        
-        auto op = FileOperation::deserialize(opData);
-        log.recordOperation(op);
+    // Operations: her biri kaydın slice'ından, kopyasız okunur
+    uint64_t count = reader.readLE<uint64_t>();
+    for (uint64_t i = 0; i < count && reader.ok(); i++) {
+        auto opData = reader.readBytes(static_cast<size_t>(reader.readLE<uint64_t>()));
+        if (!reader.ok()) break;
+        log.recordOperation(FileOperation::deserialize(opData));
     }
     
-    // Read checkpoint markers
-    if (pos < data.size()) {
-        uint32_t markerCount = readU32();
-        for (uint32_t i = 0; i < markerCount && pos < data.size(); i++) {
-            uint64_t checkpointId = readU64();
-            uint64_t idx = readU64();
+    // Checkpoint markers
+    if (!reader.atEnd()) {
+        uint32_t markerCount = reader.readLE<uint32_t>();
+        for (uint32_t i = 0; i < markerCount; i++) {
+            uint64_t checkpointId = reader.readLE<uint64_t>();
+            uint64_t idx = reader.readLE<uint64_t>();
+            if (!reader.ok()) break;
             log.m_impl->checkpointMarkers[checkpointId] = idx;
         }
     }
@@ -498,7 +1046,25 @@ bool FileOperationLog::loadFromFile(const std::filesystem::path& path) {
     
     if (!file) return false;
     
-    *this = std::move(FileOperationLog::deserialize(data));
+    auto loaded = FileOperationLog::deserialize(data);
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    if (!m_impl->journaled) {
+        std::swap(m_impl, loaded.m_impl);
+        return true;
+    }
+    
+    // Journal açık: eski segmentleri at, yüklenen kayıtları yeniden yaz
+    std::vector<uint32_t> numbers;
+    for (const auto& entry : m_impl->segments) numbers.push_back(entry.first);
+    uint32_t next = m_impl->activeSegment + 1;
+    for (uint32_t number : numbers) m_impl->removeSegment(number);
+    m_impl->operations.clear();
+    m_impl->refs.clear();
+    m_impl->checkpointMarkers.clear();
+    m_impl->markerSegments.clear();
+    m_impl->epochCoverage.clear();
+    if (!m_impl->openSegment(next, nullptr)) return false;
+    m_impl->migrate(std::move(loaded.m_impl->operations), loaded.m_impl->checkpointMarkers);
     return true;
 }
 
@@ -524,14 +1090,105 @@ struct FileOperationTracker::Impl {
     std::map<std::string, PendingOp> pendingUnlinks;
     std::map<std::string, PendingOp> pendingRenames;    // oldPath -> pending
     std::map<std::string, PendingOp> pendingCreates;
+    
+    // backupDir'e yazılan ön görüntüler. Önek aynı dizini paylaşan
+    // tracker'ların (ve process'lerin) dosyalarını ayırır.
+    FileBackupStrategy backupStrategy;
+    std::string backupPrefix;
+    std::vector<std::string> backupFiles;
+    
+    Impl() {
+        static std::atomic<uint64_t> trackerSeq{0};
+        backupPrefix = "fop-" + std::to_string(::getpid()) + "-" + std::to_string(trackerSeq++);
+    }
+    
+    // path'in tamamını backupDir'e kopyala (mutex tutulurken). backupDir
+    // yoksa ya da kopya başarısızsa false: çağıran belleğe düşer.
+    bool backupToFile(const std::string& path, FileOperation& op) {
+        if (options.backupDir.empty()) return false;
+        std::error_code ec;
+        std::filesystem::create_directories(options.backupDir, ec);
+        std::string dst = options.backupDir + "/" + backupPrefix + "-" +
+                          std::to_string(op.operationId) + ".pre";
+        if (backupStrategy.copyFile(path, dst) == BackupMethod::None) {
+            std::filesystem::remove(dst, ec);
+            return false;
+        }
+        op.backupPath = dst;
+        backupFiles.push_back(std::move(dst));
+        return true;
+    }
+    
+    // path -> salt okunur fd. Sıcak yazma döngülerinde her çağrıda
+    // open/stat yerine aynı fd'ye fstat + pread yapılır.
+    std::map<std::string, int> readFds;
+    mutable std::mutex fdMutex;
+    
+    ~Impl() {
+        for (auto& entry : readFds) {
+            ::close(entry.second);
+        }
+    }
+    
+    // fdMutex tutulurken çağrılır
+    int cachedFd(const std::string& path) {
+        auto it = readFds.find(path);
+        if (it != readFds.end()) return it->second;
+        
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return -1;
+        if (readFds.size() >= MAX_CACHED_FILES) {
+            ::close(readFds.begin()->second);
+            readFds.erase(readFds.begin());
+        }
+        readFds.emplace(path, fd);
+        return fd;
+    }
+    
+    // Önbellekteki fd ile st'yi doldur (verildiyse) ve [offset, offset+size)
+    // aralığını tek pread ile oku. Dosya açılamazsa false.
+    bool readRange(const std::string& path, off_t offset, size_t size,
+                   std::vector<uint8_t>* out, struct stat* st) {
+        std::lock_guard<std::mutex> lock(fdMutex);
+        int fd = cachedFd(path);
+        if (fd < 0) return false;
+        if (st && ::fstat(fd, st) != 0) return false;
+        if (!out) return true;
+        
+        out->resize(size);
+        size_t got = 0;
+        while (got < size) {
+            ssize_t n = ::pread(fd, out->data() + got, size - got, offset + static_cast<off_t>(got));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;      // EOF ya da hata: okunan kadarı
+            got += static_cast<size_t>(n);
+        }
+        out->resize(got);
+        return true;
+    }
+    
+    void invalidate(const std::string& path) {
+        std::lock_guard<std::mutex> lock(fdMutex);
+        auto it = readFds.find(path);
+        if (it != readFds.end()) {
+            ::close(it->second);
+            readFds.erase(it);
+        }
+    }
 };
 
 FileOperationTracker::FileOperationTracker() 
-    : m_impl(std::make_unique<Impl>()) {}
+    : m_impl(std::make_unique<Impl>()) {
+    m_impl->log.setCoalesceWrites(m_impl->options.coalesceWrites);
+}
 
 FileOperationTracker::FileOperationTracker(const FileTrackingOptions& options)
     : m_impl(std::make_unique<Impl>()) {
     m_impl->options = options;
+    m_impl->log.setCoalesceWrites(options.coalesceWrites);
+    if (!options.journalDir.empty()) {
+        m_impl->log.openJournal(options.journalDir);
+    }
 }
 
 FileOperationTracker::~FileOperationTracker() {
@@ -603,37 +1260,50 @@ uint64_t FileOperationTracker::generateOperationId() {
 }
 
 std::vector<uint8_t> FileOperationTracker::captureFileContent(const std::string& path) {
-    std::ifstream file(path, std::ios::binary);
-    if (!file) return {};
-    
-    file.seekg(0, std::ios::end);
-    size_t size = file.tellg();
+    struct stat st;
+    if (!m_impl->readRange(path, 0, 0, nullptr, &st)) return {};
     
     // Boyut sınırlaması
-    if (size > m_impl->options.maxFileSize) {
+    if (static_cast<size_t>(st.st_size) > m_impl->options.maxFileSize) {
         return {};  // Too large for full backup
     }
     
-    file.seekg(0, std::ios::beg);
-    std::vector<uint8_t> content(size);
-    file.read(reinterpret_cast<char*>(content.data()), size);
-    
+    std::vector<uint8_t> content;
+    m_impl->readRange(path, 0, static_cast<size_t>(st.st_size), &content, nullptr);
     return content;
 }
 
 std::vector<uint8_t> FileOperationTracker::captureFileContent(
     const std::string& path, off_t offset, size_t size) {
     
-    std::ifstream file(path, std::ios::binary);
-    if (!file) return {};
-    
-    file.seekg(offset, std::ios::beg);
-    std::vector<uint8_t> content(size);
-    file.read(reinterpret_cast<char*>(content.data()), size);
-    
+    std::vector<uint8_t> content;
+    m_impl->readRange(path, offset, size, &content, nullptr);
     return content;
 }
 
+void FileOperationTracker::invalidateFile(const std::string& path) {
+    m_impl->invalidate(path);
+}
+
+size_t FileOperationTracker::getBackupFileCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->backupFiles.size();
+}
+
+void FileOperationTracker::removeBackupFiles() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    std::error_code ec;
+    for (const auto& file : m_impl->backupFiles) {
+        std::filesystem::remove(file, ec);
+    }
+    m_impl->backupFiles.clear();
+}
+
+size_t FileOperationTracker::getCachedFileCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->fdMutex);
+    return m_impl->readFds.size();
+}
+
 void FileOperationTracker::beforeWrite(int fd, const std::string& path, 
                                         off_t offset, size_t size) {
     if (!m_impl->isTracking || !shouldTrackFile(path)) return;
@@ -649,22 +1319,26 @@ void FileOperationTracker::beforeWrite(int fd, const std::string& path,
     op.offset = offset;
     op.pid = m_impl->trackedPid;
     
-    // Get file stats before write
+    // Tek fstat + pread: append'in (offset < 0) üzerine yazdığı eski veri
+    // yoktur, sadece başladığı yer (dosya sonu) bilinmeli
+    bool capture = size <= m_impl->options.maxFileSize;
     struct stat st;
-    if (stat(path.c_str(), &st) == 0) {
+    std::vector<uint8_t> oldContent;
+    if (m_impl->readRange(path, offset < 0 ? 0 : offset,
+                          (capture && offset >= 0) ? size : 0, &oldContent, &st)) {
         op.originalSize = st.st_size;
         op.originalMode = st.st_mode;
         op.originalUid = st.st_uid;
         op.originalGid = st.st_gid;
-    }
-    
-    // Capture content that will be overwritten
-    if (size <= m_impl->options.maxFileSize) {
-        // For small writes, capture the affected region
-        auto oldContent = captureFileContent(path, offset, size);
-        if (!oldContent.empty()) {
+        if (offset < 0) {
+            op.offset = st.st_size;
+        }
+        
+        // Boş oldData da kaydedilir: dosyayı büyüten kısım reverse'te
+        // originalSize'a kesilerek geri alınır
+        if (capture) {
             FileContentDiff diff;
-            diff.offset = offset;
+            diff.offset = op.offset;
             diff.oldData = std::move(oldContent);
             op.diffs.push_back(std::move(diff));
         }
@@ -689,17 +1363,19 @@ void FileOperationTracker::afterWrite(int fd, const std::string& path,
     if (!success) {
         op.isReversible = false;
         op.description = "Write failed";
+    } else if (fd != op.fd || (offset >= 0 && offset != op.offset)) {
+        // Bekleyen kayıt aynı path'e başka bir yazmaya ait: ön görüntü bu
+        // aralığı kapsamaz. Append'in (offset < 0) gerçek offset'i
+        // beforeWrite'ta bulunduğundan karşılaştırılmaz.
+        op.isReversible = false;
+        op.description = "Write does not match pending pre-image";
     } else {
-        // Get new file size
-        struct stat st;
-        if (stat(path.c_str(), &st) == 0) {
-            op.newSize = st.st_size;
-        }
+        // Yeni boyut stat'sız: yazma dosyayı en fazla offset+size'a büyütür
+        op.newSize = std::max(op.originalSize, static_cast<size_t>(op.offset) + size);
         
         // Capture new content for diff
         if (!op.diffs.empty() && size <= m_impl->options.maxFileSize) {
-            auto newContent = captureFileContent(path, offset, size);
-            op.diffs[0].newData = std::move(newContent);
+            m_impl->readRange(path, op.offset, size, &op.diffs[0].newData, nullptr);
         }
     }
     
@@ -724,8 +1400,9 @@ void FileOperationTracker::beforeTruncate(const std::string& path, off_t length)
         op.originalSize = st.st_size;
         op.originalMode = st.st_mode;
         
-        // If truncating, capture content that will be removed
-        if (static_cast<size_t>(length) < st.st_size) {
+        // Disk yedeği tüm dosyayı kapsar: kesilen kısım ayrıca tutulmaz
+        if (!m_impl->backupToFile(path, op) && static_cast<size_t>(length) < st.st_size) {
+            // If truncating, capture content that will be removed
             size_t removeSize = st.st_size - length;
             if (removeSize <= m_impl->options.maxFileSize) {
                 auto content = captureFileContent(path, length, removeSize);
@@ -740,7 +1417,7 @@ void FileOperationTracker::beforeTruncate(const std::string& path, off_t length)
     }
     
     // Full backup for small files
-    if (op.originalSize <= m_impl->options.maxFileSize) {
+    if (!op.hasFullBackup() && op.originalSize <= m_impl->options.maxFileSize) {
         op.originalContent = captureFileContent(path);
     }
     
@@ -787,7 +1464,8 @@ void FileOperationTracker::beforeUnlink(const std::string& path) {
         op.originalGid = st.st_gid;
         
         // Full backup before delete
-        if (st.st_size <= static_cast<off_t>(m_impl->options.maxFileSize)) {
+        if (!m_impl->backupToFile(path, op) &&
+            st.st_size <= static_cast<off_t>(m_impl->options.maxFileSize)) {
             op.originalContent = captureFileContent(path);
         }
     }
@@ -806,6 +1484,7 @@ void FileOperationTracker::afterUnlink(const std::string& path, bool success) {
     
     FileOperation op = std::move(it->second.op);
     m_impl->pendingUnlinks.erase(it);
+    m_impl->invalidate(path);
     
     op.isReversible = success && op.hasFullBackup();
     op.newSize = 0;
@@ -838,7 +1517,8 @@ void FileOperationTracker::beforeRename(const std::string& oldPath, const std::s
     // Check if newPath exists (will be overwritten)
     if (stat(newPath.c_str(), &st) == 0) {
         // Capture content that will be overwritten
-        if (st.st_size <= static_cast<off_t>(m_impl->options.maxFileSize)) {
+        if (!m_impl->backupToFile(newPath, op) &&
+            st.st_size <= static_cast<off_t>(m_impl->options.maxFileSize)) {
             op.originalContent = captureFileContent(newPath);
         }
     }
@@ -858,6 +1538,8 @@ void FileOperationTracker::afterRename(const std::string& oldPath,
     
     FileOperation op = std::move(it->second.op);
     m_impl->pendingRenames.erase(it);
+    m_impl->invalidate(oldPath);
+    m_impl->invalidate(newPath);
     
     op.isReversible = success;
     if (success) {
@@ -899,6 +1581,7 @@ void FileOperationTracker::afterCreate(const std::string& path, int fd, bool suc
     
     FileOperation op = std::move(it->second.op);
     m_impl->pendingCreates.erase(it);
+    m_impl->invalidate(path);
     
     op.fd = fd;
     op.isReversible = success;  // Can reverse by deleting
@@ -916,6 +1599,12 @@ const FileOperationLog& FileOperationTracker::getLog() const {
 
 void FileOperationTracker::setOptions(const FileTrackingOptions& options) {
     m_impl->options = options;
+    if (m_impl->log.getCoalesceWrites() != options.coalesceWrites) {
+        m_impl->log.setCoalesceWrites(options.coalesceWrites);
+    }
+    if (!options.journalDir.empty() && !m_impl->log.isJournaled()) {
+        m_impl->log.openJournal(options.journalDir);
+    }
 }
 
 const FileTrackingOptions& FileOperationTracker::getOptions() const {
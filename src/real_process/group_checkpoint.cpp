@@ -0,0 +1,681 @@
+#include "real_process/group_checkpoint.hpp"
+#include "real_process/dump_buffer_pool.hpp"
+#include "real_process/proc_reader.hpp"
+#include "core/binary_io.hpp"
+#include "core/metrics.hpp"
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+namespace checkpoint {
+namespace real_process {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char GROUP_MAGIC[4] = {'R', 'G', 'R', 'P'};
+constexpr uint32_t GROUP_VERSION = 1;
+constexpr size_t GROUP_HEADER_SIZE = 32;
+
+uint64_t elapsedNanos(Clock::time_point since) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - since).count());
+}
+
+void setError(std::string* error, std::string message) {
+    if (error) *error = std::move(message);
+}
+
+// ============================================================================
+// Ağaç
+// ============================================================================
+
+struct TreeEntry {
+    pid_t pid;
+    pid_t ppid;
+    std::string name;
+};
+
+// Kök önce, genişlik öncelikli: ebeveyn her zaman çocuklarından önce
+std::vector<TreeEntry> collectTree(pid_t rootPid, pid_t rootPpid) {
+    std::vector<TreeEntry> entries;
+    std::deque<std::pair<ProcessTreeNode, pid_t>> queue;
+    queue.emplace_back(buildProcessTree(rootPid), rootPpid);
+    while (!queue.empty()) {
+        auto [node, ppid] = std::move(queue.front());
+        queue.pop_front();
+        entries.push_back({node.pid, ppid, node.name});
+        for (auto& child : node.children) {
+            queue.emplace_back(std::move(child), node.pid);
+        }
+    }
+    return entries;
+}
+
+bool waitStopped(ProcFSReader& reader, pid_t pid, int timeoutMs) {
+    auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (Clock::now() < deadline) {
+        auto info = reader.getProcessInfo(pid);
+        if (!info) return false;
+        if (info->state == LinuxProcessState::STOPPED) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+// ============================================================================
+// Cgroup Freezer
+// ============================================================================
+
+struct FreezerCgroup {
+    std::string dir;
+    bool v2;
+};
+
+std::string readFirstLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+bool writeText(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    file << text;
+    file.flush();
+    return static_cast<bool>(file);
+}
+
+// /proc/<pid>/cgroup satırından hiyerarşideki yol: v2 "0::/yol",
+// v1 "N:freezer[,...]:/yol"
+std::optional<std::string> cgroupPath(pid_t pid, bool v2) {
+    std::ifstream file("/proc/" + std::to_string(pid) + "/cgroup");
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t first = line.find(':');
+        size_t second = first == std::string::npos ? first : line.find(':', first + 1);
+        if (second == std::string::npos) continue;
+
+        std::string controllers = line.substr(first + 1, second - first - 1);
+        bool match = false;
+        if (v2) {
+            match = line.compare(0, first, "0") == 0 && controllers.empty();
+        } else {
+            std::stringstream list(controllers);
+            std::string controller;
+            while (std::getline(list, controller, ',')) {
+                if (controller == "freezer") match = true;
+            }
+        }
+        if (match) return line.substr(second + 1);
+    }
+    return std::nullopt;
+}
+
+// Ağacın tamamı aynı cgroup'taysa, cgroup'ta ağaç dışından process yoksa ve
+// çağıran o cgroup'un (ya da altının) içinde değilse kullanılabilir
+std::optional<FreezerCgroup> findFreezer(const std::vector<TreeEntry>& tree) {
+    std::set<pid_t> members;
+    for (const auto& entry : tree) members.insert(entry.pid);
+
+    for (bool v2 : {true, false}) {
+        auto path = cgroupPath(tree.front().pid, v2);
+        if (!path || *path == "/" || path->empty()) continue;
+
+        bool shared = std::all_of(tree.begin(), tree.end(), [&](const TreeEntry& entry) {
+            return cgroupPath(entry.pid, v2) == path;
+        });
+        auto self = cgroupPath(getpid(), v2);
+        if (!shared || !self || *self == *path || self->rfind(*path + "/", 0) == 0) continue;
+
+        std::vector<std::string> roots = v2
+            ? std::vector<std::string>{"/sys/fs/cgroup", "/sys/fs/cgroup/unified"}
+            : std::vector<std::string>{"/sys/fs/cgroup/freezer"};
+        for (const auto& root : roots) {
+            std::string dir = root + *path;
+            if (!std::filesystem::exists(dir + (v2 ? "/cgroup.freeze" : "/freezer.state"))) continue;
+
+            std::ifstream procs(dir + "/cgroup.procs");
+            bool dedicated = static_cast<bool>(procs);
+            pid_t pid;
+            while (dedicated && procs >> pid) {
+                dedicated = members.count(pid) > 0;
+            }
+            if (dedicated) return FreezerCgroup{dir, v2};
+        }
+    }
+    return std::nullopt;
+}
+
+bool setFrozen(const FreezerCgroup& cgroup, bool frozen, int timeoutMs) {
+    bool written = cgroup.v2
+        ? writeText(cgroup.dir + "/cgroup.freeze", frozen ? "1" : "0")
+        : writeText(cgroup.dir + "/freezer.state", frozen ? "FROZEN" : "THAWED");
+    if (!written) return false;
+    if (!frozen) return true;
+
+    // v1: FREEZING -> FROZEN; v2: cgroup.events "frozen 1"
+    auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (Clock::now() < deadline) {
+        if (cgroup.v2) {
+            std::ifstream events(cgroup.dir + "/cgroup.events");
+            std::string key, value;
+            while (events >> key >> value) {
+                if (key == "frozen" && value == "1") return true;
+            }
+        } else if (readFirstLine(cgroup.dir + "/freezer.state") == "FROZEN") {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+// ============================================================================
+// Durdurma
+// ============================================================================
+
+struct StoppedTree {
+    std::vector<TreeEntry> members;
+    std::vector<pid_t> resumable;       // Bizim durdurduklarımız
+    GroupFreezeMode mode = GroupFreezeMode::Signal;
+};
+
+void resumeAll(const std::vector<pid_t>& pids) {
+    for (pid_t pid : pids) {
+        kill(pid, SIGCONT);
+    }
+}
+
+// Durmuş olanlar atlanır (sonda devam ettirilmemeli)
+void sendStop(ProcFSReader& reader, pid_t pid, StoppedTree& stopped) {
+    if (reader.getProcessState(pid) == LinuxProcessState::STOPPED) return;
+    if (kill(pid, SIGSTOP) == 0) {
+        stopped.resumable.push_back(pid);
+    }
+}
+
+bool stopViaCgroup(pid_t rootPid, pid_t rootPpid, const FreezerCgroup& cgroup,
+                   const GroupCheckpointOptions& options, StoppedTree& stopped, std::string& error) {
+    ProcFSReader reader;
+    if (!setFrozen(cgroup, true, options.stopTimeoutMs)) {
+        setFrozen(cgroup, false, 0);
+        error = "Failed to freeze cgroup " + cgroup.dir;
+        return false;
+    }
+
+    // Donmuşken ağaç değişemez: tek tarama yeter
+    stopped.members = collectTree(rootPid, rootPpid);
+    for (const auto& entry : stopped.members) {
+        sendStop(reader, entry.pid, stopped);
+    }
+    setFrozen(cgroup, false, 0);
+
+    for (const auto& entry : stopped.members) {
+        if (!waitStopped(reader, entry.pid, options.stopTimeoutMs)) {
+            error = "Process " + std::to_string(entry.pid) + " did not stop";
+            return false;
+        }
+    }
+    stopped.mode = GroupFreezeMode::Cgroup;
+    return true;
+}
+
+bool stopViaSignals(pid_t rootPid, pid_t rootPpid, const GroupCheckpointOptions& options,
+                    StoppedTree& stopped, std::string& error) {
+    ProcFSReader reader;
+    std::set<pid_t> seen;
+
+    for (unsigned pass = 0; pass < std::max(1u, options.maxStopPasses); ++pass) {
+        auto tree = collectTree(rootPid, rootPpid);
+        std::vector<pid_t> fresh;
+        for (const auto& entry : tree) {
+            if (seen.insert(entry.pid).second) {
+                sendStop(reader, entry.pid, stopped);
+                fresh.push_back(entry.pid);
+            }
+        }
+        if (fresh.empty()) {
+            stopped.members = std::move(tree);
+            stopped.mode = GroupFreezeMode::Signal;
+            return true;
+        }
+
+        // Durmadan önce fork edilen çocuklar bir sonraki taramada yakalanır
+        for (pid_t pid : fresh) {
+            if (!waitStopped(reader, pid, options.stopTimeoutMs)) {
+                error = "Process " + std::to_string(pid) + " did not stop";
+                return false;
+            }
+        }
+    }
+    error = "Process tree kept changing after " + std::to_string(options.maxStopPasses) + " passes";
+    return false;
+}
+
+// ============================================================================
+// Dedupe
+// ============================================================================
+
+struct SharedPages {
+    std::mutex mutex;
+    PageStore* store;
+    std::unordered_map<uint64_t, uint32_t> frames;      // PFN -> sayfa id
+    uint64_t frameHits = 0;
+};
+
+// Sayfa hizalı dump'ları pageRefs'e çevir; veriler havuza döner
+void dedupeMember(pid_t pid, RealProcessCheckpoint& checkpoint, ProcFSReader& reader,
+                  SharedPages& shared, DumpBufferPool& pool) {
+    const bool framesUsable = static_cast<size_t>(sysconf(_SC_PAGESIZE)) == PageStore::PAGE_BYTES;
+
+    for (auto& dump : checkpoint.memoryDumps) {
+        size_t size = dump.data.size();
+        if (!dump.isValid || dump.zeroFill || dump.isDeduplicated() ||
+            size == 0 || size % PageStore::PAGE_BYTES != 0) {
+            continue;
+        }
+
+        std::vector<uint32_t> refs(size / PageStore::PAGE_BYTES);
+        std::optional<std::vector<uint64_t>> frames;
+        if (framesUsable) {
+            frames = reader.getPageFrames(pid, dump.region.startAddr, size);
+            if (frames && frames->size() != refs.size()) frames.reset();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            for (size_t p = 0; p < refs.size(); ++p) {
+                uint64_t pfn = frames ? (*frames)[p] : 0;
+                if (pfn) {
+                    auto it = shared.frames.find(pfn);
+                    if (it != shared.frames.end()) {
+                        refs[p] = it->second;
+                        shared.frameHits++;
+                        continue;
+                    }
+                }
+                refs[p] = shared.store->intern(dump.data.data() + p * PageStore::PAGE_BYTES);
+                if (pfn) shared.frames.emplace(pfn, refs[p]);
+            }
+        }
+
+        dump.pageRefs = std::move(refs);
+        pool.recycle(dump);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// GroupCheckpoint
+// ============================================================================
+
+const GroupMember* GroupCheckpoint::member(pid_t pid) const {
+    for (const auto& m : members) {
+        if (m.pid == pid) return &m;
+    }
+    return nullptr;
+}
+
+std::optional<RealProcessCheckpoint> GroupCheckpoint::materialize(pid_t pid) const {
+    const GroupMember* m = member(pid);
+    if (!m) return std::nullopt;
+
+    RealProcessCheckpoint copy = m->checkpoint;
+    if (!rehydratePages(copy, *pages)) return std::nullopt;
+    return copy;
+}
+
+bool GroupCheckpoint::save(const std::string& filepath, std::string* error) const {
+    std::vector<std::vector<uint8_t>> records;
+    records.reserve(members.size());
+    for (const auto& m : members) {
+        records.push_back(m.checkpoint.serialize());
+    }
+
+    size_t indexSize = 0;
+    for (const auto& m : members) {
+        indexSize += 2 * sizeof(int32_t) + 2 * sizeof(uint64_t) + sizeof(uint32_t) + m.name.size();
+    }
+    uint64_t offset = GROUP_HEADER_SIZE + indexSize;
+    uint64_t recordsEnd = offset;
+    for (const auto& record : records) recordsEnd += record.size();
+    uint64_t pageOffset = (recordsEnd + PageStore::PAGE_BYTES - 1) / PageStore::PAGE_BYTES * PageStore::PAGE_BYTES;
+
+    StateData head;
+    BinaryWriter writer(head);
+    writer.writeBytes(GROUP_MAGIC, sizeof(GROUP_MAGIC));
+    writer.write(GROUP_VERSION);
+    writer.write(static_cast<int32_t>(rootPid));
+    writer.write(static_cast<uint32_t>(members.size()));
+    writer.write(static_cast<uint32_t>(pages->pageCount()));
+    writer.write(static_cast<uint32_t>(indexSize));
+    writer.write(pageOffset);
+    for (size_t i = 0; i < members.size(); ++i) {
+        writer.write(static_cast<int32_t>(members[i].pid));
+        writer.write(static_cast<int32_t>(members[i].ppid));
+        writer.write(offset);
+        writer.write(static_cast<uint64_t>(records[i].size()));
+        writer.writeString(members[i].name);
+        offset += records[i].size();
+    }
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        setError(error, "Failed to open file for writing: " + filepath);
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(head.data()), head.size());
+    for (const auto& record : records) {
+        file.write(reinterpret_cast<const char*>(record.data()), record.size());
+    }
+    std::vector<char> padding(pageOffset - recordsEnd, 0);
+    file.write(padding.data(), padding.size());
+    for (uint32_t id = 0; id < pages->pageCount(); ++id) {
+        file.write(reinterpret_cast<const char*>(pages->page(id)), PageStore::PAGE_BYTES);
+    }
+
+    if (!file) {
+        setError(error, "Failed to write group image: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+namespace {
+
+struct GroupIndexEntry {
+    pid_t pid;
+    pid_t ppid;
+    uint64_t offset;
+    uint64_t size;
+    std::string name;
+};
+
+struct GroupHeader {
+    pid_t rootPid = 0;
+    uint32_t pageCount = 0;
+    uint64_t pageOffset = 0;
+    std::vector<GroupIndexEntry> index;
+};
+
+bool readGroupHeader(std::ifstream& file, const std::string& filepath, GroupHeader& header,
+                     std::string* error) {
+    std::vector<uint8_t> fixed(GROUP_HEADER_SIZE);
+    if (!file.read(reinterpret_cast<char*>(fixed.data()), fixed.size())) {
+        setError(error, "Invalid group image: " + filepath);
+        return false;
+    }
+    BinaryReader reader(fixed);
+    auto magic = reader.readBytes(sizeof(GROUP_MAGIC));
+    uint32_t version = reader.read<uint32_t>();
+    header.rootPid = reader.read<int32_t>();
+    uint32_t memberCount = reader.read<uint32_t>();
+    header.pageCount = reader.read<uint32_t>();
+    uint32_t indexSize = reader.read<uint32_t>();
+    header.pageOffset = reader.read<uint64_t>();
+    if (!reader.ok() || std::memcmp(magic.data(), GROUP_MAGIC, sizeof(GROUP_MAGIC)) != 0 ||
+        version != GROUP_VERSION) {
+        setError(error, "Invalid group image: " + filepath);
+        return false;
+    }
+
+    std::vector<uint8_t> indexBytes(indexSize);
+    if (!file.read(reinterpret_cast<char*>(indexBytes.data()), indexBytes.size())) {
+        setError(error, "Truncated group index: " + filepath);
+        return false;
+    }
+    BinaryReader index(indexBytes);
+    header.index.resize(memberCount);
+    for (auto& entry : header.index) {
+        entry.pid = index.read<int32_t>();
+        entry.ppid = index.read<int32_t>();
+        entry.offset = index.read<uint64_t>();
+        entry.size = index.read<uint64_t>();
+        entry.name = index.readString();
+    }
+    if (!index.ok()) {
+        setError(error, "Truncated group index: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+std::optional<RealProcessCheckpoint> readMemberRecord(std::ifstream& file, const GroupIndexEntry& entry,
+                                                      const std::string& filepath, std::string* error) {
+    std::vector<uint8_t> record(entry.size);
+    file.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!file.read(reinterpret_cast<char*>(record.data()), record.size())) {
+        setError(error, "Truncated member record " + std::to_string(entry.pid) + ": " + filepath);
+        return std::nullopt;
+    }
+    auto checkpoint = RealProcessCheckpoint::deserialize(record);
+    if (checkpoint.info.pid != entry.pid) {
+        setError(error, "Invalid member record " + std::to_string(entry.pid) + ": " + filepath);
+        return std::nullopt;
+    }
+    return checkpoint;
+}
+
+} // namespace
+
+std::optional<GroupCheckpoint> GroupCheckpoint::load(const std::string& filepath, std::string* error) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file) {
+        setError(error, "Failed to open file: " + filepath);
+        return std::nullopt;
+    }
+    GroupHeader header;
+    if (!readGroupHeader(file, filepath, header, error)) {
+        return std::nullopt;
+    }
+
+    GroupCheckpoint group;
+    group.rootPid = header.rootPid;
+    for (const auto& entry : header.index) {
+        auto checkpoint = readMemberRecord(file, entry, filepath, error);
+        if (!checkpoint) return std::nullopt;
+        group.members.push_back({entry.pid, entry.ppid, entry.name, std::move(*checkpoint)});
+    }
+
+    // Yazılan sayfalar zaten tekil: intern sırayla aynı id'leri verir
+    std::vector<uint8_t> page(PageStore::PAGE_BYTES);
+    file.seekg(static_cast<std::streamoff>(header.pageOffset));
+    for (uint32_t i = 0; i < header.pageCount; ++i) {
+        if (!file.read(reinterpret_cast<char*>(page.data()), page.size()) ||
+            group.pages->intern(page.data()) != i) {
+            setError(error, "Invalid page section: " + filepath);
+            return std::nullopt;
+        }
+    }
+    return group;
+}
+
+std::optional<RealProcessCheckpoint> GroupCheckpoint::loadMember(const std::string& filepath, pid_t pid,
+                                                                 std::string* error) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file) {
+        setError(error, "Failed to open file: " + filepath);
+        return std::nullopt;
+    }
+    GroupHeader header;
+    if (!readGroupHeader(file, filepath, header, error)) {
+        return std::nullopt;
+    }
+
+    auto entry = std::find_if(header.index.begin(), header.index.end(),
+                              [pid](const GroupIndexEntry& e) { return e.pid == pid; });
+    if (entry == header.index.end()) {
+        setError(error, "No member " + std::to_string(pid) + " in " + filepath);
+        return std::nullopt;
+    }
+    auto checkpoint = readMemberRecord(file, *entry, filepath, error);
+    if (!checkpoint) return std::nullopt;
+
+    for (auto& dump : checkpoint->memoryDumps) {
+        if (!dump.isDeduplicated()) continue;
+
+        std::vector<uint8_t> data(dump.pageRefs.size() * PageStore::PAGE_BYTES);
+        for (size_t p = 0; p < dump.pageRefs.size(); ++p) {
+            uint32_t id = dump.pageRefs[p];
+            file.seekg(static_cast<std::streamoff>(header.pageOffset + uint64_t(id) * PageStore::PAGE_BYTES));
+            if (id >= header.pageCount ||
+                !file.read(reinterpret_cast<char*>(data.data() + p * PageStore::PAGE_BYTES),
+                           PageStore::PAGE_BYTES)) {
+                setError(error, "Invalid page reference in member " + std::to_string(pid));
+                return std::nullopt;
+            }
+        }
+        dump.data = std::move(data);
+        dump.pageRefs.clear();
+    }
+    return checkpoint;
+}
+
+// ============================================================================
+// ProcessGroupCheckpointer
+// ============================================================================
+
+ProcessGroupCheckpointer::ProcessGroupCheckpointer(GroupCheckpointOptions options)
+    : m_options(std::move(options)), m_bufferPool(std::make_shared<DumpBufferPool>()) {}
+
+std::optional<GroupCheckpoint> ProcessGroupCheckpointer::checkpointTree(pid_t rootPid) {
+    TraceScope trace("group.checkpoint", *m_metrics);
+    auto start = Clock::now();
+    m_lastError.clear();
+
+    ProcFSReader reader;
+    auto rootInfo = reader.getProcessInfo(rootPid);
+    if (!rootInfo) {
+        m_lastError = "No such process: " + std::to_string(rootPid);
+        return std::nullopt;
+    }
+
+    // ========================================================================
+    // Dondur
+    // ========================================================================
+    trace.stage("freeze");
+    StoppedTree stopped;
+    bool ok = false;
+    if (m_options.freeze != GroupFreezeMode::Signal) {
+        auto cgroup = findFreezer(collectTree(rootPid, rootInfo->ppid));
+        if (cgroup) {
+            ok = stopViaCgroup(rootPid, rootInfo->ppid, *cgroup, m_options, stopped, m_lastError);
+        } else if (m_options.freeze == GroupFreezeMode::Cgroup) {
+            m_lastError = "Process tree of " + std::to_string(rootPid) + " has no dedicated freezer cgroup";
+            return std::nullopt;
+        }
+    }
+    if (!ok && stopped.resumable.empty() && m_options.freeze != GroupFreezeMode::Cgroup) {
+        m_lastError.clear();
+        ok = stopViaSignals(rootPid, rootInfo->ppid, m_options, stopped, m_lastError);
+    }
+    if (!ok) {
+        resumeAll(stopped.resumable);
+        return std::nullopt;
+    }
+
+    GroupCheckpoint group;
+    group.rootPid = rootPid;
+    group.freezeMode = stopped.mode;
+    group.freezeNanos = elapsedNanos(start);
+
+    // ========================================================================
+    // Üyeleri paralel dump et
+    // ========================================================================
+    trace.stage("dump");
+    const size_t count = stopped.members.size();
+    unsigned workers = m_options.workers == 0
+        ? std::max(1u, std::thread::hardware_concurrency()) : m_options.workers;
+    workers = static_cast<unsigned>(std::min<size_t>(workers, count));
+
+    CheckpointOptions memberOptions = m_options.checkpoint;
+    memberOptions.forkSnapshot = false;
+
+    std::vector<std::optional<RealProcessCheckpoint>> results(count);
+    SharedPages shared;
+    shared.store = group.pages.get();
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::atomic<uint64_t> dumped{0};
+    std::mutex errorMutex;
+
+    auto work = [&]() {
+        RealProcessCheckpointer checkpointer;
+        checkpointer.setBufferPool(m_bufferPool);
+        checkpointer.setMetricsRegistry(*m_metrics);
+        ProcFSReader frames;
+
+        for (size_t i = next++; i < count && !failed; i = next++) {
+            const auto& entry = stopped.members[i];
+            auto checkpoint = checkpointer.createCheckpoint(entry.pid, entry.name, memberOptions);
+            if (!checkpoint) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!failed.exchange(true)) {
+                    m_lastError = "Member " + std::to_string(entry.pid) + ": " + checkpointer.getLastError();
+                }
+                return;
+            }
+            dumped += checkpoint->dumpedMemorySize();
+            if (m_options.dedupePages) {
+                dedupeMember(entry.pid, *checkpoint, frames, shared, *m_bufferPool);
+            }
+            results[i] = std::move(checkpoint);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < workers; ++t) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    trace.stage("resume");
+    if (failed) {
+        resumeAll(stopped.resumable);
+        for (auto& result : results) {
+            if (result) m_bufferPool->recycle(*result);
+        }
+        return std::nullopt;
+    }
+    if (m_options.resume) {
+        resumeAll(stopped.resumable);
+    }
+    trace.endStage();
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto& entry = stopped.members[i];
+        group.members.push_back({entry.pid, entry.ppid, entry.name, std::move(*results[i])});
+    }
+    group.dumpedBytes = dumped;
+    group.frameHits = shared.frameHits;
+    group.contentHits = group.pages->dedupHits();
+    group.totalNanos = elapsedNanos(start);
+
+    trace.count("members", count);
+    trace.count("bytes_dumped", group.dumpedBytes);
+    trace.count("pages_stored", group.pages->pageCount());
+    trace.count("frame_hits", group.frameHits);
+    trace.count("content_hits", group.contentHits);
+    trace.succeed();
+    return group;
+}
+
+} // namespace real_process
+} // namespace checkpoint
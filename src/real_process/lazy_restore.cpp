@@ -0,0 +1,589 @@
+#include "real_process/lazy_restore.hpp"
+#include "real_process/memory_manager.hpp"
+#include "real_process/parasite.hpp"
+#include <linux/userfaultfd.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif
+#ifndef SYS_pidfd_getfd
+#define SYS_pidfd_getfd 438
+#endif
+
+namespace checkpoint {
+namespace real_process {
+
+namespace {
+
+constexpr uint64_t LAZY_FEATURES = UFFD_FEATURE_EVENT_REMAP |
+                                   UFFD_FEATURE_EVENT_REMOVE |
+                                   UFFD_FEATURE_EVENT_UNMAP;
+
+} // anonymous namespace
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+bool LazyRestoreSession::isSupported() {
+#if defined(__x86_64__)
+    int fd = static_cast<int>(syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK));
+    if (fd < 0) return false;
+    close(fd);
+
+    int pidfd = static_cast<int>(syscall(SYS_pidfd_open, getpid(), 0));
+    if (pidfd < 0) return false;
+    close(pidfd);
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::unique_ptr<LazyRestoreSession> LazyRestoreSession::setup(
+    pid_t pid,
+    std::vector<Range> ranges,
+    bool prefetch,
+    std::vector<Range>& failed,
+    std::string& error) {
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const Range& a, const Range& b) { return a.addr < b.addr; });
+
+    // Hizasız aralıklar kaydedilemez
+    std::vector<Range> candidates;
+    for (const auto& range : ranges) {
+        if (range.length == 0) continue;
+        if (range.addr % PAGE_BYTES != 0 || range.length % PAGE_BYTES != 0) {
+            failed.push_back(range);
+        } else {
+            candidates.push_back(range);
+        }
+    }
+    if (candidates.empty()) {
+        error = "No page-aligned ranges to restore lazily";
+        return nullptr;
+    }
+
+    auto failAll = [&](const std::string& reason) -> std::unique_ptr<LazyRestoreSession> {
+        failed.insert(failed.end(), candidates.begin(), candidates.end());
+        error = reason;
+        return nullptr;
+    };
+
+#if !defined(__x86_64__)
+    return failAll("Lazy restore is only supported on x86_64");
+#else
+    // Sıra önemli: önce kayıt, sonra boşaltma. Aradaki bir dokunuş (ör.
+    // çekirdeğin rseq yazması) sayfayı sıfırla kurar ve fault hiç gelmez.
+    MemoryManager injector;
+    if (injector.bindProcess(pid) != MemoryError::SUCCESS) {
+        return failAll(injector.getLastError());
+    }
+
+    int64_t remoteFd = injector.injectSyscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK);
+    if (remoteFd < 0) {
+        return failAll("userfaultfd failed in target: " +
+                       (remoteFd < -1 ? std::string(strerror(static_cast<int>(-remoteFd)))
+                                      : injector.getLastError()));
+    }
+
+    // fd'yi tracer'a al; target'taki kopya her durumda kapatılır (context
+    // tracer'daki referansla yaşar)
+    int uffd = -1;
+    int pidfd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+    if (pidfd >= 0) {
+        uffd = static_cast<int>(syscall(SYS_pidfd_getfd, pidfd, static_cast<int>(remoteFd), 0));
+        close(pidfd);
+    }
+    std::string getfdError = strerror(errno);
+    injector.injectSyscall(SYS_close, static_cast<uint64_t>(remoteFd));
+
+    if (uffd < 0) {
+        return failAll("pidfd_getfd failed: " + getfdError);
+    }
+
+    struct uffdio_api api{};
+    api.api = UFFD_API;
+    api.features = LAZY_FEATURES;
+    if (ioctl(uffd, UFFDIO_API, &api) == -1) {
+        close(uffd);
+        return failAll("UFFDIO_API failed: " + std::string(strerror(errno)));
+    }
+
+    std::vector<Area> areas;
+    std::vector<Range> registered;
+    for (const auto& range : candidates) {
+        struct uffdio_register reg{};
+        reg.range.start = range.addr;
+        reg.range.len = range.length;
+        reg.mode = UFFDIO_REGISTER_MODE_MISSING;
+        if (ioctl(uffd, UFFDIO_REGISTER, &reg) == -1) {
+            failed.push_back(range);
+            continue;
+        }
+
+        uint64_t pages = range.length / PAGE_BYTES;
+        areas.push_back({range.addr, range.data, pages, std::vector<uint8_t>(pages, 0), pages});
+        registered.push_back(range);
+    }
+
+    if (areas.empty()) {
+        close(uffd);
+        error = "No range could be registered with userfaultfd";
+        return nullptr;
+    }
+
+    // Boşaltma sırasında target'ın fault'ları servis edilmeli; thread
+    // arming bitene kadar prefetch yapmaz
+    std::unique_ptr<LazyRestoreSession> session(
+        new LazyRestoreSession(pid, uffd, std::move(areas), prefetch));
+    session->start();
+
+    SyscallBatch batch;
+    for (const auto& range : registered) {
+        batch.addMadvise(range.addr, range.length, MADV_DONTNEED);
+    }
+    SyscallBatchResult discarded;
+    injector.executeBatch(batch, discarded);
+    injector.unbindProcess();
+
+    // Boşaltılamayan (ör. mlock'lu) aralık kayıtlı kalır ama sayfaları
+    // canlı içerikte: çağıran hemen yazar
+    for (size_t i = 0; i < registered.size(); ++i) {
+        if (i >= discarded.results.size() || discarded.results[i] != 0) {
+            failed.push_back(registered[i]);
+        }
+    }
+
+    session->m_armRequested = true;
+    session->wake();
+    return session;
+#endif
+}
+
+LazyRestoreSession::LazyRestoreSession(pid_t pid, int uffd, std::vector<Area> areas, bool prefetch)
+    : m_pid(pid), m_uffd(uffd), m_prefetch(prefetch), m_areas(std::move(areas)) {
+    m_wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    for (const auto& area : m_areas) {
+        m_totalPages += area.pages;
+    }
+    m_remainingPages = m_totalPages;
+}
+
+LazyRestoreSession::~LazyRestoreSession() {
+    finish();
+    if (m_uffd >= 0) close(m_uffd);
+    if (m_wakeFd >= 0) close(m_wakeFd);
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void LazyRestoreSession::start() {
+    if (m_thread.joinable() || m_complete.load()) return;
+    m_thread = std::thread([this] { run(); });
+}
+
+bool LazyRestoreSession::wait(int timeoutMs) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (timeoutMs < 0) {
+        m_completeCv.wait(lock, [this] { return m_complete.load(); });
+        return true;
+    }
+    return m_completeCv.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                                 [this] { return m_complete.load(); });
+}
+
+void LazyRestoreSession::wake() {
+    uint64_t one = 1;
+    if (write(m_wakeFd, &one, sizeof(one)) < 0) {
+        // eventfd taşmaz; thread zaten uyanık
+    }
+}
+
+void LazyRestoreSession::finish() {
+    m_armRequested = true;
+    m_drain = true;
+    if (m_thread.joinable()) {
+        wake();
+        m_thread.join();
+    } else if (!m_complete.load()) {
+        run();
+    }
+}
+
+LazyRestoreSession::Stats LazyRestoreSession::getStats() const {
+    Stats stats;
+    stats.pagesTotal = m_totalPages;
+    stats.faultsServed = m_faultsServed.load();
+    stats.pagesFaulted = m_pagesFaulted.load();
+    stats.pagesPrefetched = m_pagesPrefetched.load();
+    stats.pagesDiscarded = m_pagesDiscarded.load();
+    return stats;
+}
+
+std::string LazyRestoreSession::getLastError() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lastError;
+}
+
+void LazyRestoreSession::setError(const std::string& error) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastError = error;
+}
+
+void LazyRestoreSession::complete() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_complete = true;
+    }
+    m_completeCv.notify_all();
+}
+
+// ============================================================================
+// Service Loop
+// ============================================================================
+
+void LazyRestoreSession::run() {
+    // Fault'lar her zaman önce: prefetch varken poll beklemez, her
+    // parçadan sonra kuyruk boşaltılır
+    while (!m_complete.load()) {
+        if (!m_armed && m_armRequested.load()) {
+            m_armed = true;
+        }
+        bool armed = m_armed;
+        if (armed && m_remainingPages == 0) {
+            complete();
+            break;
+        }
+        bool prefetching = armed && (m_prefetch || m_drain.load()) && m_remainingPages > 0;
+
+        struct pollfd fds[2] = {{m_uffd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        int timeout = prefetching ? 0 : (m_retryFaults.empty() ? -1 : 1);
+        int r = poll(fds, 2, timeout);
+        if (r < 0 && errno != EINTR) {
+            setError("poll failed: " + std::string(strerror(errno)));
+            break;
+        }
+
+        if (r > 0 && (fds[1].revents & POLLIN)) {
+            uint64_t value;
+            if (read(m_wakeFd, &value, sizeof(value)) < 0) {
+                // Başka bir okuyucu boşalttı
+            }
+        }
+        if (r > 0 && (fds[0].revents & (POLLERR | POLLHUP))) {
+            setError("userfaultfd closed");
+            break;
+        }
+        if (r > 0 && (fds[0].revents & POLLIN) && !handleEvents()) {
+            break;
+        }
+        
+        // Event okunduktan sonra mm değişimi biter; bekleyen fault'lar
+        if (!m_retryFaults.empty()) {
+            std::vector<uint64_t> retry;
+            retry.swap(m_retryFaults);
+            for (uint64_t addr : retry) {
+                if (!serveFault(addr)) m_retryFaults.push_back(addr);
+            }
+        }
+
+        if (prefetching && !prefetchNext()) {
+            break;
+        }
+    }
+
+    // Bitti ya da target gitti: kayıtlar fd ile birlikte kalkar
+    if (!m_complete.load()) {
+        complete();
+    }
+    if (m_uffd >= 0) {
+        close(m_uffd);
+        m_uffd = -1;
+    }
+}
+
+bool LazyRestoreSession::handleEvents() {
+    struct uffd_msg msgs[16];
+    ssize_t n = read(m_uffd, msgs, sizeof(msgs));
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EINTR) return true;
+        setError("userfaultfd read failed: " + std::string(strerror(errno)));
+        return false;
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(n) / sizeof(struct uffd_msg); ++i) {
+        const auto& msg = msgs[i];
+        switch (msg.event) {
+            case UFFD_EVENT_PAGEFAULT:
+                m_faultsServed++;
+                if (!serveFault(msg.arg.pagefault.address)) {
+                    m_retryFaults.push_back(msg.arg.pagefault.address);
+                }
+                break;
+            case UFFD_EVENT_REMOVE:
+                // Arming sırasında gelen, setup'ın kendi MADV_DONTNEED'i:
+                // o ana kadar kopyalanan sayfalar yeniden yüklenmeli
+                if (m_armed) {
+                    markRangeDone(msg.arg.remove.start, msg.arg.remove.end - msg.arg.remove.start);
+                } else {
+                    unmarkRange(msg.arg.remove.start, msg.arg.remove.end - msg.arg.remove.start);
+                }
+                break;
+            case UFFD_EVENT_UNMAP:
+                markRangeDone(msg.arg.remove.start, msg.arg.remove.end - msg.arg.remove.start);
+                break;
+            case UFFD_EVENT_REMAP:
+                remap(msg.arg.remap.from, msg.arg.remap.to, msg.arg.remap.len);
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+bool LazyRestoreSession::serveFault(uint64_t addr) {
+    addr &= ~(PAGE_BYTES - 1);
+
+    size_t index = 0;
+    Area* area = findArea(addr, &index);
+    if (area && !area->done[(addr - area->addr) / PAGE_BYTES]) {
+        uint64_t page = (addr - area->addr) / PAGE_BYTES;
+        bool again = false;
+        populate(index, page, std::min(FAULT_AROUND_PAGES, area->pages - page), false, &again);
+        return !again || m_areas[index].done[page];
+    }
+
+    // Bilinmeyen ya da target'ın kendisinin boşalttığı sayfa: anonim
+    // belleğin karşılığı sıfırdır
+    struct uffdio_zeropage zero{};
+    zero.range.start = addr;
+    zero.range.len = PAGE_BYTES;
+    if (ioctl(m_uffd, UFFDIO_ZEROPAGE, &zero) == -1) {
+        if (errno == EAGAIN) return false;
+        if (errno == EEXIST) {
+            struct uffdio_range wake{addr, PAGE_BYTES};
+            ioctl(m_uffd, UFFDIO_WAKE, &wake);
+        }
+    }
+    return true;
+}
+
+bool LazyRestoreSession::prefetchNext() {
+    const uint64_t chunkPages = PREFETCH_CHUNK_BYTES / PAGE_BYTES;
+
+    // İmleçten itibaren ilk eksik sayfa; remap sonrası geride kalan
+    // sayfalar için bir kez baştan taranır
+    for (int pass = 0; pass < 2; ++pass) {
+        for (; m_prefetchArea < m_areas.size(); ++m_prefetchArea, m_prefetchPage = 0) {
+            auto& area = m_areas[m_prefetchArea];
+            if (area.remaining == 0) continue;
+
+            auto first = std::find(area.done.begin() + m_prefetchPage, area.done.end(), 0);
+            if (first == area.done.end()) continue;
+
+            uint64_t page = static_cast<uint64_t>(first - area.done.begin());
+            uint64_t count = std::min(chunkPages, area.pages - page);
+            m_prefetchPage = page + count;
+            return populate(m_prefetchArea, page, count, true);
+        }
+        m_prefetchArea = 0;
+        m_prefetchPage = 0;
+    }
+    return true;
+}
+
+bool LazyRestoreSession::populate(size_t index, uint64_t page, uint64_t count, bool prefetch,
+                                  bool* again) {
+    uint64_t end = page + count;
+
+    while (page < end) {
+        auto& area = m_areas[index];
+        if (area.done[page]) {
+            ++page;
+            continue;
+        }
+        uint64_t run = 1;
+        while (page + run < end && !area.done[page + run]) ++run;
+
+        uint64_t dst = area.addr + page * PAGE_BYTES;
+        uint64_t len = run * PAGE_BYTES;
+        int64_t copied;
+        int rc;
+        if (area.data) {
+            struct uffdio_copy copy{};
+            copy.dst = dst;
+            copy.src = reinterpret_cast<uint64_t>(area.data + page * PAGE_BYTES);
+            copy.len = len;
+            rc = ioctl(m_uffd, UFFDIO_COPY, &copy);
+            copied = copy.copy;
+        } else {
+            struct uffdio_zeropage zero{};
+            zero.range.start = dst;
+            zero.range.len = len;
+            rc = ioctl(m_uffd, UFFDIO_ZEROPAGE, &zero);
+            copied = zero.zeropage;
+        }
+        int err = rc == -1 ? errno : 0;
+
+        // Kısmi kopya: kopyalanan kısım biter, kalanı bir sonraki turda
+        if (rc == 0) copied = static_cast<int64_t>(len);
+        if (copied > 0) {
+            uint64_t pages = static_cast<uint64_t>(copied) / PAGE_BYTES;
+            markDone(index, page, pages, false);
+            (prefetch ? m_pagesPrefetched : m_pagesFaulted) += pages;
+            page += pages;
+            continue;
+        }
+
+        switch (err) {
+            case EAGAIN:            // mm değişiyor: önce bekleyen event okunmalı
+                if (again) *again = true;
+                return true;
+            case EEXIST: {          // Sayfa zaten var (yarım kalan kopyada kuruldu)
+                markDone(index, page, 1, false);
+                (prefetch ? m_pagesPrefetched : m_pagesFaulted) += 1;
+                struct uffdio_range wake{dst, PAGE_BYTES};     // Bekleyen fault
+                ioctl(m_uffd, UFFDIO_WAKE, &wake);
+                ++page;
+                break;
+            }
+            case ENOENT:            // Bölge artık yok
+                markDone(index, page, run, true);
+                page += run;
+                break;
+            case ESRCH:             // Target çıktı
+                setError("Target exited during lazy restore");
+                return false;
+            default: {
+                // Sayfa bırakılır; bekleyen thread tekrar fault edip sıfır alır
+                setError("UFFDIO_COPY failed at 0x" + std::to_string(dst) + ": " + strerror(err));
+                markDone(index, page, 1, true);
+                struct uffdio_range wake{dst, PAGE_BYTES};
+                ioctl(m_uffd, UFFDIO_WAKE, &wake);
+                ++page;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Area Bookkeeping
+// ============================================================================
+
+void LazyRestoreSession::markDone(size_t index, uint64_t page, uint64_t count, bool discarded) {
+    auto& area = m_areas[index];
+    uint64_t marked = 0;
+    for (uint64_t p = page; p < page + count && p < area.pages; ++p) {
+        if (!area.done[p]) {
+            area.done[p] = 1;
+            ++marked;
+        }
+    }
+    area.remaining -= marked;
+    m_remainingPages -= marked;
+    if (discarded) m_pagesDiscarded += marked;
+}
+
+void LazyRestoreSession::markRangeDone(uint64_t addr, uint64_t length) {
+    uint64_t end = addr + length;
+    for (size_t i = 0; i < m_areas.size(); ++i) {
+        auto& area = m_areas[i];
+        uint64_t areaEnd = area.addr + area.pages * PAGE_BYTES;
+        if (area.addr >= end || areaEnd <= addr) continue;
+
+        uint64_t from = (std::max(addr, area.addr) - area.addr) / PAGE_BYTES;
+        uint64_t to = (std::min(end, areaEnd) - area.addr + PAGE_BYTES - 1) / PAGE_BYTES;
+        markDone(i, from, to - from, true);
+    }
+}
+
+void LazyRestoreSession::unmarkRange(uint64_t addr, uint64_t length) {
+    uint64_t end = addr + length;
+    for (auto& area : m_areas) {
+        uint64_t areaEnd = area.addr + area.pages * PAGE_BYTES;
+        if (area.addr >= end || areaEnd <= addr) continue;
+
+        uint64_t from = (std::max(addr, area.addr) - area.addr) / PAGE_BYTES;
+        uint64_t to = (std::min(end, areaEnd) - area.addr + PAGE_BYTES - 1) / PAGE_BYTES;
+        for (uint64_t p = from; p < to; ++p) {
+            if (!area.done[p]) continue;
+            area.done[p] = 0;
+            area.remaining++;
+            m_remainingPages++;
+        }
+    }
+}
+
+LazyRestoreSession::Area* LazyRestoreSession::findArea(uint64_t addr, size_t* index) {
+    auto it = std::upper_bound(m_areas.begin(), m_areas.end(), addr,
+                               [](uint64_t a, const Area& area) { return a < area.addr; });
+    if (it == m_areas.begin()) return nullptr;
+    --it;
+    if (addr >= it->addr + it->pages * PAGE_BYTES) return nullptr;
+    if (index) *index = static_cast<size_t>(it - m_areas.begin());
+    return &*it;
+}
+
+void LazyRestoreSession::remap(uint64_t from, uint64_t to, uint64_t length) {
+    // [from, from+length) içindeki sayfalar to'ya taşındı: kesişen alanları
+    // sınırlardan böl, içerdekileri kaydır
+    uint64_t end = from + length;
+    std::vector<Area> result;
+    result.reserve(m_areas.size() + 2);
+
+    auto slice = [](const Area& area, uint64_t first, uint64_t count, uint64_t addr) {
+        Area part;
+        part.addr = addr;
+        part.data = area.data ? area.data + first * PAGE_BYTES : nullptr;
+        part.pages = count;
+        part.done.assign(area.done.begin() + first, area.done.begin() + first + count);
+        part.remaining = static_cast<uint64_t>(std::count(part.done.begin(), part.done.end(), 0));
+        return part;
+    };
+
+    for (const auto& area : m_areas) {
+        uint64_t areaEnd = area.addr + area.pages * PAGE_BYTES;
+        if (area.addr >= end || areaEnd <= from) {
+            result.push_back(area);
+            continue;
+        }
+
+        uint64_t first = (std::max(from, area.addr) - area.addr) / PAGE_BYTES;
+        uint64_t last = (std::min(end, areaEnd) - area.addr) / PAGE_BYTES;
+        if (first > 0) {
+            result.push_back(slice(area, 0, first, area.addr));
+        }
+        result.push_back(slice(area, first, last - first,
+                               area.addr + first * PAGE_BYTES - from + to));
+        if (last < area.pages) {
+            result.push_back(slice(area, last, area.pages - last, area.addr + last * PAGE_BYTES));
+        }
+    }
+
+    std::sort(result.begin(), result.end(),
+              [](const Area& a, const Area& b) { return a.addr < b.addr; });
+    m_areas = std::move(result);
+    m_prefetchArea = 0;
+    m_prefetchPage = 0;
+}
+
+} // namespace real_process
+} // namespace checkpoint
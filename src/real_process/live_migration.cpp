@@ -0,0 +1,864 @@
+#include "real_process/live_migration.hpp"
+#include "real_process/checkpoint_stream.hpp"
+#include "real_process/proc_reader.hpp"
+#include "core/binary_io.hpp"
+#include "core/checksum.hpp"
+#include "core/metrics.hpp"
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace checkpoint {
+namespace real_process {
+
+namespace {
+
+using FrameType = LiveMigrationProtocol::FrameType;
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedNanos(Clock::time_point since) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - since).count());
+}
+
+// Socket'te SIGPIPE yerine EPIPE; pipe / dosya fd'lerinde düz write
+bool writeAll(int fd, const uint8_t* data, size_t size, std::string& error) {
+    bool useSend = true;
+    while (size > 0) {
+        ssize_t n = useSend ? ::send(fd, data, size, MSG_NOSIGNAL) : ::write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (useSend && errno == ENOTSOCK) {
+                useSend = false;
+                continue;
+            }
+            error = std::string("Send failed: ") + std::strerror(errno);
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// timeoutMs < 0: süresiz bekle
+bool readAll(int fd, uint8_t* data, size_t size, int timeoutMs, std::string& error) {
+    auto deadline = Clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+    while (size > 0) {
+        if (timeoutMs >= 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            pollfd pfd{fd, POLLIN, 0};
+            int ready = left > 0 ? ::poll(&pfd, 1, static_cast<int>(left)) : 0;
+            if (ready < 0 && errno == EINTR) continue;
+            if (ready <= 0) {
+                error = ready == 0 ? "Timed out waiting for peer"
+                                   : std::string("poll failed: ") + std::strerror(errno);
+                return false;
+            }
+        }
+        ssize_t n = ::read(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            error = std::string("Receive failed: ") + std::strerror(errno);
+            return false;
+        }
+        if (n == 0) {
+            error = "Connection closed by peer";
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+std::vector<uint8_t> makeFrame(FrameType type, uint32_t round, const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> frame;
+    frame.reserve(LiveMigrationProtocol::FRAME_HEADER_SIZE + payload.size());
+    BinaryWriter writer(frame);
+    writer.writeU8(static_cast<uint8_t>(type));
+    writer.write(round);
+    writer.write(static_cast<uint32_t>(payload.size()));
+    writer.writeBytes(payload.data(), payload.size());
+    return frame;
+}
+
+bool readFrame(int fd, FrameType& type, uint32_t& round, std::vector<uint8_t>& payload,
+               int timeoutMs, std::string& error) {
+    std::array<uint8_t, LiveMigrationProtocol::FRAME_HEADER_SIZE> header;
+    if (!readAll(fd, header.data(), header.size(), timeoutMs, error)) {
+        return false;
+    }
+    BinaryReader reader(header);
+    type = static_cast<FrameType>(reader.readU8());
+    round = reader.read<uint32_t>();
+    uint32_t size = reader.read<uint32_t>();
+    if (size > LiveMigrationProtocol::MAX_FRAME_SIZE) {
+        error = "Frame too large: " + std::to_string(size);
+        return false;
+    }
+    payload.resize(size);
+    return readAll(fd, payload.data(), size, timeoutMs, error);
+}
+
+std::vector<uint8_t> messagePayload(bool ok, const std::string& message) {
+    std::vector<uint8_t> payload;
+    BinaryWriter writer(payload);
+    writer.writeBool(ok);
+    writer.writeString(message);
+    return payload;
+}
+
+// Her ROUND_END'in onayı
+bool readAck(int fd, uint32_t round, int timeoutMs, std::string& error) {
+    FrameType type;
+    uint32_t ackRound;
+    std::vector<uint8_t> payload;
+    if (!readFrame(fd, type, ackRound, payload, timeoutMs, error)) {
+        error = "No acknowledgement for round " + std::to_string(round) + ": " + error;
+        return false;
+    }
+    BinaryReader reader(payload);
+    bool ok = reader.readBool();
+    std::string message = reader.readString();
+    if (type != FrameType::Ack || ackRound != round || !reader.ok()) {
+        error = "Unexpected reply to round " + std::to_string(round);
+        return false;
+    }
+    if (!ok) {
+        error = "Receiver rejected round " + std::to_string(round) + ": " + message;
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Frame Pipeline - parçaları paralel sıkıştırıp sırayla gönderir
+// ============================================================================
+// submit() çağıran thread'i (checkpointer) sadece uçuştaki parça sayısı
+// sınıra ulaşınca bekletir; sıkıştırma worker'larda, socket yazması ayrı
+// bir thread'de olur. Parçalar gönderim sırasına (seq) göre yazılır.
+class FramePipeline {
+public:
+    FramePipeline(int fd, std::shared_ptr<ICodec> codec, unsigned threads, size_t maxInFlight)
+        : m_fd(fd), m_codec(std::move(codec)), m_maxInFlight(maxInFlight) {
+        for (unsigned i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this]() { compressLoop(); });
+        }
+        m_writer = std::thread([this]() { writeLoop(); });
+    }
+
+    ~FramePipeline() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto& worker : m_workers) worker.join();
+        m_writer.join();
+    }
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    // Stream parçası: DATA frame'i olarak sıkıştırılır
+    bool submit(uint32_t round, std::vector<uint8_t> chunk) {
+        return enqueue({0, round, std::move(chunk), false});
+    }
+
+    // Hazır frame: sıradaki yerinde olduğu gibi gönderilir
+    bool sendControl(std::vector<uint8_t> frame) {
+        return enqueue({0, 0, std::move(frame), true});
+    }
+
+    // Gönderilenlerin hepsi yazılana (ya da hata olana) kadar bekle
+    bool drain() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&]() { return m_failed || m_written == m_submitted; });
+        return !m_failed;
+    }
+
+    uint64_t wireBytes() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_wireBytes;
+    }
+
+    std::string error() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_error;
+    }
+
+private:
+    struct Job {
+        uint64_t seq;
+        uint32_t round;
+        std::vector<uint8_t> data;
+        bool control;
+    };
+
+    int m_fd;
+    std::shared_ptr<ICodec> m_codec;
+    size_t m_maxInFlight;
+    std::vector<std::thread> m_workers;
+    std::thread m_writer;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Job> m_queue;
+    std::map<uint64_t, std::vector<uint8_t>> m_ready;      // seq -> frame
+    uint64_t m_submitted = 0;
+    uint64_t m_written = 0;
+    uint64_t m_wireBytes = 0;
+    bool m_stop = false;
+    bool m_failed = false;
+    std::string m_error;
+
+    bool enqueue(Job job) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&]() { return m_failed || m_submitted - m_written < m_maxInFlight; });
+        if (m_failed) return false;
+        job.seq = m_submitted++;
+        if (job.control) {
+            m_ready.emplace(job.seq, std::move(job.data));
+        } else {
+            m_queue.push_back(std::move(job));
+        }
+        m_cv.notify_all();
+        return true;
+    }
+
+    std::vector<uint8_t> compress(const Job& job) const {
+        std::vector<uint8_t> packed(m_codec->maxCompressedSize(job.data.size()));
+        size_t size = m_codec->compress(job.data.data(), job.data.size(), packed.data(), packed.size());
+
+        // Sıkışmayan parça ham gider
+        CodecType codec = m_codec->type();
+        const std::vector<uint8_t>* body = &packed;
+        if (size == 0 || size >= job.data.size()) {
+            codec = CodecType::None;
+            body = &job.data;
+            size = job.data.size();
+        }
+
+        std::vector<uint8_t> frame;
+        frame.reserve(LiveMigrationProtocol::FRAME_HEADER_SIZE + LiveMigrationProtocol::DATA_HEADER_SIZE + size);
+        BinaryWriter writer(frame);
+        writer.writeU8(static_cast<uint8_t>(FrameType::Data));
+        writer.write(job.round);
+        writer.write(static_cast<uint32_t>(LiveMigrationProtocol::DATA_HEADER_SIZE + size));
+        writer.writeU8(static_cast<uint8_t>(codec));
+        writer.write(static_cast<uint32_t>(job.data.size()));
+        writer.writeBytes(body->data(), size);
+        return frame;
+    }
+
+    void compressLoop() {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&]() { return m_stop || m_failed || !m_queue.empty(); });
+                if (m_queue.empty() || m_failed) return;
+                job = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            auto frame = compress(job);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ready.emplace(job.seq, std::move(frame));
+            m_cv.notify_all();
+        }
+    }
+
+    void writeLoop() {
+        while (true) {
+            std::vector<uint8_t> frame;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&]() {
+                    return m_failed || m_ready.count(m_written) ||
+                           (m_stop && m_written == m_submitted);
+                });
+                if (m_failed || !m_ready.count(m_written)) return;
+                auto it = m_ready.find(m_written);
+                frame = std::move(it->second);
+                m_ready.erase(it);
+            }
+
+            std::string error;
+            bool ok = writeAll(m_fd, frame.data(), frame.size(), error);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!ok) {
+                m_failed = true;
+                m_error = error;
+            } else {
+                m_written++;
+                m_wireBytes += frame.size();
+            }
+            m_cv.notify_all();
+        }
+    }
+};
+
+// ============================================================================
+// Migration Stream Sink - turun v3 stream byte'larını parçalara böler
+// ============================================================================
+// CheckpointStreamWriter ile aynı byte'ları üretir; dosya yerine
+// chunkSize'lık parçalar halinde pipeline'a verir.
+class MigrationStreamSink : public ICheckpointSink {
+public:
+    MigrationStreamSink(FramePipeline& pipeline, size_t chunkSize)
+        : m_pipeline(pipeline), m_chunkSize(chunkSize) {}
+
+    void beginRound(uint32_t round) {
+        m_round = round;
+        m_chunk.clear();
+        m_crc.reset();
+        m_dirtyBytes = 0;
+        m_lastError.clear();
+    }
+
+    bool writeHeader(const RealProcessCheckpoint& checkpoint) override {
+        auto header = checkpoint.serializeHeader(RealProcessCheckpoint::STREAMED_DUMP_COUNT);
+        return append(header.data(), header.size());
+    }
+
+    bool writeDump(const MemoryDump& dump) override {
+        if (!dump.hasContent()) {
+            return true;
+        }
+        std::vector<uint8_t> recordHeader;
+        RealProcessCheckpoint::serializeDumpHeader(dump, recordHeader);
+        if (!dump.zeroFill) {
+            m_dirtyBytes += dump.region.size();
+        }
+        return append(recordHeader.data(), recordHeader.size()) &&
+               append(dump.payload(), dump.payloadSize());
+    }
+
+    bool finish(const SignalInfo& signals) override {
+        MemoryDump end;
+        end.region.startAddr = 0;
+        end.region.endAddr = 0;
+        end.region.readable = end.region.writable = false;
+        end.region.executable = end.region.isPrivate = false;
+        std::vector<uint8_t> trailer;
+        RealProcessCheckpoint::serializeDumpHeader(end, trailer);
+        trailer.insert(trailer.end(), reinterpret_cast<const uint8_t*>(&signals),
+                       reinterpret_cast<const uint8_t*>(&signals) + sizeof(signals));
+        return append(trailer.data(), trailer.size()) && flush();
+    }
+
+    std::string getLastError() const override { return m_lastError; }
+
+    uint64_t rawBytes() const { return m_crc.bytes(); }
+    uint32_t checksum() const { return m_crc.value(); }
+    uint64_t dirtyBytes() const { return m_dirtyBytes; }
+
+private:
+    FramePipeline& m_pipeline;
+    size_t m_chunkSize;
+    uint32_t m_round = 0;
+    std::vector<uint8_t> m_chunk;
+    Crc32c m_crc;
+    uint64_t m_dirtyBytes = 0;
+    std::string m_lastError;
+
+    bool append(const uint8_t* data, size_t size) {
+        m_crc.update(data, size);
+        while (size > 0) {
+            size_t take = std::min(size, m_chunkSize - m_chunk.size());
+            m_chunk.insert(m_chunk.end(), data, data + take);
+            data += take;
+            size -= take;
+            if (m_chunk.size() == m_chunkSize && !flush()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool flush() {
+        if (m_chunk.empty()) {
+            return true;
+        }
+        std::vector<uint8_t> chunk;
+        chunk.reserve(m_chunkSize);
+        chunk.swap(m_chunk);
+        if (!m_pipeline.submit(m_round, std::move(chunk))) {
+            m_lastError = m_pipeline.error();
+            return false;
+        }
+        return true;
+    }
+};
+
+// SIGSTOP sonrası tüm thread'ler durana kadar bekle
+bool waitStopped(ProcFSReader& reader, pid_t pid, int timeoutMs) {
+    auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (Clock::now() < deadline) {
+        auto info = reader.getProcessInfo(pid);
+        if (!info) return false;
+        if (info->state == LinuxProcessState::STOPPED) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} // namespace
+
+uint64_t MigrationResult::totalWireBytes() const {
+    uint64_t total = 0;
+    for (const auto& round : rounds) {
+        total += round.wireBytes;
+    }
+    return total;
+}
+
+// ============================================================================
+// MigrationSender
+// ============================================================================
+
+MigrationSender::MigrationSender(MigrationOptions options)
+    : m_options(std::move(options)) {
+}
+
+MigrationSender::~MigrationSender() = default;
+
+MigrationResult MigrationSender::migrate(pid_t pid, const std::string& host, uint16_t port) {
+    MigrationResult result;
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses);
+    if (rc != 0) {
+        result.errorMessage = "Cannot resolve " + host + ": " + gai_strerror(rc);
+        return result;
+    }
+
+    int fd = -1;
+    for (addrinfo* ai = addresses; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+        if (fd >= 0 && connect(fd, ai->ai_addr, ai->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+    if (fd < 0) {
+        result.errorMessage = "Cannot connect to " + host + ":" + std::to_string(port) +
+                              " (" + std::strerror(errno) + ")";
+        return result;
+    }
+
+    // Küçük kontrol frame'leri (ROUND_END) bekletilmesin
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    result = migrate(pid, fd);
+    close(fd);
+    return result;
+}
+
+MigrationResult MigrationSender::migrate(pid_t pid, int fd) {
+    MigrationResult result;
+    auto start = Clock::now();
+    TraceScope trace("migration.send", m_checkpointer.getMetricsRegistry());
+
+    auto codec = createCodec(m_options.codec);
+    if (!codec) {
+        result.errorMessage = "Unsupported codec";
+        return result;
+    }
+    unsigned threads = m_options.compressThreads == 0
+        ? std::max(1u, std::thread::hardware_concurrency()) : m_options.compressThreads;
+    FramePipeline pipeline(fd, codec, threads, 2 * threads + 2);
+    // Receiver DATA parçalarını HELLO'daki boyutla sınırlar
+    auto chunkSize = static_cast<uint32_t>(std::clamp<size_t>(
+        m_options.chunkSize, LiveMigrationProtocol::MIN_CHUNK_SIZE, LiveMigrationProtocol::MAX_CHUNK_SIZE));
+    MigrationStreamSink sink(pipeline, chunkSize);
+
+    ProcFSReader reader;
+    auto info = reader.getProcessInfo(pid);
+    if (!info) {
+        result.errorMessage = "Process " + std::to_string(pid) + " does not exist";
+        return result;
+    }
+
+    std::vector<uint8_t> hello;
+    BinaryWriter helloWriter(hello);
+    helloWriter.write(LiveMigrationProtocol::VERSION);
+    helloWriter.write(static_cast<int32_t>(pid));
+    helloWriter.writeString(info->name);
+    helloWriter.write(chunkSize);
+    pipeline.sendControl(makeFrame(FrameType::Hello, 0, hello));
+
+    // Pre-copy turları kaynağı sadece fork kadar durdurur; son tur zaten
+    // durmuş process'ten okur
+    CheckpointOptions precopy = m_options.checkpoint;
+    precopy.forkSnapshot = true;
+    precopy.trackDirtyPages = true;
+    precopy.saveFileDescriptors = false;
+    precopy.saveEnvironment = false;
+    precopy.hashPages = false;
+    CheckpointOptions stopCopy = m_options.checkpoint;
+    stopCopy.forkSnapshot = false;
+    stopCopy.trackDirtyPages = true;
+    stopCopy.hashPages = false;
+
+    std::optional<RealProcessCheckpoint> previous;
+    auto runRound = [&](bool final, const CheckpointOptions& options) {
+        MigrationRound round;
+        round.round = static_cast<uint32_t>(result.rounds.size());
+        round.final = final;
+        auto roundStart = Clock::now();
+        uint64_t wireBefore = pipeline.wireBytes();
+
+        sink.beginRound(round.round);
+        auto checkpoint = m_checkpointer.createCheckpointToSink(
+            pid, sink, "migration_" + std::to_string(pid) + "_" + std::to_string(round.round),
+            options, previous ? &*previous : nullptr);
+        if (!checkpoint) {
+            result.errorMessage = "Round " + std::to_string(round.round) + " failed: " +
+                                  m_checkpointer.getLastError();
+            return false;
+        }
+
+        std::vector<uint8_t> end;
+        BinaryWriter writer(end);
+        writer.writeBool(final);
+        writer.write(sink.rawBytes());
+        writer.write(sink.checksum());
+        if (!pipeline.sendControl(makeFrame(FrameType::RoundEnd, round.round, end)) ||
+            !pipeline.drain()) {
+            result.errorMessage = pipeline.error();
+            return false;
+        }
+        if (!readAck(fd, round.round, m_options.ackTimeoutMs, result.errorMessage)) {
+            return false;
+        }
+
+        round.dirtyBytes = sink.dirtyBytes();
+        round.rawBytes = sink.rawBytes();
+        round.wireBytes = pipeline.wireBytes() - wireBefore;
+        round.nanos = elapsedNanos(roundStart);
+        result.rounds.push_back(round);
+        previous = std::move(*checkpoint);
+        return true;
+    };
+
+    // Başarısızlıkta receiver bilgilendirilir (bağlantı hâlâ açıksa)
+    auto abort = [&]() {
+        pipeline.sendControl(makeFrame(FrameType::Abort, 0, messagePayload(false, result.errorMessage)));
+        pipeline.drain();
+    };
+
+    trace.stage("precopy");
+    bool ok = runRound(false, precopy);
+    while (ok) {
+        uint64_t dirty = result.rounds.back().dirtyBytes;
+        if (dirty <= m_options.stopCopyBytes) {
+            result.converged = true;
+            break;
+        }
+        if (result.rounds.size() >= m_options.maxRounds) {
+            break;
+        }
+        if (result.rounds.size() >= 2 &&
+            dirty > m_options.minShrinkRatio * result.rounds[result.rounds.size() - 2].dirtyBytes) {
+            break;
+        }
+        ok = runRound(false, precopy);
+    }
+    if (!ok) {
+        abort();
+        trace.count("rounds", result.rounds.size());
+        result.totalNanos = elapsedNanos(start);
+        return result;
+    }
+
+    // Stop-and-copy: bu noktadan onaya kadar kaynak durur
+    trace.stage("stop");
+    auto stopStart = Clock::now();
+    if (kill(pid, SIGSTOP) != 0 || !waitStopped(reader, pid, m_options.stopTimeoutMs)) {
+        result.errorMessage = "Source process " + std::to_string(pid) + " did not stop";
+        kill(pid, SIGCONT);
+        abort();
+        result.totalNanos = elapsedNanos(start);
+        return result;
+    }
+
+    trace.stage("stop_copy");
+    ok = runRound(true, stopCopy);
+    result.downtimeNanos = elapsedNanos(stopStart);
+    trace.endStage();
+
+    if (!ok) {
+        kill(pid, SIGCONT);     // Kaynak çalışmaya devam eder; migration yok sayılır
+        abort();
+    } else if (m_options.killSourceOnSuccess) {
+        kill(pid, SIGKILL);
+    }
+
+    for (const auto& round : result.rounds) {
+        trace.count("dirty_bytes", round.dirtyBytes);
+        trace.count("raw_bytes", round.rawBytes);
+        trace.count("wire_bytes", round.wireBytes);
+    }
+    trace.count("rounds", result.rounds.size());
+    trace.count("downtime_ns", result.downtimeNanos);
+
+    result.success = ok;
+    result.totalNanos = elapsedNanos(start);
+    if (ok) {
+        trace.succeed();
+    }
+    return result;
+}
+
+// ============================================================================
+// MigrationReceiver
+// ============================================================================
+
+MigrationReceiver::MigrationReceiver() = default;
+
+MigrationReceiver::~MigrationReceiver() {
+    if (m_listenFd >= 0) {
+        close(m_listenFd);
+    }
+}
+
+bool MigrationReceiver::listen(uint16_t port, const std::string& bindAddress) {
+    if (m_listenFd >= 0) {
+        close(m_listenFd);
+        m_listenFd = -1;
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, bindAddress.c_str(), &addr.sin_addr) != 1) {
+        m_lastError = "Invalid bind address: " + bindAddress;
+        return false;
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    int one = 1;
+    if (fd < 0 || setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0 ||
+        bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(fd, 1) != 0) {
+        m_lastError = std::string("Cannot listen on port ") + std::to_string(port) +
+                      " (" + std::strerror(errno) + ")";
+        if (fd >= 0) close(fd);
+        return false;
+    }
+
+    socklen_t len = sizeof(addr);
+    getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+    m_port = ntohs(addr.sin_port);
+    m_listenFd = fd;
+    return true;
+}
+
+bool MigrationReceiver::accept(pid_t targetPid, const RestoreOptions& options) {
+    if (m_listenFd < 0) {
+        m_lastError = "Receiver is not listening";
+        return false;
+    }
+    int fd;
+    do {
+        fd = ::accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        m_lastError = std::string("accept failed: ") + std::strerror(errno);
+        return false;
+    }
+
+    bool ok = receive(fd, targetPid, options);
+    close(fd);
+    return ok;
+}
+
+bool MigrationReceiver::applyRound(std::vector<uint8_t>& stream) {
+    auto round = RealProcessCheckpoint::deserialize(stream);
+    stream.clear();
+    if (round.checkpointId == 0) {
+        m_lastError = "Corrupt checkpoint stream in round " + std::to_string(m_rounds);
+        return false;
+    }
+
+    if (m_rounds == 0) {
+        if (round.isIncremental) {
+            m_lastError = "First round is not a full checkpoint";
+            return false;
+        }
+        m_merged = std::move(round);
+    } else {
+        std::vector<RealProcessCheckpoint> chain;
+        chain.reserve(2);
+        chain.push_back(std::move(m_merged));
+        chain.push_back(std::move(round));
+        auto merged = m_checkpointer.mergeCheckpointChain(chain);
+        if (!merged) {
+            m_lastError = "Round " + std::to_string(m_rounds) + ": " + m_checkpointer.getLastError();
+            return false;
+        }
+        m_merged = std::move(*merged);
+    }
+    m_rounds++;
+    return true;
+}
+
+bool MigrationReceiver::receive(int fd, pid_t targetPid, const RestoreOptions& options) {
+    TraceScope trace("migration.receive", m_checkpointer.getMetricsRegistry());
+    m_merged = RealProcessCheckpoint();
+    m_restoreResult = RestoreResult();
+    m_rounds = 0;
+    m_lastError.clear();
+
+    auto reply = [&](uint32_t round, bool ok, const std::string& message) {
+        auto frame = makeFrame(FrameType::Ack, round, messagePayload(ok, message));
+        std::string error;
+        return writeAll(fd, frame.data(), frame.size(), error);
+    };
+
+    FrameType type;
+    uint32_t round;
+    std::vector<uint8_t> payload;
+    trace.stage("handshake");
+    if (!readFrame(fd, type, round, payload, m_readTimeoutMs, m_lastError)) {
+        return false;
+    }
+    BinaryReader hello(payload);
+    uint32_t version = hello.read<uint32_t>();
+    if (type != FrameType::Hello || !hello.ok() || version != LiveMigrationProtocol::VERSION) {
+        m_lastError = "Unsupported migration handshake (version " + std::to_string(version) + ")";
+        return false;
+    }
+    hello.read<int32_t>();
+    hello.readString();
+    uint32_t chunkSize = hello.read<uint32_t>();
+    if (!hello.ok() || chunkSize < LiveMigrationProtocol::MIN_CHUNK_SIZE ||
+        chunkSize > LiveMigrationProtocol::MAX_CHUNK_SIZE) {
+        m_lastError = "Invalid chunk size in migration handshake: " + std::to_string(chunkSize);
+        return false;
+    }
+
+    trace.stage("receive");
+    std::array<std::shared_ptr<ICodec>, 3> codecs;
+    std::vector<uint8_t> stream;
+    uint64_t wireBytes = 0;
+    while (true) {
+        if (!readFrame(fd, type, round, payload, m_readTimeoutMs, m_lastError)) {
+            return false;
+        }
+        wireBytes += LiveMigrationProtocol::FRAME_HEADER_SIZE + payload.size();
+        if (type != FrameType::Abort && round != m_rounds) {
+            m_lastError = "Out of order frame for round " + std::to_string(round);
+            return false;
+        }
+
+        BinaryReader reader(payload);
+        if (type == FrameType::Data) {
+            auto codecType = static_cast<CodecType>(reader.readU8());
+            uint32_t rawSize = reader.read<uint32_t>();
+            auto body = reader.readBytes(
+                payload.size() - std::min<size_t>(payload.size(), LiveMigrationProtocol::DATA_HEADER_SIZE));
+            size_t index = static_cast<size_t>(codecType);
+            if (!reader.ok() || index >= codecs.size() || rawSize == 0 || rawSize > chunkSize) {
+                m_lastError = "Malformed data frame in round " + std::to_string(round);
+                reply(round, false, m_lastError);
+                return false;
+            }
+            // Açılmış boyut eşten gelir: büyütmeden önce tur sınırına bak
+            if (stream.size() + rawSize > m_maxRoundBytes) {
+                m_lastError = "Round " + std::to_string(round) + " exceeds " +
+                              std::to_string(m_maxRoundBytes) + " bytes";
+                reply(round, false, m_lastError);
+                return false;
+            }
+            if (!codecs[index]) {
+                codecs[index] = createCodec(codecType);
+            }
+            size_t offset = stream.size();
+            stream.resize(offset + rawSize);
+            if (!codecs[index]->decompress(body.data(), body.size(), stream.data() + offset, rawSize)) {
+                m_lastError = "Corrupt data frame in round " + std::to_string(round);
+                reply(round, false, m_lastError);
+                return false;
+            }
+        } else if (type == FrameType::RoundEnd) {
+            bool final = reader.readBool();
+            uint64_t rawBytes = reader.read<uint64_t>();
+            uint32_t checksum = reader.read<uint32_t>();
+            if (!reader.ok() || rawBytes != stream.size() ||
+                crc32c(stream.data(), stream.size()) != checksum) {
+                m_lastError = "Checksum mismatch in round " + std::to_string(round);
+                reply(round, false, m_lastError);
+                return false;
+            }
+            trace.count("raw_bytes", rawBytes);
+            if (!applyRound(stream)) {
+                reply(round, false, m_lastError);
+                return false;
+            }
+
+            if (!final) {
+                if (!reply(round, true, "")) {
+                    m_lastError = "Failed to acknowledge round " + std::to_string(round);
+                    return false;
+                }
+                continue;
+            }
+
+            // Son tur: onay restore sonucudur (sender kaynağı buna göre bırakır)
+            bool ok = true;
+            if (targetPid > 0) {
+                trace.stage("restore");
+                m_restoreResult = m_checkpointer.restoreCheckpointEx(targetPid, m_merged, options);
+                ok = m_restoreResult.success;
+                if (!ok) {
+                    m_lastError = "Restore into " + std::to_string(targetPid) + " failed: " +
+                                  m_restoreResult.errorMessage;
+                }
+            }
+            trace.endStage();
+            trace.count("rounds", m_rounds);
+            trace.count("wire_bytes", wireBytes);
+            if (!reply(round, ok, ok ? "" : m_lastError) && ok) {
+                m_lastError = "Failed to acknowledge final round";
+            }
+            if (ok) {
+                trace.succeed();
+            }
+            return ok;
+        } else if (type == FrameType::Abort) {
+            reader.readBool();
+            m_lastError = "Sender aborted migration: " + reader.readString();
+            return false;
+        } else {
+            m_lastError = "Unexpected frame type " + std::to_string(static_cast<int>(type));
+            return false;
+        }
+    }
+}
+
+} // namespace real_process
+} // namespace checkpoint
@@ -15,6 +15,10 @@
 #include <set>
 #include <map>
 
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23      // Linux 5.14
+#endif
+
 namespace checkpoint {
 namespace real_process {
 
@@ -107,7 +111,10 @@ bool ASLRConfig::enable() {
 // ============================================================================
 
 MemoryManager::MemoryManager()
-    : m_pid(0) {
+    : m_pid(0), m_useParasite(true) {
+    // Ardışık getCurrentMemoryMap/findRegion çağrıları aynı görüntüyü
+    // paylaşsın; kendi syscall'larımız cache'i ayrıca düşürür
+    m_procReader.setMapsCacheTtl(std::chrono::milliseconds(100));
 }
 
 MemoryManager::~MemoryManager() {
@@ -137,10 +144,13 @@ MemoryError MemoryManager::bindProcess(pid_t pid) {
     }
     
     m_pid = pid;
+    m_procReader.invalidateMemoryMaps();
     return MemoryError::SUCCESS;
 }
 
 void MemoryManager::unbindProcess() {
+    releaseParasite();
+    m_procReader.invalidateMemoryMaps();
     m_pid = 0;
 }
 
@@ -153,14 +163,16 @@ std::vector<MemoryRegion> MemoryManager::getCurrentMemoryMap() {
         return {};
     }
     
-    ProcFSReader reader;
-    return reader.getMemoryMaps(m_pid);
+    return m_procReader.getMemoryMaps(m_pid);
 }
 
 bool MemoryManager::regionExists(uint64_t addr, size_t size) {
-    auto maps = getCurrentMemoryMap();
+    if (m_pid <= 0) {
+        return false;
+    }
+    auto maps = m_procReader.getMemoryMapsSnapshot(m_pid);
     
-    for (const auto& region : maps) {
+    for (const auto& region : *maps) {
         // Check if the requested range is fully contained in this region
         if (addr >= region.startAddr && (addr + size) <= region.endAddr) {
             return true;
@@ -171,9 +183,12 @@ bool MemoryManager::regionExists(uint64_t addr, size_t size) {
 }
 
 std::optional<MemoryRegion> MemoryManager::findRegion(uint64_t addr) {
-    auto maps = getCurrentMemoryMap();
+    if (m_pid <= 0) {
+        return std::nullopt;
+    }
+    auto maps = m_procReader.getMemoryMapsSnapshot(m_pid);
     
-    for (const auto& region : maps) {
+    for (const auto& region : *maps) {
         if (addr >= region.startAddr && addr < region.endAddr) {
             return region;
         }
@@ -417,6 +432,7 @@ int64_t MemoryManager::injectSyscall(
         m_lastError = "No process bound";
         return -1;
     }
+    m_procReader.invalidateMemoryMaps(m_pid);      // Syscall map'i değiştirebilir
     
     // Save current registers
     LinuxRegisters savedRegs;
@@ -501,6 +517,87 @@ int64_t MemoryManager::injectSyscall(
     return result;
 }
 
+// ============================================================================
+// Batched Syscalls
+// ============================================================================
+
+bool MemoryManager::executeBatch(const SyscallBatch& batch, SyscallBatchResult& result) {
+    result.results.assign(batch.size(), SyscallBatchResult::NOT_RUN);
+    result.executed = 0;
+    result.roundTrips = 0;
+    
+    if (m_pid <= 0) {
+        m_lastError = "No process bound";
+        return false;
+    }
+    if (batch.empty()) {
+        return true;
+    }
+    m_procReader.invalidateMemoryMaps(m_pid);
+    
+    if (m_useParasite && ParasiteStub::isSupported()) {
+        if (!m_parasite) {
+            m_parasite = std::make_unique<ParasiteStub>(m_pid);
+        }
+        
+        // Parasite sayfasını değiştirecek bir komut varsa tek tek çalıştır
+        bool touchesParasite = false;
+        if (m_parasite->isInstalled()) {
+            for (const auto& cmd : batch.commands()) {
+                bool addressed = cmd.nr == SYS_mmap || cmd.nr == SYS_munmap ||
+                                 cmd.nr == SYS_mprotect || cmd.nr == SYS_madvise ||
+                                 cmd.nr == SYS_mremap;
+                if (addressed && cmd.args[0] != 0 && !(cmd.resultRefs & 3) &&
+                    m_parasite->overlaps(cmd.args[0], cmd.args[1])) {
+                    touchesParasite = true;
+                    break;
+                }
+            }
+        }
+        
+        if (!touchesParasite) {
+            if (m_parasite->execute(batch, result)) {
+                return true;
+            }
+            m_lastError = m_parasite->getLastError();
+            if (result.roundTrips > 0) {
+                return false;       // Yarıda kaldı: tekrar çalıştırmak güvenli değil
+            }
+        }
+    }
+    
+    if (batch.hasData()) {
+        m_lastError = "Batch needs the parasite stub for data arguments";
+        return false;
+    }
+    
+    const auto& commands = batch.commands();
+    for (size_t i = 0; i < commands.size(); ++i) {
+        auto args = commands[i].args;
+        for (int a = 0; a < SyscallBatch::MAX_ARGS; ++a) {
+            if (commands[i].resultRefs & (1u << a)) {
+                args[a] = static_cast<uint64_t>(result.results[args[a]]);
+            }
+        }
+        int64_t value = injectSyscall(commands[i].nr, args[0], args[1], args[2],
+                                      args[3], args[4], args[5]);
+        result.results[i] = value;
+        result.executed++;
+        result.roundTrips++;
+        if (batch.getStopOnError() && !result.succeeded(i)) {
+            break;
+        }
+    }
+    return true;
+}
+
+void MemoryManager::releaseParasite() {
+    if (m_parasite) {
+        m_parasite->uninstall();
+        m_parasite.reset();
+    }
+}
+
 // ============================================================================
 // Memory Mapping Operations
 // ============================================================================
@@ -635,11 +732,13 @@ MemoryManager::PrepareResult MemoryManager::prepareForRestore(
     
     reportProgress("Preparing memory regions", 0.3);
     
+    // Tüm mmap/munmap'ler tek batch: parasite ile tek tur
+    SyscallBatch batch;
+    std::vector<std::pair<MemoryRegion, size_t>> allocations;   // region -> komut
+    std::vector<std::pair<MemoryRegion, size_t>> removals;
+    
     // Allocate missing regions
     if (allocateMissing && !comparison.missing.empty()) {
-        int total = comparison.missing.size();
-        int done = 0;
-        
         for (const auto& region : comparison.missing) {
             // Skip non-essential regions
             if (region.isVdso()) {
@@ -658,27 +757,10 @@ MemoryManager::PrepareResult MemoryManager::prepareForRestore(
                 continue;
             }
             
-            // Try to allocate
-            MemoryError err = createMapping(
-                targetAddr,
-                region.size(),
-                region.readable,
-                region.writable,
-                region.executable,
-                true  // MAP_FIXED
-            );
-            
-            if (err == MemoryError::SUCCESS) {
-                result.createdRegions.push_back(region);
-            } else {
-                result.warnings.push_back(
-                    "Failed to allocate region at " + std::to_string(targetAddr) +
-                    ": " + m_lastError);
-                result.failedRegions.push_back(region);
-            }
-            
-            done++;
-            reportProgress("Allocating memory", 0.3 + 0.4 * (double(done) / total));
+            int prot = toProtFlags(region.readable, region.writable, region.executable);
+            size_t cmd = batch.addMmap(targetAddr, region.size(), prot,
+                                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED);
+            allocations.emplace_back(region, cmd);
         }
     }
     
@@ -691,14 +773,53 @@ MemoryManager::PrepareResult MemoryManager::prepareForRestore(
                                           region.pathname);
                 continue;
             }
-            
-            MemoryError err = removeMapping(region.startAddr, region.size());
-            if (err != MemoryError::SUCCESS) {
-                result.warnings.push_back("Failed to remove extra region at " +
-                                          std::to_string(region.startAddr));
+            if (m_parasite && m_parasite->overlaps(region.startAddr, region.size())) {
+                continue;       // Kendi parasite sayfamız
             }
+            
+            size_t cmd = batch.addMunmap(region.startAddr, region.size());
+            removals.emplace_back(region, cmd);
+        }
+    }
+    
+    SyscallBatchResult batchResult;
+    if (!batch.empty() && !executeBatch(batch, batchResult)) {
+        result.warnings.push_back("Batched syscalls failed: " + m_lastError);
+    }
+    reportProgress("Allocating memory", 0.7);
+    
+    for (const auto& allocation : allocations) {
+        const auto& region = allocation.first;
+        int64_t value = batchResult.results[allocation.second];
+        if (batchResult.succeeded(allocation.second) &&
+            static_cast<uint64_t>(value) == region.startAddr) {
+            result.createdRegions.push_back(region);
+        } else {
+            result.warnings.push_back(
+                "Failed to allocate region at " + std::to_string(region.startAddr) +
+                ": mmap failed with error: " + std::to_string(-value));
+            result.failedRegions.push_back(region);
+        }
+    }
+    
+    for (const auto& removal : removals) {
+        if (batchResult.results[removal.second] != 0) {
+            result.warnings.push_back("Failed to remove extra region at " +
+                                      std::to_string(removal.first.startAddr));
+        }
+    }
+    
+    // THP ile eşlenmiş bölgeler yazılmadan önce huge page'lerle hazırlanır
+    std::vector<std::pair<uint64_t, uint64_t>> hugeRanges;
+    for (const auto& region : checkpointMap) {
+        if (region.hugePages && region.writable && !result.needsRelocation) {
+            hugeRanges.emplace_back(region.startAddr, region.size());
         }
     }
+    if (!hugeRanges.empty()) {
+        reportProgress("Pre-faulting huge pages", 0.9);
+        result.bytesPrefaulted = prepareHugePages(hugeRanges);
+    }
     
     reportProgress("Preparation complete", 1.0);
     
@@ -710,5 +831,28 @@ MemoryManager::PrepareResult MemoryManager::prepareForRestore(
     return result;
 }
 
+uint64_t MemoryManager::prepareHugePages(const std::vector<std::pair<uint64_t, uint64_t>>& ranges) {
+    if (m_pid <= 0 || ranges.empty()) return 0;
+    
+    SyscallBatch batch;
+    std::vector<std::pair<size_t, uint64_t>> populates;     // komut -> byte
+    for (const auto& [addr, length] : ranges) {
+        if (length == 0) continue;
+        batch.addMadvise(addr, length, MADV_HUGEPAGE);
+        populates.emplace_back(batch.addMadvise(addr, length, MADV_POPULATE_WRITE), length);
+    }
+    
+    SyscallBatchResult batchResult;
+    if (batch.empty() || !executeBatch(batch, batchResult)) {
+        return 0;
+    }
+    
+    uint64_t populated = 0;
+    for (const auto& [cmd, length] : populates) {
+        if (batchResult.succeeded(cmd)) populated += length;
+    }
+    return populated;
+}
+
 } // namespace real_process
 } // namespace checkpoint
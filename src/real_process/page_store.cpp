@@ -0,0 +1,256 @@
+#include "real_process/page_store.hpp"
+#include "core/checksum.hpp"
+#include <cstring>
+#include <fstream>
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// Zero Page Elimination
+// ============================================================================
+
+bool isZeroPage(const uint8_t* data, size_t size) {
+    size_t i = 0;
+
+#if defined(__x86_64__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 64 <= size; i += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 48));
+        __m128i acc = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, zero)) != 0xFFFF) {
+            return false;
+        }
+    }
+#elif defined(__aarch64__)
+    for (; i + 64 <= size; i += 64) {
+        uint8x16_t a = vld1q_u8(data + i);
+        uint8x16_t b = vld1q_u8(data + i + 16);
+        uint8x16_t c = vld1q_u8(data + i + 32);
+        uint8x16_t d = vld1q_u8(data + i + 48);
+        uint8x16_t acc = vorrq_u8(vorrq_u8(a, b), vorrq_u8(c, d));
+        if (vmaxvq_u8(acc) != 0) {
+            return false;
+        }
+    }
+#endif
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word != 0) return false;
+    }
+    for (; i < size; ++i) {
+        if (data[i] != 0) return false;
+    }
+    return true;
+}
+
+uint64_t eliminateZeroPages(std::vector<MemoryDump>& dumps, size_t pageSize) {
+    uint64_t eliminated = 0;
+    std::vector<MemoryDump> out;
+    out.reserve(dumps.size());
+
+    for (auto& dump : dumps) {
+        size_t size = dump.data.size();
+        if (!dump.isValid || dump.zeroFill || dump.isDeduplicated() ||
+            size == 0 || size % pageSize != 0) {
+            out.push_back(std::move(dump));
+            continue;
+        }
+
+        // Sayfaları sıfır / dolu dizilerine ayır
+        std::vector<std::pair<size_t, bool>> runs;    // (başlangıç sayfası, sıfır mı)
+        size_t pages = size / pageSize;
+        for (size_t p = 0; p < pages; ++p) {
+            bool zero = isZeroPage(dump.data.data() + p * pageSize, pageSize);
+            if (runs.empty() || runs.back().second != zero) {
+                runs.emplace_back(p, zero);
+            }
+        }
+
+        if (runs.size() == 1 && !runs[0].second) {
+            out.push_back(std::move(dump));
+            continue;
+        }
+
+        for (size_t r = 0; r < runs.size(); ++r) {
+            size_t first = runs[r].first;
+            size_t last = (r + 1 < runs.size()) ? runs[r + 1].first : pages;
+
+            MemoryDump part;
+            part.region = dump.region;
+            part.region.startAddr = dump.region.startAddr + first * pageSize;
+            part.region.endAddr = dump.region.startAddr + last * pageSize;
+            part.isValid = true;
+            if (runs[r].second) {
+                part.zeroFill = true;
+                eliminated += (last - first) * pageSize;
+            } else {
+                part.data.assign(dump.data.begin() + first * pageSize,
+                                 dump.data.begin() + last * pageSize);
+            }
+            out.push_back(std::move(part));
+        }
+    }
+
+    dumps = std::move(out);
+    return eliminated;
+}
+
+// ============================================================================
+// PageStore
+// ============================================================================
+
+namespace {
+constexpr char STORE_MAGIC[4] = {'R', 'P', 'G', 'S'};
+constexpr uint32_t STORE_VERSION = 1;
+}
+
+PageStore::PageStore() : m_count(0), m_hits(0) {
+}
+
+uint64_t PageStore::hashPage(const uint8_t* page) {
+    // İki yarının CRC32C'si: tek geçişte 64-bit anahtar
+    uint64_t lo = crc32c(page, PAGE_BYTES / 2);
+    uint64_t hi = crc32c(page + PAGE_BYTES / 2, PAGE_BYTES / 2);
+    return (hi << 32) | lo;
+}
+
+uint8_t* PageStore::slot(uint32_t id) const {
+    return m_blocks[id / PAGES_PER_BLOCK].get() + (id % PAGES_PER_BLOCK) * PAGE_BYTES;
+}
+
+uint32_t PageStore::append(const uint8_t* page, uint64_t hash) {
+    if (m_count % PAGES_PER_BLOCK == 0) {
+        m_blocks.emplace_back(new uint8_t[PAGES_PER_BLOCK * PAGE_BYTES]);
+    }
+    uint32_t id = static_cast<uint32_t>(m_count++);
+    std::memcpy(slot(id), page, PAGE_BYTES);
+    m_index.emplace(hash, id);
+    return id;
+}
+
+uint32_t PageStore::intern(const uint8_t* page) {
+    uint64_t hash = hashPage(page);
+    auto range = m_index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (std::memcmp(slot(it->second), page, PAGE_BYTES) == 0) {
+            m_hits++;
+            return it->second;
+        }
+    }
+    return append(page, hash);
+}
+
+const uint8_t* PageStore::page(uint32_t id) const {
+    return id < m_count ? slot(id) : nullptr;
+}
+
+bool PageStore::save(const std::string& filepath) const {
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        m_lastError = "Failed to open file for writing: " + filepath;
+        return false;
+    }
+
+    uint32_t count = static_cast<uint32_t>(m_count);
+    file.write(STORE_MAGIC, sizeof(STORE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&STORE_VERSION), sizeof(STORE_VERSION));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t b = 0; b < m_blocks.size(); ++b) {
+        size_t pages = std::min(PAGES_PER_BLOCK, m_count - b * PAGES_PER_BLOCK);
+        file.write(reinterpret_cast<const char*>(m_blocks[b].get()), pages * PAGE_BYTES);
+    }
+
+    if (!file) {
+        m_lastError = "Failed to write page store: " + filepath;
+        return false;
+    }
+    return true;
+}
+
+bool PageStore::load(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file) {
+        m_lastError = "Failed to open file: " + filepath;
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version = 0, count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!file || std::memcmp(magic, STORE_MAGIC, sizeof(magic)) != 0 || version != STORE_VERSION) {
+        m_lastError = "Invalid page store: " + filepath;
+        return false;
+    }
+
+    m_blocks.clear();
+    m_index.clear();
+    m_count = 0;
+    m_hits = 0;
+
+    std::vector<uint8_t> page(PAGE_BYTES);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!file.read(reinterpret_cast<char*>(page.data()), PAGE_BYTES)) {
+            m_lastError = "Truncated page store: " + filepath;
+            return false;
+        }
+        append(page.data(), hashPage(page.data()));
+    }
+    return true;
+}
+
+// ============================================================================
+// Checkpoint <-> PageStore
+// ============================================================================
+
+uint64_t deduplicatePages(RealProcessCheckpoint& checkpoint, PageStore& store) {
+    uint64_t shared = store.dedupHits();
+    for (auto& dump : checkpoint.memoryDumps) {
+        size_t size = dump.data.size();
+        if (!dump.isValid || dump.zeroFill || dump.isDeduplicated() ||
+            size == 0 || size % PageStore::PAGE_BYTES != 0) {
+            continue;
+        }
+        
+        dump.pageRefs.resize(size / PageStore::PAGE_BYTES);
+        for (size_t p = 0; p < dump.pageRefs.size(); ++p) {
+            dump.pageRefs[p] = store.intern(dump.data.data() + p * PageStore::PAGE_BYTES);
+        }
+        std::vector<uint8_t>().swap(dump.data);
+    }
+    return store.dedupHits() - shared;
+}
+
+bool rehydratePages(RealProcessCheckpoint& checkpoint, const PageStore& store) {
+    for (auto& dump : checkpoint.memoryDumps) {
+        if (!dump.isDeduplicated()) continue;
+        
+        std::vector<uint8_t> data(dump.pageRefs.size() * PageStore::PAGE_BYTES);
+        for (size_t p = 0; p < dump.pageRefs.size(); ++p) {
+            const uint8_t* page = store.page(dump.pageRefs[p]);
+            if (!page) {
+                return false;
+            }
+            std::memcpy(data.data() + p * PageStore::PAGE_BYTES, page, PageStore::PAGE_BYTES);
+        }
+        dump.data = std::move(data);
+        dump.pageRefs.clear();
+    }
+    return true;
+}
+
+} // namespace real_process
+} // namespace checkpoint
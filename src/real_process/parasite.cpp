@@ -0,0 +1,455 @@
+#include "real_process/parasite.hpp"
+#include "real_process/memory_manager.hpp"
+#include <sys/mman.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/user.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace checkpoint {
+namespace real_process {
+
+// ============================================================================
+// SyscallBatch
+// ============================================================================
+
+size_t SyscallBatch::add(uint64_t nr, uint64_t arg1, uint64_t arg2, uint64_t arg3,
+                         uint64_t arg4, uint64_t arg5, uint64_t arg6) {
+    Command cmd;
+    cmd.nr = nr;
+    cmd.args = {arg1, arg2, arg3, arg4, arg5, arg6};
+    m_commands.push_back(std::move(cmd));
+    return m_commands.size() - 1;
+}
+
+void SyscallBatch::useResult(size_t cmd, int argIndex, size_t sourceCmd) {
+    if (cmd >= m_commands.size() || sourceCmd >= cmd || argIndex < 0 || argIndex >= MAX_ARGS) {
+        return;
+    }
+    m_commands[cmd].args[argIndex] = sourceCmd;
+    m_commands[cmd].resultRefs |= static_cast<uint8_t>(1u << argIndex);
+}
+
+void SyscallBatch::useData(size_t cmd, int argIndex, const void* data, size_t size) {
+    if (cmd >= m_commands.size() || argIndex < 0 || argIndex >= MAX_ARGS) {
+        return;
+    }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    m_commands[cmd].data.emplace_back(argIndex, std::vector<uint8_t>(bytes, bytes + size));
+}
+
+void SyscallBatch::useString(size_t cmd, int argIndex, const std::string& str) {
+    useData(cmd, argIndex, str.c_str(), str.size() + 1);
+}
+
+size_t SyscallBatch::addMmap(uint64_t addr, uint64_t length, int prot, int flags, int fd, off_t offset) {
+    return add(SYS_mmap, addr, length, static_cast<uint64_t>(prot), static_cast<uint64_t>(flags),
+               static_cast<uint64_t>(static_cast<int64_t>(fd)), static_cast<uint64_t>(offset));
+}
+
+size_t SyscallBatch::addMunmap(uint64_t addr, uint64_t length) {
+    return add(SYS_munmap, addr, length);
+}
+
+size_t SyscallBatch::addMprotect(uint64_t addr, uint64_t length, int prot) {
+    return add(SYS_mprotect, addr, length, static_cast<uint64_t>(prot));
+}
+
+size_t SyscallBatch::addMadvise(uint64_t addr, uint64_t length, int advice) {
+    return add(SYS_madvise, addr, length, static_cast<uint64_t>(advice));
+}
+
+size_t SyscallBatch::addOpen(const std::string& path, int flags, int mode) {
+    // openat(AT_FDCWD, ...): aarch64'te SYS_open yok, x86_64'te eşdeğer
+    size_t index = add(SYS_openat, static_cast<uint64_t>(static_cast<int64_t>(AT_FDCWD)), 0,
+                       static_cast<uint64_t>(flags), static_cast<uint64_t>(mode));
+    useString(index, 1, path);
+    return index;
+}
+
+size_t SyscallBatch::addClose(int fd) {
+    return add(SYS_close, static_cast<uint64_t>(static_cast<int64_t>(fd)));
+}
+
+size_t SyscallBatch::addDup2(int oldFd, int newFd) {
+    return add(SYS_dup2, static_cast<uint64_t>(static_cast<int64_t>(oldFd)),
+               static_cast<uint64_t>(static_cast<int64_t>(newFd)));
+}
+
+size_t SyscallBatch::addLseek(int fd, off_t offset, int whence) {
+    return add(SYS_lseek, static_cast<uint64_t>(static_cast<int64_t>(fd)),
+               static_cast<uint64_t>(offset), static_cast<uint64_t>(whence));
+}
+
+bool SyscallBatch::hasData() const {
+    for (const auto& cmd : m_commands) {
+        if (!cmd.data.empty()) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// ParasiteStub
+// ============================================================================
+
+namespace {
+
+#if defined(__x86_64__)
+// Giriş: rdi = komut dizisi, rsi = komut sayısı, rdx = stopOnError.
+// Komut (64 byte): nr(u32) | resultRefs(u32) | args[6] | result(i64).
+// Kalan komut sayısı int3'te r12'de; hata ile durulduysa r12 > 0.
+//
+//   mov rbx, rdi; mov r13, rdi; mov r12, rsi; mov r14, rdx
+// loop:
+//   test r12, r12; jz done
+//   mov r15d, [rbx+4]; xor ecx, ecx
+// ref:                                  ; resultRefs bitleri
+//   bt r15d, ecx; jnc next
+//   mov rax, [rbx+rcx*8+8]; shl rax, 6
+//   mov rax, [r13+rax+56]; mov [rbx+rcx*8+8], rax
+// next:
+//   inc ecx; cmp ecx, 6; jb ref
+//   mov eax, [rbx]; mov rdi..r9, [rbx+8..48]
+//   syscall
+//   mov [rbx+56], rax
+//   test r14, r14; jz advance
+//   cmp rax, -4095; jae done
+// advance:
+//   add rbx, 64; dec r12; jmp loop
+// done:
+//   int3
+constexpr uint8_t PARASITE_CODE[] = {
+    0x48, 0x89, 0xfb, 0x49, 0x89, 0xfd, 0x49, 0x89, 0xf4, 0x49, 0x89, 0xd6,
+    0x4d, 0x85, 0xe4, 0x74, 0x5c, 0x44, 0x8b, 0x7b, 0x04, 0x31, 0xc9,
+    0x41, 0x0f, 0xa3, 0xcf, 0x73, 0x13, 0x48, 0x8b, 0x44, 0xcb, 0x08,
+    0x48, 0xc1, 0xe0, 0x06, 0x49, 0x8b, 0x44, 0x05, 0x38, 0x48, 0x89, 0x44, 0xcb, 0x08,
+    0xff, 0xc1, 0x83, 0xf9, 0x06, 0x72, 0xe0,
+    0x8b, 0x03, 0x48, 0x8b, 0x7b, 0x08, 0x48, 0x8b, 0x73, 0x10, 0x48, 0x8b, 0x53, 0x18,
+    0x4c, 0x8b, 0x53, 0x20, 0x4c, 0x8b, 0x43, 0x28, 0x4c, 0x8b, 0x4b, 0x30,
+    0x0f, 0x05, 0x48, 0x89, 0x43, 0x38,
+    0x4d, 0x85, 0xf6, 0x74, 0x08, 0x48, 0x3d, 0x01, 0xf0, 0xff, 0xff, 0x73, 0x09,
+    0x48, 0x83, 0xc3, 0x40, 0x49, 0xff, 0xcc, 0xeb, 0x9f,
+    0xcc
+};
+constexpr size_t PARASITE_TRAP_OFFSET = sizeof(PARASITE_CODE);    // int3 sonrası RIP
+static_assert(sizeof(PARASITE_CODE) == 0x6e, "parasite code layout");
+#endif
+
+size_t alignUp(size_t value) {
+    return (value + 15) & ~size_t(15);
+}
+
+// Bir komutun komut alanında kapladığı yer (veri dahil)
+size_t commandFootprint(const SyscallBatch::Command& cmd) {
+    size_t bytes = ParasiteStub::COMMAND_BYTES;
+    for (const auto& data : cmd.data) {
+        bytes += alignUp(data.second.size());
+    }
+    return bytes;
+}
+
+} // namespace
+
+ParasiteStub::ParasiteStub(pid_t pid, size_t areaSize)
+    : m_pid(pid) {
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    m_areaSize = std::max(areaSize, CODE_SIZE + COMMAND_BYTES);
+    m_areaSize = (m_areaSize + page - 1) / page * page;
+}
+
+ParasiteStub::~ParasiteStub() {
+    if (m_base != 0) {
+        uninstall();
+    }
+}
+
+bool ParasiteStub::isSupported() {
+#if defined(__x86_64__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ParasiteStub::install() {
+    if (m_base != 0) return true;
+    if (!isSupported()) {
+        m_lastError = "Parasite stub is only implemented for x86_64";
+        return false;
+    }
+
+#if defined(__x86_64__)
+    MemoryManager bootstrap;
+    if (bootstrap.bindProcess(m_pid) != MemoryError::SUCCESS) {
+        m_lastError = bootstrap.getLastError();
+        return false;
+    }
+    int64_t addr = bootstrap.injectSyscall(SYS_mmap, 0, m_areaSize,
+                                           PROT_READ | PROT_WRITE | PROT_EXEC,
+                                           MAP_PRIVATE | MAP_ANONYMOUS,
+                                           static_cast<uint64_t>(-1), 0);
+    if (addr == -1) {
+        // injectSyscall kendi hatasında da -1 döner
+        m_lastError = "Parasite mmap failed: " + bootstrap.getLastError();
+        return false;
+    }
+    if (addr < 0 && addr >= -4095) {
+        m_lastError = "Parasite mmap failed: " + std::string(strerror(static_cast<int>(-addr)));
+        return false;
+    }
+
+    m_base = static_cast<uint64_t>(addr);
+    if (!writeRemote(m_base, PARASITE_CODE, sizeof(PARASITE_CODE))) {
+        bootstrap.injectSyscall(SYS_munmap, m_base, m_areaSize);
+        m_base = 0;
+        return false;
+    }
+    m_totalRoundTrips++;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ParasiteStub::uninstall() {
+    if (m_base == 0) return true;
+    MemoryManager bootstrap;
+    bool ok = bootstrap.bindProcess(m_pid) == MemoryError::SUCCESS &&
+              bootstrap.injectSyscall(SYS_munmap, m_base, m_areaSize) == 0;
+    if (!ok) {
+        m_lastError = "Parasite munmap failed: " + bootstrap.getLastError();
+    }
+    m_base = 0;
+    return ok;
+}
+
+bool ParasiteStub::overlaps(uint64_t addr, uint64_t length) const {
+    return m_base != 0 && addr < m_base + m_areaSize && m_base < addr + length;
+}
+
+bool ParasiteStub::writeRemote(uint64_t addr, const void* data, size_t size) {
+    struct iovec local = {const_cast<void*>(data), size};
+    struct iovec remote = {reinterpret_cast<void*>(addr), size};
+    ssize_t n = process_vm_writev(m_pid, &local, 1, &remote, 1, 0);
+    if (n == static_cast<ssize_t>(size)) return true;
+
+    // process_vm_writev kapalıysa (ör. seccomp) ptrace ile word word
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t off = 0; off < size; off += sizeof(long)) {
+        long word = 0;
+        size_t chunk = std::min(sizeof(long), size - off);
+        if (chunk < sizeof(long)) {
+            errno = 0;
+            word = ptrace(PTRACE_PEEKDATA, m_pid, addr + off, nullptr);
+            if (errno != 0) {
+                m_lastError = "Failed to read parasite area: " + std::string(strerror(errno));
+                return false;
+            }
+        }
+        std::memcpy(&word, bytes + off, chunk);
+        if (ptrace(PTRACE_POKEDATA, m_pid, addr + off, word) == -1) {
+            m_lastError = "Failed to write parasite area: " + std::string(strerror(errno));
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParasiteStub::readRemote(uint64_t addr, void* data, size_t size) {
+    struct iovec local = {data, size};
+    struct iovec remote = {reinterpret_cast<void*>(addr), size};
+    ssize_t n = process_vm_readv(m_pid, &local, 1, &remote, 1, 0);
+    if (n == static_cast<ssize_t>(size)) return true;
+
+    auto* bytes = static_cast<uint8_t*>(data);
+    for (size_t off = 0; off < size; off += sizeof(long)) {
+        errno = 0;
+        long word = ptrace(PTRACE_PEEKDATA, m_pid, addr + off, nullptr);
+        if (errno != 0) {
+            m_lastError = "Failed to read parasite area: " + std::string(strerror(errno));
+            return false;
+        }
+        std::memcpy(bytes + off, &word, std::min(sizeof(long), size - off));
+    }
+    return true;
+}
+
+bool ParasiteStub::execute(const SyscallBatch& batch, SyscallBatchResult& result) {
+    result.results.assign(batch.size(), SyscallBatchResult::NOT_RUN);
+    result.executed = 0;
+    result.roundTrips = 0;
+    if (batch.empty()) return true;
+    if (!install()) return false;
+
+    const size_t capacity = m_areaSize - CODE_SIZE;
+    const auto& commands = batch.commands();
+    size_t first = 0;
+    while (first < commands.size()) {
+        size_t count = 0;
+        size_t used = 0;
+        while (first + count < commands.size()) {
+            size_t need = commandFootprint(commands[first + count]);
+            if (used + need > capacity) break;
+            used += need;
+            count++;
+        }
+        if (count == 0) {
+            m_lastError = "Syscall batch command does not fit the parasite area";
+            return false;
+        }
+
+        bool stopped = false;
+        if (!runChunk(batch, first, count, result, stopped)) {
+            return false;
+        }
+        if (stopped) break;
+        first += count;
+    }
+    return true;
+}
+
+bool ParasiteStub::runChunk(const SyscallBatch& batch, size_t first, size_t count,
+                            SyscallBatchResult& result, bool& stopped) {
+#if defined(__x86_64__)
+    const auto& commands = batch.commands();
+    const uint64_t cmdBase = m_base + CODE_SIZE;
+
+    // Komut dizisi + arkasına veriler
+    size_t dataBytes = 0;
+    for (size_t j = 0; j < count; ++j) {
+        dataBytes += commandFootprint(commands[first + j]) - COMMAND_BYTES;
+    }
+    std::vector<uint8_t> buffer(count * COMMAND_BYTES + dataBytes, 0);
+    size_t dataOffset = count * COMMAND_BYTES;
+
+    for (size_t j = 0; j < count; ++j) {
+        const auto& cmd = commands[first + j];
+        uint64_t words[8] = {};
+        uint32_t refs = 0;
+        for (int a = 0; a < SyscallBatch::MAX_ARGS; ++a) {
+            words[1 + a] = cmd.args[a];
+            if (!(cmd.resultRefs & (1u << a))) continue;
+            size_t source = static_cast<size_t>(cmd.args[a]);
+            if (source >= first) {
+                words[1 + a] = source - first;      // blok içinde çözülür
+                refs |= 1u << a;
+            } else {
+                words[1 + a] = static_cast<uint64_t>(result.results[source]);
+            }
+        }
+        for (const auto& data : cmd.data) {
+            std::memcpy(buffer.data() + dataOffset, data.second.data(), data.second.size());
+            words[1 + data.first] = cmdBase + dataOffset;
+            dataOffset += alignUp(data.second.size());
+        }
+        words[0] = (cmd.nr & 0xFFFFFFFFULL) | (static_cast<uint64_t>(refs) << 32);
+        words[7] = static_cast<uint64_t>(SyscallBatchResult::NOT_RUN);
+        std::memcpy(buffer.data() + j * COMMAND_BYTES, words, sizeof(words));
+    }
+
+    if (!writeRemote(cmdBase, buffer.data(), buffer.size())) {
+        return false;
+    }
+
+    struct user_regs_struct saved, regs;
+    if (ptrace(PTRACE_GETREGS, m_pid, nullptr, &saved) == -1) {
+        m_lastError = "Failed to save registers: " + std::string(strerror(errno));
+        return false;
+    }
+    regs = saved;
+    regs.rip = m_base;
+    regs.rdi = cmdBase;
+    regs.rsi = count;
+    regs.rdx = batch.getStopOnError() ? 1 : 0;
+    regs.orig_rax = static_cast<uint64_t>(-1);      // syscall restart yapılmasın
+    if (ptrace(PTRACE_SETREGS, m_pid, nullptr, &regs) == -1) {
+        m_lastError = "Failed to set registers: " + std::string(strerror(errno));
+        return false;
+    }
+
+    // int3'e kadar çalıştır; araya giren sinyaller sonra yeniden kuyruğa alınır
+    std::vector<int> deferred;
+    bool trapped = false;
+    if (ptrace(PTRACE_CONT, m_pid, nullptr, nullptr) == -1) {
+        m_lastError = "Failed to run parasite: " + std::string(strerror(errno));
+        ptrace(PTRACE_SETREGS, m_pid, nullptr, &saved);
+        return false;
+    }
+    while (!trapped) {
+        int status = 0;
+        if (waitpid(m_pid, &status, __WALL) == -1) {
+            if (errno == EINTR) continue;
+            m_lastError = "waitpid failed: " + std::string(strerror(errno));
+            return false;
+        }
+        if (WIFEXITED(status) || WIFSIGNALED(status)) {
+            m_lastError = "Target exited while running parasite";
+            m_base = 0;
+            return false;
+        }
+        if (!WIFSTOPPED(status)) continue;
+
+        int sig = WSTOPSIG(status);
+        if (sig == SIGTRAP) {
+            if (ptrace(PTRACE_GETREGS, m_pid, nullptr, &regs) == -1) {
+                m_lastError = "Failed to read parasite registers";
+                return false;
+            }
+            if (regs.rip == m_base + PARASITE_TRAP_OFFSET) {
+                trapped = true;
+                break;
+            }
+        }
+        if (sig == SIGSEGV || sig == SIGBUS || sig == SIGILL) {
+            // Parasite alanı batch tarafından bozuldu (ör. MAP_FIXED üstüne)
+            ptrace(PTRACE_SETREGS, m_pid, nullptr, &saved);
+            m_lastError = "Parasite faulted with signal " + std::to_string(sig);
+            m_base = 0;
+            return false;
+        }
+        deferred.push_back(sig);
+        ptrace(PTRACE_CONT, m_pid, nullptr, nullptr);
+    }
+
+    uint64_t remaining = regs.r12;
+    if (ptrace(PTRACE_SETREGS, m_pid, nullptr, &saved) == -1) {
+        m_lastError = "Failed to restore registers: " + std::string(strerror(errno));
+    }
+    for (int sig : deferred) {
+        syscall(SYS_tkill, m_pid, sig);
+    }
+    m_totalRoundTrips++;
+    result.roundTrips++;
+
+    std::vector<uint8_t> back(count * COMMAND_BYTES);
+    if (!readRemote(cmdBase, back.data(), back.size())) {
+        return false;
+    }
+    for (size_t j = 0; j < count; ++j) {
+        int64_t value;
+        std::memcpy(&value, back.data() + j * COMMAND_BYTES + 56, sizeof(value));
+        result.results[first + j] = value;
+    }
+
+    size_t executed = count - static_cast<size_t>(remaining);
+    stopped = remaining > 0;
+    if (stopped) executed++;         // Duran komut da çalıştı
+    result.executed += executed;
+    return true;
+#else
+    (void)batch; (void)first; (void)count; (void)result;
+    stopped = true;
+    m_lastError = "Parasite stub is only implemented for x86_64";
+    return false;
+#endif
+}
+
+} // namespace real_process
+} // namespace checkpoint
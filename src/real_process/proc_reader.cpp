@@ -7,8 +7,17 @@
 #include <unistd.h>
 #include <cstring>
 #include <algorithm>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <iomanip>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <linux/fs.h>
+#include <string_view>
 
 namespace checkpoint {
 namespace real_process {
@@ -202,41 +211,170 @@ bool ProcFSReader::parseStatusFile(pid_t pid, RealProcessInfo& info) {
     return true;
 }
 
-bool ProcFSReader::parseMapsLine(const std::string& line, MemoryRegion& region) {
-    // Format: address perms offset dev inode pathname
-    // Example: 00400000-00452000 r-xp 00000000 08:01 1234567 /usr/bin/program
-    
-    std::istringstream iss(line);
-    std::string addrRange, perms, offset, dev;
+namespace {
+
+// Eski kernel header'larında yok (Linux 6.11, include/uapi/linux/fs.h)
+#ifndef PROCMAP_QUERY
+struct procmap_query {
+    uint64_t size;
+    uint64_t query_flags;
+    uint64_t query_addr;
+    uint64_t vma_start;
+    uint64_t vma_end;
+    uint64_t vma_flags;
+    uint64_t vma_page_size;
+    uint64_t vma_offset;
     uint64_t inode;
+    uint32_t dev_major;
+    uint32_t dev_minor;
+    uint32_t vma_name_size;
+    uint32_t build_id_size;
+    uint64_t vma_name_addr;
+    uint64_t build_id_addr;
+};
+#define PROCMAP_QUERY _IOWR('f', 17, struct procmap_query)
+#endif
+
+constexpr uint64_t kVmaReadable = 0x01;
+constexpr uint64_t kVmaWritable = 0x02;
+constexpr uint64_t kVmaExecutable = 0x04;
+constexpr uint64_t kVmaShared = 0x08;
+constexpr uint64_t kQueryCoveringOrNext = 0x10;
+
+constexpr size_t kMapsReadChunk = 64 * 1024;
+
+// ENOTTY/EINVAL bir kez görülünce metin yoluna kalıcı geçilir
+std::atomic<bool> g_mapQueryUnsupported{false};
+
+inline bool isBlank(char c) { return c == ' ' || c == '\t'; }
+
+inline void skipBlanks(const char*& p, const char* end) {
+    while (p < end && isBlank(*p)) ++p;
+}
+
+bool parseHex(const char*& p, const char* end, uint64_t& value) {
+    const char* start = p;
+    uint64_t v = 0;
+    for (; p < end; ++p) {
+        unsigned digit;
+        char c = *p;
+        if (c >= '0' && c <= '9') digit = static_cast<unsigned>(c - '0');
+        else if (c >= 'a' && c <= 'f') digit = static_cast<unsigned>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') digit = static_cast<unsigned>(c - 'A' + 10);
+        else break;
+        v = (v << 4) | digit;
+    }
+    value = v;
+    return p != start;
+}
+
+bool parseDec(const char*& p, const char* end, uint64_t& value) {
+    const char* start = p;
+    uint64_t v = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        v = v * 10 + static_cast<uint64_t>(*p - '0');
+    }
+    value = v;
+    return p != start;
+}
+
+const char* tokenEnd(const char* p, const char* end) {
+    while (p < end && !isBlank(*p)) ++p;
+    return p;
+}
+
+// fd'yi sabit bir buffer'a parça parça okuyup her satırı ('\n' hariç)
+// callback'e verir; yarım kalan satır buffer başına taşınır
+template<typename LineFn>
+bool forEachLine(int fd, LineFn&& onLine) {
+    static thread_local std::vector<char> buffer(kMapsReadChunk);
+    size_t used = 0;
+    bool ok = true;
     
-    iss >> addrRange >> perms >> offset >> dev >> inode;
+    while (true) {
+        ssize_t n = ::read(fd, buffer.data() + used, buffer.size() - used);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) {
+            ok = false;
+            break;
+        }
+        if (n == 0) break;
+        used += static_cast<size_t>(n);
+        
+        const char* p = buffer.data();
+        const char* end = p + used;
+        while (const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)))) {
+            onLine(p, nl);
+            p = nl + 1;
+        }
+        
+        size_t rest = static_cast<size_t>(end - p);
+        if (rest == buffer.size()) {
+            rest = 0;           // Buffer'dan uzun satır (olmamalı): at
+        }
+        std::memmove(buffer.data(), p, rest);
+        used = rest;
+    }
     
-    // Parse address range
-    size_t dashPos = addrRange.find('-');
-    if (dashPos == std::string::npos) return false;
+    if (ok && used > 0) {
+        onLine(buffer.data(), buffer.data() + used);
+    }
+    return ok;
+}
+
+// [vsyscall] gibi gate alanları VMA değildir, PROCMAP_QUERY bunları
+// döndürmez. Sistem geneli olduklarından bir kez /proc/self/maps'ten alınır.
+const std::vector<MemoryRegion>& gateRegions() {
+    static const std::vector<MemoryRegion> regions = [] {
+        std::vector<MemoryRegion> all;
+        ProcFSReader reader;
+        reader.readMemoryMapsText(getpid(), all);
+        std::vector<MemoryRegion> gates;
+        for (auto& region : all) {
+            if (region.startAddr >= (1ULL << 63)) {
+                gates.push_back(std::move(region));
+            }
+        }
+        return gates;
+    }();
+    return regions;
+}
+
+} // namespace
+
+bool ProcFSReader::parseMapsLine(const char* begin, const char* end, MemoryRegion& region) {
+    // Format: address perms offset dev inode pathname
+    // Example: 00400000-00452000 r-xp 00000000 08:01 1234567 /usr/bin/program
+    const char* p = begin;
     
-    region.startAddr = std::stoull(addrRange.substr(0, dashPos), nullptr, 16);
-    region.endAddr = std::stoull(addrRange.substr(dashPos + 1), nullptr, 16);
+    if (!parseHex(p, end, region.startAddr) || p >= end || *p != '-') return false;
+    ++p;
+    if (!parseHex(p, end, region.endAddr)) return false;
+    skipBlanks(p, end);
     
     // Parse permissions
-    region.readable = (perms.size() > 0 && perms[0] == 'r');
-    region.writable = (perms.size() > 1 && perms[1] == 'w');
-    region.executable = (perms.size() > 2 && perms[2] == 'x');
-    region.isPrivate = (perms.size() > 3 && perms[3] == 'p');
+    const char* perms = p;
+    p = tokenEnd(p, end);
+    size_t permLen = static_cast<size_t>(p - perms);
+    region.readable = (permLen > 0 && perms[0] == 'r');
+    region.writable = (permLen > 1 && perms[1] == 'w');
+    region.executable = (permLen > 2 && perms[2] == 'x');
+    region.isPrivate = (permLen > 3 && perms[3] == 'p');
+    skipBlanks(p, end);
+    
+    if (!parseHex(p, end, region.offset)) return false;
+    skipBlanks(p, end);
+    
+    const char* dev = p;
+    p = tokenEnd(p, end);
+    region.device.assign(dev, static_cast<size_t>(p - dev));      // "maj:min" SSO'ya sığar
+    skipBlanks(p, end);
     
-    region.offset = std::stoull(offset, nullptr, 16);
-    region.device = dev;
-    region.inode = inode;
+    if (!parseDec(p, end, region.inode)) return false;
     
     // Pathname (rest of line, may have leading spaces)
-    std::getline(iss, region.pathname);
-    size_t start = region.pathname.find_first_not_of(" \t");
-    if (start != std::string::npos) {
-        region.pathname = region.pathname.substr(start);
-    } else {
-        region.pathname.clear();
-    }
+    skipBlanks(p, end);
+    region.pathname.assign(p, static_cast<size_t>(end - p));
     
     return true;
 }
@@ -327,24 +465,228 @@ LinuxProcessState ProcFSReader::getProcessState(pid_t pid) {
 // Memory Maps
 // ============================================================================
 
-std::vector<MemoryRegion> ProcFSReader::getMemoryMaps(pid_t pid) {
-    std::vector<MemoryRegion> regions;
+bool ProcFSReader::isMapQuerySupported() {
+    return !g_mapQueryUnsupported.load(std::memory_order_relaxed);
+}
+
+bool ProcFSReader::queryMemoryMaps(pid_t pid, std::vector<MemoryRegion>& regions) {
+    regions.clear();
+    if (!isMapQuerySupported()) {
+        return false;
+    }
     
-    auto lines = readFileLines(procPath(pid, "maps"));
-    for (const auto& line : lines) {
-        MemoryRegion region;
-        if (parseMapsLine(line, region)) {
-            regions.push_back(region);
+    int fd = ::open(procPath(pid, "maps").c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    
+    char name[PATH_MAX + 64];
+    uint64_t addr = 0;
+    bool ok = true;
+    while (true) {
+        procmap_query query;
+        std::memset(&query, 0, sizeof(query));
+        query.size = sizeof(query);
+        query.query_flags = kQueryCoveringOrNext;
+        query.query_addr = addr;
+        query.vma_name_addr = reinterpret_cast<uintptr_t>(name);
+        query.vma_name_size = sizeof(name);
+        
+        if (::ioctl(fd, PROCMAP_QUERY, &query) != 0) {
+            if (errno == EINTR) continue;
+            if (errno == ENOENT) break;         // addr'den sonra VMA yok
+            if (errno == ENOTTY || errno == EINVAL || errno == EOPNOTSUPP) {
+                g_mapQueryUnsupported.store(true, std::memory_order_relaxed);
+            }
+            ok = false;
+            break;
+        }
+        
+        MemoryRegion& region = regions.emplace_back();
+        region.startAddr = query.vma_start;
+        region.endAddr = query.vma_end;
+        region.readable = (query.vma_flags & kVmaReadable) != 0;
+        region.writable = (query.vma_flags & kVmaWritable) != 0;
+        region.executable = (query.vma_flags & kVmaExecutable) != 0;
+        region.isPrivate = (query.vma_flags & kVmaShared) == 0;
+        region.offset = query.vma_offset;
+        region.inode = query.inode;
+        
+        // maps ile aynı biçim: "%02x:%02x"
+        char dev[24];
+        int devLen = std::snprintf(dev, sizeof(dev), "%02x:%02x", query.dev_major, query.dev_minor);
+        region.device.assign(dev, static_cast<size_t>(devLen));
+        
+        // vma_name_size NUL dahil döner; isimsiz VMA'da 0
+        if (query.vma_name_size > 1) {
+            region.pathname.assign(name, query.vma_name_size - 1);
+        }
+        
+        addr = query.vma_end;
+    }
+    ::close(fd);
+    
+    if (!ok) {
+        regions.clear();
+        return false;
+    }
+    
+    for (const auto& gate : gateRegions()) {
+        if (regions.empty() || gate.startAddr >= regions.back().endAddr) {
+            regions.push_back(gate);
+        }
+    }
+    return true;
+}
+
+bool ProcFSReader::readMemoryMapsText(pid_t pid, std::vector<MemoryRegion>& regions) {
+    regions.clear();
+    
+    int fd = ::open(procPath(pid, "maps").c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    
+    bool ok = forEachLine(fd, [&regions](const char* begin, const char* end) {
+        MemoryRegion& region = regions.emplace_back();
+        if (!parseMapsLine(begin, end, region)) {
+            regions.pop_back();
         }
+    });
+    ::close(fd);
+    return ok;
+}
+
+bool ProcFSReader::readSmaps(pid_t pid, std::vector<MemoryRegion>& regions) {
+    regions.clear();
+    
+    int fd = ::open(procPath(pid, "smaps").c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
     }
     
+    // Başlık satırı maps satırıdır; ardından "Anahtar: değer [kB]" satırları
+    bool ok = forEachLine(fd, [&regions](const char* begin, const char* end) {
+        const char* key = tokenEnd(begin, end);
+        if (key == begin || key[-1] != ':') {
+            MemoryRegion& region = regions.emplace_back();
+            if (!parseMapsLine(begin, end, region)) {
+                regions.pop_back();
+            }
+            return;
+        }
+        if (regions.empty()) return;
+        
+        MemoryRegion& region = regions.back();
+        std::string_view name(begin, static_cast<size_t>(key - begin - 1));
+        const char* p = key;
+        skipBlanks(p, end);
+        uint64_t value = 0;
+        if (name == "KernelPageSize") {
+            if (parseDec(p, end, value)) region.kernelPageSize = value * 1024;
+        } else if (name == "AnonHugePages") {
+            if (parseDec(p, end, value)) region.anonHugeBytes = value * 1024;
+            region.hugePages = region.anonHugeBytes > 0;
+        } else if (name == "THPeligible") {
+            region.thpEligible = parseDec(p, end, value) && value != 0;
+        }
+    });
+    ::close(fd);
+    return ok;
+}
+
+void ProcFSReader::copyPageSizes(const std::vector<MemoryRegion>& from, std::vector<MemoryRegion>& to) {
+    // İki liste de adrese göre sıralı: tek geçişte başlangıcı eşleşenler
+    auto src = from.begin();
+    for (auto& region : to) {
+        while (src != from.end() && src->startAddr < region.startAddr) ++src;
+        if (src == from.end()) break;
+        if (src->startAddr != region.startAddr) continue;
+        region.kernelPageSize = src->kernelPageSize;
+        region.anonHugeBytes = src->anonHugeBytes;
+        region.thpEligible = src->thpEligible;
+        region.hugePages = src->hugePages;
+    }
+}
+
+MemoryMapSnapshot ProcFSReader::loadMemoryMaps(pid_t pid, bool& viaQuery) {
+    auto regions = std::make_shared<std::vector<MemoryRegion>>();
+    viaQuery = queryMemoryMaps(pid, *regions);
+    if (!viaQuery) {
+        readMemoryMapsText(pid, *regions);
+    }
     return regions;
 }
 
+MemoryMapSnapshot ProcFSReader::getMemoryMapsSnapshot(pid_t pid) {
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::milliseconds ttl;
+    {
+        std::lock_guard<std::mutex> lock(m_mapsMutex);
+        ttl = m_mapsCacheTtl;
+        if (ttl.count() > 0) {
+            auto it = m_mapsCache.find(pid);
+            if (it != m_mapsCache.end() && now - it->second.loadedAt < ttl) {
+                m_mapsStats.hits++;
+                return it->second.regions;
+            }
+        }
+    }
+    
+    bool viaQuery = false;
+    MemoryMapSnapshot snapshot = loadMemoryMaps(pid, viaQuery);
+    
+    std::lock_guard<std::mutex> lock(m_mapsMutex);
+    m_mapsStats.misses++;
+    if (viaQuery) m_mapsStats.queryReads++;
+    else m_mapsStats.textReads++;
+    
+    if (ttl.count() > 0 && !snapshot->empty()) {
+        // Süresi dolmuş girdileri de temizle (ölü pid'ler birikmesin)
+        for (auto it = m_mapsCache.begin(); it != m_mapsCache.end();) {
+            if (now - it->second.loadedAt >= ttl) it = m_mapsCache.erase(it);
+            else ++it;
+        }
+        m_mapsCache[pid] = MapsCacheEntry{snapshot, now};
+    }
+    return snapshot;
+}
+
+void ProcFSReader::setMapsCacheTtl(std::chrono::milliseconds ttl) {
+    std::lock_guard<std::mutex> lock(m_mapsMutex);
+    m_mapsCacheTtl = ttl;
+    if (ttl.count() <= 0) {
+        m_mapsCache.clear();
+    }
+}
+
+std::chrono::milliseconds ProcFSReader::getMapsCacheTtl() const {
+    std::lock_guard<std::mutex> lock(m_mapsMutex);
+    return m_mapsCacheTtl;
+}
+
+void ProcFSReader::invalidateMemoryMaps(pid_t pid) {
+    std::lock_guard<std::mutex> lock(m_mapsMutex);
+    if (pid == 0) {
+        m_mapsCache.clear();
+    } else {
+        m_mapsCache.erase(pid);
+    }
+}
+
+ProcFSReader::MapsCacheStats ProcFSReader::getMapsCacheStats() const {
+    std::lock_guard<std::mutex> lock(m_mapsMutex);
+    return m_mapsStats;
+}
+
+std::vector<MemoryRegion> ProcFSReader::getMemoryMaps(pid_t pid) {
+    return *getMemoryMapsSnapshot(pid);
+}
+
 std::vector<MemoryRegion> ProcFSReader::getStackRegions(pid_t pid) {
     std::vector<MemoryRegion> result;
-    auto maps = getMemoryMaps(pid);
-    for (const auto& region : maps) {
+    auto maps = getMemoryMapsSnapshot(pid);
+    for (const auto& region : *maps) {
         if (region.isStack()) {
             result.push_back(region);
         }
@@ -354,8 +696,8 @@ std::vector<MemoryRegion> ProcFSReader::getStackRegions(pid_t pid) {
 
 std::vector<MemoryRegion> ProcFSReader::getHeapRegions(pid_t pid) {
     std::vector<MemoryRegion> result;
-    auto maps = getMemoryMaps(pid);
-    for (const auto& region : maps) {
+    auto maps = getMemoryMapsSnapshot(pid);
+    for (const auto& region : *maps) {
         if (region.isHeap()) {
             result.push_back(region);
         }
@@ -365,8 +707,8 @@ std::vector<MemoryRegion> ProcFSReader::getHeapRegions(pid_t pid) {
 
 std::vector<MemoryRegion> ProcFSReader::getWritableRegions(pid_t pid) {
     std::vector<MemoryRegion> result;
-    auto maps = getMemoryMaps(pid);
-    for (const auto& region : maps) {
+    auto maps = getMemoryMapsSnapshot(pid);
+    for (const auto& region : *maps) {
         if (region.writable) {
             result.push_back(region);
         }
@@ -376,8 +718,8 @@ std::vector<MemoryRegion> ProcFSReader::getWritableRegions(pid_t pid) {
 
 std::vector<MemoryRegion> ProcFSReader::getAnonymousRegions(pid_t pid) {
     std::vector<MemoryRegion> result;
-    auto maps = getMemoryMaps(pid);
-    for (const auto& region : maps) {
+    auto maps = getMemoryMapsSnapshot(pid);
+    for (const auto& region : *maps) {
         if (region.isAnonymous() && !region.isVdso()) {
             result.push_back(region);
         }
@@ -385,6 +727,190 @@ std::vector<MemoryRegion> ProcFSReader::getAnonymousRegions(pid_t pid) {
     return result;
 }
 
+// ============================================================================
+// Soft-Dirty Tracking
+// ============================================================================
+
+bool ProcFSReader::clearSoftDirty(pid_t pid) {
+    std::ofstream file(procPath(pid, "clear_refs"));
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    // 4 = sadece soft-dirty bitlerini temizle (bkz. Documentation/admin-guide/mm/soft-dirty.rst)
+    file << "4";
+    file.flush();
+    return file.good();
+}
+
+namespace {
+
+// Paylaşılan sıfır sayfasının frame numarası: kendi adres alanımızda okunan
+// ama hiç yazılmamış anonim sayfa ona bağlanır. PFN gizliyse 0.
+uint64_t zeroPageFrame() {
+    static const uint64_t frame = []() -> uint64_t {
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        void* p = mmap(nullptr, static_cast<size_t>(pageSize), PROT_READ,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            return 0;
+        }
+        (void)*static_cast<volatile const uint8_t*>(p);
+        
+        uint64_t entry = 0;
+        int fd = open("/proc/self/pagemap", O_RDONLY);
+        if (fd >= 0) {
+            off_t off = static_cast<off_t>(reinterpret_cast<uint64_t>(p) / pageSize * sizeof(entry));
+            if (pread(fd, &entry, sizeof(entry), off) != static_cast<ssize_t>(sizeof(entry))) {
+                entry = 0;
+            }
+            close(fd);
+        }
+        munmap(p, static_cast<size_t>(pageSize));
+        return (entry & (1ULL << 63)) ? (entry & ((1ULL << 55) - 1)) : 0;
+    }();
+    return frame;
+}
+
+} // namespace
+
+bool ProcFSReader::softDirtySupported() {
+    // Yeni VMA VM_SOFTDIRTY ile doğar: destek varsa yazılan sayfa kirli okunur
+    static const bool supported = []() {
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        void* p = mmap(nullptr, static_cast<size_t>(pageSize), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            return false;
+        }
+        *static_cast<volatile uint8_t*>(p) = 1;
+        
+        uint64_t entry = 0;
+        int fd = open("/proc/self/pagemap", O_RDONLY);
+        if (fd >= 0) {
+            off_t off = static_cast<off_t>(reinterpret_cast<uint64_t>(p) / pageSize * sizeof(entry));
+            if (pread(fd, &entry, sizeof(entry), off) != static_cast<ssize_t>(sizeof(entry))) {
+                entry = 0;
+            }
+            close(fd);
+        }
+        munmap(p, static_cast<size_t>(pageSize));
+        return (entry & (1ULL << 55)) != 0;
+    }();
+    return supported;
+}
+
+std::optional<std::vector<std::pair<uint64_t, uint64_t>>> ProcFSReader::getDirtyPageRanges(
+    pid_t pid, const MemoryRegion& region,
+    std::vector<std::pair<uint64_t, uint64_t>>* zeroRanges) {
+    
+    constexpr uint64_t PRESENT_BIT = 1ULL << 63;
+    constexpr uint64_t SWAPPED_BIT = 1ULL << 62;
+    constexpr uint64_t FILE_BIT = 1ULL << 61;
+    constexpr uint64_t EXCLUSIVE_BIT = 1ULL << 56;
+    constexpr uint64_t SOFT_DIRTY_BIT = 1ULL << 55;
+    constexpr uint64_t PFN_MASK = (1ULL << 55) - 1;
+    const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    
+    int fd = open(procPath(pid, "pagemap").c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    
+    // Soft-dirty biti sadece yazmaları görür. MADV_DONTNEED (ya da reclaim)
+    // sonrası sayfa bit'siz geri gelir: bellekte olmayan, swap'taki ve sıfır
+    // sayfasına bağlı girişler de kirli sayılır. Özel anonim bölgede dosya
+    // sayfası sadece huge zero page olabilir. PFN gizliyse sıfır sayfası
+    // fork'la paylaşılan COW sayfasından ayırt edilemez; ikisi de kirli.
+    const bool anonymous = region.isPrivate && region.isAnonymous();
+    const uint64_t zeroFrame = zeroPageFrame();
+    auto isDirtyEntry = [&](uint64_t entry) {
+        if (entry & SOFT_DIRTY_BIT) return true;
+        if (!(entry & PRESENT_BIT) || (entry & SWAPPED_BIT)) return true;
+        if (entry & FILE_BIT) return anonymous;
+        if (entry & EXCLUSIVE_BIT) return false;
+        uint64_t frame = entry & PFN_MASK;
+        return frame == 0 || frame == zeroFrame;
+    };
+    
+    // Özel anonim bölgede hiç dokunulmamış / boşaltılmış sayfa ve sıfır
+    // sayfası kesin sıfır okunur. Dosya destekli bölgede boşluk dosya
+    // içeriğini okur, sıfır sayılmaz.
+    auto isZeroEntry = [&](uint64_t entry) {
+        if (!anonymous || (entry & SWAPPED_BIT)) return false;
+        if (!(entry & PRESENT_BIT) || (entry & FILE_BIT)) return true;
+        uint64_t frame = entry & PFN_MASK;
+        return !(entry & EXCLUSIVE_BIT) && frame != 0 && frame == zeroFrame;
+    };
+    auto append = [pageSize](std::vector<std::pair<uint64_t, uint64_t>>& out, uint64_t addr) {
+        if (!out.empty() && out.back().second == addr) {
+            out.back().second += pageSize;
+        } else {
+            out.emplace_back(addr, addr + pageSize);
+        }
+    };
+    
+    // pagemap: sanal sayfa başına 8 byte, sayfa numarasıyla indekslenir
+    const uint64_t firstPage = region.startAddr / pageSize;
+    const uint64_t pageCount = region.size() / pageSize;
+    constexpr uint64_t BATCH = 512;
+    std::vector<uint64_t> entries(BATCH);
+    
+    for (uint64_t done = 0; done < pageCount; ) {
+        uint64_t batch = std::min(BATCH, pageCount - done);
+        ssize_t want = static_cast<ssize_t>(batch * sizeof(uint64_t));
+        off_t off = static_cast<off_t>((firstPage + done) * sizeof(uint64_t));
+        
+        if (pread(fd, entries.data(), want, off) != want) {
+            close(fd);
+            return std::nullopt;
+        }
+        
+        for (uint64_t i = 0; i < batch; ++i) {
+            uint64_t addr = region.startAddr + (done + i) * pageSize;
+            if (zeroRanges && isZeroEntry(entries[i])) {
+                append(*zeroRanges, addr);
+            } else if (isDirtyEntry(entries[i])) {
+                append(ranges, addr);
+            }
+        }
+        
+        done += batch;
+    }
+    
+    close(fd);
+    return ranges;
+}
+
+std::optional<std::vector<uint64_t>> ProcFSReader::getPageFrames(
+    pid_t pid, uint64_t startAddr, uint64_t size) {
+    
+    constexpr uint64_t PRESENT_BIT = 1ULL << 63;
+    constexpr uint64_t PFN_MASK = (1ULL << 55) - 1;
+    const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    
+    int fd = open(procPath(pid, "pagemap").c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    
+    std::vector<uint64_t> frames(size / pageSize);
+    ssize_t want = static_cast<ssize_t>(frames.size() * sizeof(uint64_t));
+    off_t off = static_cast<off_t>(startAddr / pageSize * sizeof(uint64_t));
+    bool ok = pread(fd, frames.data(), want, off) == want;
+    close(fd);
+    if (!ok) {
+        return std::nullopt;
+    }
+    
+    for (auto& entry : frames) {
+        entry = (entry & PRESENT_BIT) ? (entry & PFN_MASK) : 0;
+    }
+    return frames;
+}
+
 // ============================================================================
 // File Descriptors
 // ============================================================================
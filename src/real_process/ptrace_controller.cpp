@@ -1,8 +1,19 @@
 #include "real_process/ptrace_controller.hpp"
+#include "real_process/memory_manager.hpp"
+#include "real_process/checkpoint_stream.hpp"
+#include "real_process/checkpoint_image.hpp"
+#include "real_process/page_store.hpp"
+#include "real_process/dump_buffer_pool.hpp"
+#include "real_process/lazy_restore.hpp"
 #include <sys/ptrace.h>
 #include <sys/wait.h>
 #include <sys/user.h>
 #include <sys/uio.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sched.h>
+#include <signal.h>
+#include <pthread.h>
 #include <elf.h>
 #include <fcntl.h>
 #include <unistd.h>
@@ -11,6 +22,9 @@
 #include <chrono>
 #include <thread>
 #include <fstream>
+#include <map>
+#include <climits>
+#include <algorithm>
 
 namespace checkpoint {
 namespace real_process {
@@ -44,6 +58,23 @@ PtraceError errnoToPtraceError() {
     }
 }
 
+// waitForStop: kaçan SIGCHLD'de en uzun gecikme
+constexpr int64_t WAIT_SLICE_US = 10000;
+
+// process_vm_readv/writev çağrısı başına iovec sınırı
+static size_t maxIovecs() {
+    static const size_t limit = [] {
+        long v = sysconf(_SC_IOV_MAX);
+        return v > 0 ? static_cast<size_t>(v) : static_cast<size_t>(IOV_MAX);
+    }();
+    return limit;
+}
+
+static uint64_t pageSize() {
+    static const uint64_t size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
 // ============================================================================
 // PtraceController Implementation
 // ============================================================================
@@ -61,7 +92,12 @@ PtraceController::~PtraceController() {
 
 PtraceController::PtraceController(PtraceController&& other) noexcept
     : m_pid(other.m_pid), m_attached(other.m_attached), 
-      m_seized(other.m_seized), m_memFd(other.m_memFd) {
+      m_seized(other.m_seized), m_memFd(other.m_memFd),
+      m_threads(std::move(other.m_threads)), m_freezeStats(other.m_freezeStats),
+      m_frozenAt(other.m_frozenAt), m_bufferPool(std::move(other.m_bufferPool)),
+      m_readCalls(other.m_readCalls.load()), m_readBytes(other.m_readBytes.load()),
+      m_writeCalls(other.m_writeCalls.load()), m_writeBytes(other.m_writeBytes.load()) {
+    other.m_threads.clear();
     other.m_pid = 0;
     other.m_attached = false;
     other.m_seized = false;
@@ -79,7 +115,16 @@ PtraceController& PtraceController::operator=(PtraceController&& other) noexcept
         m_attached = other.m_attached;
         m_seized = other.m_seized;
         m_memFd = other.m_memFd;
+        m_threads = std::move(other.m_threads);
+        m_freezeStats = other.m_freezeStats;
+        m_frozenAt = other.m_frozenAt;
+        m_bufferPool = std::move(other.m_bufferPool);
+        m_readCalls = other.m_readCalls.load();
+        m_readBytes = other.m_readBytes.load();
+        m_writeCalls = other.m_writeCalls.load();
+        m_writeBytes = other.m_writeBytes.load();
         
+        other.m_threads.clear();
         other.m_pid = 0;
         other.m_attached = false;
         other.m_seized = false;
@@ -125,6 +170,10 @@ PtraceError PtraceController::detach() {
     
     closeMemFd();
     
+    if (!m_threads.empty()) {
+        return detachThreads();
+    }
+    
     if (ptrace(PTRACE_DETACH, m_pid, nullptr, nullptr) == -1) {
         // If process is not stopped, try to continue first
         if (errno == ESRCH) {
@@ -142,6 +191,24 @@ PtraceError PtraceController::detach() {
     return PtraceError::SUCCESS;
 }
 
+PtraceError PtraceController::adoptTracee(pid_t pid) {
+    if (m_attached || m_seized) {
+        detach();
+    }
+    
+    // Gerçekten tracee'miz mi ve durmuş mu? (PTRACE_GETREGS sadece buna izin verir)
+    struct user_regs_struct regs;
+    if (ptrace(PTRACE_GETREGS, pid, nullptr, &regs) == -1) {
+        return errnoToPtraceError();
+    }
+    
+    m_pid = pid;
+    m_attached = true;
+    openMemFd();
+    
+    return PtraceError::SUCCESS;
+}
+
 PtraceError PtraceController::seize(pid_t pid) {
     if (m_attached || m_seized) {
         detach();
@@ -160,6 +227,117 @@ PtraceError PtraceController::seize(pid_t pid) {
     return PtraceError::SUCCESS;
 }
 
+// ============================================================================
+// Thread Group
+// ============================================================================
+
+PtraceError PtraceController::freezeThreadGroup(pid_t pid) {
+    if (m_attached || m_seized) {
+        detach();
+    }
+    
+    m_freezeStats = FreezeStats();
+    auto start = std::chrono::steady_clock::now();
+    m_pid = pid;
+    m_seized = true;
+    
+    ProcFSReader reader;
+    std::vector<pid_t> interrupted;
+    PtraceError failure = PtraceError::SUCCESS;
+    
+    while (failure == PtraceError::SUCCESS) {
+        interrupted.clear();
+        for (pid_t tid : reader.getThreadIds(pid)) {
+            bool known = std::any_of(m_threads.begin(), m_threads.end(),
+                                     [tid](const FrozenThread& t) { return t.tid == tid; });
+            if (known) continue;
+            
+            if (ptrace(PTRACE_SEIZE, tid, nullptr, nullptr) == -1) {
+                if (errno == ESRCH) continue;       // Bu arada çıktı
+                failure = errnoToPtraceError();
+                break;
+            }
+            if (ptrace(PTRACE_INTERRUPT, tid, nullptr, nullptr) == -1 && errno != ESRCH) {
+                failure = errnoToPtraceError();
+                ptrace(PTRACE_DETACH, tid, nullptr, nullptr);
+                break;
+            }
+            interrupted.push_back(tid);
+        }
+        if (interrupted.empty()) break;
+        m_freezeStats.scanRounds++;
+        
+        // Interrupt'lar gönderildi; şimdi durmalarını topla
+        for (pid_t tid : interrupted) {
+            int status = 0;
+            pid_t waited;
+            do {
+                waited = waitpid(tid, &status, __WALL);
+            } while (waited == -1 && errno == EINTR);
+            if (waited == -1 || !WIFSTOPPED(status)) {
+                continue;       // Thread çıktı; tracee değil artık
+            }
+            
+            // status >> 16 == 0: interrupt'tan önce gelen bir sinyalin
+            // delivery-stop'u. Sinyal yutulmasın diye detach'te geri verilir.
+            int pendingSignal = 0;
+            if ((status >> 16) == 0) {
+                pendingSignal = WSTOPSIG(status);
+            }
+            m_threads.push_back({tid, pendingSignal});
+        }
+    }
+    
+    auto leader = std::find_if(m_threads.begin(), m_threads.end(),
+                               [pid](const FrozenThread& t) { return t.tid == pid; });
+    if (failure == PtraceError::SUCCESS && leader == m_threads.end()) {
+        failure = PtraceError::NO_SUCH_PROCESS;
+    }
+    if (failure != PtraceError::SUCCESS) {
+        detachThreads();
+        return failure;
+    }
+    std::iter_swap(m_threads.begin(), leader);
+    
+    m_frozenAt = std::chrono::steady_clock::now();
+    m_freezeStats.threads = m_threads.size();
+    m_freezeStats.freezeNanos = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(m_frozenAt - start).count());
+    
+    openMemFd();
+    return PtraceError::SUCCESS;
+}
+
+std::vector<pid_t> PtraceController::getFrozenThreads() const {
+    std::vector<pid_t> tids;
+    tids.reserve(m_threads.size());
+    for (const auto& thread : m_threads) {
+        tids.push_back(thread.tid);
+    }
+    return tids;
+}
+
+PtraceError PtraceController::detachThreads() {
+    PtraceError first = PtraceError::SUCCESS;
+    for (const auto& thread : m_threads) {
+        if (ptrace(PTRACE_DETACH, thread.tid, nullptr, thread.pendingSignal) == -1 &&
+            errno != ESRCH && first == PtraceError::SUCCESS) {
+            first = errnoToPtraceError();
+        }
+    }
+    if (m_freezeStats.threads > 0) {
+        m_freezeStats.stoppedNanos = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_frozenAt).count());
+    }
+    
+    m_threads.clear();
+    m_attached = false;
+    m_seized = false;
+    m_pid = 0;
+    return first;
+}
+
 // ============================================================================
 // Process Control
 // ============================================================================
@@ -254,25 +432,50 @@ bool PtraceController::waitForStop(int timeoutMs) {
         return WIFSTOPPED(status);
     }
     
-    // Non-blocking wait with timeout
-    auto start = std::chrono::steady_clock::now();
+    // Timeout'lu bekleme: SIGCHLD bu thread'de bloklanıp sigtimedwait ile
+    // beklenir, durma anında uyanılır. Sinyal process'in başka bir thread'ine
+    // gitmiş olabileceğinden bekleme dilimlere bölünür.
+    sigset_t set;
+    sigset_t oldMask;
+    sigemptyset(&set);
+    sigaddset(&set, SIGCHLD);
+    pthread_sigmask(SIG_BLOCK, &set, &oldMask);
+    bool consumed = false;
+    bool stopped = false;
+    
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
     while (true) {
-        pid_t result = waitpid(m_pid, &status, WNOHANG);
+        pid_t result = waitpid(m_pid, &status, WNOHANG | __WALL);
         if (result == m_pid) {
-            return WIFSTOPPED(status);
+            stopped = WIFSTOPPED(status);
+            break;
         }
         if (result == -1) {
-            return false;
+            break;
         }
         
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now() - start).count();
-        if (elapsed >= timeoutMs) {
-            return false;
+        auto left = std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (left <= 0) {
+            break;
+        }
+        left = std::min<int64_t>(left, WAIT_SLICE_US);
+        timespec ts{static_cast<time_t>(left / 1000000), static_cast<long>((left % 1000000) * 1000)};
+        if (sigtimedwait(&set, nullptr, &ts) == SIGCHLD) {
+            consumed = true;
         }
-        
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+    
+    pthread_sigmask(SIG_SETMASK, &oldMask, nullptr);
+    // Başka çocuklar için kurulmuş bir SIGCHLD handler'ı bildirimi kaçırmasın
+    if (consumed && !sigismember(&oldMask, SIGCHLD)) {
+        struct sigaction action;
+        if (sigaction(SIGCHLD, nullptr, &action) == 0 &&
+            action.sa_handler != SIG_DFL && action.sa_handler != SIG_IGN) {
+            kill(getpid(), SIGCHLD);
+        }
+    }
+    return stopped;
 }
 
 // ============================================================================
@@ -280,13 +483,17 @@ bool PtraceController::waitForStop(int timeoutMs) {
 // ============================================================================
 
 PtraceError PtraceController::getRegisters(LinuxRegisters& regs) {
+    return getThreadRegisters(m_pid, regs);
+}
+
+PtraceError PtraceController::getThreadRegisters(pid_t tid, LinuxRegisters& regs) {
     if (!m_attached && !m_seized) {
         return PtraceError::NOT_STOPPED;
     }
     
     struct user_regs_struct uregs;
     
-    if (ptrace(PTRACE_GETREGS, m_pid, nullptr, &uregs) == -1) {
+    if (ptrace(PTRACE_GETREGS, tid, nullptr, &uregs) == -1) {
         return errnoToPtraceError();
     }
     
@@ -323,6 +530,10 @@ PtraceError PtraceController::getRegisters(LinuxRegisters& regs) {
 }
 
 PtraceError PtraceController::setRegisters(const LinuxRegisters& regs) {
+    return setThreadRegisters(m_pid, regs);
+}
+
+PtraceError PtraceController::setThreadRegisters(pid_t tid, const LinuxRegisters& regs) {
     if (!m_attached && !m_seized) {
         return PtraceError::NOT_STOPPED;
     }
@@ -358,7 +569,7 @@ PtraceError PtraceController::setRegisters(const LinuxRegisters& regs) {
     uregs.fs = regs.fs;
     uregs.gs = regs.gs;
     
-    if (ptrace(PTRACE_SETREGS, m_pid, nullptr, &uregs) == -1) {
+    if (ptrace(PTRACE_SETREGS, tid, nullptr, &uregs) == -1) {
         return errnoToPtraceError();
     }
     
@@ -366,6 +577,10 @@ PtraceError PtraceController::setRegisters(const LinuxRegisters& regs) {
 }
 
 PtraceError PtraceController::getFPURegisters(std::vector<uint8_t>& fpuState) {
+    return getThreadFPURegisters(m_pid, fpuState);
+}
+
+PtraceError PtraceController::getThreadFPURegisters(pid_t tid, std::vector<uint8_t>& fpuState) {
     if (!m_attached && !m_seized) {
         return PtraceError::NOT_STOPPED;
     }
@@ -377,7 +592,7 @@ PtraceError PtraceController::getFPURegisters(std::vector<uint8_t>& fpuState) {
     iov.iov_base = fpuState.data();
     iov.iov_len = fpuState.size();
     
-    if (ptrace(PTRACE_GETREGSET, m_pid, NT_FPREGSET, &iov) == -1) {
+    if (ptrace(PTRACE_GETREGSET, tid, NT_FPREGSET, &iov) == -1) {
         fpuState.clear();
         return errnoToPtraceError();
     }
@@ -387,6 +602,10 @@ PtraceError PtraceController::getFPURegisters(std::vector<uint8_t>& fpuState) {
 }
 
 PtraceError PtraceController::setFPURegisters(const std::vector<uint8_t>& fpuState) {
+    return setThreadFPURegisters(m_pid, fpuState);
+}
+
+PtraceError PtraceController::setThreadFPURegisters(pid_t tid, const std::vector<uint8_t>& fpuState) {
     if (!m_attached && !m_seized) {
         return PtraceError::NOT_STOPPED;
     }
@@ -395,7 +614,7 @@ PtraceError PtraceController::setFPURegisters(const std::vector<uint8_t>& fpuSta
     iov.iov_base = const_cast<uint8_t*>(fpuState.data());
     iov.iov_len = fpuState.size();
     
-    if (ptrace(PTRACE_SETREGSET, m_pid, NT_FPREGSET, &iov) == -1) {
+    if (ptrace(PTRACE_SETREGSET, tid, NT_FPREGSET, &iov) == -1) {
         return errnoToPtraceError();
     }
     
@@ -415,9 +634,11 @@ uint64_t PtraceController::peekData(uint64_t addr, PtraceError* err) {
     errno = 0;
     long data = ptrace(PTRACE_PEEKDATA, m_pid, addr, nullptr);
     if (errno != 0) {
+        countRead(0);
         if (err) *err = errnoToPtraceError();
         return 0;
     }
+    countRead(sizeof(long));
     
     if (err) *err = PtraceError::SUCCESS;
     return static_cast<uint64_t>(data);
@@ -429,8 +650,10 @@ PtraceError PtraceController::pokeData(uint64_t addr, uint64_t data) {
     }
     
     if (ptrace(PTRACE_POKEDATA, m_pid, addr, data) == -1) {
+        countWrite(0);
         return errnoToPtraceError();
     }
+    countWrite(sizeof(long));
     
     return PtraceError::SUCCESS;
 }
@@ -440,9 +663,20 @@ PtraceError PtraceController::readMemory(uint64_t addr, void* buffer, size_t siz
         return PtraceError::NOT_STOPPED;
     }
     
-    // Try using /proc/pid/mem first (faster)
+    // process_vm_readv: tek syscall, ptrace-stop gerektirmez
+    struct iovec local = { buffer, size };
+    struct iovec remote = { reinterpret_cast<void*>(addr), size };
+    ssize_t r = process_vm_readv(m_pid, &local, 1, &remote, 1, 0);
+    countRead(r);
+    if (r == static_cast<ssize_t>(size)) {
+        return PtraceError::SUCCESS;
+    }
+    
+    // Try using /proc/pid/mem (faster than PEEKDATA)
     if (m_memFd >= 0) {
-        if (pread(m_memFd, buffer, size, addr) == static_cast<ssize_t>(size)) {
+        r = pread(m_memFd, buffer, size, addr);
+        countRead(r);
+        if (r == static_cast<ssize_t>(size)) {
             return PtraceError::SUCCESS;
         }
         // Fall back to ptrace
@@ -475,6 +709,15 @@ PtraceError PtraceController::writeMemory(uint64_t addr, const void* buffer, siz
         return PtraceError::NOT_STOPPED;
     }
     
+    // process_vm_writev dene (salt-okunur sayfalara yazamaz, o durumda POKEDATA)
+    struct iovec local = { const_cast<void*>(buffer), size };
+    struct iovec remote = { reinterpret_cast<void*>(addr), size };
+    ssize_t r = process_vm_writev(m_pid, &local, 1, &remote, 1, 0);
+    countWrite(r);
+    if (r == static_cast<ssize_t>(size)) {
+        return PtraceError::SUCCESS;
+    }
+    
     const uint8_t* buf = static_cast<const uint8_t*>(buffer);
     size_t offset = 0;
     
@@ -526,11 +769,13 @@ MemoryDump PtraceController::dumpMemoryRegion(const MemoryRegion& region) {
     }
     
     size_t size = region.size();
-    dump.data.resize(size);
+    dump.data = allocateDumpBuffer(size);
     
     PtraceError err = readMemory(region.startAddr, dump.data.data(), size);
     if (err == PtraceError::SUCCESS) {
         dump.isValid = true;
+    } else if (m_bufferPool) {
+        m_bufferPool->recycle(dump);
     } else {
         dump.data.clear();
     }
@@ -538,6 +783,19 @@ MemoryDump PtraceController::dumpMemoryRegion(const MemoryRegion& region) {
     return dump;
 }
 
+PtraceController::IoStats PtraceController::getIoStats() const {
+    IoStats stats;
+    stats.readCalls = m_readCalls.load(std::memory_order_relaxed);
+    stats.readBytes = m_readBytes.load(std::memory_order_relaxed);
+    stats.writeCalls = m_writeCalls.load(std::memory_order_relaxed);
+    stats.writeBytes = m_writeBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::vector<uint8_t> PtraceController::allocateDumpBuffer(size_t size) {
+    return m_bufferPool ? m_bufferPool->acquire(size) : std::vector<uint8_t>(size);
+}
+
 PtraceError PtraceController::restoreMemoryRegion(const MemoryDump& dump) {
     if (!dump.isValid || dump.data.empty()) {
         return PtraceError::INVALID_ARGUMENT;
@@ -555,6 +813,415 @@ PtraceError PtraceController::restoreMemoryRegion(const MemoryDump& dump) {
     return writeMemory(dump.region.startAddr, dump.data.data(), dump.data.size());
 }
 
+void PtraceController::readSegments(const std::vector<ReadSegment>& segments,
+                                    std::vector<SegmentHole>& holes,
+                                    bool onTracerThread) {
+    auto markHole = [&holes](size_t seg, uint64_t off, uint64_t len) {
+        if (!holes.empty() && holes.back().segment == seg &&
+            holes.back().offset + holes.back().length == off) {
+            holes.back().length += len;
+        } else {
+            holes.push_back({seg, off, len});
+        }
+    };
+    
+    // process_vm_readv yoksa: /proc/<pid>/mem, tracer thread'inde PEEKDATA da
+    auto fallbackRead = [this, onTracerThread](uint64_t addr, uint8_t* buf, size_t len) {
+        if (onTracerThread) {
+            return readMemory(addr, buf, len) == PtraceError::SUCCESS;
+        }
+        if (m_memFd < 0) return false;
+        ssize_t r = pread(m_memFd, buf, len, addr);
+        countRead(r);
+        return r == static_cast<ssize_t>(len);
+    };
+    
+    std::vector<struct iovec> local(maxIovecs());
+    std::vector<struct iovec> remote(maxIovecs());
+    
+    size_t idx = 0;     // segments içindeki imleç
+    uint64_t off = 0;   // segments[idx] içindeki offset
+    bool vmUnavailable = false;
+    
+    while (idx < segments.size()) {
+        // İmleçten itibaren bir grup iovec hazırla
+        size_t n = 0;
+        size_t batchBytes = 0;
+        for (size_t i = idx; i < segments.size() && n < local.size(); ++i) {
+            uint64_t start = (i == idx) ? off : 0;
+            size_t len = segments[i].length - start;
+            local[n].iov_base = segments[i].buffer + start;
+            local[n].iov_len = len;
+            remote[n].iov_base = reinterpret_cast<void*>(segments[i].addr + start);
+            remote[n].iov_len = len;
+            batchBytes += len;
+            ++n;
+        }
+        
+        ssize_t r = process_vm_readv(m_pid, local.data(), n, remote.data(), n, 0);
+        countRead(r);
+        if (r < 0 && errno != EFAULT) {
+            vmUnavailable = true;   // ENOSYS / EPERM - eski yola düş
+            break;
+        }
+        
+        // Okunan byte kadar imleci ilerlet
+        size_t got = r < 0 ? 0 : static_cast<size_t>(r);
+        while (got > 0 && idx < segments.size()) {
+            size_t left = segments[idx].length - off;
+            if (got >= left) {
+                got -= left;
+                ++idx;
+                off = 0;
+            } else {
+                off += got;
+                got = 0;
+            }
+        }
+        
+        if (r >= 0 && static_cast<size_t>(r) == batchBytes) continue;
+        if (idx >= segments.size()) break;
+        
+        // Kısa okuma: imleçteki sayfayı tek başına dene. Okunamıyorsa
+        // delik olarak işaretle ve bir sonraki sayfadan devam et.
+        uint64_t addr = segments[idx].addr + off;
+        size_t len = std::min<uint64_t>(pageSize() - (addr % pageSize()),
+                                        segments[idx].length - off);
+        struct iovec l = { segments[idx].buffer + off, len };
+        struct iovec rm = { reinterpret_cast<void*>(addr), len };
+        ssize_t single = process_vm_readv(m_pid, &l, 1, &rm, 1, 0);
+        countRead(single);
+        if (single != static_cast<ssize_t>(len)) {
+            markHole(idx, off, len);
+        }
+        
+        off += len;
+        if (off >= segments[idx].length) {
+            ++idx;
+            off = 0;
+        }
+    }
+    
+    if (!vmUnavailable) return;
+    
+    for (; idx < segments.size(); ++idx, off = 0) {
+        const auto& seg = segments[idx];
+        if (fallbackRead(seg.addr + off, seg.buffer + off, seg.length - off)) {
+            continue;
+        }
+        
+        for (uint64_t p = off; p < seg.length; ) {
+            uint64_t addr = seg.addr + p;
+            uint64_t len = std::min<uint64_t>(pageSize() - (addr % pageSize()), seg.length - p);
+            if (!fallbackRead(addr, seg.buffer + p, len)) {
+                markHole(idx, p, len);
+            }
+            p += len;
+        }
+    }
+}
+
+std::vector<MemoryDump> PtraceController::dumpMemoryRegions(
+    const std::vector<MemoryRegion>& regions,
+    unsigned threads,
+    uint64_t chunkSize) {
+    
+    std::vector<MemoryDump> dumps;
+    if (!m_attached && !m_seized) {
+        return dumps;
+    }
+    
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (chunkSize == 0) {
+        chunkSize = DEFAULT_DUMP_CHUNK_SIZE;
+    }
+    chunkSize = std::max<uint64_t>(pageSize(), chunkSize - chunkSize % pageSize());
+    if (chunkSize >= HUGE_PAGE_SIZE) {
+        chunkSize -= chunkSize % HUGE_PAGE_SIZE;
+    }
+    
+    // Tamponları baştan ayır (dumpMemoryRegion ile aynı filtre); worker'lar
+    // doğrudan bu tamponlara yazar, böylece çıktı sırası deterministik kalır
+    std::vector<MemoryDump> pending;
+    pending.reserve(regions.size());
+    uint64_t totalBytes = 0;
+    for (const auto& region : regions) {
+        if (region.isVdso() || !region.readable || region.size() == 0) continue;
+        MemoryDump dump;
+        dump.region = region;
+        dump.data = allocateDumpBuffer(region.size());
+        totalBytes += region.size();
+        pending.push_back(std::move(dump));
+    }
+    
+    // Segment listesi: tek thread'de bölge başına bir segment, paralelde
+    // büyük bölgeler chunkSize'lık parçalara bölünür
+    std::vector<ReadSegment> segments;
+    std::vector<std::pair<size_t, uint64_t>> owners;   // segment -> (pending idx, offset)
+    bool parallel = threads > 1 && totalBytes > chunkSize;
+    
+    for (size_t i = 0; i < pending.size(); ++i) {
+        uint64_t size = pending[i].data.size();
+        uint64_t start = pending[i].region.startAddr;
+        uint64_t o = 0;
+        while (o < size) {
+            // Parça bir sonraki mutlak chunk sınırında biter
+            uint64_t len = parallel ? chunkSize - (start + o) % chunkSize : size;
+            len = std::min(len, size - o);
+            segments.push_back({start + o, pending[i].data.data() + o, len});
+            owners.emplace_back(i, o);
+            o += len;
+        }
+    }
+    
+    std::vector<SegmentHole> segmentHoles;
+    
+    if (!parallel) {
+        readSegments(segments, segmentHoles, true);
+    } else {
+        // Segmentleri byte olarak dengeli, ardışık gruplara böl
+        threads = static_cast<unsigned>(std::min<size_t>(threads, segments.size()));
+        uint64_t target = (totalBytes + threads - 1) / threads;
+        
+        std::vector<std::vector<ReadSegment>> groups(threads);
+        std::vector<std::vector<size_t>> groupIndex(threads);
+        uint64_t acc = 0;
+        size_t g = 0;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (acc >= target && g + 1 < threads) {
+                ++g;
+                acc = 0;
+            }
+            groups[g].push_back(segments[i]);
+            groupIndex[g].push_back(i);
+            acc += segments[i].length;
+        }
+        
+        std::vector<std::vector<SegmentHole>> groupHoles(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([this, &groups, &groupHoles, t] {
+                readSegments(groups[t], groupHoles[t], false);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        
+        // Grup içi segment index'lerini global index'e çevir (sıra korunur)
+        for (unsigned t = 0; t < threads; ++t) {
+            for (auto hole : groupHoles[t]) {
+                hole.segment = groupIndex[t][hole.segment];
+                segmentHoles.push_back(hole);
+            }
+        }
+    }
+    
+    // Segment deliklerini bölge offset'lerine çevir, bitişik olanları birleştir
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> holes(pending.size());
+    for (const auto& hole : segmentHoles) {
+        auto [owner, base] = owners[hole.segment];
+        auto& list = holes[owner];
+        uint64_t holeOff = base + hole.offset;
+        if (!list.empty() && list.back().first + list.back().second == holeOff) {
+            list.back().second += hole.length;
+        } else {
+            list.emplace_back(holeOff, hole.length);
+        }
+    }
+    
+    // Delikli bölgeleri okunabilir sayfa aralıklarına böl
+    dumps.reserve(pending.size());
+    for (size_t i = 0; i < pending.size(); ++i) {
+        auto& dump = pending[i];
+        
+        if (holes[i].empty()) {
+            dump.isValid = true;
+            dumps.push_back(std::move(dump));
+            continue;
+        }
+        
+        uint64_t runStart = 0;
+        auto emitRun = [&](uint64_t from, uint64_t to) {
+            if (to <= from) return;
+            MemoryDump run;
+            run.region = dump.region;
+            run.region.startAddr = dump.region.startAddr + from;
+            run.region.endAddr = dump.region.startAddr + to;
+            run.data = allocateDumpBuffer(to - from);
+            std::memcpy(run.data.data(), dump.data.data() + from, to - from);
+            run.isValid = true;
+            dumps.push_back(std::move(run));
+        };
+        
+        for (const auto& [holeOff, holeLen] : holes[i]) {
+            emitRun(runStart, holeOff);
+            runStart = holeOff + holeLen;
+        }
+        emitRun(runStart, dump.data.size());
+        if (m_bufferPool) {
+            m_bufferPool->recycle(dump);
+        }
+    }
+    
+    return dumps;
+}
+
+PtraceError PtraceController::restoreMemoryRegions(const std::vector<MemoryDump>& dumps,
+                                                   std::vector<PtraceError>* errors) {
+    std::vector<PtraceError> localErrors;
+    std::vector<PtraceError>& results = errors ? *errors : localErrors;
+    results.assign(dumps.size(), PtraceError::SUCCESS);
+    
+    if (!m_attached && !m_seized) {
+        results.assign(dumps.size(), PtraceError::NOT_STOPPED);
+        return PtraceError::NOT_STOPPED;
+    }
+    
+    // restoreMemoryRegion ile aynı ön kontroller
+    std::vector<size_t> writable;
+    std::vector<WriteSegment> segments;
+    writable.reserve(dumps.size());
+    segments.reserve(dumps.size());
+    for (size_t i = 0; i < dumps.size(); ++i) {
+        if (!dumps[i].isValid || dumps[i].data.empty()) {
+            results[i] = PtraceError::INVALID_ARGUMENT;
+        } else if (!dumps[i].region.writable) {
+            results[i] = PtraceError::PERMISSION_DENIED;
+        } else {
+            writable.push_back(i);
+            segments.push_back({dumps[i].region.startAddr, dumps[i].data.data(),
+                                dumps[i].data.size()});
+        }
+    }
+    
+    std::vector<PtraceError> segmentErrors;
+    writeMemorySegments(segments, &segmentErrors);
+    for (size_t i = 0; i < writable.size(); ++i) {
+        results[writable[i]] = segmentErrors[i];
+    }
+    
+    for (auto err : results) {
+        if (err != PtraceError::SUCCESS) return err;
+    }
+    return PtraceError::SUCCESS;
+}
+
+PtraceError PtraceController::writeMemorySegments(const std::vector<WriteSegment>& segments,
+                                                  std::vector<PtraceError>* errors) {
+    std::vector<PtraceError> localErrors;
+    std::vector<PtraceError>& results = errors ? *errors : localErrors;
+    results.assign(segments.size(), PtraceError::SUCCESS);
+    
+    if (!m_attached && !m_seized) {
+        results.assign(segments.size(), PtraceError::NOT_STOPPED);
+        return PtraceError::NOT_STOPPED;
+    }
+    
+    std::vector<size_t> pending;
+    pending.reserve(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (!segments[i].data || segments[i].length == 0) {
+            results[i] = PtraceError::INVALID_ARGUMENT;
+        } else {
+            pending.push_back(i);
+        }
+    }
+    
+    std::vector<struct iovec> local(maxIovecs());
+    std::vector<struct iovec> remote(maxIovecs());
+    
+    size_t pos = 0;     // pending içindeki imleç
+    uint64_t off = 0;
+    
+    while (pos < pending.size()) {
+        size_t n = 0;
+        size_t batchBytes = 0;
+        for (size_t i = pos; i < pending.size() && n < local.size(); ++i) {
+            const auto& seg = segments[pending[i]];
+            uint64_t start = (i == pos) ? off : 0;
+            size_t len = seg.length - start;
+            local[n].iov_base = const_cast<uint8_t*>(seg.data) + start;
+            local[n].iov_len = len;
+            remote[n].iov_base = reinterpret_cast<void*>(seg.addr + start);
+            remote[n].iov_len = len;
+            batchBytes += len;
+            ++n;
+        }
+        
+        ssize_t r = process_vm_writev(m_pid, local.data(), n, remote.data(), n, 0);
+        countWrite(r);
+        
+        size_t put = r < 0 ? 0 : static_cast<size_t>(r);
+        while (put > 0 && pos < pending.size()) {
+            size_t left = segments[pending[pos]].length - off;
+            if (put >= left) {
+                put -= left;
+                ++pos;
+                off = 0;
+            } else {
+                off += put;
+                put = 0;
+            }
+        }
+        
+        if (r >= 0 && static_cast<size_t>(r) == batchBytes) continue;
+        if (pos >= pending.size()) break;
+        
+        // Kısa yazma: bu segmentin kalanını POKEDATA ile dene, sonrakine geç
+        const auto& seg = segments[pending[pos]];
+        PtraceError err = writeMemory(seg.addr + off, seg.data + off, seg.length - off);
+        if (err != PtraceError::SUCCESS) {
+            results[pending[pos]] = err;
+        }
+        ++pos;
+        off = 0;
+    }
+    
+    for (auto err : results) {
+        if (err != PtraceError::SUCCESS) return err;
+    }
+    return PtraceError::SUCCESS;
+}
+
+PtraceError PtraceController::readMemorySegments(const std::vector<ReadSegment>& segments,
+                                                 std::vector<PtraceError>* errors) {
+    std::vector<PtraceError> localErrors;
+    std::vector<PtraceError>& results = errors ? *errors : localErrors;
+    results.assign(segments.size(), PtraceError::SUCCESS);
+    
+    if (!m_attached && !m_seized) {
+        results.assign(segments.size(), PtraceError::NOT_STOPPED);
+        return PtraceError::NOT_STOPPED;
+    }
+    
+    std::vector<ReadSegment> pending;
+    std::vector<size_t> index;
+    pending.reserve(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (!segments[i].buffer || segments[i].length == 0) {
+            results[i] = PtraceError::INVALID_ARGUMENT;
+        } else {
+            pending.push_back(segments[i]);
+            index.push_back(i);
+        }
+    }
+    
+    std::vector<SegmentHole> holes;
+    readSegments(pending, holes, true);
+    for (const auto& hole : holes) {
+        results[index[hole.segment]] = PtraceError::MEMORY_ERROR;
+    }
+    
+    for (auto err : results) {
+        if (err != PtraceError::SUCCESS) return err;
+    }
+    return PtraceError::SUCCESS;
+}
+
 // ============================================================================
 // Signal Handling
 // ============================================================================
@@ -630,12 +1297,21 @@ PtraceController::ScopedAttach::~ScopedAttach() {
 // RealProcessCheckpointer Implementation
 // ============================================================================
 
-RealProcessCheckpointer::RealProcessCheckpointer() {
+RealProcessCheckpointer::RealProcessCheckpointer()
+    : m_bufferPool(std::make_shared<DumpBufferPool>()) {
 }
 
 RealProcessCheckpointer::~RealProcessCheckpointer() {
 }
 
+void RealProcessCheckpointer::releaseCheckpoint(RealProcessCheckpoint& checkpoint) {
+    if (m_bufferPool) {
+        m_bufferPool->recycle(checkpoint);
+    } else {
+        checkpoint.memoryDumps.clear();
+    }
+}
+
 void RealProcessCheckpointer::reportProgress(const std::string& stage, double progress) {
     if (m_progressCallback) {
         m_progressCallback(stage, progress);
@@ -651,7 +1327,101 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
     const std::string& name,
     const CheckpointOptions& options) {
     
+    return captureCheckpoint(pid, name, options, nullptr, nullptr);
+}
+
+std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpointToFile(
+    pid_t pid,
+    const std::string& filepath,
+    const std::string& name,
+    const CheckpointOptions& options,
+    CheckpointFileFormat format) {
+    
+    auto sink = openFileSink(filepath, format);
+    if (!sink) {
+        return std::nullopt;
+    }
+    
+    auto checkpoint = captureCheckpoint(pid, name, options, nullptr, sink.get());
+    sink.reset();
+    
+    if (!checkpoint) {
+        unlink(filepath.c_str());  // Yarım imaj bırakma
+    }
+    return checkpoint;
+}
+
+std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpointToSink(
+    pid_t pid,
+    ICheckpointSink& sink,
+    const std::string& name,
+    const CheckpointOptions& options,
+    const RealProcessCheckpoint* parent) {
+    
+    if (parent && parent->checkpointId == 0) {
+        m_lastError = "Invalid parent checkpoint";
+        return std::nullopt;
+    }
+    
+    return captureCheckpoint(pid, name, options, parent, &sink);
+}
+
+std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createIncrementalCheckpoint(
+    pid_t pid,
+    const RealProcessCheckpoint& parent,
+    const std::string& name,
+    const CheckpointOptions& options) {
+    
+    if (parent.checkpointId == 0) {
+        m_lastError = "Invalid parent checkpoint";
+        return std::nullopt;
+    }
+    
+    if (parent.info.pid != 0 && parent.info.pid != pid) {
+        m_lastError = "Parent checkpoint belongs to process " + 
+                      std::to_string(parent.info.pid);
+        return std::nullopt;
+    }
+    
+    return captureCheckpoint(pid, name, options, &parent, nullptr);
+}
+
+namespace {
+
+// Sıfır olmayan syscall / byte sayaçlarını ize ekle
+void countIo(TraceScope& trace, const PtraceController::IoStats& io) {
+    if (io.readCalls) trace.count("read_syscalls", io.readCalls);
+    if (io.readBytes) trace.count("read_bytes", io.readBytes);
+    if (io.writeCalls) trace.count("write_syscalls", io.writeCalls);
+    if (io.writeBytes) trace.count("write_bytes", io.writeBytes);
+}
+
+} // namespace
+
+bool RealProcessCheckpointer::shouldDumpRegion(const MemoryRegion& region,
+                                               const CheckpointOptions& options) const {
+    if (options.skipReadOnly && !region.writable) return false;
+    if (options.skipVdso && region.isVdso()) return false;
+    if (!options.dumpHeap && region.isHeap()) return false;
+    if (!options.dumpStack && region.isStack()) return false;
+    if (!options.dumpFileBacked && !region.isAnonymous()) {
+        // mapImagePayloads ile restore edilmiş bölge imaj dosyasının private
+        // eşlemesidir: yolu dosyayı gösterse de içeriği process'in belleği
+        return region.isPrivate && region.writable &&
+               MappedCheckpointImage::isIndexedImage(region.pathname);
+    }
+    return true;
+}
+
+std::optional<RealProcessCheckpoint> RealProcessCheckpointer::captureCheckpoint(
+    pid_t pid,
+    const std::string& name,
+    const CheckpointOptions& options,
+    const RealProcessCheckpoint* parent,
+    ICheckpointSink* sink) {
+    
     reportProgress("Starting checkpoint", 0.0);
+    TraceScope trace(parent ? "checkpoint.incremental" : "checkpoint.create", *m_metrics);
     
     // Verify process exists
     if (!m_procReader.processExists(pid)) {
@@ -666,8 +1436,14 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
     checkpoint.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
     
+    if (parent) {
+        checkpoint.parentCheckpointId = parent->checkpointId;
+        checkpoint.isIncremental = true;
+    }
+    
     // Get process info
     reportProgress("Reading process info", 0.1);
+    trace.stage("proc_info");
     auto info = m_procReader.getProcessInfo(pid);
     if (!info) {
         m_lastError = "Failed to read process info";
@@ -675,10 +1451,22 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
     }
     checkpoint.info = *info;
     
-    // Attach to process
+    // smaps her VMA için sayfa tablolarını yürütür: durdurmadan önce okunur.
+    // Aradaki mmap/munmap'lerde eşleşmeyen bölgeler bayraksız kalır.
+    std::vector<MemoryRegion> pageSizes;
+    if (options.saveMemory && options.capturePageSizes) {
+        trace.stage("page_sizes");
+        m_procReader.readSmaps(pid, pageSizes);
+    }
+    
+    // Attach to process - durma penceresi buradan detach'e kadar sürer;
+    // durmayı gerektirmeyen okumalar (process info) öncesinde yapıldı
     reportProgress("Attaching to process", 0.2);
+    trace.stage("attach");
+    m_lastFreezeStats = PtraceController::FreezeStats();
     PtraceController ptrace;
-    PtraceError err = ptrace.attach(pid);
+    PtraceError err = options.captureAllThreads ? ptrace.freezeThreadGroup(pid)
+                                                : ptrace.attach(pid);
     if (err != PtraceError::SUCCESS) {
         m_lastError = "Failed to attach: " + ptraceErrorToString(err);
         return std::nullopt;
@@ -687,6 +1475,7 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
     // Get registers
     if (options.saveRegisters) {
         reportProgress("Reading registers", 0.3);
+        trace.stage("registers");
         err = ptrace.getRegisters(checkpoint.registers);
         if (err != PtraceError::SUCCESS) {
             m_lastError = "Failed to read registers: " + ptraceErrorToString(err);
@@ -699,49 +1488,159 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
             checkpoint.registers.hasFPU = true;
             checkpoint.registers.fpuState = std::move(fpuState);
         }
+        
+        // Diğer thread'ler (ana thread registers'ta)
+        for (pid_t tid : ptrace.getFrozenThreads()) {
+            if (tid == pid) continue;
+            RealProcessCheckpoint::ThreadState thread;
+            thread.tid = tid;
+            err = ptrace.getThreadRegisters(tid, thread.registers);
+            if (err != PtraceError::SUCCESS) {
+                m_lastError = "Failed to read registers of thread " + std::to_string(tid) +
+                              ": " + ptraceErrorToString(err);
+                continue;
+            }
+            if (ptrace.getThreadFPURegisters(tid, fpuState) == PtraceError::SUCCESS) {
+                thread.registers.hasFPU = true;
+                thread.registers.fpuState = std::move(fpuState);
+            }
+            checkpoint.threads.push_back(std::move(thread));
+        }
     }
     
     // Get memory maps
     reportProgress("Reading memory maps", 0.4);
+    trace.stage("maps");
     checkpoint.memoryMap = m_procReader.getMemoryMaps(pid);
+    if (!pageSizes.empty()) {
+        ProcFSReader::copyPageSizes(pageSizes, checkpoint.memoryMap);
+    }
+    
+    // Stream modunda header dump'lardan önce gider
+    if (sink && !sink->writeHeader(checkpoint)) {
+        m_lastError = "Failed to write checkpoint header: " + sink->getLastError();
+        return std::nullopt;
+    }
     
     // Dump memory
     if (options.saveMemory) {
         reportProgress("Dumping memory", 0.5);
+        trace.stage("plan");
         
-        uint64_t totalDumped = 0;
-        int regionIndex = 0;
-        int totalRegions = checkpoint.memoryMap.size();
+        // Dump edilecek bölgeleri (incremental'da kirli sayfa aralıklarını)
+        // topla, sonra tek seferde toplu oku. Kesin sıfır okunan sayfalar
+        // okunmaz, zeroFill aralığı olarak ayrıca kaydedilir.
+        std::vector<MemoryRegion> toDump;
+        std::vector<MemoryRegion> zeroRuns;
+        uint64_t plannedBytes = 0;
+        const bool softDirty = ProcFSReader::softDirtySupported();
         
         for (const auto& region : checkpoint.memoryMap) {
             // Skip based on options
-            if (options.skipReadOnly && !region.writable) continue;
-            if (options.skipVdso && region.isVdso()) continue;
-            if (!options.dumpFileBacked && !region.isAnonymous()) continue;
-            if (!options.dumpHeap && region.isHeap()) continue;
-            if (!options.dumpStack && region.isStack()) continue;
+            if (!shouldDumpRegion(region, options)) continue;
             
             // Check size limit
-            if (options.maxMemoryDump > 0 && totalDumped >= options.maxMemoryDump) {
+            if (options.maxMemoryDump > 0 && plannedBytes >= options.maxMemoryDump) {
                 break;
             }
             
-            // Dump region
-            MemoryDump dump = ptrace.dumpMemoryRegion(region);
-            if (dump.isValid) {
-                totalDumped += dump.data.size();
-                checkpoint.memoryDumps.push_back(std::move(dump));
+            if (parent) {
+                // Sadece kirli sayfaları dump et. Çekirdek soft-dirty tutmuyorsa
+                // ya da pagemap okunamazsa region'ın tamamı tek aralık olarak
+                // alınır (her zaman doğru).
+                std::vector<std::pair<uint64_t, uint64_t>> zeros;
+                std::optional<std::vector<std::pair<uint64_t, uint64_t>>> ranges;
+                if (softDirty) {
+                    ranges = m_procReader.getDirtyPageRanges(pid, region, &zeros);
+                }
+                if (!ranges) {
+                    zeros.clear();
+                    ranges.emplace();
+                    ranges->emplace_back(region.startAddr, region.endAddr);
+                }
+                
+                for (const auto& [start, end] : *ranges) {
+                    MemoryRegion pageRun = region;
+                    pageRun.startAddr = start;
+                    pageRun.endAddr = end;
+                    plannedBytes += pageRun.size();
+                    toDump.push_back(std::move(pageRun));
+                }
+                for (const auto& [start, end] : zeros) {
+                    MemoryRegion zeroRun = region;
+                    zeroRun.startAddr = start;
+                    zeroRun.endAddr = end;
+                    zeroRuns.push_back(std::move(zeroRun));
+                }
+            } else {
+                plannedBytes += region.size();
+                toDump.push_back(region);
+            }
+        }
+        
+        bool clearDirty = parent || options.trackDirtyPages;
+        bool dumped = false;
+        
+        if (options.forkSnapshot) {
+            reportProgress("Forking snapshot", 0.6);
+            trace.stage("fork");
+            auto dumps = dumpViaForkSnapshot(ptrace, pid, toDump, options, clearDirty, sink, trace);
+            if (dumps) {
+                checkpoint.memoryDumps = std::move(*dumps);
+                dumped = true;
+            } else if (!ptrace.isAttached()) {
+                // Target serbest bırakıldıktan sonra başarısız oldu (m_lastError set)
+                return std::nullopt;
+            }
+            // Aksi halde target hâlâ durdurulmuş - yerinde dump'a düş
+        }
+        
+        if (!dumped) {
+            reportProgress("Dumping memory", 0.6);
+            trace.stage("dump");
+            if (!dumpRegions(ptrace, toDump, options, sink, checkpoint.memoryDumps, nullptr)) {
+                return std::nullopt;
             }
             
-            // Update progress
-            regionIndex++;
-            reportProgress("Dumping memory", 0.5 + 0.3 * (double(regionIndex) / totalRegions));
+            // Process hâlâ durdurulmuşken soft-dirty bitlerini sıfırla; bir
+            // sonraki incremental checkpoint bu dump'tan sonraki yazmaları görür.
+            // Temizleme başarısız olursa sonraki dump sadece büyür, yanlış olmaz.
+            if (clearDirty) {
+                m_deltaBaselines.erase(pid);
+                if (!m_procReader.clearSoftDirty(pid)) {
+                    m_lastError = "Failed to clear soft-dirty bits (next incremental will be larger)";
+                }
+            }
+        }
+        
+        // MADV_DONTNEED ile boşaltılan sayfa soft-dirty bırakmaz: parent'taki
+        // eski içerik sıfırla örtülmeli
+        for (const auto& run : zeroRuns) {
+            MemoryDump dump;
+            dump.region = run;
+            dump.zeroFill = true;
+            dump.isValid = true;
+            if (!sink) {
+                checkpoint.memoryDumps.push_back(std::move(dump));
+            } else if (!sink->writeDump(dump)) {
+                m_lastError = "Failed to write memory dump: " + sink->getLastError();
+                return std::nullopt;
+            }
+        }
+        reportProgress("Dumping memory", 0.8);
+        
+        uint64_t dumpedBytes = 0;
+        for (const auto& dump : checkpoint.memoryDumps) {
+            dumpedBytes += dump.region.size();
         }
+        trace.count("regions_dumped", checkpoint.memoryDumps.size());
+        trace.count("bytes_dumped", dumpedBytes);
     }
     
     // Get signals
     if (options.saveSignals) {
         reportProgress("Reading signals", 0.85);
+        trace.stage("signals");
         auto signals = m_procReader.getSignalInfo(pid);
         if (signals) {
             checkpoint.signals = *signals;
@@ -751,34 +1650,247 @@ std::optional<RealProcessCheckpoint> RealProcessCheckpointer::createCheckpoint(
     // Get environment
     if (options.saveEnvironment) {
         reportProgress("Reading environment", 0.9);
+        trace.stage("environ");
         checkpoint.environ = m_procReader.getEnvironment(pid);
     }
     
     // Get file descriptors
     if (options.saveFileDescriptors) {
         reportProgress("Reading file descriptors", 0.95);
+        trace.stage("fds");
         checkpoint.fileDescriptors = m_procReader.getFileDescriptors(pid);
     }
     
-    // Detach (done automatically by destructor)
+    // Durmuş durum okumaları bitti - stream'i kapatmadan önce serbest bırak
+    trace.stage("detach");
+    ptrace.detach();
+    m_lastFreezeStats = ptrace.getFreezeStats();
+    countIo(trace, ptrace.getIoStats());
+    trace.count("threads", m_lastFreezeStats.threads ? m_lastFreezeStats.threads : 1);
+    trace.count("freeze_ns", m_lastFreezeStats.freezeNanos);
+    trace.count("stopped_ns", m_lastFreezeStats.stoppedNanos);
+    
+    trace.stage("finish_stream");
+    if (sink && !sink->finish(checkpoint.signals)) {
+        m_lastError = "Failed to finish checkpoint stream: " + sink->getLastError();
+        return std::nullopt;
+    }
+    
+    // Target serbest: hash ağacı duraklamaya eklenmez
+    if (options.hashPages) {
+        trace.stage("hash");
+        checkpoint.computePageHashes();
+    }
+    
     reportProgress("Complete", 1.0);
+    trace.succeed();
     
     return checkpoint;
 }
 
-bool RealProcessCheckpointer::saveCheckpoint(const RealProcessCheckpoint& checkpoint, 
-                                             const std::string& filepath) {
-    auto data = checkpoint.serialize();
+std::optional<std::vector<MemoryDump>> RealProcessCheckpointer::dumpViaForkSnapshot(
+    PtraceController& ptrace,
+    pid_t pid,
+    const std::vector<MemoryRegion>& regions,
+    const CheckpointOptions& options,
+    bool clearSoftDirty,
+    ICheckpointSink* sink,
+    TraceScope& trace) {
+    
+    // Child, enjekte edilen syscall talimatı yerinde iken kopyalanır;
+    // dump'lardaki bu word'ü sonradan orijinaliyle düzeltmek için sakla
+    LinuxRegisters regs;
+    if (ptrace.getRegisters(regs) != PtraceError::SUCCESS) {
+        m_lastError = "Fork snapshot: failed to read registers";
+        return std::nullopt;
+    }
+    PtraceError peekErr;
+    uint64_t originalCode = ptrace.peekData(regs.rip, &peekErr);
+    
+    // clone(CLONE_PTRACE): child bizim tracee'miz olarak SIGSTOP ile doğar ve
+    // tek talimat çalıştırmadan durur. exit_signal = 0, target'ın SIGCHLD
+    // handler'ı tetiklenmez.
+    MemoryManager memory;
+    memory.bindProcess(pid);
+    int64_t child = memory.injectSyscall(SYS_clone, CLONE_PTRACE, 0, 0, 0, 0);
+    if (child <= 0) {
+        m_lastError = "Fork snapshot: clone injection failed: " + memory.getLastError();
+        return std::nullopt;
+    }
+    
+    pid_t snapPid = static_cast<pid_t>(child);
+    int status;
+    if (waitpid(snapPid, &status, __WALL) == -1) {
+        kill(snapPid, SIGKILL);
+        m_lastError = "Fork snapshot: child did not stop";
+        return std::nullopt;
+    }
+    
+    // Target durmuşken soft-dirty temizle, sonra hemen serbest bırak
+    if (clearSoftDirty) {
+        m_deltaBaselines.erase(pid);
+        if (!m_procReader.clearSoftDirty(pid)) {
+            m_lastError = "Failed to clear soft-dirty bits (next incremental will be larger)";
+        }
+    }
+    ptrace.detach();
+    reportProgress("Target resumed, dumping snapshot", 0.65);
+    trace.stage("dump");
+    
+    // Child, enjekte edilen syscall talimatı yerindeyken kopyalandı
+    auto fixup = [&](MemoryDump& dump) {
+        if (peekErr == PtraceError::SUCCESS &&
+            regs.rip >= dump.region.startAddr &&
+            regs.rip + sizeof(originalCode) <= dump.region.endAddr) {
+            std::memcpy(dump.data.data() + (regs.rip - dump.region.startAddr),
+                        &originalCode, sizeof(originalCode));
+        }
+    };
+    
+    PtraceController snapshot;
+    std::vector<MemoryDump> dumps;
+    bool ok = false;
+    if (snapshot.adoptTracee(snapPid) == PtraceError::SUCCESS) {
+        ok = dumpRegions(snapshot, regions, options, sink, dumps, fixup);
+        countIo(trace, snapshot.getIoStats());
+    } else {
+        m_lastError = "Fork snapshot: failed to adopt snapshot child";
+    }
+    
+    // Child'ı öldür. Tracer olarak çıkışını topluyoruz ama zombie'yi gerçek
+    // parent (target) reap etmeli: kısa bir attach ile wait4 enjekte et.
+    trace.stage("reap");
+    kill(snapPid, SIGKILL);
+    waitpid(snapPid, &status, __WALL);
+    snapshot.detach();
+    
+    PtraceController reaper;
+    if (reaper.attach(pid) == PtraceError::SUCCESS) {
+        MemoryManager reapMemory;
+        reapMemory.bindProcess(pid);
+        reapMemory.injectSyscall(SYS_wait4, static_cast<uint64_t>(snapPid), 0, __WALL, 0);
+        reaper.detach();
+    } else {
+        m_lastError = "Fork snapshot: could not reap snapshot child " + std::to_string(snapPid);
+    }
+    
+    if (!ok) {
+        return std::nullopt;
+    }
+    return dumps;
+}
+
+bool RealProcessCheckpointer::dumpRegions(
+    PtraceController& source,
+    const std::vector<MemoryRegion>& regions,
+    const CheckpointOptions& options,
+    ICheckpointSink* sink,
+    std::vector<MemoryDump>& out,
+    const std::function<void(MemoryDump&)>& fixup) {
+    
+    source.setBufferPool(m_bufferPool);
+    if (!sink) {
+        out = source.dumpMemoryRegions(regions, options.dumpThreads, options.dumpChunkSize);
+        if (fixup) {
+            for (auto& dump : out) fixup(dump);
+        }
+        if (options.eliminateZeroPages) {
+            eliminateZeroPages(out);
+        }
+        return true;
+    }
     
-    std::ofstream file(filepath, std::ios::binary);
-    if (!file.is_open()) {
-        m_lastError = "Failed to open file for writing: " + filepath;
+    // Stream: bölgeleri sınırlı gruplar halinde oku ve hemen yaz; tepe bellek
+    // kullanımı imaj boyutu yerine grup boyutuyla sınırlı kalır
+    uint64_t threads = options.dumpThreads == 0 ? std::thread::hardware_concurrency()
+                                                : options.dumpThreads;
+    uint64_t chunk = options.dumpChunkSize == 0 ? PtraceController::DEFAULT_DUMP_CHUNK_SIZE
+                                                : options.dumpChunkSize;
+    uint64_t batchLimit = std::max<uint64_t>(STREAM_BATCH_BYTES, chunk * std::max<uint64_t>(1, threads));
+    
+    std::vector<MemoryRegion> batch;
+    uint64_t batchBytes = 0;
+    
+    auto flush = [&]() {
+        auto dumps = source.dumpMemoryRegions(batch, options.dumpThreads, options.dumpChunkSize);
+        if (fixup) {
+            for (auto& dump : dumps) fixup(dump);
+        }
+        if (options.eliminateZeroPages) {
+            eliminateZeroPages(dumps);
+        }
+        for (auto& dump : dumps) {
+            if (!sink->writeDump(dump)) {
+                m_lastError = "Failed to write memory dump: " + sink->getLastError();
+                return false;
+            }
+            if (m_bufferPool) {
+                m_bufferPool->recycle(dump);    // Sonraki grup aynı tamponları kullanır
+            }
+        }
+        batch.clear();
+        batchBytes = 0;
+        return true;
+    };
+    
+    for (const auto& region : regions) {
+        // Tek başına sınırı aşan bölgeleri sınır boyutunda parçalara böl
+        for (uint64_t start = region.startAddr; start < region.endAddr; ) {
+            uint64_t len = std::min(region.endAddr - start, batchLimit - batchBytes);
+            MemoryRegion part = region;
+            part.startAddr = start;
+            part.endAddr = start + len;
+            batch.push_back(std::move(part));
+            batchBytes += len;
+            start += len;
+            
+            if (batchBytes >= batchLimit && !flush()) {
+                return false;
+            }
+        }
+    }
+    
+    return batch.empty() || flush();
+}
+
+std::unique_ptr<ICheckpointSink> RealProcessCheckpointer::openFileSink(
+    const std::string& filepath,
+    CheckpointFileFormat format) {
+    
+    if (format == CheckpointFileFormat::INDEXED) {
+        auto writer = std::make_unique<CheckpointImageWriter>();
+        if (!writer->open(filepath, m_ioOptions)) {
+            m_lastError = writer->getLastError();
+            return nullptr;
+        }
+        return writer;
+    }
+    
+    auto writer = std::make_unique<CheckpointStreamWriter>();
+    if (!writer->open(filepath, m_ioOptions)) {
+        m_lastError = writer->getLastError();
+        return nullptr;
+    }
+    return writer;
+}
+
+bool RealProcessCheckpointer::saveCheckpoint(const RealProcessCheckpoint& checkpoint, 
+                                             const std::string& filepath,
+                                             CheckpointFileFormat format) {
+    // Tüm imajı tek vector'de toplamadan dump dump yaz
+    auto sink = openFileSink(filepath, format);
+    if (!sink) {
         return false;
     }
     
-    file.write(reinterpret_cast<const char*>(data.data()), data.size());
-    if (!file.good()) {
-        m_lastError = "Failed to write checkpoint data";
+    bool ok = sink->writeHeader(checkpoint);
+    for (size_t i = 0; ok && i < checkpoint.memoryDumps.size(); ++i) {
+        ok = sink->writeDump(checkpoint.memoryDumps[i]);
+    }
+    ok = ok && sink->finish(checkpoint.signals);
+    
+    if (!ok) {
+        m_lastError = "Failed to write checkpoint data: " + sink->getLastError();
         return false;
     }
     
@@ -788,24 +1900,29 @@ bool RealProcessCheckpointer::saveCheckpoint(const RealProcessCheckpoint& checkp
 std::optional<RealProcessCheckpoint> RealProcessCheckpointer::loadCheckpoint(
     const std::string& filepath) {
     
-    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        m_lastError = "Failed to open file: " + filepath;
-        return std::nullopt;
+    if (MappedCheckpointImage::isIndexedImage(filepath)) {
+        MappedCheckpointImage image;
+        if (!image.open(filepath)) {
+            m_lastError = image.getLastError();
+            return std::nullopt;
+        }
+        return image.materialize();
     }
     
-    size_t size = file.tellg();
-    file.seekg(0);
-    
-    std::vector<uint8_t> data(size);
-    file.read(reinterpret_cast<char*>(data.data()), size);
+    // Dump'lar doğrudan son yerlerine okunur (ara dosya tamponu yok)
+    CheckpointStreamReader reader;
+    if (!reader.open(filepath, m_ioOptions)) {
+        m_lastError = reader.getLastError();
+        return std::nullopt;
+    }
     
-    if (!file.good()) {
-        m_lastError = "Failed to read checkpoint data";
+    auto checkpoint = reader.readAll();
+    if (!checkpoint) {
+        m_lastError = "Failed to read checkpoint data: " + reader.getLastError();
         return std::nullopt;
     }
     
-    return RealProcessCheckpoint::deserialize(data);
+    return checkpoint;
 }
 
 PtraceError RealProcessCheckpointer::restoreCheckpoint(
@@ -829,10 +1946,244 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
     const RealProcessCheckpoint& checkpoint,
     const RestoreOptions& options) {
     
+    for (const auto& dump : checkpoint.memoryDumps) {
+        if (dump.isDeduplicated()) {
+            RestoreResult result;
+            result.errorMessage = "Checkpoint has page references - restore it with its PageStore";
+            return result;
+        }
+    }
+    
+    return restoreImpl(pid, checkpoint, dumpViews(checkpoint), nullptr, options);
+}
+
+RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
+    pid_t pid,
+    const RealProcessCheckpoint& checkpoint,
+    const PageStore& store,
+    const RestoreOptions& options) {
+    
+    return restoreImpl(pid, checkpoint, dumpViews(checkpoint), &store, options);
+}
+
+std::vector<RealProcessCheckpointer::RestoreDumpView> RealProcessCheckpointer::dumpViews(
+    const RealProcessCheckpoint& checkpoint) {
+    
+    std::vector<RestoreDumpView> dumps;
+    dumps.reserve(checkpoint.memoryDumps.size());
+    for (const auto& dump : checkpoint.memoryDumps) {
+        if (!dump.isValid) {
+            dumps.push_back({dump.region, nullptr, 0, false, nullptr});
+        } else if (dump.isDeduplicated()) {
+            dumps.push_back({dump.region, nullptr, 0, false, &dump.pageRefs});
+        } else {
+            dumps.push_back({dump.region, dump.data.data(), dump.data.size(), dump.zeroFill, nullptr});
+        }
+    }
+    return dumps;
+}
+
+RestoreResult RealProcessCheckpointer::restoreFromImage(
+    pid_t pid,
+    const MappedCheckpointImage& image,
+    const RestoreOptions& options) {
+    
+    if (!image.isOpen()) {
+        RestoreResult result;
+        result.success = false;
+        result.errorMessage = "Checkpoint image not open";
+        return result;
+    }
+    
+    std::vector<RestoreDumpView> dumps;
+    dumps.reserve(image.dumpCount());
+    for (size_t i = 0; i < image.dumpCount(); ++i) {
+        auto data = image.dumpData(i);
+        dumps.push_back({image.dumpRegion(i), data.data(), data.size(), image.isZeroFill(i),
+                         nullptr, static_cast<int64_t>(image.dumpOffset(i))});
+    }
+    
+    return restoreImpl(pid, image.metadata(), dumps, nullptr, options, nullptr, &image.path());
+}
+
+RestoreResult RealProcessCheckpointer::restoreLazy(
+    pid_t pid,
+    const RealProcessCheckpoint& checkpoint,
+    std::unique_ptr<LazyRestoreSession>& session,
+    const RestoreOptions& options) {
+    
+    session.reset();
+    for (const auto& dump : checkpoint.memoryDumps) {
+        if (dump.isDeduplicated()) {
+            RestoreResult result;
+            result.errorMessage = "Checkpoint has page references - restore it with its PageStore";
+            return result;
+        }
+    }
+    
+    return restoreImpl(pid, checkpoint, dumpViews(checkpoint), nullptr, options, &session);
+}
+
+RestoreResult RealProcessCheckpointer::restoreLazyFromImage(
+    pid_t pid,
+    const MappedCheckpointImage& image,
+    std::unique_ptr<LazyRestoreSession>& session,
+    const RestoreOptions& options) {
+    
+    session.reset();
+    if (!image.isOpen()) {
+        RestoreResult result;
+        result.success = false;
+        result.errorMessage = "Checkpoint image not open";
+        return result;
+    }
+    
+    std::vector<RestoreDumpView> dumps;
+    dumps.reserve(image.dumpCount());
+    for (size_t i = 0; i < image.dumpCount(); ++i) {
+        auto data = image.dumpData(i);
+        dumps.push_back({image.dumpRegion(i), data.data(), data.size(), image.isZeroFill(i),
+                         nullptr, static_cast<int64_t>(image.dumpOffset(i))});
+    }
+    
+    return restoreImpl(pid, image.metadata(), dumps, nullptr, options, &session, &image.path());
+}
+
+void RealProcessCheckpointer::filterUnchangedPages(
+    PtraceController& ptrace,
+    pid_t pid,
+    const std::vector<RestoreDumpView>& dumps,
+    const std::vector<uint64_t>& targets,
+    bool onlyDirty,
+    std::vector<PtraceController::WriteSegment>& segments,
+    std::vector<size_t>& owners,
+    RestoreResult& result) {
+    
+    constexpr uint64_t PAGE = RealProcessCheckpoint::PAGE_HASH_BYTES;
+    
+    // Segmentleri sayfa parçalarına aç; soft-dirty temiz olanlar okunmaz
+    struct Piece {
+        size_t segment;
+        uint64_t offset;
+        uint64_t length;
+    };
+    std::vector<Piece> pieces;
+    
+    std::map<size_t, std::optional<std::vector<std::pair<uint64_t, uint64_t>>>> dirtyRanges;
+    auto isDirty = [&](size_t d, uint64_t addr) {
+        auto it = dirtyRanges.find(d);
+        if (it == dirtyRanges.end()) {
+            MemoryRegion region = dumps[d].region;
+            region.endAddr = targets[d] + region.size();
+            region.startAddr = targets[d];
+            it = dirtyRanges.emplace(d, m_procReader.getDirtyPageRanges(pid, region)).first;
+        }
+        if (!it->second) return true;   // pagemap okunamadı - hepsini karşılaştır
+        const auto& ranges = *it->second;
+        auto r = std::upper_bound(ranges.begin(), ranges.end(), addr,
+            [](uint64_t a, const std::pair<uint64_t, uint64_t>& range) { return a < range.first; });
+        return r != ranges.begin() && addr < std::prev(r)->second;
+    };
+    
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const auto& seg = segments[i];
+        for (uint64_t off = 0; off < seg.length; ) {
+            uint64_t addr = seg.addr + off;
+            uint64_t len = std::min<uint64_t>(PAGE - addr % PAGE, seg.length - off);
+            if (onlyDirty && !isDirty(owners[i], addr)) {
+                result.pagesClean++;
+            } else {
+                pieces.push_back({i, off, len});
+            }
+            off += len;
+        }
+    }
+    
+    std::vector<PtraceController::WriteSegment> changed;
+    std::vector<size_t> changedOwners;
+    auto emit = [&](const Piece& piece) {
+        const auto& seg = segments[piece.segment];
+        size_t owner = owners[piece.segment];
+        uint64_t addr = seg.addr + piece.offset;
+        const uint8_t* data = seg.data + piece.offset;
+        if (!changed.empty() && changedOwners.back() == owner &&
+            changed.back().addr + changed.back().length == addr &&
+            changed.back().data + changed.back().length == data) {
+            changed.back().length += piece.length;
+        } else {
+            changed.push_back({addr, data, piece.length});
+            changedOwners.push_back(owner);
+        }
+    };
+    
+    // Canlı sayfaları DELTA_BATCH_BYTES'lık gruplar halinde oku ve karşılaştır.
+    // Eşitlik her zaman kaynak veriyle memcmp'tir (hash çakışması sayfayı
+    // yanlışlıkla atlatmasın).
+    std::vector<uint8_t> live;
+    std::vector<PtraceController::ReadSegment> reads;
+    std::vector<PtraceError> readErrors;
+    
+    for (size_t first = 0; first < pieces.size(); ) {
+        size_t last = first;
+        uint64_t bytes = 0;
+        while (last < pieces.size() && (bytes == 0 || bytes + pieces[last].length <= DELTA_BATCH_BYTES)) {
+            bytes += pieces[last].length;
+            ++last;
+        }
+        
+        live.resize(bytes);
+        reads.clear();
+        uint64_t pos = 0;
+        for (size_t k = first; k < last; ++k) {
+            reads.push_back({segments[pieces[k].segment].addr + pieces[k].offset,
+                             live.data() + pos, pieces[k].length});
+            pos += pieces[k].length;
+        }
+        ptrace.readMemorySegments(reads, &readErrors);
+        
+        for (size_t k = first; k < last; ++k) {
+            const auto& piece = pieces[k];
+            const auto& read = reads[k - first];
+            if (readErrors[k - first] != PtraceError::SUCCESS) {
+                emit(piece);    // Okunamayan sayfa yazılmayı dener
+                continue;
+            }
+            
+            const uint8_t* source = segments[piece.segment].data + piece.offset;
+            result.pagesCompared++;
+            if (std::memcmp(read.buffer, source, read.length) == 0) {
+                result.pagesUnchanged++;
+            } else {
+                emit(piece);
+            }
+        }
+        first = last;
+    }
+    
+    segments = std::move(changed);
+    owners = std::move(changedOwners);
+}
+
+RestoreResult RealProcessCheckpointer::restoreImpl(
+    pid_t pid,
+    const RealProcessCheckpoint& checkpoint,
+    const std::vector<RestoreDumpView>& dumps,
+    const PageStore* store,
+    const RestoreOptions& options,
+    std::unique_ptr<LazyRestoreSession>* lazy,
+    const std::string* imagePath) {
+    
     RestoreResult result;
     result.success = false;
     
     reportProgress("Starting restore", 0.0);
+    TraceScope trace("checkpoint.restore", *m_metrics);
+    
+    if (checkpoint.isIncremental) {
+        result.warnings.push_back(
+            "Incremental checkpoint restored without its chain - only dirty pages "
+            "are applied (use restoreCheckpointChain for a full restore)");
+    }
     
     // Verify process exists
     if (!m_procReader.processExists(pid)) {
@@ -840,10 +2191,12 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
         return result;
     }
     
-    // Attach to process
+    // Attach to process - çok thread'li checkpoint'te tüm thread'ler durdurulur
     reportProgress("Attaching to process", 0.05);
+    trace.stage("attach");
     PtraceController ptrace;
-    PtraceError err = ptrace.attach(pid);
+    bool freezeGroup = options.restoreRegisters && !checkpoint.threads.empty();
+    PtraceError err = freezeGroup ? ptrace.freezeThreadGroup(pid) : ptrace.attach(pid);
     if (err != PtraceError::SUCCESS) {
         result.errorMessage = "Failed to attach: " + ptraceErrorToString(err);
         return result;
@@ -852,6 +2205,7 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
     // Validation phase
     if (options.validateBeforeRestore) {
         reportProgress("Validating restore", 0.1);
+        trace.stage("validate");
         
         // Get current memory map
         auto currentMap = m_procReader.getMemoryMaps(pid);
@@ -906,12 +2260,14 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
         result.success = true;
         result.errorMessage = "Dry run completed - no changes applied";
         reportProgress("Dry run complete", 1.0);
+        trace.succeed();
         return result;
     }
     
     // Restore registers
     if (options.restoreRegisters) {
         reportProgress("Restoring registers", 0.2);
+        trace.stage("registers");
         
         LinuxRegisters regsToRestore = checkpoint.registers;
         
@@ -942,25 +2298,63 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
                 result.warnings.push_back("Failed to restore FPU registers");
             }
         }
+        
+        // Diğer thread'ler tid ile eşleştirilir; çıkmış thread yeniden yaratılmaz
+        auto live = ptrace.getFrozenThreads();
+        for (const auto& thread : checkpoint.threads) {
+            if (std::find(live.begin(), live.end(), thread.tid) == live.end()) {
+                result.warnings.push_back("Thread " + std::to_string(thread.tid) +
+                                          " no longer exists - registers not restored");
+                continue;
+            }
+            
+            LinuxRegisters threadRegs = thread.registers;
+            if (result.aslrDetected && options.handleASLR) {
+                threadRegs.rip += result.aslrOffset;
+            }
+            err = ptrace.setThreadRegisters(thread.tid, threadRegs);
+            if (err != PtraceError::SUCCESS) {
+                result.warnings.push_back("Failed to restore registers of thread " +
+                                          std::to_string(thread.tid) + ": " +
+                                          ptraceErrorToString(err));
+                continue;
+            }
+            if (thread.registers.hasFPU &&
+                ptrace.setThreadFPURegisters(thread.tid, thread.registers.fpuState) != PtraceError::SUCCESS) {
+                result.warnings.push_back("Failed to restore FPU registers of thread " +
+                                          std::to_string(thread.tid));
+            }
+            result.registersRestored++;
+        }
     }
     
     // Restore memory
     if (options.restoreMemory) {
         reportProgress("Restoring memory", 0.3);
+        trace.stage("plan");
         
-        int totalRegions = checkpoint.memoryDumps.size();
-        int processedRegions = 0;
-        int skippedReadOnly = 0;
+        // Read-only bölgeler restore edilemez (beklenen durum) - atla,
+        // kalanları ASLR'a göre kaydırıp toplu yaz. Veri kopyalanmaz;
+        // segmentler dump tamponuna (ya da imaj mapping'ine) bakar.
+        // zeroFill dump'ları paylaşılan sıfır bloğundan, pageRefs sayfaları
+        // store'dan yazılır; bir dump birden çok segmente açılabilir.
+        static const std::vector<uint8_t> zeroBlock(DISCARD_MIN_BYTES, 0);
         
-        for (const auto& dump : checkpoint.memoryDumps) {
-            // Skip read-only regions - they can't be restored and that's expected
-            if (!dump.region.writable) {
-                skippedReadOnly++;
-                processedRegions++;
-                reportProgress("Restoring memory", 
-                              0.3 + 0.5 * (double(processedRegions) / totalRegions));
-                continue;
-            }
+        std::vector<PtraceController::WriteSegment> segments;
+        std::vector<size_t> owners;                 // segment -> dump index'i
+        std::vector<size_t> restorable;             // yazılabilir dump'lar
+        std::vector<uint64_t> targets(dumps.size(), 0);
+        std::vector<PtraceError> dumpErrors(dumps.size(), PtraceError::SUCCESS);
+        std::vector<size_t> discards;               // MADV_DONTNEED adayları
+        std::vector<size_t> deferred;               // lazy session'a bırakılanlar
+        std::vector<size_t> mapped;                 // imaj dosyasından eşlenecekler
+        bool mapFromImage = options.mapImagePayloads && imagePath && !imagePath->empty();
+        segments.reserve(dumps.size());
+        
+        for (size_t d = 0; d < dumps.size(); ++d) {
+            const auto& dump = dumps[d];
+            if (!dump.region.writable) continue;
+            restorable.push_back(d);
             
             // Calculate target address (adjust for ASLR if needed)
             uint64_t targetAddr = dump.region.startAddr;
@@ -970,18 +2364,234 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
                     targetAddr += result.aslrOffset;
                 }
             }
+            targets[d] = targetAddr;
             
-            // Create modified dump with adjusted address
-            MemoryDump adjustedDump = dump;
-            adjustedDump.region.startAddr = targetAddr;
-            adjustedDump.region.endAddr = targetAddr + dump.region.size();
+            if (mapFromImage && canMapFromImage(dump)) {
+                mapped.push_back(d);
+                continue;
+            }
             
-            err = ptrace.restoreMemoryRegion(adjustedDump);
-            if (err != PtraceError::SUCCESS) {
+            // Büyük private anonim bölgeler talep üzerine; stack sıcak kümede
+            if (lazy && !dump.pageRefs && dump.region.isPrivate && dump.region.isAnonymous() &&
+                !dump.region.isStack() && dump.region.size() >= options.lazyEagerBytes &&
+                (dump.zeroFill || (dump.data && dump.size == dump.region.size()))) {
+                deferred.push_back(d);
+                continue;
+            }
+            
+            if (dump.pageRefs) {
+                if (!store) {
+                    dumpErrors[d] = PtraceError::INVALID_ARGUMENT;
+                    result.warnings.push_back("Page references without a PageStore at 0x" +
+                                              std::to_string(targetAddr));
+                    continue;
+                }
+                for (size_t p = 0; p < dump.pageRefs->size(); ++p) {
+                    const uint8_t* page = store->page((*dump.pageRefs)[p]);
+                    if (!page) {
+                        dumpErrors[d] = PtraceError::INVALID_ARGUMENT;
+                        break;
+                    }
+                    segments.push_back({targetAddr + p * PageStore::PAGE_BYTES,
+                                        page, PageStore::PAGE_BYTES});
+                    owners.push_back(d);
+                }
+                continue;
+            }
+            
+            if (dump.zeroFill) {
+                uint64_t length = dump.region.size();
+                
+                // Private anonymous sayfalar MADV_DONTNEED sonrası sıfır okunur;
+                // hepsi aşağıda tek batch'te, başarısızlıkta sıfır yazılır
+                if (options.discardZeroPages && length >= DISCARD_MIN_BYTES &&
+                    dump.region.isPrivate && dump.region.isAnonymous()) {
+                    discards.push_back(d);
+                    continue;
+                }
+                
+                for (uint64_t off = 0; off < length; off += zeroBlock.size()) {
+                    segments.push_back({targetAddr + off, zeroBlock.data(),
+                                        std::min<uint64_t>(zeroBlock.size(), length - off)});
+                    owners.push_back(d);
+                }
+                continue;
+            }
+            
+            segments.push_back({targetAddr, dump.data, dump.size});
+            owners.push_back(d);
+        }
+        
+        if (!mapped.empty()) {
+            reportProgress("Mapping image payloads", 0.4);
+            trace.stage("map_image");
+            
+            // Tek batch: imajı target'ta aç, payload'ları eski adreslerin
+            // üzerine eşle, fd'yi kapat. mmap'ler fd'yi open'ın sonucundan
+            // alır; open başarısızsa hepsi EBADF ile döner.
+            MemoryManager mapper;
+            SyscallBatch batch;
+            SyscallBatchResult done;
+            bool ran = false;
+            if (mapper.bindProcess(pid) == MemoryError::SUCCESS) {
+                size_t open = batch.addOpen(*imagePath, O_RDONLY | O_CLOEXEC);
+                for (size_t d : mapped) {
+                    const auto& region = dumps[d].region;
+                    int prot = (region.readable ? PROT_READ : 0) |
+                               (region.writable ? PROT_WRITE : 0) |
+                               (region.executable ? PROT_EXEC : 0);
+                    size_t cmd = batch.addMmap(targets[d], region.size(), prot,
+                                               MAP_PRIVATE | MAP_FIXED, -1,
+                                               static_cast<off_t>(dumps[d].fileOffset));
+                    batch.useResult(cmd, 4, open);
+                }
+                batch.useResult(batch.addClose(-1), 0, open);
+                ran = mapper.executeBatch(batch, done);
+                mapper.unbindProcess();
+            }
+            
+            if (ran && !done.succeeded(0)) {
+                result.warnings.push_back("Target could not open checkpoint image " + *imagePath +
+                                          " - writing mapped regions instead");
+            }
+            
+            // Eşlenemeyen bölgeler normal yoldan yazılır
+            for (size_t i = 0; i < mapped.size(); ++i) {
+                size_t d = mapped[i];
+                if (ran && done.succeeded(i + 1) &&
+                    static_cast<uint64_t>(done.results[i + 1]) == targets[d]) {
+                    result.bytesMapped += dumps[d].region.size();
+                    continue;
+                }
+                segments.push_back({targets[d], dumps[d].data, dumps[d].size});
+                owners.push_back(d);
+            }
+        }
+        
+        if (!discards.empty()) {
+            trace.stage("discard");
+            MemoryManager discarder;
+            discarder.bindProcess(pid);
+            SyscallBatch batch;
+            for (size_t d : discards) {
+                batch.addMadvise(targets[d], dumps[d].region.size(), MADV_DONTNEED);
+            }
+            SyscallBatchResult discarded;
+            discarder.executeBatch(batch, discarded);
+            
+            for (size_t i = 0; i < discards.size(); ++i) {
+                if (discarded.results[i] == 0) continue;
+                size_t d = discards[i];
+                uint64_t length = dumps[d].region.size();
+                for (uint64_t off = 0; off < length; off += zeroBlock.size()) {
+                    segments.push_back({targets[d] + off, zeroBlock.data(),
+                                        std::min<uint64_t>(zeroBlock.size(), length - off)});
+                    owners.push_back(d);
+                }
+            }
+        }
+        
+        if (!deferred.empty()) {
+            reportProgress("Registering lazy regions", 0.45);
+            trace.stage("lazy_setup");
+            
+            std::vector<LazyRestoreSession::Range> ranges;
+            for (size_t d : deferred) {
+                ranges.push_back({targets[d], dumps[d].zeroFill ? nullptr : dumps[d].data,
+                                  dumps[d].region.size()});
+            }
+            
+            // Kaydedilemeyen aralıklar hemen yazılır
+            std::vector<LazyRestoreSession::Range> failed;
+            std::string lazyError;
+            *lazy = LazyRestoreSession::setup(pid, ranges, options.lazyPrefetch, failed, lazyError);
+            if (!*lazy) {
+                result.warnings.push_back("Lazy restore unavailable (" + lazyError +
+                                          ") - writing all regions now");
+            }
+            for (const auto& range : failed) {
+                size_t d = *std::find_if(deferred.begin(), deferred.end(),
+                                         [&](size_t c) { return targets[c] == range.addr; });
+                if (range.data) {
+                    segments.push_back({range.addr, range.data, range.length});
+                    owners.push_back(d);
+                    continue;
+                }
+                for (uint64_t off = 0; off < range.length; off += zeroBlock.size()) {
+                    segments.push_back({range.addr + off, zeroBlock.data(),
+                                        std::min<uint64_t>(zeroBlock.size(), range.length - off)});
+                    owners.push_back(d);
+                }
+            }
+            
+            // Eager yazma lazy aralıklara dokunmaz; fault'lar zaten servis ediliyor
+            if (*lazy) {
+                result.bytesDeferred = (*lazy)->getLazyBytes();
+            }
+        }
+        
+        // Delta restore birkaç sayfa yazar; tüm bölgeyi fault etmek kazancı siler
+        if (options.restoreHugePages && !options.deltaRestore) {
+            std::vector<std::pair<uint64_t, uint64_t>> hugeRanges;
+            std::vector<bool> seen(dumps.size(), false);
+            for (size_t d : owners) {
+                const auto& region = dumps[d].region;
+                if (seen[d] || !region.hugePages || !region.writable) continue;
+                seen[d] = true;
+                hugeRanges.emplace_back(targets[d], region.size());
+            }
+            
+            if (!hugeRanges.empty()) {
+                reportProgress("Pre-faulting huge pages", 0.45);
+                trace.stage("huge_pages");
+                MemoryManager prefaulter;
+                if (prefaulter.bindProcess(pid) == MemoryError::SUCCESS) {
+                    result.bytesPrefaulted = prefaulter.prepareHugePages(hugeRanges);
+                    prefaulter.unbindProcess();
+                }
+                trace.count("bytes_prefaulted", result.bytesPrefaulted);
+            }
+        }
+        
+        if (options.deltaRestore) {
+            reportProgress("Comparing live memory", 0.5);
+            trace.stage("compare");
+            
+            // Temiz sayfalara ancak soft-dirty son olarak bu checkpoint'in
+            // delta restore'undan sonra temizlendiyse güvenilir
+            bool onlyDirty = false;
+            auto baseline = m_deltaBaselines.find(pid);
+            if (options.deltaUseSoftDirty && baseline != m_deltaBaselines.end()) {
+                auto info = m_procReader.getProcessInfo(pid);
+                onlyDirty = info && baseline->second.checkpointId == checkpoint.checkpointId &&
+                            baseline->second.startTime == info->startTime;
+            }
+            filterUnchangedPages(ptrace, pid, dumps, targets, onlyDirty, segments, owners, result);
+        }
+        
+        for (const auto& seg : segments) {
+            result.bytesWritten += seg.length;
+        }
+        
+        trace.stage("write");
+        std::vector<PtraceError> errors;
+        ptrace.writeMemorySegments(segments, &errors);
+        reportProgress("Restoring memory", 0.8);
+        trace.endStage();
+        
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (errors[i] != PtraceError::SUCCESS && dumpErrors[owners[i]] == PtraceError::SUCCESS) {
+                dumpErrors[owners[i]] = errors[i];
+            }
+        }
+        
+        for (size_t d : restorable) {
+            if (dumpErrors[d] != PtraceError::SUCCESS) {
                 result.memoryRegionsFailed++;
                 result.warnings.push_back(
                     "Failed to restore memory region at 0x" + 
-                    std::to_string(targetAddr) + ": " + ptraceErrorToString(err));
+                    std::to_string(targets[d]) + ": " +
+                    ptraceErrorToString(dumpErrors[d]));
                 
                 if (options.stopOnError && !options.ignoreMemoryErrors) {
                     result.errorMessage = "Memory restore failed";
@@ -990,16 +2600,38 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
             } else {
                 result.memoryRegionsRestored++;
             }
+        }
+        
+        // Hatasız delta restore sonrası bellek checkpoint'e eşit: soft-dirty
+        // temizlenirse bir sonraki delta restore temiz sayfaları okumaz.
+        // Yazma bitleri kaldırmıyorsa (soft-dirty yok) baseline tutulmaz.
+        if (options.deltaRestore && options.deltaUseSoftDirty &&
+            result.memoryRegionsFailed == 0 && result.bytesDeferred == 0 &&
+            result.bytesMapped == 0) {
+            bool tracked = true;
+            if (!segments.empty()) {
+                MemoryRegion probe;
+                probe.startAddr = segments.front().addr & ~(RealProcessCheckpoint::PAGE_HASH_BYTES - 1);
+                probe.endAddr = probe.startAddr + RealProcessCheckpoint::PAGE_HASH_BYTES;
+                auto dirty = m_procReader.getDirtyPageRanges(pid, probe);
+                tracked = dirty && !dirty->empty();
+            }
             
-            processedRegions++;
-            reportProgress("Restoring memory", 
-                          0.3 + 0.5 * (double(processedRegions) / totalRegions));
+            auto info = m_procReader.getProcessInfo(pid);
+            if (!segments.empty() && tracked && info && m_procReader.clearSoftDirty(pid)) {
+                m_deltaBaselines[pid] = {checkpoint.checkpointId, info->startTime};
+            } else if (!segments.empty()) {
+                m_deltaBaselines.erase(pid);
+            }
+        } else {
+            m_deltaBaselines.erase(pid);
         }
     }
     
     // Restore file descriptors
     if (options.restoreFileDescriptors && !checkpoint.fileDescriptors.empty()) {
         reportProgress("Restoring file descriptors", 0.85);
+        trace.stage("fds");
         
         // Note: FD restoration requires the FDRestorer class
         // This is a simplified implementation
@@ -1014,6 +2646,7 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
     // If continueAfterRestore is true, process will continue running
     // If false, process will remain stopped (requires manual handling)
     reportProgress("Releasing process", 0.95);
+    trace.stage("detach");
     
     if (options.continueAfterRestore) {
         // Detach will automatically continue the process
@@ -1024,8 +2657,13 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
         }
     } else {
         // User wants process to stay stopped - first stop it, then detach
-        // After detach with SIGSTOP, process will be stopped but not traced
-        ptrace.stop();
+        // After detach with SIGSTOP, process will be stopped but not traced.
+        // Seize edilmiş grupta SIGSTOP bekler; detach sonrası grup durur.
+        if (ptrace.isGroupFrozen()) {
+            kill(pid, SIGSTOP);
+        } else {
+            ptrace.stop();
+        }
         err = ptrace.detach();
         if (err != PtraceError::SUCCESS) {
             result.warnings.push_back("Failed to detach from process: " + 
@@ -1033,6 +2671,12 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
         }
     }
     
+    countIo(trace, ptrace.getIoStats());
+    trace.count("bytes_written", result.bytesWritten);
+    if (result.bytesMapped) trace.count("bytes_mapped", result.bytesMapped);
+    if (result.bytesDeferred) trace.count("bytes_deferred", result.bytesDeferred);
+    trace.count("regions_restored", result.memoryRegionsRestored);
+    
     // Success if we got here
     result.success = (result.memoryRegionsFailed == 0 || options.ignoreMemoryErrors);
     
@@ -1041,10 +2685,139 @@ RestoreResult RealProcessCheckpointer::restoreCheckpointEx(
                               std::to_string(result.memoryRegionsFailed) + " failed regions";
     }
     
+    if (result.success) {
+        trace.succeed();
+    }
+    
     reportProgress("Restore complete", 1.0);
     return result;
 }
 
+bool RealProcessCheckpointer::canMapFromImage(const RestoreDumpView& dump) {
+    // Paylaşımlı ya da dosya destekli bölgeler eşlenirse anlamı değişir;
+    // stack ve heap'in etiketi ve büyüme davranışı korunmalı
+    return dump.fileOffset >= 0 && !dump.zeroFill && !dump.pageRefs && dump.data &&
+           dump.region.writable && dump.region.isPrivate && dump.region.isAnonymous() &&
+           !dump.region.isStack() && !dump.region.isHeap() &&
+           dump.size == dump.region.size() &&
+           dump.fileOffset % CheckpointImageWriter::PAYLOAD_ALIGNMENT == 0 &&
+           dump.region.startAddr % CheckpointImageWriter::PAYLOAD_ALIGNMENT == 0;
+}
+
+std::optional<RealProcessCheckpoint> RealProcessCheckpointer::mergeCheckpointChain(
+    const std::vector<RealProcessCheckpoint>& chain) {
+    
+    if (chain.empty()) {
+        m_lastError = "Empty checkpoint chain";
+        return std::nullopt;
+    }
+    
+    if (chain.front().isIncremental) {
+        m_lastError = "Checkpoint chain must start with a full checkpoint";
+        return std::nullopt;
+    }
+    
+    for (const auto& checkpoint : chain) {
+        for (const auto& dump : checkpoint.memoryDumps) {
+            if (dump.isDeduplicated()) {
+                m_lastError = "Checkpoint chain has page references - rehydrate it before merging";
+                return std::nullopt;
+            }
+        }
+    }
+    
+    for (size_t i = 1; i < chain.size(); ++i) {
+        if (chain[i].parentCheckpointId != chain[i - 1].checkpointId) {
+            m_lastError = "Broken checkpoint chain at index " + std::to_string(i) +
+                          ": parent " + std::to_string(chain[i].parentCheckpointId) +
+                          " != " + std::to_string(chain[i - 1].checkpointId);
+            return std::nullopt;
+        }
+    }
+    
+    // Metadata, register'lar ve memory map en yeni checkpoint'ten gelir
+    RealProcessCheckpoint merged = chain.back();
+    merged.parentCheckpointId = 0;
+    merged.isIncremental = false;
+    merged.memoryDumps = chain.front().memoryDumps;
+    
+    // startAddr -> merged.memoryDumps index
+    std::map<uint64_t, size_t> dumpIndex;
+    for (size_t i = 0; i < merged.memoryDumps.size(); ++i) {
+        dumpIndex[merged.memoryDumps[i].region.startAddr] = i;
+    }
+    
+    for (size_t c = 1; c < chain.size(); ++c) {
+        for (const auto& run : chain[c].memoryDumps) {
+            // Sayfa aralığını içeren dump'ı bul
+            auto it = dumpIndex.upper_bound(run.region.startAddr);
+            if (it != dumpIndex.begin()) {
+                --it;
+                MemoryDump& target = merged.memoryDumps[it->second];
+                uint64_t runSize = run.zeroFill ? run.region.size() : run.data.size();
+                uint64_t targetSize = target.zeroFill ? target.region.size() : target.data.size();
+                if (run.region.startAddr >= target.region.startAddr &&
+                    run.region.startAddr + runSize <= target.region.startAddr + targetSize) {
+                    if (target.zeroFill) {
+                        if (run.zeroFill) continue;
+                        // Sıfır aralığına veri düştü - hedefi açık sıfırlara çevir
+                        target.data.assign(targetSize, 0);
+                        target.zeroFill = false;
+                    }
+                    target.pageHashes.clear();
+                    target.hashTree.clear();
+                    uint8_t* dst = target.data.data() + (run.region.startAddr - target.region.startAddr);
+                    if (run.zeroFill) {
+                        std::memset(dst, 0, runSize);
+                    } else {
+                        std::memcpy(dst, run.data.data(), runSize);
+                    }
+                    continue;
+                }
+            }
+            
+            // Base'de karşılığı yok (yeni region) - ayrı dump olarak ekle
+            dumpIndex[run.region.startAddr] = merged.memoryDumps.size();
+            merged.memoryDumps.push_back(run);
+        }
+    }
+    
+    // Son memory map'te artık bulunmayan bölgelere ait dump'ları at
+    std::vector<MemoryDump> live;
+    live.reserve(merged.memoryDumps.size());
+    for (auto& dump : merged.memoryDumps) {
+        bool mapped = false;
+        for (const auto& region : merged.memoryMap) {
+            if (dump.region.startAddr >= region.startAddr &&
+                dump.region.endAddr <= region.endAddr) {
+                mapped = true;
+                break;
+            }
+        }
+        if (mapped) {
+            live.push_back(std::move(dump));
+        }
+    }
+    merged.memoryDumps = std::move(live);
+    
+    return merged;
+}
+
+RestoreResult RealProcessCheckpointer::restoreCheckpointChain(
+    pid_t pid,
+    const std::vector<RealProcessCheckpoint>& chain,
+    const RestoreOptions& options) {
+    
+    auto merged = mergeCheckpointChain(chain);
+    if (!merged) {
+        RestoreResult result;
+        result.errorMessage = m_lastError;
+        return result;
+    }
+    
+    return restoreCheckpointEx(pid, *merged, options);
+}
+
 RestoreResult RealProcessCheckpointer::validateRestore(
     pid_t pid,
     const RealProcessCheckpoint& checkpoint) {
@@ -1053,6 +2826,176 @@ RestoreResult RealProcessCheckpointer::validateRestore(
     return restoreCheckpointEx(pid, checkpoint, options);
 }
 
+// Dump içeriğine sayfa erişimi (zeroFill sıfır okunur) ve ağaç düğümleri.
+// Hash'i olmayan dump'ta ağaç kurulmaz: iki tarafı hash'lemek sayfaları
+// doğrudan karşılaştırmaktan pahalıdır.
+namespace {
+
+struct DiffSide {
+    const MemoryDump& dump;
+    const std::vector<uint64_t>* leaves = nullptr;
+    const std::vector<uint64_t>* tree = nullptr;
+    std::vector<uint64_t> levelStart;       // levelStart[l]: seviye l'nin tree offset'i (l >= 1)
+    std::vector<uint64_t> levelSize;
+    
+    explicit DiffSide(const MemoryDump& d) : dump(d) {
+        constexpr uint64_t PAGE = RealProcessCheckpoint::PAGE_HASH_BYTES;
+        if (dump.zeroFill || dump.isDeduplicated() || dump.data.empty()) return;
+        
+        uint64_t pages = (dump.data.size() + PAGE - 1) / PAGE;
+        if (dump.pageHashes.size() != pages || dump.hashTree.size() != treeNodes(pages)) return;
+        leaves = &dump.pageHashes;
+        tree = &dump.hashTree;
+        
+        levelStart = {0};
+        levelSize = {pages};
+        uint64_t offset = 0;
+        while (levelSize.back() > 1) {
+            uint64_t n = (levelSize.back() + RealProcessCheckpoint::HASH_TREE_FANOUT - 1) /
+                         RealProcessCheckpoint::HASH_TREE_FANOUT;
+            levelStart.push_back(offset);
+            levelSize.push_back(n);
+            offset += n;
+        }
+    }
+    
+    static uint64_t treeNodes(uint64_t pages) {
+        uint64_t total = 0;
+        while (pages > 1) {
+            pages = (pages + RealProcessCheckpoint::HASH_TREE_FANOUT - 1) /
+                    RealProcessCheckpoint::HASH_TREE_FANOUT;
+            total += pages;
+        }
+        return total;
+    }
+    
+    bool hashed() const { return leaves != nullptr; }
+    size_t levels() const { return levelSize.size(); }
+    
+    uint64_t node(size_t level, uint64_t index) const {
+        return level == 0 ? (*leaves)[index] : (*tree)[levelStart[level] + index];
+    }
+    
+    // Bölge içi offset'teki byte'lar (dump verisinin dışı: nullptr)
+    const uint8_t* bytes(uint64_t offset, uint64_t& available) const {
+        static const std::vector<uint8_t> zeros(RealProcessCheckpoint::PAGE_HASH_BYTES, 0);
+        if (dump.zeroFill) {
+            available = std::min<uint64_t>(zeros.size(), dump.region.size() - offset);
+            return zeros.data();
+        }
+        if (offset >= dump.data.size()) {
+            available = 0;
+            return nullptr;
+        }
+        available = dump.data.size() - offset;
+        return dump.data.data() + offset;
+    }
+};
+
+void addChangedRange(RealProcessCheckpointer::CheckpointDiff& diff, uint64_t addr, uint64_t length) {
+    if (length == 0) return;
+    auto& ranges = diff.changedRanges;
+    if (!ranges.empty() && ranges.back().addr + ranges.back().length == addr) {
+        ranges.back().length += length;
+    } else {
+        ranges.push_back({addr, length});
+    }
+}
+
+// Aynı adresten başlayan iki dump'ın farkı. İki taraf da hash'liyse
+// ağaç kökten inilir ve eşit düğümlerin altı atlanır; kalan sayfalar byte
+// byte karşılaştırılıp değişen aralıklar eklenir. Bölge boyu değiştiyse
+// fazlası değişmiş sayılır.
+void diffDumps(const MemoryDump& a, const MemoryDump& b,
+               RealProcessCheckpointer::CheckpointDiff& diff) {
+    constexpr uint64_t PAGE = RealProcessCheckpoint::PAGE_HASH_BYTES;
+    constexpr uint64_t FANOUT = RealProcessCheckpoint::HASH_TREE_FANOUT;
+    const uint64_t base = a.region.startAddr;
+    const uint64_t common = std::min(a.region.size(), b.region.size());
+    const uint64_t commonPages = (common + PAGE - 1) / PAGE;
+    
+    if (a.isDeduplicated() || b.isDeduplicated()) {
+        // PageStore olmadan içerik bilinmez: aynı id'li sayfalar eşittir
+        for (uint64_t p = 0; p < commonPages; ++p) {
+            bool same = a.isDeduplicated() && b.isDeduplicated() &&
+                        p < a.pageRefs.size() && p < b.pageRefs.size() &&
+                        a.pageRefs[p] == b.pageRefs[p];
+            if (!same) {
+                addChangedRange(diff, base + p * PAGE, std::min(PAGE, common - p * PAGE));
+            }
+        }
+    } else if (!(a.zeroFill && b.zeroFill)) {
+        DiffSide sa(a), sb(b);
+        
+        auto comparePage = [&](uint64_t p) {
+            uint64_t off = p * PAGE;
+            uint64_t len = std::min(PAGE, common - off);
+            uint64_t availA = 0, availB = 0;
+            const uint8_t* x = sa.bytes(off, availA);
+            const uint8_t* y = sb.bytes(off, availB);
+            uint64_t n = std::min({len, availA, availB});
+            diff.pagesCompared++;
+            
+            if (n == len && std::memcmp(x, y, len) == 0) return;
+            for (uint64_t k = 0; k < n;) {
+                if (x[k] == y[k]) {
+                    ++k;
+                    continue;
+                }
+                uint64_t start = k;
+                while (k < n && x[k] != y[k]) ++k;
+                addChangedRange(diff, base + off + start, k - start);
+            }
+            addChangedRange(diff, base + off + n, len - n);    // Bir tarafta veri yok
+        };
+        
+        if (sa.hashed() && sb.hashed()) {
+            // Düğüm ancak kapsadığı sayfalar iki dump'ta da tam ise
+            // karşılaştırılabilir (son eksik sayfa boyları farklı olabilir)
+            bool sameShape = a.data.size() == b.data.size();
+            uint64_t fullPages = std::min(a.data.size(), b.data.size()) / PAGE;
+            size_t top = std::min(sa.levels(), sb.levels()) - 1;
+            
+            std::vector<uint64_t> spans(top + 1, 1);
+            for (size_t l = 1; l <= top; ++l) spans[l] = spans[l - 1] * FANOUT;
+            
+            // Adres sırasıyla in: yığına ters sırada it
+            std::vector<std::pair<size_t, uint64_t>> stack;
+            for (uint64_t i = (commonPages + spans[top] - 1) / spans[top]; i-- > 0;) {
+                stack.push_back({top, i});
+            }
+            while (!stack.empty()) {
+                auto [level, index] = stack.back();
+                stack.pop_back();
+                uint64_t first = index * spans[level];
+                if (first >= commonPages) continue;
+                
+                uint64_t end = first + spans[level];
+                bool comparable = index < sa.levelSize[level] && index < sb.levelSize[level] &&
+                                  (sameShape || end <= fullPages);
+                if (comparable && sa.node(level, index) == sb.node(level, index)) continue;
+                
+                if (level == 0) {
+                    comparePage(index);
+                    continue;
+                }
+                for (uint64_t c = FANOUT; c-- > 0;) {
+                    stack.push_back({level - 1, index * FANOUT + c});
+                }
+            }
+        } else {
+            for (uint64_t p = 0; p < commonPages; ++p) {
+                comparePage(p);
+            }
+        }
+    }
+    
+    uint64_t longer = std::max(a.region.size(), b.region.size());
+    addChangedRange(diff, base + common, longer - common);
+}
+
+} // anonymous namespace
+
 RealProcessCheckpointer::CheckpointDiff RealProcessCheckpointer::compareCheckpoints(
     const RealProcessCheckpoint& cp1,
     const RealProcessCheckpoint& cp2) {
@@ -1075,19 +3018,49 @@ RealProcessCheckpointer::CheckpointDiff RealProcessCheckpointer::compareCheckpoi
         // ... more registers
     }
     
-    // Compare memory - simplified
-    if (cp1.memoryDumps.size() != cp2.memoryDumps.size()) {
-        diff.memoryChanged = true;
-    } else {
-        for (size_t i = 0; i < cp1.memoryDumps.size(); ++i) {
-            if (cp1.memoryDumps[i].data != cp2.memoryDumps[i].data) {
-                diff.memoryChanged = true;
-                diff.modifiedRegions.push_back(cp1.memoryDumps[i].region);
-                diff.totalBytesChanged += cp1.memoryDumps[i].data.size();
+    // Compare memory - dump'lar başlangıç adresiyle eşleşir
+    auto byAddress = [](const RealProcessCheckpoint& cp) {
+        std::vector<const MemoryDump*> dumps;
+        for (const auto& dump : cp.memoryDumps) {
+            if (dump.isValid) dumps.push_back(&dump);
+        }
+        std::sort(dumps.begin(), dumps.end(), [](const MemoryDump* a, const MemoryDump* b) {
+            return a->region.startAddr < b->region.startAddr;
+        });
+        return dumps;
+    };
+    auto dumps1 = byAddress(cp1);
+    auto dumps2 = byAddress(cp2);
+    
+    size_t i = 0, j = 0;
+    while (i < dumps1.size() || j < dumps2.size()) {
+        if (j == dumps2.size() ||
+            (i < dumps1.size() && dumps1[i]->region.startAddr < dumps2[j]->region.startAddr)) {
+            diff.removedRegions.push_back(dumps1[i]->region);
+            diff.totalBytesChanged += dumps1[i]->region.size();
+            ++i;
+        } else if (i == dumps1.size() ||
+                   dumps2[j]->region.startAddr < dumps1[i]->region.startAddr) {
+            diff.addedRegions.push_back(dumps2[j]->region);
+            diff.totalBytesChanged += dumps2[j]->region.size();
+            ++j;
+        } else {
+            size_t before = diff.changedRanges.size();
+            diffDumps(*dumps1[i], *dumps2[j], diff);
+            if (diff.changedRanges.size() != before) {
+                diff.modifiedRegions.push_back(dumps2[j]->region);
             }
+            ++i;
+            ++j;
         }
     }
     
+    for (const auto& range : diff.changedRanges) {
+        diff.totalBytesChanged += range.length;
+    }
+    diff.memoryChanged = !diff.addedRegions.empty() || !diff.removedRegions.empty() ||
+                         !diff.changedRanges.empty();
+    
     // Compare file descriptors
     if (cp1.fileDescriptors.size() != cp2.fileDescriptors.size()) {
         diff.filesChanged = true;
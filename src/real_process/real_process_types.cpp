@@ -1,7 +1,10 @@
 #include "real_process/real_process_types.hpp"
+#include "core/checksum.hpp"
+#include "core/binary_io.hpp"
 #include <sstream>
 #include <cstring>
 #include <chrono>
+#include <algorithm>
 
 namespace checkpoint {
 namespace real_process {
@@ -40,246 +43,257 @@ LinuxProcessState charToLinuxState(char c) {
 // RealProcessCheckpoint serialization
 // ============================================================================
 
-std::vector<uint8_t> RealProcessCheckpoint::serialize() const {
+namespace {
+
+// Ham register bloğu (vector hariç) + FPU (flag, boyut, veri)
+constexpr size_t RAW_REGISTERS_SIZE = sizeof(LinuxRegisters) - sizeof(std::vector<uint8_t>);
+
+void writeRegisters(BinaryWriter& writer, const LinuxRegisters& registers) {
+    writer.writeBytes(&registers, RAW_REGISTERS_SIZE);
+    writer.writeBool(registers.hasFPU);
+    if (registers.hasFPU) {
+        writer.write(static_cast<uint32_t>(registers.fpuState.size()));
+        writer.writeBytes(registers.fpuState.data(), registers.fpuState.size());
+    }
+}
+
+bool readRegisters(BinaryReader& reader, LinuxRegisters& registers) {
+    if (!reader.readBytesInto(&registers, RAW_REGISTERS_SIZE)) return false;
+    // Ham blok vector'ün önünde biter; fpuState'e dokunulmaz
+    registers.hasFPU = reader.readBool();
+    if (registers.hasFPU) {
+        auto fpu = reader.readBytes(reader.read<uint32_t>());
+        registers.fpuState.assign(fpu.begin(), fpu.end());
+    }
+    return reader.ok();
+}
+
+uint8_t regionFlags(const MemoryRegion& region) {
+    return (region.readable ? 1 : 0) |
+           (region.writable ? 2 : 0) |
+           (region.executable ? 4 : 0) |
+           (region.isPrivate ? 8 : 0) |
+           (region.hugePages ? RealProcessCheckpoint::REGION_FLAG_HUGE_PAGES : 0);
+}
+
+} // namespace
+
+std::vector<uint8_t> RealProcessCheckpoint::serializeHeader(uint32_t dumpCount,
+                                                            uint32_t version) const {
     std::vector<uint8_t> data;
+    BinaryWriter writer(data);
     
     // Magic number: "RCHK" (Real Checkpoint)
-    data.push_back('R');
-    data.push_back('C');
-    data.push_back('H');
-    data.push_back('K');
+    writer.writeBytes("RCHK", 4);
     
     // Version
-    uint32_t version = 1;
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&version),
-                reinterpret_cast<uint8_t*>(&version) + sizeof(version));
+    writer.write(version);
     
-    // Checkpoint ID
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&checkpointId),
-                reinterpret_cast<const uint8_t*>(&checkpointId) + sizeof(checkpointId));
+    // Checkpoint ID, timestamp
+    writer.write(checkpointId);
+    writer.write(timestamp);
     
-    // Timestamp
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&timestamp),
-                reinterpret_cast<const uint8_t*>(&timestamp) + sizeof(timestamp));
+    // Parent checkpoint (incremental zincir)
+    writer.write(parentCheckpointId);
+    writer.writeBool(isIncremental);
     
     // Name (length + data)
-    uint32_t nameLen = static_cast<uint32_t>(name.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&nameLen),
-                reinterpret_cast<uint8_t*>(&nameLen) + sizeof(nameLen));
-    data.insert(data.end(), name.begin(), name.end());
+    writer.writeString(name);
     
     // Process Info
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&info.pid),
-                reinterpret_cast<const uint8_t*>(&info.pid) + sizeof(info.pid));
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&info.ppid),
-                reinterpret_cast<const uint8_t*>(&info.ppid) + sizeof(info.ppid));
-    
-    // Process name
-    uint32_t procNameLen = static_cast<uint32_t>(info.name.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&procNameLen),
-                reinterpret_cast<uint8_t*>(&procNameLen) + sizeof(procNameLen));
-    data.insert(data.end(), info.name.begin(), info.name.end());
-    
-    // Cmdline
-    uint32_t cmdlineLen = static_cast<uint32_t>(info.cmdline.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&cmdlineLen),
-                reinterpret_cast<uint8_t*>(&cmdlineLen) + sizeof(cmdlineLen));
-    data.insert(data.end(), info.cmdline.begin(), info.cmdline.end());
-    
-    // Registers (raw dump)
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&registers),
-                reinterpret_cast<const uint8_t*>(&registers) + sizeof(LinuxRegisters) - sizeof(std::vector<uint8_t>));
-    
-    // FPU state
-    uint8_t hasFPU = registers.hasFPU ? 1 : 0;
-    data.push_back(hasFPU);
-    if (registers.hasFPU) {
-        uint32_t fpuSize = static_cast<uint32_t>(registers.fpuState.size());
-        data.insert(data.end(), reinterpret_cast<uint8_t*>(&fpuSize),
-                    reinterpret_cast<uint8_t*>(&fpuSize) + sizeof(fpuSize));
-        data.insert(data.end(), registers.fpuState.begin(), registers.fpuState.end());
+    writer.write(info.pid);
+    writer.write(info.ppid);
+    writer.writeString(info.name);
+    writer.writeString(info.cmdline);
+    
+    // Registers (raw dump) + FPU state
+    writeRegisters(writer, registers);
+    
+    // Diğer thread'ler (v6+)
+    if (version >= 6) {
+        writer.write(static_cast<uint32_t>(threads.size()));
+        for (const auto& thread : threads) {
+            writer.write(static_cast<int32_t>(thread.tid));
+            writeRegisters(writer, thread.registers);
+        }
     }
     
-    // Memory regions count
-    uint32_t regionCount = static_cast<uint32_t>(memoryMap.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&regionCount),
-                reinterpret_cast<uint8_t*>(&regionCount) + sizeof(regionCount));
-    
-    // Each memory region
+    // Memory regions
+    writer.write(static_cast<uint32_t>(memoryMap.size()));
     for (const auto& region : memoryMap) {
-        data.insert(data.end(), reinterpret_cast<const uint8_t*>(&region.startAddr),
-                    reinterpret_cast<const uint8_t*>(&region.startAddr) + sizeof(region.startAddr));
-        data.insert(data.end(), reinterpret_cast<const uint8_t*>(&region.endAddr),
-                    reinterpret_cast<const uint8_t*>(&region.endAddr) + sizeof(region.endAddr));
-        
-        uint8_t flags = (region.readable ? 1 : 0) | 
-                       (region.writable ? 2 : 0) |
-                       (region.executable ? 4 : 0) |
-                       (region.isPrivate ? 8 : 0);
-        data.push_back(flags);
-        
-        uint32_t pathLen = static_cast<uint32_t>(region.pathname.size());
-        data.insert(data.end(), reinterpret_cast<uint8_t*>(&pathLen),
-                    reinterpret_cast<uint8_t*>(&pathLen) + sizeof(pathLen));
-        data.insert(data.end(), region.pathname.begin(), region.pathname.end());
+        writer.write(region.startAddr);
+        writer.write(region.endAddr);
+        writer.writeU8(regionFlags(region));
+        writer.writeString(region.pathname);
     }
     
-    // Memory dumps count
-    uint32_t dumpCount = static_cast<uint32_t>(memoryDumps.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&dumpCount),
-                reinterpret_cast<uint8_t*>(&dumpCount) + sizeof(dumpCount));
+    // Memory dumps count (STREAMED_DUMP_COUNT: end kaydına kadar oku)
+    writer.write(dumpCount);
     
-    // Each memory dump
+    return data;
+}
+
+uint8_t RealProcessCheckpoint::dumpFlags(const MemoryDump& dump) {
+    uint8_t flags = regionFlags(dump.region);
+    if (dump.zeroFill) flags |= DUMP_FLAG_ZERO_FILL;
+    if (dump.isDeduplicated()) flags |= DUMP_FLAG_PAGE_REFS;
+    return flags;
+}
+
+void RealProcessCheckpoint::applyDumpFlags(MemoryDump& dump, uint8_t flags) {
+    dump.region.readable = (flags & 1) != 0;
+    dump.region.writable = (flags & 2) != 0;
+    dump.region.executable = (flags & 4) != 0;
+    dump.region.isPrivate = (flags & 8) != 0;
+    dump.region.hugePages = (flags & REGION_FLAG_HUGE_PAGES) != 0;
+    dump.zeroFill = (flags & DUMP_FLAG_ZERO_FILL) != 0;
+}
+
+void RealProcessCheckpoint::serializeDumpHeader(const MemoryDump& dump, std::vector<uint8_t>& out) {
+    BinaryWriter writer(out);
+    writer.write(dump.region.startAddr);
+    writer.write(dump.region.endAddr);
+    writer.writeU8(dumpFlags(dump));
+    writer.write(static_cast<uint64_t>(dump.payloadSize()));
+}
+
+std::vector<uint8_t> RealProcessCheckpoint::serialize() const {
+    std::vector<uint8_t> data = serializeHeader(static_cast<uint32_t>(memoryDumps.size()));
+    data.reserve(data.size() + dumpedMemorySize() + memoryDumps.size() * 32 + sizeof(signals));
+    
+    // Each memory dump: start, end, flags, size, data
     for (const auto& dump : memoryDumps) {
-        // Region info
-        data.insert(data.end(), reinterpret_cast<const uint8_t*>(&dump.region.startAddr),
-                    reinterpret_cast<const uint8_t*>(&dump.region.startAddr) + sizeof(dump.region.startAddr));
-        data.insert(data.end(), reinterpret_cast<const uint8_t*>(&dump.region.endAddr),
-                    reinterpret_cast<const uint8_t*>(&dump.region.endAddr) + sizeof(dump.region.endAddr));
-        
-        // Data
-        uint64_t dataSize = dump.data.size();
-        data.insert(data.end(), reinterpret_cast<uint8_t*>(&dataSize),
-                    reinterpret_cast<uint8_t*>(&dataSize) + sizeof(dataSize));
-        data.insert(data.end(), dump.data.begin(), dump.data.end());
+        serializeDumpHeader(dump, data);
+        data.insert(data.end(), dump.payload(), dump.payload() + dump.payloadSize());
     }
     
     // Signals
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&signals),
-                reinterpret_cast<const uint8_t*>(&signals) + sizeof(signals));
+    BinaryWriter(data).write(signals);
     
     return data;
 }
 
-RealProcessCheckpoint RealProcessCheckpoint::deserialize(const std::vector<uint8_t>& data) {
-    RealProcessCheckpoint checkpoint;
-    
-    if (data.size() < 8) {
-        return checkpoint;  // Invalid data
-    }
-    
-    size_t offset = 0;
+RealProcessCheckpoint RealProcessCheckpoint::deserialize(std::span<const uint8_t> data) {
+    BinaryReader reader(data);
     
     // Check magic number
-    if (data[0] != 'R' || data[1] != 'C' || data[2] != 'H' || data[3] != 'K') {
-        return checkpoint;  // Invalid magic
+    auto magic = reader.readBytes(4);
+    if (!reader.ok() || std::memcmp(magic.data(), "RCHK", 4) != 0) {
+        return {};  // Invalid magic
     }
-    offset += 4;
     
     // Version
-    uint32_t version;
-    std::memcpy(&version, &data[offset], sizeof(version));
-    offset += sizeof(version);
-    
-    if (version != 1) {
-        return checkpoint;  // Unsupported version
+    uint32_t version = reader.read<uint32_t>();
+    if (!reader.ok() || !isStreamVersion(version)) {
+        return {};  // Unsupported version (v4/v7 indeksli imaj: MappedCheckpointImage)
     }
     
-    // Checkpoint ID
-    std::memcpy(&checkpoint.checkpointId, &data[offset], sizeof(checkpoint.checkpointId));
-    offset += sizeof(checkpoint.checkpointId);
-    
-    // Timestamp
-    std::memcpy(&checkpoint.timestamp, &data[offset], sizeof(checkpoint.timestamp));
-    offset += sizeof(checkpoint.timestamp);
-    
-    // Name
-    uint32_t nameLen;
-    std::memcpy(&nameLen, &data[offset], sizeof(nameLen));
-    offset += sizeof(nameLen);
-    checkpoint.name = std::string(reinterpret_cast<const char*>(&data[offset]), nameLen);
-    offset += nameLen;
-    
-    // Process Info - pid, ppid
-    std::memcpy(&checkpoint.info.pid, &data[offset], sizeof(checkpoint.info.pid));
-    offset += sizeof(checkpoint.info.pid);
-    std::memcpy(&checkpoint.info.ppid, &data[offset], sizeof(checkpoint.info.ppid));
-    offset += sizeof(checkpoint.info.ppid);
-    
-    // Process name
-    uint32_t procNameLen;
-    std::memcpy(&procNameLen, &data[offset], sizeof(procNameLen));
-    offset += sizeof(procNameLen);
-    checkpoint.info.name = std::string(reinterpret_cast<const char*>(&data[offset]), procNameLen);
-    offset += procNameLen;
+    RealProcessCheckpoint checkpoint;
+    reader.read(checkpoint.checkpointId);
+    reader.read(checkpoint.timestamp);
     
-    // Cmdline
-    uint32_t cmdlineLen;
-    std::memcpy(&cmdlineLen, &data[offset], sizeof(cmdlineLen));
-    offset += sizeof(cmdlineLen);
-    checkpoint.info.cmdline = std::string(reinterpret_cast<const char*>(&data[offset]), cmdlineLen);
-    offset += cmdlineLen;
+    // Parent checkpoint (v2+)
+    if (version >= 2) {
+        reader.read(checkpoint.parentCheckpointId);
+        checkpoint.isIncremental = reader.readBool();
+    }
     
-    // Registers
-    size_t regSize = sizeof(LinuxRegisters) - sizeof(std::vector<uint8_t>);
-    std::memcpy(&checkpoint.registers, &data[offset], regSize);
-    offset += regSize;
+    checkpoint.name = reader.readString();
     
-    // FPU state
-    uint8_t hasFPU = data[offset++];
-    checkpoint.registers.hasFPU = (hasFPU != 0);
-    if (checkpoint.registers.hasFPU) {
-        uint32_t fpuSize;
-        std::memcpy(&fpuSize, &data[offset], sizeof(fpuSize));
-        offset += sizeof(fpuSize);
-        checkpoint.registers.fpuState.resize(fpuSize);
-        std::memcpy(checkpoint.registers.fpuState.data(), &data[offset], fpuSize);
-        offset += fpuSize;
+    // Process Info
+    reader.read(checkpoint.info.pid);
+    reader.read(checkpoint.info.ppid);
+    checkpoint.info.name = reader.readString();
+    checkpoint.info.cmdline = reader.readString();
+    
+    // Registers + FPU state
+    readRegisters(reader, checkpoint.registers);
+    
+    // Diğer thread'ler (v6+)
+    if (version >= 6) {
+        uint32_t threadCount = reader.read<uint32_t>();
+        for (uint32_t i = 0; i < threadCount && reader.ok(); ++i) {
+            ThreadState thread;
+            thread.tid = reader.read<int32_t>();
+            if (!readRegisters(reader, thread.registers)) break;
+            checkpoint.threads.push_back(std::move(thread));
+        }
     }
     
     // Memory regions
-    uint32_t regionCount;
-    std::memcpy(&regionCount, &data[offset], sizeof(regionCount));
-    offset += sizeof(regionCount);
-    
-    for (uint32_t i = 0; i < regionCount; ++i) {
+    uint32_t regionCount = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < regionCount && reader.ok(); ++i) {
         MemoryRegion region;
-        std::memcpy(&region.startAddr, &data[offset], sizeof(region.startAddr));
-        offset += sizeof(region.startAddr);
-        std::memcpy(&region.endAddr, &data[offset], sizeof(region.endAddr));
-        offset += sizeof(region.endAddr);
+        reader.read(region.startAddr);
+        reader.read(region.endAddr);
         
-        uint8_t flags = data[offset++];
+        uint8_t flags = reader.readU8();
         region.readable = (flags & 1) != 0;
         region.writable = (flags & 2) != 0;
         region.executable = (flags & 4) != 0;
         region.isPrivate = (flags & 8) != 0;
+        region.hugePages = (flags & REGION_FLAG_HUGE_PAGES) != 0;
         
-        uint32_t pathLen;
-        std::memcpy(&pathLen, &data[offset], sizeof(pathLen));
-        offset += sizeof(pathLen);
-        region.pathname = std::string(reinterpret_cast<const char*>(&data[offset]), pathLen);
-        offset += pathLen;
-        
-        checkpoint.memoryMap.push_back(region);
+        region.pathname = reader.readString();
+        checkpoint.memoryMap.push_back(std::move(region));
     }
     
     // Memory dumps
-    uint32_t dumpCount;
-    std::memcpy(&dumpCount, &data[offset], sizeof(dumpCount));
-    offset += sizeof(dumpCount);
+    uint32_t dumpCount = reader.read<uint32_t>();
+    
+    // v3 stream'lerinde sayı bilinmez; start = end = 0 olan end kaydına kadar oku
+    bool streamed = (version >= 3 && dumpCount == STREAMED_DUMP_COUNT);
     
-    for (uint32_t i = 0; i < dumpCount; ++i) {
+    for (uint32_t i = 0; (streamed || i < dumpCount) && reader.ok(); ++i) {
         MemoryDump dump;
-        std::memcpy(&dump.region.startAddr, &data[offset], sizeof(dump.region.startAddr));
-        offset += sizeof(dump.region.startAddr);
-        std::memcpy(&dump.region.endAddr, &data[offset], sizeof(dump.region.endAddr));
-        offset += sizeof(dump.region.endAddr);
+        reader.read(dump.region.startAddr);
+        reader.read(dump.region.endAddr);
         
-        uint64_t dataSize;
-        std::memcpy(&dataSize, &data[offset], sizeof(dataSize));
-        offset += sizeof(dataSize);
+        // Dump'ı içeren region'dan pathname (v1'de flag'ler de) al
+        for (const auto& region : checkpoint.memoryMap) {
+            if (dump.region.startAddr >= region.startAddr &&
+                dump.region.endAddr <= region.endAddr) {
+                uint64_t start = dump.region.startAddr;
+                uint64_t end = dump.region.endAddr;
+                dump.region = region;
+                dump.region.startAddr = start;
+                dump.region.endAddr = end;
+                break;
+            }
+        }
         
-        dump.data.resize(dataSize);
-        std::memcpy(dump.data.data(), &data[offset], dataSize);
-        offset += dataSize;
+        uint8_t flags = 0;
+        if (version >= 2) {
+            flags = reader.readU8();
+            applyDumpFlags(dump, flags);
+        }
+        
+        uint64_t dataSize = reader.read<uint64_t>();
+        
+        if (streamed && dump.region.startAddr == 0 && dump.region.endAddr == 0) {
+            break;  // End kaydı
+        }
+        
+        auto payload = reader.readBytes(static_cast<size_t>(dataSize));
+        if (!reader.ok()) break;
+        if (flags & DUMP_FLAG_PAGE_REFS) {
+            dump.pageRefs.resize(dataSize / sizeof(uint32_t));
+            std::memcpy(dump.pageRefs.data(), payload.data(), dump.pageRefs.size() * sizeof(uint32_t));
+        } else {
+            dump.data.assign(payload.begin(), payload.end());
+        }
         dump.isValid = true;
         
-        checkpoint.memoryDumps.push_back(dump);
+        checkpoint.memoryDumps.push_back(std::move(dump));
     }
     
     // Signals
-    std::memcpy(&checkpoint.signals, &data[offset], sizeof(checkpoint.signals));
+    reader.read(checkpoint.signals);
+    
+    // Kesik / bozuk kayıt: yarım checkpoint yerine geçersiz (boş) döndür
+    if (!reader.ok()) {
+        return {};
+    }
     
     return checkpoint;
 }
@@ -292,6 +306,54 @@ uint64_t RealProcessCheckpoint::totalMemorySize() const {
     return total;
 }
 
+void RealProcessCheckpoint::computePageHashes() {
+    for (auto& dump : memoryDumps) {
+        if (!dump.isValid || dump.zeroFill || dump.isDeduplicated() || dump.data.empty()) {
+            dump.pageHashes.clear();
+            dump.hashTree.clear();
+            continue;
+        }
+        uint64_t pages = (dump.data.size() + PAGE_HASH_BYTES - 1) / PAGE_HASH_BYTES;
+        if (dump.pageHashes.size() != pages) {
+            dump.pageHashes.resize(pages);
+            for (uint64_t p = 0; p < pages; ++p) {
+                uint64_t off = p * PAGE_HASH_BYTES;
+                uint64_t len = std::min<uint64_t>(PAGE_HASH_BYTES, dump.data.size() - off);
+                dump.pageHashes[p] = xxhash64(dump.data.data() + off, len);
+            }
+            dump.hashTree.clear();
+        }
+        if (dump.hashTree.empty()) {
+            dump.hashTree = buildHashTree(dump.pageHashes);
+        }
+    }
+}
+
+std::vector<uint64_t> RealProcessCheckpoint::buildHashTree(const std::vector<uint64_t>& leaves) {
+    std::vector<uint64_t> tree;
+    uint64_t count = leaves.size();
+    size_t levelStart = 0;
+    bool fromLeaves = true;
+    
+    // Seviye seviye: düğüm = çocuk hash dizisinin xxhash64'ü (son düğüm
+    // eksik çocuklu olabilir)
+    while (count > 1) {
+        uint64_t parents = (count + HASH_TREE_FANOUT - 1) / HASH_TREE_FANOUT;
+        size_t next = tree.size();
+        tree.resize(next + parents);
+        const uint64_t* level = fromLeaves ? leaves.data() : tree.data() + levelStart;
+        for (uint64_t i = 0; i < parents; ++i) {
+            uint64_t first = i * HASH_TREE_FANOUT;
+            uint64_t n = std::min<uint64_t>(HASH_TREE_FANOUT, count - first);
+            tree[next + i] = xxhash64(level + first, n * sizeof(uint64_t));
+        }
+        levelStart = next;
+        count = parents;
+        fromLeaves = false;
+    }
+    return tree;
+}
+
 uint64_t RealProcessCheckpoint::dumpedMemorySize() const {
     uint64_t total = 0;
     for (const auto& dump : memoryDumps) {
@@ -1,16 +1,34 @@
 #include "real_process/reverse_executor.hpp"
+#include "real_process/file_backup.hpp"
+#include "core/metrics.hpp"
 #include <fstream>
 #include <cstring>
 #include <sys/stat.h>
 #include <sys/ptrace.h>
 #include <sys/wait.h>
 #include <sys/syscall.h>
+#include <sys/prctl.h>
+#include <sys/user.h>
+#include <sys/uio.h>
+#include <linux/audit.h>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <csignal>
+#include <cstddef>
+#include <cerrno>
 #include <unistd.h>
 #include <fcntl.h>
 #include <mutex>
+#include <set>
+#include <map>
+#include <memory>
 #include <atomic>
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <optional>
+#include <thread>
 
 namespace checkpoint {
 namespace real_process {
@@ -23,10 +41,13 @@ struct ReverseExecutor::Impl {
     ReverseOptions options;
     ProgressCallback progressCallback;
     std::mutex mutex;
+    FileBackupStrategy backupStrategy;      // createBackup ve disk yedeklerinden geri yükleme
     
     // Statistics
     std::atomic<size_t> totalReversed{0};
     std::atomic<size_t> totalBytesRestored{0};
+    // Aynı ms'de aynı isimli dosyaların (paralel) yedekleri çakışmasın
+    std::atomic<uint64_t> backupSeq{0};
 };
 
 ReverseExecutor::ReverseExecutor() 
@@ -205,12 +226,11 @@ bool ReverseExecutor::createBackup(const std::string& path) {
             std::chrono::system_clock::now().time_since_epoch()).count();
         
         std::string backupPath = m_impl->options.backupDir + "/" + 
-                                  filename + "." + std::to_string(timestamp) + ".bak";
+                                  filename + "." + std::to_string(timestamp) + "." +
+                                  std::to_string(m_impl->backupSeq++) + ".bak";
         
-        std::filesystem::copy_file(path, backupPath,
-            std::filesystem::copy_options::overwrite_existing);
-        
-        return true;
+        // Reflink/copy_file_range: yedek RAM'den geçmez
+        return m_impl->backupStrategy.copyFile(path, backupPath) != BackupMethod::None;
     } catch (const std::exception&) {
         return false;
     }
@@ -298,18 +318,41 @@ ReverseResult ReverseExecutor::reverseCreate(const FileOperation& op) {
     }
 }
 
+namespace {
+
+// Tam yedeği (disk dosyası ya da bellekteki içerik) target'a yaz. target
+// yoksa oluşturulur, varsa içeriği değiştirilir.
+bool restoreFullBackup(const FileBackupStrategy& strategy, const FileOperation& op,
+                       const std::string& target, std::string& error) {
+    if (!op.backupPath.empty()) {
+        return strategy.copyFile(op.backupPath, target, &error) != BackupMethod::None;
+    }
+    std::ofstream file(target, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        error = "Cannot open file for writing";
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(op.originalContent->data()),
+               op.originalContent->size());
+    return true;
+}
+
+size_t fullBackupSize(const FileOperation& op) {
+    return op.originalContent ? op.originalContent->size() : op.originalSize;
+}
+
+} // namespace
+
 ReverseResult ReverseExecutor::reverseWrite(const FileOperation& op) {
     // Reverse WRITE by restoring original content
     try {
         if (op.hasFullBackup()) {
             // Full restore
-            std::ofstream file(op.path, std::ios::binary | std::ios::trunc);
-            if (!file) {
-                return ReverseResult::error(op.operationId, "Cannot open file for writing");
+            std::string error;
+            if (!restoreFullBackup(m_impl->backupStrategy, op, op.path, error)) {
+                return ReverseResult::error(op.operationId, error);
             }
-            file.write(reinterpret_cast<const char*>(op.originalContent->data()),
-                       op.originalContent->size());
-            return ReverseResult::ok(op.operationId, op.path, op.originalContent->size());
+            return ReverseResult::ok(op.operationId, op.path, fullBackupSize(op));
         }
         
         if (op.hasDiffs()) {
@@ -348,13 +391,12 @@ ReverseResult ReverseExecutor::reverseTruncate(const FileOperation& op) {
     // Reverse TRUNCATE by restoring truncated content
     try {
         if (op.hasFullBackup()) {
-            std::ofstream file(op.path, std::ios::binary | std::ios::trunc);
-            if (!file) {
-                return ReverseResult::error(op.operationId, "Cannot open file for writing");
+            // Full restore
+            std::string error;
+            if (!restoreFullBackup(m_impl->backupStrategy, op, op.path, error)) {
+                return ReverseResult::error(op.operationId, error);
             }
-            file.write(reinterpret_cast<const char*>(op.originalContent->data()),
-                       op.originalContent->size());
-            return ReverseResult::ok(op.operationId, op.path, op.originalContent->size());
+            return ReverseResult::ok(op.operationId, op.path, fullBackupSize(op));
         }
         
         if (op.hasDiffs()) {
@@ -398,13 +440,10 @@ ReverseResult ReverseExecutor::reverseDelete(const FileOperation& op) {
         }
         
         // Write content
-        std::ofstream file(op.path, std::ios::binary);
-        if (!file) {
-            return ReverseResult::error(op.operationId, "Cannot create file");
+        std::string error;
+        if (!restoreFullBackup(m_impl->backupStrategy, op, op.path, error)) {
+            return ReverseResult::error(op.operationId, "Cannot create file: " + error);
         }
-        file.write(reinterpret_cast<const char*>(op.originalContent->data()),
-                   op.originalContent->size());
-        file.close();
         
         // Restore permissions
         if (op.originalMode != 0) {
@@ -416,7 +455,7 @@ ReverseResult ReverseExecutor::reverseDelete(const FileOperation& op) {
             chown(op.path.c_str(), op.originalUid, op.originalGid);
         }
         
-        return ReverseResult::ok(op.operationId, op.path, op.originalContent->size());
+        return ReverseResult::ok(op.operationId, op.path, fullBackupSize(op));
     } catch (const std::exception& e) {
         return ReverseResult::error(op.operationId, e.what());
     }
@@ -429,11 +468,8 @@ ReverseResult ReverseExecutor::reverseRename(const FileOperation& op) {
         
         // If there was content at newPath that was overwritten, restore it
         if (op.hasFullBackup()) {
-            std::ofstream file(op.path, std::ios::binary);
-            if (file) {
-                file.write(reinterpret_cast<const char*>(op.originalContent->data()),
-                           op.originalContent->size());
-            }
+            std::string error;
+            restoreFullBackup(m_impl->backupStrategy, op, op.path, error);
         }
         
         return ReverseResult::ok(op.operationId, op.originalPath);
@@ -517,8 +553,10 @@ std::vector<FileOperation> ReverseExecutor::sortOperations(
     std::vector<FileOperation> sorted = ops;
     
     if (m_impl->options.reverseNewestFirst) {
-        // Sort by timestamp descending (newest first) - LIFO order
-        std::sort(sorted.begin(), sorted.end(),
+        // Sort by timestamp descending (newest first) - LIFO order.
+        // Aynı zaman damgalı (aynı ms) işlemler kayıt sırasının tersinde kalır.
+        std::reverse(sorted.begin(), sorted.end());
+        std::stable_sort(sorted.begin(), sorted.end(),
             [](const FileOperation& a, const FileOperation& b) {
                 return a.timestamp > b.timestamp;
             });
@@ -527,35 +565,192 @@ std::vector<FileOperation> ReverseExecutor::sortOperations(
     return sorted;
 }
 
+namespace {
+
+bool isStructural(FileOperationType type) {
+    return type == FileOperationType::RENAME || type == FileOperationType::MKDIR ||
+           type == FileOperationType::RMDIR;
+}
+
+std::string trimSlashes(std::string path) {
+    while (path.size() > 1 && path.back() == '/') path.pop_back();
+    return path;
+}
+
+} // namespace
+
+std::vector<std::vector<size_t>> ReverseExecutor::buildDependencies(
+    const std::vector<FileOperation>& orderedOps) {
+    
+    std::vector<std::vector<size_t>> deps(orderedOps.size());
+    std::map<std::string, size_t> lastToucher;      // path -> son işlem
+    std::map<std::string, size_t> lastStructural;   // dizin -> son RENAME/MKDIR/RMDIR
+    
+    for (size_t i = 0; i < orderedOps.size(); ++i) {
+        const auto& op = orderedOps[i];
+        bool structural = isStructural(op.type);
+        
+        std::vector<std::string> keys;
+        if (!op.path.empty()) keys.push_back(trimSlashes(op.path));
+        if (!op.originalPath.empty()) keys.push_back(trimSlashes(op.originalPath));
+        
+        auto& mine = deps[i];
+        for (const auto& key : keys) {
+            auto it = lastToucher.find(key);
+            if (it != lastToucher.end()) mine.push_back(it->second);
+            
+            // Üst dizinlerden birini taşıyan/oluşturan/silen işlemden sonra
+            for (auto slash = key.rfind('/'); slash != std::string::npos && slash > 0;
+                 slash = key.rfind('/', slash - 1)) {
+                auto parent = lastStructural.find(key.substr(0, slash));
+                if (parent != lastStructural.end()) mine.push_back(parent->second);
+            }
+            auto root = lastStructural.find("/");
+            if (root != lastStructural.end() && key != "/") mine.push_back(root->second);
+            
+            // Dizin işlemi altındaki her path'in son işleminden sonra
+            if (structural) {
+                std::string prefix = key == "/" ? "/" : key + "/";
+                for (auto child = lastToucher.lower_bound(prefix);
+                     child != lastToucher.end() &&
+                     child->first.compare(0, prefix.size(), prefix) == 0; ++child) {
+                    mine.push_back(child->second);
+                }
+            }
+        }
+        
+        std::sort(mine.begin(), mine.end());
+        mine.erase(std::unique(mine.begin(), mine.end()), mine.end());
+        
+        for (const auto& key : keys) {
+            lastToucher[key] = i;
+            if (structural) lastStructural[key] = i;
+        }
+    }
+    
+    return deps;
+}
+
 BatchReverseResult ReverseExecutor::reverseOperations(const std::vector<FileOperation>& ops) {
     BatchReverseResult result;
     result.totalOperations = ops.size();
+    TraceScope trace("reverse.batch");
     
     auto startTime = std::chrono::steady_clock::now();
+    trace.stage("sort");
     auto sortedOps = sortOperations(ops);
+    trace.stage("reverse");
     
-    for (size_t i = 0; i < sortedOps.size(); ++i) {
-        const auto& op = sortedOps[i];
-        
-        if (m_impl->progressCallback) {
-            m_impl->progressCallback(i + 1, sortedOps.size(), 
-                "Reversing: " + fileOpTypeToString(op.type) + " " + op.path);
+    unsigned threads = m_impl->options.parallelism;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, sortedOps.size())));
+    result.workersUsed = threads;
+    
+    if (threads <= 1) {
+        for (size_t i = 0; i < sortedOps.size(); ++i) {
+            const auto& op = sortedOps[i];
+            
+            if (m_impl->progressCallback) {
+                m_impl->progressCallback(i + 1, sortedOps.size(), 
+                    "Reversing: " + fileOpTypeToString(op.type) + " " + op.path);
+            }
+            
+            if (!shouldProcess(op)) {
+                result.skippedCount++;
+                continue;
+            }
+            
+            auto reverseResult = reverseOperation(op);
+            result.results.push_back(reverseResult);
+            
+            if (reverseResult.success) {
+                result.successCount++;
+            } else {
+                result.failCount++;
+                if (m_impl->options.stopOnError) {
+                    break;
+                }
+            }
         }
-        
-        if (!shouldProcess(op)) {
-            result.skippedCount++;
-            continue;
+    } else {
+        // Bağımlılıkları biten işlemler hazır kuyruğundan alınır
+        auto deps = buildDependencies(sortedOps);
+        std::vector<std::vector<size_t>> dependents(sortedOps.size());
+        std::vector<size_t> pending(sortedOps.size());
+        std::deque<size_t> ready;
+        for (size_t i = 0; i < deps.size(); ++i) {
+            pending[i] = deps[i].size();
+            for (size_t dep : deps[i]) dependents[dep].push_back(i);
+            if (pending[i] == 0) ready.push_back(i);
         }
         
-        auto reverseResult = reverseOperation(op);
-        result.results.push_back(reverseResult);
+        std::vector<std::optional<ReverseResult>> results(sortedOps.size());
+        std::vector<char> filtered(sortedOps.size(), 0);
+        std::mutex queueMutex;
+        std::condition_variable queueCv;
+        size_t remaining = sortedOps.size();
+        bool stop = false;
+        std::mutex progressMutex;
+        size_t started = 0;
         
-        if (reverseResult.success) {
-            result.successCount++;
-        } else {
-            result.failCount++;
-            if (m_impl->options.stopOnError) {
-                break;
+        auto worker = [&]() {
+            while (true) {
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock(queueMutex);
+                    queueCv.wait(lock, [&]() { return stop || remaining == 0 || !ready.empty(); });
+                    if (stop || ready.empty()) return;
+                    index = ready.front();
+                    ready.pop_front();
+                }
+                
+                const auto& op = sortedOps[index];
+                if (m_impl->progressCallback) {
+                    std::lock_guard<std::mutex> lock(progressMutex);
+                    m_impl->progressCallback(++started, sortedOps.size(),
+                        "Reversing: " + fileOpTypeToString(op.type) + " " + op.path);
+                }
+                
+                bool failed = false;
+                if (shouldProcess(op)) {
+                    results[index] = reverseOperation(op);
+                    failed = !results[index]->success;
+                } else {
+                    filtered[index] = 1;
+                }
+                
+                std::lock_guard<std::mutex> lock(queueMutex);
+                remaining--;
+                if (failed && m_impl->options.stopOnError) {
+                    stop = true;
+                }
+                for (size_t next : dependents[index]) {
+                    if (--pending[next] == 0) ready.push_back(next);
+                }
+                queueCv.notify_all();
+            }
+        };
+        
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back(worker);
+        }
+        for (auto& t : workers) t.join();
+        
+        // Sonuçlar geri alma sırasında; durdurulduysa başlamayanlar yok
+        for (size_t i = 0; i < sortedOps.size(); ++i) {
+            if (results[i]) {
+                if (results[i]->success) {
+                    result.successCount++;
+                } else {
+                    result.failCount++;
+                }
+                result.results.push_back(std::move(*results[i]));
+            } else if (filtered[i]) {
+                result.skippedCount++;
             }
         }
     }
@@ -566,6 +761,15 @@ BatchReverseResult ReverseExecutor::reverseOperations(const std::vector<FileOper
     
     result.allSucceeded = (result.failCount == 0);
     
+    trace.endStage();
+    trace.count("operations", result.totalOperations);
+    trace.count("succeeded", result.successCount);
+    trace.count("failed", result.failCount);
+    trace.count("skipped", result.skippedCount);
+    trace.count("workers", result.workersUsed);
+    if (result.allSucceeded) {
+        trace.succeed();
+    }
     return result;
 }
 
@@ -649,6 +853,37 @@ std::vector<std::string> ReverseExecutor::previewReverse(
 // SyscallInterceptor Implementation
 // ============================================================================
 
+namespace {
+
+#if defined(__x86_64__)
+constexpr uint32_t SECCOMP_AUDIT_ARCH = AUDIT_ARCH_X86_64;
+#elif defined(__aarch64__)
+constexpr uint32_t SECCOMP_AUDIT_ARCH = AUDIT_ARCH_AARCH64;
+#else
+constexpr uint32_t SECCOMP_AUDIT_ARCH = 0;     // seccomp modu desteklenmez
+#endif
+
+// nr listede ise SECCOMP_RET_TRACE, değilse ALLOW. Başka ABI'den gelen
+// syscall'lar (arch uyuşmazsa) izlenmez.
+std::vector<sock_filter> buildSeccompFilter(const std::vector<long>& syscalls) {
+    std::vector<sock_filter> filter;
+    filter.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, arch)));
+    filter.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SECCOMP_AUDIT_ARCH, 1, 0));
+    filter.push_back(BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+    filter.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, nr)));
+    size_t n = syscalls.size();
+    for (size_t i = 0; i < n; ++i) {
+        // Eşleşirse kalan karşılaştırmaları ve ALLOW'u atla
+        filter.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, static_cast<uint32_t>(syscalls[i]),
+                                  static_cast<uint8_t>(n - i), 0));
+    }
+    filter.push_back(BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+    filter.push_back(BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_TRACE));
+    return filter;
+}
+
+} // namespace
+
 struct SyscallInterceptor::Impl {
     std::atomic<bool> attached{false};
     std::atomic<bool> intercepting{false};
@@ -662,7 +897,494 @@ struct SyscallInterceptor::Impl {
     bool interceptRename{true};
     bool interceptTruncate{true};
     
+    SyscallTraceMode mode{SyscallTraceMode::PtraceSyscall};
+    SyscallTraceMode activeMode{SyscallTraceMode::PtraceSyscall};
+    bool launched{false};
+    // Seccomp modunda filtre fork/clone ile çocuklara geçer; izlenmeyen bir
+    // çocukta SECCOMP_RET_TRACE ENOSYS olurdu, bu yüzden hepsi izlenir
+    bool followChildren{false};
+    std::set<pid_t> tracees;
+    pid_t stoppedPid{0};        // ptrace-stop'ta bekleyen, devam ettirilmemiş
+    int exitStatus{-1};
+    std::atomic<uint64_t> stopCount{0};
+    std::atomic<uint64_t> handledCount{0};
+    
+    // Tracee fd tablosu. Thread'ler (CLONE event'i) tabloyu paylaşır,
+    // fork/vfork kopyalar, exec boşaltır. Tablo eksikse readlink ile
+    // tamamlanır; bu yüzden boş tablo her zaman doğrudur, kopya sadece
+    // hızlandırır.
+    struct FdEntry {
+        std::string path;
+        bool regular{false};
+        int infoFd{-1};         // /proc/<pid>/fdinfo/<fd>, ilk yazmada açılır
+    };
+    struct FdTable {
+        std::map<int, FdEntry> fds;
+        
+        FdTable() = default;
+        FdTable(const FdTable& other) : fds(other.fds) {
+            for (auto& entry : fds) entry.second.infoFd = -1;   // başka pid'e ait
+        }
+        FdTable& operator=(const FdTable&) = delete;
+        ~FdTable() {
+            for (auto& entry : fds) closeInfo(entry.second);
+        }
+        
+        static void closeInfo(FdEntry& entry) {
+            if (entry.infoFd >= 0) ::close(entry.infoFd);
+            entry.infoFd = -1;
+        }
+        void erase(int fd) {
+            auto it = fds.find(fd);
+            if (it == fds.end()) return;
+            closeInfo(it->second);
+            fds.erase(it);
+        }
+        void eraseRange(unsigned lo, unsigned hi) {
+            for (auto it = fds.lower_bound(static_cast<int>(std::min<unsigned>(lo, INT32_MAX)));
+                 it != fds.end() && static_cast<unsigned>(it->first) <= hi;) {
+                closeInfo(it->second);
+                it = fds.erase(it);
+            }
+        }
+    };
+    std::map<pid_t, std::shared_ptr<FdTable>> fdTables;
+    
+    // Girişi görülmüş, çıkışı beklenen syscall
+    struct WriteTarget {
+        int fd{-1};             // -1: kaydedilecek yazma yok
+        std::string path;
+        off_t offset{0};        // -1: O_APPEND
+        size_t size{0};
+    };
+    struct InFlight {
+        long nr{-1};
+        std::vector<uint64_t> args;
+        WriteTarget write;
+    };
+    std::map<pid_t, InFlight> inFlight;
+    
     std::mutex mutex;
+    
+    std::vector<long> trackedSyscalls() const {
+        std::vector<long> nrs;
+        if (interceptWrite) {
+#ifdef SYS_write
+            nrs.push_back(SYS_write);
+#endif
+#ifdef SYS_pwrite64
+            nrs.push_back(SYS_pwrite64);
+#endif
+#ifdef SYS_writev
+            nrs.push_back(SYS_writev);
+#endif
+#ifdef SYS_pwritev
+            nrs.push_back(SYS_pwritev);
+#endif
+#ifdef SYS_pwritev2
+            nrs.push_back(SYS_pwritev2);
+#endif
+            // fd tablosunu güncel tutmak için
+#ifdef SYS_close
+            nrs.push_back(SYS_close);
+#endif
+#ifdef SYS_close_range
+            nrs.push_back(SYS_close_range);
+#endif
+#ifdef SYS_dup
+            nrs.push_back(SYS_dup);
+#endif
+#ifdef SYS_dup2
+            nrs.push_back(SYS_dup2);
+#endif
+#ifdef SYS_dup3
+            nrs.push_back(SYS_dup3);
+#endif
+        }
+        if (interceptOpen) {
+#ifdef SYS_open
+            nrs.push_back(SYS_open);
+#endif
+#ifdef SYS_creat
+            nrs.push_back(SYS_creat);
+#endif
+#ifdef SYS_openat
+            nrs.push_back(SYS_openat);
+#endif
+#ifdef SYS_openat2
+            nrs.push_back(SYS_openat2);
+#endif
+        }
+        if (interceptUnlink) {
+#ifdef SYS_unlink
+            nrs.push_back(SYS_unlink);
+#endif
+#ifdef SYS_unlinkat
+            nrs.push_back(SYS_unlinkat);
+#endif
+#ifdef SYS_rmdir
+            nrs.push_back(SYS_rmdir);
+#endif
+        }
+        if (interceptRename) {
+#ifdef SYS_rename
+            nrs.push_back(SYS_rename);
+#endif
+#ifdef SYS_renameat
+            nrs.push_back(SYS_renameat);
+#endif
+#ifdef SYS_renameat2
+            nrs.push_back(SYS_renameat2);
+#endif
+        }
+        if (interceptTruncate) {
+#ifdef SYS_truncate
+            nrs.push_back(SYS_truncate);
+#endif
+#ifdef SYS_ftruncate
+            nrs.push_back(SYS_ftruncate);
+#endif
+        }
+        return nrs;
+    }
+    
+    bool isTracked(long nr) const {
+        auto nrs = trackedSyscalls();
+        return std::find(nrs.begin(), nrs.end(), nr) != nrs.end();
+    }
+    
+    // Moda göre devam ettir; signal sadece signal-delivery-stop'ta verilir
+    void resume(int signal) {
+        if (stoppedPid <= 0) return;
+        // Seccomp modunda çıkışı beklenen syscall için bir kez PTRACE_SYSCALL:
+        // seccomp-stop'tan sonraki syscall durması çıkıştır
+        bool wantExit = activeMode == SyscallTraceMode::Seccomp && inFlight.count(stoppedPid);
+        long request = intercepting && (activeMode == SyscallTraceMode::PtraceSyscall || wantExit)
+                       ? PTRACE_SYSCALL : PTRACE_CONT;
+        ptrace(static_cast<__ptrace_request>(request), stoppedPid, nullptr,
+               reinterpret_cast<void*>(static_cast<intptr_t>(signal)));
+        stoppedPid = 0;
+    }
+    
+    void reset() {
+        attached = false;
+        intercepting = false;
+        launched = false;
+        followChildren = false;
+        tracees.clear();
+        fdTables.clear();
+        inFlight.clear();
+        stoppedPid = 0;
+        targetPid = 0;
+    }
+    
+    void detachLocked() {
+        if (!attached || targetPid <= 0) return;
+        pid_t pid = targetPid;
+        
+        // Filtre tracer'sız ENOSYS üretir: process bozuk çalışmaya bırakılmaz
+        if (launched && activeMode == SyscallTraceMode::Seccomp) {
+            for (pid_t tracee : tracees) {
+                ::kill(tracee, SIGKILL);
+            }
+            for (pid_t tracee : tracees) {
+                int status;
+                while (waitpid(tracee, &status, __WALL) == -1 && errno == EINTR) {}
+                if (tracee == pid) exitStatus = status;
+            }
+            reset();
+            return;
+        }
+        
+        // PTRACE_DETACH ptrace-stop ister: SIGSTOP'la durdur, o sinyali
+        // bastırarak (detach signal = 0) bırak
+        intercepting = false;
+        if (stoppedPid != pid) {
+            ::kill(pid, SIGSTOP);
+            while (true) {
+                int status;
+                if (waitpid(pid, &status, __WALL) == -1) {
+                    if (errno == EINTR) continue;
+                    break;
+                }
+                if (WIFEXITED(status) || WIFSIGNALED(status)) {
+                    exitStatus = status;
+                    reset();
+                    return;
+                }
+                if (WIFSTOPPED(status) && WSTOPSIG(status) == SIGSTOP && (status >> 16) == 0) {
+                    break;
+                }
+                // Araya giren syscall/event durması ya da başka sinyal
+                int sig = WIFSTOPPED(status) && (status >> 16) == 0 &&
+                          WSTOPSIG(status) != (SIGTRAP | 0x80) ? WSTOPSIG(status) : 0;
+                ptrace(PTRACE_CONT, pid, nullptr, reinterpret_cast<void*>(static_cast<intptr_t>(sig)));
+            }
+        }
+        ptrace(PTRACE_DETACH, pid, nullptr, nullptr);
+        reset();
+    }
+    
+    // Syscall-stop / seccomp-stop'tan nr ve argümanları (girişte) ya da
+    // dönüş değerini (çıkışta) oku. Çıkışta nr bilinmez; inFlight'tan alınır.
+    bool readSyscall(pid_t pid, bool seccompStop, long& nr, std::vector<uint64_t>& args,
+                     bool& entry, int64_t& rval) {
+#ifdef PTRACE_GET_SYSCALL_INFO
+        __ptrace_syscall_info info;
+        std::memset(&info, 0, sizeof(info));
+        if (ptrace(static_cast<__ptrace_request>(PTRACE_GET_SYSCALL_INFO), pid,
+                   reinterpret_cast<void*>(sizeof(info)), &info) > 0) {
+            if (info.op == PTRACE_SYSCALL_INFO_SECCOMP) {
+                nr = static_cast<long>(info.seccomp.nr);
+                args.assign(info.seccomp.args, info.seccomp.args + 6);
+                entry = true;
+                return true;
+            }
+            if (info.op == PTRACE_SYSCALL_INFO_ENTRY) {
+                nr = static_cast<long>(info.entry.nr);
+                args.assign(info.entry.args, info.entry.args + 6);
+                entry = true;
+                return true;
+            }
+            entry = false;
+            rval = info.exit.rval;
+            return info.op == PTRACE_SYSCALL_INFO_EXIT;
+        }
+#endif
+#if defined(__x86_64__)
+        // < 5.3: register'lardan oku. Kernel giriş durmasından önce rax'a
+        // -ENOSYS yazar; çıkışta rax dönüş değeridir
+        struct user_regs_struct regs;
+        if (ptrace(PTRACE_GETREGS, pid, nullptr, &regs) == -1) {
+            return false;
+        }
+        entry = seccompStop || static_cast<int64_t>(regs.rax) == -ENOSYS;
+        nr = static_cast<long>(regs.orig_rax);
+        args = {regs.rdi, regs.rsi, regs.rdx, regs.r10, regs.r8, regs.r9};
+        rval = static_cast<int64_t>(regs.rax);
+        return true;
+#else
+        (void)pid; (void)seccompStop; (void)nr; (void)args; (void)entry; (void)rval;
+        return false;
+#endif
+    }
+    
+    FdTable& tableFor(pid_t pid) {
+        auto& table = fdTables[pid];
+        if (!table) table = std::make_shared<FdTable>();
+        return *table;
+    }
+    
+    // Tabloda yoksa /proc/<pid>/fd/<fd> üzerinden bir kez çöz
+    FdEntry* lookupFd(pid_t pid, int fd) {
+        FdTable& table = tableFor(pid);
+        auto it = table.fds.find(fd);
+        if (it != table.fds.end()) return &it->second;
+        
+        std::string link = "/proc/" + std::to_string(pid) + "/fd/" + std::to_string(fd);
+        char buf[4096];
+        ssize_t len = ::readlink(link.c_str(), buf, sizeof(buf) - 1);
+        if (len <= 0) return nullptr;
+        
+        FdEntry entry;
+        entry.path.assign(buf, static_cast<size_t>(len));
+        struct stat st;
+        // "pipe:[...]", "socket:[...]" ya da silinmiş dosyalar kaydedilmez
+        entry.regular = entry.path[0] == '/' && ::stat(link.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+        return &table.fds.emplace(fd, std::move(entry)).first->second;
+    }
+    
+    // fdinfo'dan pozisyon; O_APPEND ise -1. Okunamazsa false
+    bool fdPosition(pid_t pid, int fd, FdEntry& entry, off_t& offset) {
+        char buf[256];
+        ssize_t len = -1;
+        for (int attempt = 0; attempt < 2 && len <= 0; ++attempt) {
+            if (entry.infoFd < 0 || attempt > 0) {
+                // Paylaşılan tabloda açan thread çıkmış olabilir: bu pid'den aç
+                FdTable::closeInfo(entry);
+                std::string info = "/proc/" + std::to_string(pid) + "/fdinfo/" + std::to_string(fd);
+                entry.infoFd = ::open(info.c_str(), O_RDONLY | O_CLOEXEC);
+                if (entry.infoFd < 0) return false;
+            }
+            len = ::pread(entry.infoFd, buf, sizeof(buf) - 1, 0);
+        }
+        if (len <= 0) return false;
+        buf[len] = '\0';
+        
+        const char* pos = std::strstr(buf, "pos:");
+        const char* flags = std::strstr(buf, "flags:");
+        if (!pos || !flags) return false;
+        unsigned long fl = std::strtoul(flags + 6, nullptr, 8);
+        offset = (fl & O_APPEND) ? -1 : static_cast<off_t>(std::strtoll(pos + 4, nullptr, 10));
+        return true;
+    }
+    
+    // writev/pwritev: iovec dizisini tek process_vm_readv ile okuyup topla
+    static bool iovecTotal(pid_t pid, uint64_t iovAddr, uint64_t iovCount, size_t& total) {
+        if (iovCount == 0 || iovCount > 1024) return false;   // IOV_MAX
+        std::vector<struct iovec> iov(iovCount);
+        struct iovec local{iov.data(), iov.size() * sizeof(struct iovec)};
+        struct iovec remote{reinterpret_cast<void*>(iovAddr), local.iov_len};
+        if (process_vm_readv(pid, &local, 1, &remote, 1, 0) != static_cast<ssize_t>(local.iov_len)) {
+            return false;
+        }
+        total = 0;
+        for (const auto& v : iov) total += v.iov_len;
+        return true;
+    }
+    
+    // İzlenen syscall girişinde fd tablosu / yazma hedefi. Çıkışı da
+    // görülmesi gerekiyorsa true (op doldurulur).
+    bool onEntry(pid_t pid, long nr, const std::vector<uint64_t>& args, InFlight& op) {
+        op.nr = nr;
+        op.args = args;
+        int fd = static_cast<int>(args[0]);
+        switch (nr) {
+#ifdef SYS_write
+            case SYS_write:
+#endif
+#ifdef SYS_pwrite64
+            case SYS_pwrite64:
+#endif
+#ifdef SYS_writev
+            case SYS_writev:
+#endif
+#ifdef SYS_pwritev
+            case SYS_pwritev:
+#endif
+#ifdef SYS_pwritev2
+            case SYS_pwritev2:
+#endif
+            {
+                if (!interceptWrite) return false;
+                FdEntry* entry = lookupFd(pid, fd);
+                if (!entry || !entry->regular) return false;
+                
+                bool vectored = false;
+                bool positional = false;
+#ifdef SYS_writev
+                vectored |= nr == SYS_writev;
+#endif
+#ifdef SYS_pwritev
+                vectored |= nr == SYS_pwritev;
+                positional |= nr == SYS_pwritev;
+#endif
+#ifdef SYS_pwritev2
+                vectored |= nr == SYS_pwritev2;
+                // offset -1: o anki pozisyon
+                positional |= nr == SYS_pwritev2 && static_cast<int64_t>(args[3]) != -1;
+#endif
+#ifdef SYS_pwrite64
+                positional |= nr == SYS_pwrite64;
+#endif
+                size_t size = static_cast<size_t>(args[2]);
+                if (vectored && !iovecTotal(pid, args[1], args[2], size)) return false;
+                if (size == 0) return false;
+                
+                off_t offset = 0;
+                if (positional) {
+                    offset = static_cast<off_t>(args[3]);
+                } else if (!fdPosition(pid, fd, *entry, offset)) {
+                    return false;
+                }
+                op.write.fd = fd;
+                op.write.path = entry->path;
+                op.write.offset = offset;
+                op.write.size = size;
+                return true;
+            }
+#ifdef SYS_close
+            case SYS_close:
+                tableFor(pid).erase(fd);
+                return false;
+#endif
+#ifdef SYS_close_range
+            case SYS_close_range:
+                // CLOSE_RANGE_CLOEXEC sadece işaretler; exec tabloyu boşaltır
+                if (!(args[2] & 4u)) {
+                    tableFor(pid).eraseRange(static_cast<unsigned>(args[0]),
+                                             static_cast<unsigned>(args[1]));
+                }
+                return false;
+#endif
+#ifdef SYS_dup
+            case SYS_dup:
+#endif
+#ifdef SYS_dup2
+            case SYS_dup2:
+#endif
+#ifdef SYS_dup3
+            case SYS_dup3:
+#endif
+#ifdef SYS_open
+            case SYS_open:
+#endif
+#ifdef SYS_creat
+            case SYS_creat:
+#endif
+#ifdef SYS_openat
+            case SYS_openat:
+#endif
+#ifdef SYS_openat2
+            case SYS_openat2:
+#endif
+                return true;
+            default:
+                return false;
+        }
+    }
+    
+    // Çıkışta fd tablosunu güncelle. Açılan normal dosyanın path'i
+    // (tracker önbelleği geçersizlensin diye) opened'a yazılır.
+    void onExit(pid_t pid, const InFlight& op, int64_t rval, std::string& opened) {
+        if (rval < 0) return;
+        int newFd = static_cast<int>(rval);
+        FdTable& table = tableFor(pid);
+        switch (op.nr) {
+#ifdef SYS_dup
+            case SYS_dup:
+#endif
+#ifdef SYS_dup2
+            case SYS_dup2:
+#endif
+#ifdef SYS_dup3
+            case SYS_dup3:
+#endif
+            {
+                int oldFd = static_cast<int>(op.args[0]);
+                if (oldFd == newFd) return;
+                table.erase(newFd);
+                auto it = table.fds.find(oldFd);
+                if (it != table.fds.end()) {
+                    FdEntry copy;
+                    copy.path = it->second.path;
+                    copy.regular = it->second.regular;
+                    table.fds.emplace(newFd, std::move(copy));
+                }
+                return;
+            }
+#ifdef SYS_open
+            case SYS_open:
+#endif
+#ifdef SYS_creat
+            case SYS_creat:
+#endif
+#ifdef SYS_openat
+            case SYS_openat:
+#endif
+#ifdef SYS_openat2
+            case SYS_openat2:
+#endif
+            {
+                table.erase(newFd);
+                FdEntry* entry = lookupFd(pid, newFd);
+                if (entry && entry->regular) opened = entry->path;
+                return;
+            }
+            default:
+                return;
+        }
+    }
 };
 
 SyscallInterceptor::SyscallInterceptor()
@@ -676,7 +1398,7 @@ bool SyscallInterceptor::attach(pid_t pid) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
     if (m_impl->attached) {
-        detach();
+        m_impl->detachLocked();
     }
     
     // Attach to process using ptrace
@@ -686,26 +1408,104 @@ bool SyscallInterceptor::attach(pid_t pid) {
     
     // Wait for the process to stop
     int status;
-    if (waitpid(pid, &status, 0) == -1) {
+    if (waitpid(pid, &status, __WALL) == -1) {
         ptrace(PTRACE_DETACH, pid, nullptr, nullptr);
         return false;
     }
     
+    // Çalışan process'e kaldırılamayan filtre kurulmaz (bkz. header)
+    ptrace(PTRACE_SETOPTIONS, pid, nullptr, PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEEXEC);
+    
     m_impl->targetPid = pid;
+    m_impl->activeMode = SyscallTraceMode::PtraceSyscall;
+    m_impl->launched = false;
+    m_impl->followChildren = false;
+    m_impl->tracees = {pid};
+    m_impl->stoppedPid = pid;
+    m_impl->fdTables.clear();
+    m_impl->inFlight.clear();
+    m_impl->exitStatus = -1;
     m_impl->attached = true;
     
     return true;
 }
 
-void SyscallInterceptor::detach() {
+pid_t SyscallInterceptor::launch(const std::string& path, const std::vector<std::string>& args) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
-    if (m_impl->attached && m_impl->targetPid > 0) {
-        stopInterception();
-        ptrace(PTRACE_DETACH, m_impl->targetPid, nullptr, nullptr);
-        m_impl->attached = false;
-        m_impl->targetPid = 0;
+    if (m_impl->attached) {
+        m_impl->detachLocked();
+    }
+    
+    bool useSeccomp = m_impl->mode == SyscallTraceMode::Seccomp && SECCOMP_AUDIT_ARCH != 0;
+    
+    // fork sonrası child'da sadece async-signal-safe çağrılar: her şey önceden
+    auto filter = buildSeccompFilter(m_impl->trackedSyscalls());
+    sock_fprog prog;
+    prog.len = static_cast<unsigned short>(filter.size());
+    prog.filter = filter.data();
+    
+    std::vector<char*> argv;
+    for (const auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    if (argv.empty()) {
+        argv.push_back(const_cast<char*>(path.c_str()));
+    }
+    argv.push_back(nullptr);
+    
+    pid_t pid = fork();
+    if (pid < 0) {
+        return -1;
+    }
+    if (pid == 0) {
+        ptrace(PTRACE_TRACEME, 0, nullptr, nullptr);
+        raise(SIGSTOP);     // tracer seçenekleri ayarlasın
+        if (useSeccomp) {
+            if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0 ||
+                syscall(SYS_seccomp, SECCOMP_SET_MODE_FILTER, 0, &prog) != 0) {
+                _exit(126);
+            }
+        }
+        execv(path.c_str(), argv.data());
+        _exit(127);
+    }
+    
+    int status;
+    if (waitpid(pid, &status, __WALL) == -1 || !WIFSTOPPED(status)) {
+        ::kill(pid, SIGKILL);
+        waitpid(pid, &status, __WALL);
+        return -1;
+    }
+    
+    long options = PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEEXEC | PTRACE_O_EXITKILL;
+    if (useSeccomp) {
+        options |= PTRACE_O_TRACESECCOMP | PTRACE_O_TRACEFORK |
+                   PTRACE_O_TRACEVFORK | PTRACE_O_TRACECLONE;
     }
+    if (ptrace(PTRACE_SETOPTIONS, pid, nullptr, options) == -1) {
+        ::kill(pid, SIGKILL);
+        waitpid(pid, &status, __WALL);
+        return -1;
+    }
+    
+    m_impl->targetPid = pid;
+    m_impl->activeMode = useSeccomp ? SyscallTraceMode::Seccomp : SyscallTraceMode::PtraceSyscall;
+    m_impl->launched = true;
+    m_impl->followChildren = useSeccomp;
+    m_impl->tracees = {pid};
+    m_impl->stoppedPid = pid;
+    m_impl->fdTables.clear();
+    m_impl->inFlight.clear();
+    m_impl->exitStatus = -1;
+    m_impl->attached = true;
+    
+    return pid;
+}
+
+void SyscallInterceptor::detach() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->detachLocked();
 }
 
 bool SyscallInterceptor::isAttached() const {
@@ -717,31 +1517,183 @@ void SyscallInterceptor::setTracker(std::shared_ptr<FileOperationTracker> tracke
 }
 
 void SyscallInterceptor::startInterception() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
     if (!m_impl->attached) return;
     
-    // Set ptrace options for syscall interception
-    ptrace(PTRACE_SETOPTIONS, m_impl->targetPid, nullptr, 
-           PTRACE_O_TRACESYSGOOD);
-    
     m_impl->intercepting = true;
     
-    // Continue the process
-    ptrace(PTRACE_SYSCALL, m_impl->targetPid, nullptr, nullptr);
+    // Continue the process (PTRACE_SYSCALL ya da seccomp modunda PTRACE_CONT)
+    m_impl->resume(0);
 }
 
 void SyscallInterceptor::stopInterception() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
     if (!m_impl->intercepting) return;
     
     m_impl->intercepting = false;
+    m_impl->inFlight.clear();
     
-    // Continue without syscall stops
-    ptrace(PTRACE_CONT, m_impl->targetPid, nullptr, nullptr);
+    // Continue without syscall stops (sonraki durmalar işlenmeden geçilir)
+    m_impl->resume(0);
 }
 
 bool SyscallInterceptor::isIntercepting() const {
     return m_impl->intercepting;
 }
 
+bool SyscallInterceptor::processNextEvent() {
+    pid_t waitFor;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        if (!m_impl->attached) return false;
+        m_impl->resume(0);
+        // Çocuklar izleniyorsa herhangi bir tracee'nin durması beklenir
+        waitFor = m_impl->followChildren ? -1 : m_impl->targetPid;
+    }
+    
+    int status;
+    pid_t pid;
+    while ((pid = waitpid(waitFor, &status, __WALL)) == -1) {
+        if (errno != EINTR) return false;
+    }
+    
+    int inject = 0;
+    bool handle = false;
+    bool exited = false;
+    long nr = -1;
+    int64_t rval = 0;
+    std::vector<uint64_t> args;
+    Impl::InFlight done;
+    std::string opened;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        if (WIFEXITED(status) || WIFSIGNALED(status)) {
+            if (pid == m_impl->targetPid) {
+                m_impl->exitStatus = status;
+            }
+            m_impl->tracees.erase(pid);
+            m_impl->fdTables.erase(pid);
+            m_impl->inFlight.erase(pid);
+            if (m_impl->tracees.empty()) {
+                m_impl->reset();
+                return false;
+            }
+            return true;
+        }
+        if (!WIFSTOPPED(status)) {
+            return true;
+        }
+        
+        m_impl->stoppedPid = pid;
+        m_impl->stopCount++;
+        int sig = WSTOPSIG(status);
+        int event = status >> 16;
+        
+        bool seccompStop = sig == SIGTRAP && event == PTRACE_EVENT_SECCOMP;
+        if (seccompStop || sig == (SIGTRAP | 0x80)) {
+            bool entry = false;
+            if (m_impl->intercepting && m_impl->readSyscall(pid, seccompStop, nr, args, entry, rval)) {
+                if (entry) {
+                    handle = m_impl->isTracked(nr);
+                    Impl::InFlight op;
+                    if (handle && m_impl->tracker && m_impl->onEntry(pid, nr, args, op)) {
+                        done.write = op.write;      // beforeWrite için
+                        m_impl->inFlight[pid] = std::move(op);
+                    }
+                } else {
+                    auto it = m_impl->inFlight.find(pid);
+                    if (it != m_impl->inFlight.end()) {
+                        done = std::move(it->second);
+                        m_impl->inFlight.erase(it);
+                        m_impl->onExit(pid, done, rval, opened);
+                        exited = true;
+                    }
+                }
+            }
+        } else if (event == PTRACE_EVENT_FORK || event == PTRACE_EVENT_VFORK ||
+                   event == PTRACE_EVENT_CLONE) {
+            unsigned long child = 0;
+            if (ptrace(PTRACE_GETEVENTMSG, pid, nullptr, &child) == 0 && child > 0) {
+                pid_t childPid = static_cast<pid_t>(child);
+                m_impl->tracees.insert(childPid);
+                // CLONE event'i pratikte thread'dir (CLONE_FILES); fork kopyalar.
+                // Çocuk önceden durup tablosunu oluşturduysa o korunur.
+                auto parent = m_impl->fdTables.find(pid);
+                if (parent != m_impl->fdTables.end() && !m_impl->fdTables.count(childPid)) {
+                    m_impl->fdTables[childPid] = event == PTRACE_EVENT_CLONE
+                        ? parent->second
+                        : std::make_shared<Impl::FdTable>(*parent->second);
+                }
+            }
+        } else if (event == PTRACE_EVENT_EXEC) {
+            // CLOEXEC fd'ler kapandı; kalanlar gerektikçe yeniden çözülür
+            m_impl->fdTables.erase(pid);
+        } else if (event == 0) {
+            // Otomatik izlenen yeni çocuğun ilk SIGSTOP'u (fork event'inden
+            // önce gelebilir) bastırılır; diğer sinyaller iletilir
+            bool newChild = m_impl->tracees.insert(pid).second;
+            inject = (newChild && sig == SIGSTOP) ? 0 : sig;
+        }
+        // Diğer event'ler sinyalsiz devam eder
+    }
+    
+    // Tracee durmuşken, kilitsiz (callback interceptor'ı çağırabilir)
+    if (handle) {
+        m_impl->handledCount++;
+        handleSyscall(pid, nr, args);
+        if (done.write.fd >= 0) {
+            m_impl->tracker->beforeWrite(done.write.fd, done.write.path,
+                                         done.write.offset, done.write.size);
+        }
+    }
+    if (exited && m_impl->tracker) {
+        if (!opened.empty()) {
+            m_impl->tracker->invalidateFile(opened);
+        }
+        if (done.write.fd >= 0) {
+            bool ok = rval >= 0;
+            m_impl->tracker->afterWrite(done.write.fd, done.write.path, done.write.offset,
+                                        ok ? static_cast<size_t>(rval) : 0, ok);
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    if (m_impl->attached && m_impl->stoppedPid == pid) {
+        m_impl->resume(inject);
+    }
+    return m_impl->attached;
+}
+
+void SyscallInterceptor::run() {
+    while (processNextEvent()) {}
+}
+
+int SyscallInterceptor::getExitStatus() const {
+    return m_impl->exitStatus;
+}
+
+void SyscallInterceptor::setTraceMode(SyscallTraceMode mode) {
+    m_impl->mode = mode;
+}
+
+SyscallTraceMode SyscallInterceptor::getTraceMode() const {
+    return m_impl->mode;
+}
+
+SyscallTraceMode SyscallInterceptor::getActiveTraceMode() const {
+    return m_impl->activeMode;
+}
+
+bool SyscallInterceptor::isSeccompTraceSupported() {
+#if defined(SYS_seccomp) && defined(SECCOMP_GET_ACTION_AVAIL)
+    if (SECCOMP_AUDIT_ARCH == 0) return false;
+    uint32_t action = SECCOMP_RET_TRACE;
+    return syscall(SYS_seccomp, SECCOMP_GET_ACTION_AVAIL, 0, &action) == 0;
+#else
+    return false;
+#endif
+}
+
 void SyscallInterceptor::interceptWrite(bool enable) {
     m_impl->interceptWrite = enable;
 }
@@ -770,6 +1722,18 @@ void SyscallInterceptor::interceptAll(bool enable) {
     m_impl->interceptTruncate = enable;
 }
 
+std::vector<long> SyscallInterceptor::getTrackedSyscalls() const {
+    return m_impl->trackedSyscalls();
+}
+
+uint64_t SyscallInterceptor::getStopCount() const {
+    return m_impl->stopCount;
+}
+
+uint64_t SyscallInterceptor::getHandledSyscallCount() const {
+    return m_impl->handledCount;
+}
+
 void SyscallInterceptor::setSyscallCallback(SyscallCallback callback) {
     m_impl->callback = std::move(callback);
 }
@@ -786,14 +1750,8 @@ void SyscallInterceptor::handleSyscall(pid_t pid, long syscallNum,
     
     // Handle specific syscalls
     switch (syscallNum) {
-#ifdef SYS_write
-        case SYS_write:
-            if (m_impl->interceptWrite && args.size() >= 3) {
-                // args: fd, buf, count
-                // Note: Would need to resolve fd to path via /proc/<pid>/fd/<fd>
-            }
-            break;
-#endif
+        // write ailesi processNextEvent'te fd tablosuyla çözülüp
+        // beforeWrite/afterWrite olarak kaydedilir
             
 #ifdef SYS_unlink
         case SYS_unlink:
@@ -0,0 +1,390 @@
+#include "real_process/tracee_supervisor.hpp"
+#include <sys/epoll.h>
+#include <sys/ptrace.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <algorithm>
+#include <chrono>
+
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif
+
+namespace checkpoint {
+namespace real_process {
+
+std::string traceeStateToString(TraceeSupervisor::TraceeState state) {
+    switch (state) {
+        case TraceeSupervisor::TraceeState::Running:      return "Running";
+        case TraceeSupervisor::TraceeState::Interrupting: return "Interrupting";
+        case TraceeSupervisor::TraceeState::Stopped:      return "Stopped";
+        case TraceeSupervisor::TraceeState::Dumping:      return "Dumping";
+        case TraceeSupervisor::TraceeState::Exited:       return "Exited";
+        default:                                          return "Unknown";
+    }
+}
+
+namespace {
+
+bool isGroupStopSignal(int sig) {
+    return sig == SIGSTOP || sig == SIGTSTP || sig == SIGTTIN || sig == SIGTTOU;
+}
+
+} // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+TraceeSupervisor::TraceeSupervisor() {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGCHLD);
+    pthread_sigmask(SIG_BLOCK, &set, &m_oldMask);
+
+    m_signalFd = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFd >= 0 && m_signalFd >= 0) {
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = m_signalFd;
+        epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_signalFd, &ev);
+    }
+}
+
+TraceeSupervisor::~TraceeSupervisor() {
+    for (pid_t pid : getTracees()) {
+        remove(pid, WAKE_SLICE_MS);
+    }
+    // Detach edilemeyenler: fd'leri kapat (tracer çıkınca kernel bırakır)
+    for (auto& [pid, tracee] : m_tracees) {
+        if (tracee.pidfd >= 0) close(tracee.pidfd);
+    }
+    m_tracees.clear();
+
+    if (m_epollFd >= 0) close(m_epollFd);
+    if (m_signalFd >= 0) close(m_signalFd);
+    pthread_sigmask(SIG_SETMASK, &m_oldMask, nullptr);
+}
+
+// ============================================================================
+// Tracee yönetimi
+// ============================================================================
+
+PtraceError TraceeSupervisor::add(pid_t pid) {
+    if (pid <= 0) {
+        return PtraceError::INVALID_ARGUMENT;
+    }
+    auto it = m_tracees.find(pid);
+    if (it != m_tracees.end()) {
+        if (it->second.state != TraceeState::Exited) {
+            return PtraceError::ALREADY_TRACED;
+        }
+        forget(pid, it->second);        // Aynı pid yeniden kullanılmış
+    }
+
+    if (ptrace(PTRACE_SEIZE, pid, nullptr, nullptr) == -1) {
+        return errnoToPtraceError();
+    }
+
+    Tracee tracee;
+    // pidfd yoksa (eski kernel) çıkış da SIGCHLD ile fark edilir
+    tracee.pidfd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+    if (tracee.pidfd >= 0 && m_epollFd >= 0) {
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = tracee.pidfd;
+        epoll_ctl(m_epollFd, EPOLL_CTL_ADD, tracee.pidfd, &ev);
+    }
+    m_tracees.emplace(pid, tracee);
+    return PtraceError::SUCCESS;
+}
+
+PtraceError TraceeSupervisor::remove(pid_t pid, int timeoutMs) {
+    auto it = m_tracees.find(pid);
+    if (it == m_tracees.end()) {
+        return PtraceError::NO_SUCH_PROCESS;
+    }
+    it->second.detaching = true;
+
+    if (it->second.state == TraceeState::Running) {
+        PtraceError err = interrupt(pid);
+        if (err != PtraceError::SUCCESS && err != PtraceError::NO_SUCH_PROCESS) {
+            it->second.detaching = false;
+            return err;
+        }
+    }
+
+    // Detach sadece durmuş tracee'de geçerli
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        it = m_tracees.find(pid);
+        if (it == m_tracees.end()) {
+            return PtraceError::SUCCESS;
+        }
+        if (it->second.state != TraceeState::Interrupting) break;
+
+        int remaining = -1;
+        if (timeoutMs >= 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0) {
+                it->second.detaching = false;
+                return PtraceError::NOT_STOPPED;
+            }
+            remaining = static_cast<int>(left);
+        }
+        poll(remaining);
+    }
+
+    Tracee& tracee = it->second;
+    PtraceError result = PtraceError::SUCCESS;
+    if (tracee.state != TraceeState::Exited &&
+        ptrace(PTRACE_DETACH, pid, nullptr, tracee.pendingSignal) == -1 && errno != ESRCH) {
+        result = errnoToPtraceError();
+    }
+    forget(pid, tracee);
+    return result;
+}
+
+PtraceError TraceeSupervisor::interrupt(pid_t pid) {
+    auto it = m_tracees.find(pid);
+    if (it == m_tracees.end() || it->second.state == TraceeState::Exited) {
+        return PtraceError::NO_SUCH_PROCESS;
+    }
+    if (it->second.state != TraceeState::Running) {
+        return PtraceError::SUCCESS;        // Zaten duruyor / durmak üzere
+    }
+    if (ptrace(PTRACE_INTERRUPT, pid, nullptr, nullptr) == -1) {
+        return errnoToPtraceError();
+    }
+    it->second.state = TraceeState::Interrupting;
+    return PtraceError::SUCCESS;
+}
+
+size_t TraceeSupervisor::interruptAll() {
+    size_t sent = 0;
+    for (auto& [pid, tracee] : m_tracees) {
+        if (tracee.state == TraceeState::Running &&
+            ptrace(PTRACE_INTERRUPT, pid, nullptr, nullptr) == 0) {
+            tracee.state = TraceeState::Interrupting;
+            sent++;
+        }
+    }
+    return sent;
+}
+
+PtraceError TraceeSupervisor::resume(pid_t pid) {
+    auto it = m_tracees.find(pid);
+    if (it == m_tracees.end() || it->second.state == TraceeState::Exited) {
+        return PtraceError::NO_SUCH_PROCESS;
+    }
+    Tracee& tracee = it->second;
+    if (tracee.state == TraceeState::Running) {
+        return PtraceError::SUCCESS;
+    }
+    if (tracee.state == TraceeState::Interrupting) {
+        return PtraceError::NOT_STOPPED;
+    }
+
+    if (ptrace(PTRACE_CONT, pid, nullptr, tracee.pendingSignal) == -1) {
+        return errnoToPtraceError();    // ESRCH: öldü, çıkış olayı poll'da gelir
+    }
+    tracee.pendingSignal = 0;
+    tracee.state = TraceeState::Running;
+    return PtraceError::SUCCESS;
+}
+
+size_t TraceeSupervisor::resumeAll() {
+    size_t resumed = 0;
+    for (pid_t pid : getTracees()) {
+        auto state = getState(pid);
+        if ((state == TraceeState::Stopped || state == TraceeState::Dumping) &&
+            resume(pid) == PtraceError::SUCCESS) {
+            resumed++;
+        }
+    }
+    return resumed;
+}
+
+// ============================================================================
+// Event loop
+// ============================================================================
+
+size_t TraceeSupervisor::poll(int timeoutMs) {
+    // Kurulumdan önce gelmiş ya da sinyali kaçmış olaylar
+    size_t handled = drainEvents();
+    if (handled > 0 || timeoutMs == 0 || m_epollFd < 0) {
+        return handled;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    epoll_event events[16];
+    while (true) {
+        int slice = WAKE_SLICE_MS;
+        if (timeoutMs > 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0) return 0;
+            slice = static_cast<int>(std::min<int64_t>(left, WAKE_SLICE_MS));
+        }
+
+        int n = epoll_wait(m_epollFd, events, 16, slice);
+        if (n > 0 && m_signalFd >= 0) {
+            // Birikmiş SIGCHLD'leri tüket; hangi çocuğun olduğu önemli değil
+            signalfd_siginfo info;
+            while (read(m_signalFd, &info, sizeof(info)) == sizeof(info)) {
+            }
+        }
+
+        handled = drainEvents();
+        if (handled > 0) {
+            return handled;
+        }
+    }
+}
+
+bool TraceeSupervisor::waitForAllStopped(int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (count(TraceeState::Interrupting) > 0) {
+        int remaining = -1;
+        if (timeoutMs >= 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0) return false;
+            remaining = static_cast<int>(left);
+        }
+        poll(remaining);
+    }
+    return true;
+}
+
+size_t TraceeSupervisor::drainEvents() {
+    size_t handled = 0;
+    std::vector<pid_t> stopped;
+    std::vector<std::pair<pid_t, int>> exited;
+
+    for (auto& [pid, tracee] : m_tracees) {
+        if (tracee.state == TraceeState::Exited) continue;
+
+        int status = 0;
+        pid_t waited;
+        while ((waited = waitpid(pid, &status, WNOHANG | __WALL)) == pid) {
+            if (handleStatus(pid, tracee, status)) {
+                handled++;
+                if (tracee.state == TraceeState::Exited) {
+                    exited.emplace_back(pid, status);
+                } else if (!tracee.detaching) {
+                    stopped.push_back(pid);
+                }
+            }
+            if (tracee.state == TraceeState::Exited || tracee.state == TraceeState::Stopped) break;
+        }
+        if (waited == -1 && errno == ECHILD) {
+            // Başka biri reap etti: artık tracee değil
+            handleStatus(pid, tracee, 0);
+            exited.emplace_back(pid, 0);
+            handled++;
+        }
+    }
+
+    // Handler'lar döngü dışında: tracee ekleyip çıkarabilirler
+    if (m_onExit) {
+        for (const auto& [pid, status] : exited) {
+            m_onExit(pid, status);
+        }
+    }
+    for (pid_t pid : stopped) {
+        auto it = m_tracees.find(pid);
+        if (it == m_tracees.end() || it->second.state != TraceeState::Stopped || !m_onStop) {
+            continue;
+        }
+        it->second.state = TraceeState::Dumping;
+        bool resumeAfter = m_onStop(pid);
+
+        it = m_tracees.find(pid);
+        if (it == m_tracees.end() || it->second.state != TraceeState::Dumping) {
+            continue;           // Handler remove / resume çağırdı
+        }
+        it->second.state = TraceeState::Stopped;
+        if (resumeAfter) {
+            resume(pid);
+        }
+    }
+    return handled;
+}
+
+bool TraceeSupervisor::handleStatus(pid_t pid, Tracee& tracee, int status) {
+    if (WIFEXITED(status) || WIFSIGNALED(status)) {
+        tracee.state = TraceeState::Exited;
+        if (tracee.pidfd >= 0) {
+            close(tracee.pidfd);            // epoll'dan da düşer
+            tracee.pidfd = -1;
+        }
+        return true;
+    }
+    if (!WIFSTOPPED(status)) {
+        return false;
+    }
+
+    int sig = WSTOPSIG(status);
+    int event = status >> 16;
+
+    if (tracee.state == TraceeState::Interrupting) {
+        // event == 0: interrupt'tan önce gelen bir sinyalin delivery-stop'u;
+        // yutulmasın diye resume / detach'te geri verilir
+        tracee.pendingSignal = (event == 0) ? sig : 0;
+        tracee.state = TraceeState::Stopped;
+        return true;
+    }
+    if (tracee.state != TraceeState::Running) {
+        return false;
+    }
+
+    // İstenmemiş durma: tracee'yi çalışır tut
+    if (event == 0) {
+        ptrace(PTRACE_CONT, pid, nullptr, sig);         // Sinyali olduğu gibi ilet
+    } else if (event == PTRACE_EVENT_STOP && isGroupStopSignal(sig)) {
+        ptrace(PTRACE_LISTEN, pid, nullptr, nullptr);   // Job control durması korunur
+    } else {
+        ptrace(PTRACE_CONT, pid, nullptr, nullptr);     // Önceki interrupt'ın artığı
+    }
+    return false;
+}
+
+void TraceeSupervisor::forget(pid_t pid, Tracee& tracee) {
+    if (tracee.pidfd >= 0) {
+        close(tracee.pidfd);
+    }
+    m_tracees.erase(pid);
+}
+
+// ============================================================================
+// Sorgular
+// ============================================================================
+
+TraceeSupervisor::TraceeState TraceeSupervisor::getState(pid_t pid) const {
+    auto it = m_tracees.find(pid);
+    return it == m_tracees.end() ? TraceeState::Exited : it->second.state;
+}
+
+std::vector<pid_t> TraceeSupervisor::getTracees() const {
+    std::vector<pid_t> pids;
+    pids.reserve(m_tracees.size());
+    for (const auto& [pid, tracee] : m_tracees) {
+        pids.push_back(pid);
+    }
+    return pids;
+}
+
+size_t TraceeSupervisor::count(TraceeState state) const {
+    return static_cast<size_t>(std::count_if(m_tracees.begin(), m_tracees.end(),
+        [state](const auto& entry) { return entry.second.state == state; }));
+}
+
+} // namespace real_process
+} // namespace checkpoint
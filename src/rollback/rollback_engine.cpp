@@ -1,8 +1,11 @@
 #include "rollback/rollback_engine.hpp"
+#include "rollback/state_delta.hpp"
+#include "core/checksum.hpp"
+#include "core/metrics.hpp"
 #include "real_process/file_operation.hpp"
 #include "real_process/reverse_executor.hpp"
 #include "utils/helpers.hpp"
-#include <stack>
+#include <deque>
 #include <algorithm>
 
 namespace checkpoint {
@@ -13,9 +16,17 @@ struct RollbackEngine::Impl {
     std::shared_ptr<StateManager> stateManager;
     std::shared_ptr<OperationLogger> logger;
     
-    std::stack<StateData> undoStack;  // Geri alınan durumları sakla
+    // Undo kaydı: rollback sonrası durumdan öncekine delta. Kayıt sadece
+    // durum rollback'ten beri değişmediyse (crc tutuyorsa) uygulanır.
+    struct UndoEntry {
+        BlockDelta delta;
+        uint32_t restoredCrc;
+    };
+    std::deque<UndoEntry> undoStack;
     size_t maxUndoHistory = 10;
     
+    DeltaChain deltaChain;
+    
     std::function<bool(const RollbackPlan&)> confirmationCallback;
     
     size_t rollbackCount = 0;
@@ -26,7 +37,32 @@ struct RollbackEngine::Impl {
     std::unique_ptr<real_process::ReverseExecutor> reverseExecutor;
     bool enableReverseExecution = true;
     
-    std::mutex mutex;
+    mutable std::mutex mutex;
+    
+    // Delta zinciri yöneticinin bildiği durumla uyuşuyor mu
+    bool chainInSync(const SharedBuffer& current) const {
+        return deltaChain.isInitialized() && current == deltaChain.current();
+    }
+    
+    // Incremental: hedef durumu deltalardan üret; mümkün değilse nullopt
+    std::optional<SharedBuffer> incrementalTarget(const RollbackPlan& plan,
+                                                  const SharedBuffer& current,
+                                                  std::string& reason) const {
+        if (plan.operationsToUndo.empty()) {
+            reason = "no operations recorded since checkpoint";
+            return std::nullopt;
+        }
+        if (!chainInSync(current)) {
+            reason = "state changed outside recorded operations";
+            return std::nullopt;
+        }
+        auto target = deltaChain.stateBefore(plan.operationsToUndo.front().id);
+        if (target.isError()) {
+            reason = target.message;
+            return std::nullopt;
+        }
+        return SharedBuffer(std::move(*target.value));
+    }
 };
 
 RollbackEngine::RollbackEngine(std::shared_ptr<StateManager> stateManager,
@@ -48,8 +84,10 @@ RollbackEngine& RollbackEngine::operator=(RollbackEngine&&) noexcept = default;
 Result<RollbackPlan> RollbackEngine::createRollbackPlan(CheckpointId targetId, 
                                                         RollbackStrategy strategy) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
+    TraceScope trace("rollback.plan");
     
     // Hedef checkpoint'i kontrol et
+    trace.stage("resolve_target");
     auto checkpointResult = m_impl->stateManager->getCheckpoint(targetId);
     if (checkpointResult.isError()) {
         return Result<RollbackPlan>::failure(checkpointResult.error, checkpointResult.message);
@@ -60,9 +98,12 @@ Result<RollbackPlan> RollbackEngine::createRollbackPlan(CheckpointId targetId,
     plan.strategy = strategy;
     
     // Bu checkpoint'ten sonraki işlemleri bul
+    trace.stage("collect_operations");
     if (m_impl->logger) {
         plan.operationsToUndo = m_impl->logger->getOperationsSince(targetId);
     }
+    trace.endStage();
+    trace.count("operations", plan.operationsToUndo.size());
     
     // Tahmini süre hesapla
     plan.estimatedTime = Duration(plan.operationsToUndo.size() * 10);  // 10ms per operation
@@ -74,12 +115,14 @@ Result<RollbackPlan> RollbackEngine::createRollbackPlan(CheckpointId targetId,
     // Onay gereksinimi
     plan.requiresConfirmation = (plan.operationsToUndo.size() > 10);
     
+    trace.succeed();
     return Result<RollbackPlan>::success(plan);
 }
 
 Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
                                                        ProgressCallback progress) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
+    TraceScope trace("rollback.execute");
     
     auto startTime = utils::TimeUtils::now();
     RollbackResult result;
@@ -94,30 +137,30 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
         }
     }
     
-    // Mevcut durumu kaydet (undo için)
-    auto currentStateResult = m_impl->stateManager->getCurrentState();
-    if (currentStateResult.isSuccess()) {
-        if (m_impl->undoStack.size() >= m_impl->maxUndoHistory) {
-            // En eski undo kaydını sil
-            std::stack<StateData> temp;
-            while (m_impl->undoStack.size() > 1) {
-                temp.push(m_impl->undoStack.top());
-                m_impl->undoStack.pop();
-            }
-            m_impl->undoStack.pop();  // En eskisini at
-            while (!temp.empty()) {
-                m_impl->undoStack.push(temp.top());
-                temp.pop();
-            }
+    // Mevcut durum (undo deltası bundan hesaplanır). Durum ve hedef
+    // checkpoint verisi paylaşılan buffer'lardır; geri yükleme kopya almaz,
+    // sadece yöneticideki referansı değiştirir.
+    trace.stage("resolve_target");
+    SharedBuffer currentState = m_impl->stateManager->getCurrentStateBuffer();
+    
+    // Hedef durumu üret: Incremental deltalardan, diğerleri checkpoint verisinden
+    std::optional<SharedBuffer> targetState;
+    if (plan.strategy == RollbackStrategy::Incremental) {
+        std::string reason;
+        targetState = m_impl->incrementalTarget(plan, currentState, reason);
+        if (!targetState) {
+            result.warnings.push_back("Incremental rollback fell back to full restore: " + reason);
+            trace.count("incremental_fallbacks");
         }
-        m_impl->undoStack.push(*currentStateResult.value);
     }
     
-    // Hedef checkpoint'i al
-    auto checkpointResult = m_impl->stateManager->getCheckpoint(plan.targetCheckpoint);
-    if (checkpointResult.isError()) {
-        result.errorMessage = checkpointResult.message;
-        return Result<RollbackResult>::success(result);
+    if (!targetState) {
+        auto checkpointResult = m_impl->stateManager->getCheckpointHandle(plan.targetCheckpoint);
+        if (checkpointResult.isError()) {
+            result.errorMessage = checkpointResult.message;
+            return Result<RollbackResult>::success(result);
+        }
+        targetState = (*checkpointResult.value)->getData();
     }
     
     // ============================================================
@@ -127,6 +170,7 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
         if (progress) {
             progress(0.1, "Reversing file operations...");
         }
+        trace.stage("reverse_files");
         
         // Get file operations since the target checkpoint
         auto& fileLog = m_impl->fileTracker->getLog();
@@ -144,6 +188,7 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
             
             // Execute reverse operations in LIFO order
             auto reverseResult = m_impl->reverseExecutor->reverseOperations(fileOps);
+            trace.count("file_operations_reversed", reverseResult.successCount);
             
             if (!reverseResult.allSucceeded) {
                 for (const auto& res : reverseResult.results) {
@@ -163,6 +208,7 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
     // ============================================================
     
     // İşlemleri geri al (state operations)
+    trace.stage("undo_operations");
     size_t totalOps = plan.operationsToUndo.size();
     for (size_t i = 0; i < totalOps; ++i) {
         if (progress) {
@@ -174,19 +220,33 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
         result.operationsUndone++;
     }
     
-    // Durumu geri yükle
-    // Not: Bu basit implementasyonda sadece checkpoint verisini geri yüklüyoruz
-    // Gerçek uygulamada daha karmaşık olabilir
+    // Durumu geri yükle; undo için sadece farkı sakla
+    trace.stage("restore_state");
+    if (m_impl->undoStack.size() >= m_impl->maxUndoHistory && !m_impl->undoStack.empty()) {
+        m_impl->undoStack.pop_front();  // En eskisini at
+    }
+    if (m_impl->maxUndoHistory > 0) {
+        m_impl->undoStack.push_back({BlockDelta::compute(targetState->data(), targetState->size(),
+                                                         currentState.data(), currentState.size()),
+                                     crc32c(targetState->data(), targetState->size())});
+    }
+    bool chainWasInSync = m_impl->chainInSync(currentState);
+    m_impl->stateManager->setCurrentState(*targetState);
     
     if (progress) {
         progress(1.0, "Rollback completed");
     }
     
-    // Loglama
+    // Loglama; rollback da zincirde bir adım olur (sonraki rollback'ler
+    // bunun üzerinden geri gidebilir)
+    trace.stage("log");
     if (m_impl->logger) {
-        m_impl->logger->logOperation(OperationType::Rollback, 
-                                     plan.description, 
-                                     plan.targetCheckpoint);
+        OperationId opId = m_impl->logger->logOperation(OperationType::Rollback, 
+                                                        plan.description, 
+                                                        plan.targetCheckpoint);
+        if (chainWasInSync) {
+            m_impl->deltaChain.record(opId, targetState->data(), targetState->size());
+        }
     }
     
     result.success = true;
@@ -198,6 +258,10 @@ Result<RollbackResult> RollbackEngine::executeRollback(const RollbackPlan& plan,
     m_impl->rollbackCount++;
     m_impl->totalRollbackTime += result.timeTaken;
     
+    trace.endStage();
+    trace.count("operations_undone", result.operationsUndone);
+    trace.count("state_bytes", targetState->size());
+    trace.succeed();
     return Result<RollbackResult>::success(result);
 }
 
@@ -299,11 +363,19 @@ Result<void> RollbackEngine::undoRollback() {
         return Result<void>::failure(ErrorCode::InvalidState, "No rollback to undo");
     }
     
-    StateData previousState = m_impl->undoStack.top();
-    m_impl->undoStack.pop();
+    SharedBuffer current = m_impl->stateManager->getCurrentStateBuffer();
+    const auto& entry = m_impl->undoStack.back();
+    if (crc32c(current.data(), current.size()) != entry.restoredCrc) {
+        return Result<void>::failure(ErrorCode::InvalidState, "State changed since rollback");
+    }
+    bool chainWasInSync = m_impl->chainInSync(current);
+    
+    // Delta yerinde uygulanır: paylaşılan buffer'ın tek kopyası
+    StateData previousState = current.toVector();
+    entry.delta.apply(previousState);
+    m_impl->undoStack.pop_back();
     
     // Durumu geri yükle
-    auto id = utils::IdGenerator::generateCheckpointId();
     auto result = m_impl->stateManager->createCheckpoint("UndoRollback", previousState);
     
     if (result.isError()) {
@@ -311,16 +383,96 @@ Result<void> RollbackEngine::undoRollback() {
     }
     
     if (m_impl->logger) {
-        m_impl->logger->logOperation(OperationType::Rollback, "Undo rollback", *result.value);
+        OperationId opId = m_impl->logger->logOperation(OperationType::Rollback, "Undo rollback", *result.value);
+        if (chainWasInSync) {
+            m_impl->deltaChain.record(opId, previousState);
+        }
     }
     
     return Result<void>::success();
 }
 
 bool RollbackEngine::canUndoRollback() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
     return !m_impl->undoStack.empty();
 }
 
+Result<OperationId> RollbackEngine::recordStateChange(const std::string& description,
+                                                      const StateData& newState,
+                                                      CheckpointId relatedCheckpoint) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    
+    // Zincir dışarıdan değişen duruma (ör. yeni checkpoint) yeniden bağlanır
+    SharedBuffer current = m_impl->stateManager->getCurrentStateBuffer();
+    if (!m_impl->chainInSync(current)) {
+        m_impl->deltaChain.reset(current.toVector());
+    }
+    
+    OperationId opId = m_impl->logger
+        ? m_impl->logger->logOperation(OperationType::Update, description, relatedCheckpoint)
+        : utils::IdGenerator::generateOperationId();
+    
+    m_impl->deltaChain.record(opId, newState);
+    m_impl->stateManager->setCurrentState(newState);
+    
+    return Result<OperationId>::success(opId);
+}
+
+Result<RollbackResult> RollbackEngine::mergeFromCheckpoint(CheckpointId targetId,
+                                                           const StateMerge& merge,
+                                                           const std::string& description) {
+    auto startTime = utils::TimeUtils::now();
+    RollbackResult result;
+    result.success = false;
+    result.restoredCheckpoint = targetId;
+    result.operationsUndone = 0;
+    
+    auto target = m_impl->stateManager->getCheckpointHandle(targetId);
+    if (target.isError()) {
+        result.errorMessage = target.message;
+        return Result<RollbackResult>::success(result);
+    }
+    
+    SharedBuffer current = m_impl->stateManager->getCurrentStateBuffer();
+    const SharedBuffer& targetData = (*target.value)->getData();
+    auto merged = merge(std::span<const uint8_t>(current.data(), current.size()),
+                        std::span<const uint8_t>(targetData.data(), targetData.size()));
+    if (!merged) {
+        result.errorMessage = "State could not be merged with checkpoint";
+        return Result<RollbackResult>::success(result);
+    }
+    
+    auto recorded = recordStateChange(description, *merged, targetId);
+    if (recorded.isError()) {
+        result.errorMessage = recorded.message;
+        return Result<RollbackResult>::success(result);
+    }
+    result.success = true;
+    
+    auto endTime = utils::TimeUtils::now();
+    result.timeTaken = std::chrono::duration_cast<Duration>(endTime - startTime);
+    
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->rollbackCount++;
+    m_impl->totalRollbackTime += result.timeTaken;
+    
+    return Result<RollbackResult>::success(result);
+}
+
+void RollbackEngine::setDeltaCompactionInterval(size_t interval) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->deltaChain.setCompactionInterval(interval);
+}
+
+size_t RollbackEngine::getDeltaMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    size_t total = m_impl->deltaChain.memoryUsage();
+    for (const auto& entry : m_impl->undoStack) {
+        total += entry.delta.memoryUsage();
+    }
+    return total;
+}
+
 void RollbackEngine::setConfirmationCallback(std::function<bool(const RollbackPlan&)> callback) {
     m_impl->confirmationCallback = callback;
 }
@@ -367,6 +519,7 @@ AutoRollbackManager::AutoRollbackManager(std::shared_ptr<RollbackEngine> engine,
                                          std::shared_ptr<StateManager> stateManager)
     : m_engine(engine)
     , m_stateManager(stateManager)
+    , m_scrubber(std::make_unique<IntegrityScrubber>(stateManager))
     , m_enabled(false)
     , m_checkInterval(Duration(5000))  // 5 saniye
     , m_running(false) {
@@ -380,6 +533,7 @@ void AutoRollbackManager::start() {
     if (m_running) return;
     
     m_running = true;
+    m_scrubber->start();
     m_monitorThread = std::thread(&AutoRollbackManager::monitorLoop, this);
 }
 
@@ -388,6 +542,7 @@ void AutoRollbackManager::stop() {
     if (m_monitorThread.joinable()) {
         m_monitorThread.join();
     }
+    m_scrubber->stop();
 }
 
 void AutoRollbackManager::monitorLoop() {
@@ -404,19 +559,15 @@ void AutoRollbackManager::monitorLoop() {
 }
 
 bool AutoRollbackManager::detectCorruption() {
-    // Basit bütünlük kontrolü
-    auto checkpoints = m_stateManager->listCheckpoints();
-    
-    for (const auto& meta : checkpoints) {
-        auto result = m_stateManager->getCheckpoint(meta.id);
-        if (result.isSuccess()) {
-            if (!result.value->verifyIntegrity()) {
-                return true;  // Bozulma tespit edildi
-            }
+    // Tarayıcının son turdan beri bulduğu bozulmalar
+    auto corrupted = m_scrubber->takeCorrupted();
+    if (m_errorCallback) {
+        for (auto id : corrupted) {
+            m_errorCallback(ErrorCode::CheckpointCorrupted,
+                            "Checkpoint corrupted: " + std::to_string(id));
         }
     }
-    
-    return false;
+    return !corrupted.empty();
 }
 
 void AutoRollbackManager::setCheckInterval(Duration interval) {
@@ -428,7 +579,7 @@ void AutoRollbackManager::setEnabled(bool enabled) {
 }
 
 void AutoRollbackManager::setErrorCallback(ErrorCallback callback) {
-    // TODO: Hata callback'i sakla ve kullan
+    m_errorCallback = std::move(callback);
 }
 
 } // namespace checkpoint
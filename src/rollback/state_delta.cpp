@@ -0,0 +1,251 @@
+#include "rollback/state_delta.hpp"
+#include "core/binary_io.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace checkpoint {
+
+// ==================== BlockDelta ====================
+
+namespace {
+
+struct Bytes {
+    const uint8_t* data;
+    size_t size;
+};
+
+// Kısa taraf sıfırla uzatılmış gibi [off, off+len) baytını oku
+inline uint8_t byteAt(const Bytes& data, size_t pos) {
+    return pos < data.size ? data.data[pos] : 0;
+}
+
+bool blockEqual(const Bytes& a, const Bytes& b, size_t off, size_t len) {
+    if (off + len <= a.size && off + len <= b.size) {
+        return std::memcmp(a.data + off, b.data + off, len) == 0;
+    }
+    for (size_t i = off; i < off + len; ++i) {
+        if (byteAt(a, i) != byteAt(b, i)) return false;
+    }
+    return true;
+}
+
+template<typename T>
+bool readPod(const uint8_t* data, size_t size, size_t& offset, T& value) {
+    if (size - offset < sizeof(T)) return false;
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+} // namespace
+
+BlockDelta BlockDelta::compute(const StateData& from, const StateData& to, uint32_t blockSize) {
+    return compute(from.data(), from.size(), to.data(), to.size(), blockSize);
+}
+
+BlockDelta BlockDelta::compute(const uint8_t* fromData, size_t fromLen,
+                               const uint8_t* toData, size_t toLen, uint32_t blockSize) {
+    Bytes from{fromData, fromLen};
+    Bytes to{toData, toLen};
+    BlockDelta delta;
+    delta.blockSize = blockSize;
+    delta.fromSize = from.size;
+    delta.toSize = to.size;
+
+    size_t maxSize = std::max(from.size, to.size);
+    size_t blockCount = (maxSize + blockSize - 1) / blockSize;
+
+    for (size_t b = 0; b < blockCount; ++b) {
+        size_t off = b * blockSize;
+        size_t len = std::min<size_t>(blockSize, maxSize - off);
+        if (blockEqual(from, to, off, len)) continue;
+
+        delta.blocks.push_back(static_cast<uint32_t>(b));
+        size_t pos = delta.xorData.size();
+        delta.xorData.resize(pos + len);
+        uint8_t* out = delta.xorData.data() + pos;
+        for (size_t i = 0; i < len; ++i) {
+            out[i] = byteAt(from, off + i) ^ byteAt(to, off + i);
+        }
+    }
+
+    return delta;
+}
+
+bool BlockDelta::xorInto(StateData& state, uint64_t expectedSize, uint64_t resultSize) const {
+    if (state.size() != expectedSize) {
+        return false;
+    }
+
+    size_t maxSize = std::max(fromSize, toSize);
+    state.resize(maxSize, 0);
+
+    const uint8_t* src = xorData.data();
+    for (uint32_t b : blocks) {
+        size_t off = static_cast<size_t>(b) * blockSize;
+        size_t len = std::min<size_t>(blockSize, maxSize - off);
+        uint8_t* dst = state.data() + off;
+        for (size_t i = 0; i < len; ++i) {
+            dst[i] ^= src[i];
+        }
+        src += len;
+    }
+
+    state.resize(resultSize);
+    return true;
+}
+
+bool BlockDelta::apply(StateData& state) const {
+    return xorInto(state, fromSize, toSize);
+}
+
+bool BlockDelta::revert(StateData& state) const {
+    return xorInto(state, toSize, fromSize);
+}
+
+size_t BlockDelta::memoryUsage() const {
+    return sizeof(BlockDelta) + blocks.capacity() * sizeof(uint32_t) + xorData.capacity();
+}
+
+StateData BlockDelta::serialize() const {
+    StateData out;
+    out.reserve(2 * sizeof(uint32_t) + 2 * sizeof(uint64_t) +
+                blocks.size() * sizeof(uint32_t) + xorData.size());
+    BinaryWriter writer(out);
+    writer.write(blockSize);
+    writer.write(fromSize);
+    writer.write(toSize);
+    writer.write(static_cast<uint32_t>(blocks.size()));
+    writer.writeBytes(blocks.data(), blocks.size() * sizeof(uint32_t));
+    writer.writeBytes(xorData);
+    return out;
+}
+
+std::optional<BlockDelta> BlockDelta::deserialize(const uint8_t* data, size_t size) {
+    BlockDelta delta;
+    size_t offset = 0;
+    uint32_t count = 0;
+    if (!readPod(data, size, offset, delta.blockSize) || delta.blockSize == 0 ||
+        !readPod(data, size, offset, delta.fromSize) ||
+        !readPod(data, size, offset, delta.toSize) ||
+        !readPod(data, size, offset, count) ||
+        (size - offset) / sizeof(uint32_t) < count) {
+        return std::nullopt;
+    }
+
+    // Bloklar artan ve aralık içinde olmalı; xorData uzunlukları tutmalı
+    uint64_t maxSize = std::max(delta.fromSize, delta.toSize);
+    uint64_t expectedXor = 0;
+    delta.blocks.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        readPod(data, size, offset, delta.blocks[i]);
+        uint64_t off = static_cast<uint64_t>(delta.blocks[i]) * delta.blockSize;
+        if (off >= maxSize || (i > 0 && delta.blocks[i] <= delta.blocks[i - 1])) {
+            return std::nullopt;
+        }
+        expectedXor += std::min<uint64_t>(delta.blockSize, maxSize - off);
+    }
+    if (size - offset != expectedXor) {
+        return std::nullopt;
+    }
+    delta.xorData.assign(data + offset, data + size);
+    return delta;
+}
+
+// ==================== DeltaChain ====================
+
+DeltaChain::DeltaChain(uint32_t blockSize)
+    : m_blockSize(blockSize)
+    , m_compactionInterval(DEFAULT_COMPACTION_INTERVAL)
+    , m_initialized(false)
+    , m_foldedUpTo(0)
+    , m_deltaBytes(0) {
+}
+
+void DeltaChain::reset(const StateData& state) {
+    m_base = state;
+    m_current = state;
+    m_deltas.clear();
+    m_deltaBytes = 0;
+    m_initialized = true;
+}
+
+void DeltaChain::record(OperationId opId, const StateData& newState) {
+    record(opId, newState.data(), newState.size());
+}
+
+void DeltaChain::record(OperationId opId, const uint8_t* data, size_t size) {
+    if (!m_initialized) {
+        reset(StateData());
+    }
+
+    Entry entry{opId, BlockDelta::compute(m_current.data(), m_current.size(), data, size, m_blockSize)};
+    m_deltaBytes += entry.delta.memoryUsage();
+    m_deltas.push_back(std::move(entry));
+    m_current.assign(data, data + size);
+
+    while (m_deltas.size() > m_compactionInterval) {
+        foldOldest();
+    }
+}
+
+void DeltaChain::foldOldest() {
+    Entry& oldest = m_deltas.front();
+    oldest.delta.apply(m_base);
+    m_foldedUpTo = oldest.opId;
+    m_deltaBytes -= oldest.delta.memoryUsage();
+    m_deltas.pop_front();
+}
+
+void DeltaChain::compact() {
+    while (!m_deltas.empty()) {
+        foldOldest();
+    }
+}
+
+void DeltaChain::setCompactionInterval(size_t interval) {
+    m_compactionInterval = std::max<size_t>(interval, 1);
+    while (m_deltas.size() > m_compactionInterval) {
+        foldOldest();
+    }
+}
+
+Result<StateData> DeltaChain::stateBefore(OperationId opId) const {
+    if (!m_initialized) {
+        return Result<StateData>::failure(ErrorCode::InvalidState, "Delta chain is empty");
+    }
+    if (m_foldedUpTo != 0 && opId <= m_foldedUpTo) {
+        return Result<StateData>::failure(ErrorCode::RollbackFailed,
+            "Operation " + std::to_string(opId) + " was compacted into the base state");
+    }
+
+    auto it = std::lower_bound(m_deltas.begin(), m_deltas.end(), opId,
+        [](const Entry& e, OperationId id) { return e.opId < id; });
+    size_t index = it - m_deltas.begin();
+
+    // Yakın uçtan başla: tabandan ileri ya da current'tan geri
+    StateData state;
+    bool ok = true;
+    if (index < m_deltas.size() - index) {
+        state = m_base;
+        for (size_t i = 0; ok && i < index; ++i) {
+            ok = m_deltas[i].delta.apply(state);
+        }
+    } else {
+        state = m_current;
+        for (size_t i = m_deltas.size(); ok && i > index; --i) {
+            ok = m_deltas[i - 1].delta.revert(state);
+        }
+    }
+
+    if (!ok) {
+        return Result<StateData>::failure(ErrorCode::CheckpointCorrupted, "Delta size mismatch");
+    }
+    return Result<StateData>::success(std::move(state));
+}
+
+size_t DeltaChain::memoryUsage() const {
+    return m_base.capacity() + m_current.capacity() + m_deltaBytes;
+}
+
+} // namespace checkpoint
@@ -0,0 +1,87 @@
+#include "state/checkpoint_index.hpp"
+#include "core/binary_io.hpp"
+#include "core/checksum.hpp"
+#include <cstring>
+
+namespace checkpoint {
+
+// ==================== Checkpoint Index ====================
+
+namespace {
+
+constexpr char INDEX_MAGIC[4] = {'C', 'K', 'I', 'X'};
+constexpr uint32_t INDEX_VERSION = 2;
+
+} // namespace
+
+CheckpointIndexEntry makeCheckpointIndexEntry(const Checkpoint& checkpoint, size_t storedSize) {
+    CheckpointIndexEntry entry;
+    entry.metadata = checkpoint.getMetadata();
+    entry.storedSize = storedSize;
+    // Checkpoint::serialize düzeni: metaSize u32 | meta | dataSize u32 | data
+    entry.dataOffset = sizeof(uint32_t) + entry.metadata.serializedSize() + sizeof(uint32_t);
+    return entry;
+}
+
+StateData serializeCheckpointIndex(const std::map<CheckpointId, CheckpointIndexEntry>& index) {
+    StateData out;
+    BinaryWriter writer(out);
+    writer.writeBytes(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    writer.write(INDEX_VERSION);
+    writer.write(static_cast<uint32_t>(index.size()));
+    for (const auto& [id, entry] : index) {
+        auto meta = entry.metadata.serialize();
+        writer.write(static_cast<uint32_t>(meta.size()));
+        writer.writeBytes(meta);
+        writer.write(entry.storedSize);
+        writer.write(entry.dataOffset);
+        writer.write(static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            entry.lastVerified.time_since_epoch()).count()));
+    }
+    writer.write(crc32c(out.data(), out.size()));
+    return out;
+}
+
+std::optional<std::map<CheckpointId, CheckpointIndexEntry>> deserializeCheckpointIndex(const StateData& data) {
+    if (data.size() < sizeof(INDEX_MAGIC) + 3 * sizeof(uint32_t) ||
+        std::memcmp(data.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        return std::nullopt;
+    }
+    
+    size_t end = data.size() - sizeof(uint32_t);
+    uint32_t storedCrc;
+    std::memcpy(&storedCrc, data.data() + end, sizeof(storedCrc));
+    if (storedCrc != crc32c(data.data(), end)) {
+        return std::nullopt;
+    }
+    
+    BinaryReader reader(std::span<const uint8_t>(data.data(), end));
+    reader.skip(sizeof(INDEX_MAGIC));
+    uint32_t version = reader.read<uint32_t>();
+    uint32_t count = reader.read<uint32_t>();
+    if (!reader.ok() || version == 0 || version > INDEX_VERSION) {
+        return std::nullopt;
+    }
+    
+    std::map<CheckpointId, CheckpointIndexEntry> index;
+    for (uint32_t i = 0; i < count; ++i) {
+        auto meta = reader.readBytes(reader.read<uint32_t>());
+        if (!reader.ok()) {
+            return std::nullopt;
+        }
+        CheckpointIndexEntry entry;
+        entry.metadata = CheckpointMetadata::deserialize(meta);
+        reader.read(entry.storedSize);
+        reader.read(entry.dataOffset);
+        if (version >= 2) {
+            entry.lastVerified = Timestamp(std::chrono::milliseconds(reader.read<int64_t>()));
+        }
+        if (!reader.ok()) {
+            return std::nullopt;
+        }
+        index[entry.metadata.id] = std::move(entry);
+    }
+    return index;
+}
+
+} // namespace checkpoint
@@ -0,0 +1,163 @@
+#include "state/integrity_scrubber.hpp"
+#include "utils/helpers.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace checkpoint {
+
+// ==================== IntegrityScrubber ====================
+
+IntegrityScrubber::IntegrityScrubber(std::shared_ptr<StateManager> stateManager)
+    : m_stateManager(std::move(stateManager)) {
+}
+
+IntegrityScrubber::~IntegrityScrubber() {
+    stop();
+}
+
+void IntegrityScrubber::start() {
+    if (m_running) return;
+
+    m_running = true;
+    m_thread = std::thread(&IntegrityScrubber::scrubLoop, this);
+}
+
+void IntegrityScrubber::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+        m_cv.notify_all();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void IntegrityScrubber::setBytesPerSecond(uint64_t bytesPerSecond) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bytesPerSecond = bytesPerSecond;
+}
+
+void IntegrityScrubber::setReverifyInterval(Duration interval) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_reverifyInterval = interval;
+}
+
+void IntegrityScrubber::setIdleInterval(Duration interval) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_idleInterval = interval;
+}
+
+void IntegrityScrubber::setCorruptionCallback(CorruptionCallback callback) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_onCorruption = std::move(callback);
+}
+
+bool IntegrityScrubber::scrubNext() {
+    return verifyOne().has_value();
+}
+
+std::vector<CheckpointId> IntegrityScrubber::takeCorrupted() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::exchange(m_corrupted, {});
+}
+
+IntegrityScrubber::Stats IntegrityScrubber::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::optional<uint64_t> IntegrityScrubber::verifyOne() {
+    Duration reverifyInterval;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        reverifyInterval = m_reverifyInterval;
+    }
+
+    auto now = utils::TimeUtils::now();
+    auto candidates = m_stateManager->getScrubCandidates();
+
+    // Doğrulamadan sonra yazılan (store lastVerified'ı sıfırlar) ya da okunan
+    // kayıtlar önce; en son etkinlik en önde
+    const ScrubCandidate* next = nullptr;
+    Timestamp nextActivity{};
+    for (const auto& c : candidates) {
+        Timestamp activity = std::max(c.modifiedAt, c.lastAccessed);
+        bool touched = c.lastVerified == Timestamp{} || c.lastAccessed > c.lastVerified;
+        if (touched && (!next || activity > nextActivity)) {
+            next = &c;
+            nextActivity = activity;
+        }
+    }
+    // Sonra vadesi geçmiş olanlar; en eski doğrulama önce
+    if (!next) {
+        for (const auto& c : candidates) {
+            if (now - c.lastVerified >= reverifyInterval &&
+                (!next || c.lastVerified < next->lastVerified)) {
+                next = &c;
+            }
+        }
+    }
+    if (!next) return std::nullopt;
+
+    CheckpointId id = next->id;
+    uint64_t size = next->storedSize;
+    auto result = m_stateManager->verifyStoredCheckpoint(id);
+    if (result.isError()) {
+        // Silinmiş / tarama sırasında güncellenmiş: sıradaki turda yeniden seçilir
+        return size;
+    }
+
+    bool intact = *result.value;
+    CorruptionCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.checkpointsVerified++;
+        m_stats.bytesVerified += size;
+        m_stateDirty = true;
+        if (!intact) {
+            m_stats.corruptionsFound++;
+            m_corrupted.push_back(id);
+            callback = m_onCorruption;
+        }
+    }
+    if (callback) {
+        callback(id);
+    }
+    return size;
+}
+
+void IntegrityScrubber::scrubLoop() {
+    while (m_running) {
+        auto verified = verifyOne();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Duration wait;
+        if (verified) {
+            // Okunan byte kadar bekle: ortalama hız bytesPerSecond'ı aşmaz
+            wait = m_bytesPerSecond == 0 ? Duration(0)
+                 : Duration(static_cast<Duration::rep>(*verified * 1000 / m_bytesPerSecond));
+        } else {
+            // Tur bitti: doğrulama zamanlarını kalıcı yap ki yeniden
+            // açılışta baştan taranmasın
+            if (m_stateDirty) {
+                m_stateDirty = false;
+                lock.unlock();
+                m_stateManager->flushIndex();
+                lock.lock();
+            }
+            wait = m_idleInterval;
+        }
+        if (wait.count() > 0) {
+            m_cv.wait_for(lock, wait, [this] { return !m_running.load(); });
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stateDirty) {
+        m_stateDirty = false;
+        m_stateManager->flushIndex();
+    }
+}
+
+} // namespace checkpoint
@@ -0,0 +1,542 @@
+#include "state/storage.hpp"
+#include "core/checksum.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace checkpoint {
+
+// ==================== LogStorage ====================
+
+namespace {
+
+constexpr char RECORD_MAGIC[4] = {'C', 'K', 'W', 'L'};
+constexpr uint8_t RECORD_PUT = 1;
+constexpr uint8_t RECORD_DEL = 2;
+constexpr size_t HEADER_SIZE = 24;
+
+// magic(4) | type(1) | pad(3) | id(8) | len(4) | crc(4)
+void encodeHeader(uint8_t* out, uint8_t type, CheckpointId id, uint32_t len, const uint8_t* payload) {
+    std::memset(out, 0, HEADER_SIZE);
+    std::memcpy(out, RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    out[4] = type;
+    uint64_t id64 = id;
+    std::memcpy(out + 8, &id64, sizeof(id64));
+    std::memcpy(out + 16, &len, sizeof(len));
+    uint32_t crc = crc32c(out, 20);
+    crc = crc32c(payload, len, crc);
+    std::memcpy(out + 20, &crc, sizeof(crc));
+}
+
+struct Header {
+    uint8_t type;
+    CheckpointId id;
+    uint32_t len;
+    uint32_t crc;
+};
+
+bool decodeHeader(const uint8_t* in, Header& header) {
+    if (std::memcmp(in, RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0) return false;
+    header.type = in[4];
+    if (header.type != RECORD_PUT && header.type != RECORD_DEL) return false;
+    uint64_t id64;
+    std::memcpy(&id64, in + 8, sizeof(id64));
+    std::memcpy(&header.len, in + 16, sizeof(header.len));
+    std::memcpy(&header.crc, in + 20, sizeof(header.crc));
+    header.id = id64;
+    return true;
+}
+
+bool headerCrcMatches(const uint8_t* headerBytes, const Header& header, const uint8_t* payload) {
+    return crc32c(payload, header.len, crc32c(headerBytes, 20)) == header.crc;
+}
+
+bool preadFull(int fd, void* buf, size_t size, uint64_t offset) {
+    uint8_t* p = static_cast<uint8_t*>(buf);
+    while (size > 0) {
+        ssize_t n = ::pread(fd, p, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+bool pwriteFull(int fd, const void* buf, size_t size, uint64_t offset) {
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    while (size > 0) {
+        ssize_t n = ::pwrite(fd, p, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+// Yeni/silinen dosya adlarının kalıcı olması için dizin de sync edilir
+void syncDirectory(const std::filesystem::path& dir) {
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+std::string segmentName(uint32_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%08u.wal", number);
+    return name;
+}
+
+} // namespace
+
+struct LogStorage::SegmentFile {
+    uint32_t number = 0;
+    int fd = -1;
+    uint64_t size = 0;          // geçerli kayıtların sonu
+    uint64_t liveBytes = 0;     // canlı PUT kayıtları (header dahil)
+    std::filesystem::path path;
+
+    ~SegmentFile() {
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+LogStorage::LogStorage(const std::filesystem::path& basePath, const LogStorageOptions& options)
+    : m_basePath(basePath)
+    , m_walPath(basePath / "wal")
+    , m_options(options)
+    , m_payloadBytes(0)
+    , m_committing(false)
+    , m_stats{}
+    , m_stopping(false) {
+    std::filesystem::create_directories(m_walPath);
+    recover();
+
+    if (m_options.backgroundCompaction) {
+        m_compactThread = std::thread(&LogStorage::compactionLoop, this);
+    }
+}
+
+LogStorage::~LogStorage() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_compactCv.notify_all();
+    if (m_compactThread.joinable()) {
+        m_compactThread.join();
+    }
+}
+
+Result<void> LogStorage::openSegment(uint32_t number) {
+    auto segment = std::make_shared<SegmentFile>();
+    segment->number = number;
+    segment->path = m_walPath / segmentName(number);
+    segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (segment->fd < 0) {
+        return Result<void>::failure(ErrorCode::IOError,
+            "Cannot open log segment " + segment->path.string() + ": " + std::strerror(errno));
+    }
+    syncDirectory(m_walPath);
+    m_segments[number] = segment;
+    m_active = segment;
+    return Result<void>::success();
+}
+
+// ---------- Recovery ----------
+
+void LogStorage::recover() {
+    std::vector<uint32_t> numbers;
+    for (const auto& entry : std::filesystem::directory_iterator(m_walPath)) {
+        if (entry.path().extension() != ".wal") continue;
+        try {
+            numbers.push_back(static_cast<uint32_t>(std::stoul(entry.path().stem().string())));
+        } catch (...) {
+            // Tanınmayan dosya - atla
+        }
+    }
+    std::sort(numbers.begin(), numbers.end());
+
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        auto segment = std::make_shared<SegmentFile>();
+        segment->number = numbers[i];
+        segment->path = m_walPath / segmentName(numbers[i]);
+        segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CLOEXEC);
+        if (segment->fd < 0) continue;
+        m_segments[segment->number] = segment;
+        recoverSegment(*segment, i + 1 == numbers.size());
+        m_active = segment;
+    }
+
+    if (!m_active) {
+        openSegment(1);
+    }
+}
+
+void LogStorage::recoverSegment(SegmentFile& segment, bool isLast) {
+    struct stat st;
+    uint64_t fileSize = (::fstat(segment.fd, &st) == 0) ? static_cast<uint64_t>(st.st_size) : 0;
+
+    uint8_t headerBytes[HEADER_SIZE];
+    std::vector<uint8_t> payload;
+    uint64_t offset = 0;
+
+    while (offset + HEADER_SIZE <= fileSize) {
+        Header header;
+        if (!preadFull(segment.fd, headerBytes, HEADER_SIZE, offset) ||
+            !decodeHeader(headerBytes, header) ||
+            offset + HEADER_SIZE + header.len > fileSize) {
+            break;
+        }
+        payload.resize(header.len);
+        if (header.len > 0 && !preadFull(segment.fd, payload.data(), header.len, offset + HEADER_SIZE)) {
+            break;
+        }
+        if (!headerCrcMatches(headerBytes, header, payload.data())) {
+            break;
+        }
+
+        PendingOp op{header.type, header.id, 0, header.len, nullptr, false, {}};
+        applyOp(op, segment.number, offset);
+        offset += HEADER_SIZE + header.len;
+        m_stats.recoveredRecords++;
+    }
+
+    segment.size = offset;
+    if (offset < fileSize) {
+        // Yarım kalan commit (çökme) ya da bozuk kuyruk: sadece aktif
+        // segmentte kesilir, eski segmentlerde geri kalanı yok sayılır
+        m_stats.truncatedBytes += fileSize - offset;
+        if (isLast && ::ftruncate(segment.fd, static_cast<off_t>(offset)) == 0) {
+            ::fdatasync(segment.fd);
+        }
+    }
+}
+
+// ---------- Group commit ----------
+
+void LogStorage::applyOp(const PendingOp& op, uint32_t segment, uint64_t recordOffset) {
+    auto it = m_index.find(op.id);
+    if (op.conditional && (it == m_index.end() || !(it->second == op.expected))) {
+        return;     // compaction sırasında üzerine yazılmış / silinmiş
+    }
+
+    if (it != m_index.end()) {
+        auto seg = m_segments.find(it->second.segment);
+        if (seg != m_segments.end()) {
+            seg->second->liveBytes -= HEADER_SIZE + it->second.size;
+        }
+        m_payloadBytes -= it->second.size;
+    }
+
+    if (op.type == RECORD_DEL) {
+        if (it != m_index.end()) m_index.erase(it);
+        return;
+    }
+
+    Location loc{segment, recordOffset, op.size};
+    m_index[op.id] = loc;
+    m_segments[segment]->liveBytes += HEADER_SIZE + op.size;
+    m_payloadBytes += op.size;
+}
+
+Result<void> LogStorage::submit(const std::vector<Append>& appends) {
+    Waiter waiter;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (const auto& append : appends) {
+        uint32_t len = append.data ? static_cast<uint32_t>(append.data->size()) : 0;
+        const uint8_t* payload = append.data ? append.data->data() : nullptr;
+
+        uint64_t offset = m_pendingBuffer.size();
+        m_pendingBuffer.resize(offset + HEADER_SIZE + len);
+        encodeHeader(m_pendingBuffer.data() + offset, append.type, append.id, len, payload);
+        if (len > 0) {
+            std::memcpy(m_pendingBuffer.data() + offset + HEADER_SIZE, payload, len);
+        }
+        m_pendingOps.push_back({append.type, append.id, offset, len, &waiter,
+                                append.conditional, append.expected});
+    }
+
+    // Commit eden yoksa lider ol; varsa onun bitirip bizi almasını bekle
+    while (!waiter.done) {
+        if (!m_committing) {
+            commitPending(lock);
+        } else {
+            m_commitCv.wait(lock);
+        }
+    }
+    return waiter.result;
+}
+
+void LogStorage::commitPending(std::unique_lock<std::mutex>& lock) {
+    m_committing = true;
+
+    std::vector<uint8_t> buffer;
+    std::vector<PendingOp> ops;
+    buffer.swap(m_pendingBuffer);
+    ops.swap(m_pendingOps);
+
+    Result<void> result = Result<void>::success();
+    if (!m_active || m_active->size >= m_options.segmentSize) {
+        uint32_t next = m_active ? m_active->number + 1 : 1;
+        result = openSegment(next);
+    }
+    std::shared_ptr<SegmentFile> segment = m_active;
+    uint64_t base = segment ? segment->size : 0;
+
+    lock.unlock();
+
+    // Tek write + tek sync; kilit tutulmadığı için bu sırada yeni kayıtlar
+    // bir sonraki batch'e birikir
+    if (result.isSuccess()) {
+        bool ok = pwriteFull(segment->fd, buffer.data(), buffer.size(), base);
+        if (ok && m_options.syncOnCommit) {
+            ok = ::fdatasync(segment->fd) == 0;
+        }
+        if (!ok) {
+            result = Result<void>::failure(ErrorCode::IOError,
+                std::string("Log commit failed: ") + std::strerror(errno));
+            // Yarım kalan kuyruk sonraki batch'in önüne geçmesin
+            if (::ftruncate(segment->fd, static_cast<off_t>(base)) != 0) {
+                result.message += " (truncate failed)";
+            }
+        }
+    }
+
+    lock.lock();
+
+    if (result.isSuccess()) {
+        segment->size = base + buffer.size();
+        for (const auto& op : ops) {
+            applyOp(op, segment->number, base + op.bufferOffset);
+        }
+        m_stats.commits++;
+        m_stats.committedRecords += ops.size();
+    }
+    for (const auto& op : ops) {
+        op.waiter->result = result;
+        op.waiter->done = true;
+    }
+
+    m_committing = false;
+    m_commitCv.notify_all();
+}
+
+// ---------- IStorage ----------
+
+Result<void> LogStorage::save(CheckpointId id, const StateData& data) {
+    return submit({{RECORD_PUT, id, &data, false, {}}});
+}
+
+Result<void> LogStorage::saveBatch(const std::vector<std::pair<CheckpointId, const StateData*>>& items) {
+    std::vector<Append> appends;
+    appends.reserve(items.size());
+    for (const auto& [id, data] : items) {
+        appends.push_back({RECORD_PUT, id, data, false, {}});
+    }
+    return submit(appends);
+}
+
+Result<StateData> LogStorage::readRecord(const SegmentFile& segment, const Location& loc) const {
+    uint8_t headerBytes[HEADER_SIZE];
+    Header header;
+    StateData data(loc.size);
+    if (!preadFull(segment.fd, headerBytes, HEADER_SIZE, loc.offset) ||
+        !decodeHeader(headerBytes, header) || header.len != loc.size ||
+        (loc.size > 0 && !preadFull(segment.fd, data.data(), loc.size, loc.offset + HEADER_SIZE))) {
+        return Result<StateData>::failure(ErrorCode::IOError, "Log record read failed");
+    }
+    if (!headerCrcMatches(headerBytes, header, data.data())) {
+        return Result<StateData>::failure(ErrorCode::CheckpointCorrupted,
+            "Log record checksum mismatch: " + std::to_string(header.id));
+    }
+    return Result<StateData>::success(std::move(data));
+}
+
+Result<StateData> LogStorage::load(CheckpointId id) {
+    std::shared_ptr<SegmentFile> segment;
+    Location loc;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(id);
+        if (it == m_index.end()) {
+            return Result<StateData>::failure(ErrorCode::CheckpointNotFound);
+        }
+        loc = it->second;
+        segment = m_segments[loc.segment];
+    }
+    // Okuma kilitsiz; segment compaction'da silinse bile fd açık kalır
+    return readRecord(*segment, loc);
+}
+
+Result<void> LogStorage::remove(CheckpointId id) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_index.find(id) == m_index.end()) {
+            return Result<void>::success();
+        }
+    }
+    auto result = submit({{RECORD_DEL, id, nullptr, false, {}}});
+    if (result.isSuccess() && m_options.backgroundCompaction) {
+        m_compactCv.notify_all();
+    }
+    return result;
+}
+
+bool LogStorage::exists(CheckpointId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_index.count(id) > 0;
+}
+
+std::vector<CheckpointId> LogStorage::listAll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<CheckpointId> ids;
+    ids.reserve(m_index.size());
+    for (const auto& [id, loc] : m_index) {
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+size_t LogStorage::getSize(CheckpointId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(id);
+    return it != m_index.end() ? it->second.size : 0;
+}
+
+size_t LogStorage::getTotalSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_payloadBytes;
+}
+
+Result<void> LogStorage::saveIndex(const StateData& index) {
+    // tmp'ye yaz, sync et, rename et: yarım index hiç görünmez
+    auto path = m_basePath / "checkpoints.idx";
+    auto tmp = path;
+    tmp += ".tmp";
+
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return Result<void>::failure(ErrorCode::IOError, "Cannot open index for writing");
+    }
+    bool ok = pwriteFull(fd, index.data(), index.size(), 0) &&
+              (!m_options.syncOnCommit || ::fdatasync(fd) == 0);
+    ::close(fd);
+    if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0) {
+        return Result<void>::failure(ErrorCode::IOError, "Index write failed");
+    }
+    if (m_options.syncOnCommit) {
+        syncDirectory(m_basePath);
+    }
+    return Result<void>::success();
+}
+
+Result<StateData> LogStorage::loadIndex() {
+    std::ifstream file(m_basePath / "checkpoints.idx", std::ios::binary | std::ios::ate);
+    if (!file) {
+        return Result<StateData>::failure(ErrorCode::CheckpointNotFound, "No index");
+    }
+    size_t size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    StateData data(size);
+    if (!file.read(reinterpret_cast<char*>(data.data()), size)) {
+        return Result<StateData>::failure(ErrorCode::IOError, "Index read failed");
+    }
+    return Result<StateData>::success(std::move(data));
+}
+
+// ---------- Compaction ----------
+
+bool LogStorage::compactOldest() {
+    std::shared_ptr<SegmentFile> oldest;
+    std::vector<std::pair<CheckpointId, Location>> live;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_segments.size() < 2) return false;
+        oldest = m_segments.begin()->second;
+        if (oldest == m_active || oldest->size == 0) return false;
+
+        double ratio = static_cast<double>(oldest->liveBytes) / static_cast<double>(oldest->size);
+        if (ratio >= m_options.compactionThreshold) return false;
+
+        for (const auto& [id, loc] : m_index) {
+            if (loc.segment == oldest->number) live.emplace_back(id, loc);
+        }
+    }
+
+    // Canlı kayıtları aktif segmente taşı (tek commit). Koşullu: bu arada
+    // üzerine yazılan ya da silinen kayıtlar eski haliyle geri gelmez.
+    std::vector<StateData> payloads;
+    payloads.reserve(live.size());
+    std::vector<Append> appends;
+    appends.reserve(live.size());
+    for (const auto& [id, loc] : live) {
+        auto data = readRecord(*oldest, loc);
+        if (data.isError()) return false;
+        payloads.push_back(std::move(*data.value));
+    }
+    for (size_t i = 0; i < live.size(); ++i) {
+        appends.push_back({RECORD_PUT, live[i].first, &payloads[i], true, live[i].second});
+    }
+    if (!appends.empty() && submit(appends).isError()) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [id, loc] : m_index) {
+            if (loc.segment == oldest->number) return false;    // beklenmedik
+        }
+        m_segments.erase(oldest->number);
+        m_stats.compactedSegments++;
+    }
+    std::filesystem::remove(oldest->path);
+    syncDirectory(m_walPath);
+    return true;
+}
+
+size_t LogStorage::compact() {
+    std::lock_guard<std::mutex> guard(m_compactMutex);
+    size_t removed = 0;
+    while (compactOldest()) {
+        removed++;
+    }
+    return removed;
+}
+
+void LogStorage::compactionLoop() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_compactCv.wait_for(lock, m_options.compactionInterval, [this] { return m_stopping; });
+            if (m_stopping) return;
+        }
+        compact();
+    }
+}
+
+LogStorage::Stats LogStorage::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.segments = m_segments.size();
+    stats.records = m_index.size();
+    stats.liveBytes = 0;
+    stats.logBytes = 0;
+    for (const auto& [number, segment] : m_segments) {
+        stats.liveBytes += segment->liveBytes;
+        stats.logBytes += segment->size;
+    }
+    return stats;
+}
+
+} // namespace checkpoint
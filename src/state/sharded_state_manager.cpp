@@ -0,0 +1,464 @@
+#include "state/sharded_state_manager.hpp"
+#include "state/checkpoint_index.hpp"
+#include "state/storage.hpp"
+#include "utils/helpers.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace checkpoint {
+
+namespace {
+
+// Id'lerin alt bitleri sayaç, üst bitleri zaman: karıştırıp dağıt
+inline uint64_t mixId(CheckpointId id) {
+    uint64_t x = id;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+} // namespace
+
+// ==================== ShardedStateManager Implementation ====================
+
+struct ShardedStateManager::Impl {
+    struct CachedCheckpoint {
+        CheckpointHandle handle;
+        mutable std::atomic<uint64_t> lastUsed;     // shared kilit altında güncellenir
+
+        CachedCheckpoint(CheckpointHandle h, uint64_t tick)
+            : handle(std::move(h)), lastUsed(tick) {}
+    };
+
+    struct Shard {
+        // Sıra: mutex -> storageMutex
+        mutable std::shared_mutex mutex;
+        std::map<CheckpointId, CheckpointIndexEntry> index;
+        std::unordered_map<CheckpointId, CachedCheckpoint> cache;
+        bool indexDirty = false;
+
+        std::mutex storageMutex;
+        std::unique_ptr<IStorage> storage;
+
+        std::atomic<uint64_t> tick{0};
+
+        // mutex exclusive tutulurken
+        void cachePut(CheckpointHandle handle, size_t capacity) {
+            CheckpointId id = handle->getId();
+            uint64_t now = tick.fetch_add(1, std::memory_order_relaxed);
+            auto it = cache.find(id);
+            if (it != cache.end()) {
+                it->second.handle = std::move(handle);
+                it->second.lastUsed.store(now, std::memory_order_relaxed);
+                return;
+            }
+            cache.try_emplace(id, std::move(handle), now);
+
+            // En uzun süredir kullanılmayanı at (kapasite shard başına küçük)
+            while (cache.size() > capacity) {
+                auto victim = std::min_element(cache.begin(), cache.end(),
+                    [](const auto& a, const auto& b) {
+                        return a.second.lastUsed.load(std::memory_order_relaxed) <
+                               b.second.lastUsed.load(std::memory_order_relaxed);
+                    });
+                cache.erase(victim);
+            }
+        }
+
+        // mutex exclusive tutulurken
+        void flushIndex() {
+            if (!indexDirty) return;
+            auto serialized = serializeCheckpointIndex(index);
+            std::lock_guard<std::mutex> io(storageMutex);
+            if (storage->saveIndex(serialized).isSuccess()) {
+                indexDirty = false;
+            }
+        }
+
+        // Kalıcı index'i yükle ve storage ile uzlaştır (bkz. StateManager)
+        void loadIndex() {
+            auto persisted = storage->loadIndex();
+            if (persisted.isSuccess()) {
+                auto parsed = deserializeCheckpointIndex(*persisted.value);
+                if (parsed) index = std::move(*parsed);
+            }
+
+            std::map<CheckpointId, CheckpointIndexEntry> reconciled;
+            for (auto id : storage->listAll()) {
+                auto it = index.find(id);
+                if (it != index.end() && it->second.storedSize == storage->getSize(id)) {
+                    reconciled[id] = std::move(it->second);
+                    continue;
+                }
+                auto result = storage->loadShared(id);
+                if (result.isSuccess()) {
+                    Checkpoint checkpoint = Checkpoint::deserialize(*result.value);
+                    reconciled[id] = makeCheckpointIndexEntry(checkpoint, result.value->size());
+                }
+                indexDirty = true;
+            }
+            if (reconciled.size() != index.size()) {
+                indexDirty = true;
+            }
+            index = std::move(reconciled);
+            flushIndex();
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<size_t> cacheCapacity{DEFAULT_CACHE_CAPACITY_PER_SHARD};
+    std::atomic<CheckpointId> latestCheckpointId{0};
+
+    mutable std::shared_mutex stateMutex;
+    SharedBuffer currentState;      // son checkpoint'in verisini paylaşır
+
+    // Auto-save
+    std::mutex autoSaveMutex;
+    std::condition_variable autoSaveCv;
+    Duration autoSaveInterval = Duration(60000);
+    bool autoSaveRunning = false;
+    std::thread autoSaveThread;
+
+    Shard& shardFor(CheckpointId id) {
+        return *shards[mixId(id) % shards.size()];
+    }
+
+    void noteLatest(CheckpointId id) {
+        CheckpointId seen = latestCheckpointId.load(std::memory_order_relaxed);
+        while (id > seen && !latestCheckpointId.compare_exchange_weak(seen, id)) {
+        }
+    }
+
+    // Yeni handle'ı yaz ve yayınla. Serialize kilitsiz yapılır.
+    Result<void> publish(Shard& shard, CheckpointHandle checkpoint) {
+        SharedBuffer serialized(checkpoint->serialize());
+        CheckpointId id = checkpoint->getId();
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        Result<void> result = Result<void>::success();
+        {
+            std::lock_guard<std::mutex> io(shard.storageMutex);
+            result = shard.storage->saveShared(id, serialized);
+        }
+        if (result.isError()) {
+            return result;
+        }
+        shard.index[id] = makeCheckpointIndexEntry(*checkpoint, serialized.size());
+        shard.indexDirty = true;
+        shard.cachePut(std::move(checkpoint), cacheCapacity.load(std::memory_order_relaxed));
+        noteLatest(id);
+        return result;
+    }
+
+    // Veri paylaşılır: checkpoint ve currentState aynı buffer'ı tutar
+    Result<CheckpointId> create(const std::string& name, SharedBuffer data) {
+        auto id = utils::IdGenerator::generateCheckpointId();
+        auto checkpoint = std::make_shared<Checkpoint>(id, name);
+        checkpoint->setData(std::move(data));
+        checkpoint->setStatus(CheckpointStatus::Committed);
+
+        {
+            std::unique_lock<std::shared_mutex> lock(stateMutex);
+            currentState = checkpoint->getData();
+        }
+
+        auto result = publish(shardFor(id), std::move(checkpoint));
+        if (result.isError()) {
+            return Result<CheckpointId>::failure(result.error, result.message);
+        }
+        return Result<CheckpointId>::success(id);
+    }
+
+    void stopAutoSave() {
+        {
+            std::lock_guard<std::mutex> lock(autoSaveMutex);
+            if (!autoSaveRunning) return;
+            autoSaveRunning = false;
+        }
+        autoSaveCv.notify_all();
+        if (autoSaveThread.joinable()) {
+            autoSaveThread.join();
+        }
+    }
+};
+
+ShardedStateManager::ShardedStateManager(size_t shardCount)
+    : ShardedStateManager([](size_t) { return std::make_unique<MemoryStorage>(); }, shardCount) {
+}
+
+ShardedStateManager::ShardedStateManager(const std::filesystem::path& storagePath, size_t shardCount)
+    : ShardedStateManager([storagePath](size_t shard) {
+          char name[16];
+          std::snprintf(name, sizeof(name), "shard-%02zu", shard);
+          return std::make_unique<FileStorage>(storagePath / name);
+      }, shardCount) {
+}
+
+ShardedStateManager::ShardedStateManager(StorageFactory factory, size_t shardCount)
+    : m_impl(std::make_unique<Impl>()) {
+    shardCount = std::max<size_t>(shardCount, 1);
+    m_impl->shards.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i) {
+        auto shard = std::make_unique<Impl::Shard>();
+        shard->storage = factory(i);
+        shard->loadIndex();
+        if (!shard->index.empty()) {
+            m_impl->noteLatest(shard->index.rbegin()->first);
+        }
+        m_impl->shards.push_back(std::move(shard));
+    }
+}
+
+ShardedStateManager::~ShardedStateManager() {
+    m_impl->stopAutoSave();
+    flushIndex();
+}
+
+Result<CheckpointId> ShardedStateManager::createCheckpoint(const std::string& name,
+                                                          const StateData& state) {
+    return m_impl->create(name, SharedBuffer::copyOf(state));
+}
+
+Result<CheckpointHandle> ShardedStateManager::getCheckpointHandle(CheckpointId id) {
+    auto& shard = m_impl->shardFor(id);
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.index.find(id) == shard.index.end()) {
+            return Result<CheckpointHandle>::failure(ErrorCode::CheckpointNotFound,
+                                                    "Checkpoint not found: " + std::to_string(id));
+        }
+        auto it = shard.cache.find(id);
+        if (it != shard.cache.end()) {
+            it->second.lastUsed.store(shard.tick.fetch_add(1, std::memory_order_relaxed),
+                                      std::memory_order_relaxed);
+            return Result<CheckpointHandle>::success(it->second.handle);
+        }
+    }
+
+    // Kaçırma: exclusive kilitle tekrar bak, yoksa storage'dan oku
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    if (shard.index.find(id) == shard.index.end()) {
+        return Result<CheckpointHandle>::failure(ErrorCode::CheckpointNotFound,
+                                                "Checkpoint not found: " + std::to_string(id));
+    }
+    auto it = shard.cache.find(id);
+    if (it != shard.cache.end()) {
+        return Result<CheckpointHandle>::success(it->second.handle);
+    }
+
+    Result<SharedBuffer> loaded = Result<SharedBuffer>::failure(ErrorCode::Unknown);
+    {
+        std::lock_guard<std::mutex> io(shard.storageMutex);
+        loaded = shard.storage->loadShared(id);
+    }
+    if (loaded.isError()) {
+        return Result<CheckpointHandle>::failure(loaded.error, loaded.message);
+    }
+    auto handle = std::make_shared<const Checkpoint>(Checkpoint::deserialize(*loaded.value));
+    shard.cachePut(handle, m_impl->cacheCapacity.load(std::memory_order_relaxed));
+    return Result<CheckpointHandle>::success(std::move(handle));
+}
+
+Result<Checkpoint> ShardedStateManager::getCheckpoint(CheckpointId id) {
+    auto handle = getCheckpointHandle(id);
+    if (handle.isError()) {
+        return Result<Checkpoint>::failure(handle.error, handle.message);
+    }
+    return Result<Checkpoint>::success(**handle.value);
+}
+
+Result<void> ShardedStateManager::updateCheckpoint(CheckpointId id, const StateData& state) {
+    auto current = getCheckpointHandle(id);
+    if (current.isError()) {
+        return Result<void>::failure(current.error, current.message);
+    }
+
+    // Yayınlanmış handle değişmez; kopyayı güncelle ve yerine koy
+    auto updated = std::make_shared<Checkpoint>(**current.value);
+    updated->setData(state);
+
+    auto& shard = m_impl->shardFor(id);
+    SharedBuffer serialized(updated->serialize());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    if (shard.index.find(id) == shard.index.end()) {
+        return Result<void>::failure(ErrorCode::CheckpointNotFound);    // arada silindi
+    }
+    Result<void> result = Result<void>::success();
+    {
+        std::lock_guard<std::mutex> io(shard.storageMutex);
+        result = shard.storage->saveShared(id, serialized);
+    }
+    if (result.isError()) {
+        return result;
+    }
+    shard.index[id] = makeCheckpointIndexEntry(*updated, serialized.size());
+    shard.indexDirty = true;
+    shard.cachePut(std::move(updated), m_impl->cacheCapacity.load(std::memory_order_relaxed));
+    // Aynı boyutlu güncellemeler açılışta ayırt edilemez - index hemen yazılır
+    shard.flushIndex();
+    return Result<void>::success();
+}
+
+Result<void> ShardedStateManager::deleteCheckpoint(CheckpointId id) {
+    auto& shard = m_impl->shardFor(id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(id);
+    if (it == shard.index.end()) {
+        return Result<void>::failure(ErrorCode::CheckpointNotFound);
+    }
+    shard.index.erase(it);
+    shard.indexDirty = true;
+    shard.cache.erase(id);
+
+    std::lock_guard<std::mutex> io(shard.storageMutex);
+    shard.storage->remove(id);
+    return Result<void>::success();
+}
+
+std::vector<CheckpointMetadata> ShardedStateManager::listCheckpoints() {
+    std::vector<CheckpointMetadata> result;
+    for (const auto& shard : m_impl->shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        for (const auto& [id, entry] : shard->index) {
+            result.push_back(entry.metadata);
+        }
+    }
+    std::sort(result.begin(), result.end(),
+        [](const CheckpointMetadata& a, const CheckpointMetadata& b) { return a.id < b.id; });
+    return result;
+}
+
+void ShardedStateManager::setAutoSaveInterval(Duration interval) {
+    {
+        std::lock_guard<std::mutex> lock(m_impl->autoSaveMutex);
+        m_impl->autoSaveInterval = interval;
+    }
+    m_impl->autoSaveCv.notify_all();
+}
+
+void ShardedStateManager::enableAutoSave(bool enable) {
+    if (!enable) {
+        m_impl->stopAutoSave();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_impl->autoSaveMutex);
+    if (m_impl->autoSaveRunning) return;
+    m_impl->autoSaveRunning = true;
+    m_impl->autoSaveThread = std::thread([this] {
+        std::unique_lock<std::mutex> lock(m_impl->autoSaveMutex);
+        while (m_impl->autoSaveRunning) {
+            m_impl->autoSaveCv.wait_for(lock, m_impl->autoSaveInterval,
+                                        [this] { return !m_impl->autoSaveRunning; });
+            if (!m_impl->autoSaveRunning) break;
+
+            SharedBuffer state;
+            {
+                std::shared_lock<std::shared_mutex> stateLock(m_impl->stateMutex);
+                state = m_impl->currentState;
+            }
+            if (state.empty()) continue;
+
+            lock.unlock();
+            m_impl->create("AutoSave_" + utils::TimeUtils::formatTimestamp(utils::TimeUtils::now()),
+                           std::move(state));
+            lock.lock();
+        }
+    });
+}
+
+Result<StateData> ShardedStateManager::getCurrentState() {
+    std::shared_lock<std::shared_mutex> lock(m_impl->stateMutex);
+    return Result<StateData>::success(m_impl->currentState.toVector());
+}
+
+SharedBuffer ShardedStateManager::getCurrentStateBuffer() {
+    std::shared_lock<std::shared_mutex> lock(m_impl->stateMutex);
+    return m_impl->currentState;
+}
+
+void ShardedStateManager::setCurrentState(const StateData& state) {
+    setCurrentState(SharedBuffer::copyOf(state));
+}
+
+void ShardedStateManager::setCurrentState(SharedBuffer state) {
+    std::unique_lock<std::shared_mutex> lock(m_impl->stateMutex);
+    m_impl->currentState = std::move(state);
+}
+
+Result<CheckpointId> ShardedStateManager::getLatestCheckpointId() {
+    CheckpointId id = m_impl->latestCheckpointId.load();
+    if (id == 0) {
+        return Result<CheckpointId>::failure(ErrorCode::CheckpointNotFound, "No checkpoints exist");
+    }
+    return Result<CheckpointId>::success(id);
+}
+
+void ShardedStateManager::setCacheCapacity(size_t capacityPerShard) {
+    capacityPerShard = std::max<size_t>(1, capacityPerShard);
+    m_impl->cacheCapacity = capacityPerShard;
+    for (auto& shard : m_impl->shards) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        while (shard->cache.size() > capacityPerShard) {
+            auto victim = std::min_element(shard->cache.begin(), shard->cache.end(),
+                [](const auto& a, const auto& b) {
+                    return a.second.lastUsed.load() < b.second.lastUsed.load();
+                });
+            shard->cache.erase(victim);
+        }
+    }
+}
+
+size_t ShardedStateManager::getCachedCheckpointCount() const {
+    size_t count = 0;
+    for (const auto& shard : m_impl->shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        count += shard->cache.size();
+    }
+    return count;
+}
+
+void ShardedStateManager::flushIndex() {
+    for (auto& shard : m_impl->shards) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        shard->flushIndex();
+    }
+}
+
+size_t ShardedStateManager::getShardCount() const {
+    return m_impl->shards.size();
+}
+
+size_t ShardedStateManager::shardOf(CheckpointId id) const {
+    return mixId(id) % m_impl->shards.size();
+}
+
+size_t ShardedStateManager::getCheckpointCount() const {
+    size_t count = 0;
+    for (const auto& shard : m_impl->shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        count += shard->index.size();
+    }
+    return count;
+}
+
+size_t ShardedStateManager::getTotalStorageSize() const {
+    size_t total = 0;
+    for (const auto& shard : m_impl->shards) {
+        std::lock_guard<std::mutex> io(shard->storageMutex);
+        total += shard->storage->getTotalSize();
+    }
+    return total;
+}
+
+} // namespace checkpoint
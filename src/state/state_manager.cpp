@@ -1,105 +1,104 @@
 #include "state/state_manager.hpp"
 #include "state/storage.hpp"
+#include "state/checkpoint_index.hpp"
 #include "core/serializer.hpp"
+#include "core/binary_io.hpp"
 #include "utils/helpers.hpp"
+#include "core/checksum.hpp"
+#include "core/metrics.hpp"
+#include "rollback/state_delta.hpp"
 #include <mutex>
 #include <map>
 #include <thread>
 #include <atomic>
 #include <condition_variable>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <optional>
+#include <unordered_map>
 
 namespace checkpoint {
 
+namespace {
+
+// Delta auto-save kayıtlarında tabanın id'si
+constexpr const char* AUTOSAVE_BASE_TAG = "autosave.base";
+
+// Metadata'yı yerinde yaz (serializedSize() byte)
+void writeMetadata(BinaryWriter& writer, const CheckpointMetadata& meta) {
+    writer.write(meta.id);
+    writer.writeString(meta.name);
+    writer.writeString(meta.description);
+    writer.write(utils::TimeUtils::toUnixTimestamp(meta.createdAt));
+    writer.write(utils::TimeUtils::toUnixTimestamp(meta.modifiedAt));
+    writer.write(static_cast<int>(meta.status));
+    writer.write(meta.dataSize);
+    writer.write(meta.checksum);
+    
+    // Tags (opsiyonel; eski kayıtlarda yok)
+    if (!meta.tags.empty()) {
+        writer.write(static_cast<uint32_t>(meta.tags.size()));
+        for (const auto& [key, value] : meta.tags) {
+            writer.writeString(key);
+            writer.writeString(value);
+        }
+    }
+}
+
+} // namespace
+
 // ==================== CheckpointMetadata ====================
 
+size_t CheckpointMetadata::serializedSize() const {
+    size_t size = sizeof(CheckpointId) +
+                  sizeof(uint32_t) + name.size() +
+                  sizeof(uint32_t) + description.size() +
+                  2 * sizeof(int64_t) + sizeof(int) + sizeof(size_t) + sizeof(uint32_t);
+    if (!tags.empty()) {
+        size += sizeof(uint32_t);
+        for (const auto& [key, value] : tags) {
+            size += 2 * sizeof(uint32_t) + key.size() + value.size();
+        }
+    }
+    return size;
+}
+
 StateData CheckpointMetadata::serialize() const {
-    BinarySerializer serializer;
-    StateData data;
-    
-    // ID
-    auto idData = serializer.serializeObject(id);
-    data.insert(data.end(), idData.begin(), idData.end());
-    
-    // Name length + name
-    uint32_t nameLen = static_cast<uint32_t>(name.size());
-    auto nameLenData = serializer.serializeObject(nameLen);
-    data.insert(data.end(), nameLenData.begin(), nameLenData.end());
-    data.insert(data.end(), name.begin(), name.end());
-    
-    // Description length + description
-    uint32_t descLen = static_cast<uint32_t>(description.size());
-    auto descLenData = serializer.serializeObject(descLen);
-    data.insert(data.end(), descLenData.begin(), descLenData.end());
-    data.insert(data.end(), description.begin(), description.end());
-    
-    // Timestamps
-    int64_t created = utils::TimeUtils::toUnixTimestamp(createdAt);
-    int64_t modified = utils::TimeUtils::toUnixTimestamp(modifiedAt);
-    auto createdData = serializer.serializeObject(created);
-    auto modifiedData = serializer.serializeObject(modified);
-    data.insert(data.end(), createdData.begin(), createdData.end());
-    data.insert(data.end(), modifiedData.begin(), modifiedData.end());
-    
-    // Status
-    auto statusData = serializer.serializeObject(static_cast<int>(status));
-    data.insert(data.end(), statusData.begin(), statusData.end());
-    
-    // Data size and checksum
-    auto sizeData = serializer.serializeObject(dataSize);
-    auto checksumData = serializer.serializeObject(checksum);
-    data.insert(data.end(), sizeData.begin(), sizeData.end());
-    data.insert(data.end(), checksumData.begin(), checksumData.end());
-    
+    StateData data(serializedSize());
+    BinaryWriter writer{std::span<uint8_t>(data)};
+    writeMetadata(writer, *this);
     return data;
 }
 
-CheckpointMetadata CheckpointMetadata::deserialize(const StateData& data) {
+CheckpointMetadata CheckpointMetadata::deserialize(std::span<const uint8_t> data) {
     CheckpointMetadata meta;
-    BinarySerializer serializer;
-    size_t offset = 0;
-    
-    // ID
-    meta.id = serializer.deserializeObject<CheckpointId>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(CheckpointId)));
-    offset += sizeof(CheckpointId);
-    
-    // Name
-    uint32_t nameLen = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
-    meta.name = std::string(data.begin() + offset, data.begin() + offset + nameLen);
-    offset += nameLen;
-    
-    // Description
-    uint32_t descLen = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
-    meta.description = std::string(data.begin() + offset, data.begin() + offset + descLen);
-    offset += descLen;
-    
-    // Timestamps
-    int64_t created = serializer.deserializeObject<int64_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(int64_t)));
-    offset += sizeof(int64_t);
-    int64_t modified = serializer.deserializeObject<int64_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(int64_t)));
-    offset += sizeof(int64_t);
-    
-    meta.createdAt = utils::TimeUtils::fromUnixTimestamp(created);
-    meta.modifiedAt = utils::TimeUtils::fromUnixTimestamp(modified);
-    
-    // Status
-    int statusInt = serializer.deserializeObject<int>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(int)));
-    offset += sizeof(int);
-    meta.status = static_cast<CheckpointStatus>(statusInt);
-    
-    // Data size and checksum
-    meta.dataSize = serializer.deserializeObject<size_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(size_t)));
-    offset += sizeof(size_t);
-    meta.checksum = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
+    BinaryReader reader(data);
+    
+    meta.id = reader.read<CheckpointId>();
+    meta.name = reader.readString();
+    meta.description = reader.readString();
+    meta.createdAt = utils::TimeUtils::fromUnixTimestamp(reader.read<int64_t>());
+    meta.modifiedAt = utils::TimeUtils::fromUnixTimestamp(reader.read<int64_t>());
+    meta.status = static_cast<CheckpointStatus>(reader.read<int>());
+    meta.dataSize = reader.read<size_t>();
+    meta.checksum = reader.read<uint32_t>();
+    if (!reader.ok()) {
+        meta.status = CheckpointStatus::Corrupted;
+        return meta;
+    }
+    
+    // Tags
+    if (!reader.atEnd()) {
+        uint32_t tagCount = reader.read<uint32_t>();
+        for (uint32_t i = 0; i < tagCount && reader.ok(); ++i) {
+            std::string key = reader.readString();
+            std::string value = reader.readString();
+            if (reader.ok()) meta.tags[std::move(key)] = std::move(value);
+        }
+    }
     
     return meta;
 }
@@ -132,20 +131,17 @@ void Checkpoint::setStatus(CheckpointStatus status) {
 }
 
 void Checkpoint::setData(const StateData& data) {
-    m_data = data;
-    m_metadata.dataSize = data.size();
-    
-    BinarySerializer serializer;
-    m_metadata.checksum = serializer.calculateChecksum(data);
-    m_metadata.modifiedAt = utils::TimeUtils::now();
+    setData(SharedBuffer::copyOf(data));
 }
 
 void Checkpoint::setData(StateData&& data) {
+    setData(SharedBuffer(std::move(data)));
+}
+
+void Checkpoint::setData(SharedBuffer data) {
     m_data = std::move(data);
     m_metadata.dataSize = m_data.size();
-    
-    BinarySerializer serializer;
-    m_metadata.checksum = serializer.calculateChecksum(m_data);
+    m_metadata.checksum = crc32c(m_data.data(), m_data.size());
     m_metadata.modifiedAt = utils::TimeUtils::now();
 }
 
@@ -154,6 +150,11 @@ void Checkpoint::addTag(const std::string& key, const std::string& value) {
     m_metadata.modifiedAt = utils::TimeUtils::now();
 }
 
+void Checkpoint::removeTag(const std::string& key) {
+    m_metadata.tags.erase(key);
+    m_metadata.modifiedAt = utils::TimeUtils::now();
+}
+
 void Checkpoint::addRelatedOperation(OperationId opId) {
     m_relatedOperations.push_back(opId);
 }
@@ -166,142 +167,89 @@ bool Checkpoint::isValid() const {
 
 bool Checkpoint::verifyIntegrity() const {
     if (m_data.empty()) return true;
+    if (crc32c(m_data.data(), m_data.size()) == m_metadata.checksum) return true;
     
+    // CRC32C öncesi checkpoint'ler: eski checksum için kopya gerekir
     BinarySerializer serializer;
-    return serializer.verifyChecksum(m_data, m_metadata.checksum);
+    return serializer.verifyChecksum(m_data.toVector(), m_metadata.checksum);
 }
 
 StateData Checkpoint::serialize() const {
-    StateData result;
-    
-    // Metadata
-    auto metaData = m_metadata.serialize();
-    uint32_t metaSize = static_cast<uint32_t>(metaData.size());
+    // Düzen: metaSize u32 | meta | dataSize u32 | data | opCount u32 | opId x N
+    size_t metaSize = m_metadata.serializedSize();
+    StateData result(sizeof(uint32_t) + metaSize + sizeof(uint32_t) + m_data.size() +
+                     sizeof(uint32_t) + m_relatedOperations.size() * sizeof(OperationId));
+    BinaryWriter writer{std::span<uint8_t>(result)};
     
-    BinarySerializer serializer;
-    auto metaSizeData = serializer.serializeObject(metaSize);
-    result.insert(result.end(), metaSizeData.begin(), metaSizeData.end());
-    result.insert(result.end(), metaData.begin(), metaData.end());
+    writer.write(static_cast<uint32_t>(metaSize));
+    writeMetadata(writer, m_metadata);
     
-    // Data
-    uint32_t dataSize = static_cast<uint32_t>(m_data.size());
-    auto dataSizeData = serializer.serializeObject(dataSize);
-    result.insert(result.end(), dataSizeData.begin(), dataSizeData.end());
-    result.insert(result.end(), m_data.begin(), m_data.end());
+    writer.write(static_cast<uint32_t>(m_data.size()));
+    writer.writeBytes(m_data.data(), m_data.size());
     
-    // Related operations
-    uint32_t opCount = static_cast<uint32_t>(m_relatedOperations.size());
-    auto opCountData = serializer.serializeObject(opCount);
-    result.insert(result.end(), opCountData.begin(), opCountData.end());
-    
-    for (OperationId opId : m_relatedOperations) {
-        auto opData = serializer.serializeObject(opId);
-        result.insert(result.end(), opData.begin(), opData.end());
-    }
+    writer.write(static_cast<uint32_t>(m_relatedOperations.size()));
+    writer.writeBytes(m_relatedOperations.data(), m_relatedOperations.size() * sizeof(OperationId));
     
     return result;
 }
 
 Checkpoint Checkpoint::deserialize(const StateData& data) {
+    return deserialize(SharedBuffer::copyOf(data));
+}
+
+Checkpoint Checkpoint::deserialize(const SharedBuffer& data) {
     Checkpoint checkpoint;
-    BinarySerializer serializer;
-    size_t offset = 0;
-    
-    // Metadata size
-    uint32_t metaSize = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
-    
-    // Metadata
-    checkpoint.m_metadata = CheckpointMetadata::deserialize(
-        StateData(data.begin() + offset, data.begin() + offset + metaSize));
-    offset += metaSize;
-    
-    // Data size
-    uint32_t dataSize = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
+    BinaryReader reader(std::span<const uint8_t>(data.data(), data.size()));
     
-    // Data
-    checkpoint.m_data = StateData(data.begin() + offset, data.begin() + offset + dataSize);
-    offset += dataSize;
+    uint32_t metaSize = reader.read<uint32_t>();
+    checkpoint.m_metadata = CheckpointMetadata::deserialize(reader.readBytes(metaSize));
     
-    // Related operations
-    uint32_t opCount = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
+    // Data: kopyalanmaz, kaydın slice'ı
+    uint32_t dataSize = reader.read<uint32_t>();
+    size_t dataOffset = reader.position();
+    if (reader.skip(dataSize)) {
+        checkpoint.m_data = data.slice(dataOffset, dataSize);
+    }
     
-    for (uint32_t i = 0; i < opCount; i++) {
-        OperationId opId = serializer.deserializeObject<OperationId>(
-            StateData(data.begin() + offset, data.begin() + offset + sizeof(OperationId)));
-        offset += sizeof(OperationId);
-        checkpoint.m_relatedOperations.push_back(opId);
+    uint32_t opCount = reader.read<uint32_t>();
+    if (reader.ok() && reader.remaining() / sizeof(OperationId) >= opCount) {
+        checkpoint.m_relatedOperations.resize(opCount);
+        reader.readBytesInto(checkpoint.m_relatedOperations.data(), opCount * sizeof(OperationId));
     }
     
+    if (!reader.ok()) {
+        checkpoint.m_metadata.status = CheckpointStatus::Corrupted;
+    }
     return checkpoint;
 }
 
 // ==================== OperationRecord ====================
 
 StateData OperationRecord::serialize() const {
-    BinarySerializer serializer;
-    StateData result;
+    StateData result(sizeof(OperationId) + sizeof(int) + sizeof(int64_t) + sizeof(CheckpointId) +
+                     sizeof(uint32_t) + description.size() + sizeof(bool));
+    BinaryWriter writer{std::span<uint8_t>(result)};
     
-    auto idData = serializer.serializeObject(id);
-    result.insert(result.end(), idData.begin(), idData.end());
-    
-    auto typeData = serializer.serializeObject(static_cast<int>(type));
-    result.insert(result.end(), typeData.begin(), typeData.end());
-    
-    int64_t ts = utils::TimeUtils::toUnixTimestamp(timestamp);
-    auto tsData = serializer.serializeObject(ts);
-    result.insert(result.end(), tsData.begin(), tsData.end());
-    
-    auto cpData = serializer.serializeObject(relatedCheckpoint);
-    result.insert(result.end(), cpData.begin(), cpData.end());
-    
-    uint32_t descLen = static_cast<uint32_t>(description.size());
-    auto descLenData = serializer.serializeObject(descLen);
-    result.insert(result.end(), descLenData.begin(), descLenData.end());
-    result.insert(result.end(), description.begin(), description.end());
-    
-    auto canUndoData = serializer.serializeObject(canUndo);
-    result.insert(result.end(), canUndoData.begin(), canUndoData.end());
+    writer.write(id);
+    writer.write(static_cast<int>(type));
+    writer.write(utils::TimeUtils::toUnixTimestamp(timestamp));
+    writer.write(relatedCheckpoint);
+    writer.writeString(description);
+    writer.write(canUndo);
     
     return result;
 }
 
-OperationRecord OperationRecord::deserialize(const StateData& data) {
-    OperationRecord record;
-    BinarySerializer serializer;
-    size_t offset = 0;
-    
-    record.id = serializer.deserializeObject<OperationId>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(OperationId)));
-    offset += sizeof(OperationId);
+OperationRecord OperationRecord::deserialize(std::span<const uint8_t> data) {
+    OperationRecord record{};
+    BinaryReader reader(data);
     
-    int typeInt = serializer.deserializeObject<int>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(int)));
-    offset += sizeof(int);
-    record.type = static_cast<OperationType>(typeInt);
-    
-    int64_t ts = serializer.deserializeObject<int64_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(int64_t)));
-    offset += sizeof(int64_t);
-    record.timestamp = utils::TimeUtils::fromUnixTimestamp(ts);
-    
-    record.relatedCheckpoint = serializer.deserializeObject<CheckpointId>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(CheckpointId)));
-    offset += sizeof(CheckpointId);
-    
-    uint32_t descLen = serializer.deserializeObject<uint32_t>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(uint32_t)));
-    offset += sizeof(uint32_t);
-    record.description = std::string(data.begin() + offset, data.begin() + offset + descLen);
-    offset += descLen;
-    
-    record.canUndo = serializer.deserializeObject<bool>(
-        StateData(data.begin() + offset, data.begin() + offset + sizeof(bool)));
+    record.id = reader.read<OperationId>();
+    record.type = static_cast<OperationType>(reader.read<int>());
+    record.timestamp = utils::TimeUtils::fromUnixTimestamp(reader.read<int64_t>());
+    record.relatedCheckpoint = reader.read<CheckpointId>();
+    record.description = reader.readString();
+    record.canUndo = reader.readBool();
     
     return record;
 }
@@ -310,38 +258,460 @@ OperationRecord OperationRecord::deserialize(const StateData& data) {
 
 struct StateManager::Impl {
     std::unique_ptr<IStorage> storage;
-    std::map<CheckpointId, Checkpoint> checkpoints;
-    StateData currentState;
+    SharedBuffer currentState;      // son checkpoint'in verisini paylaşır
     CheckpointId latestCheckpointId = 0;
     
+    // Tüm checkpoint'lerin metadata'sı bellekte; payload'lar ilk
+    // getCheckpoint'te storage'dan okunup sınırlı LRU cache'te tutulur
+    std::map<CheckpointId, CheckpointIndexEntry> index;
+    bool indexDirty = false;
+    
+    std::list<CheckpointId> lru;    // baş: en son kullanılan
+    // Cache girdileri paylaşılan, değişmez handle'lardır: okuyucular kopya
+    // almaz, güncelleme yeni bir nesne yayınlar
+    std::unordered_map<CheckpointId, std::pair<CheckpointHandle, std::list<CheckpointId>::iterator>> cache;
+    size_t cacheCapacity = DEFAULT_CACHE_CAPACITY;
+    
     std::mutex mutex;
     
+    // Storage çağrıları ayrıca bu kilitle sıralanır; böylece arka plan
+    // yazıcı diske yazarken mutex tutulmaz. Sıra: mutex -> storageMutex
+    // (yazıcı storageMutex tutarken mutex almaz).
+    std::mutex storageMutex;
+    
+    // Async yazıcı
+    enum class WriteState { Queued, Superseded, Deleted };
+    struct PendingWrite {
+        CheckpointHandle checkpoint;
+        std::promise<Result<CheckpointId>> promise;
+        CheckpointCallback onDurable;
+        std::atomic<WriteState> state{WriteState::Queued};
+        
+        PendingWrite(CheckpointHandle cp, CheckpointCallback cb)
+            : checkpoint(std::move(cp)), onDurable(std::move(cb)) {}
+    };
+    std::unordered_map<CheckpointId, std::shared_ptr<PendingWrite>> pending;   // mutex altında
+    
+    static constexpr size_t MAX_WRITE_BATCH = 64;
+    std::mutex queueMutex;
+    std::condition_variable queueCv;
+    std::condition_variable drainedCv;
+    std::deque<std::shared_ptr<PendingWrite>> writeQueue;
+    size_t outstandingWrites = 0;
+    bool writerStop = false;
+    std::thread writerThread;
+    
     // Auto-save
     bool autoSaveEnabled = false;
     Duration autoSaveInterval = Duration(60000);  // 1 dakika
+    AutoSaveMode autoSaveMode = AutoSaveMode::Full;
+    uint64_t stateGeneration = 0;       // currentState her değiştiğinde artar
+    uint64_t savedGeneration = 0;       // checkpoint'e yazılmış son generation
+    CheckpointId lastAutoSaveId = 0;    // delta tabanı (0: sıradaki tam kayıt)
+    SharedBuffer lastAutoSaveState;
+    size_t autoSaveChainLength = 0;
     std::thread autoSaveThread;
     std::atomic<bool> running{false};
     std::condition_variable cv;
     
-    void autoSaveLoop() {
-        while (running) {
-            std::unique_lock<std::mutex> lock(mutex);
-            cv.wait_for(lock, autoSaveInterval, [this]{ return !running.load(); });
+    void cachePut(CheckpointHandle checkpoint) {
+        CheckpointId id = checkpoint->getId();
+        auto it = cache.find(id);
+        if (it != cache.end()) {
+            it->second.first = std::move(checkpoint);
+            lru.splice(lru.begin(), lru, it->second.second);
+            return;
+        }
+        lru.push_front(id);
+        cache.emplace(id, std::make_pair(std::move(checkpoint), lru.begin()));
+        while (cache.size() > cacheCapacity && !lru.empty()) {
+            cache.erase(lru.back());
+            lru.pop_back();
+        }
+    }
+    
+    void cacheErase(CheckpointId id) {
+        auto it = cache.find(id);
+        if (it != cache.end()) {
+            lru.erase(it->second.second);
+            cache.erase(it);
+        }
+    }
+    
+    // Cache'te yoksa (henüz yazılmamışsa bekleyen kopyadan) storage'dan oku
+    // (mutex tutulurken çağrılır)
+    Result<CheckpointHandle> fetch(CheckpointId id) {
+        auto it = cache.find(id);
+        if (it != cache.end()) {
+            lru.splice(lru.begin(), lru, it->second.second);
+            return Result<CheckpointHandle>::success(it->second.first);
+        }
+        
+        CheckpointHandle stored;
+        auto pit = pending.find(id);
+        if (pit != pending.end()) {
+            stored = pit->second->checkpoint;
+        } else {
+            std::lock_guard<std::mutex> io(storageMutex);
+            // Paylaşılan buffer: veri storage'dakiyle (ya da mmap ile) aynı bellek
+            auto loaded = storage->loadShared(id);
+            if (loaded.isError()) {
+                return Result<CheckpointHandle>::failure(loaded.error, loaded.message);
+            }
+            stored = std::make_shared<const Checkpoint>(Checkpoint::deserialize(*loaded.value));
+        }
+        
+        auto checkpoint = materialize(std::move(stored));
+        if (checkpoint.isSuccess()) {
+            cachePut(*checkpoint.value);
+        }
+        return checkpoint;
+    }
+    
+    // Delta auto-save kaydını tabanı üzerine uygulayıp tam checkpoint üret;
+    // diğer kayıtlar olduğu gibi döner (mutex tutulurken)
+    Result<CheckpointHandle> materialize(CheckpointHandle stored) {
+        const auto& tags = stored->getMetadata().tags;
+        auto tag = tags.find(AUTOSAVE_BASE_TAG);
+        if (tag == tags.end()) {
+            return Result<CheckpointHandle>::success(std::move(stored));
+        }
+        
+        CheckpointId id = stored->getId();
+        const auto& raw = stored->getData();
+        auto delta = stored->verifyIntegrity() ? BlockDelta::deserialize(raw.data(), raw.size())
+                                               : std::nullopt;
+        if (!delta) {
+            return Result<CheckpointHandle>::failure(ErrorCode::CheckpointCorrupted,
+                "Corrupted auto-save delta: " + std::to_string(id));
+        }
+        auto base = fetch(std::strtoull(tag->second.c_str(), nullptr, 10));
+        if (base.isError()) {
+            return Result<CheckpointHandle>::failure(base.error,
+                "Auto-save delta base unavailable for " + std::to_string(id) + ": " + base.message);
+        }
+        
+        StateData data = (*base.value)->getData().toVector();
+        if (!delta->apply(data)) {
+            return Result<CheckpointHandle>::failure(ErrorCode::CheckpointCorrupted,
+                "Auto-save delta does not match its base: " + std::to_string(id));
+        }
+        Checkpoint full = *stored;
+        full.removeTag(AUTOSAVE_BASE_TAG);
+        full.setData(std::move(data));
+        return Result<CheckpointHandle>::success(std::make_shared<const Checkpoint>(std::move(full)));
+    }
+    
+    // Bu checkpoint'i taban alan delta auto-save'leri tam veriyle yeniden
+    // yaz; taban silinmeden / güncellenmeden önce çağrılır (mutex tutulurken)
+    void detachDependents(CheckpointId baseId) {
+        if (lastAutoSaveId == baseId) {
+            lastAutoSaveId = 0;
+        }
+        std::string key = std::to_string(baseId);
+        std::vector<CheckpointId> dependents;
+        for (const auto& [id, entry] : index) {
+            auto tag = entry.metadata.tags.find(AUTOSAVE_BASE_TAG);
+            if (tag != entry.metadata.tags.end() && tag->second == key) {
+                dependents.push_back(id);
+            }
+        }
+        for (auto id : dependents) {
+            auto full = fetch(id);
+            if (full.isSuccess()) {
+                store(*full.value);
+            }
+        }
+    }
+    
+    // Checkpoint'i storage'a yaz ve index'i güncelle; trace verilirse
+    // serialize / storage aşamaları ona yazılır
+    Result<void> store(CheckpointHandle checkpoint, TraceScope* trace = nullptr) {
+        CheckpointId id = checkpoint->getId();
+        cancelPending(id, WriteState::Superseded);
+        if (trace) trace->stage("serialize");
+        SharedBuffer serialized(checkpoint->serialize());
+        if (trace) {
+            trace->count("bytes_serialized", serialized.size());
+            trace->stage("storage");
+        }
+        Result<void> result = Result<void>::success();
+        {
+            std::lock_guard<std::mutex> io(storageMutex);
+            result = storage->saveShared(id, serialized);
+        }
+        if (trace) trace->stage("index");
+        index[id] = makeCheckpointIndexEntry(*checkpoint, serialized.size());
+        indexDirty = true;
+        cachePut(std::move(checkpoint));
+        if (id > latestCheckpointId) {
+            latestCheckpointId = id;
+        }
+        return result;
+    }
+    
+    void flushIndex() {
+        if (!indexDirty) return;
+        auto serialized = serializeCheckpointIndex(index);
+        std::lock_guard<std::mutex> io(storageMutex);
+        if (storage->saveIndex(serialized).isSuccess()) {
+            indexDirty = false;
+        }
+    }
+    
+    // Sıradaki async yazmayı iptal et; storageMutex'ten önce işaretlendiği
+    // için yazıcı bundan sonra bu kaydı diske yazmaz (mutex tutulurken)
+    void cancelPending(CheckpointId id, WriteState reason) {
+        auto it = pending.find(id);
+        if (it != pending.end()) {
+            it->second->state = reason;
+            pending.erase(it);
+        }
+    }
+    
+    // Checkpoint'i index'e Pending olarak ekle ve async yazma işini hazırla;
+    // iş mutex bırakıldıktan sonra enqueueWrite'a verilir (mutex tutulurken)
+    std::shared_ptr<PendingWrite> beginAsyncWrite(Checkpoint checkpoint, CheckpointCallback onDurable) {
+        CheckpointId id = checkpoint.getId();
+        CheckpointIndexEntry entry;
+        entry.metadata = checkpoint.getMetadata();
+        entry.metadata.status = CheckpointStatus::Pending;
+        index[id] = std::move(entry);
+        indexDirty = true;
+        if (id > latestCheckpointId) {
+            latestCheckpointId = id;
+        }
+        
+        auto job = std::make_shared<PendingWrite>(
+            std::make_shared<const Checkpoint>(std::move(checkpoint)), std::move(onDurable));
+        pending[id] = job;
+        return job;
+    }
+    
+    void enqueueWrite(std::shared_ptr<PendingWrite> job) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (!writerThread.joinable()) {
+            writerThread = std::thread(&Impl::writerLoop, this);
+        }
+        writeQueue.push_back(std::move(job));
+        outstandingWrites++;
+        queueCv.notify_one();
+    }
+    
+    // Kuyruktan alınan işleri tek saveBatch ile yaz: log tabanlı storage'da
+    // bu tek sync demek. Batch başarısız olursa içindeki tüm işler hata alır.
+    void completeWrites(std::vector<std::shared_ptr<PendingWrite>>& jobs) {
+        // Serialize kilitsiz; yazma sadece storage kilidiyle
+        std::vector<StateData> serialized;
+        serialized.reserve(jobs.size());
+        for (const auto& job : jobs) {
+            serialized.push_back(job->checkpoint->serialize());
+        }
+        
+        Result<void> saved = Result<void>::success();
+        {
+            std::lock_guard<std::mutex> io(storageMutex);
+            std::vector<std::pair<CheckpointId, const StateData*>> items;
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                if (jobs[i]->state == WriteState::Queued) {
+                    items.emplace_back(jobs[i]->checkpoint->getId(), &serialized[i]);
+                }
+            }
+            if (items.size() == 1) {
+                saved = storage->save(items[0].first, *items[0].second);
+            } else if (!items.empty()) {
+                saved = storage->saveBatch(items);
+            }
+        }
+        
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            finishWrite(*jobs[i], serialized[i].size(), saved);
+        }
+    }
+    
+    void finishWrite(PendingWrite& job, size_t serializedSize, const Result<void>& saved) {
+        CheckpointId id = job.checkpoint->getId();
+        Result<CheckpointId> result = Result<CheckpointId>::success(id);
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = pending.find(id);
+            bool stillPending = it != pending.end() && it->second.get() == &job;
+            if (stillPending) pending.erase(it);
             
-            if (running && autoSaveEnabled && !currentState.empty()) {
-                // Auto-save checkpoint oluştur
-                auto id = utils::IdGenerator::generateCheckpointId();
-                Checkpoint cp(id, "AutoSave_" + utils::TimeUtils::formatTimestamp(utils::TimeUtils::now()));
-                cp.setData(currentState);
-                cp.setStatus(CheckpointStatus::Committed);
-                checkpoints[id] = cp;
-                latestCheckpointId = id;
-                
-                if (storage) {
-                    storage->save(id, cp.serialize());
+            if (job.state == WriteState::Deleted) {
+                result = Result<CheckpointId>::failure(ErrorCode::CheckpointNotFound,
+                    "Checkpoint deleted before it was written: " + std::to_string(id));
+            } else if (job.state == WriteState::Superseded) {
+                // store() üzerine yazdı; onun sonucu geçerli
+            } else if (saved.isError()) {
+                index.erase(id);
+                cacheErase(id);
+                indexDirty = true;
+                result = Result<CheckpointId>::failure(saved.error, saved.message);
+            } else if (stillPending) {
+                auto entry = index.find(id);
+                if (entry != index.end()) {
+                    entry->second = makeCheckpointIndexEntry(*job.checkpoint, serializedSize);
+                    indexDirty = true;
                 }
             }
         }
+        
+        job.promise.set_value(result);
+        if (job.onDurable) {
+            job.onDurable(result);
+        }
+    }
+    
+    void writerLoop() {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        for (;;) {
+            queueCv.wait(lock, [this] { return writerStop || !writeQueue.empty(); });
+            if (writeQueue.empty()) break;      // stop + kuyruk boş
+            
+            // Biriken işleri bir seferde al (group commit)
+            std::vector<std::shared_ptr<PendingWrite>> jobs;
+            while (!writeQueue.empty() && jobs.size() < MAX_WRITE_BATCH) {
+                jobs.push_back(std::move(writeQueue.front()));
+                writeQueue.pop_front();
+            }
+            lock.unlock();
+            completeWrites(jobs);
+            lock.lock();
+            
+            outstandingWrites -= jobs.size();
+            if (outstandingWrites == 0) {
+                drainedCv.notify_all();
+            }
+        }
+    }
+    
+    void stopWriter() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            writerStop = true;
+            queueCv.notify_all();
+        }
+        if (writerThread.joinable()) {
+            writerThread.join();
+        }
+    }
+    
+    // Kalıcı index'i yükle ve storage ile uzlaştır: index'te olmayan ya da
+    // boyutu değişmiş kayıtların sadece metadata'sı payload'dan çıkarılır,
+    // storage'da artık bulunmayanlar atılır
+    void loadIndex() {
+        auto persisted = storage->loadIndex();
+        if (persisted.isSuccess()) {
+            auto parsed = deserializeCheckpointIndex(*persisted.value);
+            if (parsed) index = std::move(*parsed);
+        }
+        
+        auto ids = storage->listAll();
+        std::map<CheckpointId, CheckpointIndexEntry> reconciled;
+        for (auto id : ids) {
+            auto it = index.find(id);
+            if (it != index.end() && it->second.storedSize == storage->getSize(id)) {
+                reconciled[id] = std::move(it->second);
+                continue;
+            }
+            
+            auto result = storage->loadShared(id);
+            if (result.isSuccess()) {
+                auto checkpoint = std::make_shared<const Checkpoint>(Checkpoint::deserialize(*result.value));
+                reconciled[id] = makeCheckpointIndexEntry(*checkpoint, result.value->size());
+                // Delta kayıtlar cache'e ancak tabanla birleştirilince girer
+                if (checkpoint->getMetadata().tags.count(AUTOSAVE_BASE_TAG) == 0) {
+                    cachePut(std::move(checkpoint));
+                }
+            }
+            indexDirty = true;
+        }
+        if (reconciled.size() != index.size()) {
+            indexDirty = true;
+        }
+        index = std::move(reconciled);
+        
+        if (!index.empty()) {
+            latestCheckpointId = index.rbegin()->first;
+        }
+        flushIndex();
+    }
+    
+    // Güncel durumu auto-save checkpoint'i olarak kuyruğa al; değişiklik
+    // yoksa nullopt. mutex sadece durum referansı alınırken ve kayıt index'e
+    // eklenirken tutulur.
+    std::optional<CheckpointId> autoSave() {
+        SharedBuffer state, baseState;
+        uint64_t generation;
+        CheckpointId baseId = 0;
+        size_t chainLength;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (currentState.empty() || stateGeneration == savedGeneration) {
+                return std::nullopt;
+            }
+            state = currentState;
+            generation = stateGeneration;
+            chainLength = autoSaveChainLength;
+            if (autoSaveMode == AutoSaveMode::Delta && lastAutoSaveId != 0 &&
+                chainLength < MAX_AUTOSAVE_DELTA_CHAIN && index.count(lastAutoSaveId) != 0) {
+                baseId = lastAutoSaveId;
+                baseState = lastAutoSaveState;
+            }
+        }
+        
+        auto id = utils::IdGenerator::generateCheckpointId();
+        Checkpoint cp(id, "AutoSave_" + utils::TimeUtils::formatTimestamp(utils::TimeUtils::now()));
+        cp.setStatus(CheckpointStatus::Committed);
+        bool isDelta = false;
+        if (baseId != 0) {
+            auto delta = BlockDelta::compute(baseState.data(), baseState.size(), state.data(), state.size());
+            if (delta.isIdentity()) {
+                // İçerik son auto-save ile aynı
+                std::lock_guard<std::mutex> lock(mutex);
+                savedGeneration = std::max(savedGeneration, generation);
+                return std::nullopt;
+            }
+            if (delta.xorData.size() < state.size() / 2) {
+                cp.setData(delta.serialize());
+                cp.addTag(AUTOSAVE_BASE_TAG, std::to_string(baseId));
+                isDelta = true;
+            }
+        }
+        if (!isDelta) {
+            cp.setData(state);      // kopya yok
+        }
+        
+        std::shared_ptr<PendingWrite> job;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Taban bu arada silindi / güncellendi: tam kayıt
+            if (isDelta && lastAutoSaveId != baseId) {
+                cp.removeTag(AUTOSAVE_BASE_TAG);
+                cp.setData(state);
+                isDelta = false;
+            }
+            savedGeneration = std::max(savedGeneration, generation);
+            lastAutoSaveId = id;
+            lastAutoSaveState = state;
+            autoSaveChainLength = isDelta ? chainLength + 1 : 0;
+            job = beginAsyncWrite(std::move(cp), nullptr);
+        }
+        enqueueWrite(std::move(job));
+        return id;
+    }
+    
+    void autoSaveLoop() {
+        while (running) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait_for(lock, autoSaveInterval, [this]{ return !running.load(); });
+                if (!running || !autoSaveEnabled) continue;
+            }
+            autoSave();
+        }
     }
 };
 
@@ -350,24 +720,20 @@ StateManager::StateManager() : m_impl(std::make_unique<Impl>()) {
 }
 
 StateManager::StateManager(const std::filesystem::path& storagePath) 
+    : StateManager(std::make_unique<FileStorage>(storagePath)) {
+}
+
+StateManager::StateManager(std::unique_ptr<IStorage> storage)
     : m_impl(std::make_unique<Impl>()) {
-    m_impl->storage = std::make_unique<FileStorage>(storagePath);
-    
-    // Mevcut checkpoint'leri yükle
-    auto ids = m_impl->storage->listAll();
-    for (auto id : ids) {
-        auto result = m_impl->storage->load(id);
-        if (result.isSuccess()) {
-            auto checkpoint = Checkpoint::deserialize(*result.value);
-            m_impl->checkpoints[id] = checkpoint;
-            if (id > m_impl->latestCheckpointId) {
-                m_impl->latestCheckpointId = id;
-            }
-        }
-    }
+    m_impl->storage = std::move(storage);
+    
+    // Mevcut checkpoint'lerin sadece metadata'sı yüklenir
+    m_impl->loadIndex();
 }
 
 StateManager::~StateManager() {
+    if (!m_impl) return;    // moved-from
+    
     if (m_impl->running) {
         m_impl->running = false;
         m_impl->cv.notify_all();
@@ -375,53 +741,83 @@ StateManager::~StateManager() {
             m_impl->autoSaveThread.join();
         }
     }
+    m_impl->stopWriter();       // kuyrukta kalanlar yazılır
+    m_impl->flushIndex();
 }
 
 StateManager::StateManager(StateManager&&) noexcept = default;
 StateManager& StateManager::operator=(StateManager&&) noexcept = default;
 
 Result<CheckpointId> StateManager::createCheckpoint(const std::string& name, const StateData& state) {
+    TraceScope trace("state.create_checkpoint");
+    trace.stage("lock");
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
+    trace.stage("build");
     auto id = utils::IdGenerator::generateCheckpointId();
     Checkpoint checkpoint(id, name);
     checkpoint.setData(state);
     checkpoint.setStatus(CheckpointStatus::Committed);
     
-    m_impl->checkpoints[id] = checkpoint;
-    m_impl->currentState = state;
-    m_impl->latestCheckpointId = id;
+    m_impl->currentState = checkpoint.getData();
+    m_impl->savedGeneration = ++m_impl->stateGeneration;
     
-    auto saveResult = m_impl->storage->save(id, checkpoint.serialize());
+    auto saveResult = m_impl->store(std::make_shared<const Checkpoint>(std::move(checkpoint)), &trace);
     if (saveResult.isError()) {
         return Result<CheckpointId>::failure(saveResult.error, saveResult.message);
     }
     
+    trace.succeed();
     return Result<CheckpointId>::success(id);
 }
 
 Result<Checkpoint> StateManager::getCheckpoint(CheckpointId id) {
+    auto handle = getCheckpointHandle(id);
+    if (handle.isError()) {
+        return Result<Checkpoint>::failure(handle.error, handle.message);
+    }
+    return Result<Checkpoint>::success(**handle.value);
+}
+
+Result<CheckpointHandle> StateManager::getCheckpointHandle(CheckpointId id) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
-    auto it = m_impl->checkpoints.find(id);
-    if (it == m_impl->checkpoints.end()) {
-        return Result<Checkpoint>::failure(ErrorCode::CheckpointNotFound, 
-                                          "Checkpoint not found: " + std::to_string(id));
+    auto it = m_impl->index.find(id);
+    if (it == m_impl->index.end()) {
+        return Result<CheckpointHandle>::failure(ErrorCode::CheckpointNotFound, 
+                                                "Checkpoint not found: " + std::to_string(id));
     }
-    
-    return Result<Checkpoint>::success(it->second);
+    it->second.lastAccessed = utils::TimeUtils::now();
+    
+    // Cache isabetleri ayrı ölçülür; aksi halde storage yüklemesi ortalamayı gizler
+    TraceScope trace("state.get_checkpoint");
+    trace.count(m_impl->cache.count(id) ? "cache_hits" : "cache_misses");
+    auto handle = m_impl->fetch(id);
+    if (handle.isSuccess()) {
+        trace.succeed();
+    }
+    return handle;
 }
 
 Result<void> StateManager::updateCheckpoint(CheckpointId id, const StateData& state) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
-    auto it = m_impl->checkpoints.find(id);
-    if (it == m_impl->checkpoints.end()) {
+    if (m_impl->index.find(id) == m_impl->index.end()) {
         return Result<void>::failure(ErrorCode::CheckpointNotFound);
     }
     
-    it->second.setData(state);
-    m_impl->storage->save(id, it->second.serialize());
+    auto current = m_impl->fetch(id);
+    if (current.isError()) {
+        return Result<void>::failure(current.error, current.message);
+    }
+    
+    // Yayınlanmış handle'lar değişmez; kopya güncellenip yerine konur
+    m_impl->detachDependents(id);
+    Checkpoint checkpoint = **current.value;
+    checkpoint.setData(state);
+    m_impl->store(std::make_shared<const Checkpoint>(std::move(checkpoint)));
+    // Aynı boyutlu güncellemeler açılışta ayırt edilemez - index hemen yazılır
+    m_impl->flushIndex();
     
     return Result<void>::success();
 }
@@ -429,12 +825,17 @@ Result<void> StateManager::updateCheckpoint(CheckpointId id, const StateData& st
 Result<void> StateManager::deleteCheckpoint(CheckpointId id) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
-    auto it = m_impl->checkpoints.find(id);
-    if (it == m_impl->checkpoints.end()) {
+    auto it = m_impl->index.find(id);
+    if (it == m_impl->index.end()) {
         return Result<void>::failure(ErrorCode::CheckpointNotFound);
     }
     
-    m_impl->checkpoints.erase(it);
+    m_impl->detachDependents(id);
+    m_impl->index.erase(id);
+    m_impl->indexDirty = true;
+    m_impl->cacheErase(id);
+    m_impl->cancelPending(id, Impl::WriteState::Deleted);
+    std::lock_guard<std::mutex> io(m_impl->storageMutex);
     m_impl->storage->remove(id);
     
     return Result<void>::success();
@@ -444,13 +845,110 @@ std::vector<CheckpointMetadata> StateManager::listCheckpoints() {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     
     std::vector<CheckpointMetadata> result;
-    for (const auto& [id, checkpoint] : m_impl->checkpoints) {
-        result.push_back(checkpoint.getMetadata());
+    result.reserve(m_impl->index.size());
+    for (const auto& [id, entry] : m_impl->index) {
+        result.push_back(entry.metadata);
     }
     
     return result;
 }
 
+void StateManager::setCacheCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->cacheCapacity = std::max<size_t>(1, capacity);
+    while (m_impl->cache.size() > m_impl->cacheCapacity) {
+        m_impl->cache.erase(m_impl->lru.back());
+        m_impl->lru.pop_back();
+    }
+}
+
+size_t StateManager::getCachedCheckpointCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->cache.size();
+}
+
+void StateManager::flushIndex() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->flushIndex();
+}
+
+std::vector<ScrubCandidate> StateManager::getScrubCandidates() const {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    
+    std::vector<ScrubCandidate> result;
+    result.reserve(m_impl->index.size());
+    for (const auto& [id, entry] : m_impl->index) {
+        if (m_impl->pending.count(id) != 0 ||
+            entry.metadata.status == CheckpointStatus::Corrupted) continue;
+        result.push_back({id, entry.storedSize, entry.metadata.modifiedAt,
+                          entry.lastVerified, entry.lastAccessed});
+    }
+    return result;
+}
+
+Result<bool> StateManager::verifyStoredCheckpoint(CheckpointId id) {
+    CheckpointIndexEntry expected;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        auto it = m_impl->index.find(id);
+        if (it == m_impl->index.end()) {
+            return Result<bool>::failure(ErrorCode::CheckpointNotFound,
+                                         "Checkpoint not found: " + std::to_string(id));
+        }
+        if (m_impl->pending.count(id) != 0) {
+            return Result<bool>::failure(ErrorCode::InvalidState,
+                                         "Checkpoint not yet written: " + std::to_string(id));
+        }
+        expected = it->second;
+    }
+    
+    // Okuma ve checksum mutex dışında: okuyucular tarama yüzünden beklemez
+    Result<SharedBuffer> loaded = Result<SharedBuffer>::failure(ErrorCode::Unknown);
+    {
+        std::lock_guard<std::mutex> io(m_impl->storageMutex);
+        loaded = m_impl->storage->loadShared(id);
+    }
+    if (loaded.isError() && loaded.error == ErrorCode::CheckpointNotFound) {
+        return Result<bool>::failure(loaded.error, loaded.message);
+    }
+    
+    // Okunamayan kayıt (ör. bozuk chunk) da bozuk sayılır.
+    // Kayıt düzeni: metaSize u32 | meta | dataSize u32 | data | ...
+    SharedBuffer record = loaded.isSuccess() ? *loaded.value : SharedBuffer();
+    const auto& meta = expected.metadata;
+    bool intact = loaded.isSuccess() && record.size() == expected.storedSize &&
+                  expected.dataOffset >= sizeof(uint32_t) &&
+                  expected.dataOffset + meta.dataSize <= record.size();
+    if (intact) {
+        uint32_t dataSize = 0;
+        std::memcpy(&dataSize, record.data() + expected.dataOffset - sizeof(uint32_t), sizeof(dataSize));
+        const uint8_t* data = record.data() + expected.dataOffset;
+        intact = dataSize == meta.dataSize &&
+                 (meta.dataSize == 0 || crc32c(data, meta.dataSize) == meta.checksum ||
+                  // CRC32C öncesi checkpoint'ler
+                  BinarySerializer().verifyChecksum(StateData(data, data + meta.dataSize), meta.checksum));
+    }
+    
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    auto it = m_impl->index.find(id);
+    // Bu arada güncellenen / silinen kayıt için sonuç geçersiz
+    if (it == m_impl->index.end() || it->second.storedSize != expected.storedSize ||
+        it->second.metadata.checksum != meta.checksum ||
+        it->second.metadata.modifiedAt != meta.modifiedAt) {
+        return Result<bool>::failure(ErrorCode::InvalidState,
+                                     "Checkpoint changed during verification: " + std::to_string(id));
+    }
+    if (intact) {
+        it->second.lastVerified = utils::TimeUtils::now();
+    } else {
+        it->second.metadata.status = CheckpointStatus::Corrupted;
+        // Cache'teki sağlam kopya storage'daki bozulmayı gizlemesin
+        m_impl->cacheErase(id);
+    }
+    m_impl->indexDirty = true;
+    return Result<bool>::success(intact);
+}
+
 void StateManager::setAutoSaveInterval(Duration interval) {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
     m_impl->autoSaveInterval = interval;
@@ -471,9 +969,66 @@ void StateManager::enableAutoSave(bool enable) {
     m_impl->autoSaveEnabled = enable;
 }
 
+void StateManager::setAutoSaveMode(AutoSaveMode mode) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->autoSaveMode = mode;
+}
+
+std::optional<CheckpointId> StateManager::autoSaveNow() {
+    return m_impl->autoSave();
+}
+
 Result<StateData> StateManager::getCurrentState() {
     std::lock_guard<std::mutex> lock(m_impl->mutex);
-    return Result<StateData>::success(m_impl->currentState);
+    return Result<StateData>::success(m_impl->currentState.toVector());
+}
+
+SharedBuffer StateManager::getCurrentStateBuffer() {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->currentState;
+}
+
+void StateManager::setCurrentState(const StateData& state) {
+    setCurrentState(SharedBuffer::copyOf(state));
+}
+
+void StateManager::setCurrentState(SharedBuffer state) {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->currentState = std::move(state);
+    m_impl->stateGeneration++;
+}
+
+std::future<Result<CheckpointId>> StateManager::createCheckpointAsync(const std::string& name,
+                                                                      StateData&& state,
+                                                                      CheckpointCallback onDurable) {
+    std::shared_ptr<Impl::PendingWrite> job;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        
+        auto id = utils::IdGenerator::generateCheckpointId();
+        Checkpoint checkpoint(id, name);
+        checkpoint.setData(std::move(state));
+        checkpoint.setStatus(CheckpointStatus::Committed);
+        m_impl->currentState = checkpoint.getData();    // kopya yok, veri paylaşılır
+        m_impl->savedGeneration = ++m_impl->stateGeneration;
+        
+        // Yazılana kadar index'te Pending görünür
+        job = m_impl->beginAsyncWrite(std::move(checkpoint), std::move(onDurable));
+    }
+    
+    auto future = job->promise.get_future();
+    m_impl->enqueueWrite(std::move(job));
+    return future;
+}
+
+void StateManager::waitForPendingWrites() {
+    std::unique_lock<std::mutex> lock(m_impl->queueMutex);
+    m_impl->drainedCv.wait(lock, [this] { return m_impl->outstandingWrites == 0; });
+}
+
+size_t StateManager::getPendingWriteCount() const {
+    std::lock_guard<std::mutex> lock(m_impl->queueMutex);
+    return m_impl->outstandingWrites;
 }
 
 Result<CheckpointId> StateManager::getLatestCheckpointId() {
@@ -518,10 +1073,12 @@ Result<Checkpoint> StateManager::loadFromFile(const std::filesystem::path& path)
 }
 
 size_t StateManager::getCheckpointCount() const {
-    return m_impl->checkpoints.size();
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->index.size();
 }
 
 size_t StateManager::getTotalStorageSize() const {
+    std::lock_guard<std::mutex> io(m_impl->storageMutex);
     return m_impl->storage->getTotalSize();
 }
 
@@ -1,10 +1,60 @@
 #include "state/storage.hpp"
 #include "core/exceptions.hpp"
+#include "core/checksum.hpp"
+#include "core/codec.hpp"
 #include <fstream>
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <unordered_set>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace checkpoint {
 
+namespace {
+
+// Index dosyası tmp + rename ile yazılır; yarım yazılmış index okunmaz
+Result<void> writeIndexFile(const std::filesystem::path& path, const StateData& index) {
+    try {
+        auto tmp = path;
+        tmp += ".tmp";
+        {
+            std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return Result<void>::failure(ErrorCode::IOError, "Cannot open index for writing");
+            }
+            file.write(reinterpret_cast<const char*>(index.data()), index.size());
+            if (!file.good()) {
+                return Result<void>::failure(ErrorCode::IOError, "Index write failed");
+            }
+        }
+        std::filesystem::rename(tmp, path);
+        return Result<void>::success();
+    } catch (const std::exception& e) {
+        return Result<void>::failure(ErrorCode::IOError, e.what());
+    }
+}
+
+Result<StateData> readIndexFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return Result<StateData>::failure(ErrorCode::CheckpointNotFound, "No index");
+    }
+    size_t size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    StateData data(size);
+    if (!file.read(reinterpret_cast<char*>(data.data()), size)) {
+        return Result<StateData>::failure(ErrorCode::IOError, "Index read failed");
+    }
+    return Result<StateData>::success(std::move(data));
+}
+
+} // namespace
+
 // ==================== FileStorage ====================
 
 FileStorage::FileStorage(const std::filesystem::path& basePath, const std::string& extension)
@@ -16,48 +66,107 @@ std::filesystem::path FileStorage::getFilePath(CheckpointId id) const {
     return m_basePath / (std::to_string(id) + m_extension);
 }
 
+IoEngine& FileStorage::ioEngine() {
+    if (!m_io) {
+        m_io = std::make_unique<IoEngine>(m_ioOptions);
+        m_writer = std::make_unique<AsyncFileWriter>(m_ioOptions, m_io.get());
+    }
+    return *m_io;
+}
+
+void FileStorage::setIoOptions(const IoEngineOptions& options) {
+    m_ioOptions = options;
+    m_writer.reset();
+    m_io.reset();
+}
+
 Result<void> FileStorage::save(CheckpointId id, const StateData& data) {
-    try {
-        std::ofstream file(getFilePath(id), std::ios::binary);
-        if (!file) {
-            return Result<void>::failure(ErrorCode::IOError, "Cannot open file for writing");
-        }
-        
-        file.write(reinterpret_cast<const char*>(data.data()), data.size());
-        
-        if (!file.good()) {
-            return Result<void>::failure(ErrorCode::IOError, "Write failed");
-        }
-        
-        return Result<void>::success();
-    } catch (const std::exception& e) {
-        return Result<void>::failure(ErrorCode::IOError, e.what());
+    return writeFile(id, data.data(), data.size());
+}
+
+Result<void> FileStorage::saveShared(CheckpointId id, const SharedBuffer& data) {
+    return writeFile(id, data.data(), data.size());
+}
+
+Result<void> FileStorage::writeFile(CheckpointId id, const uint8_t* data, size_t size) {
+    ioEngine();
+    auto path = getFilePath(id);
+    auto tmp = path;
+    tmp += ".tmp";
+    // data çağrı boyunca sabit: kopyasız, parçalar aynı anda kuyrukta
+    if (!m_writer->open(tmp.string()) ||
+        !m_writer->writeStable(data, size) ||
+        !m_writer->finish()) {
+        std::string error = m_writer->getLastError();
+        ::unlink(tmp.c_str());
+        return Result<void>::failure(ErrorCode::IOError, error);
+    }
+    if (::rename(tmp.c_str(), path.c_str()) != 0) {
+        ::unlink(tmp.c_str());
+        return Result<void>::failure(ErrorCode::IOError, "Cannot rename checkpoint file");
     }
+    return Result<void>::success();
 }
 
 Result<StateData> FileStorage::load(CheckpointId id) {
-    try {
-        auto path = getFilePath(id);
-        if (!std::filesystem::exists(path)) {
+    auto path = getFilePath(id);
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == ENOENT) {
             return Result<StateData>::failure(ErrorCode::CheckpointNotFound);
         }
-        
-        std::ifstream file(path, std::ios::binary);
-        if (!file) {
-            return Result<StateData>::failure(ErrorCode::IOError, "Cannot open file for reading");
+        return Result<StateData>::failure(ErrorCode::IOError, "Cannot open file for reading");
+    }
+    
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return Result<StateData>::failure(ErrorCode::IOError, "Cannot stat checkpoint file");
+    }
+    
+    StateData data(static_cast<size_t>(st.st_size));
+    std::string error;
+    bool ok = data.empty() ||
+              ioEngine().readFully(fd, data.data(), data.size(), 0, m_ioOptions.bufferSize, &error);
+    ::close(fd);
+    if (!ok) {
+        return Result<StateData>::failure(ErrorCode::IOError, error);
+    }
+    return Result<StateData>::success(std::move(data));
+}
+
+Result<SharedBuffer> FileStorage::loadShared(CheckpointId id) {
+    if (m_mmapThreshold == 0) {
+        return IStorage::loadShared(id);
+    }
+    auto path = getFilePath(id);
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return Result<SharedBuffer>::failure(ErrorCode::CheckpointNotFound);
         }
-        
-        file.seekg(0, std::ios::end);
-        size_t size = file.tellg();
-        file.seekg(0, std::ios::beg);
-        
-        StateData data(size);
-        file.read(reinterpret_cast<char*>(data.data()), size);
-        
-        return Result<StateData>::success(std::move(data));
-    } catch (const std::exception& e) {
-        return Result<StateData>::failure(ErrorCode::IOError, e.what());
+        return Result<SharedBuffer>::failure(ErrorCode::IOError, "Cannot open file for reading");
+    }
+    
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return Result<SharedBuffer>::failure(ErrorCode::IOError, "Cannot stat checkpoint file");
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    if (size < m_mmapThreshold) {
+        // Küçük kayıtlar için mmap + page fault okumadan pahalı
+        ::close(fd);
+        return IStorage::loadShared(id);
     }
+    
+    std::string error;
+    auto mapped = SharedBuffer::mapFile(fd, size, &error);
+    ::close(fd);
+    if (!mapped) {
+        return Result<SharedBuffer>::failure(ErrorCode::IOError, error);
+    }
+    return Result<SharedBuffer>::success(std::move(*mapped));
 }
 
 Result<void> FileStorage::remove(CheckpointId id) {
@@ -112,6 +221,15 @@ size_t FileStorage::getTotalSize() {
     return total;
 }
 
+Result<void> FileStorage::saveIndex(const StateData& index) {
+    // Checkpoint uzantısından farklı: listAll index'i görmez
+    return writeIndexFile(m_basePath / "checkpoints.idx", index);
+}
+
+Result<StateData> FileStorage::loadIndex() {
+    return readIndexFile(m_basePath / "checkpoints.idx");
+}
+
 void FileStorage::setBasePath(const std::filesystem::path& path) {
     m_basePath = path;
     std::filesystem::create_directories(path);
@@ -146,6 +264,14 @@ Result<void> MemoryStorage::save(CheckpointId id, const StateData& data) {
         return Result<void>::failure(ErrorCode::OutOfMemory, "Memory storage limit exceeded");
     }
     
+    m_storage[id] = SharedBuffer::copyOf(data);
+    return Result<void>::success();
+}
+
+Result<void> MemoryStorage::saveShared(CheckpointId id, const SharedBuffer& data) {
+    if (getTotalSize() + data.size() > m_maxSize) {
+        return Result<void>::failure(ErrorCode::OutOfMemory, "Memory storage limit exceeded");
+    }
     m_storage[id] = data;
     return Result<void>::success();
 }
@@ -155,7 +281,15 @@ Result<StateData> MemoryStorage::load(CheckpointId id) {
     if (it == m_storage.end()) {
         return Result<StateData>::failure(ErrorCode::CheckpointNotFound);
     }
-    return Result<StateData>::success(it->second);
+    return Result<StateData>::success(it->second.toVector());
+}
+
+Result<SharedBuffer> MemoryStorage::loadShared(CheckpointId id) {
+    auto it = m_storage.find(id);
+    if (it == m_storage.end()) {
+        return Result<SharedBuffer>::failure(ErrorCode::CheckpointNotFound);
+    }
+    return Result<SharedBuffer>::success(it->second);
 }
 
 Result<void> MemoryStorage::remove(CheckpointId id) {
@@ -198,47 +332,317 @@ void MemoryStorage::clear() {
 
 // ==================== HybridStorage ====================
 
-HybridStorage::HybridStorage(const std::filesystem::path& basePath, size_t memoryThreshold)
-    : m_memoryStorage(std::make_unique<MemoryStorage>(memoryThreshold))
-    , m_fileStorage(std::make_unique<FileStorage>(basePath))
-    , m_memoryThreshold(memoryThreshold) {
+HybridStorage::HybridStorage(const std::filesystem::path& basePath, size_t memoryThreshold,
+                             size_t compressedBudget)
+    : m_fileStorage(std::make_unique<FileStorage>(basePath))
+    , m_memoryBudget(memoryThreshold)
+    , m_compressedBudget(compressedBudget) {
+    m_flusher = std::thread(&HybridStorage::flushLoop, this);
+}
+
+HybridStorage::~HybridStorage() {
+    flushToFile();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_flushCv.notify_all();
+    }
+    m_flusher.join();
 }
 
 Result<void> HybridStorage::save(CheckpointId id, const StateData& data) {
-    // Küçük veriler bellekte, büyük veriler dosyada
-    if (data.size() < m_memoryThreshold / 10) {
-        return m_memoryStorage->save(id, data);
-    } else {
-        return m_fileStorage->save(id, data);
+    return store(id, SharedBuffer::copyOf(data));
+}
+
+Result<void> HybridStorage::saveShared(CheckpointId id, const SharedBuffer& data) {
+    return store(id, data);
+}
+
+Result<void> HybridStorage::store(CheckpointId id, SharedBuffer data) {
+    if (data.size() > m_memoryBudget) {
+        // Bellek katmanına sığmaz: eski kopya atılır, doğrudan dosyaya
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_entries.find(id);
+            if (it != m_entries.end()) eraseEntry(it);
+        }
+        std::lock_guard<std::mutex> io(m_fileMutex);
+        return m_fileStorage->saveShared(id, data);
     }
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Geri basınç: yazıcı yetişemiyorsa dirty byte'lar bütçeyi aşmasın.
+    // Yazma hatasında (kuyruk boş ama dirty kalmış) beklemeden devam edilir.
+    m_flushedCv.wait(lock, [&] {
+        return m_stats.dirtyBytes + data.size() <= m_memoryBudget || m_stats.dirtyBytes == 0 ||
+               (m_flushQueue.empty() && !m_flushing);
+    });
+    
+    auto it = m_entries.find(id);
+    if (it != m_entries.end()) eraseEntry(it);
+    
+    Entry entry;
+    entry.size = data.size();
+    entry.data = std::move(data);
+    entry.dirty = true;
+    entry.version = ++m_nextVersion;
+    m_memoryLru.push_front(id);
+    entry.lruPos = m_memoryLru.begin();
+    m_stats.memoryBytes += entry.size;
+    m_stats.dirtyBytes += entry.size;
+    m_entries.emplace(id, std::move(entry));
+    
+    m_flushQueue.push_back(id);
+    m_flushCv.notify_one();
+    evict();
+    return Result<void>::success();
 }
 
 Result<StateData> HybridStorage::load(CheckpointId id) {
-    // Önce bellekte ara
-    if (m_memoryStorage->exists(id)) {
-        return m_memoryStorage->load(id);
+    auto loaded = fetch(id);
+    if (loaded.isError()) {
+        return Result<StateData>::failure(loaded.error, loaded.message);
+    }
+    return Result<StateData>::success(loaded.value->toVector());
+}
+
+Result<SharedBuffer> HybridStorage::loadShared(CheckpointId id) {
+    return fetch(id);
+}
+
+Result<SharedBuffer> HybridStorage::fetch(CheckpointId id) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it != m_entries.end()) {
+            bool fromCompressed = !it->second.compressed.empty();
+            if (promote(it->second, id)) {
+                if (fromCompressed) {
+                    m_stats.compressedHits++;
+                } else {
+                    m_stats.memoryHits++;
+                }
+                SharedBuffer data = it->second.data;
+                evict();
+                return Result<SharedBuffer>::success(std::move(data));
+            }
+            // Açılamayan sıkıştırılmış kopya atılır; temiz kaydın dosyada
+            // güncel kopyası vardır
+            eraseEntry(it);
+        }
+    }
+    
+    Result<SharedBuffer> loaded = Result<SharedBuffer>::failure(ErrorCode::Unknown);
+    {
+        std::lock_guard<std::mutex> io(m_fileMutex);
+        loaded = m_fileStorage->loadShared(id);
+    }
+    if (loaded.isError() || loaded.value->size() > m_memoryBudget) {
+        return loaded;
+    }
+    
+    // Dosyadan okunan kayıt temiz olarak belleğe terfi eder (bu arada yeni
+    // bir save geldiyse onunki geçerli)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.fileLoads++;
+    if (m_entries.find(id) == m_entries.end()) {
+        Entry entry;
+        entry.size = loaded.value->size();
+        entry.data = *loaded.value;
+        m_memoryLru.push_front(id);
+        entry.lruPos = m_memoryLru.begin();
+        m_stats.memoryBytes += entry.size;
+        m_entries.emplace(id, std::move(entry));
+        evict();
+    }
+    return loaded;
+}
+
+// Girdiyi bellek katmanının başına al; sıkıştırılmış katmandaysa açıp taşı
+// (m_mutex tutulurken). Açılamazsa false, girdi yerinde kalır.
+bool HybridStorage::promote(Entry& entry, CheckpointId id) {
+    if (entry.compressed.empty()) {
+        m_memoryLru.splice(m_memoryLru.begin(), m_memoryLru, entry.lruPos);
+        return true;
+    }
+    
+    CompressedFrame frame;
+    StateData plain(entry.size);
+    if (!frame.open(entry.compressed.data(), entry.compressed.size()) ||
+        frame.originalSize() != entry.size || !frame.decompressAll(plain.data())) {
+        return false;
+    }
+    m_stats.compressedBytes -= entry.compressed.size();
+    m_stats.compressedEntries--;
+    entry.compressed = SharedBuffer();
+    entry.data = SharedBuffer(std::move(plain));
+    m_compressedLru.erase(entry.lruPos);
+    m_memoryLru.push_front(id);
+    entry.lruPos = m_memoryLru.begin();
+    m_stats.memoryBytes += entry.size;
+    return true;
+}
+
+void HybridStorage::eraseEntry(std::unordered_map<CheckpointId, Entry>::iterator it) {
+    Entry& entry = it->second;
+    if (!entry.compressed.empty()) {
+        m_stats.compressedBytes -= entry.compressed.size();
+        m_stats.compressedEntries--;
+        m_compressedLru.erase(entry.lruPos);
+    } else {
+        m_stats.memoryBytes -= entry.size;
+        m_memoryLru.erase(entry.lruPos);
+    }
+    if (entry.dirty) {
+        m_stats.dirtyBytes -= entry.size;
+        m_flushedCv.notify_all();
+    }
+    m_entries.erase(it);
+}
+
+// Bütçeyi aşan temiz kayıtları en az kullanılandan başlayarak aşağı katmana
+// düşür (m_mutex tutulurken). Temiz kayıtların dosyada güncel kopyası vardır.
+void HybridStorage::evict() {
+    auto victim = m_memoryLru.end();
+    while (m_stats.memoryBytes > m_memoryBudget && victim != m_memoryLru.begin()) {
+        --victim;
+        auto it = m_entries.find(*victim);
+        if (it->second.dirty) continue;
+        
+        CheckpointId id = *victim;
+        Entry& entry = it->second;
+        victim = m_memoryLru.erase(victim);
+        m_stats.memoryBytes -= entry.size;
+        m_stats.evictions++;
+        
+        StateData frame;
+        if (m_compressedBudget > 0) {
+            frame = CompressedFrame::compress(Lz4Codec(), entry.data.data(), entry.size);
+        }
+        if (!frame.empty() && frame.size() < entry.size && frame.size() <= m_compressedBudget) {
+            entry.data = SharedBuffer();
+            entry.compressed = SharedBuffer(std::move(frame));
+            m_compressedLru.push_front(id);
+            entry.lruPos = m_compressedLru.begin();
+            m_stats.compressedBytes += entry.compressed.size();
+            m_stats.compressedEntries++;
+        } else {
+            m_entries.erase(it);
+        }
+    }
+    
+    while (m_stats.compressedBytes > m_compressedBudget && !m_compressedLru.empty()) {
+        eraseEntry(m_entries.find(m_compressedLru.back()));
     }
-    // Sonra dosyada ara
-    return m_fileStorage->load(id);
+}
+
+void HybridStorage::flushLoop() {
+    for (;;) {
+        CheckpointId id;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_flushCv.wait(lock, [this] { return m_stop || !m_flushQueue.empty(); });
+            if (m_flushQueue.empty()) return;      // stop + kuyruk boş
+            id = m_flushQueue.front();
+            m_flushQueue.pop_front();
+            m_flushing = true;
+        }
+        
+        // Dosya kilidi yazma boyunca tutulur: remove bu arada dosyayı silemez,
+        // yazmadan önce kaydın hâlâ dirty olduğu kontrol edilir
+        {
+            std::lock_guard<std::mutex> io(m_fileMutex);
+            SharedBuffer data;
+            uint64_t version = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_entries.find(id);
+                if (it != m_entries.end() && it->second.dirty) {
+                    data = it->second.data;
+                    version = it->second.version;
+                }
+            }
+            if (version != 0 && m_fileStorage->saveShared(id, data).isSuccess()) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_entries.find(id);
+                if (it != m_entries.end() && it->second.version == version) {
+                    it->second.dirty = false;
+                    m_stats.dirtyBytes -= it->second.size;
+                    m_stats.writeBacks++;
+                    evict();
+                }
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flushing = false;
+        m_flushedCv.notify_all();
+    }
+}
+
+void HybridStorage::flushToFile() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Daha önce yazılamamış kayıtlar yeniden denenir
+    for (const auto& [id, entry] : m_entries) {
+        if (entry.dirty) m_flushQueue.push_back(id);
+    }
+    m_flushCv.notify_one();
+    m_flushedCv.wait(lock, [this] { return m_flushQueue.empty() && !m_flushing; });
+}
+
+void HybridStorage::loadToMemory(CheckpointId id) {
+    fetch(id);
+}
+
+void HybridStorage::setCompressedBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compressedBudget = bytes;
+    evict();
+}
+
+HybridStorage::Stats HybridStorage::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.memoryEntries = m_memoryLru.size();
+    return stats;
 }
 
 Result<void> HybridStorage::remove(CheckpointId id) {
-    if (m_memoryStorage->exists(id)) {
-        m_memoryStorage->remove(id);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it != m_entries.end()) eraseEntry(it);
     }
+    std::lock_guard<std::mutex> io(m_fileMutex);
     if (m_fileStorage->exists(id)) {
-        m_fileStorage->remove(id);
+        return m_fileStorage->remove(id);
     }
     return Result<void>::success();
 }
 
 bool HybridStorage::exists(CheckpointId id) {
-    return m_memoryStorage->exists(id) || m_fileStorage->exists(id);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.count(id) != 0) return true;
+    }
+    std::lock_guard<std::mutex> io(m_fileMutex);
+    return m_fileStorage->exists(id);
 }
 
 std::vector<CheckpointId> HybridStorage::listAll() {
-    auto memIds = m_memoryStorage->listAll();
-    auto fileIds = m_fileStorage->listAll();
+    std::vector<CheckpointId> memIds;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [id, _] : m_entries) {
+            memIds.push_back(id);
+        }
+    }
+    std::sort(memIds.begin(), memIds.end());
+    std::vector<CheckpointId> fileIds;
+    {
+        std::lock_guard<std::mutex> io(m_fileMutex);
+        fileIds = m_fileStorage->listAll();
+    }
     
     std::vector<CheckpointId> result;
     std::set_union(memIds.begin(), memIds.end(),
@@ -249,34 +653,408 @@ std::vector<CheckpointId> HybridStorage::listAll() {
 }
 
 size_t HybridStorage::getSize(CheckpointId id) {
-    if (m_memoryStorage->exists(id)) {
-        return m_memoryStorage->getSize(id);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it != m_entries.end()) return it->second.size;
     }
+    std::lock_guard<std::mutex> io(m_fileMutex);
     return m_fileStorage->getSize(id);
 }
 
 size_t HybridStorage::getTotalSize() {
-    return m_memoryStorage->getTotalSize() + m_fileStorage->getTotalSize();
+    size_t total = 0;
+    for (auto id : listAll()) {
+        total += getSize(id);
+    }
+    return total;
 }
 
-void HybridStorage::flushToFile() {
-    auto ids = m_memoryStorage->listAll();
-    for (auto id : ids) {
-        auto data = m_memoryStorage->load(id);
-        if (data.isSuccess()) {
-            m_fileStorage->save(id, *data.value);
-            m_memoryStorage->remove(id);
+Result<void> HybridStorage::saveIndex(const StateData& index) {
+    std::lock_guard<std::mutex> io(m_fileMutex);
+    return m_fileStorage->saveIndex(index);
+}
+
+Result<StateData> HybridStorage::loadIndex() {
+    std::lock_guard<std::mutex> io(m_fileMutex);
+    return m_fileStorage->loadIndex();
+}
+
+// ==================== ChunkStorage ====================
+
+namespace {
+
+constexpr char MANIFEST_MAGIC[4] = {'C', 'K', 'M', 'F'};
+constexpr uint32_t MANIFEST_VERSION = 1;
+constexpr size_t MANIFEST_HEADER_SIZE = 4 + 4 + 8 + 4;
+constexpr size_t MANIFEST_ENTRY_SIZE = 8 + 4 + 4;
+
+// Gear rolling hash tablosu (splitmix64 ile sabit üretilir - sınırlar
+// süreçler ve sürümler arasında aynı kalmalı)
+const std::array<uint64_t, 256>& gearTable() {
+    static const std::array<uint64_t, 256> table = [] {
+        std::array<uint64_t, 256> t{};
+        uint64_t x = 0x6A09E667F3BCC908ULL;
+        for (auto& v : t) {
+            x += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = x;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            v = z ^ (z >> 31);
         }
+        return t;
+    }();
+    return table;
+}
+
+template<typename T>
+void appendPod(std::vector<uint8_t>& out, T value) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), p, p + sizeof(T));
+}
+
+template<typename T>
+T loadPod(const uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+std::optional<StateData> readWholeFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return std::nullopt;
+    }
+    size_t size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    StateData data(size);
+    if (!file.read(reinterpret_cast<char*>(data.data()), size)) {
+        return std::nullopt;
     }
+    return data;
 }
 
-void HybridStorage::loadToMemory(CheckpointId id) {
-    if (m_fileStorage->exists(id) && !m_memoryStorage->exists(id)) {
-        auto data = m_fileStorage->load(id);
-        if (data.isSuccess()) {
-            m_memoryStorage->save(id, *data.value);
+} // namespace
+
+ChunkStorage::ChunkStorage(const std::filesystem::path& basePath)
+    : m_basePath(basePath), m_storedBytes(0) {
+    std::filesystem::create_directories(basePath / "manifests");
+    std::filesystem::create_directories(basePath / "chunks");
+    
+    // Referans sayıları manifest'lerden kurulur (ayrı bir sayaç dosyası yok)
+    for (const auto& entry : std::filesystem::directory_iterator(basePath / "manifests")) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".manifest") {
+            continue;
+        }
+        try {
+            CheckpointId id = std::stoull(entry.path().stem().string());
+            auto manifest = readManifest(entry.path());
+            if (manifest) {
+                addRefs(*manifest);
+                m_manifests[id] = std::move(*manifest);
+            }
+        } catch (...) {
+            // Geçersiz dosya adı, atla
+        }
+    }
+}
+
+std::filesystem::path ChunkStorage::manifestPath(CheckpointId id) const {
+    return m_basePath / "manifests" / (std::to_string(id) + ".manifest");
+}
+
+std::filesystem::path ChunkStorage::chunkPath(const ChunkRef& ref) const {
+    char name[40];
+    std::snprintf(name, sizeof(name), "%016llx-%08x.chunk",
+                  static_cast<unsigned long long>(ref.hash), ref.crc);
+    return m_basePath / "chunks" / std::string(name, 2) / name;
+}
+
+std::vector<size_t> ChunkStorage::chunkBoundaries(const uint8_t* data, size_t size) {
+    // Hash'in üst bitleri son 64 byte'a bağlıdır; maske oraya uygulanır
+    constexpr int maskBits = __builtin_ctzll(AVG_CHUNK_SIZE);
+    constexpr uint64_t mask = ((1ULL << maskBits) - 1) << (64 - maskBits);
+    const auto& gear = gearTable();
+    
+    std::vector<size_t> ends;
+    size_t start = 0;
+    while (start < size) {
+        size_t remaining = size - start;
+        if (remaining <= MIN_CHUNK_SIZE) {
+            ends.push_back(size);
+            break;
+        }
+        
+        size_t limit = std::min(remaining, MAX_CHUNK_SIZE);
+        size_t cut = limit;
+        uint64_t h = 0;
+        for (size_t i = MIN_CHUNK_SIZE; i < limit; ++i) {
+            h = (h << 1) + gear[data[start + i]];
+            if ((h & mask) == 0) {
+                cut = i + 1;
+                break;
+            }
+        }
+        
+        start += cut;
+        ends.push_back(start);
+    }
+    return ends;
+}
+
+bool ChunkStorage::writeFileAtomic(const std::filesystem::path& path, const void* data, size_t size) {
+    // tmp + rename: yarıda kalan yazma eksik chunk/manifest bırakmaz
+    auto tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(static_cast<const char*>(data), size);
+        if (!file.good()) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    return !ec;
+}
+
+std::optional<ChunkStorage::Manifest> ChunkStorage::readManifest(const std::filesystem::path& path) {
+    auto bytes = readWholeFile(path);
+    if (!bytes || bytes->size() < MANIFEST_HEADER_SIZE + sizeof(uint32_t)) {
+        return std::nullopt;
+    }
+    
+    const uint8_t* p = bytes->data();
+    size_t bodySize = bytes->size() - sizeof(uint32_t);
+    if (std::memcmp(p, MANIFEST_MAGIC, sizeof(MANIFEST_MAGIC)) != 0 ||
+        loadPod<uint32_t>(p + 4) != MANIFEST_VERSION ||
+        loadPod<uint32_t>(p + bodySize) != crc32c(p, bodySize)) {
+        return std::nullopt;
+    }
+    
+    Manifest manifest;
+    manifest.totalSize = loadPod<uint64_t>(p + 8);
+    uint32_t count = loadPod<uint32_t>(p + 16);
+    if (bodySize != MANIFEST_HEADER_SIZE + static_cast<size_t>(count) * MANIFEST_ENTRY_SIZE) {
+        return std::nullopt;
+    }
+    
+    manifest.chunks.resize(count);
+    const uint8_t* e = p + MANIFEST_HEADER_SIZE;
+    for (auto& ref : manifest.chunks) {
+        ref.hash = loadPod<uint64_t>(e);
+        ref.crc = loadPod<uint32_t>(e + 8);
+        ref.size = loadPod<uint32_t>(e + 12);
+        e += MANIFEST_ENTRY_SIZE;
+    }
+    return manifest;
+}
+
+void ChunkStorage::addRefs(const Manifest& manifest) {
+    for (const auto& ref : manifest.chunks) {
+        if (m_refCounts[ref]++ == 0) {
+            m_storedBytes += ref.size;
+        }
+    }
+}
+
+void ChunkStorage::dropRefs(const Manifest& manifest) {
+    for (const auto& ref : manifest.chunks) {
+        auto it = m_refCounts.find(ref);
+        if (it == m_refCounts.end()) continue;
+        if (--it->second == 0) {
+            m_storedBytes -= ref.size;
+            m_refCounts.erase(it);
+            std::error_code ec;
+            std::filesystem::remove(chunkPath(ref), ec);
+        }
+    }
+}
+
+Result<void> ChunkStorage::save(CheckpointId id, const StateData& data) {
+    try {
+        Manifest manifest;
+        manifest.totalSize = data.size();
+        
+        std::unordered_set<ChunkRef, ChunkRefHash> written;
+        size_t start = 0;
+        for (size_t end : chunkBoundaries(data.data(), data.size())) {
+            ChunkRef ref;
+            ref.hash = xxhash64(data.data() + start, end - start);
+            ref.crc = crc32c(data.data() + start, end - start);
+            ref.size = static_cast<uint32_t>(end - start);
+            
+            // Bilinen chunk: sadece referans
+            if (m_refCounts.find(ref) == m_refCounts.end() && written.insert(ref).second) {
+                auto path = chunkPath(ref);
+                std::filesystem::create_directories(path.parent_path());
+                if (!writeFileAtomic(path, data.data() + start, ref.size)) {
+                    return Result<void>::failure(ErrorCode::IOError, "Chunk write failed");
+                }
+            }
+            
+            manifest.chunks.push_back(ref);
+            start = end;
+        }
+        
+        std::vector<uint8_t> bytes;
+        bytes.reserve(MANIFEST_HEADER_SIZE + manifest.chunks.size() * MANIFEST_ENTRY_SIZE + 4);
+        bytes.insert(bytes.end(), MANIFEST_MAGIC, MANIFEST_MAGIC + sizeof(MANIFEST_MAGIC));
+        appendPod(bytes, MANIFEST_VERSION);
+        appendPod(bytes, manifest.totalSize);
+        appendPod(bytes, static_cast<uint32_t>(manifest.chunks.size()));
+        for (const auto& ref : manifest.chunks) {
+            appendPod(bytes, ref.hash);
+            appendPod(bytes, ref.crc);
+            appendPod(bytes, ref.size);
+        }
+        appendPod(bytes, crc32c(bytes.data(), bytes.size()));
+        
+        if (!writeFileAtomic(manifestPath(id), bytes.data(), bytes.size())) {
+            return Result<void>::failure(ErrorCode::IOError, "Manifest write failed");
+        }
+        
+        // Önce yeni referanslar: üzerine yazılan checkpoint'le ortak
+        // chunk'lar silinmez
+        addRefs(manifest);
+        auto old = m_manifests.find(id);
+        if (old != m_manifests.end()) {
+            dropRefs(old->second);
+        }
+        m_manifests[id] = std::move(manifest);
+        
+        return Result<void>::success();
+    } catch (const std::exception& e) {
+        return Result<void>::failure(ErrorCode::IOError, e.what());
+    }
+}
+
+Result<StateData> ChunkStorage::load(CheckpointId id) {
+    auto it = m_manifests.find(id);
+    if (it == m_manifests.end()) {
+        return Result<StateData>::failure(ErrorCode::CheckpointNotFound);
+    }
+    
+    try {
+        StateData data;
+        data.reserve(it->second.totalSize);
+        for (const auto& ref : it->second.chunks) {
+            std::ifstream file(chunkPath(ref), std::ios::binary);
+            if (!file) {
+                return Result<StateData>::failure(ErrorCode::CheckpointCorrupted, "Missing chunk");
+            }
+            size_t offset = data.size();
+            data.resize(offset + ref.size);
+            file.read(reinterpret_cast<char*>(data.data() + offset), ref.size);
+            if (static_cast<size_t>(file.gcount()) != ref.size ||
+                crc32c(data.data() + offset, ref.size) != ref.crc) {
+                return Result<StateData>::failure(ErrorCode::CheckpointCorrupted, "Chunk checksum mismatch");
+            }
+        }
+        return Result<StateData>::success(std::move(data));
+    } catch (const std::exception& e) {
+        return Result<StateData>::failure(ErrorCode::IOError, e.what());
+    }
+}
+
+Result<void> ChunkStorage::remove(CheckpointId id) {
+    auto it = m_manifests.find(id);
+    if (it == m_manifests.end()) {
+        return Result<void>::success();
+    }
+    
+    try {
+        // Önce manifest: çökme sahipsiz chunk bırakabilir (collectGarbage
+        // temizler) ama eksik chunk'lı manifest bırakmaz
+        std::filesystem::remove(manifestPath(id));
+        dropRefs(it->second);
+        m_manifests.erase(it);
+        return Result<void>::success();
+    } catch (const std::exception& e) {
+        return Result<void>::failure(ErrorCode::IOError, e.what());
+    }
+}
+
+bool ChunkStorage::exists(CheckpointId id) {
+    return m_manifests.find(id) != m_manifests.end();
+}
+
+std::vector<CheckpointId> ChunkStorage::listAll() {
+    std::vector<CheckpointId> ids;
+    for (const auto& [id, _] : m_manifests) {
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+size_t ChunkStorage::getSize(CheckpointId id) {
+    auto it = m_manifests.find(id);
+    return it != m_manifests.end() ? it->second.totalSize : 0;
+}
+
+size_t ChunkStorage::getTotalSize() {
+    size_t total = m_storedBytes;
+    for (const auto& [_, manifest] : m_manifests) {
+        total += MANIFEST_HEADER_SIZE + manifest.chunks.size() * MANIFEST_ENTRY_SIZE + sizeof(uint32_t);
+    }
+    return total;
+}
+
+size_t ChunkStorage::collectGarbage() {
+    // Silme iterasyon bitince: iterator'ı geçersiz kılmamak için önce topla
+    std::vector<std::filesystem::path> orphans;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_basePath / "chunks")) {
+        if (!entry.is_regular_file()) continue;
+        
+        // <hash>-<crc>.chunk, boyut dosyadan
+        const auto name = entry.path().filename().string();
+        ChunkRef ref{};
+        unsigned long long hash = 0;
+        unsigned crc = 0;
+        bool known = false;
+        if (entry.path().extension() == ".chunk" &&
+            std::sscanf(name.c_str(), "%16llx-%8x", &hash, &crc) == 2) {
+            ref.hash = hash;
+            ref.crc = crc;
+            ref.size = static_cast<uint32_t>(entry.file_size());
+            known = m_refCounts.find(ref) != m_refCounts.end();
         }
+        
+        if (!known) {
+            orphans.push_back(entry.path());
+        }
+    }
+    
+    size_t removed = 0;
+    for (const auto& path : orphans) {
+        std::error_code ec;
+        if (std::filesystem::remove(path, ec)) {
+            removed++;
+        }
+    }
+    return removed;
+}
+
+Result<void> ChunkStorage::saveIndex(const StateData& index) {
+    return writeIndexFile(m_basePath / "checkpoints.idx", index);
+}
+
+Result<StateData> ChunkStorage::loadIndex() {
+    return readIndexFile(m_basePath / "checkpoints.idx");
+}
+
+ChunkStorage::Stats ChunkStorage::getStats() const {
+    Stats stats{};
+    stats.checkpoints = m_manifests.size();
+    stats.uniqueChunks = m_refCounts.size();
+    stats.storedBytes = m_storedBytes;
+    for (const auto& [_, manifest] : m_manifests) {
+        stats.logicalBytes += manifest.totalSize;
     }
+    return stats;
 }
 
 } // namespace checkpoint
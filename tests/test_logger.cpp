@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 #include "logger/operation_logger.hpp"
+#include "logger/log_ring.hpp"
+#include "logger/binary_log.hpp"
+#include "logger/log_history.hpp"
 #include "utils/helpers.hpp"
 #include <filesystem>
 #include <thread>
 #include <sstream>
+#include <atomic>
+#include <set>
 
 using namespace checkpoint;
 
@@ -271,3 +276,390 @@ TEST_F(LoggerTest, ConcurrentLogging) {
     auto entries = logger.getEntries(LogLevel::Info, numThreads * logsPerThread);
     EXPECT_EQ(entries.size(), numThreads * logsPerThread);
 }
+
+// Async Ring Tests
+namespace {
+
+class CountingLogOutput : public ILogOutput {
+public:
+    std::atomic<size_t> writes{0};
+    std::atomic<bool> blocked{false};
+
+    void write(const std::string&) override {
+        while (blocked.load()) std::this_thread::yield();
+        writes++;
+    }
+    void flush() override {}
+};
+
+class CountingFormatter : public ILogFormatter {
+public:
+    size_t calls = 0;
+
+    std::string format(const LogEntry& entry) override {
+        calls++;
+        return entry.message;
+    }
+};
+
+} // namespace
+
+TEST_F(LoggerTest, MpscRingPreservesOrderAndReportsFull) {
+    MpscRing<int> ring(3);
+    EXPECT_EQ(ring.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush([i](int& slot) { slot = i; }));
+    }
+    EXPECT_FALSE(ring.tryPush([](int& slot) { slot = 99; }));
+
+    std::vector<int> seen;
+    EXPECT_EQ(ring.drain([&](int& v) { seen.push_back(v); }, 3), 3u);
+    EXPECT_TRUE(ring.tryPush([](int& slot) { slot = 4; }));
+    ring.drain([&](int& v) { seen.push_back(v); }, 10);
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(LoggerTest, MpscRingConcurrentProducers) {
+    MpscRing<uint64_t> ring(1024);
+    const int numThreads = 4;
+    const uint64_t perThread = 20000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&ring, t, perThread]() {
+            for (uint64_t i = 0; i < perThread; ++i) {
+                uint64_t value = (static_cast<uint64_t>(t) << 32) | i;
+                while (!ring.tryPush([value](uint64_t& slot) { slot = value; })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Her üreticinin kayıtları kendi içinde sıralı gelmeli
+    std::vector<uint64_t> next(numThreads, 0);
+    uint64_t total = 0;
+    bool ordered = true;
+    while (total < numThreads * perThread) {
+        total += ring.drain([&](uint64_t& v) {
+            auto t = v >> 32;
+            ordered = ordered && (v & 0xFFFFFFFF) == next[t];
+            next[t]++;
+        }, 256);
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(ring.enqueued(), numThreads * perThread);
+}
+
+TEST_F(LoggerTest, AsyncLoggingDeliversAllEntries) {
+    OperationLogger logger;
+    auto counter = std::make_shared<CountingLogOutput>();
+    logger.addOutput(counter);
+    logger.setAsyncQueue(64);
+    logger.enableAsync(true);
+
+    const int numThreads = 4;
+    const int logsPerThread = 250;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&logger, t, logsPerThread]() {
+            for (int i = 0; i < logsPerThread; ++i) {
+                logger.info("Async" + std::to_string(t), "Message " + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    logger.flush();
+    EXPECT_EQ(counter->writes.load(), static_cast<size_t>(numThreads * logsPerThread));
+    EXPECT_EQ(logger.getEntries(LogLevel::Info, 10000).size(),
+              static_cast<size_t>(numThreads * logsPerThread));
+    EXPECT_EQ(logger.getDroppedCount(), 0u);
+
+    // Async kapatıldıktan sonra senkron yola dönülür
+    logger.enableAsync(false);
+    logger.info("Sync", "after async");
+    EXPECT_EQ(counter->writes.load(), static_cast<size_t>(numThreads * logsPerThread + 1));
+}
+
+TEST_F(LoggerTest, AsyncDropPolicyCountsOverflow) {
+    OperationLogger logger;
+    auto counter = std::make_shared<CountingLogOutput>();
+    counter->blocked = true;
+    logger.addOutput(counter);
+    logger.setAsyncQueue(4, LogOverflowPolicy::Drop);
+    logger.enableAsync(true);
+
+    for (int i = 0; i < 100; ++i) {
+        logger.info("Drop", "Message " + std::to_string(i));
+    }
+    EXPECT_GT(logger.getDroppedCount(), 0u);
+
+    counter->blocked = false;
+    logger.flush();
+    EXPECT_EQ(counter->writes.load() + logger.getDroppedCount(), 100u);
+    logger.enableAsync(false);
+}
+
+// Binary Log Tests
+TEST_F(LoggerTest, BinaryLogRoundTripsEntries) {
+    auto path = testLogDir / "ops.cklg";
+    std::vector<LogEntry> written;
+    {
+        BinaryLogOutput output(path);
+        for (int i = 0; i < 50; ++i) {
+            LogEntry entry{};
+            entry.id = 1000 + i;
+            entry.level = (i % 2) ? LogLevel::Warning : LogLevel::Info;
+            entry.timestamp = utils::TimeUtils::now();
+            entry.category = "Rollback";
+            entry.message = "Restored 00" + std::to_string(i) + " of " +
+                            std::to_string(i * 4096) + " bytes \x1F raw " +
+                            "184467440737095516150";
+            if (i % 3 == 0) {
+                entry.file = "rollback.cpp";
+                entry.line = 40 + i;
+                entry.context["pid"] = std::to_string(100 + i);
+            }
+            if (i == 7) entry.message = "plain 1 2 3";
+            output.writeEntry(entry);
+            written.push_back(entry);
+        }
+    }
+
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(path)) << reader.getLastError();
+    auto entries = reader.readAll();
+    EXPECT_TRUE(reader.getLastError().empty());
+    ASSERT_EQ(entries.size(), written.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].id, written[i].id);
+        EXPECT_EQ(entries[i].level, written[i].level);
+        EXPECT_EQ(entries[i].timestamp, written[i].timestamp);
+        EXPECT_EQ(entries[i].category, written[i].category);
+        EXPECT_EQ(entries[i].message, written[i].message);
+        EXPECT_EQ(entries[i].file, written[i].file);
+        EXPECT_EQ(entries[i].line, written[i].line);
+        EXPECT_EQ(entries[i].context, written[i].context);
+    }
+}
+
+TEST_F(LoggerTest, BinaryLogIsSmallerThanText) {
+    auto binPath = testLogDir / "ops.cklg";
+    auto textPath = testLogDir / "ops.log";
+    {
+        BinaryLogOutput binary(binPath);
+        FileLogOutput text(textPath);
+        TextLogFormatter formatter;
+        for (int i = 0; i < 500; ++i) {
+            LogEntry entry{};
+            entry.id = i + 1;
+            entry.level = LogLevel::Info;
+            entry.timestamp = utils::TimeUtils::now();
+            entry.category = "Checkpoint";
+            entry.message = "Checkpoint " + std::to_string(i) + " created with " +
+                            std::to_string(i * 3) + " regions";
+            binary.writeEntry(entry);
+            text.write(formatter.format(entry));
+        }
+    }
+    EXPECT_LT(std::filesystem::file_size(binPath) * 3, std::filesystem::file_size(textPath));
+}
+
+TEST_F(LoggerTest, BinaryOnlyOutputsSkipFormatting) {
+    auto path = testLogDir / "ops.cklg";
+    auto formatter = std::make_shared<CountingFormatter>();
+    {
+        OperationLogger logger;
+        logger.clearOutputs();
+        logger.setFormatter(formatter);
+        logger.addOutput(std::make_shared<BinaryLogOutput>(path));
+        for (int i = 0; i < 20; ++i) {
+            logger.info("Deferred", "Entry " + std::to_string(i));
+        }
+        EXPECT_EQ(formatter->calls, 0u);
+
+        // Metin isteyen output eklenince entry başına bir kez formatlanır
+        auto counter = std::make_shared<CountingLogOutput>();
+        logger.addOutput(counter);
+        logger.addOutput(counter);
+        logger.info("Deferred", "Entry 20");
+        EXPECT_EQ(formatter->calls, 1u);
+        EXPECT_EQ(counter->writes.load(), 2u);
+        logger.flush();
+    }
+
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    auto entries = reader.readAll();
+    ASSERT_EQ(entries.size(), 21u);
+    EXPECT_EQ(entries[5].message, "Entry 5");
+    EXPECT_EQ(entries[5].category, "Deferred");
+}
+
+TEST_F(LoggerTest, BinaryLogRendersTextAndJsonOffline) {
+    auto path = testLogDir / "ops.cklg";
+    LogEntry entry{};
+    entry.id = 42;
+    entry.level = LogLevel::Error;
+    entry.timestamp = utils::TimeUtils::now();
+    entry.category = "Restore";
+    entry.message = "Failed at page 17";
+    {
+        BinaryLogOutput output(path);
+        output.writeEntry(entry);
+    }
+
+    TextLogFormatter text;
+    JsonLogFormatter json;
+    std::ostringstream textOut, jsonOut;
+    EXPECT_EQ(BinaryLogReader::render(path, text, textOut), 1u);
+    EXPECT_EQ(BinaryLogReader::render(path, json, jsonOut), 1u);
+    EXPECT_EQ(textOut.str(), text.format(entry));
+    EXPECT_EQ(jsonOut.str(), json.format(entry));
+
+    // Yarım kalan son kayıt: önceki entry'ler okunur, hata raporlanır
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file.put(0x02);
+        file.put(0x03);
+    }
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.readAll().size(), 1u);
+    EXPECT_FALSE(reader.getLastError().empty());
+}
+
+TEST_F(LoggerTest, BinaryLogRotationKeepsFilesSelfContained) {
+    auto path = testLogDir / "rot.cklg";
+    {
+        BinaryLogOutput output(path, 512, 3);
+        for (int i = 0; i < 200; ++i) {
+            LogEntry entry{};
+            entry.id = i + 1;
+            entry.timestamp = utils::TimeUtils::now();
+            entry.category = "Rotate";
+            entry.message = "Entry " + std::to_string(i);
+            output.writeEntry(entry);
+            if (i % 10 == 9) output.flush();
+        }
+    }
+
+    ASSERT_TRUE(std::filesystem::exists(path.string() + ".0"));
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(path.string() + ".0"));
+    auto entries = reader.readAll();
+    EXPECT_TRUE(reader.getLastError().empty());
+    ASSERT_FALSE(entries.empty());
+    EXPECT_EQ(entries[0].category, "Rotate");
+}
+
+TEST_F(LoggerTest, LogEntrySerializeRoundTrip) {
+    LogEntry entry{};
+    entry.id = 7;
+    entry.level = LogLevel::Critical;
+    entry.timestamp = utils::TimeUtils::now();
+    entry.category = "State";
+    entry.message = "Checksum mismatch in block 12";
+    entry.context["checkpoint"] = "3";
+
+    LogEntry restored = LogEntry::deserialize(entry.serialize());
+    EXPECT_EQ(restored.id, entry.id);
+    EXPECT_EQ(restored.level, entry.level);
+    EXPECT_EQ(restored.timestamp, entry.timestamp);
+    EXPECT_EQ(restored.message, entry.message);
+    EXPECT_EQ(restored.context, entry.context);
+}
+
+// History Index Tests
+namespace {
+
+struct Stamped {
+    Timestamp timestamp;
+    int value;
+};
+
+} // namespace
+
+TEST_F(LoggerTest, SegmentedHistoryTimeQueryToleratesSkew) {
+    SegmentedHistory<Stamped> history;
+    const size_t total = SegmentedHistory<Stamped>::SEGMENT_SIZE * 3 + 17;
+    Timestamp base = utils::TimeUtils::now();
+
+    // Her 100 kayıtta bir, 5µs geriden gelen bir kayıt
+    std::vector<Stamped> all;
+    for (size_t i = 0; i < total; ++i) {
+        auto offset = std::chrono::microseconds(i * 10);
+        if (i % 100 == 50) offset -= std::chrono::microseconds(5);
+        Stamped item{base + offset, static_cast<int>(i)};
+        history.push(item);
+        all.push_back(item);
+    }
+
+    Timestamp start = base + std::chrono::microseconds(40000);
+    Timestamp end = base + std::chrono::microseconds(82005);
+    std::vector<int> expected, actual;
+    for (const auto& item : all) {
+        if (item.timestamp >= start && item.timestamp <= end) expected.push_back(item.value);
+    }
+    history.forEachBetween(start, end, [&](const Stamped& item) { actual.push_back(item.value); });
+    EXPECT_EQ(actual, expected);
+
+    // Retention: sadece baştaki tam segmentler atılır, seq'ler geçerli kalır
+    size_t evicted = history.evict(SegmentedHistory<Stamped>::SEGMENT_SIZE + 1, [](const Stamped&) {});
+    EXPECT_EQ(evicted, SegmentedHistory<Stamped>::SEGMENT_SIZE * 2);
+    EXPECT_EQ(history.firstSeq(), SegmentedHistory<Stamped>::SEGMENT_SIZE * 2);
+    EXPECT_EQ(history.at(history.firstSeq()).value, static_cast<int>(history.firstSeq()));
+    EXPECT_EQ(history.at(total - 1).value, static_cast<int>(total - 1));
+}
+
+TEST_F(LoggerTest, RetentionEvictsOldSegmentsAndKeepsIndexes) {
+    OperationLogger logger;
+    logger.clearOutputs();
+    const size_t seg = SegmentedHistory<OperationRecord>::SEGMENT_SIZE;
+    logger.setRetention(seg, seg);
+
+    logger.logOperation(OperationType::Checkpoint, "Evicted checkpoint", 1);
+    for (size_t i = 0; i < seg * 2; ++i) {
+        logger.logOperation(OperationType::Update, "Update", 0);
+    }
+    logger.logOperation(OperationType::Checkpoint, "Recent checkpoint", 2);
+    auto recent = logger.logOperation(OperationType::Update, "After recent", 2);
+    logger.logOperationComplete(recent, false);
+
+    EXPECT_LT(logger.getOperationCount(), seg * 2);
+    EXPECT_GE(logger.getOperationCount(), seg);
+    EXPECT_LT(logger.getEntryCount(), seg * 2);
+    EXPECT_TRUE(logger.getOperationsSince(1).empty());
+    EXPECT_TRUE(logger.getEntriesForCheckpoint(1).empty());
+
+    auto ops = logger.getOperationsSince(2);
+    ASSERT_EQ(ops.size(), 2u);
+    EXPECT_EQ(ops[0].description, "Recent checkpoint");
+    EXPECT_EQ(ops[1].id, recent);
+    EXPECT_FALSE(ops[1].canUndo);
+
+    auto entries = logger.getEntriesForCheckpoint(2);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0].message, "[CHECKPOINT] Recent checkpoint");
+}
+
+TEST_F(LoggerTest, GetOperationsSinceStartsAtFirstRelatedOperation) {
+    OperationLogger logger;
+    logger.clearOutputs();
+
+    logger.logOperation(OperationType::Update, "Before", 0);
+    logger.logOperation(OperationType::Checkpoint, "Checkpoint 5", 5);
+    logger.logOperation(OperationType::Update, "Unrelated", 0);
+    logger.logOperation(OperationType::Checkpoint, "Checkpoint 6", 6);
+    logger.logOperation(OperationType::Update, "Again 5", 5);
+
+    auto ops = logger.getOperationsSince(5);
+    ASSERT_EQ(ops.size(), 4u);
+    EXPECT_EQ(ops.front().description, "Checkpoint 5");
+    EXPECT_EQ(ops.back().description, "Again 5");
+    EXPECT_TRUE(logger.getOperationsSince(99).empty());
+}
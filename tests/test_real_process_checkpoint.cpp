@@ -0,0 +1,2529 @@
+#include <gtest/gtest.h>
+#include "real_process/ptrace_controller.hpp"
+#include "real_process/real_process_types.hpp"
+#include "real_process/checkpoint_stream.hpp"
+#include "real_process/checkpoint_image.hpp"
+#include "real_process/page_store.hpp"
+#include "real_process/parasite.hpp"
+#include "real_process/memory_manager.hpp"
+#include "real_process/fd_restorer.hpp"
+#include "real_process/aslr_handler.hpp"
+#include "real_process/proc_reader.hpp"
+#include "real_process/lazy_restore.hpp"
+#include "real_process/tracee_supervisor.hpp"
+#include "real_process/dump_buffer_pool.hpp"
+#include "real_process/live_migration.hpp"
+#include "real_process/group_checkpoint.hpp"
+#include "real_process/checkpoint_daemon.hpp"
+#include "core/binary_io.hpp"
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <thread>
+
+using namespace checkpoint::real_process;
+
+// ============================================================================
+// RealProcessCheckpoint Tests (ptrace gerektirmeyen kısımlar)
+// ============================================================================
+
+class RealProcessCheckpointTest : public ::testing::Test {
+protected:
+    static constexpr uint64_t PAGE = 4096;
+
+    MemoryRegion makeRegion(uint64_t start, uint64_t end, const std::string& path = "[heap]") {
+        MemoryRegion region{};
+        region.startAddr = start;
+        region.endAddr = end;
+        region.readable = true;
+        region.writable = true;
+        region.executable = false;
+        region.isPrivate = true;
+        region.pathname = path;
+        return region;
+    }
+
+    MemoryDump makeDump(const MemoryRegion& region, uint8_t fill) {
+        MemoryDump dump;
+        dump.region = region;
+        dump.data.assign(region.size(), fill);
+        dump.isValid = true;
+        return dump;
+    }
+
+    RealProcessCheckpoint makeBase() {
+        RealProcessCheckpoint cp;
+        cp.checkpointId = 100;
+        cp.name = "base";
+        cp.info.pid = 1234;
+        cp.memoryMap.push_back(makeRegion(0x10000, 0x10000 + 4 * PAGE));
+        cp.memoryDumps.push_back(makeDump(cp.memoryMap[0], 0xAA));
+        return cp;
+    }
+
+    RealProcessCheckpoint makeIncremental(const RealProcessCheckpoint& parent, uint64_t id) {
+        RealProcessCheckpoint cp;
+        cp.checkpointId = id;
+        cp.parentCheckpointId = parent.checkpointId;
+        cp.isIncremental = true;
+        cp.info.pid = parent.info.pid;
+        cp.memoryMap = parent.memoryMap;
+        return cp;
+    }
+};
+
+TEST_F(RealProcessCheckpointTest, SerializeRoundTripKeepsChainFields) {
+    auto base = makeBase();
+    auto inc = makeIncremental(base, 200);
+    inc.memoryDumps.push_back(makeDump(makeRegion(0x10000 + PAGE, 0x10000 + 2 * PAGE), 0xBB));
+
+    auto restored = RealProcessCheckpoint::deserialize(inc.serialize());
+
+    EXPECT_EQ(restored.checkpointId, 200u);
+    EXPECT_EQ(restored.parentCheckpointId, 100u);
+    EXPECT_TRUE(restored.isIncremental);
+    ASSERT_EQ(restored.memoryDumps.size(), 1u);
+    EXPECT_EQ(restored.memoryDumps[0].region.startAddr, 0x10000 + PAGE);
+    EXPECT_TRUE(restored.memoryDumps[0].region.writable);
+    EXPECT_EQ(restored.memoryDumps[0].region.pathname, "[heap]");
+    EXPECT_EQ(restored.memoryDumps[0].data, std::vector<uint8_t>(PAGE, 0xBB));
+}
+
+TEST_F(RealProcessCheckpointTest, MergeChainAppliesDirtyPages) {
+    auto base = makeBase();
+    auto inc1 = makeIncremental(base, 200);
+    inc1.memoryDumps.push_back(makeDump(makeRegion(0x10000 + PAGE, 0x10000 + 2 * PAGE), 0xBB));
+    auto inc2 = makeIncremental(inc1, 300);
+    inc2.memoryDumps.push_back(makeDump(makeRegion(0x10000 + PAGE, 0x10000 + 3 * PAGE), 0xCC));
+
+    RealProcessCheckpointer checkpointer;
+    auto merged = checkpointer.mergeCheckpointChain({base, inc1, inc2});
+
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_EQ(merged->checkpointId, 300u);
+    EXPECT_FALSE(merged->isIncremental);
+    EXPECT_EQ(merged->parentCheckpointId, 0u);
+    ASSERT_EQ(merged->memoryDumps.size(), 1u);
+
+    const auto& data = merged->memoryDumps[0].data;
+    ASSERT_EQ(data.size(), 4 * PAGE);
+    EXPECT_EQ(data[0], 0xAA);
+    EXPECT_EQ(data[PAGE], 0xCC);
+    EXPECT_EQ(data[2 * PAGE], 0xCC);
+    EXPECT_EQ(data[3 * PAGE], 0xAA);
+}
+
+TEST_F(RealProcessCheckpointTest, MergeChainKeepsNewRegionsAndDropsUnmapped) {
+    auto base = makeBase();
+    auto inc = makeIncremental(base, 200);
+
+    // Base region unmap edildi, yeni bir region eklendi
+    inc.memoryMap.clear();
+    inc.memoryMap.push_back(makeRegion(0x50000, 0x50000 + PAGE, ""));
+    inc.memoryDumps.push_back(makeDump(inc.memoryMap[0], 0xDD));
+
+    RealProcessCheckpointer checkpointer;
+    auto merged = checkpointer.mergeCheckpointChain({base, inc});
+
+    ASSERT_TRUE(merged.has_value());
+    ASSERT_EQ(merged->memoryDumps.size(), 1u);
+    EXPECT_EQ(merged->memoryDumps[0].region.startAddr, 0x50000u);
+}
+
+TEST_F(RealProcessCheckpointTest, MergeChainRejectsBrokenChain) {
+    auto base = makeBase();
+    auto inc = makeIncremental(base, 200);
+    inc.parentCheckpointId = 999;
+
+    RealProcessCheckpointer checkpointer;
+    EXPECT_FALSE(checkpointer.mergeCheckpointChain({base, inc}).has_value());
+    EXPECT_FALSE(checkpointer.mergeCheckpointChain({inc}).has_value());
+    EXPECT_FALSE(checkpointer.getLastError().empty());
+}
+
+TEST_F(RealProcessCheckpointTest, CompareCheckpointsReportsExactRanges) {
+    // 300 sayfa: ağaç üç seviye; dump sırası iki checkpoint'te farklı
+    auto big = makeRegion(0x100000, 0x100000 + 300 * PAGE, "");
+    auto small = makeRegion(0x10000, 0x10000 + PAGE);
+    RealProcessCheckpoint before;
+    before.memoryDumps.push_back(makeDump(big, 0x11));
+    before.memoryDumps.push_back(makeDump(small, 0x22));
+    before.memoryDumps.push_back(makeDump(makeRegion(0x50000, 0x50000 + PAGE), 0x33));
+
+    RealProcessCheckpoint after;
+    after.memoryDumps.push_back(makeDump(makeRegion(0x70000, 0x70000 + 2 * PAGE), 0x44));
+    after.memoryDumps.push_back(makeDump(small, 0x22));
+    after.memoryDumps.push_back(makeDump(big, 0x11));
+    auto& data = after.memoryDumps[2].data;
+    data[5 * PAGE + 10] = 0;                            // Tek byte
+    std::fill(data.begin() + 200 * PAGE - 3, data.begin() + 200 * PAGE + 5, 0);   // Sayfa sınırı
+
+    for (bool hashed : {false, true}) {
+        if (hashed) {
+            before.computePageHashes();
+            after.computePageHashes();
+            ASSERT_FALSE(after.memoryDumps[2].hashTree.empty());
+        }
+
+        RealProcessCheckpointer checkpointer;
+        auto diff = checkpointer.compareCheckpoints(before, after);
+        EXPECT_TRUE(diff.memoryChanged);
+        ASSERT_EQ(diff.addedRegions.size(), 1u);
+        EXPECT_EQ(diff.addedRegions[0].startAddr, 0x70000u);
+        ASSERT_EQ(diff.removedRegions.size(), 1u);
+        EXPECT_EQ(diff.removedRegions[0].startAddr, 0x50000u);
+        ASSERT_EQ(diff.modifiedRegions.size(), 1u);
+        EXPECT_EQ(diff.modifiedRegions[0].startAddr, big.startAddr);
+
+        ASSERT_EQ(diff.changedRanges.size(), 2u);
+        EXPECT_EQ(diff.changedRanges[0].addr, big.startAddr + 5 * PAGE + 10);
+        EXPECT_EQ(diff.changedRanges[0].length, 1u);
+        EXPECT_EQ(diff.changedRanges[1].addr, big.startAddr + 200 * PAGE - 3);
+        EXPECT_EQ(diff.changedRanges[1].length, 8u);
+        EXPECT_EQ(diff.totalBytesChanged, 9u + 3 * PAGE);
+
+        // Ağaçla sadece hash'i farklı sayfalar okunur
+        if (hashed) {
+            EXPECT_EQ(diff.pagesCompared, 3u);
+        } else {
+            EXPECT_EQ(diff.pagesCompared, 301u);
+        }
+    }
+}
+
+TEST_F(RealProcessCheckpointTest, CompareCheckpointsHandlesResizeAndZeroFill) {
+    auto region = makeRegion(0x10000, 0x10000 + 4 * PAGE);
+    RealProcessCheckpoint before;
+    before.memoryDumps.push_back(makeDump(region, 0));
+    before.memoryDumps[0].data.clear();
+    before.memoryDumps[0].zeroFill = true;
+
+    RealProcessCheckpoint after;
+    auto grown = makeRegion(0x10000, 0x10000 + 6 * PAGE);
+    after.memoryDumps.push_back(makeDump(grown, 0));
+    after.memoryDumps[0].data[3 * PAGE] = 7;
+    after.computePageHashes();
+
+    RealProcessCheckpointer checkpointer;
+    auto diff = checkpointer.compareCheckpoints(before, after);
+    ASSERT_EQ(diff.changedRanges.size(), 2u);
+    EXPECT_EQ(diff.changedRanges[0].addr, 0x10000u + 3 * PAGE);
+    EXPECT_EQ(diff.changedRanges[0].length, 1u);
+    EXPECT_EQ(diff.changedRanges[1].addr, 0x10000u + 4 * PAGE);     // Büyüyen kısım
+    EXPECT_EQ(diff.changedRanges[1].length, 2 * PAGE);
+
+    auto same = checkpointer.compareCheckpoints(after, after);
+    EXPECT_FALSE(same.memoryChanged);
+    EXPECT_EQ(same.pagesCompared, 0u);
+}
+
+TEST_F(RealProcessCheckpointTest, ZeroPageScanFindsLastByte) {
+    std::vector<uint8_t> page(PAGE, 0);
+    EXPECT_TRUE(isZeroPage(page.data(), page.size()));
+    page[PAGE - 1] = 1;
+    EXPECT_FALSE(isZeroPage(page.data(), page.size()));
+    // 64 byte'a bölünmeyen boyutlar da kuyruktan taranır
+    EXPECT_FALSE(isZeroPage(page.data() + PAGE - 13, 13));
+    EXPECT_TRUE(isZeroPage(page.data(), PAGE - 13));
+}
+
+TEST_F(RealProcessCheckpointTest, EliminateZeroPagesSplitsRuns) {
+    auto base = makeBase();
+    auto& data = base.memoryDumps[0].data;
+    std::fill(data.begin() + PAGE, data.begin() + 3 * PAGE, 0);
+
+    EXPECT_EQ(eliminateZeroPages(base.memoryDumps), 2 * PAGE);
+    ASSERT_EQ(base.memoryDumps.size(), 3u);
+    EXPECT_FALSE(base.memoryDumps[0].zeroFill);
+    EXPECT_TRUE(base.memoryDumps[1].zeroFill);
+    EXPECT_TRUE(base.memoryDumps[1].data.empty());
+    EXPECT_EQ(base.memoryDumps[1].region.startAddr, 0x10000 + PAGE);
+    EXPECT_EQ(base.memoryDumps[1].region.endAddr, 0x10000 + 3 * PAGE);
+    EXPECT_EQ(base.memoryDumps[2].data, std::vector<uint8_t>(PAGE, 0xAA));
+
+    auto restored = RealProcessCheckpoint::deserialize(base.serialize());
+    ASSERT_EQ(restored.memoryDumps.size(), 3u);
+    EXPECT_TRUE(restored.memoryDumps[1].zeroFill);
+    EXPECT_TRUE(restored.memoryDumps[1].region.writable);
+    EXPECT_EQ(restored.memoryDumps[1].region.size(), 2 * PAGE);
+    EXPECT_EQ(restored.memoryDumps[2].data, std::vector<uint8_t>(PAGE, 0xAA));
+}
+
+TEST_F(RealProcessCheckpointTest, PageStoreSharesPagesAcrossCheckpoints) {
+    auto first = makeBase();
+    auto second = makeBase();
+    second.checkpointId = 101;
+    second.memoryDumps[0].data[3 * PAGE] = 0x01;   // son sayfa farklı
+    auto original = second.memoryDumps[0].data;
+
+    PageStore store;
+    // İlk checkpoint'in 4 aynı sayfası tek sayfaya iner
+    EXPECT_EQ(deduplicatePages(first, store), 3u);
+    EXPECT_EQ(store.pageCount(), 1u);
+    EXPECT_EQ(deduplicatePages(second, store), 3u);
+    EXPECT_EQ(store.pageCount(), 2u);
+    ASSERT_TRUE(second.memoryDumps[0].isDeduplicated());
+    EXPECT_TRUE(second.memoryDumps[0].data.empty());
+    EXPECT_EQ(second.memoryDumps[0].pageRefs, (std::vector<uint32_t>{0, 0, 0, 1}));
+
+    // pageRefs serialize edilir; store dosyaya yazılıp geri okunabilir
+    auto restored = RealProcessCheckpoint::deserialize(second.serialize());
+    EXPECT_EQ(restored.memoryDumps[0].pageRefs, second.memoryDumps[0].pageRefs);
+
+    std::string path = "/tmp/page_store_test_" + std::to_string(getpid()) + ".rpgs";
+    ASSERT_TRUE(store.save(path)) << store.getLastError();
+    PageStore reloaded;
+    ASSERT_TRUE(reloaded.load(path)) << reloaded.getLastError();
+    EXPECT_EQ(reloaded.pageCount(), 2u);
+    std::remove(path.c_str());
+
+    ASSERT_TRUE(rehydratePages(restored, reloaded));
+    EXPECT_FALSE(restored.memoryDumps[0].isDeduplicated());
+    EXPECT_EQ(restored.memoryDumps[0].data, original);
+
+    // Deduplicated checkpoint'ler ancak rehydrate edildikten sonra birleşir
+    RealProcessCheckpointer checkpointer;
+    EXPECT_FALSE(checkpointer.mergeCheckpointChain({second}).has_value());
+}
+
+TEST_F(RealProcessCheckpointTest, MergeChainAppliesZeroFillRuns) {
+    auto base = makeBase();
+    auto inc = makeIncremental(base, 200);
+    MemoryDump zero;
+    zero.region = makeRegion(0x10000 + PAGE, 0x10000 + 2 * PAGE);
+    zero.zeroFill = true;
+    zero.isValid = true;
+    inc.memoryDumps.push_back(zero);
+
+    RealProcessCheckpointer checkpointer;
+    auto merged = checkpointer.mergeCheckpointChain({base, inc});
+
+    ASSERT_TRUE(merged.has_value());
+    ASSERT_EQ(merged->memoryDumps.size(), 1u);
+    const auto& data = merged->memoryDumps[0].data;
+    EXPECT_EQ(data[0], 0xAA);
+    EXPECT_EQ(data[PAGE], 0x00);
+    EXPECT_EQ(data[2 * PAGE - 1], 0x00);
+    EXPECT_EQ(data[2 * PAGE], 0xAA);
+}
+
+// ============================================================================
+// Batched dump/restore (process_vm_readv/writev) - ptrace gerekir
+// ============================================================================
+
+TEST_F(RealProcessCheckpointTest, RelocatePointersUsesRegionTable) {
+    std::vector<MemoryRegion> map = {
+        makeRegion(0x400000, 0x401000, "/usr/bin/app"),     // CODE
+        makeRegion(0x600000, 0x601000, "[heap]"),
+        makeRegion(0x700000, 0x701000, ""),                 // MMAP: conservative'de atlanır
+    };
+    map[0].executable = true;
+    ASLRHandler::AddressOffset offsets{};
+    offsets.codeOffset = 0x10000;
+    offsets.heapOffset = 0x20000;
+    offsets.mmapOffset = 0x30000;
+
+    // İlk ve son word'ler SIMD blokları dışında kalsın diye 37 word
+    std::vector<uint64_t> words(37, 0x12345);
+    words[0] = 0x400010;            // code
+    words[5] = 0x500000;            // bölgeler arası boşluk: sayılmaz
+    words[9] = 0x600ff8;            // heap
+    words[17] = 0x700100;           // mmap
+    words[36] = 0x600000;           // heap, skaler kuyruk
+    MemoryDump dump = makeDump(makeRegion(0x800000, 0x800000 + words.size() * 8), 0);
+    std::memcpy(dump.data.data(), words.data(), dump.data.size());
+
+    ASLRHandler handler;
+    auto result = handler.relocatePointers(dump, map, offsets);
+    EXPECT_EQ(result.pointersFound, 4u);
+    EXPECT_EQ(result.pointersRelocated, 3u);
+    ASSERT_EQ(result.relocatedAddresses.size(), 3u);
+    EXPECT_EQ(result.relocatedAddresses[1], 0x800000u + 9 * 8);
+
+    std::vector<uint64_t> after(words.size());
+    std::memcpy(after.data(), dump.data.data(), dump.data.size());
+    EXPECT_EQ(after[0], 0x410010u);
+    EXPECT_EQ(after[5], 0x500000u);
+    EXPECT_EQ(after[9], 0x620ff8u);
+    EXPECT_EQ(after[17], 0x700100u);
+    EXPECT_EQ(after[36], 0x620000u);
+
+    // Çok dump'lı paralel tarama tek tek taramayla aynı
+    std::vector<MemoryDump> dumps;
+    for (int i = 0; i < 8; ++i) {
+        MemoryDump copy = makeDump(makeRegion(0x900000 + i * 0x1000, 0x900000 + i * 0x1000 + words.size() * 8), 0);
+        std::memcpy(copy.data.data(), words.data(), copy.data.size());
+        dumps.push_back(std::move(copy));
+    }
+    auto all = handler.relocatePointers(dumps, map, offsets, false, 4);
+    EXPECT_EQ(all.pointersFound, 8 * 4u);
+    EXPECT_EQ(all.pointersRelocated, 8 * 4u);      // conservative değil: mmap da
+    EXPECT_EQ(all.relocatedAddresses.front(), 0x900000u);
+    EXPECT_EQ(all.relocatedAddresses.back(), 0x907000u + 36 * 8);
+}
+
+TEST_F(RealProcessCheckpointTest, MapsLineParserHandlesAllFields) {
+    const char line[] = "7f0012340000-7f0012345000 r-xs 0001a000 fe:01 123456      /usr/lib/lib foo.so";
+    MemoryRegion region{};
+    ASSERT_TRUE(ProcFSReader::parseMapsLine(line, line + sizeof(line) - 1, region));
+    EXPECT_EQ(region.startAddr, 0x7f0012340000u);
+    EXPECT_EQ(region.endAddr, 0x7f0012345000u);
+    EXPECT_TRUE(region.readable);
+    EXPECT_FALSE(region.writable);
+    EXPECT_TRUE(region.executable);
+    EXPECT_FALSE(region.isPrivate);
+    EXPECT_EQ(region.offset, 0x1a000u);
+    EXPECT_EQ(region.device, "fe:01");
+    EXPECT_EQ(region.inode, 123456u);
+    EXPECT_EQ(region.pathname, "/usr/lib/lib foo.so");
+
+    const char anon[] = "00400000-00401000 rw-p 00000000 00:00 0 ";
+    ASSERT_TRUE(ProcFSReader::parseMapsLine(anon, anon + sizeof(anon) - 1, region));
+    EXPECT_TRUE(region.pathname.empty());
+    EXPECT_TRUE(region.isPrivate);
+
+    const char bad[] = "not a maps line";
+    EXPECT_FALSE(ProcFSReader::parseMapsLine(bad, bad + sizeof(bad) - 1, region));
+}
+
+TEST_F(RealProcessCheckpointTest, MapQueryMatchesTextMaps) {
+    ProcFSReader reader;
+    std::vector<MemoryRegion> text, query;
+    ASSERT_TRUE(reader.readMemoryMapsText(getpid(), text));
+    ASSERT_FALSE(text.empty());
+    if (!reader.queryMemoryMaps(getpid(), query)) {
+        GTEST_SKIP() << "PROCMAP_QUERY not supported by this kernel";
+    }
+    // Okumalar arasında heap büyümesin: kapasiteyi önceden ayır ve tekrar oku
+    text.reserve(text.size() * 4);
+    query.reserve(text.size());
+    ASSERT_TRUE(reader.queryMemoryMaps(getpid(), query));
+    ASSERT_TRUE(reader.readMemoryMapsText(getpid(), text));
+    ASSERT_EQ(query.size(), text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        EXPECT_EQ(query[i].startAddr, text[i].startAddr) << i;
+        EXPECT_EQ(query[i].endAddr, text[i].endAddr) << i;
+        EXPECT_EQ(query[i].readable, text[i].readable) << i;
+        EXPECT_EQ(query[i].writable, text[i].writable) << i;
+        EXPECT_EQ(query[i].executable, text[i].executable) << i;
+        EXPECT_EQ(query[i].isPrivate, text[i].isPrivate) << i;
+        EXPECT_EQ(query[i].offset, text[i].offset) << i;
+        EXPECT_EQ(query[i].device, text[i].device) << i;
+        EXPECT_EQ(query[i].inode, text[i].inode) << i;
+        EXPECT_EQ(query[i].pathname, text[i].pathname) << i;
+    }
+}
+
+TEST_F(RealProcessCheckpointTest, MapsCacheSharesSnapshotUntilInvalidated) {
+    ProcFSReader reader;
+    reader.setMapsCacheTtl(std::chrono::seconds(60));
+
+    auto first = reader.getMemoryMapsSnapshot(getpid());
+    ASSERT_FALSE(first->empty());
+    auto heap = reader.getHeapRegions(getpid());
+    auto writable = reader.getWritableRegions(getpid());
+    EXPECT_EQ(reader.getMemoryMapsSnapshot(getpid()), first);
+    EXPECT_FALSE(writable.empty());
+
+    auto stats = reader.getMapsCacheStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 3u);
+
+    // Yeni eşleme cache'te görünmez, invalidate sonrası görünür
+    void* page = mmap(nullptr, PAGE, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(page, MAP_FAILED);
+    auto covers = [page](const std::vector<MemoryRegion>& maps) {
+        uint64_t addr = reinterpret_cast<uint64_t>(page);
+        return std::any_of(maps.begin(), maps.end(), [addr](const MemoryRegion& r) {
+            return addr >= r.startAddr && addr < r.endAddr;
+        });
+    };
+    EXPECT_FALSE(covers(*reader.getMemoryMapsSnapshot(getpid())));
+    reader.invalidateMemoryMaps(getpid());
+    auto fresh = reader.getMemoryMapsSnapshot(getpid());
+    EXPECT_NE(fresh, first);
+    EXPECT_TRUE(covers(*fresh));
+    munmap(page, PAGE);
+
+    // TTL 0: her çağrı yeniden okur
+    reader.setMapsCacheTtl(std::chrono::milliseconds(0));
+    EXPECT_NE(reader.getMemoryMapsSnapshot(getpid()), reader.getMemoryMapsSnapshot(getpid()));
+}
+
+// THP kapalıysa (never) huge page testleri atlanır
+bool transparentHugePagesEnabled() {
+    std::ifstream in("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string mode((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return !mode.empty() && mode.find("[never]") == std::string::npos;
+}
+
+// 2MB hizalı, henüz dokunulmamış anonim eşleme (munmap: base, 3 * HUGE)
+uint8_t* mapHugeAligned(void*& base) {
+    const uint64_t huge = PtraceController::HUGE_PAGE_SIZE;
+    base = mmap(nullptr, 3 * huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return nullptr;
+    uint64_t addr = (reinterpret_cast<uint64_t>(base) + huge - 1) & ~(huge - 1);
+    return reinterpret_cast<uint8_t*>(addr);
+}
+
+TEST_F(RealProcessCheckpointTest, SmapsReportsTransparentHugePages) {
+    if (!transparentHugePagesEnabled()) {
+        GTEST_SKIP() << "transparent huge pages disabled";
+    }
+    const uint64_t huge = PtraceController::HUGE_PAGE_SIZE;
+    void* base = nullptr;
+    uint8_t* area = mapHugeAligned(base);
+    ASSERT_NE(area, nullptr);
+    ASSERT_EQ(madvise(area, 2 * huge, MADV_HUGEPAGE), 0);
+    std::memset(area, 0x42, 2 * huge);
+
+    ProcFSReader reader;
+    std::vector<MemoryRegion> smaps, maps;
+    ASSERT_TRUE(reader.readSmaps(getpid(), smaps));
+    ASSERT_TRUE(reader.readMemoryMapsText(getpid(), maps));
+    munmap(base, 3 * huge);
+
+    uint64_t addr = reinterpret_cast<uint64_t>(area);
+    auto covers = [addr](const MemoryRegion& r) { return addr >= r.startAddr && addr < r.endAddr; };
+    auto it = std::find_if(smaps.begin(), smaps.end(), covers);
+    ASSERT_NE(it, smaps.end());
+    EXPECT_TRUE(it->thpEligible);
+    EXPECT_EQ(it->kernelPageSize, PAGE);
+    if (it->anonHugeBytes == 0) {
+        GTEST_SKIP() << "kernel could not allocate a huge page";
+    }
+    EXPECT_TRUE(it->hugePages);
+
+    // maps'e kopyalanır ve serialize'dan geçer
+    ProcFSReader::copyPageSizes(smaps, maps);
+    auto mapped = std::find_if(maps.begin(), maps.end(), covers);
+    ASSERT_NE(mapped, maps.end());
+    EXPECT_EQ(mapped->anonHugeBytes, it->anonHugeBytes);
+
+    RealProcessCheckpoint checkpoint;
+    checkpoint.memoryMap.push_back(*mapped);
+    checkpoint.memoryDumps.push_back(makeDump(*mapped, 0x42));
+    auto restored = RealProcessCheckpoint::deserialize(checkpoint.serialize());
+    ASSERT_EQ(restored.memoryDumps.size(), 1u);
+    EXPECT_TRUE(restored.memoryDumps[0].region.hugePages);
+    EXPECT_TRUE(restored.memoryMap[0].hugePages);
+}
+
+class BatchedMemoryTest : public ::testing::Test {
+protected:
+    pid_t child = -1;
+    uint8_t* mapping = nullptr;
+    size_t page = 0;
+
+    void SetUp() override {
+        page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        void* p = mmap(nullptr, 3 * page, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(p, MAP_FAILED);
+        mapping = static_cast<uint8_t*>(p);
+        std::memset(mapping, 0x11, page);
+        std::memset(mapping + 2 * page, 0x33, page);
+        mprotect(mapping + page, page, PROT_NONE);  // guard page
+
+        child = fork();
+        if (child == 0) {
+            while (true) pause();
+        }
+    }
+
+    void TearDown() override {
+        if (child > 0) {
+            kill(child, SIGKILL);
+            waitpid(child, nullptr, 0);
+        }
+        if (mapping) munmap(mapping, 3 * page);
+    }
+
+    // Çocuğa enjekte edilen madvise(MADV_DONTNEED): sayfa soft-dirty'siz boşalır
+    bool discardInChild(const uint8_t* addr) {
+        PtraceController ptrace;
+        if (ptrace.attach(child) != PtraceError::SUCCESS) return false;
+        MemoryManager memory;
+        memory.bindProcess(child);
+        int64_t ret = memory.injectSyscall(SYS_madvise, reinterpret_cast<uint64_t>(addr),
+                                           page, MADV_DONTNEED);
+        memory.unbindProcess();
+        ptrace.detach();
+        return ret == 0;
+    }
+
+    MemoryRegion wholeMapping() const {
+        MemoryRegion region{};
+        region.startAddr = reinterpret_cast<uint64_t>(mapping);
+        region.endAddr = region.startAddr + 3 * page;
+        region.readable = true;
+        region.writable = true;
+        region.isPrivate = true;
+        return region;
+    }
+};
+
+TEST_F(BatchedMemoryTest, DumpSkipsUnreadablePages) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+
+    ASSERT_EQ(dumps.size(), 2u);
+    EXPECT_EQ(dumps[0].region.startAddr, reinterpret_cast<uint64_t>(mapping));
+    EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x11));
+    EXPECT_EQ(dumps[1].region.startAddr, reinterpret_cast<uint64_t>(mapping + 2 * page));
+    EXPECT_EQ(dumps[1].data, std::vector<uint8_t>(page, 0x33));
+}
+
+TEST_F(BatchedMemoryTest, RestoreWritesAllDumps) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    for (auto& dump : dumps) {
+        std::fill(dump.data.begin(), dump.data.end(), 0x77);
+    }
+
+    std::vector<PtraceError> errors;
+    EXPECT_EQ(ptrace.restoreMemoryRegions(dumps, &errors), PtraceError::SUCCESS);
+
+    auto reread = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(reread.size(), 2u);
+    EXPECT_EQ(reread[0].data, std::vector<uint8_t>(page, 0x77));
+    EXPECT_EQ(reread[1].data, std::vector<uint8_t>(page, 0x77));
+}
+
+TEST_F(BatchedMemoryTest, ParallelDumpMatchesSerial) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+
+    // Tek sayfalık chunk'lar: her sayfa ayrı segment, 4 worker
+    auto serial = ptrace.dumpMemoryRegions({wholeMapping()});
+    auto parallel = ptrace.dumpMemoryRegions({wholeMapping()}, 4, page);
+
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(parallel[i].region.startAddr, serial[i].region.startAddr);
+        EXPECT_EQ(parallel[i].data, serial[i].data);
+    }
+}
+
+TEST_F(BatchedMemoryTest, ForkSnapshotDumpsChildCopy) {
+    CheckpointOptions options;
+    options.forkSnapshot = true;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.createCheckpoint(child, "fork_snapshot", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    uint64_t first = reinterpret_cast<uint64_t>(mapping);
+    bool found = false;
+    for (const auto& dump : checkpoint->memoryDumps) {
+        if (dump.region.startAddr == first) {
+            found = true;
+            EXPECT_EQ(dump.data, std::vector<uint8_t>(page, 0x11));
+        }
+    }
+    EXPECT_TRUE(found);
+    EXPECT_TRUE(checkpointer.getLastError().empty()) << checkpointer.getLastError();
+
+    // Target devam ediyor olmalı ve snapshot child'ı kalmamalı
+    EXPECT_EQ(kill(child, 0), 0);
+    ProcFSReader reader;
+    auto info = reader.getProcessInfo(child);
+    ASSERT_TRUE(info.has_value());
+    EXPECT_NE(info->state, LinuxProcessState::STOPPED);
+}
+
+// ============================================================================
+// Checkpoint Stream Tests
+// ============================================================================
+
+TEST_F(RealProcessCheckpointTest, StreamWriterOutputMatchesDeserialize) {
+    std::string path = "/tmp/checkpoint_stream_test_" + std::to_string(getpid()) + ".rchk";
+    auto cp = makeBase();
+    cp.memoryDumps.push_back(makeDump(makeRegion(0x80000, 0x80000 + 2 * PAGE, "[stack]"), 0x42));
+    cp.signals.blocked = 0x1234;
+
+    RealProcessCheckpointer checkpointer;
+    ASSERT_TRUE(checkpointer.saveCheckpoint(cp, path)) << checkpointer.getLastError();
+
+    // Dosya stream formatında; hem reader hem deserialize okuyabilmeli
+    auto loaded = checkpointer.loadCheckpoint(path);
+    ASSERT_TRUE(loaded.has_value()) << checkpointer.getLastError();
+    ASSERT_EQ(loaded->memoryDumps.size(), 2u);
+    EXPECT_EQ(loaded->memoryDumps[1].data, std::vector<uint8_t>(2 * PAGE, 0x42));
+    EXPECT_EQ(loaded->signals.blocked, 0x1234u);
+
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> raw((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+    auto viaDeserialize = RealProcessCheckpoint::deserialize(raw);
+    ASSERT_EQ(viaDeserialize.memoryDumps.size(), 2u);
+    EXPECT_EQ(viaDeserialize.signals.blocked, 0x1234u);
+
+    // Yazarken biriken checksum dosyanın tamamını kapsar
+    CheckpointStreamWriter writer;
+    ASSERT_TRUE(writer.open(path));
+    ASSERT_TRUE(writer.writeHeader(cp));
+    for (const auto& dump : cp.memoryDumps) ASSERT_TRUE(writer.writeDump(dump));
+    ASSERT_TRUE(writer.finish(cp.signals));
+    EXPECT_EQ(writer.checksum(), checkpoint::crc32c(raw.data(), raw.size()));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(RealProcessCheckpointTest, SaveLoadThroughIoEngine) {
+    std::string path = "/tmp/checkpoint_io_engine_" + std::to_string(getpid()) + ".rchk";
+    auto cp = makeBase();
+    cp.memoryDumps.push_back(makeDump(makeRegion(0x100000, 0x100000 + 256 * PAGE), 0x5A));
+    cp.memoryDumps.push_back(makeDump(makeRegion(0x80000, 0x80000 + 3 * PAGE, "[stack]"), 0x42));
+
+    checkpoint::IoEngineOptions io;
+    io.bufferSize = 64 * 1024;      // payload'lar birden fazla parçaya bölünsün
+    io.buffers = 2;
+    io.queueDepth = 4;
+
+    for (auto format : {CheckpointFileFormat::STREAM, CheckpointFileFormat::INDEXED}) {
+        for (bool useIoUring : {true, false}) {
+            io.useIoUring = useIoUring;
+            RealProcessCheckpointer checkpointer;
+            checkpointer.setIoOptions(io);
+            ASSERT_TRUE(checkpointer.saveCheckpoint(cp, path, format)) << checkpointer.getLastError();
+
+            auto loaded = checkpointer.loadCheckpoint(path);
+            ASSERT_TRUE(loaded.has_value()) << checkpointer.getLastError();
+            ASSERT_EQ(loaded->memoryDumps.size(), 3u);
+            for (size_t i = 0; i < 3; ++i) {
+                EXPECT_EQ(loaded->memoryDumps[i].data, cp.memoryDumps[i].data);
+            }
+        }
+    }
+
+    // Engine ile yazılan stream, doğrudan fd'ye yazılanla byte byte aynı
+    {
+        CheckpointStreamWriter plain;
+        ASSERT_TRUE(plain.open(path));
+        ASSERT_TRUE(plain.writeHeader(cp));
+        for (const auto& dump : cp.memoryDumps) ASSERT_TRUE(plain.writeDump(dump));
+        ASSERT_TRUE(plain.finish(cp.signals));
+    }
+    std::ifstream plainFile(path, std::ios::binary);
+    std::vector<uint8_t> raw((std::istreambuf_iterator<char>(plainFile)),
+                             std::istreambuf_iterator<char>());
+    CheckpointStreamWriter writer;
+    ASSERT_TRUE(writer.open(path, io));
+    ASSERT_TRUE(writer.writeHeader(cp));
+    for (const auto& dump : cp.memoryDumps) ASSERT_TRUE(writer.writeDump(dump));
+    ASSERT_TRUE(writer.finish(cp.signals));
+    EXPECT_EQ(writer.checksum(), checkpoint::crc32c(raw.data(), raw.size()));
+    EXPECT_EQ(std::filesystem::file_size(path), raw.size());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(RealProcessCheckpointTest, StreamReaderSkipsPayloads) {
+    auto cp = makeBase();
+    cp.memoryDumps.push_back(makeDump(makeRegion(0x80000, 0x80000 + PAGE), 0x42));
+    auto data = cp.serialize();
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    close(fds[1]);
+
+    // Pipe seekable değil: atlama okuyup atarak yapılmalı
+    CheckpointStreamReader reader(fds[0]);
+    auto header = reader.readHeader();
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->memoryMap.size(), 1u);
+
+    MemoryDump dump;
+    ASSERT_TRUE(reader.nextDump(dump, false));
+    EXPECT_TRUE(dump.data.empty());
+    ASSERT_TRUE(reader.nextDump(dump));
+    EXPECT_EQ(dump.data, std::vector<uint8_t>(PAGE, 0x42));
+    EXPECT_FALSE(reader.nextDump(dump));
+    EXPECT_TRUE(reader.finished());
+    close(fds[0]);
+}
+
+TEST_F(BatchedMemoryTest, CreateCheckpointToFileStreamsDumps) {
+    std::string path = "/tmp/checkpoint_stream_live_" + std::to_string(getpid()) + ".rchk";
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto meta = checkpointer.createCheckpointToFile(child, path, "streamed", options);
+    if (!meta) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+    EXPECT_TRUE(meta->memoryDumps.empty());
+
+    auto loaded = checkpointer.loadCheckpoint(path);
+    ASSERT_TRUE(loaded.has_value()) << checkpointer.getLastError();
+    EXPECT_EQ(loaded->name, "streamed");
+
+    bool found = false;
+    for (const auto& dump : loaded->memoryDumps) {
+        if (dump.region.startAddr == reinterpret_cast<uint64_t>(mapping)) {
+            found = true;
+            EXPECT_EQ(dump.data, std::vector<uint8_t>(page, 0x11));
+        }
+    }
+    EXPECT_TRUE(found);
+    std::remove(path.c_str());
+}
+
+TEST(DumpBufferPoolTest, ReusesRecycledBuffersWithinLimit) {
+    DumpBufferPool pool(64 * 1024);
+
+    auto first = pool.acquire(4096);
+    ASSERT_EQ(first.size(), 4096u);
+    const uint8_t* storage = first.data();
+    first[0] = 0xAB;
+    pool.recycle(std::move(first));
+
+    // Aynı boyut: aynı tampon, içerik sıfırlanmadan
+    auto second = pool.acquire(4096);
+    EXPECT_EQ(second.data(), storage);
+    EXPECT_EQ(second[0], 0xAB);
+
+    // Sınırı aşan tampon saklanmaz
+    pool.recycle(std::vector<uint8_t>(128 * 1024));
+    pool.recycle(std::move(second));
+
+    auto stats = pool.getStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.recycled, 2u);
+    EXPECT_EQ(stats.dropped, 1u);
+    EXPECT_EQ(stats.retainedBytes, 4096u);
+
+    pool.trim();
+    EXPECT_EQ(pool.getStats().retainedBytes, 0u);
+}
+
+TEST_F(BatchedMemoryTest, RepeatedDumpsReuseBufferPool) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+    auto pool = std::make_shared<DumpBufferPool>();
+    ptrace.setBufferPool(pool);
+
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    for (auto& dump : dumps) pool->recycle(dump);
+    uint64_t missesAfterFirst = pool->getStats().misses;
+
+    auto again = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(again.size(), 2u);
+    EXPECT_EQ(again[0].data, std::vector<uint8_t>(page, 0x11));
+    EXPECT_EQ(again[1].data, std::vector<uint8_t>(page, 0x33));
+    EXPECT_EQ(pool->getStats().misses, missesAfterFirst);
+}
+
+TEST_F(BatchedMemoryTest, CheckpointTraceRecordsStagesAndIo) {
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    checkpoint::MetricsRegistry metrics;
+    RealProcessCheckpointer checkpointer;
+    checkpointer.setMetricsRegistry(metrics);
+    auto checkpoint = checkpointer.createCheckpoint(child, "traced", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    auto trace = metrics.getLastTrace("checkpoint.create");
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_TRUE(trace->success);
+    EXPECT_GT(trace->stageNanos("dump"), 0u);
+    EXPECT_GT(trace->stageNanos("attach"), 0u);
+    EXPECT_EQ(trace->counter("regions_dumped"), checkpoint->memoryDumps.size());
+    EXPECT_GT(trace->counter("read_syscalls"), 0u);
+    EXPECT_GE(trace->counter("read_bytes"), 2 * page);
+
+    uint64_t stageSum = 0;
+    for (const auto& [stage, nanos] : trace->stages) stageSum += nanos;
+    EXPECT_LE(stageSum, trace->totalNanos);
+}
+
+TEST_F(BatchedMemoryTest, LiveMigrationPreCopiesAndRestoresIntoTarget) {
+    // Hazırlanmış target: aynı adres düzenine sahip ikinci çocuk
+    pid_t target = fork();
+    if (target == 0) {
+        while (true) pause();
+    }
+    ASSERT_GT(target, 0);
+
+    {
+        PtraceController ptrace;
+        if (ptrace.attach(child) != PtraceError::SUCCESS) {
+            kill(target, SIGKILL);
+            waitpid(target, nullptr, 0);
+            GTEST_SKIP() << "ptrace not permitted in this environment";
+        }
+        std::vector<uint8_t> state(page, 0x55);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), state.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+
+    MigrationReceiver receiver;
+    ASSERT_TRUE(receiver.listen(0, "127.0.0.1")) << receiver.getLastError();
+    bool received = false;
+    std::thread receiving([&]() { received = receiver.accept(target); });
+
+    MigrationOptions options;
+    options.chunkSize = 4096;               // Çok parça: sıkıştırma hattından geçsin
+    MigrationSender sender(options);
+    auto result = sender.migrate(child, "127.0.0.1", receiver.boundPort());
+    receiving.join();
+
+    EXPECT_TRUE(result.success) << result.errorMessage;
+    EXPECT_TRUE(received) << receiver.getLastError();
+    ASSERT_GE(result.rounds.size(), 2u);
+    EXPECT_FALSE(result.rounds.front().final);
+    EXPECT_TRUE(result.rounds.back().final);
+    EXPECT_EQ(receiver.roundsReceived(), result.rounds.size());
+    // Durmuş kaynakta son tur sadece pre-copy'den sonra kirlenenleri taşır
+    // (soft-dirty yoksa her tur tam bölgeleri alır)
+    if (ProcFSReader::softDirtySupported()) {
+        EXPECT_LT(result.rounds.back().dirtyBytes, result.rounds.front().dirtyBytes);
+    }
+    EXPECT_LT(result.totalWireBytes(), result.rounds.front().rawBytes + result.rounds.back().rawBytes);
+    EXPECT_GT(result.downtimeNanos, 0u);
+
+    // Kaynak durmuş bekler, target kaynağın belleğiyle devam eder
+    ProcFSReader reader;
+    auto sourceInfo = reader.getProcessInfo(child);
+    ASSERT_TRUE(sourceInfo.has_value());
+    EXPECT_EQ(sourceInfo->state, LinuxProcessState::STOPPED);
+
+    PtraceController check;
+    ASSERT_EQ(check.attach(target), PtraceError::SUCCESS);
+    std::vector<uint8_t> first(page), third(page);
+    ASSERT_EQ(check.readMemory(reinterpret_cast<uint64_t>(mapping), first.data(), page),
+              PtraceError::SUCCESS);
+    ASSERT_EQ(check.readMemory(reinterpret_cast<uint64_t>(mapping) + 2 * page, third.data(), page),
+              PtraceError::SUCCESS);
+    check.detach();
+    EXPECT_EQ(first, std::vector<uint8_t>(page, 0x55));
+    EXPECT_EQ(third, std::vector<uint8_t>(page, 0x33));
+
+    kill(target, SIGKILL);
+    waitpid(target, nullptr, 0);
+    kill(child, SIGCONT);
+}
+
+TEST_F(BatchedMemoryTest, LiveMigrationCarriesPagesDiscardedBetweenRounds) {
+    pid_t target = fork();
+    if (target == 0) {
+        while (true) pause();
+    }
+    ASSERT_GT(target, 0);
+
+    {
+        PtraceController ptrace;
+        if (ptrace.attach(child) != PtraceError::SUCCESS) {
+            kill(target, SIGKILL);
+            waitpid(target, nullptr, 0);
+            GTEST_SKIP() << "ptrace not permitted in this environment";
+        }
+    }
+
+    MigrationReceiver receiver;
+    ASSERT_TRUE(receiver.listen(0, "127.0.0.1")) << receiver.getLastError();
+    bool received = false;
+    std::thread receiving([&]() { received = receiver.accept(target); });
+
+    // İlk pre-copy snapshot'ı alındıktan sonra kaynak sayfayı boşaltır;
+    // sonraki turlar bunu soft-dirty olmadan da taşımalı
+    MigrationSender sender;
+    bool discarded = false;
+    sender.checkpointer().setProgressCallback([&](const std::string& stage, double) {
+        if (!discarded && stage == "Target resumed, dumping snapshot") {
+            discarded = discardInChild(mapping + 2 * page);
+        }
+    });
+    auto result = sender.migrate(child, "127.0.0.1", receiver.boundPort());
+    receiving.join();
+
+    EXPECT_TRUE(result.success) << result.errorMessage;
+    EXPECT_TRUE(received) << receiver.getLastError();
+    ASSERT_TRUE(discarded);
+
+    PtraceController check;
+    ASSERT_EQ(check.attach(target), PtraceError::SUCCESS);
+    std::vector<uint8_t> first(page), third(page);
+    ASSERT_EQ(check.readMemory(reinterpret_cast<uint64_t>(mapping), first.data(), page),
+              PtraceError::SUCCESS);
+    ASSERT_EQ(check.readMemory(reinterpret_cast<uint64_t>(mapping) + 2 * page, third.data(), page),
+              PtraceError::SUCCESS);
+    check.detach();
+    EXPECT_EQ(first, std::vector<uint8_t>(page, 0x11));
+    EXPECT_EQ(third, std::vector<uint8_t>(page, 0x00));
+
+    kill(target, SIGKILL);
+    waitpid(target, nullptr, 0);
+    kill(child, SIGCONT);
+}
+
+TEST_F(BatchedMemoryTest, LiveMigrationResumesSourceWhenRestoreFails) {
+    {
+        PtraceController ptrace;
+        if (ptrace.attach(child) != PtraceError::SUCCESS) {
+            GTEST_SKIP() << "ptrace not permitted in this environment";
+        }
+    }
+
+    MigrationReceiver receiver;
+    ASSERT_TRUE(receiver.listen(0, "127.0.0.1")) << receiver.getLastError();
+    std::thread receiving([&]() { receiver.accept(999999); });     // Olmayan target
+
+    MigrationSender sender;
+    auto result = sender.migrate(child, "127.0.0.1", receiver.boundPort());
+    receiving.join();
+
+    EXPECT_FALSE(result.success);
+    EXPECT_NE(result.errorMessage.find("rejected"), std::string::npos) << result.errorMessage;
+    EXPECT_FALSE(receiver.getLastError().empty());
+
+    // Kaynak SIGCONT ile devam etmiş olmalı
+    ProcFSReader reader;
+    std::optional<RealProcessInfo> info;
+    for (int i = 0; i < 100; ++i) {
+        info = reader.getProcessInfo(child);
+        if (info && info->state != LinuxProcessState::STOPPED) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(info.has_value());
+    EXPECT_NE(info->state, LinuxProcessState::STOPPED);
+}
+
+namespace {
+
+std::vector<uint8_t> migrationFrame(LiveMigrationProtocol::FrameType type, uint32_t round,
+                                    const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> frame;
+    checkpoint::BinaryWriter writer(frame);
+    writer.writeU8(static_cast<uint8_t>(type));
+    writer.write(round);
+    writer.write(static_cast<uint32_t>(payload.size()));
+    writer.writeBytes(payload.data(), payload.size());
+    return frame;
+}
+
+std::vector<uint8_t> migrationHello(uint32_t chunkSize) {
+    std::vector<uint8_t> payload;
+    checkpoint::BinaryWriter writer(payload);
+    writer.write(LiveMigrationProtocol::VERSION);
+    writer.write(static_cast<int32_t>(1));
+    writer.writeString("peer");
+    writer.write(chunkSize);
+    return migrationFrame(LiveMigrationProtocol::FrameType::Hello, 0, payload);
+}
+
+// Ham (CodecType::None) DATA frame'i; rawSize gövde boyundan bağımsız
+std::vector<uint8_t> migrationData(uint32_t rawSize, size_t bodySize) {
+    std::vector<uint8_t> payload(LiveMigrationProtocol::DATA_HEADER_SIZE + bodySize, 0x11);
+    checkpoint::BinaryWriter writer{std::span<uint8_t>(payload)};
+    writer.writeU8(static_cast<uint8_t>(checkpoint::CodecType::None));
+    writer.write(rawSize);
+    return migrationFrame(LiveMigrationProtocol::FrameType::Data, 0, payload);
+}
+
+} // namespace
+
+TEST(MigrationReceiverTest, RejectsDataFrameLargerThanChunkSize) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+
+    // 16 byte'lık gövde 4 GiB'a açılacağını iddia ediyor
+    auto bytes = migrationHello(4096);
+    auto frame = migrationData(0xFFFFFFF0u, 16);
+    bytes.insert(bytes.end(), frame.begin(), frame.end());
+    ASSERT_EQ(write(fds[1], bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+
+    MigrationReceiver receiver;
+    EXPECT_FALSE(receiver.receive(fds[0]));
+    EXPECT_NE(receiver.getLastError().find("Malformed data frame"), std::string::npos)
+        << receiver.getLastError();
+    EXPECT_EQ(receiver.roundsReceived(), 0u);
+
+    // Sender'a ret onayı gider
+    uint8_t header[LiveMigrationProtocol::FRAME_HEADER_SIZE];
+    ASSERT_EQ(read(fds[1], header, sizeof(header)), static_cast<ssize_t>(sizeof(header)));
+    EXPECT_EQ(header[0], static_cast<uint8_t>(LiveMigrationProtocol::FrameType::Ack));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MigrationReceiverTest, CapsRoundSizeAndTimesOutOnStalledPeer) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+
+    auto bytes = migrationHello(4096);
+    for (int i = 0; i < 2; ++i) {
+        auto frame = migrationData(4096, 4096);
+        bytes.insert(bytes.end(), frame.begin(), frame.end());
+    }
+    ASSERT_EQ(write(fds[1], bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+
+    MigrationReceiver receiver;
+    receiver.setMaxRoundBytes(6000);
+    EXPECT_FALSE(receiver.receive(fds[0]));
+    EXPECT_NE(receiver.getLastError().find("exceeds 6000 bytes"), std::string::npos)
+        << receiver.getLastError();
+    close(fds[0]);
+    close(fds[1]);
+
+    // HELLO'dan sonra susan peer
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+    bytes = migrationHello(4096);
+    ASSERT_EQ(write(fds[1], bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+    MigrationReceiver stalled;
+    stalled.setReadTimeout(100);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(stalled.receive(fds[0]));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    EXPECT_NE(stalled.getLastError().find("Timed out"), std::string::npos) << stalled.getLastError();
+    close(fds[0]);
+    close(fds[1]);
+}
+
+// ============================================================================
+// Indexed Image Tests
+// ============================================================================
+
+TEST_F(RealProcessCheckpointTest, IndexedImageMapsAlignedPayloads) {
+    std::string path = "/tmp/checkpoint_image_test_" + std::to_string(getpid()) + ".rchk";
+    auto cp = makeBase();
+    cp.memoryMap.push_back(makeRegion(0x80000, 0x80000 + 2 * PAGE, "[stack]"));
+    cp.memoryDumps.push_back(makeDump(cp.memoryMap[1], 0x42));
+    cp.signals.blocked = 0x1234;
+
+    RealProcessCheckpointer checkpointer;
+    ASSERT_TRUE(checkpointer.saveCheckpoint(cp, path, CheckpointFileFormat::INDEXED))
+        << checkpointer.getLastError();
+    EXPECT_TRUE(MappedCheckpointImage::isIndexedImage(path));
+
+    MappedCheckpointImage image;
+    ASSERT_TRUE(image.open(path)) << image.getLastError();
+    EXPECT_EQ(image.metadata().checkpointId, 100u);
+    EXPECT_EQ(image.metadata().signals.blocked, 0x1234u);
+    EXPECT_TRUE(image.metadata().memoryDumps.empty());
+    ASSERT_EQ(image.dumpCount(), 2u);
+
+    auto data = image.dumpData(1);
+    ASSERT_EQ(data.size(), 2 * PAGE);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data.data()) % CheckpointImageWriter::PAYLOAD_ALIGNMENT, 0u);
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](uint8_t b) { return b == 0x42; }));
+    EXPECT_EQ(image.dumpRegion(1).pathname, "[stack]");
+    EXPECT_TRUE(image.verifyDump(0));
+    EXPECT_EQ(image.dumpChecksum(1), checkpoint::crc32c(data.data(), data.size()));
+
+    EXPECT_EQ(image.findDump(0x10000 + PAGE), std::optional<size_t>(0));
+    EXPECT_EQ(image.findDump(0x80000), std::optional<size_t>(1));
+    EXPECT_FALSE(image.findDump(0x10000 + 4 * PAGE).has_value());
+    EXPECT_FALSE(image.findDump(0x100).has_value());
+
+    // loadCheckpoint indeksli imajı tanır ve tam checkpoint döner
+    auto loaded = checkpointer.loadCheckpoint(path);
+    ASSERT_TRUE(loaded.has_value()) << checkpointer.getLastError();
+    ASSERT_EQ(loaded->memoryDumps.size(), 2u);
+    EXPECT_EQ(loaded->memoryDumps[0].data, std::vector<uint8_t>(4 * PAGE, 0xAA));
+    EXPECT_EQ(loaded->signals.blocked, 0x1234u);
+
+    // Stream reader indeksli imajın dump'larını okumayı reddeder
+    CheckpointStreamReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_TRUE(reader.readHeader().has_value());
+    MemoryDump dump;
+    EXPECT_FALSE(reader.nextDump(dump));
+    EXPECT_FALSE(reader.getLastError().empty());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(RealProcessCheckpointTest, IndexedImageKeepsThreads) {
+    std::string path = "/tmp/checkpoint_image_threads_" + std::to_string(getpid()) + ".rchk";
+    auto cp = makeBase();
+    for (pid_t tid : {4242, 4243}) {
+        RealProcessCheckpoint::ThreadState thread;
+        thread.tid = tid;
+        thread.registers.rip = 0x400000 + tid;
+        thread.registers.hasFPU = true;
+        thread.registers.fpuState.assign(512, static_cast<uint8_t>(tid));
+        cp.threads.push_back(thread);
+    }
+
+    RealProcessCheckpointer checkpointer;
+    ASSERT_TRUE(checkpointer.saveCheckpoint(cp, path, CheckpointFileFormat::INDEXED))
+        << checkpointer.getLastError();
+
+    MappedCheckpointImage image;
+    ASSERT_TRUE(image.open(path)) << image.getLastError();
+    ASSERT_EQ(image.metadata().threads.size(), 2u);
+    ASSERT_EQ(image.dumpCount(), 1u);
+
+    auto loaded = checkpointer.loadCheckpoint(path);
+    ASSERT_TRUE(loaded.has_value()) << checkpointer.getLastError();
+    ASSERT_EQ(loaded->threads.size(), cp.threads.size());
+    for (size_t i = 0; i < cp.threads.size(); ++i) {
+        EXPECT_EQ(loaded->threads[i].tid, cp.threads[i].tid);
+        EXPECT_EQ(loaded->threads[i].registers.rip, cp.threads[i].registers.rip);
+        EXPECT_EQ(loaded->threads[i].registers.fpuState, cp.threads[i].registers.fpuState);
+    }
+    EXPECT_EQ(loaded->memoryDumps[0].data, std::vector<uint8_t>(4 * PAGE, 0xAA));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(RealProcessCheckpointTest, IndexedImageRejectsTruncatedFile) {
+    std::string path = "/tmp/checkpoint_image_trunc_" + std::to_string(getpid()) + ".rchk";
+    RealProcessCheckpointer checkpointer;
+    ASSERT_TRUE(checkpointer.saveCheckpoint(makeBase(), path, CheckpointFileFormat::INDEXED));
+
+    ASSERT_EQ(truncate(path.c_str(), 2 * PAGE), 0);
+
+    MappedCheckpointImage image;
+    EXPECT_FALSE(image.open(path));
+    EXPECT_FALSE(image.getLastError().empty());
+    EXPECT_FALSE(checkpointer.loadCheckpoint(path).has_value());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(BatchedMemoryTest, RestoreFromMappedImage) {
+    std::string path = "/tmp/checkpoint_image_live_" + std::to_string(getpid()) + ".rchk";
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto meta = checkpointer.createCheckpointToFile(child, path, "indexed", options,
+                                                    CheckpointFileFormat::INDEXED);
+    if (!meta) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    MappedCheckpointImage image;
+    ASSERT_TRUE(image.open(path)) << image.getLastError();
+    auto index = image.findDump(reinterpret_cast<uint64_t>(mapping));
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(image.dumpData(*index)[0], 0x11);
+
+    // Child'ın kopyasını boz, sonra imajdan geri yükle
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    auto result = checkpointer.restoreFromImage(child, image, restoreOptions);
+    EXPECT_TRUE(result.success) << result.errorMessage;
+    EXPECT_GT(result.memoryRegionsRestored, 0);
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    std::vector<uint8_t> now(page);
+    ASSERT_EQ(ptrace.readMemory(reinterpret_cast<uint64_t>(mapping), now.data(), page),
+              PtraceError::SUCCESS);
+    EXPECT_EQ(now, std::vector<uint8_t>(page, 0x11));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(BatchedMemoryTest, RestoreMapsImagePayloadsIntoTarget) {
+    std::string path = "/tmp/checkpoint_image_map_" + std::to_string(getpid()) + ".rchk";
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto meta = checkpointer.createCheckpointToFile(child, path, "mapped", options,
+                                                    CheckpointFileFormat::INDEXED);
+    if (!meta) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    MappedCheckpointImage image;
+    ASSERT_TRUE(image.open(path)) << image.getLastError();
+    EXPECT_EQ(image.path().front(), '/');
+
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    restoreOptions.mapImagePayloads = true;
+    auto result = checkpointer.restoreFromImage(child, image, restoreOptions);
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    EXPECT_GE(result.bytesMapped, page);
+
+    // Bölge artık imaj dosyasına bakıyor, içerik checkpoint'teki gibi
+    ProcFSReader reader;
+    auto maps = reader.getMemoryMaps(child);
+    auto it = std::find_if(maps.begin(), maps.end(), [&](const MemoryRegion& r) {
+        return r.startAddr == reinterpret_cast<uint64_t>(mapping);
+    });
+    ASSERT_NE(it, maps.end());
+    EXPECT_EQ(it->pathname, image.path());
+    EXPECT_TRUE(it->isPrivate);
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    std::vector<uint8_t> now(page);
+    ASSERT_EQ(ptrace.readMemory(reinterpret_cast<uint64_t>(mapping), now.data(), page),
+              PtraceError::SUCCESS);
+    EXPECT_EQ(now, std::vector<uint8_t>(page, 0x11));
+
+    // Private eşleme: target'ın yazması dosyaya gitmez
+    std::vector<uint8_t> poke(page, 0x77);
+    ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), poke.data(), page),
+              PtraceError::SUCCESS);
+    ptrace.detach();
+    image.close();
+    ASSERT_TRUE(image.open(path));
+    auto index = image.findDump(reinterpret_cast<uint64_t>(mapping));
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(image.dumpData(*index)[0], 0x11);
+
+    std::remove(path.c_str());
+}
+
+TEST_F(BatchedMemoryTest, CheckpointKeepsWritesToMappedImagePayloads) {
+    std::string path = "/tmp/checkpoint_image_remap_" + std::to_string(getpid()) + ".rchk";
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto meta = checkpointer.createCheckpointToFile(child, path, "mapped", options,
+                                                    CheckpointFileFormat::INDEXED);
+    if (!meta) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    MappedCheckpointImage image;
+    ASSERT_TRUE(image.open(path)) << image.getLastError();
+    RestoreOptions mapOptions;
+    mapOptions.restoreRegisters = false;
+    mapOptions.restoreFileDescriptors = false;
+    mapOptions.mapImagePayloads = true;
+    auto mapped = checkpointer.restoreFromImage(child, image, mapOptions);
+    ASSERT_TRUE(mapped.success) << mapped.errorMessage;
+    ASSERT_GE(mapped.bytesMapped, page);
+
+    // Restore sonrası yazma: bölgenin yolu imaj dosyası ama içeriği process'in
+    auto write = [&](uint8_t value) {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> bytes(page, value);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), bytes.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    };
+    write(0x77);
+
+    auto checkpoint = checkpointer.createCheckpoint(child, "after_map", options);
+    ASSERT_TRUE(checkpoint.has_value()) << checkpointer.getLastError();
+    auto base = reinterpret_cast<uint64_t>(mapping);
+    auto dump = std::find_if(checkpoint->memoryDumps.begin(), checkpoint->memoryDumps.end(),
+        [&](const MemoryDump& d) { return d.region.startAddr <= base && base < d.region.endAddr; });
+    ASSERT_NE(dump, checkpoint->memoryDumps.end());
+    EXPECT_EQ(dump->data[base - dump->region.startAddr], 0x77);
+
+    write(0x99);
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    auto result = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(result.success) << result.errorMessage;
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    std::vector<uint8_t> now(page);
+    ASSERT_EQ(ptrace.readMemory(base, now.data(), page), PtraceError::SUCCESS);
+    EXPECT_EQ(now, std::vector<uint8_t>(page, 0x77));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(BatchedMemoryTest, RestoreFromPageStoreAndZeroFill) {
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.createCheckpoint(child, "dedup", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    PageStore store;
+    deduplicatePages(*checkpoint, store);
+
+    // İlk sayfayı boz, üçüncü sayfa için sıfır aralığı ekle
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+    MemoryDump zero;
+    zero.region = wholeMapping();
+    zero.region.startAddr += 2 * page;
+    zero.zeroFill = true;
+    zero.isValid = true;
+    checkpoint->memoryDumps.push_back(zero);
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+
+    // Store olmadan pageRefs yazılamaz
+    EXPECT_FALSE(checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions).success);
+
+    auto result = checkpointer.restoreCheckpointEx(child, *checkpoint, store, restoreOptions);
+    EXPECT_TRUE(result.success) << result.errorMessage;
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x11));
+    EXPECT_EQ(dumps[1].data, std::vector<uint8_t>(page, 0x00));
+}
+
+TEST_F(BatchedMemoryTest, IncrementalCheckpointCapturesWrittenAndDiscardedPages) {
+    CheckpointOptions options = CheckpointOptions::incremental();
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto base = checkpointer.createCheckpoint(child, "base", options);
+    if (!base) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    // İlk sayfa yazılır, üçüncüsü boşaltılır (soft-dirty bırakmaz)
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> state(page, 0x44);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), state.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+    ASSERT_TRUE(discardInChild(mapping + 2 * page));
+
+    auto inc = checkpointer.createIncrementalCheckpoint(child, *base, "inc", options);
+    ASSERT_TRUE(inc.has_value()) << checkpointer.getLastError();
+
+    // Soft-dirty yoksa incremental tam bölgeleri alır; sayfa kümesi sadece
+    // destekleyen çekirdekte kesin
+    if (ProcFSReader::softDirtySupported()) {
+        MemoryRegion whole = wholeMapping();
+        std::vector<const MemoryDump*> runs;
+        for (const auto& dump : inc->memoryDumps) {
+            if (dump.region.startAddr < whole.endAddr && dump.region.endAddr > whole.startAddr) {
+                runs.push_back(&dump);
+            }
+        }
+        std::sort(runs.begin(), runs.end(), [](const MemoryDump* a, const MemoryDump* b) {
+            return a->region.startAddr < b->region.startAddr;
+        });
+        ASSERT_EQ(runs.size(), 2u);
+        EXPECT_EQ(runs[0]->region.startAddr, whole.startAddr);
+        EXPECT_EQ(runs[0]->region.size(), page);
+        EXPECT_FALSE(runs[0]->zeroFill);
+        EXPECT_EQ(runs[0]->data, std::vector<uint8_t>(page, 0x44));
+        EXPECT_EQ(runs[1]->region.startAddr, whole.startAddr + 2 * page);
+        EXPECT_EQ(runs[1]->region.size(), page);
+        EXPECT_TRUE(runs[1]->zeroFill);
+    }
+
+    // Zincir restore bozulan iki sayfayı incremental anına döndürür
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping) + 2 * page, junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    auto result = checkpointer.restoreCheckpointChain(child, {*base, *inc}, restoreOptions);
+    ASSERT_TRUE(result.success) << result.errorMessage;
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x44));
+    EXPECT_EQ(dumps[1].data, std::vector<uint8_t>(page, 0x00));
+}
+
+TEST_F(BatchedMemoryTest, DeltaRestoreWritesOnlyChangedPages) {
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.createCheckpoint(child, "delta", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    // Tek sayfa değişir; geri kalan her şey checkpoint ile aynı
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    restoreOptions.deltaRestore = true;
+    restoreOptions.deltaUseSoftDirty = true;
+
+    auto result = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    EXPECT_GT(result.pagesUnchanged, 0u);
+    EXPECT_GE(result.bytesWritten, page);
+    EXPECT_LT(result.bytesWritten, checkpoint->dumpedMemorySize());
+    EXPECT_EQ(result.pagesCompared, result.pagesUnchanged + result.bytesWritten / page);
+
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+        ASSERT_EQ(dumps.size(), 2u);
+        EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x11));
+        EXPECT_EQ(dumps[1].data, std::vector<uint8_t>(page, 0x33));
+    }
+
+    // Soft-dirty çalışıyorsa restore sonunda temizlenen sayfaları ikinci
+    // delta restore okumaz. Destek: yeni yazılmış sayfa kirli görünmeli.
+    ProcFSReader reader;
+    std::vector<uint8_t> probe(16 * page, 0x01);
+    MemoryRegion probeRegion{};
+    probeRegion.startAddr = (reinterpret_cast<uint64_t>(probe.data()) + page - 1) & ~(page - 1);
+    probeRegion.endAddr = probeRegion.startAddr + page;
+    auto dirty = reader.getDirtyPageRanges(getpid(), probeRegion);
+    bool tracked = dirty && !dirty->empty();
+
+    auto again = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(again.success) << again.errorMessage;
+    EXPECT_EQ(again.bytesWritten, 0u);
+    if (tracked) {
+        EXPECT_GT(again.pagesClean, 0u);
+        EXPECT_LT(again.pagesCompared, result.pagesCompared);
+    } else {
+        EXPECT_EQ(again.pagesClean, 0u);
+    }
+}
+
+TEST_F(BatchedMemoryTest, DeltaRestoreRewritesDiscardedPages) {
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.createCheckpoint(child, "delta", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    restoreOptions.deltaRestore = true;
+    restoreOptions.deltaUseSoftDirty = true;
+
+    // İlk restore bir şey yazmalı ki soft-dirty temizlensin
+    {
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(page, 0x99);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), page),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+    }
+    auto first = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(first.success) << first.errorMessage;
+
+    // Soft-dirty temizlendikten sonra boşaltılan sayfa bit'siz sıfır okunur
+    ASSERT_TRUE(discardInChild(mapping + 2 * page));
+
+    auto second = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(second.success) << second.errorMessage;
+    EXPECT_GE(second.bytesWritten, page);
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x11));
+    EXPECT_EQ(dumps[1].data, std::vector<uint8_t>(page, 0x33));
+}
+
+TEST_F(BatchedMemoryTest, DeltaRestoreComparesBytesNotHashes) {
+    CheckpointOptions options;
+    options.saveFileDescriptors = false;
+    options.saveEnvironment = false;
+    options.hashPages = true;
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.createCheckpoint(child, "delta", options);
+    if (!checkpoint) {
+        GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+    }
+
+    // Bayat hash canlı sayfayla eşleşir ama byte'lar farklı (çakışma gibi)
+    auto base = reinterpret_cast<uint64_t>(mapping);
+    auto dump = std::find_if(checkpoint->memoryDumps.begin(), checkpoint->memoryDumps.end(),
+        [&](const MemoryDump& d) { return d.region.startAddr <= base && base < d.region.endAddr; });
+    ASSERT_NE(dump, checkpoint->memoryDumps.end());
+    ASSERT_FALSE(dump->pageHashes.empty());
+    std::fill_n(dump->data.begin() + (base - dump->region.startAddr), page, 0x77);
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreRegisters = false;
+    restoreOptions.restoreFileDescriptors = false;
+    restoreOptions.deltaRestore = true;
+
+    auto result = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    EXPECT_GE(result.bytesWritten, page);
+
+    PtraceController ptrace;
+    ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+    auto dumps = ptrace.dumpMemoryRegions({wholeMapping()});
+    ASSERT_EQ(dumps.size(), 2u);
+    EXPECT_EQ(dumps[0].data, std::vector<uint8_t>(page, 0x77));
+}
+
+TEST(ZeroPageRestoreTest, DiscardZeroPagesUsesMadvise) {
+    const size_t size = 32 * 4096;
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(p, MAP_FAILED);
+    std::memset(p, 0x55, size);
+
+    pid_t child = fork();
+    if (child == 0) {
+        while (true) pause();
+    }
+
+    MemoryRegion region{};
+    region.startAddr = reinterpret_cast<uint64_t>(p);
+    region.endAddr = region.startAddr + size;
+    region.readable = true;
+    region.writable = true;
+    region.isPrivate = true;
+
+    RealProcessCheckpoint checkpoint;
+    checkpoint.memoryMap.push_back(region);
+    MemoryDump zero;
+    zero.region = region;
+    zero.zeroFill = true;
+    zero.isValid = true;
+    checkpoint.memoryDumps.push_back(zero);
+
+    RestoreOptions options;
+    options.restoreRegisters = false;
+    options.restoreFileDescriptors = false;
+    options.discardZeroPages = true;
+
+    RealProcessCheckpointer checkpointer;
+    auto result = checkpointer.restoreCheckpointEx(child, checkpoint, options);
+
+    std::vector<uint8_t> now(size, 0xFF);
+    PtraceController ptrace;
+    if (result.success && ptrace.attach(child) == PtraceError::SUCCESS) {
+        ptrace.readMemory(region.startAddr, now.data(), size);
+        ptrace.detach();
+    }
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+    munmap(p, size);
+
+    if (!result.success && result.errorMessage.find("attach") != std::string::npos) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+    EXPECT_TRUE(result.success) << result.errorMessage;
+    EXPECT_EQ(now, std::vector<uint8_t>(size, 0));
+}
+
+TEST(HugePageRestoreTest, PrefaultsHugePagesBeforeWriting) {
+    if (!transparentHugePagesEnabled()) {
+        GTEST_SKIP() << "transparent huge pages disabled";
+    }
+    const uint64_t huge = PtraceController::HUGE_PAGE_SIZE;
+    void* base = nullptr;
+    uint8_t* area = mapHugeAligned(base);
+    ASSERT_NE(area, nullptr);
+
+    // Child'da bölge hiç fault edilmemiş durumda
+    pid_t child = fork();
+    if (child == 0) {
+        while (true) pause();
+    }
+
+    MemoryRegion region{};
+    region.startAddr = reinterpret_cast<uint64_t>(area);
+    region.endAddr = region.startAddr + 2 * huge;
+    region.readable = true;
+    region.writable = true;
+    region.isPrivate = true;
+    region.hugePages = true;
+
+    RealProcessCheckpoint checkpoint;
+    checkpoint.memoryMap.push_back(region);
+    MemoryDump dump;
+    dump.region = region;
+    dump.data.assign(region.size(), 0x5A);
+    dump.isValid = true;
+    checkpoint.memoryDumps.push_back(dump);
+
+    RestoreOptions options;
+    options.restoreRegisters = false;
+    options.restoreFileDescriptors = false;
+
+    RealProcessCheckpointer checkpointer;
+    auto result = checkpointer.restoreCheckpointEx(child, checkpoint, options);
+
+    std::vector<uint8_t> now(region.size(), 0);
+    PtraceController ptrace;
+    if (result.success && ptrace.attach(child) == PtraceError::SUCCESS) {
+        ptrace.readMemory(region.startAddr, now.data(), now.size());
+        ptrace.detach();
+    }
+    std::vector<MemoryRegion> smaps;
+    ProcFSReader().readSmaps(child, smaps);
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+    munmap(base, 3 * huge);
+
+    if (!result.success && result.errorMessage.find("attach") != std::string::npos) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    EXPECT_EQ(now, std::vector<uint8_t>(region.size(), 0x5A));
+    if (result.bytesPrefaulted == 0) {
+        GTEST_SKIP() << "MADV_POPULATE_WRITE not supported by this kernel";
+    }
+    EXPECT_EQ(result.bytesPrefaulted, region.size());
+
+    auto it = std::find_if(smaps.begin(), smaps.end(), [&](const MemoryRegion& r) {
+        return region.startAddr >= r.startAddr && region.startAddr < r.endAddr;
+    });
+    ASSERT_NE(it, smaps.end());
+    EXPECT_GT(it->anonHugeBytes, 0u);
+}
+
+class LazyRestoreTest : public ::testing::Test {
+protected:
+    static constexpr size_t PAGES = 64;
+    static constexpr size_t SIZE = PAGES * 4096;
+
+    pid_t child = -1;
+    uint8_t* mapping = nullptr;
+    int cmd[2] = {-1, -1};
+    int reply[2] = {-1, -1};
+    RealProcessCheckpointer checkpointer;
+    std::optional<RealProcessCheckpoint> checkpoint;
+
+    void SetUp() override {
+        if (!LazyRestoreSession::isSupported()) {
+            GTEST_SKIP() << "userfaultfd / pidfd_getfd not available";
+        }
+
+        void* p = mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(p, MAP_FAILED);
+        mapping = static_cast<uint8_t*>(p);
+        for (size_t i = 0; i < SIZE; ++i) mapping[i] = static_cast<uint8_t>(i / 4096 + 1);
+
+        // Child her komutta bölgeyi doğrular: sayfa i'nin her byte'ı i+1
+        ASSERT_EQ(pipe(cmd), 0);
+        ASSERT_EQ(pipe(reply), 0);
+        child = fork();
+        if (child == 0) {
+            char c;
+            while (read(cmd[0], &c, 1) == 1) {
+                char ok = 'Y';
+                for (size_t i = 0; i < SIZE; ++i) {
+                    if (mapping[i] != static_cast<uint8_t>(i / 4096 + 1)) ok = 'N';
+                }
+                if (write(reply[1], &ok, 1) != 1) break;
+            }
+            _exit(0);
+        }
+
+        // Child read'de bloklanınca checkpoint al (stack sabit), sonra
+        // child'ın kopyasını boz
+        ASSERT_EQ(ask(), 'Y');
+        ASSERT_TRUE(waitInRead());
+        CheckpointOptions options;
+        options.saveFileDescriptors = false;
+        options.saveEnvironment = false;
+        checkpoint = checkpointer.createCheckpoint(child, "lazy", options);
+        if (!checkpoint) {
+            GTEST_SKIP() << "checkpoint not possible here: " << checkpointer.getLastError();
+        }
+
+        PtraceController ptrace;
+        ASSERT_EQ(ptrace.attach(child), PtraceError::SUCCESS);
+        std::vector<uint8_t> junk(SIZE, 0);
+        ASSERT_EQ(ptrace.writeMemory(reinterpret_cast<uint64_t>(mapping), junk.data(), SIZE),
+                  PtraceError::SUCCESS);
+        ptrace.detach();
+        ASSERT_EQ(ask(), 'N');
+        // Restore stack'i checkpoint anındaki haliyle yazar; child aynı
+        // noktada olmalı
+        ASSERT_TRUE(waitInRead());
+    }
+
+    void TearDown() override {
+        if (child > 0) {
+            kill(child, SIGKILL);
+            waitpid(child, nullptr, 0);
+        }
+        for (int fd : {cmd[0], cmd[1], reply[0], reply[1]}) {
+            if (fd >= 0) close(fd);
+        }
+        if (mapping) munmap(mapping, SIZE);
+    }
+
+    // Doğrulama turu; cevap gelmezse 'T'
+    char ask() {
+        char c = 'v';
+        if (write(cmd[1], &c, 1) != 1) return 'E';
+        struct pollfd pfd = {reply[0], POLLIN, 0};
+        if (poll(&pfd, 1, 5000) != 1 || read(reply[0], &c, 1) != 1) return 'T';
+        return c;
+    }
+
+    // Child cmd pipe'ında read(2)'de bekleyene kadar
+    bool waitInRead() {
+        std::string expected = "0 0x" + std::to_string(cmd[0]) + " ";
+        for (int i = 0; i < 5000; ++i) {
+            std::ifstream in("/proc/" + std::to_string(child) + "/syscall");
+            std::string line;
+            std::getline(in, line);
+            if (line.compare(0, expected.size(), expected) == 0) return true;
+            usleep(1000);
+        }
+        return false;
+    }
+
+    RestoreOptions lazyOptions(bool prefetch) const {
+        RestoreOptions options;
+        options.restoreRegisters = false;
+        options.restoreFileDescriptors = false;
+        options.lazyEagerBytes = SIZE / 2;
+        options.lazyPrefetch = prefetch;
+        return options;
+    }
+};
+
+TEST_F(LazyRestoreTest, ServesFaultsFromCheckpoint) {
+    std::unique_ptr<LazyRestoreSession> session;
+    auto result = checkpointer.restoreLazy(child, *checkpoint, session, lazyOptions(false));
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    ASSERT_NE(session, nullptr) << (result.warnings.empty() ? "" : result.warnings.back());
+    EXPECT_GE(result.bytesDeferred, SIZE);
+
+    // Sayfalar ancak child dokununca gelir
+    EXPECT_EQ(ask(), 'Y');
+    auto stats = session->getStats();
+    EXPECT_GT(stats.faultsServed, 0u);
+    EXPECT_GE(stats.pagesFaulted, PAGES);
+    EXPECT_EQ(stats.pagesPrefetched, 0u);
+
+    session->finish();
+    EXPECT_TRUE(session->isComplete());
+    EXPECT_EQ(ask(), 'Y');
+}
+
+TEST_F(LazyRestoreTest, PrefetchCompletesInBackground) {
+    std::unique_ptr<LazyRestoreSession> session;
+    auto result = checkpointer.restoreLazy(child, *checkpoint, session, lazyOptions(true));
+    ASSERT_TRUE(result.success) << result.errorMessage;
+    ASSERT_NE(session, nullptr) << (result.warnings.empty() ? "" : result.warnings.back());
+
+    ASSERT_TRUE(session->wait(5000));
+    auto stats = session->getStats();
+    EXPECT_EQ(stats.pagesFaulted + stats.pagesPrefetched + stats.pagesDiscarded, stats.pagesTotal);
+    EXPECT_GT(stats.pagesPrefetched, 0u);
+    EXPECT_EQ(ask(), 'Y');
+}
+
+TEST_F(BatchedMemoryTest, ParasiteRunsBatchInOneRoundTrip) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+    LinuxRegisters before{};
+    ASSERT_EQ(ptrace.getRegisters(before), PtraceError::SUCCESS);
+
+    ParasiteStub parasite(child);
+    ASSERT_TRUE(parasite.install()) << parasite.getLastError();
+
+    SyscallBatch batch;
+    size_t map = batch.addMmap(0, 2 * page, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS);
+    size_t protect = batch.addMprotect(0, 2 * page, PROT_READ | PROT_WRITE);
+    batch.useResult(protect, 0, map);
+    size_t open = batch.addOpen("/dev/null", O_RDONLY);
+    size_t dup = batch.addDup2(0, 77);
+    batch.useResult(dup, 0, open);
+    size_t close = batch.addClose(0);
+    batch.useResult(close, 0, open);
+    size_t pid = batch.add(SYS_getpid);
+
+    SyscallBatchResult result;
+    ASSERT_TRUE(parasite.execute(batch, result)) << parasite.getLastError();
+    EXPECT_EQ(result.roundTrips, 1u);
+    EXPECT_EQ(result.executed, batch.size());
+    EXPECT_TRUE(result.succeeded(map));
+    EXPECT_EQ(result.results[protect], 0);
+    EXPECT_EQ(result.results[dup], 77);
+    EXPECT_EQ(result.results[close], 0);
+    EXPECT_EQ(result.results[pid], child);
+
+    char link[64] = {};
+    std::string fdPath = "/proc/" + std::to_string(child) + "/fd/77";
+    ASSERT_GT(readlink(fdPath.c_str(), link, sizeof(link) - 1), 0);
+    EXPECT_STREQ(link, "/dev/null");
+
+    // Yazmaçlar geri yüklendi
+    LinuxRegisters after{};
+    ASSERT_EQ(ptrace.getRegisters(after), PtraceError::SUCCESS);
+    EXPECT_EQ(after.rip, before.rip);
+    EXPECT_EQ(after.rsp, before.rsp);
+
+    // stopOnError: ilk hatadan sonrası çalışmaz
+    SyscallBatch failing;
+    failing.setStopOnError(true);
+    failing.addClose(12345);
+    failing.add(SYS_getpid);
+    ASSERT_TRUE(parasite.execute(failing, result));
+    EXPECT_EQ(result.executed, 1u);
+    EXPECT_EQ(result.results[0], -EBADF);
+    EXPECT_EQ(result.results[1], SyscallBatchResult::NOT_RUN);
+
+    EXPECT_TRUE(parasite.uninstall());
+}
+
+TEST_F(BatchedMemoryTest, ParasiteSplitsLargeBatchesAndRestoresFds) {
+    PtraceController ptrace;
+    if (ptrace.attach(child) != PtraceError::SUCCESS) {
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+
+    // Tek sayfalık alan: 300 komut birkaç tura bölünür, referanslar çözülür
+    ParasiteStub parasite(child, 4096);
+    SyscallBatch batch;
+    size_t first = batch.add(SYS_getpid);
+    for (int i = 0; i < 299; ++i) {
+        size_t cmd = batch.add(SYS_getpgid);
+        batch.useResult(cmd, 0, first);
+    }
+    SyscallBatchResult result;
+    ASSERT_TRUE(parasite.execute(batch, result)) << parasite.getLastError();
+    EXPECT_GT(result.roundTrips, 1u);
+    EXPECT_EQ(result.executed, 300u);
+    EXPECT_EQ(result.results.back(), getpgid(child));
+    parasite.uninstall();
+
+    std::string path = "/tmp/parasite_fd_" + std::to_string(getpid());
+    {
+        std::ofstream file(path);
+        file << "0123456789";
+    }
+    std::vector<ExtendedFDInfo> fds;
+    for (int fd : {41, 40}) {           // Ters sıra: open hedef numaraları çakışabilir
+        ExtendedFDInfo info;
+        info.fd = fd;
+        info.path = path;
+        info.type = FDType::REGULAR_FILE;
+        info.flags = O_RDONLY;
+        info.pos = fd - 36;
+        fds.push_back(info);
+    }
+    ExtendedFDInfo missing;
+    missing.fd = 42;
+    missing.path = path + ".missing";
+    missing.type = FDType::REGULAR_FILE;
+    fds.push_back(missing);
+
+    FDRestorer restorer;
+    ASSERT_EQ(restorer.bindProcess(child), FDError::SUCCESS);
+    auto restored = restorer.restoreAllFDs(fds);
+    EXPECT_EQ(restored.restoredFDs, 2);
+    EXPECT_EQ(restored.failedFDs, 1);
+    EXPECT_EQ(restored.results[2].error, FDError::OPEN_FAILED);
+
+    for (int fd : {40, 41}) {
+        std::ifstream info("/proc/" + std::to_string(child) + "/fdinfo/" + std::to_string(fd));
+        std::string key;
+        long pos = -1;
+        info >> key >> pos;
+        EXPECT_EQ(key, "pos:");
+        EXPECT_EQ(pos, fd - 36);
+    }
+    restorer.unbindProcess();
+    std::remove(path.c_str());
+}
+
+TEST(ThreadGroupCheckpointTest, FreezesAndRestoresEveryThread) {
+    constexpr int WORKERS = 4;
+    pid_t child = fork();
+    if (child == 0) {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < WORKERS; ++i) {
+            workers.emplace_back([] { while (true) pause(); });
+        }
+        while (true) pause();
+    }
+    ASSERT_GT(child, 0);
+
+    ProcFSReader reader;
+    for (int i = 0; i < 500 && reader.getThreadIds(child).size() < WORKERS + 1; ++i) {
+        usleep(1000);
+    }
+    auto tids = reader.getThreadIds(child);
+    ASSERT_EQ(tids.size(), static_cast<size_t>(WORKERS + 1));
+
+    {
+        PtraceController probe;
+        if (probe.freezeThreadGroup(child) != PtraceError::SUCCESS) {
+            kill(child, SIGKILL);
+            waitpid(child, nullptr, 0);
+            GTEST_SKIP() << "ptrace not permitted in this environment";
+        }
+        auto frozen = probe.getFrozenThreads();
+        EXPECT_EQ(frozen.front(), child);
+        std::sort(frozen.begin(), frozen.end());
+        EXPECT_EQ(frozen, tids);
+        EXPECT_EQ(probe.getFreezeStats().threads, tids.size());
+        EXPECT_EQ(reader.getProcessState(child), LinuxProcessState::STOPPED);
+    }
+
+    RealProcessCheckpointer checkpointer;
+    CheckpointOptions options = CheckpointOptions::minimal();
+    options.saveRegisters = true;
+    auto checkpoint = checkpointer.createCheckpoint(child, "threads", options);
+    ASSERT_TRUE(checkpoint.has_value()) << checkpointer.getLastError();
+    ASSERT_EQ(checkpoint->threads.size(), static_cast<size_t>(WORKERS));
+    for (const auto& thread : checkpoint->threads) {
+        EXPECT_NE(thread.tid, child);
+        EXPECT_NE(std::find(tids.begin(), tids.end(), thread.tid), tids.end());
+        EXPECT_NE(thread.registers.rip, 0u);
+        EXPECT_TRUE(thread.registers.hasFPU);
+    }
+    const auto& stats = checkpointer.getLastFreezeStats();
+    EXPECT_EQ(stats.threads, tids.size());
+    EXPECT_GT(stats.freezeNanos, 0u);
+    EXPECT_GT(stats.stoppedNanos, 0u);
+
+    // v6 serileştirme thread bölümünü taşır
+    auto restoredCopy = RealProcessCheckpoint::deserialize(checkpoint->serialize());
+    ASSERT_EQ(restoredCopy.threads.size(), checkpoint->threads.size());
+    for (size_t i = 0; i < restoredCopy.threads.size(); ++i) {
+        EXPECT_EQ(restoredCopy.threads[i].tid, checkpoint->threads[i].tid);
+        EXPECT_EQ(restoredCopy.threads[i].registers.rip, checkpoint->threads[i].registers.rip);
+        EXPECT_EQ(restoredCopy.threads[i].registers.fpuState, checkpoint->threads[i].registers.fpuState);
+    }
+
+    RestoreOptions restoreOptions;
+    restoreOptions.restoreMemory = false;
+    restoreOptions.validateBeforeRestore = false;
+    auto result = checkpointer.restoreCheckpointEx(child, *checkpoint, restoreOptions);
+    EXPECT_TRUE(result.success) << result.errorMessage;
+    EXPECT_EQ(result.registersRestored, WORKERS + 1);
+
+    // Serbest bırakıldı: grup tekrar durdurulabilir, thread'ler yerinde
+    EXPECT_EQ(kill(child, 0), 0);
+    PtraceController again;
+    ASSERT_EQ(again.freezeThreadGroup(child), PtraceError::SUCCESS);
+    EXPECT_EQ(again.getFrozenThreads().size(), tids.size());
+    again.detach();
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+}
+
+// ============================================================================
+// TraceeSupervisor Tests
+// ============================================================================
+
+TEST(TraceeSupervisorTest, InterruptsDumpsAndResumesManyTracees) {
+    std::vector<pid_t> children;
+    for (int i = 0; i < 4; ++i) {
+        pid_t child = fork();
+        if (child == 0) {
+            while (true) pause();
+        }
+        ASSERT_GT(child, 0);
+        children.push_back(child);
+    }
+    auto cleanup = [&children] {
+        for (pid_t child : children) {
+            kill(child, SIGKILL);
+            waitpid(child, nullptr, 0);
+        }
+    };
+
+    {
+        TraceeSupervisor supervisor;
+        ASSERT_TRUE(supervisor.isValid());
+        if (supervisor.add(children[0]) != PtraceError::SUCCESS) {
+            cleanup();
+            GTEST_SKIP() << "ptrace not permitted in this environment";
+        }
+        for (size_t i = 1; i < children.size(); ++i) {
+            ASSERT_EQ(supervisor.add(children[i]), PtraceError::SUCCESS);
+        }
+        EXPECT_EQ(supervisor.add(children[0]), PtraceError::ALREADY_TRACED);
+
+        std::vector<pid_t> dumped;
+        supervisor.setStopHandler([&](pid_t pid) {
+            EXPECT_EQ(supervisor.getState(pid), TraceeSupervisor::TraceeState::Dumping);
+            dumped.push_back(pid);
+            return pid != children[0];      // İlki durmuş kalsın
+        });
+        std::vector<pid_t> exited;
+        supervisor.setExitHandler([&](pid_t pid, int status) {
+            EXPECT_TRUE(WIFSIGNALED(status));
+            exited.push_back(pid);
+        });
+
+        EXPECT_EQ(supervisor.interruptAll(), children.size());
+        ASSERT_TRUE(supervisor.waitForAllStopped(5000));
+        EXPECT_EQ(dumped.size(), children.size());
+        EXPECT_EQ(supervisor.getState(children[0]), TraceeSupervisor::TraceeState::Stopped);
+        EXPECT_EQ(supervisor.count(TraceeSupervisor::TraceeState::Running), children.size() - 1);
+
+        EXPECT_EQ(supervisor.resume(children[0]), PtraceError::SUCCESS);
+        EXPECT_EQ(supervisor.getState(children[0]), TraceeSupervisor::TraceeState::Running);
+
+        // Çıkış pidfd / SIGCHLD ile fark edilir
+        kill(children[1], SIGKILL);
+        for (int i = 0; i < 100 && exited.empty(); ++i) {
+            supervisor.poll(50);
+        }
+        ASSERT_EQ(exited, std::vector<pid_t>{children[1]});
+        EXPECT_EQ(supervisor.getState(children[1]), TraceeSupervisor::TraceeState::Exited);
+
+        // Çalışan tracee interrupt edilip bırakılır
+        EXPECT_EQ(supervisor.remove(children[2]), PtraceError::SUCCESS);
+        EXPECT_FALSE(supervisor.contains(children[2]));
+        EXPECT_EQ(dumped.size(), children.size());      // remove handler çağırmaz
+    }
+
+    cleanup();
+}
+
+// ============================================================================
+// Group Checkpoint Tests
+// ============================================================================
+
+// Kök process desenli bir mapping'i fork ile torunla paylaşır (COW) ve
+// torunu biçer
+class GroupCheckpointTest : public ::testing::Test {
+protected:
+    static constexpr size_t PAGES = 32;
+    size_t page = 0;
+    uint8_t* mapping = nullptr;
+    pid_t root = -1;
+    pid_t grandchild = -1;
+    std::string cgroupDir;
+
+    void SetUp() override {
+        page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        mapping = static_cast<uint8_t*>(mmap(nullptr, PAGES * page, PROT_READ | PROT_WRITE,
+                                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        ASSERT_NE(mapping, MAP_FAILED);
+        for (size_t p = 0; p < PAGES; ++p) {
+            std::memset(mapping + p * page, 0x5a, page);
+            mapping[p * page] = static_cast<uint8_t>(p);
+        }
+
+        root = fork();
+        if (root == 0) {
+            if (fork() == 0) {
+                while (true) pause();
+            }
+            while (true) {
+                waitpid(-1, nullptr, WNOHANG);
+                usleep(1000);
+            }
+        }
+        ASSERT_GT(root, 0);
+
+        for (int i = 0; i < 500 && grandchild < 0; ++i) {
+            auto tree = buildProcessTree(root);
+            if (!tree.children.empty()) grandchild = tree.children.front().pid;
+            else usleep(1000);
+        }
+        ASSERT_GT(grandchild, 0);
+    }
+
+    void TearDown() override {
+        if (grandchild > 0) {
+            kill(grandchild, SIGKILL);
+            for (int i = 0; i < 500 && kill(grandchild, 0) == 0; ++i) usleep(1000);
+        }
+        if (root > 0) {
+            kill(root, SIGKILL);
+            waitpid(root, nullptr, 0);
+        }
+        if (mapping && mapping != MAP_FAILED) munmap(mapping, PAGES * page);
+        for (int i = 0; !cgroupDir.empty() && i < 500 && rmdir(cgroupDir.c_str()) != 0; ++i) {
+            usleep(1000);
+        }
+    }
+
+    bool ptraceAllowed() {
+        PtraceController probe;
+        if (probe.attach(root) != PtraceError::SUCCESS) return false;
+        probe.detach();
+        return true;
+    }
+
+    bool running(pid_t pid) {
+        ProcFSReader reader;
+        for (int i = 0; i < 500; ++i) {
+            if (reader.getProcessState(pid) != LinuxProcessState::STOPPED) return true;
+            usleep(1000);
+        }
+        return false;
+    }
+};
+
+TEST_F(GroupCheckpointTest, DumpsWholeTreeAndSharesForkedPages) {
+    if (!ptraceAllowed()) GTEST_SKIP() << "ptrace not permitted in this environment";
+
+    GroupCheckpointOptions options;
+    options.freeze = GroupFreezeMode::Signal;
+    options.workers = 2;
+    ProcessGroupCheckpointer group(options);
+    checkpoint::MetricsRegistry registry;
+    group.setMetricsRegistry(registry);
+
+    auto image = group.checkpointTree(root);
+    ASSERT_TRUE(image.has_value()) << group.getLastError();
+    ASSERT_EQ(image->members.size(), 2u);
+    EXPECT_EQ(image->members[0].pid, root);
+    EXPECT_EQ(image->members[1].pid, grandchild);
+    EXPECT_EQ(image->members[1].ppid, root);
+    EXPECT_EQ(image->freezeMode, GroupFreezeMode::Signal);
+
+    // Torunun desenli sayfaları kökünkilerle aynı frame / içerik
+    EXPECT_GE(image->frameHits + image->contentHits, PAGES);
+    EXPECT_LT(image->pages->storedBytes(), image->dumpedBytes);
+    for (const auto& member : image->members) {
+        for (const auto& dump : member.checkpoint.memoryDumps) {
+            EXPECT_TRUE(dump.data.empty());
+        }
+    }
+
+    auto trace = registry.getLastTrace("group.checkpoint");
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_TRUE(trace->success);
+    EXPECT_EQ(trace->counter("members"), 2u);
+    EXPECT_GT(trace->stageNanos("dump"), 0u);
+
+    // Durdurulanlar devam ettirildi
+    EXPECT_TRUE(running(root));
+    EXPECT_TRUE(running(grandchild));
+
+    std::string path = "/tmp/group_checkpoint_test_" + std::to_string(getpid()) + ".rgrp";
+    std::string error;
+    ASSERT_TRUE(image->save(path, &error)) << error;
+
+    auto member = GroupCheckpoint::loadMember(path, grandchild, &error);
+    ASSERT_TRUE(member.has_value()) << error;
+    auto address = reinterpret_cast<uint64_t>(mapping);
+    // Komşu anonim mapping'le birleşmiş olabilir
+    auto dump = std::find_if(member->memoryDumps.begin(), member->memoryDumps.end(),
+                             [address](const MemoryDump& d) {
+                                 return d.region.startAddr <= address && address < d.region.endAddr;
+                             });
+    ASSERT_NE(dump, member->memoryDumps.end());
+    size_t offset = address - dump->region.startAddr;
+    ASSERT_GE(dump->data.size(), offset + PAGES * page);
+    EXPECT_EQ(std::memcmp(dump->data.data() + offset, mapping, PAGES * page), 0);
+
+    auto loaded = GroupCheckpoint::load(path, &error);
+    ASSERT_TRUE(loaded.has_value()) << error;
+    ASSERT_EQ(loaded->members.size(), 2u);
+    EXPECT_EQ(loaded->members[1].name, image->members[1].name);
+    EXPECT_EQ(loaded->pages->pageCount(), image->pages->pageCount());
+    auto materialized = loaded->materialize(grandchild);
+    ASSERT_TRUE(materialized.has_value());
+    EXPECT_EQ(materialized->dumpedMemorySize(), member->dumpedMemorySize());
+    EXPECT_FALSE(GroupCheckpoint::loadMember(path, 1, &error).has_value());
+    std::remove(path.c_str());
+}
+
+TEST_F(GroupCheckpointTest, FreezesDedicatedCgroup) {
+    std::string dir = "/sys/fs/cgroup/freezer/group_checkpoint_test_" + std::to_string(getpid());
+    if (mkdir(dir.c_str(), 0755) != 0) GTEST_SKIP() << "cgroup v1 freezer not available";
+    cgroupDir = dir;
+    {
+        std::ofstream procs(dir + "/cgroup.procs");
+        procs << root << std::endl << grandchild << std::endl;
+    }
+    if (!ptraceAllowed()) GTEST_SKIP() << "ptrace not permitted in this environment";
+
+    GroupCheckpointOptions options;
+    options.freeze = GroupFreezeMode::Cgroup;
+    options.checkpoint = CheckpointOptions::minimal();
+    ProcessGroupCheckpointer group(options);
+    auto image = group.checkpointTree(root);
+    ASSERT_TRUE(image.has_value()) << group.getLastError();
+    EXPECT_EQ(image->freezeMode, GroupFreezeMode::Cgroup);
+    EXPECT_EQ(image->members.size(), 2u);
+
+    std::string state;
+    std::ifstream(dir + "/freezer.state") >> state;
+    EXPECT_EQ(state, "THAWED");
+    EXPECT_TRUE(running(root));
+    EXPECT_TRUE(running(grandchild));
+}
+
+TEST(DaemonPolicyTest, ParsesJobsAndLimits) {
+    std::string error;
+    auto policy = DaemonPolicy::parse(
+        "# fleet\n"
+        "directory /tmp/cp   # imajlar\n"
+        "socket /tmp/cp.sock\n"
+        "workers 3\n"
+        "io_limit 64M\n"
+        "cpu_limit 0.5\n"
+        "fork_snapshot off\n"
+        "job web pid 1234 every 30s keep 5\n"
+        "job batch cgroup batch.slice every 250ms\n", &error);
+    ASSERT_TRUE(policy) << error;
+    EXPECT_EQ(policy->directory, "/tmp/cp");
+    EXPECT_EQ(policy->controlSocket, "/tmp/cp.sock");
+    EXPECT_EQ(policy->workers, 3u);
+    EXPECT_EQ(policy->ioBytesPerSec, 64u * 1024 * 1024);
+    EXPECT_DOUBLE_EQ(policy->cpuCores, 0.5);
+    EXPECT_FALSE(policy->checkpoint.forkSnapshot);
+    ASSERT_EQ(policy->jobs.size(), 2u);
+    EXPECT_EQ(policy->jobs[0].pid, 1234);
+    EXPECT_EQ(policy->jobs[0].interval, std::chrono::seconds(30));
+    EXPECT_EQ(policy->jobs[0].keep, 5u);
+    EXPECT_EQ(policy->jobs[1].target, DaemonJob::Target::Cgroup);
+    EXPECT_EQ(policy->jobs[1].interval, std::chrono::milliseconds(250));
+    EXPECT_EQ(policy->jobs[1].keep, 0u);
+
+    EXPECT_FALSE(DaemonPolicy::parse("workers 2\njob a.b pid 1 every 1s\n", &error));
+    EXPECT_EQ(error.rfind("line 2:", 0), 0u) << error;
+    EXPECT_FALSE(DaemonPolicy::parse("job a pid 1 every 1s\njob a pid 2 every 1s\n", &error));
+    EXPECT_FALSE(DaemonPolicy::parse("io_limit fast\n", &error));
+}
+
+TEST(RateLimiterTest, ReservationsWaitForDebt) {
+    RateLimiter limiter(10000, 0.1);     // 1000 token'lık kova
+
+    auto start = std::chrono::steady_clock::now();
+    limiter.acquire(1000);               // Dolu kova: beklemez
+    limiter.charge(1000);                // 1000 borç
+    limiter.acquire(1000);               // 2000 borç -> ~200ms
+    auto waited = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(waited, std::chrono::milliseconds(150));
+    EXPECT_LT(waited, std::chrono::seconds(2));
+
+    // İptal edilince beklemeden döner
+    limiter.setCancelled(true);
+    start = std::chrono::steady_clock::now();
+    limiter.acquire(100000);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+}
+
+// Kontrol socket'ine istekleri gönderip bağlantı kapanana kadar oku
+std::string controlRequest(const std::string& socketPath, const std::string& requests) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        if (fd >= 0) close(fd);
+        return "";
+    }
+    send(fd, requests.data(), requests.size(), MSG_NOSIGNAL);
+    std::string reply;
+    char chunk[4096];
+    ssize_t n;
+    while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+        reply.append(chunk, static_cast<size_t>(n));
+    }
+    close(fd);
+    return reply;
+}
+
+TEST(CheckpointDaemonTest, SchedulesSnapshotsServesControlAndPrunes) {
+    pid_t child = fork();
+    if (child == 0) {
+        while (true) pause();
+    }
+
+    std::string dir = (std::filesystem::temp_directory_path() /
+                       ("daemon_test_" + std::to_string(getpid()))).string();
+    std::string sock = dir + ".sock";
+    std::filesystem::remove_all(dir);
+
+    std::string error;
+    auto policy = DaemonPolicy::parse(
+        "directory " + dir + "\n"
+        "socket " + sock + "\n"
+        "workers 2\n"
+        "io_limit 256M\n"
+        "job svc pid " + std::to_string(child) + " every 100ms keep 2\n", &error);
+    ASSERT_TRUE(policy) << error;
+
+    CheckpointDaemon daemon(*policy);
+    ASSERT_TRUE(daemon.start()) << daemon.getLastError();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto stats = daemon.stats();
+        if (stats.snapshots >= 3 || (stats.failures > 0 && stats.snapshots == 0)) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    if (daemon.stats().snapshots == 0) {
+        daemon.stop();
+        kill(child, SIGKILL);
+        waitpid(child, nullptr, 0);
+        std::filesystem::remove_all(dir);
+        GTEST_SKIP() << "ptrace not permitted in this environment";
+    }
+
+    std::string reply = controlRequest(sock, "status\nsnapshot svc\nlist svc\nbogus\nquit\n");
+    EXPECT_NE(reply.find("OK snapshots="), std::string::npos) << reply;
+    EXPECT_NE(reply.find("OK 1 snapshots"), std::string::npos) << reply;
+    EXPECT_NE(reply.find("ERR unknown command: bogus"), std::string::npos) << reply;
+    EXPECT_NE(reply.find("OK bye"), std::string::npos) << reply;
+
+    daemon.stop();
+    EXPECT_FALSE(daemon.isRunning());
+    EXPECT_FALSE(std::filesystem::exists(sock));
+
+    auto stats = daemon.stats();
+    EXPECT_GE(stats.snapshots, 4u);
+    EXPECT_GT(stats.filesRemoved, 0u);
+
+    // Retention: pid başına en yeni 2 imaj; yarım ".part" kalmaz
+    auto images = daemon.listImages("svc");
+    ASSERT_EQ(images.size(), 2u);
+    size_t entries = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        (void)entry;
+        entries++;
+    }
+    EXPECT_EQ(entries, 2u);
+
+    RealProcessCheckpointer checkpointer;
+    auto checkpoint = checkpointer.loadCheckpoint(dir + "/" + images.back());
+    ASSERT_TRUE(checkpoint) << checkpointer.getLastError();
+    EXPECT_EQ(checkpoint->info.pid, child);
+    EXPECT_FALSE(checkpoint->memoryDumps.empty());
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(CheckpointDaemonTest, ControlSocketIsPrivateAndNeverReplacesFiles) {
+    std::string base = (std::filesystem::temp_directory_path() /
+                        ("daemon_sock_" + std::to_string(getpid()))).string();
+    std::string sock = base + ".sock";
+    std::filesystem::remove_all(base);
+
+    // Socket yolunda normal bir dosya: silinmez, start başarısız
+    std::ofstream(sock) << "keep me";
+    DaemonPolicy policy;
+    policy.directory = base;
+    policy.controlSocket = sock;
+    {
+        CheckpointDaemon daemon(policy);
+        EXPECT_FALSE(daemon.start());
+        EXPECT_NE(daemon.getLastError().find("not a socket"), std::string::npos);
+    }
+    std::string content;
+    std::getline(std::ifstream(sock), content);
+    EXPECT_EQ(content, "keep me");
+    std::filesystem::remove(sock);
+
+    CheckpointDaemon daemon(policy);
+    ASSERT_TRUE(daemon.start()) << daemon.getLastError();
+    struct stat st{};
+    ASSERT_EQ(lstat(sock.c_str(), &st), 0);
+    EXPECT_TRUE(S_ISSOCK(st.st_mode));
+    EXPECT_EQ(st.st_mode & 0777, 0600u);
+    EXPECT_NE(controlRequest(sock, "status\nquit\n").find("OK snapshots=0"), std::string::npos);
+    daemon.stop();
+    std::filesystem::remove_all(base);
+}
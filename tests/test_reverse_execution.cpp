@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 #include "real_process/file_operation.hpp"
 #include "real_process/reverse_executor.hpp"
+#include "real_process/file_backup.hpp"
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <sys/syscall.h>
+#include <sys/wait.h>
 
 using namespace checkpoint::real_process;
 
@@ -511,3 +515,546 @@ TEST_F(FileOperationTest, FullWorkflow) {
     
     tracker.stopTracking();
 }
+
+// ============================================================================
+// SyscallInterceptor Tests
+// ============================================================================
+
+TEST_F(FileOperationTest, InterceptorTrackedSyscallsFollowFlags) {
+    SyscallInterceptor interceptor;
+    interceptor.interceptAll(false);
+    EXPECT_TRUE(interceptor.getTrackedSyscalls().empty());
+
+    interceptor.interceptWrite(true);
+    auto tracked = interceptor.getTrackedSyscalls();
+    EXPECT_NE(std::find(tracked.begin(), tracked.end(), SYS_write), tracked.end());
+    EXPECT_EQ(std::find(tracked.begin(), tracked.end(), SYS_openat), tracked.end());
+    EXPECT_EQ(interceptor.getTraceMode(), SyscallTraceMode::PtraceSyscall);
+}
+
+TEST_F(FileOperationTest, TrackerWritePreImageAndAppend) {
+    std::string testPath = createTestFile("preimage.txt", "0123456789");
+    FileTrackingOptions options;
+    options.coalesceWrites = false;             // ham diff'ler
+    FileOperationTracker tracker(options);
+    tracker.startTracking(getpid());
+
+    // Sonu aşan yazma: ön görüntü dosya sonunda kısalır
+    tracker.beforeWrite(3, testPath, 8, 4);
+    {
+        std::fstream file(testPath, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        file << "WXYZ";
+    }
+    tracker.afterWrite(3, testPath, 8, 4, true);
+
+    // Append: offset dosya sonundan bulunur
+    tracker.beforeWrite(3, testPath, -1, 2);
+    {
+        std::ofstream file(testPath, std::ios::app | std::ios::binary);
+        file << "!!";
+    }
+    tracker.afterWrite(3, testPath, -1, 2, true);
+    EXPECT_EQ(tracker.getCachedFileCount(), 1u);
+
+    auto ops = tracker.getLog().getAllOperations();
+    ASSERT_EQ(ops.size(), 2u);
+    ASSERT_EQ(ops[0].diffs.size(), 1u);
+    EXPECT_EQ(std::string(ops[0].diffs[0].oldData.begin(), ops[0].diffs[0].oldData.end()), "89");
+    EXPECT_EQ(std::string(ops[0].diffs[0].newData.begin(), ops[0].diffs[0].newData.end()), "WXYZ");
+    EXPECT_EQ(ops[0].newSize, 12u);
+    EXPECT_EQ(ops[1].offset, 12);
+    ASSERT_EQ(ops[1].diffs.size(), 1u);
+    EXPECT_TRUE(ops[1].diffs[0].oldData.empty());
+    EXPECT_EQ(ops[1].originalSize, 12u);
+    EXPECT_EQ(ops[1].newSize, 14u);
+
+    ReverseOptions opts;
+    opts.createBackups = false;
+    ReverseExecutor executor(opts);
+    auto result = executor.reverseAll(tracker.getLog());
+    EXPECT_TRUE(result.allSucceeded);
+    EXPECT_EQ(readFile(testPath), "0123456789");
+
+    tracker.stopTracking();
+}
+
+TEST_F(FileOperationTest, TrackerRejectsMismatchedAfterWrite) {
+    std::string testPath = createTestFile("mismatch.txt", "0123456789");
+    FileTrackingOptions options;
+    options.coalesceWrites = false;
+    FileOperationTracker tracker(options);
+    tracker.startTracking(getpid());
+
+    // Ön görüntü 2..4 için alındı, yazma 6'ya gitti
+    tracker.beforeWrite(3, testPath, 2, 2);
+    {
+        std::fstream file(testPath, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(6);
+        file << "AB";
+    }
+    tracker.afterWrite(3, testPath, 6, 2, true);
+
+    auto ops = tracker.getLog().getAllOperations();
+    ASSERT_EQ(ops.size(), 1u);
+    EXPECT_FALSE(ops[0].isReversible);
+
+    tracker.stopTracking();
+}
+
+TEST_F(FileOperationTest, InterceptorCapturesWritesThroughFdTable) {
+    std::string path = testDir + "/intercepted.txt";
+    // 1<>: kesmeden aç, dup2 ile stdout'a taşı; >>: O_APPEND
+    std::string script = "printf XY 1<>" + path + "; printf ZZ >>" + path;
+
+    for (auto mode : {SyscallTraceMode::Seccomp, SyscallTraceMode::PtraceSyscall}) {
+        if (mode == SyscallTraceMode::Seccomp && !SyscallInterceptor::isSeccompTraceSupported()) {
+            continue;
+        }
+        createTestFile("intercepted.txt", "0123456789");
+        FileTrackingOptions options;
+        options.includePaths.push_back(testDir);
+        auto tracker = std::make_shared<FileOperationTracker>(options);
+
+        SyscallInterceptor interceptor;
+        interceptor.setTraceMode(mode);
+        interceptor.setTracker(tracker);
+        pid_t pid = interceptor.launch("/bin/sh", {"sh", "-c", script});
+        if (pid < 0) {
+            GTEST_SKIP() << "ptrace not permitted";
+        }
+        tracker->startTracking(pid);
+        interceptor.startInterception();
+        interceptor.run();
+        ASSERT_EQ(readFile(path), "XY23456789ZZ");
+
+        auto ops = tracker->getLog().getAllOperations();
+        ASSERT_EQ(ops.size(), 2u) << "mode " << static_cast<int>(mode);
+        EXPECT_EQ(ops[0].type, FileOperationType::WRITE);
+        EXPECT_EQ(ops[0].path, std::filesystem::canonical(path).string());
+        EXPECT_EQ(ops[0].offset, 0);
+        ASSERT_EQ(ops[0].diffs.size(), 1u);
+        EXPECT_EQ(std::string(ops[0].diffs[0].oldData.begin(), ops[0].diffs[0].oldData.end()), "01");
+        EXPECT_EQ(std::string(ops[0].diffs[0].newData.begin(), ops[0].diffs[0].newData.end()), "XY");
+        EXPECT_EQ(ops[1].offset, 10);
+        EXPECT_EQ(ops[1].newSize, 12u);
+
+        ReverseOptions opts;
+        opts.createBackups = false;
+        ReverseExecutor executor(opts);
+        EXPECT_TRUE(executor.reverseAll(tracker->getLog()).allSucceeded);
+        EXPECT_EQ(readFile(path), "0123456789");
+    }
+}
+
+TEST_F(FileOperationTest, FileBackupStrategyCopiesWithoutFullBuffer) {
+    std::string payload;
+    for (int i = 0; i < 300 * 1024; ++i) payload.push_back(static_cast<char>('a' + i % 26));
+    std::string src = createTestFile("backup_src.bin", payload);
+
+    FileBackupStrategy strategy;
+    std::string error;
+    auto method = strategy.copyFile(src, testDir + "/backup_default.bin", &error);
+    EXPECT_NE(method, BackupMethod::None) << error;
+    EXPECT_EQ(readFile(testDir + "/backup_default.bin"), payload);
+
+    // Hedef daha büyükse kesilir; sadece buffer yolu
+    createTestFile("backup_buffered.bin", std::string(400 * 1024, 'Z'));
+    FileBackupOptions options;
+    options.allowReflink = false;
+    options.allowCopyFileRange = false;
+    options.bufferSize = 4096;
+    FileBackupStrategy buffered(options);
+    EXPECT_EQ(buffered.copyFile(src, testDir + "/backup_buffered.bin"), BackupMethod::Buffered);
+    EXPECT_EQ(readFile(testDir + "/backup_buffered.bin"), payload);
+    EXPECT_EQ(buffered.getStats().buffered, 1u);
+    EXPECT_EQ(buffered.getStats().bytesCopied, payload.size());
+
+    EXPECT_EQ(strategy.copyFile(testDir + "/missing.bin", testDir + "/x.bin"), BackupMethod::None);
+}
+
+TEST_F(FileOperationTest, TrackerDiskBackupsForTruncateAndUnlink) {
+    std::string content(8192, 'L');
+    content += "tail";
+    std::string logPath = createTestFile("big.log", content);
+    std::string otherPath = createTestFile("other.log", content);
+
+    FileTrackingOptions options;
+    options.maxFileSize = 16;                   // bellekte tutulamayacak kadar büyük
+    options.backupDir = testDir + "/preimages";
+    FileOperationTracker tracker(options);
+    tracker.startTracking(getpid());
+
+    tracker.beforeTruncate(logPath, 0);
+    std::filesystem::resize_file(logPath, 0);
+    tracker.afterTruncate(logPath, 0, true);
+
+    tracker.beforeUnlink(otherPath);
+    std::filesystem::remove(otherPath);
+    tracker.afterUnlink(otherPath, true);
+
+    auto ops = tracker.getLog().getAllOperations();
+    ASSERT_EQ(ops.size(), 2u);
+    for (const auto& op : ops) {
+        EXPECT_FALSE(op.backupPath.empty());
+        EXPECT_FALSE(op.originalContent.has_value());
+        EXPECT_TRUE(op.diffs.empty());
+        EXPECT_TRUE(op.isReversible);
+        EXPECT_LT(op.estimatedMemoryUsage(), 1024u);
+    }
+    EXPECT_EQ(tracker.getBackupFileCount(), 2u);
+
+    // Log yeniden yüklendiğinde yedek yolu korunur
+    auto restored = FileOperation::deserialize(ops[0].serialize());
+    EXPECT_EQ(restored.backupPath, ops[0].backupPath);
+
+    ReverseOptions opts;
+    opts.createBackups = false;
+    ReverseExecutor executor(opts);
+    EXPECT_TRUE(executor.reverseAll(tracker.getLog()).allSucceeded);
+    EXPECT_EQ(readFile(logPath), content);
+    EXPECT_EQ(readFile(otherPath), content);
+
+    tracker.removeBackupFiles();
+    EXPECT_EQ(tracker.getBackupFileCount(), 0u);
+    EXPECT_FALSE(std::filesystem::exists(ops[0].backupPath));
+    tracker.stopTracking();
+}
+
+TEST_F(FileOperationTest, ByteRangeSetMergesAndSubtracts) {
+    ByteRangeSet set;
+    set.add(10, 20);
+    set.add(30, 40);
+    set.add(20, 25);                            // değen aralık birleşir
+    EXPECT_EQ(set.intervalCount(), 2u);
+    EXPECT_EQ(set.coveredBytes(), 25u);
+
+    auto gaps = set.subtract(5, 45);
+    ASSERT_EQ(gaps.size(), 3u);
+    using Range = std::pair<off_t, off_t>;
+    EXPECT_EQ(gaps[0], Range(5, 10));
+    EXPECT_EQ(gaps[1], Range(25, 30));
+    EXPECT_EQ(gaps[2], Range(40, 45));
+    EXPECT_TRUE(set.covers(12, 24));
+    EXPECT_FALSE(set.covers(24, 31));
+
+    set.add(0, 100);
+    EXPECT_EQ(set.intervalCount(), 1u);
+    EXPECT_TRUE(set.subtract(0, 100).empty());
+}
+
+TEST_F(FileOperationTest, LogCoalescesRewritesWithinEpoch) {
+    const size_t block = 4096;
+    std::string original(2 * block, 'o');
+    std::string testPath = createTestFile("rewrite.bin", original);
+
+    FileOperationTracker tracker;               // coalesceWrites varsayılan açık
+    tracker.startTracking(getpid());
+    tracker.onCheckpointCreated(1);
+
+    auto writeAt = [&](off_t offset, const std::string& data) {
+        tracker.beforeWrite(3, testPath, offset, data.size());
+        std::fstream file(testPath, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file << data;
+        file.close();
+        tracker.afterWrite(3, testPath, offset, data.size(), true);
+    };
+
+    for (int i = 0; i < 1000; ++i) {
+        writeAt(0, std::string(block, static_cast<char>('a' + i % 26)));
+    }
+    // Kısmen örtülü: sadece [block, block + 100) yeni
+    writeAt(block - 100, std::string(200, 'x'));
+
+    auto& log = tracker.getLog();
+    auto ops = log.getOperationsSince(1);
+    ASSERT_EQ(ops.size(), 2u);
+    EXPECT_EQ(log.getCoalescedOperationCount(), 999u);
+    ASSERT_EQ(ops[0].diffs.size(), 1u);
+    EXPECT_EQ(ops[0].diffs[0].oldData, std::vector<uint8_t>(block, 'o'));
+    ASSERT_EQ(ops[1].diffs.size(), 1u);
+    EXPECT_EQ(ops[1].diffs[0].offset, static_cast<off_t>(block));
+    EXPECT_EQ(ops[1].diffs[0].oldData.size(), 100u);
+    EXPECT_EQ(ops[1].diffs[0].newData, std::vector<uint8_t>(100, 'x'));
+
+    // Yeni epoch: aynı blok yeniden kaydedilir
+    tracker.onCheckpointCreated(2);
+    writeAt(0, std::string(block, 'z'));
+    EXPECT_EQ(log.getOperationsSince(2).size(), 1u);
+
+    ReverseOptions opts;
+    opts.createBackups = false;
+    ReverseExecutor executor(opts);
+    EXPECT_TRUE(executor.reverseToCheckpoint(log, 1).allSucceeded);
+    EXPECT_EQ(readFile(testPath), original);
+    tracker.stopTracking();
+}
+
+TEST_F(FileOperationTest, LogCoalescingResetsOnNonWriteAndKeepsGrowth) {
+    FileOperationLog log;
+    log.setCoalesceWrites(true);
+
+    auto makeWrite = [](off_t offset, size_t len, size_t origSize, size_t newSize) {
+        FileOperation op;
+        op.type = FileOperationType::WRITE;
+        op.path = "/data/f";
+        op.offset = offset;
+        op.originalSize = origSize;
+        op.newSize = newSize;
+        FileContentDiff diff;
+        diff.offset = offset;
+        diff.oldData.assign(len, 'p');
+        op.diffs.push_back(diff);
+        return op;
+    };
+
+    log.recordOperation(makeWrite(0, 10, 10, 10));
+    // Epoch başındaki boyutun ötesi örtülü, ama boyut değiştiği için kayıt kalır
+    log.recordOperation(makeWrite(10, 0, 10, 20));
+    log.recordOperation(makeWrite(5, 10, 20, 20));      // [5,10) örtülü, [10,15) base ötesi
+    EXPECT_EQ(log.getOperationCount(), 2u);
+    EXPECT_EQ(log.getCoalescedBytes(), 10u);
+
+    FileOperation truncate;
+    truncate.type = FileOperationType::TRUNCATE;
+    truncate.path = "/data/f";
+    log.recordOperation(truncate);
+    log.recordOperation(makeWrite(0, 10, 10, 10));      // sıfırlandı: yeniden kaydedilir
+    EXPECT_EQ(log.getOperationCount(), 4u);
+    EXPECT_EQ(log.getAllOperations().back().diffs[0].oldData.size(), 10u);
+}
+
+TEST_F(FileOperationTest, JournalPersistsAndRecoversOperations) {
+    std::string journal = testDir + "/journal";
+    auto makeWrite = [](const std::string& path, char fill) {
+        FileOperation op;
+        op.type = FileOperationType::WRITE;
+        op.path = path;
+        op.originalSize = 64;
+        op.newSize = 64;
+        FileContentDiff diff;
+        diff.offset = 0;
+        diff.oldData.assign(64, fill);
+        op.diffs.push_back(diff);
+        return op;
+    };
+
+    {
+        FileOperationLog log;
+        log.recordOperation(makeWrite("/data/before", 'm'));     // journal öncesi, aktarılır
+        ASSERT_TRUE(log.openJournal(journal));
+        EXPECT_TRUE(log.isJournaled());
+        log.markCheckpoint(1);
+        log.recordOperation(makeWrite("/data/a", 'a'));
+        log.recordOperation(makeWrite("/data/b", 'b'));
+        EXPECT_EQ(log.getOperationsSince(1).size(), 2u);
+        EXPECT_GT(log.getJournalSize(), 3 * 64u);
+    }
+
+    FileOperationLog recovered;
+    ASSERT_TRUE(recovered.openJournal(journal));
+    ASSERT_EQ(recovered.getOperationCount(), 3u);
+    auto since = recovered.getOperationsSince(1);
+    ASSERT_EQ(since.size(), 2u);
+    EXPECT_EQ(since[0].path, "/data/a");
+    ASSERT_EQ(since[1].diffs.size(), 1u);
+    EXPECT_EQ(since[1].diffs[0].oldData, std::vector<uint8_t>(64, 'b'));
+    EXPECT_EQ(recovered.getOperationsForFile("/data/before")[0].diffs[0].oldData.size(), 64u);
+
+    // Yeni id'ler kurtarılanlarla çakışmaz
+    uint64_t id = recovered.recordOperation(makeWrite("/data/c", 'c'));
+    EXPECT_GT(id, since[1].operationId);
+
+    recovered.closeJournal();
+    EXPECT_FALSE(recovered.isJournaled());
+    EXPECT_EQ(recovered.getAllOperations().back().diffs[0].oldData, std::vector<uint8_t>(64, 'c'));
+}
+
+TEST_F(FileOperationTest, JournalRotatesAtCheckpointsAndDropsSegments) {
+    std::string journal = testDir + "/journal";
+    FileOperationLog log;
+    ASSERT_TRUE(log.openJournal(journal));
+
+    auto makeCreate = [](const std::string& path) {
+        FileOperation op;
+        op.type = FileOperationType::CREATE;
+        op.path = path;
+        return op;
+    };
+    log.recordOperation(makeCreate("/data/1"));
+    log.markCheckpoint(10);
+    log.markCheckpoint(11);                 // arada kayıt yok: aynı segment
+    log.recordOperation(makeCreate("/data/2"));
+    log.markCheckpoint(12);
+    log.recordOperation(makeCreate("/data/3"));
+    EXPECT_EQ(log.getSegmentCount(), 3u);
+
+    auto countSegments = [&journal]() {
+        size_t n = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(journal)) {
+            if (entry.path().extension() == ".fol") n++;
+        }
+        return n;
+    };
+    EXPECT_EQ(countSegments(), 3u);
+
+    log.clearOperationsBeforeCheckpoint(12);
+    EXPECT_EQ(log.getOperationCount(), 1u);
+    EXPECT_EQ(log.getSegmentCount(), 1u);
+    EXPECT_EQ(countSegments(), 1u);
+
+    FileOperationLog reopened;
+    ASSERT_TRUE(reopened.openJournal(journal));
+    ASSERT_EQ(reopened.getOperationCount(), 1u);
+    EXPECT_EQ(reopened.getOperationsSince(12)[0].path, "/data/3");
+}
+
+TEST_F(FileOperationTest, JournalTruncatesTornTail) {
+    std::string journal = testDir + "/journal";
+    {
+        FileOperationLog log;
+        ASSERT_TRUE(log.openJournal(journal));
+        FileOperation op;
+        op.type = FileOperationType::CREATE;
+        op.path = "/data/kept";
+        log.recordOperation(op);
+        op.path = "/data/torn";
+        log.recordOperation(op);
+    }
+
+    std::string segment = journal + "/00000001.fol";
+    auto size = std::filesystem::file_size(segment);
+    std::filesystem::resize_file(segment, size - 3);     // son kayıt yarım
+
+    FileOperationLog recovered;
+    ASSERT_TRUE(recovered.openJournal(journal));
+    ASSERT_EQ(recovered.getOperationCount(), 1u);
+    EXPECT_EQ(recovered.getAllOperations()[0].path, "/data/kept");
+    EXPECT_EQ(std::filesystem::file_size(segment), recovered.getJournalSize());
+
+    FileOperation next;
+    next.type = FileOperationType::CREATE;
+    next.path = "/data/next";
+    recovered.recordOperation(next);
+    EXPECT_EQ(recovered.getAllOperations().back().path, "/data/next");
+}
+
+TEST_F(FileOperationTest, ReverseDependenciesFollowPathsAndDirectories) {
+    auto makeOp = [](FileOperationType type, const std::string& path,
+                     const std::string& originalPath = "") {
+        FileOperation op;
+        op.type = type;
+        op.path = path;
+        op.originalPath = originalPath;
+        return op;
+    };
+    // Geri alma sırasında (en yeni önce)
+    std::vector<FileOperation> ops = {
+        makeOp(FileOperationType::WRITE, "/w/e/a"),                 // 0
+        makeOp(FileOperationType::RENAME, "/w/e", "/w/d"),          // 1: d -> e
+        makeOp(FileOperationType::WRITE, "/w/d/a"),                 // 2
+        makeOp(FileOperationType::WRITE, "/w/d/b"),                 // 3
+        makeOp(FileOperationType::WRITE, "/w/d/a"),                 // 4
+        makeOp(FileOperationType::WRITE, "/w/x"),                   // 5
+        makeOp(FileOperationType::MKDIR, "/w/d"),                   // 6
+    };
+    auto deps = ReverseExecutor::buildDependencies(ops);
+    using Deps = std::vector<size_t>;
+    EXPECT_EQ(deps[0], Deps{});
+    EXPECT_EQ(deps[1], Deps({0}));              // /w/e altındaki yazmadan sonra
+    EXPECT_EQ(deps[2], Deps({1}));              // rename'in eski ucu /w/d
+    EXPECT_EQ(deps[3], Deps({1}));
+    EXPECT_EQ(deps[4], Deps({1, 2}));
+    EXPECT_EQ(deps[5], Deps{});                 // bağımsız
+    EXPECT_EQ(deps[6], Deps({1, 3, 4}));
+}
+
+TEST_F(FileOperationTest, ParallelReverseKeepsPerPathOrder) {
+    FileTrackingOptions options;
+    options.coalesceWrites = false;             // her yazma ayrı ön görüntü
+    FileOperationTracker tracker(options);
+    tracker.startTracking(getpid());
+
+    auto trackedWrite = [&](const std::string& path, const std::string& data) {
+        tracker.beforeWrite(3, path, 0, data.size());
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file << data;
+        file.close();
+        tracker.afterWrite(3, path, 0, data.size(), true);
+    };
+
+    const int fileCount = 100;
+    for (int i = 0; i < fileCount; ++i) {
+        std::string path = createTestFile("par" + std::to_string(i) + ".txt", "orig");
+        for (const char* step : {"AAAA", "BBBB", "CCCC"}) trackedWrite(path, step);
+    }
+
+    // Dizin taşıma: içindeki dosyanın yazmaları iki yanında
+    std::string dirA = testDir + "/dirA", dirB = testDir + "/dirB";
+    std::filesystem::create_directories(dirA);
+    createTestFile("dirA/inner.txt", "orig");
+    trackedWrite(dirA + "/inner.txt", "1111");
+    tracker.beforeRename(dirA, dirB);
+    std::filesystem::rename(dirA, dirB);
+    tracker.afterRename(dirA, dirB, true);
+    trackedWrite(dirB + "/inner.txt", "2222");
+
+    ReverseOptions opts;
+    opts.createBackups = false;
+    opts.parallelism = 8;
+    ReverseExecutor executor(opts);
+    auto result = executor.reverseAll(tracker.getLog());
+    EXPECT_TRUE(result.allSucceeded);
+    EXPECT_EQ(result.workersUsed, 8u);
+    EXPECT_EQ(result.successCount, static_cast<size_t>(fileCount * 3 + 3));
+
+    for (int i = 0; i < fileCount; ++i) {
+        EXPECT_EQ(readFile(testDir + "/par" + std::to_string(i) + ".txt"), "orig");
+    }
+    EXPECT_FALSE(std::filesystem::exists(dirB));
+    EXPECT_EQ(readFile(dirA + "/inner.txt"), "orig");
+    tracker.stopTracking();
+}
+
+TEST_F(FileOperationTest, InterceptorSeccompStopsOnlyOnTrackedSyscalls) {
+    if (!SyscallInterceptor::isSeccompTraceSupported()) {
+        GTEST_SKIP() << "SECCOMP_RET_TRACE not supported";
+    }
+    std::string out = testDir + "/traced.txt";
+    // 200 stat (izlenmeyen) + birkaç write/open; /bin/true çocuğu da izlenmeli
+    std::string script = "i=0; while [ $i -lt 200 ]; do i=$((i+1)); [ -e /nonexistent ]; done; "
+                         "echo hi > " + out + "; /bin/true; echo again >> " + out;
+
+    auto runTraced = [&](SyscallTraceMode mode, uint64_t& stops, size_t& opens) {
+        SyscallInterceptor interceptor;
+        interceptor.setTraceMode(mode);
+        opens = 0;
+        interceptor.setSyscallCallback([&](pid_t, long nr, const std::vector<uint64_t>&) {
+            if (nr == SYS_openat) ++opens;
+        });
+        if (interceptor.launch("/bin/sh", {"sh", "-c", script}) < 0) {
+            return false;
+        }
+        interceptor.startInterception();
+        interceptor.run();
+        EXPECT_FALSE(interceptor.isAttached());
+        EXPECT_TRUE(WIFEXITED(interceptor.getExitStatus()));
+        EXPECT_EQ(WEXITSTATUS(interceptor.getExitStatus()), 0);
+        stops = interceptor.getStopCount();
+        return true;
+    };
+
+    uint64_t seccompStops = 0, ptraceStops = 0;
+    size_t seccompOpens = 0, ptraceOpens = 0;
+    if (!runTraced(SyscallTraceMode::Seccomp, seccompStops, seccompOpens)) {
+        GTEST_SKIP() << "ptrace not permitted";
+    }
+    EXPECT_EQ(readFile(out), "hi\nagain\n");
+
+    ASSERT_TRUE(runTraced(SyscallTraceMode::PtraceSyscall, ptraceStops, ptraceOpens));
+    EXPECT_GE(seccompOpens, 2u);
+    EXPECT_GE(ptraceOpens, 2u);
+    EXPECT_LT(seccompStops, 200u);
+    EXPECT_GT(ptraceStops, 400u);
+}
@@ -2,10 +2,29 @@
 #include "rollback/rollback_engine.hpp"
 #include "state/state_manager.hpp"
 #include "logger/operation_logger.hpp"
+#include "rollback/state_delta.hpp"
 #include <filesystem>
+#include <fstream>
+#include <thread>
 
 using namespace checkpoint;
 
+namespace {
+
+struct GameState {
+    int32_t level = 0;
+    std::string player;
+    std::vector<uint32_t> inventory;
+    
+    static constexpr auto schemaFields() {
+        return std::make_tuple(schemaField("level", &GameState::level),
+                               schemaField("player", &GameState::player),
+                               schemaField("inventory", &GameState::inventory));
+    }
+};
+
+} // namespace
+
 class RollbackTest : public ::testing::Test {
 protected:
     std::filesystem::path testDir = "test_rollback";
@@ -274,3 +293,185 @@ TEST_F(RollbackTest, MaxUndoHistory) {
     
     EXPECT_LE(undoCount, 3);
 }
+
+// Block Delta Tests
+TEST_F(RollbackTest, BlockDeltaRoundTripsAcrossSizeChanges) {
+    StateData base(3 * BlockDelta::DEFAULT_BLOCK_SIZE + 100);
+    for (size_t i = 0; i < base.size(); ++i) base[i] = static_cast<uint8_t>(i * 7);
+
+    StateData grown = base;
+    grown[10] ^= 0xFF;
+    grown.resize(grown.size() + 5000, 0xAB);
+
+    StateData shrunk(base.begin(), base.begin() + 1000);
+    shrunk[999] = 1;
+
+    for (const auto* target : {&grown, &shrunk, &base}) {
+        auto delta = BlockDelta::compute(base, *target);
+        StateData state = base;
+        ASSERT_TRUE(delta.apply(state));
+        EXPECT_EQ(state, *target);
+        ASSERT_TRUE(delta.revert(state));
+        EXPECT_EQ(state, base);
+    }
+
+    // Tek baytlık değişiklik tek blok tutar
+    StateData small = base;
+    small[5000] ^= 1;
+    auto delta = BlockDelta::compute(base, small);
+    EXPECT_EQ(delta.blocks.size(), 1u);
+    EXPECT_EQ(delta.xorData.size(), BlockDelta::DEFAULT_BLOCK_SIZE);
+    EXPECT_TRUE(BlockDelta::compute(base, base).isIdentity());
+
+    // Yanlış boyuttaki duruma uygulanmaz
+    StateData wrong(10);
+    EXPECT_FALSE(delta.apply(wrong));
+    EXPECT_EQ(wrong.size(), 10u);
+}
+
+TEST_F(RollbackTest, DeltaChainRewindsAndCompacts) {
+    DeltaChain chain;
+    StateData state(64 * 1024, 0);
+    chain.reset(state);
+
+    std::vector<StateData> history;
+    for (OperationId op = 1; op <= 20; ++op) {
+        history.push_back(state);       // op'tan önceki durum
+        state[op * 1000] = static_cast<uint8_t>(op);
+        chain.record(op, state);
+    }
+
+    for (OperationId op : {1, 3, 10, 18, 20}) {
+        auto before = chain.stateBefore(op);
+        ASSERT_TRUE(before.isSuccess()) << before.message;
+        EXPECT_EQ(*before.value, history[op - 1]);
+    }
+    EXPECT_EQ(*chain.stateBefore(21).value, state);
+    EXPECT_LT(chain.memoryUsage(), state.size() * 4);     // 20 tam kopya yerine
+
+    chain.setCompactionInterval(5);
+    EXPECT_EQ(chain.deltaCount(), 5u);
+    EXPECT_TRUE(chain.stateBefore(10).isError());
+    EXPECT_EQ(*chain.stateBefore(16).value, history[15]);
+    EXPECT_EQ(chain.base(), history[15]);
+}
+
+TEST_F(RollbackTest, IncrementalRollbackReplaysDeltasInReverse) {
+    StateData base(256 * 1024, 0x11);
+    auto cpResult = stateManager->createCheckpoint("Base", base);
+    ASSERT_TRUE(cpResult.isSuccess());
+    logger->logOperation(OperationType::Checkpoint, "Base checkpoint", *cpResult.value);
+
+    StateData state = base;
+    for (int i = 0; i < 50; ++i) {
+        state[i * 4096 + 17] = static_cast<uint8_t>(i);
+        ASSERT_TRUE(rollbackEngine->recordStateChange("Update " + std::to_string(i),
+                                                      state, *cpResult.value).isSuccess());
+    }
+    EXPECT_EQ(*stateManager->getCurrentState().value, state);
+    // 50 tam kopya yerine taban + current + küçük deltalar
+    EXPECT_LT(rollbackEngine->getDeltaMemoryUsage(), base.size() * 3);
+
+    auto plan = rollbackEngine->createRollbackPlan(*cpResult.value, RollbackStrategy::Incremental);
+    ASSERT_TRUE(plan.isSuccess());
+    auto result = rollbackEngine->executeRollback(*plan.value);
+    ASSERT_TRUE(result.isSuccess());
+    EXPECT_TRUE(result.value->success);
+    EXPECT_TRUE(result.value->warnings.empty());
+    EXPECT_EQ(*stateManager->getCurrentState().value, base);
+
+    // Undo, rollback öncesi durumu deltadan geri getirir
+    ASSERT_TRUE(rollbackEngine->undoRollback().isSuccess());
+    EXPECT_EQ(*stateManager->getCurrentState().value, state);
+}
+
+TEST_F(RollbackTest, IncrementalRollbackFallsBackWhenStateDiverges) {
+    auto cpResult = stateManager->createCheckpoint("Base", createTestData("base"));
+    ASSERT_TRUE(cpResult.isSuccess());
+    logger->logOperation(OperationType::Checkpoint, "Base checkpoint", *cpResult.value);
+    rollbackEngine->recordStateChange("Tracked", createTestData("tracked"), *cpResult.value);
+
+    // Zincirin bilmediği değişiklik
+    stateManager->createCheckpoint("Untracked", createTestData("untracked"));
+
+    auto plan = rollbackEngine->createRollbackPlan(*cpResult.value, RollbackStrategy::Incremental);
+    ASSERT_TRUE(plan.isSuccess());
+    auto result = rollbackEngine->executeRollback(*plan.value);
+    ASSERT_TRUE(result.isSuccess());
+    EXPECT_FALSE(result.value->warnings.empty());
+    EXPECT_EQ(*stateManager->getCurrentState().value, createTestData("base"));
+}
+
+TEST_F(RollbackTest, FullRollbackSharesCheckpointBuffer) {
+    auto initial = createTestData(std::string(128 * 1024, 'a'));
+    auto cp1 = *stateManager->createCheckpoint("cp1", initial).value;
+    stateManager->createCheckpoint("cp2", createTestData("later"));
+
+    auto result = rollbackEngine->rollbackToCheckpoint(cp1);
+    ASSERT_TRUE(result.isSuccess());
+    ASSERT_TRUE(result.value->success);
+
+    // Geri yükleme kopya almaz: güncel durum checkpoint'in verisidir
+    auto handle = *stateManager->getCheckpointHandle(cp1).value;
+    EXPECT_EQ(stateManager->getCurrentStateBuffer().data(), handle->getData().data());
+    EXPECT_EQ(*stateManager->getCurrentState().value, initial);
+
+    ASSERT_TRUE(rollbackEngine->undoRollback().isSuccess());
+    EXPECT_EQ(*stateManager->getCurrentState().value, createTestData("later"));
+}
+
+TEST_F(RollbackTest, RollbackFieldsRestoresOnlyNamedFields) {
+    GameState saved{3, "alice", {1, 2, 3}};
+    auto cp = stateManager->createTypedCheckpoint("typed", saved);
+    ASSERT_TRUE(cp.isSuccess());
+    
+    GameState changed{7, "bob", {9}};
+    stateManager->setCurrentTypedState(changed);
+    
+    auto diff = stateManager->getChangedFields<GameState>(*cp.value);
+    ASSERT_TRUE(diff.isSuccess());
+    EXPECT_EQ(diff.value->size(), 3u);
+    
+    auto result = rollbackEngine->rollbackFields<GameState>(*cp.value, {"inventory"});
+    ASSERT_TRUE(result.isSuccess());
+    EXPECT_TRUE(result.value->success);
+    
+    auto current = stateManager->getCurrentTypedState<GameState>();
+    ASSERT_TRUE(current.isSuccess());
+    EXPECT_EQ(current.value->level, 7);
+    EXPECT_EQ(current.value->player, "bob");
+    EXPECT_EQ(current.value->inventory, saved.inventory);
+    
+    // Bilinmeyen alan: durum değişmez
+    auto unknown = rollbackEngine->rollbackFields<GameState>(*cp.value, {"mana"});
+    ASSERT_TRUE(unknown.isSuccess());
+    EXPECT_FALSE(unknown.value->success);
+    EXPECT_EQ(stateManager->getCurrentTypedState<GameState>().value->player, "bob");
+}
+
+TEST_F(RollbackTest, AutoRollbackReportsScrubberCorruption) {
+    auto cp1 = *stateManager->createCheckpoint("cp1", createTestData(std::string(4096, 'a'))).value;
+    {
+        std::fstream f(testDir / (std::to_string(cp1) + ".chkpt"),
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-16, std::ios::end);
+        f.put('\x5A');
+    }
+
+    AutoRollbackManager autoRollback(rollbackEngine, stateManager);
+    std::atomic<int> errors{0};
+    autoRollback.setErrorCallback([&](ErrorCode error, const std::string&) {
+        if (error == ErrorCode::CheckpointCorrupted) errors++;
+    });
+    autoRollback.setCheckInterval(Duration(10));
+    autoRollback.getScrubber().setIdleInterval(Duration(10));
+    autoRollback.setEnabled(true);
+    autoRollback.start();
+    for (int i = 0; i < 200 && errors == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    autoRollback.stop();
+
+    EXPECT_EQ(errors, 1);
+    EXPECT_EQ(autoRollback.getScrubber().getStats().checkpointsVerified, 1u);
+}
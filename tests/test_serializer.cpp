@@ -1,6 +1,18 @@
 #include <gtest/gtest.h>
 #include "core/serializer.hpp"
+#include "core/checksum.hpp"
+#include "core/io_engine.hpp"
+#include "core/shared_buffer.hpp"
+#include "core/binary_io.hpp"
+#include "core/schema.hpp"
+#include <map>
+#include <optional>
+#include <fcntl.h>
+#include <unistd.h>
+#include <filesystem>
+#include <fstream>
 #include <cstring>
+#include <algorithm>
 
 using namespace checkpoint;
 
@@ -120,3 +132,415 @@ TEST_F(SerializerTest, DeserializeInsufficientBuffer) {
     // Daha büyük boyut isteniyor
     EXPECT_FALSE(binarySerializer.deserialize(smallData, &result, sizeof(result)));
 }
+
+TEST_F(SerializerTest, BinaryReaderWriterRoundTrip) {
+    StateData buffer;
+    BinaryWriter writer(buffer);
+    writer.write<uint32_t>(0xDEADBEEF);
+    writer.writeVarint(300);
+    writer.writeVarint(UINT64_MAX);
+    writer.writeString("abc");
+    writer.writeVarString("xyz");
+    writer.writeLE<uint16_t>(0x0102);
+    EXPECT_EQ(buffer.size(), 4 + varintSize(300) + varintSize(UINT64_MAX) + 7 + 4 + 2);
+    EXPECT_EQ(buffer[buffer.size() - 2], 0x02);     // little-endian
+    
+    BinaryReader reader(buffer);
+    EXPECT_EQ(reader.read<uint32_t>(), 0xDEADBEEFu);
+    EXPECT_EQ(reader.readVarint(), 300u);
+    EXPECT_EQ(reader.readVarint(), UINT64_MAX);
+    EXPECT_EQ(reader.readString(), "abc");
+    EXPECT_EQ(reader.readVarString(), "xyz");
+    EXPECT_EQ(reader.readLE<uint16_t>(), 0x0102);
+    EXPECT_TRUE(reader.ok());
+    EXPECT_TRUE(reader.atEnd());
+    
+    // Önceden boyutlanmış tampon taşarsa yazma reddedilir
+    uint8_t small[3];
+    BinaryWriter fixed{std::span<uint8_t>(small)};
+    fixed.write<uint32_t>(1);
+    EXPECT_FALSE(fixed.ok());
+}
+
+TEST_F(SerializerTest, BinaryReaderFailsOnTruncation) {
+    // Uzunluk öneki tampondan büyük: okuma taşmaz, hata kalıcıdır
+    StateData data = {10, 0, 0, 0, 'a', 'b'};
+    BinaryReader reader(data);
+    EXPECT_EQ(reader.readString(), "");
+    EXPECT_FALSE(reader.ok());
+    EXPECT_EQ(reader.read<uint8_t>(), 0);
+    EXPECT_EQ(reader.remaining(), 0u);
+    
+    // Bitmeyen varint
+    StateData varint = {0x80, 0x80};
+    BinaryReader varintReader(varint);
+    uint64_t value = 1;
+    EXPECT_FALSE(varintReader.readVarint(value));
+    EXPECT_EQ(value, 0u);
+    EXPECT_FALSE(varintReader.ok());
+}
+
+namespace {
+
+struct Position {
+    double x = 0;
+    double y = 0;
+    
+    static constexpr auto schemaFields() {
+        return std::make_tuple(schemaField("x", &Position::x), schemaField("y", &Position::y));
+    }
+};
+
+struct Entity {
+    uint64_t id = 0;
+    std::string name;
+    Position position;
+    std::vector<std::string> tags;
+    std::map<std::string, int32_t> stats;
+    std::optional<uint16_t> owner;
+    
+    static constexpr auto schemaFields() {
+        return std::make_tuple(schemaField("id", &Entity::id),
+                               schemaField("name", &Entity::name),
+                               schemaField("position", &Entity::position),
+                               schemaField("tags", &Entity::tags),
+                               schemaField("stats", &Entity::stats),
+                               schemaField("owner", &Entity::owner));
+    }
+};
+
+} // namespace
+
+TEST_F(SerializerTest, SchemaRoundTripsNestedTypes) {
+    Entity entity{42, "orc", {1.5, -2.0}, {"hostile", "boss"}, {{"hp", 90}, {"str", 12}}, 7};
+    
+    auto data = binarySerializer.serializeObject(entity);
+    auto restored = binarySerializer.deserializeObject<Entity>(data);
+    EXPECT_EQ(restored.id, 42u);
+    EXPECT_EQ(restored.name, "orc");
+    EXPECT_EQ(restored.position.y, -2.0);
+    EXPECT_EQ(restored.tags, entity.tags);
+    EXPECT_EQ(restored.stats, entity.stats);
+    EXPECT_EQ(restored.owner, std::optional<uint16_t>(7));
+    
+    // Kesik ya da fazladan byte içeren veri reddedilir
+    data.pop_back();
+    EXPECT_FALSE(schema::decode<Entity>(data).has_value());
+    data.push_back(0);
+    data.push_back(0);
+    EXPECT_FALSE(schema::decode<Entity>(data).has_value());
+}
+
+TEST_F(SerializerTest, SchemaDiffCarriesOnlyChangedFields) {
+    Entity before{1, "orc", {0, 0}, {"a"}, {{"hp", 100}}, std::nullopt};
+    Entity after = before;
+    after.stats["hp"] = 40;
+    after.position.x = 3;
+    
+    std::vector<std::string_view> expected = {"position", "stats"};
+    EXPECT_EQ(schema::changedFields(before, after), expected);
+    
+    auto delta = schema::diff(before, after);
+    EXPECT_LT(delta.size(), schema::encode(after).size());
+    
+    Entity patched = before;
+    ASSERT_TRUE(schema::applyDiff(patched, delta));
+    EXPECT_EQ(schema::encode(patched), schema::encode(after));
+    
+    // Bozuk fark hedefi değiştirmez
+    delta.back() ^= 0xFF;
+    delta.push_back(1);
+    Entity untouched = before;
+    EXPECT_FALSE(schema::applyDiff(untouched, delta));
+    EXPECT_EQ(untouched.stats.at("hp"), 100);
+}
+
+// Codec Tests
+namespace {
+
+// Yarı sıkıştırılabilir sayfa benzeri veri: tekrar eden yapılar + gürültü
+StateData makeHeapLikeData(size_t size) {
+    StateData data(size);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        data[i] = (i % 64 < 40) ? static_cast<uint8_t>(i % 7) : static_cast<uint8_t>(seed >> 24);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_F(SerializerTest, Lz4CodecRoundTrip) {
+    Lz4Codec codec;
+    for (size_t size : {size_t(0), size_t(5), size_t(13), size_t(4096), size_t(100000)}) {
+        auto data = makeHeapLikeData(size);
+        StateData compressed(codec.maxCompressedSize(size));
+        size_t n = codec.compress(data.data(), size, compressed.data(), compressed.size());
+        ASSERT_GT(n, 0u) << "size " << size;
+
+        StateData out(size);
+        ASSERT_TRUE(codec.decompress(compressed.data(), n, out.data(), size)) << "size " << size;
+        EXPECT_EQ(out, data);
+    }
+}
+
+TEST_F(SerializerTest, Lz4CodecRejectsCorruptInput) {
+    Lz4Codec codec;
+    StateData data(8192, 0x5A);
+    StateData compressed(codec.maxCompressedSize(data.size()));
+    size_t n = codec.compress(data.data(), data.size(), compressed.data(), compressed.size());
+    ASSERT_GT(n, 0u);
+    EXPECT_LT(n, data.size() / 10);
+
+    StateData out(data.size());
+    EXPECT_FALSE(codec.decompress(compressed.data(), n - 1, out.data(), out.size()));
+    EXPECT_FALSE(codec.decompress(compressed.data(), n, out.data(), out.size() - 1));
+}
+
+TEST_F(SerializerTest, BinaryCompressShrinksHeapLikeData) {
+    auto data = makeHeapLikeData(1024 * 1024);
+    auto compressed = binarySerializer.compress(data);
+
+    EXPECT_EQ(binarySerializer.getCodec().type(), CodecType::Lz4);
+    EXPECT_LT(compressed.size(), data.size() * 3 / 4);
+    EXPECT_EQ(binarySerializer.decompress(compressed), data);
+}
+
+TEST_F(SerializerTest, ParallelCompressMatchesSerial) {
+    auto data = makeHeapLikeData(1024 * 1024 + 123);
+    auto serial = binarySerializer.compress(data);
+
+    binarySerializer.setCodec(createCodec(CodecType::Lz4), CompressedFrame::DEFAULT_CHUNK_SIZE, 4);
+    auto parallel = binarySerializer.compress(data);
+
+    EXPECT_EQ(serial, parallel);
+    EXPECT_EQ(binarySerializer.decompress(parallel), data);
+}
+
+TEST_F(SerializerTest, DecompressRangeReadsAcrossChunks) {
+    auto data = makeHeapLikeData(300000);
+    binarySerializer.setCodec(createCodec(CodecType::Lz4), 4096);
+    auto compressed = binarySerializer.compress(data);
+
+    CompressedFrame frame;
+    ASSERT_TRUE(frame.open(compressed.data(), compressed.size()));
+    EXPECT_EQ(frame.chunkCount(), (data.size() + 4095) / 4096);
+    EXPECT_EQ(frame.originalSize(), data.size());
+
+    // Chunk sınırını aşan aralık
+    StateData part(10000);
+    ASSERT_TRUE(binarySerializer.decompressRange(compressed, 4000, part.data(), part.size()));
+    EXPECT_TRUE(std::equal(part.begin(), part.end(), data.begin() + 4000));
+
+    // Sınır dışı
+    EXPECT_FALSE(binarySerializer.decompressRange(compressed, data.size() - 10, part.data(), 20));
+}
+
+TEST_F(SerializerTest, IncompressibleChunksStoredRaw) {
+    StateData noise(65536);
+    uint32_t seed = 99;
+    for (auto& b : noise) {
+        seed = seed * 1664525u + 1013904223u;
+        b = static_cast<uint8_t>(seed >> 24);
+    }
+
+    auto compressed = binarySerializer.compress(noise);
+    EXPECT_LE(compressed.size(), noise.size() + CompressedFrame::HEADER_SIZE + sizeof(uint32_t));
+    EXPECT_EQ(binarySerializer.decompress(compressed), noise);
+}
+
+TEST_F(SerializerTest, JsonCompressDefaultsToPassthrough) {
+    StateData data = {'{', '}'};
+    EXPECT_EQ(jsonSerializer.compress(data), data);
+
+    jsonSerializer.setCodec(createCodec(CodecType::Rle));
+    StateData runs(1000, 'a');
+    auto compressed = jsonSerializer.compress(runs);
+    EXPECT_LT(compressed.size(), runs.size());
+    EXPECT_EQ(jsonSerializer.decompress(compressed), runs);
+}
+
+// CRC32C Tests
+TEST_F(SerializerTest, Crc32cKnownVector) {
+    const char* check = "123456789";
+    EXPECT_EQ(crc32c(check, 9), 0xE3069283u);
+    EXPECT_EQ(crc32cSoftware(check, 9), 0xE3069283u);
+    EXPECT_EQ(crc32c(check, 0), 0u);
+}
+
+TEST_F(SerializerTest, Crc32cHardwareMatchesSoftware) {
+    auto data = makeHeapLikeData(70000);
+    // Hizalanmamış başlangıç ve 8'in katı olmayan uzunluklar
+    for (size_t offset : {size_t(0), size_t(1), size_t(3), size_t(7)}) {
+        for (size_t len : {size_t(1), size_t(7), size_t(8), size_t(63), size_t(4096), size_t(65537)}) {
+            EXPECT_EQ(crc32c(data.data() + offset, len), crc32cSoftware(data.data() + offset, len))
+                << crc32cImplementation() << " offset " << offset << " len " << len;
+        }
+    }
+}
+
+TEST_F(SerializerTest, Crc32cStreamingMatchesOneShot) {
+    auto data = makeHeapLikeData(100000);
+    Crc32c stream;
+    for (size_t pos = 0; pos < data.size(); pos += 777) {
+        stream.update(data.data() + pos, std::min<size_t>(777, data.size() - pos));
+    }
+    EXPECT_EQ(stream.value(), crc32c(data.data(), data.size()));
+    EXPECT_EQ(stream.bytes(), data.size());
+    EXPECT_EQ(stream.value(), binarySerializer.calculateChecksum(data));
+}
+
+TEST_F(SerializerTest, VerifyChecksumAcceptsLegacyCrc32) {
+    StateData check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_TRUE(binarySerializer.verifyChecksum(check, 0xCBF43926u));  // eski CRC32
+    EXPECT_TRUE(binarySerializer.verifyChecksum(check, 0xE3069283u));  // CRC32C
+    EXPECT_FALSE(binarySerializer.verifyChecksum(check, 0x12345678u));
+}
+
+TEST_F(SerializerTest, Xxhash64KnownVectors) {
+    EXPECT_EQ(xxhash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(xxhash64("abc", 3), 0x44BC2CF5AD770999ULL);
+
+    // 32 byte'lık blok yolu ve seed farkı
+    std::string longText(100, 'a');
+    EXPECT_EQ(xxhash64(longText.data(), longText.size()), xxhash64(longText.data(), longText.size()));
+    EXPECT_NE(xxhash64(longText.data(), longText.size(), 1), xxhash64(longText.data(), longText.size()));
+}
+
+// IoEngine Tests
+namespace {
+
+std::vector<uint8_t> patternData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>((i * 131) ^ (i >> 9));
+    }
+    return data;
+}
+
+std::string ioTestPath(const char* tag) {
+    return (std::filesystem::temp_directory_path() /
+            ("io_engine_" + std::string(tag) + "_" + std::to_string(getpid()))).string();
+}
+
+} // namespace
+
+TEST_F(SerializerTest, AsyncFileWriterRoundTripOnBothBackends) {
+    auto data = patternData(5 * 1024 * 1024 + 123);
+    std::string path = ioTestPath("roundtrip");
+
+    for (bool useIoUring : {true, false}) {
+        IoEngineOptions options;
+        options.useIoUring = useIoUring;
+        options.bufferSize = 256 * 1024;
+        options.buffers = 3;
+        options.queueDepth = 4;
+
+        // Küçük kopyalı yazmalar + büyük kopyasız blok + kuyruk
+        AsyncFileWriter writer(options);
+        if (!useIoUring) {
+            EXPECT_EQ(writer.backend(), IoBackend::Blocking);
+        }
+        ASSERT_TRUE(writer.open(path));
+        ASSERT_TRUE(writer.write(data.data(), 1000));
+        ASSERT_TRUE(writer.writeStable(data.data() + 1000, 3 * 1024 * 1024));
+        ASSERT_TRUE(writer.write(data.data() + 1000 + 3 * 1024 * 1024,
+                                 data.size() - 1000 - 3 * 1024 * 1024));
+        ASSERT_TRUE(writer.finish(true)) << writer.getLastError();
+        EXPECT_EQ(writer.bytesWritten(), data.size());
+        ASSERT_EQ(std::filesystem::file_size(path), data.size());
+
+        IoEngine engine(options);
+        std::vector<uint8_t> back(data.size());
+        int fd = ::open(path.c_str(), O_RDONLY);
+        ASSERT_GE(fd, 0);
+        std::string error;
+        EXPECT_TRUE(engine.readFully(fd, back.data(), back.size(), 0, 64 * 1024, &error)) << error;
+        EXPECT_EQ(back, data) << ioBackendName(engine.backend());
+
+        // Dosya sonunu aşan okuma hata
+        std::vector<uint8_t> tooMuch(data.size() + 4096);
+        EXPECT_FALSE(engine.readFully(fd, tooMuch.data(), tooMuch.size(), 0, 64 * 1024, &error));
+        EXPECT_EQ(engine.inFlight(), 0u);
+        ::close(fd);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_F(SerializerTest, AsyncFileWriterDirectIoTruncatesPadding) {
+    auto data = patternData(300 * 1024 + 7);
+    std::string path = ioTestPath("direct");
+
+    IoEngineOptions options;
+    options.directIo = true;
+    options.bufferSize = 64 * 1024;
+
+    // Dosya sistemi O_DIRECT desteklemiyorsa normal yazmaya düşer
+    AsyncFileWriter writer(options);
+    ASSERT_TRUE(writer.open(path));
+    ASSERT_TRUE(writer.writeStable(data.data(), data.size()));
+    ASSERT_TRUE(writer.finish()) << writer.getLastError();
+    ASSERT_EQ(std::filesystem::file_size(path), data.size());
+
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> back((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    EXPECT_EQ(back, data);
+    std::filesystem::remove(path);
+}
+
+TEST_F(SerializerTest, SharedBufferSharesAndSlicesWithoutCopy) {
+    auto data = patternData(10000);
+    const uint8_t* raw = data.data();
+    SharedBuffer buffer(std::move(data));
+    EXPECT_EQ(buffer.data(), raw);      // vector sahiplenildi
+
+    SharedBuffer copy = buffer;
+    EXPECT_EQ(copy.data(), raw);
+    EXPECT_TRUE(copy.sharesStorageWith(buffer));
+    EXPECT_EQ(buffer.useCount(), 2);
+
+    auto part = buffer.slice(100, 50);
+    EXPECT_EQ(part.data(), raw + 100);
+    EXPECT_EQ(part.size(), 50u);
+    EXPECT_EQ(part, StateData(raw + 100, raw + 150));
+    EXPECT_TRUE(buffer.slice(20000, 10).empty());
+    EXPECT_EQ(buffer.slice(9990, 100).size(), 10u);
+
+    auto other = SharedBuffer::copyOf(buffer.data(), buffer.size());
+    EXPECT_EQ(other, buffer);
+    EXPECT_FALSE(other.sharesStorageWith(buffer));
+}
+
+TEST_F(SerializerTest, SharedBufferMapFileOutlivesUnlink) {
+    auto data = patternData(200 * 1024 + 3);
+    std::string path = ioTestPath("mapped");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    auto mapped = SharedBuffer::mapFile(path);
+    ASSERT_TRUE(mapped.has_value());
+    std::filesystem::remove(path);
+    EXPECT_EQ(*mapped, data);
+    EXPECT_FALSE(SharedBuffer::mapFile(path).has_value());
+}
+
+TEST_F(SerializerTest, BufferArenaPacksSmallBuffers) {
+    BufferArena arena(4096);
+    std::vector<SharedBuffer> buffers;
+    for (int i = 0; i < 16; ++i) {
+        buffers.push_back(arena.copy(patternData(100 + i)));
+    }
+    EXPECT_EQ(arena.blocksAllocated(), 1u);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(buffers[i], patternData(100 + i));
+        EXPECT_TRUE(buffers[i].sharesStorageWith(buffers[0]));
+    }
+
+    auto large = arena.copy(patternData(3000));
+    EXPECT_FALSE(large.sharesStorageWith(buffers[0]));
+    EXPECT_EQ(arena.blocksAllocated(), 1u);
+}